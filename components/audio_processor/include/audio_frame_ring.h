@@ -0,0 +1,141 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Wait-free single-producer/single-consumer audio frame ring
+ *
+ * Fixed-size frame slots with a per-slot length, built on C11 atomics.
+ * Producer and consumer indices live on separate cache lines and each side
+ * caches the other's index, so the common path touches no shared line.
+ * The producer never blocks: when the ring is full the frame is dropped and
+ * counted as an overrun.
+ *
+ * Exactly one task may produce (claim/commit/push) and one task may consume
+ * (peek/release/pop). Slots are aligned to AUDIO_FRAME_RING_CACHE_LINE and
+ * can be filled in place (e.g., directly by i2s_channel_read).
+ */
+
+#define AUDIO_FRAME_RING_CACHE_LINE     64
+
+typedef struct audio_frame_ring_t audio_frame_ring_t;
+
+/**
+ * @brief Contiguous run of slots returned by claim/peek
+ *
+ * Slot i starts at data + i * stride; lengths[i] holds its valid byte count.
+ */
+typedef struct {
+    uint8_t *data;
+    size_t stride;
+    uint32_t *lengths;
+    size_t count;
+} audio_frame_span_t;
+
+/**
+ * @brief Ring statistics
+ */
+typedef struct {
+    size_t capacity;            // Slots in the ring
+    size_t frame_bytes;         // Maximum bytes per slot
+    uint32_t frames_committed;  // Frames published by the producer
+    uint32_t frames_released;   // Frames consumed
+    uint32_t overruns;          // Frames dropped because the ring was full
+    uint32_t high_water;        // Maximum frames queued at once
+} audio_frame_ring_stats_t;
+
+/**
+ * @brief Create a frame ring
+ *
+ * @param frame_bytes Maximum bytes per frame
+ * @param frame_count Number of slots (rounded up to a power of two)
+ * @return Ring handle or NULL on failure
+ */
+audio_frame_ring_t *audio_frame_ring_create(size_t frame_bytes, size_t frame_count);
+
+/**
+ * @brief Destroy a frame ring
+ */
+void audio_frame_ring_destroy(audio_frame_ring_t *ring);
+
+/**
+ * @brief Drop all queued frames
+ *
+ * Only safe while neither the producer nor the consumer is running.
+ */
+void audio_frame_ring_reset(audio_frame_ring_t *ring);
+
+/**
+ * @brief Producer: claim up to max_frames free slots
+ *
+ * Returns a contiguous run, so fewer slots than are free may be returned at
+ * the wrap point; claim again after committing to get the rest.
+ *
+ * @param ring Ring handle
+ * @param max_frames Maximum slots wanted
+ * @param span Output span (count == 0 when full)
+ * @return Number of slots claimed
+ */
+size_t audio_frame_ring_claim(audio_frame_ring_t *ring, size_t max_frames, audio_frame_span_t *span);
+
+/**
+ * @brief Producer: publish the first count claimed slots (lengths must be set)
+ */
+void audio_frame_ring_commit(audio_frame_ring_t *ring, size_t count);
+
+/**
+ * @brief Producer: account frames dropped because claim returned nothing
+ */
+void audio_frame_ring_note_overrun(audio_frame_ring_t *ring, size_t frames);
+
+/**
+ * @brief Consumer: get up to max_frames queued slots without removing them
+ *
+ * @param ring Ring handle
+ * @param max_frames Maximum slots wanted
+ * @param span Output span (count == 0 when empty)
+ * @return Number of slots available in the span
+ */
+size_t audio_frame_ring_peek(audio_frame_ring_t *ring, size_t max_frames, audio_frame_span_t *span);
+
+/**
+ * @brief Consumer: return the first count peeked slots to the producer
+ */
+void audio_frame_ring_release(audio_frame_ring_t *ring, size_t count);
+
+/**
+ * @brief Producer: copy one frame in (claim + memcpy + commit)
+ *
+ * @return true if stored, false if the ring was full (counted as overrun) or len too large
+ */
+bool audio_frame_ring_push(audio_frame_ring_t *ring, const void *data, size_t len);
+
+/**
+ * @brief Consumer: copy one frame out (peek + memcpy + release)
+ *
+ * @param ring Ring handle
+ * @param out Output buffer of at least frame_bytes
+ * @param len Output frame length in bytes
+ * @return true if a frame was read
+ */
+bool audio_frame_ring_pop(audio_frame_ring_t *ring, void *out, size_t *len);
+
+/**
+ * @brief Number of queued frames (approximate when called from a third task)
+ */
+size_t audio_frame_ring_count(const audio_frame_ring_t *ring);
+
+/**
+ * @brief Snapshot statistics (safe from any task)
+ */
+void audio_frame_ring_get_stats(const audio_frame_ring_t *ring, audio_frame_ring_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,8 +1,8 @@
 #pragma once
 
 #include "esp_err.h"
-#include "freertos/FreeRTOS.h"
-#include "freertos/semphr.h"
+#include <stdatomic.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -14,15 +14,18 @@ extern "C" {
  * @brief Audio memory buffer for real-time audio streaming
  * 
  * Inspired by the Arduino AudioMemoryBuffer implementation
- * Provides thread-safe ring buffer for audio samples
+ * Lock-free single-producer/single-consumer ring of samples: one task
+ * writes, one task reads, neither ever blocks. When the buffer is full the
+ * newest samples are dropped and counted in overrun_samples.
  */
 typedef struct {
     int16_t *buffer;
     size_t buffer_size;      // Total buffer size in samples
-    size_t write_pos;        // Write position
-    size_t read_pos;         // Read position
-    size_t available_samples; // Number of samples available for reading
-    SemaphoreHandle_t mutex; // Thread safety
+    size_t slots;            // buffer_size + 1 (one slot kept empty)
+    atomic_size_t write_pos; // Write position (producer-owned)
+    uint8_t pad[64 - sizeof(atomic_size_t)]; // Keep the indices on separate cache lines
+    atomic_size_t read_pos;  // Read position (consumer-owned)
+    atomic_uint overrun_samples; // Samples dropped because the buffer was full
     bool is_initialized;
 } audio_memory_buffer_t;
 
@@ -46,6 +49,8 @@ esp_err_t audio_memory_buffer_deinit(audio_memory_buffer_t *amb);
 /**
  * @brief Write audio samples to buffer
  * 
+ * Never blocks. Samples that do not fit are dropped and counted.
+ * 
  * @param amb Audio memory buffer instance
  * @param samples Audio samples to write
  * @param num_samples Number of samples to write
@@ -79,9 +84,19 @@ size_t audio_memory_buffer_available(audio_memory_buffer_t *amb);
  */
 bool audio_memory_buffer_is_empty(audio_memory_buffer_t *amb);
 
+/**
+ * @brief Get number of samples dropped because the buffer was full
+ * 
+ * @param amb Audio memory buffer instance
+ * @return uint32_t Dropped sample count
+ */
+uint32_t audio_memory_buffer_overruns(audio_memory_buffer_t *amb);
+
 /**
  * @brief Clear all data from buffer
  * 
+ * Consumer-side operation: discards everything written so far.
+ * 
  * @param amb Audio memory buffer instance
  * @return esp_err_t ESP_OK on success
  */
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "driver/i2s_std.h"
+#include "tts_plc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -80,15 +83,59 @@ esp_err_t audio_processor_stop_playback(void);
  */
 esp_err_t audio_processor_set_callback(audio_event_callback_t callback);
 
+/**
+ * @brief Make a task the consumer of captured frames
+ * 
+ * Frames go through a single-producer, single-consumer ring, and consumers
+ * may modify them in place, so only one task may take them at a time. Other
+ * parts of the system get the audio from that task, e.g. from
+ * audio_interface_coordinator's AUDIO_INTERFACE_EVENT_AUDIO_CAPTURED or
+ * stt_audio_handler's STT_AUDIO_EVENT_CHUNK_READY events.
+ * 
+ * @param task Consumer task (NULL = calling task)
+ * @return esp_err_t ESP_OK, or ESP_ERR_INVALID_STATE if another task is subscribed
+ */
+esp_err_t audio_processor_subscribe_buffer(TaskHandle_t task);
+
+/**
+ * @brief Stop a task consuming captured frames
+ * 
+ * The task may still release the frame it holds. No-op if it is not the consumer.
+ * 
+ * @param task Consumer task (NULL = calling task)
+ * @return esp_err_t ESP_OK
+ */
+esp_err_t audio_processor_unsubscribe_buffer(TaskHandle_t task);
+
 /**
  * @brief Get audio buffer for processing
  * 
+ * Returns the oldest captured frame in place, pointing into I2S DMA memory
+ * (no copy). Release it with audio_processor_release_buffer() promptly: the
+ * DMA reuses the buffer after dma_buf_count - 1 further frames. Only the
+ * task subscribed with audio_processor_subscribe_buffer() may call this.
+ * 
  * @param buffer Pointer to store buffer address
  * @param length Pointer to store buffer length
- * @return esp_err_t ESP_OK on success
+ * @return esp_err_t ESP_OK on success, ESP_ERR_NOT_FOUND if no frame is
+ *         waiting, ESP_ERR_INVALID_STATE if the caller is not the consumer
  */
 esp_err_t audio_processor_get_buffer(uint8_t **buffer, size_t *length);
 
+/**
+ * @brief Wait for the next captured frame
+ * 
+ * Like audio_processor_get_buffer(), but blocks on a task notification from
+ * the capture task instead of polling. Uses the calling task's notification
+ * value.
+ * 
+ * @param buffer Pointer to store buffer address
+ * @param length Pointer to store buffer length
+ * @param timeout_ms Longest wait
+ * @return esp_err_t ESP_OK on success, ESP_ERR_TIMEOUT if nothing arrived
+ */
+esp_err_t audio_processor_wait_buffer(uint8_t **buffer, size_t *length, uint32_t timeout_ms);
+
 /**
  * @brief Release audio buffer after processing
  * 
@@ -147,9 +194,11 @@ esp_err_t audio_processor_switch_protocol(bool use_websocket);
  * @param frames_processed Total frames processed
  * @param avg_latency_ms Average processing latency
  * @param protocol_active Currently active protocol (0=UDP, 1=WebSocket)
+ * @param plc_stats Optional playback concealment counters (may be NULL)
  * @return esp_err_t ESP_OK on success
  */
-esp_err_t audio_processor_get_stats(uint32_t *frames_processed, float *avg_latency_ms, uint8_t *protocol_active);
+esp_err_t audio_processor_get_stats(uint32_t *frames_processed, float *avg_latency_ms, uint8_t *protocol_active,
+                                    tts_plc_stats_t *plc_stats);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Staged audio pipeline
+ *
+ * A stage is a named worker task with a bounded input queue. Producers
+ * push fixed-size items (copied into the queue); the stage task runs the
+ * process function on each one and records queue-to-completion latency
+ * against the stage deadline. Chaining stages (a process function pushing
+ * into the next stage) moves slow work off the capture path.
+ */
+
+#define AUDIO_STAGE_NAME_LEN    16
+
+/**
+ * @brief Behaviour when a stage queue is full
+ */
+typedef enum {
+    AUDIO_STAGE_POLICY_DROP_OLDEST = 0, ///< Discard the oldest queued item (UI, meters)
+    AUDIO_STAGE_POLICY_NEVER_DROP,      ///< Producer waits for space (transport, analysis)
+} audio_stage_policy_t;
+
+/**
+ * @brief Stage process function
+ *
+ * @param item Item popped from the queue (owned by the stage until return)
+ * @param ctx User context from the config
+ */
+typedef void (*audio_stage_process_fn_t)(void *item, void *ctx);
+
+/**
+ * @brief Stage configuration
+ */
+typedef struct {
+    const char *name;                   ///< Task name and stats label
+    audio_stage_process_fn_t process;   ///< Called once per item
+    void *ctx;                          ///< Passed to process
+    size_t item_size;                   ///< Bytes per queued item
+    uint32_t queue_depth;               ///< Maximum queued items
+    audio_stage_policy_t policy;        ///< Full-queue behaviour
+    uint32_t max_block_ms;              ///< NEVER_DROP: longest a push may wait (0 = forever)
+    uint32_t deadline_us;               ///< Queue-to-completion budget (0 = none)
+    uint32_t stack_size;                ///< Task stack in bytes
+    UBaseType_t priority;               ///< Task priority
+    BaseType_t core_id;                 ///< Pinned core (tskNO_AFFINITY allowed)
+} audio_stage_config_t;
+
+/**
+ * @brief Stage statistics
+ */
+typedef struct {
+    char name[AUDIO_STAGE_NAME_LEN];
+    uint32_t pushed;                    ///< Items accepted into the queue
+    uint32_t processed;                 ///< Items completed
+    uint32_t dropped;                   ///< DROP_OLDEST evictions
+    uint32_t overflows;                 ///< NEVER_DROP pushes that timed out
+    uint32_t deadline_misses;           ///< Items that finished after deadline_us
+    uint32_t queue_high_water;          ///< Maximum queued items seen
+    uint32_t last_latency_us;           ///< Queue-to-completion, last item
+    uint32_t max_latency_us;            ///< Queue-to-completion, worst case
+    float avg_latency_us;               ///< Queue-to-completion, running average
+    uint32_t max_process_us;            ///< Time inside process(), worst case
+} audio_stage_stats_t;
+
+typedef struct audio_stage_t *audio_stage_handle_t;
+
+/**
+ * @brief Create a stage and start its task
+ *
+ * @param config Stage configuration
+ * @param out_stage Output handle
+ * @return ESP_OK on success
+ */
+esp_err_t audio_stage_create(const audio_stage_config_t *config, audio_stage_handle_t *out_stage);
+
+/**
+ * @brief Stop the stage task and free its queue
+ *
+ * Producers must have stopped pushing.
+ */
+esp_err_t audio_stage_destroy(audio_stage_handle_t stage);
+
+/**
+ * @brief Queue one item (copied) according to the stage policy
+ *
+ * @param stage Stage handle
+ * @param item Item of config.item_size bytes
+ * @return ESP_OK if queued, ESP_ERR_TIMEOUT if a NEVER_DROP push timed out
+ */
+esp_err_t audio_stage_push(audio_stage_handle_t stage, const void *item);
+
+/**
+ * @brief Snapshot stage statistics
+ */
+esp_err_t audio_stage_get_stats(audio_stage_handle_t stage, audio_stage_stats_t *stats);
+
+/**
+ * @brief Reset statistics counters
+ */
+esp_err_t audio_stage_reset_stats(audio_stage_handle_t stage);
+
+#ifdef __cplusplus
+}
+#endif
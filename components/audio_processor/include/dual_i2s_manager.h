@@ -3,6 +3,7 @@
 #include "esp_err.h"
 #include "driver/i2s_std.h"
 #include "driver/gpio.h"
+#include "i2s_dma_capture.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -139,6 +140,17 @@ esp_err_t dual_i2s_stop(void);
  */
 esp_err_t dual_i2s_clear_dma_buffers(bool clear_mic, bool clear_speaker);
 
+/**
+ * @brief Get the event-driven microphone capture engine
+ * 
+ * Frames are delivered in place from DMA buffers with a task notification
+ * per buffer (see i2s_dma_capture.h). Started by dual_i2s_start() when the
+ * microphone is active. Preferred over polling dual_i2s_read_mic().
+ * 
+ * @return Capture handle, or NULL if not initialized
+ */
+i2s_dma_capture_handle_t dual_i2s_get_mic_capture(void);
+
 /**
  * @brief Get current I2S mode
  * 
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Boot dependency graph and boot-time profiler
+ *
+ * Each subsystem is a stage naming the stages it depends on. howdy_boot_run()
+ * starts every stage whose dependencies have finished in a task of its own,
+ * so independent stages (Wi-Fi association, display bring-up, model
+ * loading) overlap on both cores. The caller blocks until every stage has
+ * finished or been skipped.
+ *
+ * A stage without a function is a milestone: it completes as soon as its
+ * dependencies do, which timestamps points like "ready for wake word".
+ * A stage that fails skips everything that depends on it; independent
+ * stages still run.
+ *
+ * Times are esp_timer microseconds, which count from reset, so they include
+ * the bootloader and startup code before app_main. Each stage is also
+ * recorded as a HOWDY_TRACE_STAGE span on its own track, so the overlap is
+ * visible at GET /trace.
+ *
+ * With CONFIG_HOWDY_BOOT_PARALLEL off the same graph runs one stage at a
+ * time in the caller's task, in dependency order, for comparison.
+ */
+
+#define HOWDY_BOOT_MAX_STAGES       16
+#define HOWDY_BOOT_MAX_DEPS         4
+#define HOWDY_BOOT_NAME_LEN         16
+#define HOWDY_BOOT_DEFAULT_STACK    8192
+
+typedef esp_err_t (*howdy_boot_fn_t)(void *arg);
+
+/**
+ * @brief One node of the boot graph
+ */
+typedef struct {
+    const char *name;                       ///< Unique; referenced by deps
+    howdy_boot_fn_t fn;                     ///< NULL for a milestone
+    void *arg;
+    const char *deps[HOWDY_BOOT_MAX_DEPS];  ///< Stage names; unused slots NULL
+    int core;                               ///< 0 or 1 to pin, -1 for either core
+    uint32_t stack_size;                    ///< 0 for HOWDY_BOOT_DEFAULT_STACK
+} howdy_boot_stage_t;
+
+typedef enum {
+    HOWDY_BOOT_PENDING,
+    HOWDY_BOOT_RUNNING,
+    HOWDY_BOOT_DONE,
+    HOWDY_BOOT_FAILED,
+    HOWDY_BOOT_SKIPPED,                     ///< A dependency failed
+} howdy_boot_status_t;
+
+/**
+ * @brief Timing of one stage
+ */
+typedef struct {
+    char name[HOWDY_BOOT_NAME_LEN];
+    howdy_boot_status_t status;
+    esp_err_t err;                          ///< Stage result, ESP_OK unless FAILED
+    bool milestone;
+    int8_t core;                            ///< Core it ran on, -1 if it never ran
+    uint32_t ready_us;                      ///< Dependencies finished
+    uint32_t start_us;                      ///< Stage function entered
+    uint32_t end_us;                        ///< Finished; 0 while pending or running
+} howdy_boot_stage_stats_t;
+
+/**
+ * @brief Whole-run summary
+ */
+typedef struct {
+    bool parallel;
+    size_t stage_count;
+    uint32_t start_us;                      ///< howdy_boot_run() called
+    uint32_t end_us;                        ///< Last stage finished, 0 while running
+    uint32_t serial_us;                     ///< Sum of stage run times: the cost one after another
+    uint32_t failed;                        ///< Stages that failed or were skipped
+} howdy_boot_summary_t;
+
+/**
+ * @brief Run the boot graph to completion
+ *
+ * Call once. The stage array is only read during the call.
+ *
+ * @param stages Stages in any order
+ * @param count Number of stages, at most HOWDY_BOOT_MAX_STAGES
+ * @return ESP_OK if every stage succeeded, the first stage error otherwise,
+ *         ESP_ERR_INVALID_ARG for unknown dependencies, duplicate names or a cycle,
+ *         ESP_ERR_INVALID_STATE if already run
+ */
+esp_err_t howdy_boot_run(const howdy_boot_stage_t *stages, size_t count);
+
+/**
+ * @brief Look up one stage's timing by name
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND
+ */
+esp_err_t howdy_boot_get_stage(const char *name, howdy_boot_stage_stats_t *stats);
+
+/**
+ * @brief Copy every stage's timing, in the order given to howdy_boot_run()
+ *
+ * @return Number of stages copied
+ */
+size_t howdy_boot_get_stages(howdy_boot_stage_stats_t *stats, size_t max);
+
+/**
+ * @brief Copy the run summary
+ */
+void howdy_boot_get_summary(howdy_boot_summary_t *summary);
+
+/**
+ * @brief Short lowercase name of a status, e.g. "done"
+ */
+const char *howdy_boot_status_name(howdy_boot_status_t status);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Per-subsystem heap accounting
+ *
+ * HOWDY_MALLOC() prefixes each block with an 8-byte header holding its size
+ * and tag, so HOWDY_FREE() can credit the right subsystem without a heap
+ * lookup. Bookkeeping is a few relaxed atomic adds per call. Blocks from
+ * HOWDY_MALLOC() must be released with HOWDY_FREE() and nothing else.
+ *
+ * Optionally every Nth allocation is sampled into a call-site histogram
+ * (file:line, live and total bytes) to find where a tag's growth comes
+ * from. Sampling is off unless CONFIG_HOWDY_HEAP_SAMPLE_EVERY is set or
+ * howdy_heap_set_sampling() is called.
+ */
+
+typedef enum {
+    HOWDY_HEAP_TAG_OTHER = 0,
+    HOWDY_HEAP_TAG_AUDIO,           ///< Capture/processing buffers
+    HOWDY_HEAP_TAG_TTS,             ///< TTS playback chunks
+    HOWDY_HEAP_TAG_NETWORK,         ///< Per-packet and protocol buffers
+    HOWDY_HEAP_TAG_VAD_FEEDBACK,    ///< VAD feedback WebSocket messages
+    HOWDY_HEAP_TAG_JSON,            ///< cJSON (via howdy_heap_install_cjson_hooks)
+    HOWDY_HEAP_TAG_UI,              ///< LVGL (reported, see howdy_heap_set_external)
+    HOWDY_HEAP_TAG_COUNT
+} howdy_heap_tag_t;
+
+#define HOWDY_HEAP_SITE_COUNT   32  ///< Call sites kept by the sampler
+
+#define HOWDY_MALLOC(tag, size, caps) \
+    howdy_heap_alloc((tag), (size), (caps), __FILE__, __LINE__)
+#define HOWDY_CALLOC(tag, n, size, caps) \
+    howdy_heap_calloc((tag), (n), (size), (caps), __FILE__, __LINE__)
+#define HOWDY_REALLOC(tag, ptr, size, caps) \
+    howdy_heap_realloc((tag), (ptr), (size), (caps), __FILE__, __LINE__)
+#define HOWDY_FREE(ptr) \
+    howdy_heap_free(ptr)
+
+/**
+ * @brief Per-tag counters
+ */
+typedef struct {
+    const char *name;
+    size_t live_bytes;              ///< Currently allocated
+    size_t peak_bytes;              ///< Highest live_bytes seen
+    uint32_t live_blocks;
+    uint32_t allocs;                ///< Total allocations
+    uint32_t frees;
+    uint32_t failures;              ///< Allocations the heap refused
+    float alloc_rate;               ///< Allocations per second over the last howdy_heap_sample_rates() window
+} howdy_heap_tag_stats_t;
+
+/**
+ * @brief Sampled call site
+ */
+typedef struct {
+    const char *file;
+    uint32_t line;
+    howdy_heap_tag_t tag;
+    uint32_t samples;               ///< Sampled allocations from this site
+    size_t sampled_bytes;           ///< Bytes over all sampled allocations
+    size_t live_bytes;              ///< Sampled bytes not yet freed
+} howdy_heap_site_t;
+
+void *howdy_heap_alloc(howdy_heap_tag_t tag, size_t size, uint32_t caps, const char *file, int line);
+void *howdy_heap_calloc(howdy_heap_tag_t tag, size_t n, size_t size, uint32_t caps, const char *file, int line);
+void *howdy_heap_realloc(howdy_heap_tag_t tag, void *ptr, size_t size, uint32_t caps, const char *file, int line);
+void howdy_heap_free(void *ptr);
+
+/**
+ * @brief Sample every Nth allocation into the call-site histogram (0 = off)
+ */
+void howdy_heap_set_sampling(uint32_t every_n);
+
+/**
+ * @brief Report bytes for a tag whose memory is managed elsewhere (e.g. LVGL's pool)
+ */
+void howdy_heap_set_external(howdy_heap_tag_t tag, size_t live_bytes);
+
+/**
+ * @brief Route cJSON allocations through HOWDY_HEAP_TAG_JSON
+ *
+ * Call once at startup, before any cJSON object exists. Strings returned by
+ * cJSON_Print() must then be released with cJSON_free().
+ */
+void howdy_heap_install_cjson_hooks(void);
+
+/**
+ * @brief Close the allocation-rate window and start the next one
+ *
+ * Called from one task only (the performance monitor); every other reader
+ * gets the rate of the last closed window from howdy_heap_get_tag_stats().
+ */
+void howdy_heap_sample_rates(void);
+
+/**
+ * @brief Snapshot per-tag counters
+ *
+ * Safe from any task; does not move the rate window.
+ *
+ * @param stats Array of HOWDY_HEAP_TAG_COUNT entries
+ */
+esp_err_t howdy_heap_get_tag_stats(howdy_heap_tag_stats_t *stats);
+
+/**
+ * @brief Copy the sampled call sites, busiest first
+ *
+ * @return Number of sites written
+ */
+size_t howdy_heap_get_sites(howdy_heap_site_t *sites, size_t max);
+
+/**
+ * @brief Tag name for logs and JSON
+ */
+const char *howdy_heap_tag_name(howdy_heap_tag_t tag);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief End-to-end voice latency tracer
+ *
+ * Trace points are stamped with esp_timer microseconds as audio moves
+ * through the device. A wake trigger opens an utterance; later points are
+ * kept on their first occurrence only, and the first I2S write of TTS audio
+ * closes it and folds every stage span into a histogram. Capture-to-VAD is
+ * recorded for every analysed frame, not just utterances.
+ *
+ * Histograms are HDR-style: 8 linear sub-buckets per power of two, so any
+ * reported percentile is within 12.5% of the true value, with no
+ * allocation and a single atomic add per sample.
+ */
+
+typedef enum {
+    HOWDY_LAT_I2S_DMA = 0,          ///< DMA completed the capture buffer
+    HOWDY_LAT_VAD_DECISION,         ///< VAD finished with that buffer
+    HOWDY_LAT_WAKE,                 ///< Wake word triggered (opens an utterance)
+    HOWDY_LAT_UPLINK,               ///< First audio packet sent after wake
+    HOWDY_LAT_SERVER_ECHO,          ///< Server echoed the wake timestamp back
+    HOWDY_LAT_TTS_CHUNK,            ///< First TTS chunk received
+    HOWDY_LAT_PLAYOUT_POP,          ///< First TTS audio taken from the playout buffer
+    HOWDY_LAT_I2S_WRITE,            ///< First TTS audio written to I2S (closes the utterance)
+    HOWDY_LAT_POINT_COUNT
+} howdy_lat_point_t;
+
+typedef enum {
+    HOWDY_LAT_SPAN_CAPTURE_TO_VAD = 0,  ///< Every frame
+    HOWDY_LAT_SPAN_VAD_TO_WAKE,
+    HOWDY_LAT_SPAN_WAKE_TO_UPLINK,
+    HOWDY_LAT_SPAN_SERVER_RTT,          ///< Wake sent to echo received
+    HOWDY_LAT_SPAN_WAKE_TO_TTS,         ///< Includes the user speaking and server processing
+    HOWDY_LAT_SPAN_TTS_TO_POP,
+    HOWDY_LAT_SPAN_POP_TO_I2S,
+    HOWDY_LAT_SPAN_WAKE_TO_AUDIO,       ///< Wake trigger to first audible TTS sample
+    HOWDY_LAT_SPAN_COUNT
+} howdy_lat_span_t;
+
+/**
+ * @brief Summary of one span histogram
+ */
+typedef struct {
+    const char *name;
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t mean_us;
+    uint32_t p50_us;
+    uint32_t p95_us;
+    uint32_t p99_us;
+} howdy_lat_summary_t;
+
+/**
+ * @brief Utterance counters
+ */
+typedef struct {
+    uint32_t completed;             ///< Wake to first audio, fully traced
+    uint32_t abandoned;             ///< Re-triggered or timed out before audio played
+    uint32_t in_progress;           ///< 1 while an utterance is open
+} howdy_lat_counters_t;
+
+/**
+ * @brief Stamp a trace point with the current time
+ */
+void howdy_lat_mark(howdy_lat_point_t point);
+
+/**
+ * @brief Stamp a trace point with an earlier timestamp (e.g. from a DMA descriptor)
+ */
+void howdy_lat_mark_at(howdy_lat_point_t point, int64_t t_us);
+
+/**
+ * @brief Last timestamp recorded for a point, 0 if never
+ */
+int64_t howdy_lat_last(howdy_lat_point_t point);
+
+/**
+ * @brief VAD decision for a frame the DMA completed at captured_us
+ *
+ * Records capture-to-VAD and remembers the frame so a wake trigger on it
+ * can be traced back to the DMA.
+ */
+void howdy_lat_vad_decision(int64_t captured_us);
+
+/**
+ * @brief Server echoed a wake timestamp (ms since boot) back to us
+ *
+ * Ignored unless it matches the open utterance.
+ */
+void howdy_lat_server_echo(uint32_t echoed_ms);
+
+/**
+ * @brief Summarise one span histogram
+ */
+esp_err_t howdy_lat_get_summary(howdy_lat_span_t span, howdy_lat_summary_t *summary);
+
+/**
+ * @brief Utterance counters
+ */
+void howdy_lat_get_counters(howdy_lat_counters_t *counters);
+
+/**
+ * @brief Clear all histograms and counters
+ */
+void howdy_lat_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
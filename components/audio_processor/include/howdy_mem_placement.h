@@ -0,0 +1,100 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hot/cold memory placement for the audio path
+ *
+ * Buffers are classified by access pattern instead of picking heap caps at
+ * each call site:
+ *  - HOT:  DSP state touched on every frame (filter history, FFT scratch,
+ *          detector instances). Internal SRAM (or TCM where the target has
+ *          it), 32-byte aligned.
+ *  - BULK: large streaming buffers touched once per frame (jitter frames,
+ *          TTS chunks). PSRAM, cache-line aligned; use howdy_mem_stride()
+ *          for row pitches so consecutive rows don't alias the same cache set.
+ *  - DMA:  buffers handed to I2S/SPI DMA. Internal DMA-capable, cache-line
+ *          aligned, no fallback.
+ *
+ * The region of HOT and BULK can be overridden in menuconfig (Memory
+ * Placement). When the preferred region is exhausted or absent the
+ * allocation falls back to internal RAM and is counted in the class stats.
+ * Memory from howdy_mem_alloc()/howdy_mem_calloc() must be released with
+ * howdy_mem_free().
+ */
+
+typedef enum {
+    HOWDY_MEM_HOT = 0,
+    HOWDY_MEM_BULK,
+    HOWDY_MEM_DMA,
+    HOWDY_MEM_CLASS_COUNT
+} howdy_mem_class_t;
+
+/**
+ * @brief Per-class counters
+ */
+typedef struct {
+    const char *region;             ///< Preferred region ("internal", "tcm", "psram", "dma")
+    uint32_t allocs;                ///< Successful allocations
+    uint32_t frees;
+    size_t live_bytes;              ///< Currently allocated (heap block sizes)
+    uint32_t fallbacks;             ///< Allocations served outside the preferred region
+    uint32_t failures;              ///< Allocations that failed in every region
+} howdy_mem_stats_t;
+
+/**
+ * @brief Result of one placement in howdy_mem_benchmark()
+ */
+typedef struct {
+    const char *region;
+    uint32_t cycles_per_frame;      ///< Mean CPU cycles for one 20 ms frame
+    size_t bytes;                   ///< Working set streamed per pass
+} howdy_mem_bench_result_t;
+
+void *howdy_mem_alloc(howdy_mem_class_t cls, size_t size);
+void *howdy_mem_calloc(howdy_mem_class_t cls, size_t n, size_t size);
+void howdy_mem_free(void *ptr);
+
+/**
+ * @brief Preferred heap caps for a class (for pools and other heap users)
+ */
+uint32_t howdy_mem_caps(howdy_mem_class_t cls);
+
+/**
+ * @brief Alignment applied by howdy_mem_alloc() for a class
+ */
+size_t howdy_mem_align(howdy_mem_class_t cls);
+
+/**
+ * @brief Row pitch for a 2D/ring layout of row_bytes rows
+ *
+ * Rounds up to the class alignment and adds one cache line when the pitch
+ * is a multiple of 1 KB, so walking rows doesn't thrash a single cache set.
+ */
+size_t howdy_mem_stride(howdy_mem_class_t cls, size_t row_bytes);
+
+/**
+ * @brief Snapshot counters for a class
+ */
+esp_err_t howdy_mem_get_stats(howdy_mem_class_t cls, howdy_mem_stats_t *stats);
+
+/**
+ * @brief Time a per-frame DSP kernel in each available region
+ *
+ * Streams 320-sample frames through a windowed energy kernel over a 64 KB
+ * working set placed in internal RAM, TCM, PSRAM and DMA memory, and logs
+ * cycles per frame. Takes a few hundred milliseconds; call at boot only.
+ *
+ * @return Number of results written
+ */
+size_t howdy_mem_benchmark(howdy_mem_bench_result_t *results, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
@@ -31,6 +31,8 @@
 #include "esp_psram.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "freertos/ringbuf.h"
+#include "howdy_memory_pool.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -236,6 +238,10 @@ void howdy_ui_object_free(void* object, uint16_t object_type);
 
 //=============================================================================
 // MEMORY POOL MANAGEMENT
+//
+// Each pool type is backed by a lock-free howdy_pool_t (howdy_memory_pool.h).
+// Audio frame and network packet pools are created by howdy_memory_init();
+// the others on first howdy_memory_pool_create().
 //=============================================================================
 
 /**
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Lock-free fixed-size block pools
+ *
+ * Each pool is one allocation of block_count equal blocks taken from the
+ * heap with the requested capabilities (internal, PSRAM, DMA). Free blocks
+ * form a Treiber stack: the head packs a 16-bit block index with a 16-bit
+ * tag that changes on every push and pop, so a stale compare-and-swap
+ * (ABA) fails instead of corrupting the list. alloc/free never lock and
+ * are safe from any task on either core.
+ *
+ * Double frees and foreign pointers are always detected. With canaries
+ * enabled (per pool, or for all pools via CONFIG_HOWDY_MEMORY_POOL_CANARIES)
+ * each block is bracketed by guard words checked on free, and freed blocks
+ * are poisoned.
+ */
+
+#define HOWDY_POOL_NAME_LEN         16
+#define HOWDY_POOL_MAX_BLOCKS       0xFFFE  ///< Block indices are 16 bits
+#define HOWDY_POOL_REGISTRY_SIZE    16      ///< Pools visible to howdy_pool_list()
+
+typedef struct howdy_pool howdy_pool_t;
+
+/**
+ * @brief Pool configuration
+ */
+typedef struct {
+    const char *name;               ///< Label for stats and logs
+    size_t block_size;              ///< Usable bytes per block
+    uint16_t block_count;           ///< Blocks in the pool (<= HOWDY_POOL_MAX_BLOCKS)
+    uint32_t caps;                  ///< heap_caps for the backing memory
+    bool canaries;                  ///< Guard words and poisoning (debug)
+} howdy_pool_config_t;
+
+/**
+ * @brief Pool statistics
+ */
+typedef struct {
+    char name[HOWDY_POOL_NAME_LEN];
+    size_t block_size;
+    uint16_t block_count;
+    uint32_t caps;
+    size_t footprint;               ///< Backing bytes including guards and padding
+    uint32_t in_use;                ///< Blocks currently allocated
+    uint32_t peak_in_use;           ///< Most blocks allocated at once
+    uint32_t hits;                  ///< Successful allocations
+    uint32_t misses;                ///< Allocations that found the pool empty
+    uint32_t frees;                 ///< Blocks returned
+    uint32_t canary_errors;         ///< Guard words found damaged on free
+    uint32_t invalid_frees;         ///< Double frees and foreign pointers
+} howdy_pool_stats_t;
+
+/**
+ * @brief Create a pool and register it for howdy_pool_list()
+ */
+esp_err_t howdy_pool_create(const howdy_pool_config_t *config, howdy_pool_t **out_pool);
+
+/**
+ * @brief Free a pool; every block must have been returned
+ *
+ * @return ESP_ERR_INVALID_STATE (pool kept) if blocks are still in use
+ */
+esp_err_t howdy_pool_destroy(howdy_pool_t *pool);
+
+/**
+ * @brief Take a block, or NULL if the pool is empty (never blocks)
+ */
+void *howdy_pool_alloc(howdy_pool_t *pool);
+
+/**
+ * @brief Return a block
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for a pointer not from this pool,
+ *         ESP_ERR_INVALID_STATE for a double free, ESP_ERR_INVALID_CRC if
+ *         the guard words were damaged (the block is still recycled)
+ */
+esp_err_t howdy_pool_free(howdy_pool_t *pool, void *ptr);
+
+/**
+ * @brief Block index of ptr, or -1 if ptr is not a block of this pool
+ */
+int howdy_pool_index(const howdy_pool_t *pool, const void *ptr);
+
+/**
+ * @brief Usable bytes per block
+ */
+size_t howdy_pool_block_size(const howdy_pool_t *pool);
+
+/**
+ * @brief Snapshot pool statistics
+ */
+esp_err_t howdy_pool_get_stats(const howdy_pool_t *pool, howdy_pool_stats_t *stats);
+
+/**
+ * @brief Verify the guard words of every allocated block
+ *
+ * @return Number of damaged blocks found (0 when canaries are disabled)
+ */
+uint32_t howdy_pool_check(howdy_pool_t *pool);
+
+/**
+ * @brief List registered pools
+ *
+ * @param pools Output array
+ * @param max Capacity of pools
+ * @return Number of pools written
+ */
+size_t howdy_pool_list(howdy_pool_t **pools, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
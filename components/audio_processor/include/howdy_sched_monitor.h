@@ -0,0 +1,171 @@
+#pragma once
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Scheduler monitor for periodic audio tasks
+ *
+ * A periodic task registers itself once and then either replaces its
+ * vTaskDelayUntil() with howdy_sched_delay_until(), or, if it is woken by
+ * a DMA/queue event, brackets each cycle with howdy_sched_wake() and
+ * howdy_sched_done() (optional; without it there is no work time or
+ * overrun count). Each cycle records:
+ *
+ *  - period jitter: |time between wakes - period|
+ *  - overruns: the cycle's work took longer than the period
+ *  - deadline misses: vTaskDelayUntil had to catch up without blocking, or
+ *    an event arrived more than half a period late (one per missed period),
+ *    and the longest run of consecutive misses
+ *
+ * Recording is a few stores into the task's own slot; only the task itself
+ * writes it. The task also samples its own stack high-water mark about once
+ * a second.
+ *
+ * howdy_sched_sample() walks the FreeRTOS task list (needs
+ * CONFIG_FREERTOS_USE_TRACE_FACILITY) to get every task's stack high-water
+ * mark and, with CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, its share of the
+ * CPU since the previous sample. Call it from a low-priority task at a
+ * steady interval; the getters only read its cached results.
+ */
+
+#define HOWDY_SCHED_MAX_PERIODIC    8   ///< Registered periodic tasks
+#define HOWDY_SCHED_MAX_TASKS       32  ///< Tasks kept from the FreeRTOS task list
+#define HOWDY_SCHED_NAME_LEN        16
+
+typedef struct howdy_sched_task *howdy_sched_handle_t;
+
+/**
+ * @brief Counters for one registered periodic task
+ */
+typedef struct {
+    char name[HOWDY_SCHED_NAME_LEN];
+    bool running;                   ///< false once the task unregistered
+    uint32_t period_us;
+    uint32_t cycles;
+    uint32_t overruns;              ///< Work took longer than the period
+    uint32_t misses;                ///< Missed wake deadlines
+    uint32_t consecutive_misses;    ///< Current run of misses
+    uint32_t max_consecutive_misses;
+    uint32_t jitter_avg_us;         ///< Smoothed over roughly the last 16 cycles
+    uint32_t jitter_max_us;
+    uint32_t work_avg_us;           ///< Smoothed over roughly the last 16 cycles
+    uint32_t work_max_us;
+    uint32_t stack_free_min;        ///< Stack high-water mark in bytes, 0 until sampled
+    float cpu_percent;              ///< Share of total CPU at the last sample, -1 if unknown
+} howdy_sched_periodic_stats_t;
+
+/**
+ * @brief One entry from the FreeRTOS task list at the last sample
+ */
+typedef struct {
+    char name[HOWDY_SCHED_NAME_LEN];
+    uint8_t priority;
+    int8_t core;                    ///< -1 if not pinned
+    uint32_t stack_free_min;        ///< Stack high-water mark in bytes
+    float cpu_percent;              ///< Share of total CPU since the previous sample, -1 if unknown
+} howdy_sched_task_stats_t;
+
+/**
+ * @brief One-line health summary
+ */
+typedef struct {
+    uint32_t window_ms;             ///< Time covered by the CPU shares, 0 before two samples
+    float idle_percent;             ///< Idle tasks' share of total CPU, -1 if unknown
+    uint32_t misses;                ///< Over all periodic tasks
+    uint32_t overruns;
+    uint32_t max_consecutive_misses;
+    uint32_t jitter_max_us;
+    char worst_jitter_task[HOWDY_SCHED_NAME_LEN];   ///< Empty if no periodic task has run
+    uint32_t stack_free_min;        ///< Lowest high-water mark over all tasks, bytes
+    char lowest_stack_task[HOWDY_SCHED_NAME_LEN];   ///< Empty before the first sample
+} howdy_sched_summary_t;
+
+/**
+ * @brief Register the calling task as periodic
+ *
+ * Re-registering a name (e.g. a task restarted on reconnect) reuses its slot
+ * and clears its counters.
+ *
+ * @param name Task label, copied
+ * @param period_us Expected cycle period
+ * @return Handle, or NULL if all slots are taken (every call accepts NULL)
+ */
+howdy_sched_handle_t howdy_sched_register(const char *name, uint32_t period_us);
+
+/**
+ * @brief Mark the task stopped; its counters stay readable
+ *
+ * Call before the task deletes itself.
+ */
+void howdy_sched_unregister(howdy_sched_handle_t handle);
+
+/**
+ * @brief vTaskDelayUntil() that records the cycle
+ */
+void howdy_sched_delay_until(howdy_sched_handle_t handle, TickType_t *last_wake, TickType_t period);
+
+/**
+ * @brief Event-driven task woke to process a cycle
+ */
+void howdy_sched_wake(howdy_sched_handle_t handle);
+
+/**
+ * @brief Event-driven task finished the cycle started by howdy_sched_wake()
+ */
+void howdy_sched_done(howdy_sched_handle_t handle);
+
+/**
+ * @brief Change the expected period from the next wake on
+ *
+ * For tasks whose cycle follows the data, e.g. variable-size TTS chunks.
+ */
+void howdy_sched_set_period(howdy_sched_handle_t handle, uint32_t period_us);
+
+/**
+ * @brief The task went idle on purpose (e.g. no TTS queued)
+ *
+ * The next howdy_sched_wake() starts a new cadence instead of counting the
+ * gap as missed periods.
+ */
+void howdy_sched_idle(howdy_sched_handle_t handle);
+
+/**
+ * @brief Refresh stack high-water marks and CPU shares from FreeRTOS
+ */
+esp_err_t howdy_sched_sample(void);
+
+/**
+ * @brief Copy the periodic task counters
+ *
+ * @return Number of entries written
+ */
+size_t howdy_sched_get_periodic(howdy_sched_periodic_stats_t *out, size_t max);
+
+/**
+ * @brief Copy the task list from the last sample
+ *
+ * @return Number of entries written, 0 without CONFIG_FREERTOS_USE_TRACE_FACILITY
+ */
+size_t howdy_sched_get_tasks(howdy_sched_task_stats_t *out, size_t max);
+
+/**
+ * @brief Summarise the periodic counters and the last sample
+ */
+void howdy_sched_get_summary(howdy_sched_summary_t *summary);
+
+/**
+ * @brief Clear the periodic counters (not the sampled task list)
+ */
+void howdy_sched_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
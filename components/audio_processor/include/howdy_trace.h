@@ -0,0 +1,107 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Binary event trace
+ *
+ * Each core has its own ring of fixed 24-byte records (event, timestamp,
+ * two integer arguments). Recording is a slot reservation with one atomic
+ * add plus a few stores, safe from tasks and ISRs; nothing is formatted
+ * until the rings are dumped. When a ring wraps the oldest events are
+ * overwritten.
+ *
+ * howdy_trace_dump() writes Chrome trace-event JSON, which Perfetto
+ * (ui.perfetto.dev) and chrome://tracing open directly. GET /trace on the
+ * device serves it.
+ *
+ * Task switches come from the FreeRTOS tick hook, so they are sampled at
+ * tick resolution rather than captured on every context switch.
+ */
+
+typedef enum {
+    HOWDY_TRACE_TASK_SWITCH = 1,    ///< a0/a1 = first 8 chars of the task name (tick sampled)
+    HOWDY_TRACE_STAGE,              ///< a0 = track, a1 = processing time (us); recorded at the end
+    HOWDY_TRACE_QUEUE_DEPTH,        ///< a0 = track, a1 = items queued
+    HOWDY_TRACE_CAPTURE_FRAME,      ///< a0 = DMA sequence, a1 = capture ring depth
+    HOWDY_TRACE_PLAYOUT_FRAME,      ///< a0 = jitter buffer depth, a1 = 1 on underrun
+    HOWDY_TRACE_TTS_CHUNK,          ///< a0 = bytes, a1 = processing time (us)
+    HOWDY_TRACE_LATENCY_MARK,       ///< a0 = howdy_lat_point_t
+    HOWDY_TRACE_DEADLINE_MISS,      ///< a0 = scheduler monitor slot, a1 = time since the previous wake (us)
+    HOWDY_TRACE_EVENT_COUNT
+} howdy_trace_event_t;
+
+#define HOWDY_TRACE_MAX_CORES       2
+#define HOWDY_TRACE_MAX_TRACKS      16
+#define HOWDY_TRACE_TRACK_NAME_LEN  16
+
+#ifdef CONFIG_HOWDY_TRACE
+#define HOWDY_TRACE(event, a0, a1) \
+    howdy_trace_record((event), (uint32_t)(a0), (uint32_t)(a1))
+#else
+#define HOWDY_TRACE(event, a0, a1) do { (void)(a0); (void)(a1); } while (0)
+#endif
+
+/**
+ * @brief Trace statistics
+ */
+typedef struct {
+    uint32_t capacity;              ///< Events per core
+    uint32_t recorded[HOWDY_TRACE_MAX_CORES];   ///< Events written per core since init
+    bool enabled;
+} howdy_trace_stats_t;
+
+/**
+ * @brief Sink for howdy_trace_dump()
+ */
+typedef esp_err_t (*howdy_trace_write_fn_t)(void *ctx, const char *data, size_t len);
+
+/**
+ * @brief Allocate the rings and install the tick hooks; recording starts enabled
+ */
+esp_err_t howdy_trace_init(void);
+
+/**
+ * @brief Record an event on the calling core (no-op before init)
+ */
+void howdy_trace_record(uint16_t event, uint32_t a0, uint32_t a1);
+
+/**
+ * @brief Register a named track (pipeline stage, queue) for the dump
+ *
+ * @return Track id for event arguments, 0 if the table is full
+ */
+uint8_t howdy_trace_track(const char *name);
+
+/**
+ * @brief Pause or resume recording
+ */
+void howdy_trace_set_enabled(bool enabled);
+
+/**
+ * @brief Snapshot counters
+ */
+void howdy_trace_get_stats(howdy_trace_stats_t *stats);
+
+/**
+ * @brief Write the rings, merged across cores, as Chrome trace-event JSON
+ *
+ * Recording continues during the dump; events overwritten while the rings
+ * are copied are skipped.
+ */
+esp_err_t howdy_trace_dump(howdy_trace_write_fn_t write, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "esp_err.h"
+#include "enhanced_vad.h"
+#include "esp32_p4_wake_word.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief VAD and wake word settings the device ships with
+ *
+ * The conversation-aware defaults from each module with the HowdyScreen
+ * overrides applied. The application initialises its detectors from these,
+ * and tools/host_dsp/vad_corpus scores the same values against recorded
+ * audio, so a tuning change is measured before it is flashed.
+ */
+
+/**
+ * @brief Shipped enhanced VAD configuration
+ */
+esp_err_t howdy_voice_tuning_vad_config(uint16_t sample_rate, enhanced_vad_config_t *config);
+
+/**
+ * @brief Shipped wake word configuration
+ */
+esp_err_t howdy_voice_tuning_wake_word_config(esp32_p4_wake_word_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/i2s_std.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Event-driven I2S capture on DMA buffers
+ *
+ * Registers an on_recv callback on the RX channel. Each time the DMA
+ * finishes a buffer the ISR publishes its descriptor (address, length,
+ * sequence, timestamp) into a lock-free queue and wakes the consumer task
+ * with a task notification. The consumer processes the samples in place
+ * in DMA memory; nothing is copied and nobody polls.
+ *
+ * The driver reuses its dma_desc_num buffers round-robin, so a frame is
+ * only valid until the DMA comes back around to it. i2s_dma_capture_release()
+ * reports whether that happened while the frame was held; acquire skips
+ * frames that are already stale.
+ *
+ * The FAKE source runs the same path from an esp_timer with its own buffer
+ * pool, for boards running without a codec and for the host build in
+ * tools/host_dsp, where no I2S peripheral exists.
+ *
+ * With CONFIG_I2S_ISR_IRAM_SAFE the DMA callback and the ring it publishes
+ * into are placed in IRAM, and create() refuses capture state outside
+ * internal RAM.
+ */
+
+/**
+ * @brief Where DMA buffers come from
+ */
+typedef enum {
+    I2S_DMA_SOURCE_I2S = 0,     ///< Real RX channel, on_recv callback
+    I2S_DMA_SOURCE_FAKE,        ///< esp_timer-paced buffer pool
+} i2s_dma_source_t;
+
+/**
+ * @brief Fill function for the fake source
+ *
+ * @param samples Buffer to fill (frame_samples long)
+ * @param count Samples in the buffer
+ * @param seq Frame sequence number
+ * @param ctx User context
+ */
+typedef void (*i2s_dma_fake_fill_fn_t)(int16_t *samples, size_t count, uint32_t seq, void *ctx);
+
+/**
+ * @brief Capture configuration
+ */
+typedef struct {
+    i2s_dma_source_t source;
+    i2s_chan_handle_t rx_handle;        ///< I2S: initialised RX channel, not yet enabled
+    uint32_t dma_desc_num;              ///< Buffers the DMA cycles through (validity window, >= 3)
+    uint32_t sample_rate;               ///< FAKE: pacing
+    size_t frame_samples;               ///< FAKE: samples per buffer
+    i2s_dma_fake_fill_fn_t fake_fill;   ///< FAKE: buffer generator (NULL = silence)
+    void *fake_ctx;                     ///< FAKE: passed to fake_fill
+} i2s_dma_capture_config_t;
+
+/**
+ * @brief One DMA buffer handed to the consumer
+ */
+typedef struct {
+    int16_t *samples;                   ///< In DMA memory, writable in place
+    size_t sample_count;
+    uint32_t seq;                       ///< Monotonic buffer sequence number
+    int64_t timestamp_us;               ///< When the DMA completed the buffer
+} i2s_dma_frame_t;
+
+/**
+ * @brief Capture statistics
+ */
+typedef struct {
+    uint32_t frames;                    ///< Buffers completed by the DMA
+    uint32_t delivered;                 ///< Buffers handed to the consumer
+    uint32_t queue_overruns;            ///< Descriptors dropped, consumer far behind
+    uint32_t stale_skipped;             ///< Buffers already overwritten at acquire
+    uint32_t lapped;                    ///< Buffers overwritten while held
+    uint32_t max_wake_us;               ///< Worst DMA-complete to consumer latency
+    float avg_wake_us;                  ///< Running average of the above
+} i2s_dma_capture_stats_t;
+
+typedef struct i2s_dma_capture_t *i2s_dma_capture_handle_t;
+
+/**
+ * @brief Create a capture engine and register the DMA callback
+ */
+esp_err_t i2s_dma_capture_create(const i2s_dma_capture_config_t *config, i2s_dma_capture_handle_t *out_capture);
+
+/**
+ * @brief Stop capture and free the engine
+ */
+esp_err_t i2s_dma_capture_destroy(i2s_dma_capture_handle_t capture);
+
+/**
+ * @brief Enable the RX channel (or start the fake source timer)
+ */
+esp_err_t i2s_dma_capture_start(i2s_dma_capture_handle_t capture);
+
+/**
+ * @brief Disable the RX channel (or stop the fake source timer)
+ */
+esp_err_t i2s_dma_capture_stop(i2s_dma_capture_handle_t capture);
+
+/**
+ * @brief Set the task woken for each buffer (NULL = calling task)
+ *
+ * Only one consumer is supported. The consumer must not use its task
+ * notification value for anything else.
+ */
+esp_err_t i2s_dma_capture_subscribe(i2s_dma_capture_handle_t capture, TaskHandle_t task);
+
+/**
+ * @brief Wait for the next DMA buffer
+ *
+ * @param capture Capture handle
+ * @param frame Output frame, valid until release
+ * @param timeout_ms Longest wait
+ * @return ESP_OK, or ESP_ERR_TIMEOUT if no buffer arrived
+ */
+esp_err_t i2s_dma_capture_acquire(i2s_dma_capture_handle_t capture, i2s_dma_frame_t *frame, uint32_t timeout_ms);
+
+/**
+ * @brief Finish with a frame from acquire
+ *
+ * The buffer stays owned by the DMA; this only checks that it was not
+ * overwritten. Safe to call from any task holding a copy of the descriptor.
+ *
+ * @return true if the frame was intact for the whole time it was held,
+ *         false if the DMA overwrote it (results derived from it are suspect)
+ */
+bool i2s_dma_capture_release(i2s_dma_capture_handle_t capture, const i2s_dma_frame_t *frame);
+
+/**
+ * @brief Snapshot statistics
+ */
+esp_err_t i2s_dma_capture_get_stats(i2s_dma_capture_handle_t capture, i2s_dma_capture_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief RTP/RTCP media transport (RFC 3550) for HowdyTTS audio
+ *
+ * Optional replacement for the custom UDP audio headers. Audio is sent as
+ * L16/16000/1 (RFC 3551, big-endian samples) with a dynamic payload type.
+ * VAD and wake word fields travel in RFC 8285 one-byte header extensions,
+ * so standard tooling still parses the stream. RTCP is multiplexed on the
+ * same port (RFC 5761) and provides loss, jitter and RTT for both ends.
+ *
+ * The session only builds and parses packets; the caller owns the socket
+ * and passes monotonic time in microseconds.
+ */
+
+#define RTP_VERSION                 2
+#define RTP_HEADER_SIZE             12
+#define RTP_PAYLOAD_TYPE_L16        96      // Dynamic PT, L16 mono at session clock rate
+#define RTP_EXT_PROFILE_ONE_BYTE    0xBEDE  // RFC 8285 one-byte header extension
+#define RTP_EXT_ID_VAD              1       // rtp_vad_ext_t, 10 bytes
+#define RTP_EXT_ID_WAKE_WORD        2       // rtp_wake_word_ext_t, 10 bytes
+
+#define RTCP_PT_SR                  200
+#define RTCP_PT_RR                  201
+#define RTCP_PT_SDES                202
+#define RTCP_PT_BYE                 203
+#define RTCP_SDES_CNAME             1
+#define RTCP_REPORT_INTERVAL_MS     5000    // RFC 3550 minimum interval
+#define RTCP_MAX_PACKET_SIZE        128     // SR/RR + one report block + SDES CNAME
+
+/**
+ * @brief VAD fields carried in RTP_EXT_ID_VAD (same meaning as enhanced_udp_audio_header_t)
+ */
+typedef struct {
+    uint8_t  vad_flags;             // UDP_VAD_FLAG_*
+    uint8_t  vad_confidence;        // 0-255
+    uint8_t  detection_quality;     // 0-255
+    uint8_t  snr_db_scaled;         // SNR in dB * 2
+    uint16_t max_amplitude;
+    uint16_t noise_floor;
+    uint16_t zero_crossing_rate;
+} rtp_vad_ext_t;
+
+/**
+ * @brief Wake word fields carried in RTP_EXT_ID_WAKE_WORD (same meaning as enhanced_udp_wake_word_header_t)
+ */
+typedef struct {
+    uint32_t detection_id;
+    uint8_t  flags;                 // UDP_WAKE_WORD_FLAG_*
+    uint8_t  confidence;            // 0-255
+    uint16_t pattern_match_score;   // 0-1000
+    uint8_t  syllable_count;
+    uint8_t  detection_duration_ms;
+} rtp_wake_word_ext_t;
+
+/**
+ * @brief RTP session configuration
+ */
+typedef struct {
+    uint32_t ssrc;                  // Local synchronization source (random per session)
+    uint32_t clock_rate;            // RTP clock rate, equal to sample rate (16000)
+    uint8_t payload_type;           // RTP_PAYLOAD_TYPE_L16 unless negotiated otherwise
+    const char *cname;              // SDES CNAME (e.g., device id); copied
+} rtp_session_config_t;
+
+/**
+ * @brief Parsed RTP packet (payload converted to host byte order in place)
+ */
+typedef struct {
+    uint32_t ssrc;
+    uint16_t sequence;
+    uint32_t timestamp;
+    bool marker;
+    int16_t *samples;               // Points into the caller's packet buffer
+    size_t sample_count;
+    bool has_vad;
+    rtp_vad_ext_t vad;
+    bool has_wake_word;
+    rtp_wake_word_ext_t wake_word;
+} rtp_packet_info_t;
+
+/**
+ * @brief Transport statistics for both directions
+ */
+typedef struct {
+    // Local sender
+    uint32_t ssrc;
+    uint32_t packets_sent;
+    uint32_t octets_sent;           // Payload octets, as in SR
+    uint32_t reports_sent;
+
+    // Remote stream as seen by us
+    uint32_t remote_ssrc;
+    uint32_t packets_received;
+    uint32_t packets_expected;
+    int32_t  cumulative_lost;
+    uint8_t  fraction_lost;         // Last interval, 1/256 units
+    float    jitter_ms;
+    uint32_t bad_packets;           // Malformed or wrong version
+
+    // Peer feedback about our stream (from its RR/SR report block)
+    uint32_t reports_received;
+    uint8_t  remote_fraction_lost;
+    int32_t  remote_cumulative_lost;
+    float    remote_jitter_ms;
+    float    rtt_ms;                // From LSR/DLSR, 0 until the peer echoes an SR
+} rtp_session_stats_t;
+
+typedef struct rtp_session_t rtp_session_t;
+
+/**
+ * @brief Create an RTP session
+ *
+ * @param config Session configuration
+ * @return Session handle or NULL on failure
+ */
+rtp_session_t *rtp_session_create(const rtp_session_config_t *config);
+
+/**
+ * @brief Destroy an RTP session
+ */
+void rtp_session_destroy(rtp_session_t *session);
+
+/**
+ * @brief Build one RTP packet
+ *
+ * The RTP timestamp advances by sample_count after each packet.
+ *
+ * @param session Session handle
+ * @param samples PCM samples (host byte order)
+ * @param sample_count Number of samples
+ * @param vad Optional VAD extension (NULL to omit)
+ * @param wake_word Optional wake word extension (NULL to omit)
+ * @param marker Set the marker bit (first packet of a talkspurt)
+ * @param buf Output buffer
+ * @param buf_len Output buffer size
+ * @return Packet length in bytes, 0 if the buffer is too small
+ */
+size_t rtp_session_build_packet(rtp_session_t *session,
+                                const int16_t *samples, size_t sample_count,
+                                const rtp_vad_ext_t *vad,
+                                const rtp_wake_word_ext_t *wake_word,
+                                bool marker,
+                                uint8_t *buf, size_t buf_len);
+
+/**
+ * @brief Parse a received RTP packet and update receiver statistics
+ *
+ * @param session Session handle
+ * @param packet Packet buffer (payload is byte-swapped in place)
+ * @param len Packet length
+ * @param arrival_us Monotonic arrival time in microseconds
+ * @param info Output packet information
+ * @return true if the packet was valid RTP
+ */
+bool rtp_session_parse_packet(rtp_session_t *session, uint8_t *packet, size_t len,
+                              uint64_t arrival_us, rtp_packet_info_t *info);
+
+/**
+ * @brief Build a compound RTCP report (SR if we sent since the last report, else RR) plus SDES CNAME
+ *
+ * @param session Session handle
+ * @param now_us Monotonic time in microseconds
+ * @param buf Output buffer (RTCP_MAX_PACKET_SIZE is enough)
+ * @param buf_len Output buffer size
+ * @return Report length in bytes, 0 if the buffer is too small
+ */
+size_t rtp_session_build_rtcp(rtp_session_t *session, uint64_t now_us, uint8_t *buf, size_t buf_len);
+
+/**
+ * @brief Parse a received compound RTCP packet (SR/RR report blocks about our SSRC)
+ *
+ * @param session Session handle
+ * @param packet RTCP packet
+ * @param len Packet length
+ * @param now_us Monotonic arrival time in microseconds
+ * @return true if at least one valid RTCP packet was found
+ */
+bool rtp_session_handle_rtcp(rtp_session_t *session, const uint8_t *packet, size_t len, uint64_t now_us);
+
+/**
+ * @brief Check whether it is time to send the next RTCP report
+ */
+bool rtp_session_rtcp_due(const rtp_session_t *session, uint64_t now_us);
+
+/**
+ * @brief RFC 5761 demultiplexing: true if the datagram is RTCP
+ */
+bool rtp_is_rtcp(const uint8_t *packet, size_t len);
+
+/**
+ * @brief Get session statistics
+ */
+void rtp_session_get_stats(const rtp_session_t *session, rtp_session_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,6 +3,7 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include "tts_plc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -21,17 +22,25 @@ void tts_jb_destroy(tts_jitter_buffer_t *jb);
 // Reset (drop all queued data)
 void tts_jb_reset(tts_jitter_buffer_t *jb);
 
+// Enable packet loss concealment on underrun (see tts_plc.h).
+// Returns true when PLC is active.
+bool tts_jb_enable_plc(tts_jitter_buffer_t *jb, uint32_t sample_rate);
+
 // Push PCM samples. Accepts multiples of frame size; excess is buffered.
 // Returns number of samples accepted. Drops oldest on overflow.
 size_t tts_jb_push(tts_jitter_buffer_t *jb, const int16_t *samples, size_t sample_count);
 
-// Pop exactly one frame into out buffer. If underrun, fills silence and returns false_underrun=true.
-// Returns true when real audio provided; false when silence was provided due to underrun.
+// Pop exactly one frame into out buffer. If underrun, fills concealment audio (or silence
+// when PLC is disabled/exhausted) and returns false_underrun=true.
+// Returns true when real audio provided; false when the frame was synthesized due to underrun.
 bool tts_jb_pop_frame(tts_jitter_buffer_t *jb, int16_t *out_frame, bool *false_underrun);
 
 // Current queued frames
 size_t tts_jb_depth(tts_jitter_buffer_t *jb);
 
+// Concealment counters; returns false when PLC is not enabled
+bool tts_jb_get_plc_stats(tts_jitter_buffer_t *jb, tts_plc_stats_t *stats);
+
 #ifdef __cplusplus
 }
 #endif
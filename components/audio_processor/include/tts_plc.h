@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Packet loss concealment for the TTS playout path.
+//
+// Keeps a short history of the most recently played audio. When the jitter
+// buffer underruns, the last pitch period is repeated with a loop-point
+// crossfade and a linear fade-out (full level for 10 ms, silent after 60 ms).
+// When real frames resume, the first few ms are crossfaded from the synthetic
+// continuation. Concealment starts at the exact end of history, so the module
+// adds no algorithmic delay. An underrun that lasts 500 ms is taken as the end
+// of the talkspurt: its silence is not counted as a gap.
+
+typedef struct tts_plc_t tts_plc_t;
+
+typedef struct {
+    uint32_t concealed_frames;    // frames synthesized from pitch history
+    uint32_t silence_frames;      // silent underrun frames in gaps real audio resumed after (< 500 ms)
+    uint32_t concealment_events;  // loss bursts that started while audio was playing
+    uint32_t crossfades;          // recoveries blended back into real audio
+    uint16_t last_pitch_samples;  // pitch period used by the latest loss burst
+} tts_plc_stats_t;
+
+// Create a concealer for fixed-size frames
+// sample_rate: PCM rate in Hz (e.g., 16000)
+// frame_samples: samples per frame (e.g., 320 for 20 ms @ 16 kHz)
+tts_plc_t *tts_plc_create(uint32_t sample_rate, size_t frame_samples);
+
+// Destroy and free resources
+void tts_plc_destroy(tts_plc_t *plc);
+
+// Forget history and loss state (statistics are kept)
+void tts_plc_reset(tts_plc_t *plc);
+
+// Feed a real frame just before it is played. Modified in place when it
+// follows a concealed frame (crossfade from the synthetic signal).
+void tts_plc_good_frame(tts_plc_t *plc, int16_t *frame);
+
+// Produce one frame of concealment audio (silence once concealment is exhausted)
+void tts_plc_conceal_frame(tts_plc_t *plc, int16_t *out_frame);
+
+// Snapshot counters
+void tts_plc_get_stats(const tts_plc_t *plc, tts_plc_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esp_err.h"
+#include "rtp_session.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -18,6 +19,7 @@ typedef struct {
     size_t buffer_size;         // UDP buffer size in bytes
     uint32_t packet_size_ms;    // Audio packet duration in ms (e.g., 20ms)
     bool enable_compression;    // Enable audio compression
+    bool enable_rtp;            // Send RTP/RTCP (RFC 3550) instead of udp_audio_header_t packets
 } udp_audio_config_t;
 
 /**
@@ -44,6 +46,7 @@ typedef struct {
     uint32_t bytes_received;
     uint32_t sequence_errors;
     uint32_t socket_errors;
+    uint32_t ring_overruns;     // Packets dropped because the send task fell behind
     float average_latency_ms;
 } udp_audio_stats_t;
 
@@ -90,7 +93,9 @@ esp_err_t udp_audio_stop(void);
 /**
  * @brief Send audio samples via UDP
  * 
- * Packets audio data according to configured packet size
+ * Packets audio data according to configured packet size. Never blocks:
+ * packets are queued in a lock-free ring and sent by the streamer's send
+ * task. Call from a single task (the capture task).
  * 
  * @param samples Audio samples (16-bit PCM mono)
  * @param sample_count Number of samples
@@ -112,6 +117,37 @@ esp_err_t udp_audio_send_packet(const udp_audio_header_t *header,
                                const uint8_t *audio_data, 
                                size_t audio_size);
 
+/**
+ * @brief Send audio samples as one RTP packet with optional header extensions
+ * 
+ * Only valid when the streamer was initialized with enable_rtp. Samples are
+ * sent as-is (not reassembled into packet_size_ms packets).
+ * 
+ * @param samples Audio samples (16-bit PCM mono)
+ * @param sample_count Number of samples
+ * @param vad Optional VAD extension (NULL to omit)
+ * @param wake_word Optional wake word extension (NULL to omit)
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t udp_audio_send_rtp(const int16_t *samples, size_t sample_count,
+                             const rtp_vad_ext_t *vad,
+                             const rtp_wake_word_ext_t *wake_word);
+
+/**
+ * @brief Check if the streamer is running in RTP mode
+ * 
+ * @return true if enable_rtp was set at init
+ */
+bool udp_audio_is_rtp_enabled(void);
+
+/**
+ * @brief Get RTP/RTCP statistics (loss, jitter, RTT)
+ * 
+ * @param stats Output statistics structure
+ * @return esp_err_t ESP_OK on success, ESP_ERR_INVALID_STATE if RTP is disabled
+ */
+esp_err_t udp_audio_get_rtp_stats(rtp_session_stats_t *stats);
+
 /**
  * @brief Update server endpoint
  * 
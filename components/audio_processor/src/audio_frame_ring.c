@@ -0,0 +1,220 @@
+#include "audio_frame_ring.h"
+#include "howdy_mem_placement.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RING_LINE AUDIO_FRAME_RING_CACHE_LINE
+
+typedef struct audio_frame_ring_t {
+    // Producer-owned line
+    _Alignas(RING_LINE) atomic_size_t head;     // Next slot to publish
+    size_t cached_tail;                         // Producer's view of tail
+    atomic_uint committed;
+    atomic_uint overruns;
+    atomic_uint high_water;
+
+    // Consumer-owned line
+    _Alignas(RING_LINE) atomic_size_t tail;     // Next slot to consume
+    size_t cached_head;                         // Consumer's view of head
+    atomic_uint released;
+
+    // Read-only after create
+    _Alignas(RING_LINE) size_t capacity;
+    size_t mask;
+    size_t frame_bytes;
+    size_t stride;
+    uint8_t *slots;
+    uint32_t *lengths;
+    void *raw;                                  // Unaligned allocation backing this struct
+} audio_frame_ring_t;
+
+static size_t round_up(size_t v, size_t align)
+{
+    return (v + align - 1) & ~(align - 1);
+}
+
+static size_t next_pow2(size_t v)
+{
+    size_t p = 1;
+    while (p < v) p <<= 1;
+    return p;
+}
+
+audio_frame_ring_t *audio_frame_ring_create(size_t frame_bytes, size_t frame_count)
+{
+    if (frame_bytes == 0 || frame_count == 0) return NULL;
+
+    size_t capacity = next_pow2(frame_count);
+    size_t stride = round_up(frame_bytes, RING_LINE);
+    size_t hdr = round_up(sizeof(audio_frame_ring_t), RING_LINE);
+    size_t lens = round_up(capacity * sizeof(uint32_t), RING_LINE);
+    size_t total = hdr + lens + capacity * stride;
+
+    // One block: ring header, length table, slots; all cache-line aligned
+    void *raw = howdy_mem_calloc(HOWDY_MEM_HOT, 1, total + RING_LINE - 1);
+    if (!raw) return NULL;
+
+    uint8_t *base = (uint8_t *)round_up((uintptr_t)raw, RING_LINE);
+    audio_frame_ring_t *ring = (audio_frame_ring_t *)base;
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->committed, 0);
+    atomic_init(&ring->overruns, 0);
+    atomic_init(&ring->high_water, 0);
+    atomic_init(&ring->released, 0);
+    ring->cached_tail = 0;
+    ring->cached_head = 0;
+    ring->capacity = capacity;
+    ring->mask = capacity - 1;
+    ring->frame_bytes = frame_bytes;
+    ring->stride = stride;
+    ring->lengths = (uint32_t *)(base + hdr);
+    ring->slots = base + hdr + lens;
+    ring->raw = raw;
+    return ring;
+}
+
+void audio_frame_ring_destroy(audio_frame_ring_t *ring)
+{
+    if (!ring) return;
+    howdy_mem_free(ring->raw);
+}
+
+void audio_frame_ring_reset(audio_frame_ring_t *ring)
+{
+    if (!ring) return;
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    atomic_store_explicit(&ring->tail, head, memory_order_relaxed);
+    ring->cached_tail = head;
+    ring->cached_head = head;
+}
+
+size_t audio_frame_ring_claim(audio_frame_ring_t *ring, size_t max_frames, audio_frame_span_t *span)
+{
+    if (!ring || !span) return 0;
+
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    size_t free_slots = ring->capacity - (head - ring->cached_tail);
+    if (free_slots < max_frames) {
+        // Only touch the consumer's line when the cached view is not enough
+        ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        free_slots = ring->capacity - (head - ring->cached_tail);
+    }
+
+    size_t idx = head & ring->mask;
+    size_t n = max_frames;
+    if (n > free_slots) n = free_slots;
+    if (n > ring->capacity - idx) n = ring->capacity - idx;
+
+    span->data = ring->slots + idx * ring->stride;
+    span->stride = ring->stride;
+    span->lengths = ring->lengths + idx;
+    span->count = n;
+    return n;
+}
+
+void audio_frame_ring_commit(audio_frame_ring_t *ring, size_t count)
+{
+    if (!ring || count == 0) return;
+
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed) + count;
+    atomic_store_explicit(&ring->head, head, memory_order_release);
+    atomic_fetch_add_explicit(&ring->committed, (unsigned)count, memory_order_relaxed);
+
+    // Upper bound: cached_tail may lag the real tail
+    unsigned depth = (unsigned)(head - ring->cached_tail);
+    if (depth > atomic_load_explicit(&ring->high_water, memory_order_relaxed)) {
+        atomic_store_explicit(&ring->high_water, depth, memory_order_relaxed);
+    }
+}
+
+void audio_frame_ring_note_overrun(audio_frame_ring_t *ring, size_t frames)
+{
+    if (!ring || frames == 0) return;
+    atomic_fetch_add_explicit(&ring->overruns, (unsigned)frames, memory_order_relaxed);
+}
+
+size_t audio_frame_ring_peek(audio_frame_ring_t *ring, size_t max_frames, audio_frame_span_t *span)
+{
+    if (!ring || !span) return 0;
+
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    size_t avail = ring->cached_head - tail;
+    if (avail < max_frames) {
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        avail = ring->cached_head - tail;
+    }
+
+    size_t idx = tail & ring->mask;
+    size_t n = max_frames;
+    if (n > avail) n = avail;
+    if (n > ring->capacity - idx) n = ring->capacity - idx;
+
+    span->data = ring->slots + idx * ring->stride;
+    span->stride = ring->stride;
+    span->lengths = ring->lengths + idx;
+    span->count = n;
+    return n;
+}
+
+void audio_frame_ring_release(audio_frame_ring_t *ring, size_t count)
+{
+    if (!ring || count == 0) return;
+
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed) + count;
+    atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    atomic_fetch_add_explicit(&ring->released, (unsigned)count, memory_order_relaxed);
+}
+
+bool audio_frame_ring_push(audio_frame_ring_t *ring, const void *data, size_t len)
+{
+    if (!ring || !data || len > ring->frame_bytes) return false;
+
+    audio_frame_span_t span;
+    if (audio_frame_ring_claim(ring, 1, &span) == 0) {
+        audio_frame_ring_note_overrun(ring, 1);
+        return false;
+    }
+    memcpy(span.data, data, len);
+    span.lengths[0] = (uint32_t)len;
+    audio_frame_ring_commit(ring, 1);
+    return true;
+}
+
+bool audio_frame_ring_pop(audio_frame_ring_t *ring, void *out, size_t *len)
+{
+    if (!ring || !out) return false;
+
+    audio_frame_span_t span;
+    if (audio_frame_ring_peek(ring, 1, &span) == 0) {
+        return false;
+    }
+    memcpy(out, span.data, span.lengths[0]);
+    if (len) *len = span.lengths[0];
+    audio_frame_ring_release(ring, 1);
+    return true;
+}
+
+size_t audio_frame_ring_count(const audio_frame_ring_t *ring)
+{
+    if (!ring) return 0;
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return head - tail;
+}
+
+void audio_frame_ring_get_stats(const audio_frame_ring_t *ring, audio_frame_ring_stats_t *stats)
+{
+    if (!stats) return;
+    memset(stats, 0, sizeof(*stats));
+    if (!ring) return;
+
+    stats->capacity = ring->capacity;
+    stats->frame_bytes = ring->frame_bytes;
+    stats->frames_committed = atomic_load_explicit(&ring->committed, memory_order_relaxed);
+    stats->frames_released = atomic_load_explicit(&ring->released, memory_order_relaxed);
+    stats->overruns = atomic_load_explicit(&ring->overruns, memory_order_relaxed);
+    stats->high_water = atomic_load_explicit(&ring->high_water, memory_order_relaxed);
+}
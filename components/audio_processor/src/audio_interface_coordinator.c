@@ -1,5 +1,6 @@
 #include "audio_interface_coordinator.h"
 #include "audio_processor.h"
+#include "howdy_mem_placement.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -212,7 +213,7 @@ esp_err_t audio_interface_interrupt_playback(void)
     if (s_audio_interface.tts_audio_queue) {
         tts_audio_chunk_t chunk;
         while (xQueueReceive(s_audio_interface.tts_audio_queue, &chunk, 0) == pdTRUE) {
-            free(chunk.data);
+            howdy_mem_free(chunk.data);
         }
     }
 
@@ -254,7 +255,7 @@ esp_err_t audio_interface_deinit(void)
         // Clear any remaining TTS chunks
         tts_audio_chunk_t chunk;
         while (xQueueReceive(s_audio_interface.tts_audio_queue, &chunk, 0) == pdTRUE) {
-            free(chunk.data);
+            howdy_mem_free(chunk.data);
         }
         vQueueDelete(s_audio_interface.tts_audio_queue);
         s_audio_interface.tts_audio_queue = NULL;
@@ -279,10 +280,18 @@ esp_err_t audio_interface_start_listening(void)
     
     ESP_LOGI(TAG, "Starting listening mode - will capture and stream audio to server");
     
+    // The capture task is the single consumer of captured frames
+    esp_err_t ret = audio_processor_subscribe_buffer(s_audio_interface.capture_task_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Microphone frames are taken by another consumer");
+        return ret;
+    }
+    
     // Start audio processor capture
-    esp_err_t ret = audio_processor_start_capture();
+    ret = audio_processor_start_capture();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start audio capture: %s", esp_err_to_name(ret));
+        audio_processor_unsubscribe_buffer(s_audio_interface.capture_task_handle);
         return ret;
     }
     
@@ -316,6 +325,7 @@ esp_err_t audio_interface_stop_listening(void)
         
         // Stop audio processor capture
         audio_processor_stop_capture();
+        audio_processor_unsubscribe_buffer(s_audio_interface.capture_task_handle);
         
         change_state(AUDIO_INTERFACE_STATE_IDLE);
     }
@@ -332,7 +342,7 @@ esp_err_t audio_interface_play_tts_audio(const uint8_t *audio_data, size_t data_
     ESP_LOGD(TAG, "Received TTS audio chunk from server: %zu bytes", data_len);
     
     // Allocate memory for TTS chunk
-    uint8_t *chunk_data = malloc(data_len);
+    uint8_t *chunk_data = howdy_mem_alloc(HOWDY_MEM_BULK, data_len);
     if (!chunk_data) {
         ESP_LOGE(TAG, "Failed to allocate memory for TTS chunk (%zu bytes)", data_len);
         return ESP_ERR_NO_MEM;
@@ -357,7 +367,7 @@ esp_err_t audio_interface_play_tts_audio(const uint8_t *audio_data, size_t data_
     // Queue TTS chunk for playback
     if (xQueueSend(s_audio_interface.tts_audio_queue, &chunk, pdMS_TO_TICKS(100)) != pdTRUE) {
         ESP_LOGW(TAG, "TTS playback queue full, dropping chunk");
-        free(chunk_data);
+        howdy_mem_free(chunk_data);
         return ESP_ERR_TIMEOUT;
     }
     
@@ -462,8 +472,8 @@ static void audio_capture_task(void *pvParameters)
     
     while (1) {
         if (s_audio_interface.microphone_active) {
-            // Get audio buffer from processor
-            esp_err_t ret = audio_processor_get_buffer(&audio_buffer, &buffer_length);
+            // Wait for the capture task to publish a frame (notified, no polling)
+            esp_err_t ret = audio_processor_wait_buffer(&audio_buffer, &buffer_length, 100);
             if (ret == ESP_OK && audio_buffer && buffer_length > 0) {
                 
                 // Apply microphone gain
@@ -507,14 +517,15 @@ static void audio_capture_task(void *pvParameters)
                 ESP_LOGD(TAG, "Captured audio chunk: %zu bytes, level: %.3f, voice: %s", 
                         buffer_length, audio_level, voice_active ? "YES" : "NO");
                 
-            } else if (ret != ESP_ERR_TIMEOUT) {
+            } else if (ret != ESP_ERR_TIMEOUT && s_audio_interface.microphone_active) {
+                // (INVALID_STATE is expected once stop_listening has unsubscribed us)
                 ESP_LOGW(TAG, "Failed to get audio buffer: %s", esp_err_to_name(ret));
                 notify_event(AUDIO_INTERFACE_EVENT_ERROR, (const uint8_t*)&ret, sizeof(ret));
             }
+        } else {
+            // Idle until the microphone is switched on
+            vTaskDelay(pdMS_TO_TICKS(10));
         }
-        
-        // Short delay to prevent busy waiting
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
 }
 
@@ -541,7 +552,7 @@ static void tts_playback_task(void *pvParameters)
             }
             
             // Free chunk memory
-            free(chunk.data);
+            howdy_mem_free(chunk.data);
             
         } else {
             // No TTS data for a while, check if we should stop playback
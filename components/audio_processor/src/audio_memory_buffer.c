@@ -1,10 +1,16 @@
 #include "audio_memory_buffer.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
+#include "howdy_mem_placement.h"
 #include <string.h>
 
 static const char *TAG = "AudioMemoryBuffer";
 
+static inline size_t used_samples(const audio_memory_buffer_t *amb, size_t write_pos, size_t read_pos)
+{
+    return (write_pos + amb->slots - read_pos) % amb->slots;
+}
+
 esp_err_t audio_memory_buffer_init(audio_memory_buffer_t *amb, size_t buffer_size)
 {
     if (!amb || buffer_size == 0) {
@@ -12,30 +18,24 @@ esp_err_t audio_memory_buffer_init(audio_memory_buffer_t *amb, size_t buffer_siz
         return ESP_ERR_INVALID_ARG;
     }
 
-    // Allocate buffer memory (use DMA capable memory for audio)
-    amb->buffer = heap_caps_malloc(buffer_size * sizeof(int16_t), MALLOC_CAP_DMA);
+    // Allocate buffer memory (use DMA capable memory for audio); one spare
+    // slot distinguishes full from empty without a shared counter
+    amb->buffer = howdy_mem_alloc(HOWDY_MEM_DMA, (buffer_size + 1) * sizeof(int16_t));
     if (!amb->buffer) {
         ESP_LOGE(TAG, "Failed to allocate audio buffer memory");
         return ESP_ERR_NO_MEM;
     }
 
-    // Create mutex for thread safety
-    amb->mutex = xSemaphoreCreateMutex();
-    if (!amb->mutex) {
-        ESP_LOGE(TAG, "Failed to create mutex");
-        heap_caps_free(amb->buffer);
-        return ESP_ERR_NO_MEM;
-    }
-
     // Initialize buffer parameters
     amb->buffer_size = buffer_size;
-    amb->write_pos = 0;
-    amb->read_pos = 0;
-    amb->available_samples = 0;
+    amb->slots = buffer_size + 1;
+    atomic_init(&amb->write_pos, 0);
+    atomic_init(&amb->read_pos, 0);
+    atomic_init(&amb->overrun_samples, 0);
     amb->is_initialized = true;
 
     // Clear buffer
-    memset(amb->buffer, 0, buffer_size * sizeof(int16_t));
+    memset(amb->buffer, 0, amb->slots * sizeof(int16_t));
 
     ESP_LOGI(TAG, "Audio memory buffer initialized: %zu samples", buffer_size);
     return ESP_OK;
@@ -47,23 +47,14 @@ esp_err_t audio_memory_buffer_deinit(audio_memory_buffer_t *amb)
         return ESP_ERR_INVALID_ARG;
     }
 
-    // Take mutex before cleanup
-    if (xSemaphoreTake(amb->mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-        amb->is_initialized = false;
-        xSemaphoreGive(amb->mutex);
-    }
+    amb->is_initialized = false;
 
     // Free resources
     if (amb->buffer) {
-        heap_caps_free(amb->buffer);
+        howdy_mem_free(amb->buffer);
         amb->buffer = NULL;
     }
 
-    if (amb->mutex) {
-        vSemaphoreDelete(amb->mutex);
-        amb->mutex = NULL;
-    }
-
     ESP_LOGI(TAG, "Audio memory buffer deinitialized");
     return ESP_OK;
 }
@@ -74,30 +65,24 @@ esp_err_t audio_memory_buffer_write(audio_memory_buffer_t *amb, const int16_t *s
         return ESP_ERR_INVALID_ARG;
     }
 
-    if (xSemaphoreTake(amb->mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
-        ESP_LOGW(TAG, "Failed to take mutex for write");
-        return ESP_ERR_TIMEOUT;
-    }
+    size_t write_pos = atomic_load_explicit(&amb->write_pos, memory_order_relaxed);
+    size_t read_pos = atomic_load_explicit(&amb->read_pos, memory_order_acquire);
+    size_t space = amb->buffer_size - used_samples(amb, write_pos, read_pos);
 
-    size_t samples_written = 0;
-    
-    for (size_t i = 0; i < num_samples; i++) {
-        // Check if buffer is full
-        if (amb->available_samples >= amb->buffer_size) {
-            // Overwrite oldest data (ring buffer behavior)
-            amb->read_pos = (amb->read_pos + 1) % amb->buffer_size;
-        } else {
-            amb->available_samples++;
-        }
-        
-        // Write sample
-        amb->buffer[amb->write_pos] = samples[i];
-        amb->write_pos = (amb->write_pos + 1) % amb->buffer_size;
-        samples_written++;
+    size_t samples_written = (num_samples < space) ? num_samples : space;
+    if (samples_written < num_samples) {
+        atomic_fetch_add_explicit(&amb->overrun_samples, (unsigned)(num_samples - samples_written),
+                                  memory_order_relaxed);
     }
 
-    xSemaphoreGive(amb->mutex);
-    
+    // Copy in at most two runs (before and after the wrap)
+    size_t first = amb->slots - write_pos;
+    if (first > samples_written) first = samples_written;
+    memcpy(&amb->buffer[write_pos], samples, first * sizeof(int16_t));
+    memcpy(amb->buffer, samples + first, (samples_written - first) * sizeof(int16_t));
+
+    atomic_store_explicit(&amb->write_pos, (write_pos + samples_written) % amb->slots, memory_order_release);
+
     ESP_LOGD(TAG, "Written %zu samples to buffer", samples_written);
     return ESP_OK;
 }
@@ -108,28 +93,24 @@ esp_err_t audio_memory_buffer_read(audio_memory_buffer_t *amb, int16_t *samples,
         return ESP_ERR_INVALID_ARG;
     }
 
-    if (xSemaphoreTake(amb->mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
-        ESP_LOGW(TAG, "Failed to take mutex for read");
-        return ESP_ERR_TIMEOUT;
-    }
+    size_t read_pos = atomic_load_explicit(&amb->read_pos, memory_order_relaxed);
+    size_t write_pos = atomic_load_explicit(&amb->write_pos, memory_order_acquire);
+    size_t available = used_samples(amb, write_pos, read_pos);
+
+    size_t samples_read = (num_samples < available) ? num_samples : available;
+
+    size_t first = amb->slots - read_pos;
+    if (first > samples_read) first = samples_read;
+    memcpy(samples, &amb->buffer[read_pos], first * sizeof(int16_t));
+    memcpy(samples + first, amb->buffer, (samples_read - first) * sizeof(int16_t));
+
+    atomic_store_explicit(&amb->read_pos, (read_pos + samples_read) % amb->slots, memory_order_release);
 
-    size_t samples_read = 0;
-    size_t samples_to_read = (num_samples < amb->available_samples) ? num_samples : amb->available_samples;
-    
-    for (size_t i = 0; i < samples_to_read; i++) {
-        samples[i] = amb->buffer[amb->read_pos];
-        amb->read_pos = (amb->read_pos + 1) % amb->buffer_size;
-        amb->available_samples--;
-        samples_read++;
-    }
-    
     // Fill remaining with zeros if requested more than available
     for (size_t i = samples_read; i < num_samples; i++) {
         samples[i] = 0;
     }
 
-    xSemaphoreGive(amb->mutex);
-    
     ESP_LOGD(TAG, "Read %zu samples from buffer", samples_read);
     return ESP_OK;
 }
@@ -140,13 +121,9 @@ size_t audio_memory_buffer_available(audio_memory_buffer_t *amb)
         return 0;
     }
 
-    size_t available = 0;
-    if (xSemaphoreTake(amb->mutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        available = amb->available_samples;
-        xSemaphoreGive(amb->mutex);
-    }
-
-    return available;
+    size_t read_pos = atomic_load_explicit(&amb->read_pos, memory_order_acquire);
+    size_t write_pos = atomic_load_explicit(&amb->write_pos, memory_order_acquire);
+    return used_samples(amb, write_pos, read_pos);
 }
 
 bool audio_memory_buffer_is_empty(audio_memory_buffer_t *amb)
@@ -154,24 +131,25 @@ bool audio_memory_buffer_is_empty(audio_memory_buffer_t *amb)
     return (audio_memory_buffer_available(amb) == 0);
 }
 
-esp_err_t audio_memory_buffer_clear(audio_memory_buffer_t *amb)
+uint32_t audio_memory_buffer_overruns(audio_memory_buffer_t *amb)
 {
     if (!amb || !amb->is_initialized) {
-        return ESP_ERR_INVALID_ARG;
+        return 0;
     }
 
-    if (xSemaphoreTake(amb->mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
-        ESP_LOGW(TAG, "Failed to take mutex for clear");
-        return ESP_ERR_TIMEOUT;
+    return atomic_load_explicit(&amb->overrun_samples, memory_order_relaxed);
+}
+
+esp_err_t audio_memory_buffer_clear(audio_memory_buffer_t *amb)
+{
+    if (!amb || !amb->is_initialized) {
+        return ESP_ERR_INVALID_ARG;
     }
 
-    amb->write_pos = 0;
-    amb->read_pos = 0;
-    amb->available_samples = 0;
-    memset(amb->buffer, 0, amb->buffer_size * sizeof(int16_t));
+    // Consume everything written so far
+    size_t write_pos = atomic_load_explicit(&amb->write_pos, memory_order_acquire);
+    atomic_store_explicit(&amb->read_pos, write_pos, memory_order_release);
 
-    xSemaphoreGive(amb->mutex);
-    
     ESP_LOGI(TAG, "Audio buffer cleared");
     return ESP_OK;
-}
\ No newline at end of file
+}
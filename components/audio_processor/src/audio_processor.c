@@ -3,13 +3,18 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
-#include "freertos/ringbuf.h"
 #include "driver/i2s_std.h"
 #include "driver/gpio.h"
 #include "esp_log.h"
 #include "esp_check.h"
 #include "esp_timer.h"
 #include "tts_jitter_buffer.h"
+#include "audio_frame_ring.h"
+#include "i2s_dma_capture.h"
+#include "howdy_mem_placement.h"
+#include "howdy_latency.h"
+#include "howdy_trace.h"
+#include "howdy_sched_monitor.h"
 
 static const char *TAG = "AudioProcessor";
 
@@ -27,8 +32,17 @@ static i2s_chan_handle_t s_rx_handle = NULL;
 static TaskHandle_t s_capture_task_handle = NULL;
 static TaskHandle_t s_playback_task_handle = NULL;
 
-// Ring buffer for audio data
-static RingbufHandle_t s_ringbuf_handle = NULL;
+// DMA buffers arrive via on_recv; the capture task processes them in place
+static i2s_dma_capture_handle_t s_dma_capture = NULL;
+
+// DMA frame descriptors handed from the capture task to audio_processor_get_buffer()
+// (single producer, single consumer: only the subscribed task may take frames)
+static audio_frame_ring_t *s_capture_ring = NULL;
+static portMUX_TYPE s_capture_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t volatile s_capture_consumer = NULL;  // Set by audio_processor_subscribe_buffer()
+static i2s_dma_frame_t s_capture_borrowed;    // Frame held by the consumer
+static TaskHandle_t volatile s_capture_borrower = NULL;  // Task holding it, until release_buffer()
+static TaskHandle_t volatile s_capture_waiter = NULL;  // Task blocked in wait_buffer()
 
 // Callback function
 static audio_event_callback_t s_event_callback = NULL;
@@ -58,60 +72,73 @@ static size_t s_frame_samples = 0; // e.g., 320 for 20 ms at 16 kHz
 
 static void audio_capture_task(void *pvParameters)
 {
-    uint8_t *buffer = (uint8_t *)malloc(s_config.dma_buf_len * s_config.bits_per_sample / 8);
-    if (!buffer) {
-        ESP_LOGE(TAG, "Failed to allocate capture buffer");
-        vTaskDelete(NULL);
-        return;
-    }
+    ESP_LOGI(TAG, "Audio capture task started");
     
-    size_t bytes_read = 0;
+    // Woken by the DMA on_recv ISR; no polling and no copy out of DMA memory
+    i2s_dma_capture_subscribe(s_dma_capture, NULL);
     
-    ESP_LOGI(TAG, "Audio capture task started");
+    // One wake per DMA buffer of dma_buf_len frames
+    uint32_t period_us = (uint32_t)((uint64_t)s_config.dma_buf_len * 1000000 / s_config.sample_rate);
+    howdy_sched_handle_t sched = howdy_sched_register("audio_capture", period_us);
     
     while (s_capture_active) {
-        // Read audio data from I2S
-        esp_err_t ret = i2s_channel_read(s_rx_handle, buffer, 
-                                       s_config.dma_buf_len * s_config.bits_per_sample / 8, 
-                                       &bytes_read, pdMS_TO_TICKS(100));
-        
-        if (ret == ESP_OK && bytes_read > 0) {
-            uint64_t start_time = esp_timer_get_time();
-            
-            // Send to ring buffer
-            if (xRingbufferSend(s_ringbuf_handle, buffer, bytes_read, 0) != pdTRUE) {
-                ESP_LOGW(TAG, "Ring buffer full, dropping audio data");
-            }
-            
-            // HowdyTTS Integration: Process audio for streaming
-            if (s_howdytts_enabled && s_howdytts_config.howdytts_audio_callback) {
-                // Convert bytes to 16-bit samples
-                size_t sample_count = bytes_read / 2;  // Assuming 16-bit samples
-                int16_t *samples = (int16_t*)buffer;
-                
-                // Call HowdyTTS callback for UDP/WebSocket streaming
-                s_howdytts_config.howdytts_audio_callback(samples, sample_count, s_howdytts_config.howdytts_user_data);
-            }
-            
-            // Notify callback if set
-            if (s_event_callback) {
-                s_event_callback(AUDIO_EVENT_DATA_READY, buffer, bytes_read);
-            }
-            
-            // Update processing statistics
-            uint64_t end_time = esp_timer_get_time();
-            s_total_process_time_us += (end_time - start_time);
-            s_frames_processed++;
-        } else if (ret != ESP_ERR_TIMEOUT) {
-            ESP_LOGE(TAG, "I2S read error: %s", esp_err_to_name(ret));
+        i2s_dma_frame_t frame;
+        esp_err_t ret = i2s_dma_capture_acquire(s_dma_capture, &frame, 100);
+        if (ret == ESP_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "DMA capture error: %s", esp_err_to_name(ret));
             if (s_event_callback) {
                 s_event_callback(AUDIO_EVENT_ERROR, NULL, 0);
             }
             break;
         }
+        
+        howdy_sched_wake(sched);
+        howdy_lat_mark_at(HOWDY_LAT_I2S_DMA, frame.timestamp_us);
+        HOWDY_TRACE(HOWDY_TRACE_CAPTURE_FRAME, frame.seq, audio_frame_ring_count(s_capture_ring));
+        
+        uint64_t start_time = esp_timer_get_time();
+        uint8_t *buffer = (uint8_t *)frame.samples;
+        size_t bytes_read = frame.sample_count * sizeof(int16_t);
+        
+        // HowdyTTS Integration: Process audio for streaming
+        if (s_howdytts_enabled && s_howdytts_config.howdytts_audio_callback) {
+            s_howdytts_config.howdytts_audio_callback(frame.samples, frame.sample_count, s_howdytts_config.howdytts_user_data);
+        }
+        
+        // Notify callback if set
+        if (s_event_callback) {
+            s_event_callback(AUDIO_EVENT_DATA_READY, buffer, bytes_read);
+        }
+        
+        // Hand the descriptor (not the samples) on to the get_buffer() consumer
+        if (audio_frame_ring_push(s_capture_ring, &frame, sizeof(frame))) {
+            TaskHandle_t waiter = s_capture_waiter;
+            if (waiter) {
+                xTaskNotifyGive(waiter);
+            }
+        } else {
+            audio_frame_ring_stats_t ring_stats;
+            audio_frame_ring_get_stats(s_capture_ring, &ring_stats);
+            if (ring_stats.overruns % 250 == 1) {
+                ESP_LOGW(TAG, "Capture ring full, dropped %lu frames so far", ring_stats.overruns);
+            }
+        }
+        
+        if (!i2s_dma_capture_release(s_dma_capture, &frame)) {
+            ESP_LOGW(TAG, "Capture callbacks overran the DMA window (frame %lu)", frame.seq);
+        }
+        
+        // Update processing statistics
+        uint64_t end_time = esp_timer_get_time();
+        s_total_process_time_us += (end_time - start_time);
+        s_frames_processed++;
+        howdy_sched_done(sched);
     }
     
-    free(buffer);
+    howdy_sched_unregister(sched);
     ESP_LOGI(TAG, "Audio capture task stopped");
     vTaskDelete(NULL);
 }
@@ -122,15 +149,16 @@ static void audio_playback_task(void *pvParameters)
     const TickType_t frame_period = pdMS_TO_TICKS(20); // 20ms cadence
     TickType_t last_wake = xTaskGetTickCount();
 
-    int16_t *frame = (int16_t *)malloc(s_frame_samples * sizeof(int16_t));
+    int16_t *frame = (int16_t *)howdy_mem_alloc(HOWDY_MEM_HOT, s_frame_samples * sizeof(int16_t));
     if (!frame) {
         ESP_LOGE(TAG, "Failed to allocate playback frame buffer");
         vTaskDelete(NULL);
         return;
     }
+    howdy_sched_handle_t sched = howdy_sched_register("audio_playback", 20000);
 
     while (s_playback_active) {
-        vTaskDelayUntil(&last_wake, frame_period);
+        howdy_sched_delay_until(sched, &last_wake, frame_period);
 
         bool underrun = false;
         if (!s_tts_jb) {
@@ -138,6 +166,9 @@ static void audio_playback_task(void *pvParameters)
             underrun = true;
         } else {
             (void)tts_jb_pop_frame(s_tts_jb, frame, &underrun);
+            if (!underrun) {
+                howdy_lat_mark(HOWDY_LAT_PLAYOUT_POP);
+            }
         }
 
         size_t bytes_written = 0;
@@ -146,14 +177,15 @@ static void audio_playback_task(void *pvParameters)
                                           &bytes_written, pdMS_TO_TICKS(5));
         if (ret != ESP_OK) {
             ESP_LOGW(TAG, "I2S write error: %s", esp_err_to_name(ret));
+        } else if (!underrun) {
+            howdy_lat_mark(HOWDY_LAT_I2S_WRITE);
         }
 
-        if (underrun) {
-            ESP_LOGD(TAG, "Playback underrun: wrote silence frame");
-        }
+        HOWDY_TRACE(HOWDY_TRACE_PLAYOUT_FRAME, s_tts_jb ? tts_jb_depth(s_tts_jb) : 0, underrun);
     }
 
-    free(frame);
+    howdy_mem_free(frame);
+    howdy_sched_unregister(sched);
     
     ESP_LOGI(TAG, "Audio playback task stopped");
     vTaskDelete(NULL);
@@ -165,7 +197,8 @@ static esp_err_t setup_i2s_channels(void)
     
     // I2S channel configuration
     i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_0, I2S_ROLE_MASTER);
-    chan_cfg.dma_desc_num = s_config.dma_buf_count;
+    // Frames are used in place, so keep at least three buffers in rotation
+    chan_cfg.dma_desc_num = s_config.dma_buf_count < 3 ? 3 : s_config.dma_buf_count;
     chan_cfg.dma_frame_num = s_config.dma_buf_len;
     
     // Create I2S channels
@@ -220,16 +253,24 @@ esp_err_t audio_processor_init(const audio_processor_config_t *config)
     // Setup I2S channels
     ESP_RETURN_ON_ERROR(setup_i2s_channels(), TAG, "Failed to setup I2S channels");
     
-    // Create ring buffer for audio data
-    s_ringbuf_handle = xRingbufferCreate(s_config.dma_buf_len * s_config.dma_buf_count * 4, RINGBUF_TYPE_BYTEBUF);
-    if (!s_ringbuf_handle) {
-        ESP_LOGE(TAG, "Failed to create ring buffer");
+    // Register on_recv before the RX channel is ever enabled
+    i2s_dma_capture_config_t dma_cfg = {
+        .source = I2S_DMA_SOURCE_I2S,
+        .rx_handle = s_rx_handle,
+        .dma_desc_num = s_config.dma_buf_count < 3 ? 3 : s_config.dma_buf_count,
+    };
+    ESP_RETURN_ON_ERROR(i2s_dma_capture_create(&dma_cfg, &s_dma_capture), TAG, "Failed to set up DMA capture");
+    
+    // Descriptor ring towards get_buffer(); deeper than the DMA window, stale frames are skipped
+    s_capture_ring = audio_frame_ring_create(sizeof(i2s_dma_frame_t), dma_cfg.dma_desc_num * 2);
+    if (!s_capture_ring) {
+        ESP_LOGE(TAG, "Failed to create capture ring");
         return ESP_ERR_NO_MEM;
     }
     
     // Allocate audio buffer
     s_buffer_size = s_config.dma_buf_len * s_config.bits_per_sample / 8;
-    s_audio_buffer = (uint8_t *)malloc(s_buffer_size);
+    s_audio_buffer = (uint8_t *)howdy_mem_alloc(HOWDY_MEM_HOT, s_buffer_size);
     if (!s_audio_buffer) {
         ESP_LOGE(TAG, "Failed to allocate audio buffer");
         return ESP_ERR_NO_MEM;
@@ -248,6 +289,11 @@ esp_err_t audio_processor_init(const audio_processor_config_t *config)
         return ESP_ERR_NO_MEM;
     }
 
+    // Conceal underruns with pitch-repeated audio instead of hard silence
+    if (!tts_jb_enable_plc(s_tts_jb, s_config.sample_rate)) {
+        ESP_LOGW(TAG, "Packet loss concealment unavailable, underruns will play silence");
+    }
+
     s_initialized = true;
     ESP_LOGI(TAG, "Audio processor initialized successfully");
     
@@ -268,8 +314,8 @@ esp_err_t audio_processor_start_capture(void)
     
     ESP_LOGI(TAG, "Starting audio capture...");
     
-    // Enable RX channel
-    ESP_RETURN_ON_ERROR(i2s_channel_enable(s_rx_handle), TAG, "Failed to enable RX channel");
+    // Enable RX channel; DMA completions now drive the capture task
+    ESP_RETURN_ON_ERROR(i2s_dma_capture_start(s_dma_capture), TAG, "Failed to start DMA capture");
     
     s_capture_active = true;
     
@@ -287,7 +333,7 @@ esp_err_t audio_processor_start_capture(void)
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create audio capture task");
         s_capture_active = false;
-        i2s_channel_disable(s_rx_handle);
+        i2s_dma_capture_stop(s_dma_capture);
         return ESP_FAIL;
     }
     
@@ -316,7 +362,7 @@ esp_err_t audio_processor_stop_capture(void)
     }
     
     // Disable RX channel
-    i2s_channel_disable(s_rx_handle);
+    i2s_dma_capture_stop(s_dma_capture);
     
     if (s_event_callback) {
         s_event_callback(AUDIO_EVENT_STOPPED, NULL, 0);
@@ -395,31 +441,111 @@ esp_err_t audio_processor_set_callback(audio_event_callback_t callback)
     return ESP_OK;
 }
 
+esp_err_t audio_processor_subscribe_buffer(TaskHandle_t task)
+{
+    if (!task) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    esp_err_t ret = ESP_OK;
+    portENTER_CRITICAL(&s_capture_lock);
+    if (!s_capture_consumer) {
+        s_capture_consumer = task;
+    } else if (s_capture_consumer != task) {
+        ret = ESP_ERR_INVALID_STATE;
+    }
+    portEXIT_CRITICAL(&s_capture_lock);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Capture frames already go to task %s", pcTaskGetName(s_capture_consumer));
+    }
+    return ret;
+}
+
+esp_err_t audio_processor_unsubscribe_buffer(TaskHandle_t task)
+{
+    if (!task) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    portENTER_CRITICAL(&s_capture_lock);
+    if (s_capture_consumer == task) {
+        s_capture_consumer = NULL;
+        s_capture_waiter = NULL;
+    }
+    portEXIT_CRITICAL(&s_capture_lock);
+    return ESP_OK;
+}
+
 esp_err_t audio_processor_get_buffer(uint8_t **buffer, size_t *length)
 {
     if (!buffer || !length) {
         return ESP_ERR_INVALID_ARG;
     }
+    *buffer = NULL;
+    *length = 0;
     
-    // Get data from ring buffer
-    size_t item_size;
-    uint8_t *item = (uint8_t *)xRingbufferReceive(s_ringbuf_handle, &item_size, 0);
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    if (s_capture_consumer != self) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // A previous consumer has not released its frame yet; the ring slot is still its
+    TaskHandle_t borrower = s_capture_borrower;
+    if (borrower && borrower != self) {
+        return ESP_ERR_NOT_FOUND;
+    }
     
-    if (item) {
-        *buffer = item;
-        *length = item_size;
+    // Borrow the oldest DMA frame that the DMA has not come back around to yet
+    audio_frame_span_t span;
+    while (audio_frame_ring_peek(s_capture_ring, 1, &span) == 1) {
+        i2s_dma_frame_t frame;
+        memcpy(&frame, span.data, sizeof(frame));
+        if (!i2s_dma_capture_release(s_dma_capture, &frame)) {
+            audio_frame_ring_release(s_capture_ring, 1);
+            continue;
+        }
+        s_capture_borrowed = frame;
+        s_capture_borrower = self;
+        *buffer = (uint8_t *)frame.samples;
+        *length = frame.sample_count * sizeof(int16_t);
         return ESP_OK;
-    } else {
+    }
+    
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t audio_processor_wait_buffer(uint8_t **buffer, size_t *length, uint32_t timeout_ms)
+{
+    if (!buffer || !length) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_capture_consumer != xTaskGetCurrentTaskHandle()) {
         *buffer = NULL;
         *length = 0;
-        return ESP_ERR_NOT_FOUND;
+        return ESP_ERR_INVALID_STATE;
     }
+    
+    s_capture_waiter = xTaskGetCurrentTaskHandle();
+    
+    esp_err_t ret = audio_processor_get_buffer(buffer, length);
+    if (ret == ESP_ERR_NOT_FOUND) {
+        // The capture task notifies after every frame it publishes
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms)) == 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+        ret = audio_processor_get_buffer(buffer, length);
+    }
+    return ret == ESP_ERR_NOT_FOUND ? ESP_ERR_TIMEOUT : ret;
 }
 
 esp_err_t audio_processor_release_buffer(void)
 {
-    // This would be called after processing the buffer
-    // Implementation depends on ring buffer usage
+    // Hand the frame returned by audio_processor_get_buffer() back to the DMA.
+    // Still allowed after unsubscribing, so a consumer can finish its last frame.
+    if (s_capture_borrower == xTaskGetCurrentTaskHandle()) {
+        audio_frame_ring_release(s_capture_ring, 1);
+        if (!i2s_dma_capture_release(s_dma_capture, &s_capture_borrowed)) {
+            ESP_LOGD(TAG, "Consumer held frame %lu past the DMA window", s_capture_borrowed.seq);
+        }
+        s_capture_borrower = NULL;
+    }
     return ESP_OK;
 }
 
@@ -511,7 +637,8 @@ esp_err_t audio_processor_switch_protocol(bool use_websocket)
     return ESP_OK;
 }
 
-esp_err_t audio_processor_get_stats(uint32_t *frames_processed, float *avg_latency_ms, uint8_t *protocol_active)
+esp_err_t audio_processor_get_stats(uint32_t *frames_processed, float *avg_latency_ms, uint8_t *protocol_active,
+                                    tts_plc_stats_t *plc_stats)
 {
     if (!frames_processed || !avg_latency_ms || !protocol_active) {
         return ESP_ERR_INVALID_ARG;
@@ -526,6 +653,10 @@ esp_err_t audio_processor_get_stats(uint32_t *frames_processed, float *avg_laten
     }
     
     *protocol_active = s_websocket_active ? 1 : 0;
+
+    if (plc_stats && !tts_jb_get_plc_stats(s_tts_jb, plc_stats)) {
+        memset(plc_stats, 0, sizeof(*plc_stats));
+    }
     
     return ESP_OK;
 }
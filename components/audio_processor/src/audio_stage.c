@@ -0,0 +1,207 @@
+#include "audio_stage.h"
+#include "howdy_mem_placement.h"
+#include "howdy_trace.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "AudioStage";
+
+#define AUDIO_STAGE_POLL_MS     100
+
+// Queue slots carry the enqueue time ahead of the payload
+typedef struct {
+    int64_t enqueue_us;
+} stage_slot_header_t;
+
+typedef struct audio_stage_t {
+    audio_stage_config_t config;
+    char name[AUDIO_STAGE_NAME_LEN];
+    size_t slot_size;
+    QueueHandle_t queue;
+    TaskHandle_t task;
+    SemaphoreHandle_t done;
+    uint8_t trace_track;
+    volatile bool running;
+    portMUX_TYPE stats_lock;
+    audio_stage_stats_t stats;
+} audio_stage_t;
+
+static void audio_stage_task(void *pvParameters)
+{
+    audio_stage_t *stage = (audio_stage_t *)pvParameters;
+    uint8_t slot[stage->slot_size];
+    void *item = slot + sizeof(stage_slot_header_t);
+
+    ESP_LOGI(TAG, "Stage '%s' started (depth %lu, deadline %lu us)",
+             stage->name, stage->config.queue_depth, stage->config.deadline_us);
+
+    while (stage->running) {
+        if (xQueueReceive(stage->queue, slot, pdMS_TO_TICKS(AUDIO_STAGE_POLL_MS)) != pdTRUE) {
+            continue;
+        }
+
+        int64_t start_us = esp_timer_get_time();
+        stage->config.process(item, stage->config.ctx);
+        int64_t end_us = esp_timer_get_time();
+
+        int64_t enqueue_us = ((stage_slot_header_t *)slot)->enqueue_us;
+        uint32_t latency_us = (uint32_t)(end_us - enqueue_us);
+        uint32_t process_us = (uint32_t)(end_us - start_us);
+        HOWDY_TRACE(HOWDY_TRACE_STAGE, stage->trace_track, process_us);
+        // Exponential moving average, alpha = 1/16 (only this task writes it)
+        float avg_us = stage->stats.avg_latency_us + ((float)latency_us - stage->stats.avg_latency_us) / 16.0f;
+
+        portENTER_CRITICAL(&stage->stats_lock);
+        stage->stats.processed++;
+        stage->stats.last_latency_us = latency_us;
+        if (latency_us > stage->stats.max_latency_us) {
+            stage->stats.max_latency_us = latency_us;
+        }
+        if (process_us > stage->stats.max_process_us) {
+            stage->stats.max_process_us = process_us;
+        }
+        stage->stats.avg_latency_us = avg_us;
+        if (stage->config.deadline_us && latency_us > stage->config.deadline_us) {
+            stage->stats.deadline_misses++;
+        }
+        portEXIT_CRITICAL(&stage->stats_lock);
+    }
+
+    ESP_LOGI(TAG, "Stage '%s' stopped", stage->name);
+    xSemaphoreGive(stage->done);
+    vTaskDelete(NULL);
+}
+
+esp_err_t audio_stage_create(const audio_stage_config_t *config, audio_stage_handle_t *out_stage)
+{
+    if (!config || !out_stage || !config->process || config->item_size == 0 || config->queue_depth == 0) {
+        ESP_LOGE(TAG, "Invalid stage configuration");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    audio_stage_t *stage = (audio_stage_t *)howdy_mem_calloc(HOWDY_MEM_HOT, 1, sizeof(audio_stage_t));
+    if (!stage) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    stage->config = *config;
+    strncpy(stage->name, config->name ? config->name : "stage", sizeof(stage->name) - 1);
+    stage->config.name = stage->name;
+    strncpy(stage->stats.name, stage->name, sizeof(stage->stats.name) - 1);
+    stage->slot_size = sizeof(stage_slot_header_t) + config->item_size;
+    stage->stats_lock = (portMUX_TYPE)portMUX_INITIALIZER_UNLOCKED;
+    stage->trace_track = howdy_trace_track(stage->name);
+
+    stage->queue = xQueueCreate(config->queue_depth, stage->slot_size);
+    stage->done = xSemaphoreCreateBinary();
+    if (!stage->queue || !stage->done) {
+        ESP_LOGE(TAG, "Failed to allocate stage '%s'", stage->name);
+        if (stage->queue) vQueueDelete(stage->queue);
+        if (stage->done) vSemaphoreDelete(stage->done);
+        howdy_mem_free(stage);
+        return ESP_ERR_NO_MEM;
+    }
+
+    stage->running = true;
+    BaseType_t ret = xTaskCreatePinnedToCore(audio_stage_task, stage->name,
+                                             config->stack_size ? config->stack_size : 4096,
+                                             stage, config->priority, &stage->task,
+                                             config->core_id);
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create task for stage '%s'", stage->name);
+        vQueueDelete(stage->queue);
+        vSemaphoreDelete(stage->done);
+        howdy_mem_free(stage);
+        return ESP_FAIL;
+    }
+
+    *out_stage = stage;
+    return ESP_OK;
+}
+
+esp_err_t audio_stage_destroy(audio_stage_handle_t stage)
+{
+    if (!stage) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    stage->running = false;
+    xSemaphoreTake(stage->done, portMAX_DELAY);
+
+    vQueueDelete(stage->queue);
+    vSemaphoreDelete(stage->done);
+    howdy_mem_free(stage);
+    return ESP_OK;
+}
+
+esp_err_t audio_stage_push(audio_stage_handle_t stage, const void *item)
+{
+    if (!stage || !item) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t slot[stage->slot_size];
+    ((stage_slot_header_t *)slot)->enqueue_us = esp_timer_get_time();
+    memcpy(slot + sizeof(stage_slot_header_t), item, stage->config.item_size);
+
+    if (stage->config.policy == AUDIO_STAGE_POLICY_DROP_OLDEST) {
+        while (xQueueSend(stage->queue, slot, 0) != pdTRUE) {
+            // Make room by discarding the oldest item; the stage may race us to it
+            uint8_t discard[stage->slot_size];
+            if (xQueueReceive(stage->queue, discard, 0) == pdTRUE) {
+                portENTER_CRITICAL(&stage->stats_lock);
+                stage->stats.dropped++;
+                portEXIT_CRITICAL(&stage->stats_lock);
+            }
+        }
+    } else {
+        TickType_t wait = stage->config.max_block_ms ? pdMS_TO_TICKS(stage->config.max_block_ms)
+                                                     : portMAX_DELAY;
+        if (xQueueSend(stage->queue, slot, wait) != pdTRUE) {
+            portENTER_CRITICAL(&stage->stats_lock);
+            stage->stats.overflows++;
+            portEXIT_CRITICAL(&stage->stats_lock);
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+
+    uint32_t depth = (uint32_t)uxQueueMessagesWaiting(stage->queue);
+    HOWDY_TRACE(HOWDY_TRACE_QUEUE_DEPTH, stage->trace_track, depth);
+    portENTER_CRITICAL(&stage->stats_lock);
+    stage->stats.pushed++;
+    if (depth > stage->stats.queue_high_water) {
+        stage->stats.queue_high_water = depth;
+    }
+    portEXIT_CRITICAL(&stage->stats_lock);
+    return ESP_OK;
+}
+
+esp_err_t audio_stage_get_stats(audio_stage_handle_t stage, audio_stage_stats_t *stats)
+{
+    if (!stage || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&stage->stats_lock);
+    *stats = stage->stats;
+    portEXIT_CRITICAL(&stage->stats_lock);
+    return ESP_OK;
+}
+
+esp_err_t audio_stage_reset_stats(audio_stage_handle_t stage)
+{
+    if (!stage) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&stage->stats_lock);
+    memset(&stage->stats, 0, sizeof(stage->stats));
+    strncpy(stage->stats.name, stage->name, sizeof(stage->stats.name) - 1);
+    portEXIT_CRITICAL(&stage->stats_lock);
+    return ESP_OK;
+}
@@ -6,6 +6,7 @@
 #include "udp_audio_streamer.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
+#include "howdy_mem_placement.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -67,8 +68,7 @@ continuous_audio_handle_t continuous_audio_init(const continuous_audio_config_t
         return NULL;
     }
     
-    struct continuous_audio_processor *handle = heap_caps_malloc(sizeof(struct continuous_audio_processor), 
-                                                                MALLOC_CAP_DEFAULT);
+    struct continuous_audio_processor *handle = howdy_mem_alloc(HOWDY_MEM_HOT, sizeof(struct continuous_audio_processor));
     if (!handle) {
         ESP_LOGE(TAG, "Failed to allocate continuous audio processor");
         return NULL;
@@ -85,7 +85,7 @@ continuous_audio_handle_t continuous_audio_init(const continuous_audio_config_t
     handle->state_mutex = xSemaphoreCreateMutex();
     if (!handle->state_mutex) {
         ESP_LOGE(TAG, "Failed to create state mutex");
-        heap_caps_free(handle);
+        howdy_mem_free(handle);
         return NULL;
     }
     
@@ -94,7 +94,7 @@ continuous_audio_handle_t continuous_audio_init(const continuous_audio_config_t
     if (!handle->vad_handle) {
         ESP_LOGE(TAG, "Failed to initialize VAD");
         vSemaphoreDelete(handle->state_mutex);
-        heap_caps_free(handle);
+        howdy_mem_free(handle);
         return NULL;
     }
     
@@ -103,7 +103,7 @@ continuous_audio_handle_t continuous_audio_init(const continuous_audio_config_t
         ESP_LOGE(TAG, "Failed to initialize audio buffer");
         vad_deinit(handle->vad_handle);
         vSemaphoreDelete(handle->state_mutex);
-        heap_caps_free(handle);
+        howdy_mem_free(handle);
         return NULL;
     }
     
@@ -114,7 +114,7 @@ continuous_audio_handle_t continuous_audio_init(const continuous_audio_config_t
         audio_memory_buffer_deinit(&handle->audio_buffer);
         vad_deinit(handle->vad_handle);
         vSemaphoreDelete(handle->state_mutex);
-        heap_caps_free(handle);
+        howdy_mem_free(handle);
         return NULL;
     }
     
@@ -149,7 +149,7 @@ esp_err_t continuous_audio_deinit(continuous_audio_handle_t handle)
     ESP_LOGI(TAG, "Continuous audio processor deinitialized - processed %lu frames, %lu wake events",
              handle->frames_processed, handle->wake_events);
     
-    heap_caps_free(handle);
+    howdy_mem_free(handle);
     return ESP_OK;
 }
 
@@ -8,7 +8,8 @@ static const char *TAG = "DualI2S";
 
 // MINIMAL, CRASH-SAFE IMPLEMENTATION
 // This implementation prioritizes STABILITY over functionality
-// No heap allocations, no I2S channel creation, no complex initialization
+// No I2S channel creation, no complex initialization; the only heap use is
+// the fake DMA source's small buffer pool for event-driven mic frames
 
 // Simple state structure - stack allocated only
 static struct {
@@ -22,6 +23,7 @@ static struct {
     uint32_t speaker_samples_written;
     uint32_t mic_errors;
     uint32_t speaker_errors;
+    i2s_dma_capture_handle_t mic_capture;   // Fake DMA source standing in for the RX channel
 } s_dual_i2s = {
     .current_mode = DUAL_I2S_MODE_MIC,
     .is_initialized = false,
@@ -36,6 +38,15 @@ static struct {
 
 // MINIMAL IMPLEMENTATION - No codec management, no complex state machines
 
+// Same synthetic pattern as dual_i2s_read_mic(), delivered through the DMA capture path
+static void synthetic_mic_fill(int16_t *samples, size_t count, uint32_t seq, void *ctx)
+{
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = (int16_t)((i % 32) - 16);
+    }
+    s_dual_i2s.mic_samples_read += count;
+}
+
 // MINIMAL SAFE IMPLEMENTATION - All functions are stubs that return success
 // This avoids any memory allocation or hardware initialization that causes crashes
 
@@ -113,6 +124,22 @@ esp_err_t dual_i2s_init(const dual_i2s_config_t *config)
     
     // Copy configuration (safe stack operation)
     s_dual_i2s.config = *config;
+    
+    // Event-driven mic frames (20 ms) from a timer-paced fake DMA source;
+    // swap the source for I2S_DMA_SOURCE_I2S once the RX channel is real
+    i2s_dma_capture_config_t capture_cfg = {
+        .source = I2S_DMA_SOURCE_FAKE,
+        .dma_desc_num = config->dma_buf_count < 3 ? 3 : config->dma_buf_count,
+        .sample_rate = config->mic_config.sample_rate,
+        .frame_samples = config->mic_config.sample_rate / 50,
+        .fake_fill = synthetic_mic_fill,
+    };
+    esp_err_t ret = i2s_dma_capture_create(&capture_cfg, &s_dual_i2s.mic_capture);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Mic DMA capture unavailable: %s", esp_err_to_name(ret));
+        s_dual_i2s.mic_capture = NULL;
+    }
+    
     s_dual_i2s.is_initialized = true;
     
     ESP_LOGI(TAG, "✅ [MINIMAL] Pure I2S Driver system initialized successfully (crash-safe mode)!");
@@ -131,6 +158,11 @@ esp_err_t dual_i2s_deinit(void)
     
     s_dual_i2s.is_initialized = false;
     
+    if (s_dual_i2s.mic_capture) {
+        i2s_dma_capture_destroy(s_dual_i2s.mic_capture);
+        s_dual_i2s.mic_capture = NULL;
+    }
+    
     ESP_LOGI(TAG, "✅ [MINIMAL] Dual I2S system deinitialized (crash-safe mode)");
     ESP_LOGI(TAG, "✅ [MINIMAL] Statistics - Mic samples: %lu, Speaker samples: %lu, Errors: %lu/%lu",
              s_dual_i2s.mic_samples_read, s_dual_i2s.speaker_samples_written,
@@ -258,6 +290,10 @@ esp_err_t dual_i2s_start(void)
         dual_i2s_set_mode(DUAL_I2S_MODE_MIC);
     }
     
+    if (s_dual_i2s.mic_active && s_dual_i2s.mic_capture) {
+        i2s_dma_capture_start(s_dual_i2s.mic_capture);
+    }
+    
     ESP_LOGI(TAG, "✅ [MINIMAL] dual_i2s_start() completed - Mode: %d, Mic: %s, Speaker: %s (crash-safe mode)",
              s_dual_i2s.current_mode,
              s_dual_i2s.mic_active ? "ACTIVE" : "INACTIVE",
@@ -268,6 +304,9 @@ esp_err_t dual_i2s_start(void)
 
 esp_err_t dual_i2s_stop(void)
 {
+    if (s_dual_i2s.mic_capture) {
+        i2s_dma_capture_stop(s_dual_i2s.mic_capture);
+    }
     ESP_LOGI(TAG, "✅ [MINIMAL] dual_i2s_stop() completed (crash-safe mode)");
     return ESP_OK;
 }
@@ -278,6 +317,11 @@ esp_err_t dual_i2s_clear_dma_buffers(bool clear_mic, bool clear_speaker)
     return ESP_OK;
 }
 
+i2s_dma_capture_handle_t dual_i2s_get_mic_capture(void)
+{
+    return s_dual_i2s.is_initialized ? s_dual_i2s.mic_capture : NULL;
+}
+
 dual_i2s_mode_t dual_i2s_get_mode(void)
 {
     return s_dual_i2s.current_mode;
@@ -334,6 +334,21 @@ esp_err_t enhanced_udp_audio_send_enhanced_packet(const enhanced_udp_audio_heade
         return ESP_ERR_INVALID_ARG;
     }
     
+    if (udp_audio_is_rtp_enabled()) {
+        // VAD fields travel as an RTP header extension
+        rtp_vad_ext_t vad_ext = {
+            .vad_flags = header->vad_flags,
+            .vad_confidence = header->vad_confidence,
+            .detection_quality = header->detection_quality,
+            .snr_db_scaled = header->snr_db_scaled,
+            .max_amplitude = header->max_amplitude,
+            .noise_floor = header->noise_floor,
+            .zero_crossing_rate = header->zero_crossing_rate
+        };
+        return udp_audio_send_rtp((const int16_t *)audio_data, audio_size / sizeof(int16_t),
+                                  &vad_ext, NULL);
+    }
+    
     // For now, send the enhanced header followed by audio data
     // In a complete implementation, this would use the actual UDP socket
     // Here we convert to basic header for compatibility with existing UDP streamer
@@ -562,6 +577,33 @@ esp_err_t enhanced_udp_audio_send_wake_word_packet(const enhanced_udp_wake_word_
         return ESP_ERR_INVALID_ARG;
     }
     
+    if (udp_audio_is_rtp_enabled()) {
+        rtp_vad_ext_t vad_ext = {
+            .vad_flags = header->vad_flags,
+            .vad_confidence = header->vad_confidence,
+            .detection_quality = header->detection_quality,
+            .snr_db_scaled = header->snr_db_scaled,
+            .max_amplitude = header->max_amplitude,
+            .noise_floor = header->noise_floor,
+            .zero_crossing_rate = header->zero_crossing_rate
+        };
+        rtp_wake_word_ext_t ww_ext = {
+            .detection_id = header->wake_word_detection_id,
+            .flags = header->wake_word_flags,
+            .confidence = header->wake_word_confidence,
+            .pattern_match_score = header->pattern_match_score,
+            .syllable_count = header->syllable_count,
+            .detection_duration_ms = header->detection_duration_ms
+        };
+        esp_err_t ret = udp_audio_send_rtp((const int16_t *)audio_data, audio_size / sizeof(int16_t),
+                                           &vad_ext, &ww_ext);
+        if (ret == ESP_OK) {
+            ESP_LOGI(TAG, "🎯 Sent wake word RTP packet ww_id=%lu, confidence=%d",
+                    header->wake_word_detection_id, header->wake_word_confidence);
+        }
+        return ret;
+    }
+    
     // For now, convert to basic header for compatibility with existing UDP streamer
     // In a complete implementation, this would send the full wake word header
     
@@ -1,6 +1,7 @@
 #include "enhanced_vad.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
+#include "howdy_mem_placement.h"
 #include "esp_timer.h"
 #include <string.h>
 #include <math.h>
@@ -99,7 +100,7 @@ enhanced_vad_handle_t enhanced_vad_init(const enhanced_vad_config_t *config)
         return NULL;
     }
     
-    struct enhanced_vad_instance *vad = heap_caps_malloc(sizeof(struct enhanced_vad_instance), MALLOC_CAP_DEFAULT);
+    struct enhanced_vad_instance *vad = howdy_mem_alloc(HOWDY_MEM_HOT, sizeof(struct enhanced_vad_instance));
     if (!vad) {
         ESP_LOGE(TAG, "Failed to allocate enhanced VAD instance");
         return NULL;
@@ -124,8 +125,8 @@ enhanced_vad_handle_t enhanced_vad_init(const enhanced_vad_config_t *config)
         vad->fft_size = 512;  // 32ms at 16kHz
         
         // Allocate FFT buffers
-        vad->fft_buffer = heap_caps_malloc(vad->fft_size * sizeof(float), MALLOC_CAP_DEFAULT);
-        vad->window = heap_caps_malloc(vad->fft_size * sizeof(float), MALLOC_CAP_DEFAULT);
+        vad->fft_buffer = howdy_mem_alloc(HOWDY_MEM_HOT, vad->fft_size * sizeof(float));
+        vad->window = howdy_mem_alloc(HOWDY_MEM_HOT, vad->fft_size * sizeof(float));
         
         if (!vad->fft_buffer || !vad->window) {
             ESP_LOGE(TAG, "Failed to allocate spectral analysis buffers");
@@ -141,8 +142,8 @@ enhanced_vad_handle_t enhanced_vad_init(const enhanced_vad_config_t *config)
     
     // Initialize consistency checking if enabled
     if (config->feature_flags & ENHANCED_VAD_ENABLE_CONSISTENCY_CHECK) {
-        vad->frame_decisions = heap_caps_malloc(config->consistency_frames * sizeof(bool), MALLOC_CAP_DEFAULT);
-        vad->frame_confidences = heap_caps_malloc(config->consistency_frames * sizeof(float), MALLOC_CAP_DEFAULT);
+        vad->frame_decisions = howdy_mem_alloc(HOWDY_MEM_HOT, config->consistency_frames * sizeof(bool));
+        vad->frame_confidences = howdy_mem_alloc(HOWDY_MEM_HOT, config->consistency_frames * sizeof(float));
         
         if (!vad->frame_decisions || !vad->frame_confidences) {
             ESP_LOGE(TAG, "Failed to allocate consistency checking buffers");
@@ -168,24 +169,24 @@ esp_err_t enhanced_vad_deinit(enhanced_vad_handle_t handle)
     
     // Free spectral analysis buffers
     if (handle->fft_buffer) {
-        heap_caps_free(handle->fft_buffer);
+        howdy_mem_free(handle->fft_buffer);
     }
     if (handle->window) {
-        heap_caps_free(handle->window);
+        howdy_mem_free(handle->window);
     }
     
     // Free consistency checking buffers
     if (handle->frame_decisions) {
-        heap_caps_free(handle->frame_decisions);
+        howdy_mem_free(handle->frame_decisions);
     }
     if (handle->frame_confidences) {
-        heap_caps_free(handle->frame_confidences);
+        howdy_mem_free(handle->frame_confidences);
     }
     
     ESP_LOGI(TAG, "Enhanced VAD deinitialized - detections: %lu, avg confidence: %.2f", 
              handle->stats.detection_count, handle->stats.average_confidence);
     
-    heap_caps_free(handle);
+    howdy_mem_free(handle);
     return ESP_OK;
 }
 
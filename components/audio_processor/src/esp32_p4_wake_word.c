@@ -1,4 +1,5 @@
 #include "esp32_p4_wake_word.h"
+#include "howdy_mem_placement.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
@@ -91,7 +92,7 @@ esp32_p4_wake_word_handle_t esp32_p4_wake_word_init(const esp32_p4_wake_word_con
         return NULL;
     }
     
-    esp32_p4_wake_word_detector_t *detector = malloc(sizeof(esp32_p4_wake_word_detector_t));
+    esp32_p4_wake_word_detector_t *detector = howdy_mem_alloc(HOWDY_MEM_HOT, sizeof(esp32_p4_wake_word_detector_t));
     if (!detector) {
         ESP_LOGE(TAG, "Failed to allocate memory for detector");
         return NULL;
@@ -116,7 +117,7 @@ esp32_p4_wake_word_handle_t esp32_p4_wake_word_init(const esp32_p4_wake_word_con
     detector->mutex = xSemaphoreCreateMutex();
     if (!detector->mutex) {
         ESP_LOGE(TAG, "Failed to create mutex");
-        free(detector);
+        howdy_mem_free(detector);
         return NULL;
     }
     
@@ -145,7 +146,7 @@ esp_err_t esp32_p4_wake_word_deinit(esp32_p4_wake_word_handle_t handle)
         vSemaphoreDelete(detector->mutex);
     }
     
-    free(detector);
+    howdy_mem_free(detector);
     
     ESP_LOGI(TAG, "ESP32-P4 Wake Word Detection deinitialized");
     return ESP_OK;
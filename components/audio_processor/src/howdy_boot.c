@@ -0,0 +1,354 @@
+#include "howdy_boot.h"
+#include "howdy_trace.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+static const char *TAG = "Boot";
+
+#ifndef CONFIG_HOWDY_BOOT_PARALLEL
+#define CONFIG_HOWDY_BOOT_PARALLEL 0
+#endif
+
+typedef struct {
+    howdy_boot_fn_t fn;
+    void *arg;
+    uint32_t deps;                      // One bit per stage index
+    int core;
+    uint32_t stack_size;
+    uint8_t index;
+} boot_node_t;
+
+static struct {
+    portMUX_TYPE lock;
+    bool started;
+    uint8_t trace_track;
+    EventGroupHandle_t done;            // Bit per stage, set by its task
+    boot_node_t nodes[HOWDY_BOOT_MAX_STAGES];
+    howdy_boot_stage_stats_t stages[HOWDY_BOOT_MAX_STAGES];
+    howdy_boot_summary_t summary;
+} s_boot = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static inline uint32_t boot_now_us(void)
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+static int boot_find(const howdy_boot_stage_t *stages, size_t count, const char *name)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(stages[i].name, name) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+// Resolve names to bit masks and reject duplicates, unknown names and cycles
+static esp_err_t boot_build_graph(const howdy_boot_stage_t *stages, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        const howdy_boot_stage_t *stage = &stages[i];
+        if (!stage->name || boot_find(stages, count, stage->name) != (int)i) {
+            ESP_LOGE(TAG, "Stage %u: missing or duplicate name", (unsigned)i);
+            return ESP_ERR_INVALID_ARG;
+        }
+        boot_node_t *node = &s_boot.nodes[i];
+        node->fn = stage->fn;
+        node->arg = stage->arg;
+        node->core = stage->core;
+        node->stack_size = stage->stack_size ? stage->stack_size : HOWDY_BOOT_DEFAULT_STACK;
+        node->index = i;
+        node->deps = 0;
+        for (int d = 0; d < HOWDY_BOOT_MAX_DEPS && stage->deps[d]; d++) {
+            int dep = boot_find(stages, count, stage->deps[d]);
+            if (dep < 0 || dep == (int)i) {
+                ESP_LOGE(TAG, "%s: bad dependency '%s'", stage->name, stage->deps[d]);
+                return ESP_ERR_INVALID_ARG;
+            }
+            node->deps |= 1u << dep;
+        }
+
+        howdy_boot_stage_stats_t *st = &s_boot.stages[i];
+        memset(st, 0, sizeof(*st));
+        strncpy(st->name, stage->name, sizeof(st->name) - 1);
+        st->status = HOWDY_BOOT_PENDING;
+        st->milestone = stage->fn == NULL;
+        st->core = -1;
+    }
+
+    // Peel off stages whose dependencies are all resolved; leftovers form a cycle
+    const uint32_t all = (1u << count) - 1;
+    uint32_t resolved = 0;
+    bool progress = true;
+    while (resolved != all && progress) {
+        progress = false;
+        for (size_t i = 0; i < count; i++) {
+            if (!(resolved & (1u << i)) && !(s_boot.nodes[i].deps & ~resolved)) {
+                resolved |= 1u << i;
+                progress = true;
+            }
+        }
+    }
+    if (resolved != all) {
+        ESP_LOGE(TAG, "Dependency cycle among stages 0x%lx", (unsigned long)(all & ~resolved));
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+// Run a stage in the calling task and record it
+static void boot_execute(boot_node_t *node)
+{
+    howdy_boot_stage_stats_t *st = &s_boot.stages[node->index];
+    uint32_t start = boot_now_us();
+    portENTER_CRITICAL(&s_boot.lock);
+    st->core = (int8_t)xPortGetCoreID();
+    st->start_us = start;
+    portEXIT_CRITICAL(&s_boot.lock);
+
+    esp_err_t err = node->fn(node->arg);
+
+    uint32_t end = boot_now_us();
+    HOWDY_TRACE(HOWDY_TRACE_STAGE, s_boot.trace_track, end - start);
+    portENTER_CRITICAL(&s_boot.lock);
+    st->err = err;
+    st->status = err == ESP_OK ? HOWDY_BOOT_DONE : HOWDY_BOOT_FAILED;
+    st->end_us = end;
+    portEXIT_CRITICAL(&s_boot.lock);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s failed: %s", st->name, esp_err_to_name(err));
+    }
+}
+
+#if CONFIG_HOWDY_BOOT_PARALLEL
+static void boot_stage_task(void *arg)
+{
+    boot_node_t *node = arg;
+    boot_execute(node);
+    xEventGroupSetBits(s_boot.done, 1u << node->index);
+    vTaskDelete(NULL);
+}
+#endif
+
+// Mark a stage whose dependencies just finished: skip it, complete it as a
+// milestone, or start it. Returns true if it finished on the spot.
+static bool boot_start_stage(boot_node_t *node, uint32_t failed)
+{
+    howdy_boot_stage_stats_t *st = &s_boot.stages[node->index];
+    uint32_t now = boot_now_us();
+
+    portENTER_CRITICAL(&s_boot.lock);
+    st->ready_us = now;
+    if (node->deps & failed) {
+        st->status = HOWDY_BOOT_SKIPPED;
+        st->end_us = now;
+    } else if (!node->fn) {
+        st->status = HOWDY_BOOT_DONE;
+        st->start_us = now;
+        st->end_us = now;
+    } else {
+        st->status = HOWDY_BOOT_RUNNING;
+    }
+    howdy_boot_status_t status = st->status;
+    portEXIT_CRITICAL(&s_boot.lock);
+
+    if (status == HOWDY_BOOT_SKIPPED) {
+        ESP_LOGW(TAG, "%s skipped: a dependency failed", st->name);
+        return true;
+    }
+    if (status == HOWDY_BOOT_DONE) {
+        ESP_LOGI(TAG, "Milestone %s at %lu ms after reset", st->name, (unsigned long)(now / 1000));
+        return true;
+    }
+
+#if CONFIG_HOWDY_BOOT_PARALLEL
+    if (xTaskCreatePinnedToCore(boot_stage_task, st->name, node->stack_size, node,
+                                uxTaskPriorityGet(NULL), NULL,
+                                node->core < 0 ? tskNO_AFFINITY : node->core) == pdPASS) {
+        return false;
+    }
+    ESP_LOGW(TAG, "No memory for a %s task, running it inline", st->name);
+#endif
+    boot_execute(node);
+    return true;
+}
+
+static void boot_log_report(void)
+{
+    const howdy_boot_summary_t *sum = &s_boot.summary;
+    ESP_LOGI(TAG, "Boot graph: %u stages in %lu ms (%lu ms of work, %s), %lu failed or skipped",
+             (unsigned)sum->stage_count, (unsigned long)((sum->end_us - sum->start_us) / 1000),
+             (unsigned long)(sum->serial_us / 1000), sum->parallel ? "parallel" : "serial",
+             (unsigned long)sum->failed);
+    for (size_t i = 0; i < sum->stage_count; i++) {
+        const howdy_boot_stage_stats_t *st = &s_boot.stages[i];
+        if (st->status == HOWDY_BOOT_SKIPPED) {
+            ESP_LOGI(TAG, "  %-16s skipped", st->name);
+        } else if (st->milestone) {
+            ESP_LOGI(TAG, "  %-16s          at %7.1f ms  %s", st->name,
+                     st->end_us / 1000.0f, howdy_boot_status_name(st->status));
+        } else {
+            ESP_LOGI(TAG, "  %-16s core %2d  %7.1f - %7.1f ms (waited %6.1f)  %s", st->name, st->core,
+                     st->start_us / 1000.0f, st->end_us / 1000.0f,
+                     st->start_us > st->ready_us ? (st->start_us - st->ready_us) / 1000.0f : 0.0f,
+                     howdy_boot_status_name(st->status));
+        }
+    }
+}
+
+esp_err_t howdy_boot_run(const howdy_boot_stage_t *stages, size_t count)
+{
+    if (!stages || count == 0 || count > HOWDY_BOOT_MAX_STAGES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_boot.started) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t ret = boot_build_graph(stages, count);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+#if CONFIG_HOWDY_BOOT_PARALLEL
+    s_boot.done = xEventGroupCreate();
+    if (!s_boot.done) {
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+    s_boot.trace_track = howdy_trace_track("boot");
+
+    portENTER_CRITICAL(&s_boot.lock);
+    s_boot.started = true;
+    s_boot.summary.parallel = CONFIG_HOWDY_BOOT_PARALLEL;
+    s_boot.summary.stage_count = count;
+    s_boot.summary.start_us = boot_now_us();
+    portEXIT_CRITICAL(&s_boot.lock);
+
+    const uint32_t all = (1u << count) - 1;
+    uint32_t finished = 0;
+    uint32_t failed = 0;
+    uint32_t running = 0;
+
+    while (finished != all) {
+        // Start everything that is ready; rescan while stages finish on the spot
+        bool rescan = true;
+        while (rescan) {
+            rescan = false;
+            for (size_t i = 0; i < count; i++) {
+                uint32_t bit = 1u << i;
+                if (((finished | running) & bit) || (s_boot.nodes[i].deps & ~finished)) {
+                    continue;
+                }
+                if (!boot_start_stage(&s_boot.nodes[i], failed)) {
+                    running |= bit;
+                    continue;
+                }
+                finished |= bit;
+                if (s_boot.stages[i].status != HOWDY_BOOT_DONE) {
+                    failed |= bit;
+                }
+                rescan = true;
+            }
+        }
+        if (!running) {
+            break;                      // Everything left is finished
+        }
+
+#if CONFIG_HOWDY_BOOT_PARALLEL
+        uint32_t bits = xEventGroupWaitBits(s_boot.done, running, pdTRUE, pdFALSE, portMAX_DELAY) & running;
+        running &= ~bits;
+        finished |= bits;
+        for (size_t i = 0; i < count; i++) {
+            if ((bits & (1u << i)) && s_boot.stages[i].status == HOWDY_BOOT_FAILED) {
+                failed |= 1u << i;
+            }
+        }
+#endif
+    }
+
+    uint32_t serial_us = 0;
+    ret = ESP_OK;
+    for (size_t i = 0; i < count; i++) {
+        const howdy_boot_stage_stats_t *st = &s_boot.stages[i];
+        if (!st->milestone && st->status != HOWDY_BOOT_SKIPPED) {
+            serial_us += st->end_us - st->start_us;
+        }
+        if (st->status == HOWDY_BOOT_FAILED && ret == ESP_OK) {
+            ret = st->err;
+        }
+    }
+
+    portENTER_CRITICAL(&s_boot.lock);
+    s_boot.summary.end_us = boot_now_us();
+    s_boot.summary.serial_us = serial_us;
+    s_boot.summary.failed = __builtin_popcount(failed);
+    portEXIT_CRITICAL(&s_boot.lock);
+
+#if CONFIG_HOWDY_BOOT_PARALLEL
+    vEventGroupDelete(s_boot.done);
+    s_boot.done = NULL;
+#endif
+    boot_log_report();
+    return ret;
+}
+
+esp_err_t howdy_boot_get_stage(const char *name, howdy_boot_stage_stats_t *stats)
+{
+    if (!name || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    portENTER_CRITICAL(&s_boot.lock);
+    for (size_t i = 0; i < s_boot.summary.stage_count; i++) {
+        if (strcmp(s_boot.stages[i].name, name) == 0) {
+            *stats = s_boot.stages[i];
+            ret = ESP_OK;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&s_boot.lock);
+    return ret;
+}
+
+size_t howdy_boot_get_stages(howdy_boot_stage_stats_t *stats, size_t max)
+{
+    if (!stats) {
+        return 0;
+    }
+    portENTER_CRITICAL(&s_boot.lock);
+    size_t n = s_boot.summary.stage_count < max ? s_boot.summary.stage_count : max;
+    memcpy(stats, s_boot.stages, n * sizeof(*stats));
+    portEXIT_CRITICAL(&s_boot.lock);
+    return n;
+}
+
+void howdy_boot_get_summary(howdy_boot_summary_t *summary)
+{
+    if (!summary) {
+        return;
+    }
+    portENTER_CRITICAL(&s_boot.lock);
+    *summary = s_boot.summary;
+    portEXIT_CRITICAL(&s_boot.lock);
+}
+
+const char *howdy_boot_status_name(howdy_boot_status_t status)
+{
+    switch (status) {
+    case HOWDY_BOOT_PENDING: return "pending";
+    case HOWDY_BOOT_RUNNING: return "running";
+    case HOWDY_BOOT_DONE:    return "done";
+    case HOWDY_BOOT_FAILED:  return "failed";
+    case HOWDY_BOOT_SKIPPED: return "skipped";
+    }
+    return "?";
+}
@@ -0,0 +1,350 @@
+#include "howdy_heap_tags.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "cJSON.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+static const char *TAG = "HowdyHeap";
+
+#define HEAP_MAGIC          0x4857u     // "HW"
+#define HEAP_MAGIC_FREED    0xDEADu
+
+#ifdef CONFIG_HOWDY_HEAP_SAMPLE_EVERY
+#define HEAP_SAMPLE_DEFAULT CONFIG_HOWDY_HEAP_SAMPLE_EVERY
+#else
+#define HEAP_SAMPLE_DEFAULT 0
+#endif
+
+// Sits in front of every HOWDY_MALLOC block; 8 bytes keeps the heap's alignment
+typedef struct {
+    uint32_t size;
+    uint8_t tag;
+    uint8_t site;                       // Sampled site index + 1, 0 if not sampled
+    uint16_t magic;
+} heap_hdr_t;
+
+_Static_assert(sizeof(heap_hdr_t) == 8, "heap header must stay 8 bytes");
+
+typedef struct {
+    atomic_size_t live_bytes;
+    atomic_size_t peak_bytes;
+    atomic_uint live_blocks;
+    atomic_uint allocs;
+    atomic_uint frees;
+    atomic_uint failures;
+} tag_counters_t;
+
+static tag_counters_t s_tags[HOWDY_HEAP_TAG_COUNT];
+
+static const char *const s_tag_names[HOWDY_HEAP_TAG_COUNT] = {
+    [HOWDY_HEAP_TAG_OTHER] = "other",
+    [HOWDY_HEAP_TAG_AUDIO] = "audio",
+    [HOWDY_HEAP_TAG_TTS] = "tts",
+    [HOWDY_HEAP_TAG_NETWORK] = "network",
+    [HOWDY_HEAP_TAG_VAD_FEEDBACK] = "vad_feedback",
+    [HOWDY_HEAP_TAG_JSON] = "json",
+    [HOWDY_HEAP_TAG_UI] = "ui",
+};
+
+// Sampler; the lock is only taken for sampled blocks
+static atomic_uint s_sample_every = HEAP_SAMPLE_DEFAULT;
+static atomic_uint s_sample_tick;
+static howdy_heap_site_t s_sites[HOWDY_HEAP_SITE_COUNT];
+static uint32_t s_site_count;
+static portMUX_TYPE s_site_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Rate window, advanced only by howdy_heap_sample_rates(); readers copy s_rates under the lock
+static uint32_t s_rate_allocs[HOWDY_HEAP_TAG_COUNT];
+static int64_t s_rate_time_us;
+static float s_rates[HOWDY_HEAP_TAG_COUNT];
+static portMUX_TYPE s_rate_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static atomic_uint s_foreign_frees;
+
+static void raise_peak(tag_counters_t *c, size_t live)
+{
+    size_t peak = atomic_load_explicit(&c->peak_bytes, memory_order_relaxed);
+    while (live > peak &&
+           !atomic_compare_exchange_weak_explicit(&c->peak_bytes, &peak, live,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void account_alloc(howdy_heap_tag_t tag, size_t size)
+{
+    tag_counters_t *c = &s_tags[tag];
+    size_t live = atomic_fetch_add_explicit(&c->live_bytes, size, memory_order_relaxed) + size;
+    atomic_fetch_add_explicit(&c->live_blocks, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&c->allocs, 1, memory_order_relaxed);
+    raise_peak(c, live);
+}
+
+static void account_free(howdy_heap_tag_t tag, size_t size)
+{
+    tag_counters_t *c = &s_tags[tag];
+    atomic_fetch_sub_explicit(&c->live_bytes, size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&c->live_blocks, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&c->frees, 1, memory_order_relaxed);
+}
+
+// Returns site index + 1, or 0 when this allocation is not sampled
+static uint8_t sample_site(howdy_heap_tag_t tag, size_t size, const char *file, int line)
+{
+    uint32_t every = atomic_load_explicit(&s_sample_every, memory_order_relaxed);
+    if (every == 0 ||
+        atomic_fetch_add_explicit(&s_sample_tick, 1, memory_order_relaxed) % every != 0) {
+        return 0;
+    }
+
+    uint8_t site = 0;
+    portENTER_CRITICAL_SAFE(&s_site_lock);
+    uint32_t i;
+    for (i = 0; i < s_site_count; i++) {
+        if (s_sites[i].line == (uint32_t)line && s_sites[i].file == file) {
+            break;
+        }
+    }
+    if (i == s_site_count && s_site_count < HOWDY_HEAP_SITE_COUNT) {
+        s_sites[i] = (howdy_heap_site_t){ .file = file, .line = (uint32_t)line, .tag = tag };
+        s_site_count++;
+    }
+    if (i < s_site_count) {
+        s_sites[i].samples++;
+        s_sites[i].sampled_bytes += size;
+        s_sites[i].live_bytes += size;
+        site = (uint8_t)(i + 1);
+    }
+    portEXIT_CRITICAL_SAFE(&s_site_lock);
+    return site;
+}
+
+static void unsample_site(uint8_t site, size_t size)
+{
+    portENTER_CRITICAL_SAFE(&s_site_lock);
+    s_sites[site - 1].live_bytes -= size;
+    portEXIT_CRITICAL_SAFE(&s_site_lock);
+}
+
+static heap_hdr_t *header_of(void *ptr)
+{
+    heap_hdr_t *hdr = (heap_hdr_t *)ptr - 1;
+    if (hdr->magic != HEAP_MAGIC) {
+        // Not ours (or already freed): leaking beats corrupting the heap
+        if (atomic_fetch_add(&s_foreign_frees, 1) == 0) {
+            ESP_LOGE(TAG, "HOWDY_FREE on untracked or freed block %p (magic 0x%04x)", ptr, hdr->magic);
+        }
+        return NULL;
+    }
+    return hdr;
+}
+
+void *howdy_heap_alloc(howdy_heap_tag_t tag, size_t size, uint32_t caps, const char *file, int line)
+{
+    if (tag >= HOWDY_HEAP_TAG_COUNT) {
+        tag = HOWDY_HEAP_TAG_OTHER;
+    }
+    if (size > UINT32_MAX - sizeof(heap_hdr_t)) {
+        atomic_fetch_add_explicit(&s_tags[tag].failures, 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    heap_hdr_t *hdr = heap_caps_malloc(sizeof(heap_hdr_t) + size, caps);
+    if (!hdr) {
+        atomic_fetch_add_explicit(&s_tags[tag].failures, 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    hdr->size = (uint32_t)size;
+    hdr->tag = (uint8_t)tag;
+    hdr->site = sample_site(tag, size, file, line);
+    hdr->magic = HEAP_MAGIC;
+    account_alloc(tag, size);
+    return hdr + 1;
+}
+
+void *howdy_heap_calloc(howdy_heap_tag_t tag, size_t n, size_t size, uint32_t caps, const char *file, int line)
+{
+    if (size && n > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *ptr = howdy_heap_alloc(tag, n * size, caps, file, line);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void *howdy_heap_realloc(howdy_heap_tag_t tag, void *ptr, size_t size, uint32_t caps, const char *file, int line)
+{
+    if (!ptr) {
+        return howdy_heap_alloc(tag, size, caps, file, line);
+    }
+    if (size == 0) {
+        howdy_heap_free(ptr);
+        return NULL;
+    }
+
+    heap_hdr_t *hdr = header_of(ptr);
+    if (!hdr || size > UINT32_MAX - sizeof(heap_hdr_t)) {
+        return NULL;
+    }
+
+    howdy_heap_tag_t old_tag = (howdy_heap_tag_t)hdr->tag;
+    size_t old_size = hdr->size;
+    uint8_t site = hdr->site;
+
+    heap_hdr_t *grown = heap_caps_realloc(hdr, sizeof(heap_hdr_t) + size, caps);
+    if (!grown) {
+        atomic_fetch_add_explicit(&s_tags[old_tag].failures, 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    // The block stays charged to its original tag and sampled site
+    grown->size = (uint32_t)size;
+    tag_counters_t *c = &s_tags[old_tag];
+    if (size >= old_size) {
+        size_t live = atomic_fetch_add_explicit(&c->live_bytes, size - old_size, memory_order_relaxed) +
+                      (size - old_size);
+        raise_peak(c, live);
+    } else {
+        atomic_fetch_sub_explicit(&c->live_bytes, old_size - size, memory_order_relaxed);
+    }
+    if (site) {
+        portENTER_CRITICAL_SAFE(&s_site_lock);
+        s_sites[site - 1].live_bytes += size - old_size;
+        portEXIT_CRITICAL_SAFE(&s_site_lock);
+    }
+    (void)tag;
+    return grown + 1;
+}
+
+void howdy_heap_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+
+    heap_hdr_t *hdr = header_of(ptr);
+    if (!hdr) {
+        return;
+    }
+
+    account_free((howdy_heap_tag_t)hdr->tag, hdr->size);
+    if (hdr->site) {
+        unsample_site(hdr->site, hdr->size);
+    }
+    hdr->magic = HEAP_MAGIC_FREED;
+    heap_caps_free(hdr);
+}
+
+void howdy_heap_set_sampling(uint32_t every_n)
+{
+    atomic_store(&s_sample_every, every_n);
+    ESP_LOGI(TAG, "Allocation sampling %s (every %lu)", every_n ? "on" : "off", (unsigned long)every_n);
+}
+
+void howdy_heap_set_external(howdy_heap_tag_t tag, size_t live_bytes)
+{
+    if (tag >= HOWDY_HEAP_TAG_COUNT) {
+        return;
+    }
+    atomic_store_explicit(&s_tags[tag].live_bytes, live_bytes, memory_order_relaxed);
+    raise_peak(&s_tags[tag], live_bytes);
+}
+
+static void *cjson_malloc(size_t size)
+{
+    return howdy_heap_alloc(HOWDY_HEAP_TAG_JSON, size, MALLOC_CAP_DEFAULT, "cJSON", 0);
+}
+
+void howdy_heap_install_cjson_hooks(void)
+{
+    cJSON_Hooks hooks = {
+        .malloc_fn = cjson_malloc,
+        .free_fn = howdy_heap_free,
+    };
+    cJSON_InitHooks(&hooks);
+}
+
+void howdy_heap_sample_rates(void)
+{
+    int64_t now = esp_timer_get_time();
+    float window_s = s_rate_time_us ? (float)(now - s_rate_time_us) / 1000000.0f : 0.0f;
+    float rates[HOWDY_HEAP_TAG_COUNT];
+
+    for (int i = 0; i < HOWDY_HEAP_TAG_COUNT; i++) {
+        uint32_t allocs = atomic_load_explicit(&s_tags[i].allocs, memory_order_relaxed);
+        rates[i] = window_s > 0.0f ? (float)(allocs - s_rate_allocs[i]) / window_s : 0.0f;
+        s_rate_allocs[i] = allocs;
+    }
+    s_rate_time_us = now;
+
+    portENTER_CRITICAL(&s_rate_lock);
+    memcpy(s_rates, rates, sizeof(s_rates));
+    portEXIT_CRITICAL(&s_rate_lock);
+}
+
+esp_err_t howdy_heap_get_tag_stats(howdy_heap_tag_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    float rates[HOWDY_HEAP_TAG_COUNT];
+    portENTER_CRITICAL(&s_rate_lock);
+    memcpy(rates, s_rates, sizeof(rates));
+    portEXIT_CRITICAL(&s_rate_lock);
+
+    for (int i = 0; i < HOWDY_HEAP_TAG_COUNT; i++) {
+        tag_counters_t *c = &s_tags[i];
+        howdy_heap_tag_stats_t *st = &stats[i];
+        st->name = s_tag_names[i];
+        st->live_bytes = atomic_load_explicit(&c->live_bytes, memory_order_relaxed);
+        st->peak_bytes = atomic_load_explicit(&c->peak_bytes, memory_order_relaxed);
+        st->live_blocks = atomic_load_explicit(&c->live_blocks, memory_order_relaxed);
+        st->allocs = atomic_load_explicit(&c->allocs, memory_order_relaxed);
+        st->frees = atomic_load_explicit(&c->frees, memory_order_relaxed);
+        st->failures = atomic_load_explicit(&c->failures, memory_order_relaxed);
+        st->alloc_rate = rates[i];
+    }
+    return ESP_OK;
+}
+
+size_t howdy_heap_get_sites(howdy_heap_site_t *sites, size_t max)
+{
+    if (!sites || max == 0) {
+        return 0;
+    }
+
+    howdy_heap_site_t tmp[HOWDY_HEAP_SITE_COUNT];
+    portENTER_CRITICAL_SAFE(&s_site_lock);
+    size_t total = s_site_count;
+    memcpy(tmp, s_sites, total * sizeof(*tmp));
+    portEXIT_CRITICAL_SAFE(&s_site_lock);
+
+    // Busiest first
+    for (size_t i = 1; i < total; i++) {
+        howdy_heap_site_t site = tmp[i];
+        size_t j = i;
+        for (; j > 0 && tmp[j - 1].samples < site.samples; j--) {
+            tmp[j] = tmp[j - 1];
+        }
+        tmp[j] = site;
+    }
+
+    size_t count = total < max ? total : max;
+    memcpy(sites, tmp, count * sizeof(*sites));
+    return count;
+}
+
+const char *howdy_heap_tag_name(howdy_heap_tag_t tag)
+{
+    return tag < HOWDY_HEAP_TAG_COUNT ? s_tag_names[tag] : "unknown";
+}
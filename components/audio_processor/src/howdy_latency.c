@@ -0,0 +1,304 @@
+#include "howdy_latency.h"
+#include "howdy_trace.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+
+static const char *TAG = "Latency";
+
+// 8 sub-buckets per octave; values up to 2^27 us (~134 s) before clamping
+#define LAT_SUB_BITS        3
+#define LAT_SUB_COUNT       (1u << LAT_SUB_BITS)
+#define LAT_MAX_MSB         26
+#define LAT_BUCKETS         ((LAT_MAX_MSB - LAT_SUB_BITS + 2) * LAT_SUB_COUNT)
+
+// An utterance that hasn't produced audio within this window is dropped
+#define LAT_UTTERANCE_TIMEOUT_US    (30 * 1000 * 1000LL)
+
+// Wake timestamps echoed by the server are matched with this much slack
+// (the detector stamps the frame before the callback marks HOWDY_LAT_WAKE)
+#define LAT_ECHO_MATCH_MS           1000
+
+typedef struct {
+    atomic_uint buckets[LAT_BUCKETS];
+    atomic_uint count;
+    atomic_uint min_us;
+    atomic_uint max_us;
+} lat_hist_t;
+
+static const char *s_span_names[HOWDY_LAT_SPAN_COUNT] = {
+    [HOWDY_LAT_SPAN_CAPTURE_TO_VAD] = "capture_to_vad",
+    [HOWDY_LAT_SPAN_VAD_TO_WAKE]    = "vad_to_wake",
+    [HOWDY_LAT_SPAN_WAKE_TO_UPLINK] = "wake_to_uplink",
+    [HOWDY_LAT_SPAN_SERVER_RTT]     = "server_rtt",
+    [HOWDY_LAT_SPAN_WAKE_TO_TTS]    = "wake_to_tts",
+    [HOWDY_LAT_SPAN_TTS_TO_POP]     = "tts_to_pop",
+    [HOWDY_LAT_SPAN_POP_TO_I2S]     = "pop_to_i2s",
+    [HOWDY_LAT_SPAN_WAKE_TO_AUDIO]  = "wake_to_audio",
+};
+
+static lat_hist_t s_hist[HOWDY_LAT_SPAN_COUNT];
+
+static struct {
+    portMUX_TYPE lock;
+    int64_t last[HOWDY_LAT_POINT_COUNT];
+    int64_t t[HOWDY_LAT_POINT_COUNT];       // Open utterance, 0 = not reached
+    bool open;
+    int64_t vad_capture_us;                 // Most recent analysed frame
+    int64_t vad_us;
+    uint32_t completed;
+    uint32_t abandoned;
+} s_lat = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static inline uint32_t bucket_index(uint32_t v)
+{
+    if (v < LAT_SUB_COUNT) {
+        return v;
+    }
+    uint32_t msb = 31 - __builtin_clz(v);
+    if (msb > LAT_MAX_MSB) {
+        return LAT_BUCKETS - 1;
+    }
+    uint32_t sub = (v >> (msb - LAT_SUB_BITS)) & (LAT_SUB_COUNT - 1);
+    return (msb - LAT_SUB_BITS + 1) * LAT_SUB_COUNT + sub;
+}
+
+static inline uint32_t bucket_lower(uint32_t idx)
+{
+    if (idx < LAT_SUB_COUNT) {
+        return idx;
+    }
+    uint32_t msb = idx / LAT_SUB_COUNT + LAT_SUB_BITS - 1;
+    uint32_t sub = idx % LAT_SUB_COUNT;
+    return (LAT_SUB_COUNT + sub) << (msb - LAT_SUB_BITS);
+}
+
+static inline uint32_t bucket_upper(uint32_t idx)
+{
+    return idx + 1 < LAT_BUCKETS ? bucket_lower(idx + 1) - 1 : UINT32_MAX;
+}
+
+static void hist_record(howdy_lat_span_t span, int64_t us)
+{
+    lat_hist_t *h = &s_hist[span];
+    uint32_t v = us <= 0 ? 0 : (us > UINT32_MAX ? UINT32_MAX : (uint32_t)us);
+
+    atomic_fetch_add_explicit(&h->buckets[bucket_index(v)], 1, memory_order_relaxed);
+    uint32_t prev = atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+
+    uint32_t cur = atomic_load_explicit(&h->min_us, memory_order_relaxed);
+    while ((prev == 0 || v < cur) &&
+           !atomic_compare_exchange_weak_explicit(&h->min_us, &cur, v,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+    cur = atomic_load_explicit(&h->max_us, memory_order_relaxed);
+    while (v > cur &&
+           !atomic_compare_exchange_weak_explicit(&h->max_us, &cur, v,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+void howdy_lat_mark(howdy_lat_point_t point)
+{
+    howdy_lat_mark_at(point, esp_timer_get_time());
+}
+
+void howdy_lat_mark_at(howdy_lat_point_t point, int64_t t_us)
+{
+    if (point >= HOWDY_LAT_POINT_COUNT) {
+        return;
+    }
+    HOWDY_TRACE(HOWDY_TRACE_LATENCY_MARK, point, 0);
+
+    int64_t spans[HOWDY_LAT_SPAN_COUNT];
+    bool closed = false;
+
+    portENTER_CRITICAL(&s_lat.lock);
+    s_lat.last[point] = t_us;
+
+    if (point == HOWDY_LAT_WAKE) {
+        if (s_lat.open) {
+            s_lat.abandoned++;
+        }
+        memset(s_lat.t, 0, sizeof(s_lat.t));
+        s_lat.t[HOWDY_LAT_I2S_DMA] = s_lat.vad_capture_us;
+        s_lat.t[HOWDY_LAT_VAD_DECISION] = s_lat.vad_us;
+        s_lat.t[HOWDY_LAT_WAKE] = t_us;
+        s_lat.open = true;
+    } else if (s_lat.open && point > HOWDY_LAT_WAKE && s_lat.t[point] == 0) {
+        const int64_t *t = s_lat.t;
+        if (t_us - t[HOWDY_LAT_WAKE] > LAT_UTTERANCE_TIMEOUT_US) {
+            s_lat.open = false;
+            s_lat.abandoned++;
+        } else if ((point == HOWDY_LAT_PLAYOUT_POP && t[HOWDY_LAT_TTS_CHUNK] == 0) ||
+                   (point == HOWDY_LAT_I2S_WRITE && t[HOWDY_LAT_PLAYOUT_POP] == 0)) {
+            // Silence or leftovers from an earlier reply; wait for this one's audio
+        } else {
+            s_lat.t[point] = t_us;
+            if (point == HOWDY_LAT_I2S_WRITE) {
+                int64_t wake = t[HOWDY_LAT_WAKE];
+                for (int i = 0; i < HOWDY_LAT_SPAN_COUNT; i++) {
+                    spans[i] = -1;
+                }
+                if (t[HOWDY_LAT_VAD_DECISION]) {
+                    spans[HOWDY_LAT_SPAN_VAD_TO_WAKE] = wake - t[HOWDY_LAT_VAD_DECISION];
+                }
+                if (t[HOWDY_LAT_UPLINK]) {
+                    spans[HOWDY_LAT_SPAN_WAKE_TO_UPLINK] = t[HOWDY_LAT_UPLINK] - wake;
+                }
+                spans[HOWDY_LAT_SPAN_WAKE_TO_TTS] = t[HOWDY_LAT_TTS_CHUNK] - wake;
+                spans[HOWDY_LAT_SPAN_TTS_TO_POP] = t[HOWDY_LAT_PLAYOUT_POP] - t[HOWDY_LAT_TTS_CHUNK];
+                spans[HOWDY_LAT_SPAN_POP_TO_I2S] = t_us - t[HOWDY_LAT_PLAYOUT_POP];
+                spans[HOWDY_LAT_SPAN_WAKE_TO_AUDIO] = t_us - wake;
+                s_lat.open = false;
+                s_lat.completed++;
+                closed = true;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&s_lat.lock);
+
+    if (closed) {
+        for (int i = 0; i < HOWDY_LAT_SPAN_COUNT; i++) {
+            if (spans[i] >= 0) {
+                hist_record((howdy_lat_span_t)i, spans[i]);
+            }
+        }
+        ESP_LOGI(TAG, "Wake to first audio: %lld ms (tts %lld ms, playout %lld ms)",
+                 spans[HOWDY_LAT_SPAN_WAKE_TO_AUDIO] / 1000,
+                 spans[HOWDY_LAT_SPAN_WAKE_TO_TTS] / 1000,
+                 (spans[HOWDY_LAT_SPAN_TTS_TO_POP] + spans[HOWDY_LAT_SPAN_POP_TO_I2S]) / 1000);
+    }
+}
+
+int64_t howdy_lat_last(howdy_lat_point_t point)
+{
+    if (point >= HOWDY_LAT_POINT_COUNT) {
+        return 0;
+    }
+    portENTER_CRITICAL(&s_lat.lock);
+    int64_t t = s_lat.last[point];
+    portEXIT_CRITICAL(&s_lat.lock);
+    return t;
+}
+
+void howdy_lat_vad_decision(int64_t captured_us)
+{
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&s_lat.lock);
+    s_lat.last[HOWDY_LAT_VAD_DECISION] = now;
+    s_lat.vad_capture_us = captured_us;
+    s_lat.vad_us = now;
+    portEXIT_CRITICAL(&s_lat.lock);
+
+    if (captured_us > 0) {
+        hist_record(HOWDY_LAT_SPAN_CAPTURE_TO_VAD, now - captured_us);
+    }
+}
+
+void howdy_lat_server_echo(uint32_t echoed_ms)
+{
+    int64_t now = esp_timer_get_time();
+    int64_t rtt = -1;
+
+    portENTER_CRITICAL(&s_lat.lock);
+    int64_t wake = s_lat.t[HOWDY_LAT_WAKE];
+    int32_t skew_ms = (int32_t)((uint32_t)(wake / 1000) - echoed_ms);
+    if (s_lat.open && s_lat.t[HOWDY_LAT_SERVER_ECHO] == 0 &&
+        skew_ms >= 0 && skew_ms <= LAT_ECHO_MATCH_MS) {
+        s_lat.t[HOWDY_LAT_SERVER_ECHO] = now;
+        s_lat.last[HOWDY_LAT_SERVER_ECHO] = now;
+        rtt = now - wake;
+    }
+    portEXIT_CRITICAL(&s_lat.lock);
+
+    // Recorded on arrival so replies that never lead to audio still count
+    if (rtt >= 0) {
+        hist_record(HOWDY_LAT_SPAN_SERVER_RTT, rtt);
+    }
+}
+
+esp_err_t howdy_lat_get_summary(howdy_lat_span_t span, howdy_lat_summary_t *summary)
+{
+    if (span >= HOWDY_LAT_SPAN_COUNT || !summary) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const lat_hist_t *h = &s_hist[span];
+    static const uint32_t pct[3] = { 50, 95, 99 };
+    uint32_t *out[3] = { &summary->p50_us, &summary->p95_us, &summary->p99_us };
+
+    memset(summary, 0, sizeof(*summary));
+    summary->name = s_span_names[span];
+    summary->min_us = atomic_load_explicit(&h->min_us, memory_order_relaxed);
+    summary->max_us = atomic_load_explicit(&h->max_us, memory_order_relaxed);
+
+    // Count from the buckets so percentiles and count agree even while
+    // other tasks are recording
+    uint32_t snapshot[LAT_BUCKETS];
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < LAT_BUCKETS; i++) {
+        snapshot[i] = atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+        total += snapshot[i];
+    }
+    summary->count = total;
+    if (total == 0) {
+        return ESP_OK;
+    }
+
+    uint64_t weighted = 0;
+    uint32_t seen = 0;
+    int next = 0;
+    for (uint32_t i = 0; i < LAT_BUCKETS; i++) {
+        if (snapshot[i] == 0) {
+            continue;
+        }
+        uint32_t upper = bucket_upper(i);
+        if (upper > summary->max_us) {
+            upper = summary->max_us;
+        }
+        weighted += (uint64_t)snapshot[i] * ((bucket_lower(i) + (uint64_t)upper) / 2);
+        seen += snapshot[i];
+        // Highest value in the bucket holding the requested rank
+        while (next < 3 && (uint64_t)seen * 100 >= (uint64_t)total * pct[next]) {
+            *out[next++] = upper;
+        }
+    }
+    summary->mean_us = (uint32_t)(weighted / total);
+    return ESP_OK;
+}
+
+void howdy_lat_get_counters(howdy_lat_counters_t *counters)
+{
+    if (!counters) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lat.lock);
+    counters->completed = s_lat.completed;
+    counters->abandoned = s_lat.abandoned;
+    counters->in_progress = s_lat.open ? 1 : 0;
+    portEXIT_CRITICAL(&s_lat.lock);
+}
+
+void howdy_lat_reset(void)
+{
+    for (int s = 0; s < HOWDY_LAT_SPAN_COUNT; s++) {
+        lat_hist_t *h = &s_hist[s];
+        for (uint32_t i = 0; i < LAT_BUCKETS; i++) {
+            atomic_store_explicit(&h->buckets[i], 0, memory_order_relaxed);
+        }
+        atomic_store_explicit(&h->count, 0, memory_order_relaxed);
+        atomic_store_explicit(&h->min_us, 0, memory_order_relaxed);
+        atomic_store_explicit(&h->max_us, 0, memory_order_relaxed);
+    }
+    portENTER_CRITICAL(&s_lat.lock);
+    s_lat.completed = 0;
+    s_lat.abandoned = 0;
+    portEXIT_CRITICAL(&s_lat.lock);
+}
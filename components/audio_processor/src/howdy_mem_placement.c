@@ -0,0 +1,301 @@
+#include "howdy_mem_placement.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#include "esp_cpu.h"
+#endif
+
+static const char *TAG = "MemPlacement";
+
+#ifndef CONFIG_HOWDY_MEM_HOT_ALIGN
+#define CONFIG_HOWDY_MEM_HOT_ALIGN 32
+#endif
+
+#ifdef CONFIG_CACHE_L2_CACHE_LINE_SIZE
+#define MEM_CACHE_LINE  CONFIG_CACHE_L2_CACHE_LINE_SIZE
+#else
+#define MEM_CACHE_LINE  64
+#endif
+
+#define MEM_CAPS_INTERNAL   (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define MEM_CAPS_PSRAM      (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define MEM_CAPS_DMA        (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+
+#if defined(CONFIG_HOWDY_MEM_HOT_TCM) && defined(MALLOC_CAP_TCM)
+#define MEM_HOT_CAPS        MALLOC_CAP_TCM
+#define MEM_HOT_REGION      "tcm"
+#elif defined(CONFIG_HOWDY_MEM_HOT_PSRAM)
+#define MEM_HOT_CAPS        MEM_CAPS_PSRAM
+#define MEM_HOT_REGION      "psram"
+#else
+#define MEM_HOT_CAPS        MEM_CAPS_INTERNAL
+#define MEM_HOT_REGION      "internal"
+#endif
+
+#if defined(CONFIG_HOWDY_MEM_BULK_INTERNAL)
+#define MEM_BULK_CAPS       MEM_CAPS_INTERNAL
+#define MEM_BULK_REGION     "internal"
+#else
+#define MEM_BULK_CAPS       MEM_CAPS_PSRAM
+#define MEM_BULK_REGION     "psram"
+#endif
+
+// Every block carries a header in the alignment padding just below the
+// returned pointer, so howdy_mem_free() knows the class and base address.
+#define MEM_HDR_MAGIC   0x484D  // "HM"
+
+typedef struct {
+    uint16_t magic;
+    uint8_t cls;
+    uint8_t reserved;
+} mem_hdr_t;
+
+typedef struct {
+    uint32_t caps;
+    size_t align;
+    bool fallback;                  // Retry in internal RAM on failure
+    const char *region;
+} mem_policy_t;
+
+typedef struct {
+    atomic_uint allocs;
+    atomic_uint frees;
+    atomic_size_t live_bytes;
+    atomic_uint fallbacks;
+    atomic_uint failures;
+} mem_counters_t;
+
+static const mem_policy_t s_policy[HOWDY_MEM_CLASS_COUNT] = {
+    [HOWDY_MEM_HOT]  = { MEM_HOT_CAPS,  CONFIG_HOWDY_MEM_HOT_ALIGN, true,  MEM_HOT_REGION },
+    [HOWDY_MEM_BULK] = { MEM_BULK_CAPS, MEM_CACHE_LINE,             true,  MEM_BULK_REGION },
+    [HOWDY_MEM_DMA]  = { MEM_CAPS_DMA,  MEM_CACHE_LINE,             false, "dma" },
+};
+
+static mem_counters_t s_counters[HOWDY_MEM_CLASS_COUNT];
+
+_Static_assert((CONFIG_HOWDY_MEM_HOT_ALIGN & (CONFIG_HOWDY_MEM_HOT_ALIGN - 1)) == 0 &&
+               CONFIG_HOWDY_MEM_HOT_ALIGN >= sizeof(mem_hdr_t),
+               "HOWDY_MEM_HOT_ALIGN must be a power of two >= 4");
+
+void *howdy_mem_alloc(howdy_mem_class_t cls, size_t size)
+{
+    if (cls >= HOWDY_MEM_CLASS_COUNT || size == 0) {
+        return NULL;
+    }
+
+    const mem_policy_t *p = &s_policy[cls];
+    mem_counters_t *c = &s_counters[cls];
+    size_t total = p->align + size;
+
+    uint8_t *base = heap_caps_aligned_alloc(p->align, total, p->caps);
+    if (!base && p->fallback && p->caps != MEM_CAPS_INTERNAL) {
+        base = heap_caps_aligned_alloc(p->align, total, MEM_CAPS_INTERNAL);
+        if (base) {
+            atomic_fetch_add_explicit(&c->fallbacks, 1, memory_order_relaxed);
+        }
+    }
+    if (!base) {
+        atomic_fetch_add_explicit(&c->failures, 1, memory_order_relaxed);
+        ESP_LOGW(TAG, "%s allocation of %u bytes failed", p->region, (unsigned)size);
+        return NULL;
+    }
+
+    uint8_t *ptr = base + p->align;
+    mem_hdr_t *hdr = (mem_hdr_t *)(ptr - sizeof(mem_hdr_t));
+    hdr->magic = MEM_HDR_MAGIC;
+    hdr->cls = (uint8_t)cls;
+    hdr->reserved = 0;
+
+    atomic_fetch_add_explicit(&c->allocs, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&c->live_bytes, heap_caps_get_allocated_size(base), memory_order_relaxed);
+    return ptr;
+}
+
+void *howdy_mem_calloc(howdy_mem_class_t cls, size_t n, size_t size)
+{
+    if (size != 0 && n > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *ptr = howdy_mem_alloc(cls, n * size);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void howdy_mem_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+
+    mem_hdr_t *hdr = (mem_hdr_t *)((uint8_t *)ptr - sizeof(mem_hdr_t));
+    if (hdr->magic != MEM_HDR_MAGIC || hdr->cls >= HOWDY_MEM_CLASS_COUNT) {
+        ESP_LOGE(TAG, "Free of %p not from howdy_mem_alloc (or freed twice), leaking it", ptr);
+        return;
+    }
+
+    howdy_mem_class_t cls = (howdy_mem_class_t)hdr->cls;
+    uint8_t *base = (uint8_t *)ptr - s_policy[cls].align;
+    hdr->magic = 0;
+
+    mem_counters_t *c = &s_counters[cls];
+    atomic_fetch_add_explicit(&c->frees, 1, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&c->live_bytes, heap_caps_get_allocated_size(base), memory_order_relaxed);
+    heap_caps_free(base);
+}
+
+uint32_t howdy_mem_caps(howdy_mem_class_t cls)
+{
+    return cls < HOWDY_MEM_CLASS_COUNT ? s_policy[cls].caps : MEM_CAPS_INTERNAL;
+}
+
+size_t howdy_mem_align(howdy_mem_class_t cls)
+{
+    return cls < HOWDY_MEM_CLASS_COUNT ? s_policy[cls].align : sizeof(void *);
+}
+
+size_t howdy_mem_stride(howdy_mem_class_t cls, size_t row_bytes)
+{
+    size_t align = howdy_mem_align(cls);
+    size_t stride = (row_bytes + align - 1) & ~(align - 1);
+    if (stride >= 1024 && (stride % 1024) == 0) {
+        stride += MEM_CACHE_LINE;
+    }
+    return stride;
+}
+
+esp_err_t howdy_mem_get_stats(howdy_mem_class_t cls, howdy_mem_stats_t *stats)
+{
+    if (cls >= HOWDY_MEM_CLASS_COUNT || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const mem_counters_t *c = &s_counters[cls];
+    stats->region = s_policy[cls].region;
+    stats->allocs = atomic_load_explicit(&c->allocs, memory_order_relaxed);
+    stats->frees = atomic_load_explicit(&c->frees, memory_order_relaxed);
+    stats->live_bytes = atomic_load_explicit(&c->live_bytes, memory_order_relaxed);
+    stats->fallbacks = atomic_load_explicit(&c->fallbacks, memory_order_relaxed);
+    stats->failures = atomic_load_explicit(&c->failures, memory_order_relaxed);
+    return ESP_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+// ---------------------------------------------------------------------------
+
+#define BENCH_FRAME_SAMPLES     320         // 20 ms at 16 kHz
+#define BENCH_WORKING_SET       (64 * 1024)
+#define BENCH_PASSES            8
+
+static inline uint32_t bench_cycles(void)
+{
+#ifdef ESP_PLATFORM
+    return esp_cpu_get_cycle_count();
+#else
+    return (uint32_t)esp_timer_get_time();
+#endif
+}
+
+// Windowed energy plus a one-pole high-pass: a stand-in for the VAD front
+// end that reads every sample once and keeps its state in registers.
+static float bench_kernel(const int16_t *frame, const float *window)
+{
+    float energy = 0.0f;
+    float prev = 0.0f;
+    for (int i = 0; i < BENCH_FRAME_SAMPLES; i++) {
+        float x = frame[i] * window[i];
+        float y = x - 0.97f * prev;
+        prev = x;
+        energy += y * y;
+    }
+    return energy;
+}
+
+static bool bench_region(const char *region, uint32_t caps, const float *window,
+                         howdy_mem_bench_result_t *out)
+{
+    size_t bytes = BENCH_WORKING_SET;
+    size_t largest = heap_caps_get_largest_free_block(caps);
+    if (largest < bytes) {
+        // TCM is small; measure whatever fits as long as it holds a few frames.
+        bytes = (largest / 2) & ~(size_t)(MEM_CACHE_LINE - 1);
+    }
+    size_t frames = bytes / (BENCH_FRAME_SAMPLES * sizeof(int16_t));
+    if (frames < 4) {
+        return false;
+    }
+
+    int16_t *buf = heap_caps_aligned_alloc(MEM_CACHE_LINE, bytes, caps);
+    if (!buf) {
+        return false;
+    }
+    for (size_t i = 0; i < bytes / sizeof(int16_t); i++) {
+        buf[i] = (int16_t)((i * 7919u) & 0x7FFF) - 0x4000;
+    }
+
+    volatile float sink = 0.0f;
+    uint64_t total = 0;
+    for (int pass = 0; pass < BENCH_PASSES; pass++) {
+        for (size_t f = 0; f < frames; f++) {
+            uint32_t start = bench_cycles();
+            sink += bench_kernel(buf + f * BENCH_FRAME_SAMPLES, window);
+            total += (uint32_t)(bench_cycles() - start);
+        }
+    }
+    (void)sink;
+    heap_caps_free(buf);
+
+    out->region = region;
+    out->bytes = bytes;
+    out->cycles_per_frame = (uint32_t)(total / (frames * BENCH_PASSES));
+    return true;
+}
+
+size_t howdy_mem_benchmark(howdy_mem_bench_result_t *results, size_t max)
+{
+    if (!results || max == 0) {
+        return 0;
+    }
+
+    float *window = howdy_mem_alloc(HOWDY_MEM_HOT, BENCH_FRAME_SAMPLES * sizeof(float));
+    if (!window) {
+        return 0;
+    }
+    for (int i = 0; i < BENCH_FRAME_SAMPLES; i++) {
+        window[i] = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * i / (BENCH_FRAME_SAMPLES - 1));
+    }
+
+    static const struct {
+        const char *region;
+        uint32_t caps;
+    } regions[] = {
+        { "internal", MEM_CAPS_INTERNAL },
+#ifdef MALLOC_CAP_TCM
+        { "tcm",      MALLOC_CAP_TCM },
+#endif
+        { "psram",    MEM_CAPS_PSRAM },
+        { "dma",      MEM_CAPS_DMA },
+    };
+
+    size_t n = 0;
+    for (size_t i = 0; i < sizeof(regions) / sizeof(regions[0]) && n < max; i++) {
+        if (bench_region(regions[i].region, regions[i].caps, window, &results[n])) {
+            ESP_LOGI(TAG, "%-8s %6u bytes: %u cycles/frame", results[n].region,
+                     (unsigned)results[n].bytes, (unsigned)results[n].cycles_per_frame);
+            n++;
+        } else {
+            ESP_LOGI(TAG, "%-8s unavailable", regions[i].region);
+        }
+    }
+
+    howdy_mem_free(window);
+    return n;
+}
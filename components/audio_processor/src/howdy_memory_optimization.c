@@ -0,0 +1,549 @@
+/**
+ * @file howdy_memory_optimization.c
+ * @brief ESP32-P4 memory management: typed block pools plus tracked heap allocations
+ */
+
+#include "howdy_memory_optimization.h"
+#include "esp_check.h"
+#include "esp_log.h"
+#include "esp_memory_utils.h"
+#include "freertos/task.h"
+#include <stdatomic.h>
+#include <string.h>
+#include <strings.h>
+
+static const char *TAG = "HowdyMemory";
+
+#define HOWDY_UI_OBJECT_SIZE    256    // Default UI object block
+
+static struct {
+    bool initialized;
+    bool psram_enabled;
+    howdy_pool_t *pools[HOWDY_POOL_COUNT];
+
+    // Heap allocations made through howdy_memory_alloc_for_core()
+    atomic_size_t heap_total;
+    atomic_size_t heap_psram;
+    atomic_size_t heap_internal;
+    atomic_size_t heap_dma;
+    atomic_size_t heap_peak;
+    atomic_uint heap_allocations;
+
+    // Usage alerts
+    uint8_t warning_percent;
+    uint8_t critical_percent;
+    void (*threshold_cb)(uint8_t usage_percent, bool critical);
+    atomic_uint alert_level;            // 0 none, 1 warning, 2 critical
+} s_memory = {0};
+
+static const char *const s_pool_names[HOWDY_POOL_COUNT] = {
+    [HOWDY_POOL_AUDIO_FRAMES] = "audio_frames",
+    [HOWDY_POOL_NETWORK_PACKETS] = "net_packets",
+    [HOWDY_POOL_OPUS_WORK] = "opus_work",
+    [HOWDY_POOL_UI_OBJECTS] = "ui_objects",
+    [HOWDY_POOL_PROTOCOL_MESSAGES] = "proto_msgs",
+};
+
+static uint32_t large_buffer_caps(void)
+{
+    return s_memory.psram_enabled ? HOWDY_HEAP_CAPS_PSRAM : HOWDY_HEAP_CAPS_INTERNAL;
+}
+
+static size_t network_buffer_size(uint8_t protocol_type)
+{
+    switch (protocol_type) {
+        case 0: return HOWDY_UDP_BUFFER_SIZE;
+        case 1: return HOWDY_WEBSOCKET_BUFFER_SIZE;
+        default: return HOWDY_HTTP_BUFFER_SIZE;
+    }
+}
+
+static void account_heap(void *ptr, bool add)
+{
+    size_t size = heap_caps_get_allocated_size(ptr);
+    atomic_size_t *region = esp_ptr_external_ram(ptr) ? &s_memory.heap_psram :
+                            esp_ptr_dma_capable(ptr) ? &s_memory.heap_dma : &s_memory.heap_internal;
+
+    if (add) {
+        atomic_fetch_add(region, size);
+        size_t total = atomic_fetch_add(&s_memory.heap_total, size) + size;
+        size_t peak = atomic_load(&s_memory.heap_peak);
+        while (total > peak && !atomic_compare_exchange_weak(&s_memory.heap_peak, &peak, total)) {
+        }
+        atomic_fetch_add(&s_memory.heap_allocations, 1);
+    } else {
+        atomic_fetch_sub(region, size);
+        atomic_fetch_sub(&s_memory.heap_total, size);
+    }
+}
+
+static void check_thresholds(void)
+{
+    if (!s_memory.threshold_cb) {
+        return;
+    }
+
+    size_t total = heap_caps_get_total_size(MALLOC_CAP_INTERNAL);
+    size_t free_bytes = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    if (total == 0) {
+        return;
+    }
+
+    uint8_t usage = (uint8_t)(((total - free_bytes) * 100) / total);
+    unsigned level = usage >= s_memory.critical_percent ? 2 : usage >= s_memory.warning_percent ? 1 : 0;
+
+    // Report only when the level rises, not on every allocation above it
+    unsigned previous = atomic_exchange(&s_memory.alert_level, level);
+    if (level > previous) {
+        s_memory.threshold_cb(usage, level == 2);
+    }
+}
+
+// Pool if the block fits, otherwise a tracked heap allocation
+static void *pool_or_heap_alloc(howdy_memory_pool_type_t type, size_t size, uint8_t core_id, uint32_t caps)
+{
+    howdy_pool_t *pool = s_memory.pools[type];
+    if (pool && size <= howdy_pool_block_size(pool)) {
+        void *block = howdy_pool_alloc(pool);
+        if (block) {
+            return block;
+        }
+    }
+    return howdy_memory_alloc_for_core(size, core_id, caps);
+}
+
+esp_err_t howdy_memory_init(bool enable_psram)
+{
+    if (s_memory.initialized) {
+        return ESP_OK;
+    }
+
+    s_memory.psram_enabled = enable_psram && esp_psram_is_initialized();
+    if (enable_psram && !s_memory.psram_enabled) {
+        ESP_LOGW(TAG, "PSRAM requested but not available, using internal RAM");
+    }
+
+    // Real-time paths get their pools up front; the rest are created on demand
+    ESP_RETURN_ON_ERROR(howdy_memory_pool_create(HOWDY_POOL_AUDIO_FRAMES, HOWDY_AUDIO_FRAME_SIZE,
+                                                 HOWDY_AUDIO_POOL_COUNT, false),
+                        TAG, "Audio frame pool");
+    ESP_RETURN_ON_ERROR(howdy_memory_pool_create(HOWDY_POOL_NETWORK_PACKETS, HOWDY_WEBSOCKET_BUFFER_SIZE,
+                                                 HOWDY_NETWORK_POOL_COUNT, s_memory.psram_enabled),
+                        TAG, "Network packet pool");
+
+    s_memory.warning_percent = 80;
+    s_memory.critical_percent = 95;
+    s_memory.initialized = true;
+
+    ESP_LOGI(TAG, "Memory management ready (PSRAM %s)", s_memory.psram_enabled ? "enabled" : "disabled");
+    return ESP_OK;
+}
+
+void* howdy_memory_alloc_for_core(size_t size, uint8_t core_id, uint32_t caps)
+{
+    // Both P4 cores see the same memory map; core_id is advisory only
+    (void)core_id;
+
+    void *ptr = heap_caps_malloc(size, caps);
+    if (!ptr && (caps & MALLOC_CAP_SPIRAM)) {
+        ptr = heap_caps_malloc(size, HOWDY_HEAP_CAPS_INTERNAL);
+    }
+    if (!ptr) {
+        ESP_LOGW(TAG, "Allocation of %zu bytes failed (caps 0x%lx)", size, (unsigned long)caps);
+        return NULL;
+    }
+
+    account_heap(ptr, true);
+    check_thresholds();
+    return ptr;
+}
+
+void howdy_memory_free(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+
+    // Blocks from any registered pool go back to that pool
+    howdy_pool_t *pools[HOWDY_POOL_REGISTRY_SIZE];
+    size_t count = howdy_pool_list(pools, HOWDY_POOL_REGISTRY_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        if (howdy_pool_index(pools[i], ptr) >= 0) {
+            howdy_pool_free(pools[i], ptr);
+            return;
+        }
+    }
+
+    account_heap(ptr, false);
+    heap_caps_free(ptr);
+}
+
+//=============================================================================
+// AUDIO
+//=============================================================================
+
+void* howdy_audio_buffer_alloc(uint8_t frame_count)
+{
+    if (frame_count == 0) {
+        return NULL;
+    }
+    return pool_or_heap_alloc(HOWDY_POOL_AUDIO_FRAMES, (size_t)frame_count * HOWDY_AUDIO_FRAME_SIZE,
+                              1, HOWDY_HEAP_CAPS_INTERNAL);
+}
+
+void howdy_audio_buffer_free(void* buffer)
+{
+    howdy_memory_free(buffer);
+}
+
+RingbufHandle_t howdy_create_audio_ringbuffer(size_t buffer_size, bool use_psram)
+{
+    uint32_t caps = (use_psram && s_memory.psram_enabled) ? HOWDY_HEAP_CAPS_PSRAM : HOWDY_HEAP_CAPS_INTERNAL;
+    RingbufHandle_t rb = xRingbufferCreateWithCaps(buffer_size, RINGBUF_TYPE_BYTEBUF, caps);
+    if (!rb) {
+        ESP_LOGE(TAG, "Failed to create %zu byte audio ring buffer", buffer_size);
+    }
+    return rb;
+}
+
+void* howdy_opus_buffer_alloc(bool encoder)
+{
+    // One pool serves both directions; encoder and decoder buffers are the same size
+    (void)encoder;
+    return pool_or_heap_alloc(HOWDY_POOL_OPUS_WORK, HOWDY_OPUS_BUFFER_SIZE, 1, large_buffer_caps());
+}
+
+void howdy_opus_buffer_free(void* buffer, bool encoder)
+{
+    (void)encoder;
+    howdy_memory_free(buffer);
+}
+
+//=============================================================================
+// NETWORK
+//=============================================================================
+
+void* howdy_network_buffer_alloc(uint8_t protocol_type)
+{
+    return pool_or_heap_alloc(HOWDY_POOL_NETWORK_PACKETS, network_buffer_size(protocol_type),
+                              0, large_buffer_caps());
+}
+
+void howdy_network_buffer_free(void* buffer, uint8_t protocol_type)
+{
+    (void)protocol_type;
+    howdy_memory_free(buffer);
+}
+
+esp_err_t howdy_preallocate_network_buffers(uint8_t udp_count, uint8_t websocket_count, uint8_t http_count)
+{
+    uint16_t count = (uint16_t)udp_count + websocket_count + http_count;
+    if (count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t block = 0;
+    if (udp_count && HOWDY_UDP_BUFFER_SIZE > block) block = HOWDY_UDP_BUFFER_SIZE;
+    if (websocket_count && HOWDY_WEBSOCKET_BUFFER_SIZE > block) block = HOWDY_WEBSOCKET_BUFFER_SIZE;
+    if (http_count && HOWDY_HTTP_BUFFER_SIZE > block) block = HOWDY_HTTP_BUFFER_SIZE;
+
+    // Replace the default pool; refused while any packet buffer is out
+    howdy_pool_t *old = s_memory.pools[HOWDY_POOL_NETWORK_PACKETS];
+    if (old) {
+        ESP_RETURN_ON_ERROR(howdy_pool_destroy(old), TAG, "Network buffers still in use");
+        s_memory.pools[HOWDY_POOL_NETWORK_PACKETS] = NULL;
+    }
+
+    howdy_pool_config_t cfg = {
+        .name = s_pool_names[HOWDY_POOL_NETWORK_PACKETS],
+        .block_size = block,
+        .block_count = count,
+        .caps = large_buffer_caps(),
+    };
+    return howdy_pool_create(&cfg, &s_memory.pools[HOWDY_POOL_NETWORK_PACKETS]);
+}
+
+//=============================================================================
+// UI
+//=============================================================================
+
+void** howdy_ui_framebuffer_alloc(uint8_t buffer_count)
+{
+    if (buffer_count == 0) {
+        return NULL;
+    }
+
+    void **buffers = (void **)calloc(buffer_count, sizeof(void *));
+    if (!buffers) {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < buffer_count; i++) {
+        buffers[i] = howdy_memory_alloc_for_core(HOWDY_DISPLAY_BUFFER_SIZE, 0, large_buffer_caps());
+        if (!buffers[i]) {
+            howdy_ui_framebuffer_free(buffers, i);
+            return NULL;
+        }
+    }
+    return buffers;
+}
+
+void howdy_ui_framebuffer_free(void** framebuffers, uint8_t buffer_count)
+{
+    if (!framebuffers) {
+        return;
+    }
+    for (uint8_t i = 0; i < buffer_count; i++) {
+        howdy_memory_free(framebuffers[i]);
+    }
+    free(framebuffers);
+}
+
+void* howdy_ui_object_alloc(uint16_t object_type, size_t size)
+{
+    (void)object_type;
+    return pool_or_heap_alloc(HOWDY_POOL_UI_OBJECTS, size, 0, HOWDY_HEAP_CAPS_INTERNAL);
+}
+
+void howdy_ui_object_free(void* object, uint16_t object_type)
+{
+    (void)object_type;
+    howdy_memory_free(object);
+}
+
+//=============================================================================
+// TYPED POOLS
+//=============================================================================
+
+esp_err_t howdy_memory_pool_create(howdy_memory_pool_type_t pool_type, size_t buffer_size,
+                                  uint8_t buffer_count, bool use_psram)
+{
+    if (pool_type >= HOWDY_POOL_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_memory.pools[pool_type]) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    howdy_pool_config_t cfg = {
+        .name = s_pool_names[pool_type],
+        .block_size = buffer_size ? buffer_size : (pool_type == HOWDY_POOL_UI_OBJECTS ? HOWDY_UI_OBJECT_SIZE : 0),
+        .block_count = buffer_count,
+        .caps = (use_psram && esp_psram_is_initialized()) ? HOWDY_HEAP_CAPS_PSRAM : HOWDY_HEAP_CAPS_INTERNAL,
+    };
+    return howdy_pool_create(&cfg, &s_memory.pools[pool_type]);
+}
+
+void* howdy_memory_pool_alloc(howdy_memory_pool_type_t pool_type, TickType_t timeout_ms)
+{
+    if (pool_type >= HOWDY_POOL_COUNT || !s_memory.pools[pool_type]) {
+        return NULL;
+    }
+
+    // The pool itself never blocks; waiting callers re-poll once per tick
+    TickType_t start = xTaskGetTickCount();
+    TickType_t wait = (timeout_ms == portMAX_DELAY) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    for (;;) {
+        void *block = howdy_pool_alloc(s_memory.pools[pool_type]);
+        if (block || wait == 0) {
+            return block;
+        }
+        if (wait != portMAX_DELAY && (xTaskGetTickCount() - start) >= wait) {
+            return NULL;
+        }
+        vTaskDelay(1);
+    }
+}
+
+esp_err_t howdy_memory_pool_free(howdy_memory_pool_type_t pool_type, void* buffer)
+{
+    if (pool_type >= HOWDY_POOL_COUNT || !s_memory.pools[pool_type]) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return howdy_pool_free(s_memory.pools[pool_type], buffer);
+}
+
+esp_err_t howdy_memory_pool_stats(howdy_memory_pool_type_t pool_type, uint8_t* total_buffers,
+                                 uint8_t* available_buffers, uint8_t* peak_usage)
+{
+    if (pool_type >= HOWDY_POOL_COUNT || !s_memory.pools[pool_type]) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    howdy_pool_stats_t stats;
+    howdy_pool_get_stats(s_memory.pools[pool_type], &stats);
+    if (total_buffers) *total_buffers = (uint8_t)stats.block_count;
+    if (available_buffers) *available_buffers = (uint8_t)(stats.block_count - stats.in_use);
+    if (peak_usage) *peak_usage = (uint8_t)stats.peak_in_use;
+    return ESP_OK;
+}
+
+//=============================================================================
+// MONITORING
+//=============================================================================
+
+esp_err_t howdy_memory_get_stats(howdy_memory_stats_t* stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    stats->psram_allocated = atomic_load(&s_memory.heap_psram);
+    stats->internal_allocated = atomic_load(&s_memory.heap_internal);
+    stats->dma_allocated = atomic_load(&s_memory.heap_dma);
+    stats->allocation_count = atomic_load(&s_memory.heap_allocations);
+
+    // Pool backing memory counts as allocated from the moment the pool exists
+    size_t pool_bytes = 0;
+    howdy_pool_t *pools[HOWDY_POOL_REGISTRY_SIZE];
+    size_t count = howdy_pool_list(pools, HOWDY_POOL_REGISTRY_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        howdy_pool_stats_t ps;
+        howdy_pool_get_stats(pools[i], &ps);
+        pool_bytes += ps.footprint;
+        if (ps.caps & MALLOC_CAP_SPIRAM) {
+            stats->psram_allocated += ps.footprint;
+        } else if (ps.caps & MALLOC_CAP_DMA) {
+            stats->dma_allocated += ps.footprint;
+        } else {
+            stats->internal_allocated += ps.footprint;
+        }
+        stats->allocation_count += ps.hits;
+        stats->pool_hits += ps.hits;
+        stats->pool_misses += ps.misses;
+    }
+
+    stats->total_allocated = atomic_load(&s_memory.heap_total) + pool_bytes;
+    stats->peak_allocated = atomic_load(&s_memory.heap_peak) + pool_bytes;
+
+    size_t free_bytes = heap_caps_get_free_size(HOWDY_HEAP_CAPS_INTERNAL);
+    size_t largest = heap_caps_get_largest_free_block(HOWDY_HEAP_CAPS_INTERNAL);
+    stats->fragmentation_level = free_bytes ? (uint32_t)(100 - (largest * 100) / free_bytes) : 0;
+    return ESP_OK;
+}
+
+esp_err_t howdy_memory_optimize_layout(void)
+{
+    // Pools are fixed once created; report where the sizing is off
+    howdy_pool_t *pools[HOWDY_POOL_REGISTRY_SIZE];
+    size_t count = howdy_pool_list(pools, HOWDY_POOL_REGISTRY_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        howdy_pool_stats_t ps;
+        howdy_pool_get_stats(pools[i], &ps);
+        if (ps.misses > 0 && ps.peak_in_use >= ps.block_count) {
+            ESP_LOGW(TAG, "Pool '%s' exhausted %lu times: grow beyond %u blocks",
+                     ps.name, ps.misses, ps.block_count);
+        } else if (ps.hits > 0 && ps.peak_in_use * 2 < ps.block_count) {
+            ESP_LOGI(TAG, "Pool '%s' peaked at %lu of %u blocks: could shrink",
+                     ps.name, ps.peak_in_use, ps.block_count);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t howdy_memory_health_check(bool report_fragmentation, bool report_leaks)
+{
+    esp_err_t result = ESP_OK;
+
+    howdy_pool_t *pools[HOWDY_POOL_REGISTRY_SIZE];
+    size_t count = howdy_pool_list(pools, HOWDY_POOL_REGISTRY_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t damaged = howdy_pool_check(pools[i]);
+        howdy_pool_stats_t ps;
+        howdy_pool_get_stats(pools[i], &ps);
+        if (damaged || ps.canary_errors || ps.invalid_frees) {
+            ESP_LOGE(TAG, "Pool '%s': %lu damaged now, %lu canary errors, %lu invalid frees",
+                     ps.name, damaged, ps.canary_errors, ps.invalid_frees);
+            result = ESP_FAIL;
+        }
+        if (report_leaks && ps.in_use) {
+            ESP_LOGW(TAG, "Pool '%s': %lu blocks outstanding", ps.name, ps.in_use);
+        }
+    }
+
+    if (report_leaks) {
+        ESP_LOGI(TAG, "Tracked heap: %zu bytes in use (peak %zu)",
+                 atomic_load(&s_memory.heap_total), atomic_load(&s_memory.heap_peak));
+    }
+
+    if (report_fragmentation) {
+        howdy_memory_stats_t stats;
+        howdy_memory_get_stats(&stats);
+        ESP_LOGI(TAG, "Internal heap: %zu free, largest block %zu, fragmentation %lu%%",
+                 heap_caps_get_free_size(HOWDY_HEAP_CAPS_INTERNAL),
+                 heap_caps_get_largest_free_block(HOWDY_HEAP_CAPS_INTERNAL),
+                 stats.fragmentation_level);
+    }
+
+    return result;
+}
+
+esp_err_t howdy_memory_garbage_collect(bool aggressive_mode)
+{
+    // Nothing is reclaimed lazily; aggressive mode audits the heap instead
+    if (aggressive_mode && !heap_caps_check_integrity_all(true)) {
+        ESP_LOGE(TAG, "Heap integrity check failed");
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t howdy_memory_set_thresholds(uint8_t warning_threshold_percent,
+                                     uint8_t critical_threshold_percent,
+                                     void (*callback)(uint8_t usage_percent, bool critical))
+{
+    if (warning_threshold_percent > critical_threshold_percent || critical_threshold_percent > 100) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s_memory.warning_percent = warning_threshold_percent;
+    s_memory.critical_percent = critical_threshold_percent;
+    s_memory.threshold_cb = callback;
+    atomic_store(&s_memory.alert_level, 0);
+    return ESP_OK;
+}
+
+//=============================================================================
+// UTILITIES
+//=============================================================================
+
+size_t howdy_memory_get_optimal_buffer_size(uint8_t protocol_type, uint8_t network_quality)
+{
+    size_t base = network_buffer_size(protocol_type);
+
+    // Poor links need room to absorb jitter; clean links can run lean
+    if (network_quality < 30) {
+        return base * 2;
+    }
+    if (network_quality > 80) {
+        return base / 2;
+    }
+    return base;
+}
+
+bool howdy_memory_check_availability(size_t required_bytes, uint32_t preferred_caps)
+{
+    return heap_caps_get_largest_free_block(preferred_caps) >= required_bytes;
+}
+
+size_t howdy_memory_get_recommendation(const char* use_case, size_t data_size,
+                                      uint32_t* recommended_caps, uint8_t* recommended_core)
+{
+    uint32_t caps = HOWDY_HEAP_CAPS_INTERNAL;
+    uint8_t core = 0;
+
+    if (use_case && strcasecmp(use_case, "audio") == 0) {
+        core = 1;
+    } else if (use_case && strcasecmp(use_case, "dma") == 0) {
+        caps = HOWDY_HEAP_CAPS_DMA;
+        core = 1;
+    } else if (use_case && (strcasecmp(use_case, "ui") == 0 ||
+                            (strcasecmp(use_case, "network") == 0 && data_size >= HOWDY_WEBSOCKET_BUFFER_SIZE))) {
+        caps = large_buffer_caps();
+    }
+
+    if (recommended_caps) *recommended_caps = caps;
+    if (recommended_core) *recommended_core = core;
+    return (data_size + 3) & ~(size_t)3;
+}
@@ -0,0 +1,332 @@
+#include "howdy_memory_pool.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+static const char *TAG = "HowdyPool";
+
+#define POOL_EMPTY          0xFFFFu
+#define POOL_TAG_ONE        0x10000u
+#define POOL_ALIGN          8
+#define POOL_DMA_ALIGN      64          // Cache line, so DMA blocks never share one
+#define POOL_HEAD_CANARY    0xDEADC0DEu
+#define POOL_TAIL_CANARY    0xFEEDFACEu
+#define POOL_POISON         0xA5
+
+#ifdef CONFIG_HOWDY_MEMORY_POOL_CANARIES
+#define POOL_CANARIES_DEFAULT true
+#else
+#define POOL_CANARIES_DEFAULT false
+#endif
+
+struct howdy_pool {
+    // Free-list head: tag in the upper 16 bits, block index in the lower 16
+    _Atomic uint32_t head;
+    _Atomic uint16_t *next;
+    _Atomic uint8_t *allocated;         // Per block, catches double frees
+
+    char name[HOWDY_POOL_NAME_LEN];
+    size_t block_size;
+    uint16_t block_count;
+    uint32_t caps;
+    bool canaries;
+    size_t offset;                      // Block start to user pointer
+    size_t stride;
+    size_t footprint;
+    uint8_t *blocks;
+
+    atomic_uint in_use;
+    atomic_uint peak_in_use;
+    atomic_uint hits;
+    atomic_uint misses;
+    atomic_uint frees;
+    atomic_uint canary_errors;
+    atomic_uint invalid_frees;
+};
+
+static _Atomic(howdy_pool_t *) s_registry[HOWDY_POOL_REGISTRY_SIZE];
+
+static size_t round_up(size_t v, size_t align)
+{
+    return (v + align - 1) & ~(align - 1);
+}
+
+static inline uint8_t *user_ptr(const howdy_pool_t *pool, uint32_t idx)
+{
+    return pool->blocks + (size_t)idx * pool->stride + pool->offset;
+}
+
+static bool canaries_intact(const howdy_pool_t *pool, const uint8_t *user)
+{
+    uint32_t head, tail;
+    memcpy(&head, user - sizeof(uint32_t), sizeof(head));
+    memcpy(&tail, user + pool->block_size, sizeof(tail));
+    return head == POOL_HEAD_CANARY && tail == POOL_TAIL_CANARY;
+}
+
+static void write_canaries(const howdy_pool_t *pool, uint8_t *user)
+{
+    const uint32_t head = POOL_HEAD_CANARY, tail = POOL_TAIL_CANARY;
+    memcpy(user - sizeof(uint32_t), &head, sizeof(head));
+    memcpy(user + pool->block_size, &tail, sizeof(tail));
+}
+
+static uint32_t pop_block(howdy_pool_t *pool)
+{
+    uint32_t old = atomic_load_explicit(&pool->head, memory_order_acquire);
+    for (;;) {
+        uint32_t idx = old & 0xFFFFu;
+        if (idx == POOL_EMPTY) {
+            return POOL_EMPTY;
+        }
+        // May read a stale link if another core pops idx first; the tag makes our CAS fail then
+        uint32_t next = atomic_load_explicit(&pool->next[idx], memory_order_relaxed);
+        uint32_t desired = ((old + POOL_TAG_ONE) & 0xFFFF0000u) | next;
+        if (atomic_compare_exchange_weak_explicit(&pool->head, &old, desired,
+                                                  memory_order_acquire, memory_order_acquire)) {
+            return idx;
+        }
+    }
+}
+
+static void push_block(howdy_pool_t *pool, uint32_t idx)
+{
+    uint32_t old = atomic_load_explicit(&pool->head, memory_order_relaxed);
+    uint32_t desired;
+    do {
+        atomic_store_explicit(&pool->next[idx], (uint16_t)(old & 0xFFFFu), memory_order_relaxed);
+        desired = ((old + POOL_TAG_ONE) & 0xFFFF0000u) | idx;
+    } while (!atomic_compare_exchange_weak_explicit(&pool->head, &old, desired,
+                                                    memory_order_release, memory_order_relaxed));
+}
+
+esp_err_t howdy_pool_create(const howdy_pool_config_t *config, howdy_pool_t **out_pool)
+{
+    if (!config || !out_pool || config->block_size == 0 ||
+        config->block_count == 0 || config->block_count > HOWDY_POOL_MAX_BLOCKS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    howdy_pool_t *pool = (howdy_pool_t *)calloc(1, sizeof(howdy_pool_t));
+    if (!pool) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    strncpy(pool->name, config->name ? config->name : "pool", sizeof(pool->name) - 1);
+    pool->block_size = config->block_size;
+    pool->block_count = config->block_count;
+    pool->caps = config->caps;
+    pool->canaries = config->canaries || POOL_CANARIES_DEFAULT;
+
+    size_t align = (config->caps & MALLOC_CAP_DMA) ? POOL_DMA_ALIGN : POOL_ALIGN;
+    size_t guard = pool->canaries ? sizeof(uint32_t) : 0;
+    pool->offset = pool->canaries ? POOL_ALIGN : 0;
+    pool->stride = round_up(pool->offset + config->block_size + guard, align);
+    pool->footprint = pool->stride * config->block_count;
+
+    pool->blocks = (uint8_t *)heap_caps_aligned_calloc(align, 1, pool->footprint, config->caps);
+    pool->next = (_Atomic uint16_t *)calloc(config->block_count, sizeof(*pool->next));
+    pool->allocated = (_Atomic uint8_t *)calloc(config->block_count, sizeof(*pool->allocated));
+    if (!pool->blocks || !pool->next || !pool->allocated) {
+        ESP_LOGE(TAG, "Pool '%s': cannot allocate %zu bytes (caps 0x%lx)",
+                 pool->name, pool->footprint, (unsigned long)config->caps);
+        heap_caps_free(pool->blocks);
+        free((void *)pool->next);
+        free((void *)pool->allocated);
+        free(pool);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Thread every block onto the free list, lowest index first out
+    for (uint32_t i = 0; i < config->block_count; i++) {
+        uint32_t link = (i + 1 < config->block_count) ? i + 1 : POOL_EMPTY;
+        atomic_init(&pool->next[i], (uint16_t)link);
+        atomic_init(&pool->allocated[i], 0);
+        if (pool->canaries) {
+            memset(user_ptr(pool, i), POOL_POISON, config->block_size);
+        }
+    }
+    atomic_init(&pool->head, 0);
+
+    // Claim a registry slot; pools beyond the registry still work, they are just not listed
+    for (size_t i = 0; i < HOWDY_POOL_REGISTRY_SIZE; i++) {
+        howdy_pool_t *expected = NULL;
+        if (atomic_compare_exchange_strong(&s_registry[i], &expected, pool)) {
+            break;
+        }
+    }
+
+    ESP_LOGI(TAG, "Pool '%s': %u x %zu bytes (%zu total, canaries %s)",
+             pool->name, pool->block_count, pool->block_size, pool->footprint,
+             pool->canaries ? "on" : "off");
+    *out_pool = pool;
+    return ESP_OK;
+}
+
+esp_err_t howdy_pool_destroy(howdy_pool_t *pool)
+{
+    if (!pool) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    unsigned outstanding = atomic_load(&pool->in_use);
+    if (outstanding) {
+        ESP_LOGE(TAG, "Pool '%s': %u blocks still in use", pool->name, outstanding);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    for (size_t i = 0; i < HOWDY_POOL_REGISTRY_SIZE; i++) {
+        howdy_pool_t *expected = pool;
+        atomic_compare_exchange_strong(&s_registry[i], &expected, NULL);
+    }
+
+    heap_caps_free(pool->blocks);
+    free((void *)pool->next);
+    free((void *)pool->allocated);
+    free(pool);
+    return ESP_OK;
+}
+
+void *howdy_pool_alloc(howdy_pool_t *pool)
+{
+    if (!pool) {
+        return NULL;
+    }
+
+    uint32_t idx = pop_block(pool);
+    if (idx == POOL_EMPTY) {
+        atomic_fetch_add_explicit(&pool->misses, 1, memory_order_relaxed);
+        return NULL;
+    }
+
+    atomic_store_explicit(&pool->allocated[idx], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&pool->hits, 1, memory_order_relaxed);
+
+    unsigned in_use = atomic_fetch_add_explicit(&pool->in_use, 1, memory_order_relaxed) + 1;
+    unsigned peak = atomic_load_explicit(&pool->peak_in_use, memory_order_relaxed);
+    while (in_use > peak &&
+           !atomic_compare_exchange_weak_explicit(&pool->peak_in_use, &peak, in_use,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+
+    uint8_t *user = user_ptr(pool, idx);
+    if (pool->canaries) {
+        write_canaries(pool, user);
+    }
+    return user;
+}
+
+int howdy_pool_index(const howdy_pool_t *pool, const void *ptr)
+{
+    if (!pool || !ptr) {
+        return -1;
+    }
+
+    const uint8_t *p = (const uint8_t *)ptr;
+    const uint8_t *first = pool->blocks + pool->offset;
+    if (p < first || p >= first + pool->footprint) {
+        return -1;
+    }
+
+    size_t delta = (size_t)(p - first);
+    if (delta % pool->stride != 0) {
+        return -1;
+    }
+    return (int)(delta / pool->stride);
+}
+
+esp_err_t howdy_pool_free(howdy_pool_t *pool, void *ptr)
+{
+    int idx = howdy_pool_index(pool, ptr);
+    if (idx < 0) {
+        if (pool) {
+            atomic_fetch_add_explicit(&pool->invalid_frees, 1, memory_order_relaxed);
+            ESP_LOGE(TAG, "Pool '%s': free of foreign pointer %p", pool->name, ptr);
+        }
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    if (atomic_exchange_explicit(&pool->allocated[idx], 0, memory_order_relaxed) == 0) {
+        atomic_fetch_add_explicit(&pool->invalid_frees, 1, memory_order_relaxed);
+        ESP_LOGE(TAG, "Pool '%s': double free of block %d", pool->name, idx);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = ESP_OK;
+    if (pool->canaries) {
+        if (!canaries_intact(pool, (uint8_t *)ptr)) {
+            atomic_fetch_add_explicit(&pool->canary_errors, 1, memory_order_relaxed);
+            ESP_LOGE(TAG, "Pool '%s': guard words damaged around block %d", pool->name, idx);
+            ret = ESP_ERR_INVALID_CRC;
+        }
+        memset(ptr, POOL_POISON, pool->block_size);
+    }
+
+    atomic_fetch_sub_explicit(&pool->in_use, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&pool->frees, 1, memory_order_relaxed);
+    push_block(pool, (uint32_t)idx);
+    return ret;
+}
+
+size_t howdy_pool_block_size(const howdy_pool_t *pool)
+{
+    return pool ? pool->block_size : 0;
+}
+
+esp_err_t howdy_pool_get_stats(const howdy_pool_t *pool, howdy_pool_stats_t *stats)
+{
+    if (!pool || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    howdy_pool_t *p = (howdy_pool_t *)pool;
+    memset(stats, 0, sizeof(*stats));
+    memcpy(stats->name, p->name, sizeof(stats->name));
+    stats->block_size = p->block_size;
+    stats->block_count = p->block_count;
+    stats->caps = p->caps;
+    stats->footprint = p->footprint;
+    stats->in_use = atomic_load_explicit(&p->in_use, memory_order_relaxed);
+    stats->peak_in_use = atomic_load_explicit(&p->peak_in_use, memory_order_relaxed);
+    stats->hits = atomic_load_explicit(&p->hits, memory_order_relaxed);
+    stats->misses = atomic_load_explicit(&p->misses, memory_order_relaxed);
+    stats->frees = atomic_load_explicit(&p->frees, memory_order_relaxed);
+    stats->canary_errors = atomic_load_explicit(&p->canary_errors, memory_order_relaxed);
+    stats->invalid_frees = atomic_load_explicit(&p->invalid_frees, memory_order_relaxed);
+    return ESP_OK;
+}
+
+uint32_t howdy_pool_check(howdy_pool_t *pool)
+{
+    if (!pool || !pool->canaries) {
+        return 0;
+    }
+
+    uint32_t damaged = 0;
+    for (uint32_t i = 0; i < pool->block_count; i++) {
+        if (atomic_load_explicit(&pool->allocated[i], memory_order_relaxed) &&
+            !canaries_intact(pool, user_ptr(pool, i))) {
+            ESP_LOGE(TAG, "Pool '%s': guard words damaged around block %lu", pool->name, (unsigned long)i);
+            damaged++;
+        }
+    }
+    return damaged;
+}
+
+size_t howdy_pool_list(howdy_pool_t **pools, size_t max)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < HOWDY_POOL_REGISTRY_SIZE && n < max; i++) {
+        howdy_pool_t *pool = atomic_load(&s_registry[i]);
+        if (pool) {
+            pools[n++] = pool;
+        }
+    }
+    return n;
+}
@@ -0,0 +1,421 @@
+#include "howdy_sched_monitor.h"
+#include "howdy_trace.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+static const char *TAG = "SchedMon";
+
+// Period jitter and work time are smoothed with a 1/16 EWMA
+#define SCHED_EWMA_SHIFT            4
+
+// Each periodic task reads its own stack high-water mark about this often
+#define SCHED_STACK_SAMPLE_US       (1000 * 1000)
+
+struct howdy_sched_task {
+    howdy_sched_periodic_stats_t st;
+    TaskHandle_t task;                  // NULL once unregistered
+    int64_t wake_us;                    // Start of the current cycle, 0 between cycles
+    int64_t last_wake_us;               // Previous wake, 0 to start a new cadence
+    bool after_miss;                    // Previous wake was late, so this interval is short
+    uint32_t stack_every;
+    uint32_t stack_tick;
+    uint8_t index;
+};
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+typedef struct {
+    TaskHandle_t task;
+    configRUN_TIME_COUNTER_TYPE run_time;
+} run_time_prev_t;
+#endif
+
+static struct {
+    portMUX_TYPE lock;
+    struct howdy_sched_task periodic[HOWDY_SCHED_MAX_PERIODIC];
+    // Cached by howdy_sched_sample()
+    howdy_sched_task_stats_t tasks[HOWDY_SCHED_MAX_TASKS];
+    size_t task_count;
+    uint32_t window_ms;
+    float idle_percent;
+    int64_t sample_us;
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    run_time_prev_t *prev;              // Owned by the sampling task
+    size_t prev_count;
+    configRUN_TIME_COUNTER_TYPE prev_total;
+#endif
+} s_sched = {
+    .lock = portMUX_INITIALIZER_UNLOCKED,
+    .idle_percent = -1.0f,
+};
+
+static inline void ewma(uint32_t *avg, uint32_t sample)
+{
+    *avg = (uint32_t)((int32_t)*avg + ((int32_t)sample - (int32_t)*avg) / (1 << SCHED_EWMA_SHIFT));
+}
+
+static void clear_counters(struct howdy_sched_task *h)
+{
+    howdy_sched_periodic_stats_t *st = &h->st;
+    st->cycles = 0;
+    st->overruns = 0;
+    st->misses = 0;
+    st->consecutive_misses = 0;
+    st->max_consecutive_misses = 0;
+    st->jitter_avg_us = 0;
+    st->jitter_max_us = 0;
+    st->work_avg_us = 0;
+    st->work_max_us = 0;
+}
+
+howdy_sched_handle_t howdy_sched_register(const char *name, uint32_t period_us)
+{
+    if (!name || !name[0] || period_us == 0) {
+        return NULL;
+    }
+
+    struct howdy_sched_task *slot = NULL;
+    portENTER_CRITICAL(&s_sched.lock);
+    for (int i = 0; i < HOWDY_SCHED_MAX_PERIODIC; i++) {
+        struct howdy_sched_task *h = &s_sched.periodic[i];
+        if (strncmp(h->st.name, name, HOWDY_SCHED_NAME_LEN - 1) == 0) {
+            slot = h;
+            break;
+        }
+        if (!slot && !h->st.name[0]) {
+            slot = h;
+        }
+    }
+    if (slot) {
+        memset(slot, 0, sizeof(*slot));
+        strncpy(slot->st.name, name, HOWDY_SCHED_NAME_LEN - 1);
+        slot->st.running = true;
+        slot->st.period_us = period_us;
+        slot->st.cpu_percent = -1.0f;
+        slot->task = xTaskGetCurrentTaskHandle();
+        slot->stack_every = period_us < SCHED_STACK_SAMPLE_US ? SCHED_STACK_SAMPLE_US / period_us : 1;
+        slot->index = (uint8_t)(slot - s_sched.periodic);
+    }
+    portEXIT_CRITICAL(&s_sched.lock);
+
+    if (!slot) {
+        ESP_LOGW(TAG, "No monitor slot for %s (%d in use)", name, HOWDY_SCHED_MAX_PERIODIC);
+    }
+    return slot;
+}
+
+void howdy_sched_unregister(howdy_sched_handle_t handle)
+{
+    if (!handle) {
+        return;
+    }
+    portENTER_CRITICAL(&s_sched.lock);
+    handle->st.running = false;
+    handle->task = NULL;
+    portEXIT_CRITICAL(&s_sched.lock);
+}
+
+static void record_wake(struct howdy_sched_task *h, int64_t now, bool not_delayed)
+{
+    howdy_sched_periodic_stats_t *st = &h->st;
+    uint32_t missed = 0;
+
+    if (h->last_wake_us) {
+        uint32_t interval = (uint32_t)(now - h->last_wake_us);
+        if (interval > st->period_us + st->period_us / 2) {
+            missed = (interval - st->period_us / 2) / st->period_us;
+        }
+        if (not_delayed && missed == 0) {
+            missed = 1;
+        }
+
+        if (missed) {
+            st->misses += missed;
+            st->consecutive_misses += missed;
+            if (st->consecutive_misses > st->max_consecutive_misses) {
+                st->max_consecutive_misses = st->consecutive_misses;
+            }
+            HOWDY_TRACE(HOWDY_TRACE_DEADLINE_MISS, h->index, interval);
+        } else if (h->after_miss) {
+            // Measured from a late wake; not the task's jitter
+            st->consecutive_misses = 0;
+        } else {
+            uint32_t jitter = interval > st->period_us ? interval - st->period_us
+                                                       : st->period_us - interval;
+            st->consecutive_misses = 0;
+            ewma(&st->jitter_avg_us, jitter);
+            if (jitter > st->jitter_max_us) {
+                st->jitter_max_us = jitter;
+            }
+        }
+    }
+
+    h->after_miss = missed != 0;
+    h->last_wake_us = now;
+    h->wake_us = now;
+    st->cycles++;
+
+    if (++h->stack_tick >= h->stack_every) {
+        h->stack_tick = 0;
+        st->stack_free_min = (uint32_t)uxTaskGetStackHighWaterMark(NULL);
+    }
+}
+
+static void record_done(struct howdy_sched_task *h, int64_t now)
+{
+    howdy_sched_periodic_stats_t *st = &h->st;
+
+    if (h->wake_us) {
+        uint32_t work = (uint32_t)(now - h->wake_us);
+        ewma(&st->work_avg_us, work);
+        if (work > st->work_max_us) {
+            st->work_max_us = work;
+        }
+        if (work > st->period_us) {
+            st->overruns++;
+        }
+        h->wake_us = 0;
+    }
+}
+
+void howdy_sched_delay_until(howdy_sched_handle_t handle, TickType_t *last_wake, TickType_t period)
+{
+    if (!handle) {
+        vTaskDelayUntil(last_wake, period);
+        return;
+    }
+
+    record_done(handle, esp_timer_get_time());
+    // pdFALSE means the deadline had already passed and FreeRTOS is catching up
+    BaseType_t delayed = xTaskDelayUntil(last_wake, period);
+    record_wake(handle, esp_timer_get_time(), delayed == pdFALSE);
+}
+
+void howdy_sched_wake(howdy_sched_handle_t handle)
+{
+    if (handle) {
+        record_wake(handle, esp_timer_get_time(), false);
+    }
+}
+
+void howdy_sched_done(howdy_sched_handle_t handle)
+{
+    if (handle) {
+        record_done(handle, esp_timer_get_time());
+    }
+}
+
+void howdy_sched_set_period(howdy_sched_handle_t handle, uint32_t period_us)
+{
+    if (handle && period_us) {
+        handle->st.period_us = period_us;
+    }
+}
+
+void howdy_sched_idle(howdy_sched_handle_t handle)
+{
+    if (handle) {
+        handle->last_wake_us = 0;
+        handle->st.consecutive_misses = 0;
+    }
+}
+
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+static int cmp_cpu_desc(const void *a, const void *b)
+{
+    const howdy_sched_task_stats_t *ta = a;
+    const howdy_sched_task_stats_t *tb = b;
+    if (ta->cpu_percent != tb->cpu_percent) {
+        return ta->cpu_percent < tb->cpu_percent ? 1 : -1;
+    }
+    return strcmp(ta->name, tb->name);
+}
+#endif
+
+esp_err_t howdy_sched_sample(void)
+{
+#if CONFIG_FREERTOS_USE_TRACE_FACILITY
+    // A little headroom for tasks created between the count and the walk
+    UBaseType_t cap = uxTaskGetNumberOfTasks() + 4;
+    TaskStatus_t *list = heap_caps_malloc(cap * sizeof(TaskStatus_t), MALLOC_CAP_DEFAULT);
+    howdy_sched_task_stats_t *out = heap_caps_malloc(cap * sizeof(howdy_sched_task_stats_t), MALLOC_CAP_DEFAULT);
+    if (!list || !out) {
+        heap_caps_free(list);
+        heap_caps_free(out);
+        return ESP_ERR_NO_MEM;
+    }
+
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    UBaseType_t n = uxTaskGetSystemState(list, cap, &total);
+    int64_t now = esp_timer_get_time();
+    uint32_t window_ms = s_sched.sample_us ? (uint32_t)((now - s_sched.sample_us) / 1000) : 0;
+    float idle_percent = -1.0f;
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    // Run time counts per core, so the whole CPU is elapsed time x cores
+    configRUN_TIME_COUNTER_TYPE elapsed = total - s_sched.prev_total;
+    bool have_window = s_sched.prev && elapsed > 0;
+    run_time_prev_t *prev = heap_caps_malloc(n * sizeof(run_time_prev_t), MALLOC_CAP_DEFAULT);
+    if (have_window) {
+        idle_percent = 0.0f;
+    }
+#endif
+
+    for (UBaseType_t i = 0; i < n; i++) {
+        howdy_sched_task_stats_t *t = &out[i];
+        strncpy(t->name, list[i].pcTaskName, HOWDY_SCHED_NAME_LEN - 1);
+        t->name[HOWDY_SCHED_NAME_LEN - 1] = '\0';
+        t->priority = (uint8_t)list[i].uxCurrentPriority;
+        BaseType_t core = xTaskGetCoreID(list[i].xHandle);
+        t->core = (core >= 0 && core < portNUM_PROCESSORS) ? (int8_t)core : -1;
+        t->stack_free_min = (uint32_t)list[i].usStackHighWaterMark;
+        t->cpu_percent = -1.0f;
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+        if (prev) {
+            prev[i].task = list[i].xHandle;
+            prev[i].run_time = list[i].ulRunTimeCounter;
+        }
+        if (have_window) {
+            for (size_t j = 0; j < s_sched.prev_count; j++) {
+                if (s_sched.prev[j].task == list[i].xHandle) {
+                    configRUN_TIME_COUNTER_TYPE used = list[i].ulRunTimeCounter - s_sched.prev[j].run_time;
+                    t->cpu_percent = 100.0f * (float)used / ((float)elapsed * portNUM_PROCESSORS);
+                    break;
+                }
+            }
+            if (t->cpu_percent >= 0.0f && strncmp(t->name, "IDLE", 4) == 0) {
+                idle_percent += t->cpu_percent;
+            }
+        }
+#endif
+    }
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    heap_caps_free(s_sched.prev);
+    s_sched.prev = prev;
+    s_sched.prev_count = prev ? n : 0;
+    s_sched.prev_total = total;
+#endif
+
+    portENTER_CRITICAL(&s_sched.lock);
+    for (int p = 0; p < HOWDY_SCHED_MAX_PERIODIC; p++) {
+        struct howdy_sched_task *h = &s_sched.periodic[p];
+        if (!h->task) {
+            continue;
+        }
+        for (UBaseType_t i = 0; i < n; i++) {
+            if (list[i].xHandle == h->task) {
+                h->st.stack_free_min = out[i].stack_free_min;
+                h->st.cpu_percent = out[i].cpu_percent;
+                break;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&s_sched.lock);
+
+    qsort(out, n, sizeof(*out), cmp_cpu_desc);
+
+    portENTER_CRITICAL(&s_sched.lock);
+    s_sched.task_count = n < HOWDY_SCHED_MAX_TASKS ? n : HOWDY_SCHED_MAX_TASKS;
+    memcpy(s_sched.tasks, out, s_sched.task_count * sizeof(*out));
+    s_sched.window_ms = window_ms;
+    s_sched.idle_percent = idle_percent;
+    s_sched.sample_us = now;
+    portEXIT_CRITICAL(&s_sched.lock);
+
+    heap_caps_free(list);
+    heap_caps_free(out);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+size_t howdy_sched_get_periodic(howdy_sched_periodic_stats_t *out, size_t max)
+{
+    if (!out) {
+        return 0;
+    }
+    size_t count = 0;
+    portENTER_CRITICAL(&s_sched.lock);
+    for (int i = 0; i < HOWDY_SCHED_MAX_PERIODIC && count < max; i++) {
+        if (s_sched.periodic[i].st.name[0]) {
+            out[count++] = s_sched.periodic[i].st;
+        }
+    }
+    portEXIT_CRITICAL(&s_sched.lock);
+    return count;
+}
+
+size_t howdy_sched_get_tasks(howdy_sched_task_stats_t *out, size_t max)
+{
+    if (!out) {
+        return 0;
+    }
+    portENTER_CRITICAL(&s_sched.lock);
+    size_t count = s_sched.task_count < max ? s_sched.task_count : max;
+    memcpy(out, s_sched.tasks, count * sizeof(*out));
+    portEXIT_CRITICAL(&s_sched.lock);
+    return count;
+}
+
+void howdy_sched_get_summary(howdy_sched_summary_t *summary)
+{
+    if (!summary) {
+        return;
+    }
+    memset(summary, 0, sizeof(*summary));
+
+    portENTER_CRITICAL(&s_sched.lock);
+    summary->window_ms = s_sched.window_ms;
+    summary->idle_percent = s_sched.idle_percent;
+
+    for (int i = 0; i < HOWDY_SCHED_MAX_PERIODIC; i++) {
+        const howdy_sched_periodic_stats_t *st = &s_sched.periodic[i].st;
+        if (!st->name[0] || st->cycles == 0) {
+            continue;
+        }
+        summary->misses += st->misses;
+        summary->overruns += st->overruns;
+        if (st->max_consecutive_misses > summary->max_consecutive_misses) {
+            summary->max_consecutive_misses = st->max_consecutive_misses;
+        }
+        if (!summary->worst_jitter_task[0] || st->jitter_max_us > summary->jitter_max_us) {
+            summary->jitter_max_us = st->jitter_max_us;
+            strncpy(summary->worst_jitter_task, st->name, HOWDY_SCHED_NAME_LEN - 1);
+        }
+        // Fallback when the task list isn't available
+        if (st->stack_free_min &&
+            (!summary->lowest_stack_task[0] || st->stack_free_min < summary->stack_free_min)) {
+            summary->stack_free_min = st->stack_free_min;
+            strncpy(summary->lowest_stack_task, st->name, HOWDY_SCHED_NAME_LEN - 1);
+        }
+    }
+
+    for (size_t i = 0; i < s_sched.task_count; i++) {
+        const howdy_sched_task_stats_t *t = &s_sched.tasks[i];
+        if (i == 0 || t->stack_free_min < summary->stack_free_min) {
+            summary->stack_free_min = t->stack_free_min;
+            memcpy(summary->lowest_stack_task, t->name, HOWDY_SCHED_NAME_LEN);
+        }
+    }
+    portEXIT_CRITICAL(&s_sched.lock);
+}
+
+void howdy_sched_reset(void)
+{
+    // Owners write their slots without the lock; a racing cycle may survive the reset
+    portENTER_CRITICAL(&s_sched.lock);
+    for (int i = 0; i < HOWDY_SCHED_MAX_PERIODIC; i++) {
+        clear_counters(&s_sched.periodic[i]);
+    }
+    portEXIT_CRITICAL(&s_sched.lock);
+}
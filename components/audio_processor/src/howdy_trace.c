@@ -0,0 +1,388 @@
+#include "howdy_trace.h"
+#include "howdy_mem_placement.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_freertos_hooks.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_memory_utils.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char *TAG = "Trace";
+
+#ifndef CONFIG_HOWDY_TRACE_EVENTS_PER_CORE
+#define CONFIG_HOWDY_TRACE_EVENTS_PER_CORE 1024
+#endif
+
+#define TRACE_CORES         (portNUM_PROCESSORS < HOWDY_TRACE_MAX_CORES ? portNUM_PROCESSORS : HOWDY_TRACE_MAX_CORES)
+#define TRACE_OUT_BUF       1024    // Dump output is flushed in chunks of this size
+#define TRACE_TID_TRACK     100     // Chrome tid for track n is TRACE_TID_TRACK + n
+
+// seq is 0 while a slot is being written, else ring index + 1
+typedef struct {
+    atomic_uint seq;
+    uint16_t event;
+    uint16_t reserved;
+    uint32_t ts_lo;
+    uint32_t ts_hi;
+    uint32_t a0;
+    uint32_t a1;
+} trace_slot_t;
+
+typedef struct {
+    atomic_uint head;
+    trace_slot_t *slots;
+} trace_ring_t;
+
+// A slot copied out for the dump
+typedef struct {
+    int64_t ts;
+    uint16_t event;
+    uint8_t core;
+    uint32_t a0;
+    uint32_t a1;
+} trace_event_t;
+
+static struct {
+    trace_ring_t rings[HOWDY_TRACE_MAX_CORES];
+    uint32_t capacity;
+    uint32_t mask;
+    volatile bool enabled;
+    TaskHandle_t last_task[HOWDY_TRACE_MAX_CORES];  // Tick hook state
+    portMUX_TYPE track_lock;
+    uint8_t track_count;
+    char tracks[HOWDY_TRACE_MAX_TRACKS][HOWDY_TRACE_TRACK_NAME_LEN];
+} s_trace = {
+    .track_lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+void IRAM_ATTR howdy_trace_record(uint16_t event, uint32_t a0, uint32_t a1)
+{
+    if (!s_trace.enabled) {
+        return;
+    }
+
+    trace_ring_t *ring = &s_trace.rings[xPortGetCoreID()];
+    uint32_t idx = atomic_fetch_add_explicit(&ring->head, 1, memory_order_relaxed);
+    trace_slot_t *slot = &ring->slots[idx & s_trace.mask];
+    uint64_t ts = (uint64_t)esp_timer_get_time();
+
+    atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->event = event;
+    slot->ts_lo = (uint32_t)ts;
+    slot->ts_hi = (uint32_t)(ts >> 32);
+    slot->a0 = a0;
+    slot->a1 = a1;
+    atomic_store_explicit(&slot->seq, idx + 1, memory_order_release);
+}
+
+// Sample the running task once per tick on each core
+static void IRAM_ATTR trace_tick_hook(void)
+{
+    int core = xPortGetCoreID();
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    if (task == s_trace.last_task[core]) {
+        return;
+    }
+    s_trace.last_task[core] = task;
+
+    uint32_t packed[2] = { 0, 0 };
+    const char *name = pcTaskGetName(task);
+    if (name) {
+        strncpy((char *)packed, name, sizeof(packed));
+    }
+    howdy_trace_record(HOWDY_TRACE_TASK_SWITCH, packed[0], packed[1]);
+}
+
+esp_err_t howdy_trace_init(void)
+{
+    if (s_trace.capacity) {
+        return ESP_OK;
+    }
+
+    uint32_t capacity = 1;
+    while (capacity < CONFIG_HOWDY_TRACE_EVENTS_PER_CORE) {
+        capacity <<= 1;
+    }
+
+    // The tick hook records while flash writes have the cache off, so the rings
+    // cannot live in PSRAM (a HOT placement override would put them there)
+    for (int core = 0; core < TRACE_CORES; core++) {
+        trace_slot_t *slots = howdy_mem_calloc(HOWDY_MEM_HOT, capacity, sizeof(trace_slot_t));
+        if (slots && !esp_ptr_internal(slots)) {
+            howdy_mem_free(slots);
+            slots = NULL;
+        }
+        s_trace.rings[core].slots = slots;
+        if (!slots) {
+            for (int i = 0; i < core; i++) {
+                howdy_mem_free(s_trace.rings[i].slots);
+                s_trace.rings[i].slots = NULL;
+            }
+            ESP_LOGE(TAG, "Failed to allocate %lu-event trace rings in internal RAM", capacity);
+            return ESP_ERR_NO_MEM;
+        }
+        atomic_init(&s_trace.rings[core].head, 0);
+    }
+    s_trace.capacity = capacity;
+    s_trace.mask = capacity - 1;
+    s_trace.enabled = true;
+
+    for (int core = 0; core < TRACE_CORES; core++) {
+        if (esp_register_freertos_tick_hook_for_cpu(trace_tick_hook, core) != ESP_OK) {
+            ESP_LOGW(TAG, "No tick hook slot on core %d, task switches not traced", core);
+        }
+    }
+
+    ESP_LOGI(TAG, "Tracing %lu events per core (%u bytes each)",
+             capacity, (unsigned)(capacity * sizeof(trace_slot_t)));
+    return ESP_OK;
+}
+
+uint8_t howdy_trace_track(const char *name)
+{
+    uint8_t id = 0;
+    portENTER_CRITICAL(&s_trace.track_lock);
+    if (s_trace.track_count + 1 < HOWDY_TRACE_MAX_TRACKS) {
+        id = ++s_trace.track_count;
+        strncpy(s_trace.tracks[id], name ? name : "track", HOWDY_TRACE_TRACK_NAME_LEN - 1);
+    }
+    portEXIT_CRITICAL(&s_trace.track_lock);
+    return id;
+}
+
+void howdy_trace_set_enabled(bool enabled)
+{
+    s_trace.enabled = enabled && s_trace.capacity != 0;
+}
+
+void howdy_trace_get_stats(howdy_trace_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    stats->capacity = s_trace.capacity;
+    stats->enabled = s_trace.enabled;
+    for (int core = 0; core < TRACE_CORES; core++) {
+        stats->recorded[core] = atomic_load_explicit(&s_trace.rings[core].head, memory_order_relaxed);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Dump
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    howdy_trace_write_fn_t write;
+    void *ctx;
+    char buf[TRACE_OUT_BUF];
+    size_t len;
+    esp_err_t err;
+} trace_out_t;
+
+static void out_flush(trace_out_t *out)
+{
+    if (out->len && out->err == ESP_OK) {
+        out->err = out->write(out->ctx, out->buf, out->len);
+    }
+    out->len = 0;
+}
+
+static void __attribute__((format(printf, 2, 3))) out_printf(trace_out_t *out, const char *fmt, ...)
+{
+    char line[192];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    if (n <= 0) {
+        return;
+    }
+    if ((size_t)n >= sizeof(line)) {
+        n = sizeof(line) - 1;
+    }
+    if (out->len + n > sizeof(out->buf)) {
+        out_flush(out);
+    }
+    memcpy(out->buf + out->len, line, n);
+    out->len += n;
+}
+
+// Copy the committed events of one ring, oldest first
+static size_t snapshot_ring(int core, trace_event_t *events)
+{
+    trace_ring_t *ring = &s_trace.rings[core];
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    uint32_t first = head > s_trace.capacity ? head - s_trace.capacity : 0;
+    size_t n = 0;
+
+    for (uint32_t idx = first; idx != head; idx++) {
+        trace_slot_t *slot = &ring->slots[idx & s_trace.mask];
+        uint32_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        trace_event_t ev = {
+            .ts = (int64_t)(((uint64_t)slot->ts_hi << 32) | slot->ts_lo),
+            .event = slot->event,
+            .core = (uint8_t)core,
+            .a0 = slot->a0,
+            .a1 = slot->a1,
+        };
+        atomic_thread_fence(memory_order_acquire);
+        // Skip slots still being written or already reused by a newer event
+        if (seq != idx + 1 || atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq) {
+            continue;
+        }
+        events[n++] = ev;
+    }
+    return n;
+}
+
+static const char *track_name(uint32_t id)
+{
+    return id > 0 && id < HOWDY_TRACE_MAX_TRACKS && s_trace.tracks[id][0] ? s_trace.tracks[id] : "track";
+}
+
+// Every event follows the metadata records, so each starts with a separator
+static void emit_event(trace_out_t *out, const trace_event_t *ev)
+{
+    const char *sep = ",\n";
+
+    switch (ev->event) {
+        case HOWDY_TRACE_STAGE:
+            out_printf(out, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%lld,\"dur\":%lu}",
+                       sep, track_name(ev->a0), (unsigned long)(TRACE_TID_TRACK + ev->a0),
+                       (long long)(ev->ts - ev->a1), (unsigned long)ev->a1);
+            break;
+        case HOWDY_TRACE_QUEUE_DEPTH:
+            out_printf(out, "%s{\"name\":\"%s queue\",\"ph\":\"C\",\"pid\":1,\"ts\":%lld,\"args\":{\"depth\":%lu}}",
+                       sep, track_name(ev->a0), (long long)ev->ts, (unsigned long)ev->a1);
+            break;
+        case HOWDY_TRACE_CAPTURE_FRAME:
+            out_printf(out, "%s{\"name\":\"capture\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%lld,"
+                       "\"args\":{\"seq\":%lu,\"ring\":%lu}}",
+                       sep, ev->core, (long long)ev->ts, (unsigned long)ev->a0, (unsigned long)ev->a1);
+            break;
+        case HOWDY_TRACE_PLAYOUT_FRAME:
+            out_printf(out, "%s{\"name\":\"jitter buffer\",\"ph\":\"C\",\"pid\":1,\"ts\":%lld,"
+                       "\"args\":{\"depth\":%lu,\"underrun\":%lu}}",
+                       sep, (long long)ev->ts, (unsigned long)ev->a0, (unsigned long)ev->a1);
+            break;
+        case HOWDY_TRACE_TTS_CHUNK:
+            out_printf(out, "%s{\"name\":\"tts chunk\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%lld,"
+                       "\"args\":{\"bytes\":%lu,\"us\":%lu}}",
+                       sep, ev->core, (long long)ev->ts, (unsigned long)ev->a0, (unsigned long)ev->a1);
+            break;
+        case HOWDY_TRACE_LATENCY_MARK:
+            out_printf(out, "%s{\"name\":\"latency mark\",\"ph\":\"i\",\"s\":\"p\",\"pid\":1,\"tid\":%u,\"ts\":%lld,"
+                       "\"args\":{\"point\":%lu}}",
+                       sep, ev->core, (long long)ev->ts, (unsigned long)ev->a0);
+            break;
+        case HOWDY_TRACE_DEADLINE_MISS:
+            out_printf(out, "%s{\"name\":\"deadline miss\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%lld,"
+                       "\"args\":{\"slot\":%lu,\"interval_us\":%lu}}",
+                       sep, ev->core, (long long)ev->ts, (unsigned long)ev->a0, (unsigned long)ev->a1);
+            break;
+        default:
+            out_printf(out, "%s{\"name\":\"event %u\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%lld,"
+                       "\"args\":{\"a0\":%lu,\"a1\":%lu}}",
+                       sep, ev->event, ev->core, (long long)ev->ts, (unsigned long)ev->a0, (unsigned long)ev->a1);
+            break;
+    }
+}
+
+esp_err_t howdy_trace_dump(howdy_trace_write_fn_t write, void *ctx)
+{
+    if (!write) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_trace.capacity) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    trace_event_t *events[HOWDY_TRACE_MAX_CORES] = { 0 };
+    size_t count[HOWDY_TRACE_MAX_CORES] = { 0 };
+    trace_out_t *out = howdy_mem_calloc(HOWDY_MEM_BULK, 1, sizeof(trace_out_t));
+    esp_err_t ret = out ? ESP_OK : ESP_ERR_NO_MEM;
+
+    for (int core = 0; core < TRACE_CORES && ret == ESP_OK; core++) {
+        events[core] = howdy_mem_alloc(HOWDY_MEM_BULK, s_trace.capacity * sizeof(trace_event_t));
+        if (!events[core]) {
+            ret = ESP_ERR_NO_MEM;
+            break;
+        }
+        count[core] = snapshot_ring(core, events[core]);
+    }
+    if (ret != ESP_OK) {
+        goto cleanup;
+    }
+
+    out->write = write;
+    out->ctx = ctx;
+    out->err = ESP_OK;
+
+    out_printf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+               "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"HowdyScreen\"}}");
+    for (int core = 0; core < TRACE_CORES; core++) {
+        out_printf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"core %d\"}}",
+                   core, core);
+    }
+    for (int id = 1; id < HOWDY_TRACE_MAX_TRACKS; id++) {
+        if (s_trace.tracks[id][0]) {
+            out_printf(out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                       TRACE_TID_TRACK + id, s_trace.tracks[id]);
+        }
+    }
+
+    // Merge the per-core rings by timestamp. A task switch closes the
+    // previous task's slice on that core, so slices never dangle.
+    size_t pos[HOWDY_TRACE_MAX_CORES] = { 0 };
+    int64_t run_start[HOWDY_TRACE_MAX_CORES] = { 0 };
+    char run_name[HOWDY_TRACE_MAX_CORES][9] = { { 0 } };
+    while (out->err == ESP_OK) {
+        int pick = -1;
+        for (int core = 0; core < TRACE_CORES; core++) {
+            if (pos[core] < count[core] &&
+                (pick < 0 || events[core][pos[core]].ts < events[pick][pos[pick]].ts)) {
+                pick = core;
+            }
+        }
+        if (pick < 0) {
+            break;
+        }
+
+        const trace_event_t *ev = &events[pick][pos[pick]++];
+        if (ev->event != HOWDY_TRACE_TASK_SWITCH) {
+            emit_event(out, ev);
+            continue;
+        }
+        if (run_name[pick][0]) {
+            out_printf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%lld,\"dur\":%lld}",
+                       run_name[pick], pick, (long long)run_start[pick], (long long)(ev->ts - run_start[pick]));
+        }
+        memcpy(run_name[pick], &ev->a0, 4);
+        memcpy(run_name[pick] + 4, &ev->a1, 4);
+        run_name[pick][8] = '\0';
+        // Task names are plain identifiers, but keep the JSON valid regardless
+        for (char *c = run_name[pick]; *c; c++) {
+            if (*c == '"' || *c == '\\' || (unsigned char)*c < 0x20) {
+                *c = '_';
+            }
+        }
+        run_start[pick] = ev->ts;
+    }
+    out_printf(out, "\n]}\n");
+    out_flush(out);
+    ret = out->err;
+
+cleanup:
+    for (int core = 0; core < TRACE_CORES; core++) {
+        howdy_mem_free(events[core]);
+    }
+    howdy_mem_free(out);
+    return ret;
+}
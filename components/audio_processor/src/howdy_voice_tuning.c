@@ -0,0 +1,48 @@
+#include "howdy_voice_tuning.h"
+
+esp_err_t howdy_voice_tuning_vad_config(uint16_t sample_rate, enhanced_vad_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = enhanced_vad_get_conversation_config(sample_rate, config);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Fine-tune for ESP32-P4 HowdyScreen environment and <50ms target latency
+    config->amplitude_threshold = 2300;          // Slightly more sensitive for faster response
+    config->silence_threshold_ms = 1000;         // 1.0s silence for faster conversation flow
+    config->min_voice_duration_ms = 250;         // 250ms minimum for balance of speed/accuracy
+    config->snr_threshold_db = 7.5f;             // Slightly lower SNR for faster response
+    config->consistency_frames = 4;              // Reduce consistency frames for speed
+    config->confidence_threshold = 0.65f;        // Balanced confidence for conversation flow
+    config->processing_mode = 1;                 // Optimized mode for performance
+    return ESP_OK;
+}
+
+esp_err_t howdy_voice_tuning_wake_word_config(esp32_p4_wake_word_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = esp32_p4_wake_word_get_conversation_config(config);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // Optimize for ESP32-P4 HowdyScreen and <50ms target latency
+    config->sample_rate = 16000;                 // 16kHz audio
+    config->frame_size = 320;                    // 20ms frames
+    config->energy_threshold = 2900;             // Slightly more sensitive for idle wake word detection
+    config->confidence_threshold = 0.62f;        // Lower confidence for faster response in conversation
+    config->silence_timeout_ms = 1600;           // Reduced timeout for conversation flow
+    config->enable_adaptation = true;            // Enable adaptive learning
+    config->adaptation_rate = 0.06f;             // Slightly faster adaptation
+    config->max_detections_per_min = 15;         // Allow more frequent detections in conversation
+    config->pattern_frames = 18;                 // Reduce pattern frames for speed
+    config->consistency_frames = 3;              // Reduce consistency for speed
+    return ESP_OK;
+}
@@ -0,0 +1,294 @@
+#include "i2s_dma_capture.h"
+#include "audio_frame_ring.h"
+#include "howdy_mem_placement.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_memory_utils.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "I2SDMACapture";
+
+typedef struct i2s_dma_capture_t {
+    i2s_dma_capture_config_t config;
+    audio_frame_ring_t *descs;          // i2s_dma_frame_t descriptors, ISR -> consumer
+    atomic_uint next_seq;               // Written by the producer only
+    TaskHandle_t volatile consumer;
+    bool running;
+
+    // Consumer-side statistics
+    uint32_t delivered;
+    uint32_t stale_skipped;
+    atomic_uint lapped;                 // Any task holding a descriptor may check it
+    uint32_t max_wake_us;
+    float avg_wake_us;
+
+    // Fake source
+    esp_timer_handle_t fake_timer;
+    int16_t *fake_pool;
+    uint32_t fake_index;
+} i2s_dma_capture_t;
+
+// The DMA may already be filling the buffer after the newest one it reported,
+// so a frame is safe while fewer than dma_desc_num - 1 newer ones exist
+static inline bool frame_is_stale(i2s_dma_capture_t *cap, uint32_t seq)
+{
+    uint32_t next = atomic_load_explicit(&cap->next_seq, memory_order_acquire);
+    return (next - seq) >= cap->config.dma_desc_num - 1;
+}
+
+// Producer side: ISR (woken != NULL) or esp_timer task (woken == NULL).
+// With CONFIG_I2S_ISR_IRAM_SAFE the ISR also runs while the flash cache is
+// off, so everything it calls must be in IRAM: this function, the ring's
+// producer side (linker.lf), esp_timer_get_time and the FreeRTOS ISR API.
+static void IRAM_ATTR publish_frame(i2s_dma_capture_t *cap, void *buf, size_t bytes, BaseType_t *woken)
+{
+    uint32_t seq = atomic_load_explicit(&cap->next_seq, memory_order_relaxed);
+    i2s_dma_frame_t frame = {
+        .samples = (int16_t *)buf,
+        .sample_count = bytes / sizeof(int16_t),
+        .seq = seq,
+        .timestamp_us = esp_timer_get_time(),
+    };
+
+    // Drops and counts the descriptor if the consumer is a full queue behind
+    audio_frame_ring_push(cap->descs, &frame, sizeof(frame));
+    atomic_store_explicit(&cap->next_seq, seq + 1, memory_order_release);
+
+    TaskHandle_t consumer = cap->consumer;
+    if (consumer) {
+        if (woken) {
+            vTaskNotifyGiveFromISR(consumer, woken);
+        } else {
+            xTaskNotifyGive(consumer);
+        }
+    }
+}
+
+static bool IRAM_ATTR on_dma_recv(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx)
+{
+    BaseType_t woken = pdFALSE;
+    publish_frame((i2s_dma_capture_t *)user_ctx, event->dma_buf, event->size, &woken);
+    return woken == pdTRUE;
+}
+
+static void fake_dma_timer_cb(void *arg)
+{
+    i2s_dma_capture_t *cap = (i2s_dma_capture_t *)arg;
+    size_t frame_samples = cap->config.frame_samples;
+    int16_t *buf = cap->fake_pool + (cap->fake_index++ % cap->config.dma_desc_num) * frame_samples;
+
+    if (cap->config.fake_fill) {
+        uint32_t seq = atomic_load_explicit(&cap->next_seq, memory_order_relaxed);
+        cap->config.fake_fill(buf, frame_samples, seq, cap->config.fake_ctx);
+    } else {
+        memset(buf, 0, frame_samples * sizeof(int16_t));
+    }
+
+    publish_frame(cap, buf, frame_samples * sizeof(int16_t), NULL);
+}
+
+esp_err_t i2s_dma_capture_create(const i2s_dma_capture_config_t *config, i2s_dma_capture_handle_t *out_capture)
+{
+    if (!config || !out_capture || config->dma_desc_num < 3) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->source == I2S_DMA_SOURCE_I2S && !config->rx_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (config->source == I2S_DMA_SOURCE_FAKE && (config->sample_rate == 0 || config->frame_samples == 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2s_dma_capture_t *cap = (i2s_dma_capture_t *)howdy_mem_calloc(HOWDY_MEM_HOT, 1, sizeof(i2s_dma_capture_t));
+    if (!cap) {
+        return ESP_ERR_NO_MEM;
+    }
+    cap->config = *config;
+    atomic_init(&cap->next_seq, 0);
+    atomic_init(&cap->lapped, 0);
+
+    // Twice the DMA ring: anything older than that is stale anyway
+    cap->descs = audio_frame_ring_create(sizeof(i2s_dma_frame_t), config->dma_desc_num * 2);
+    if (!cap->descs) {
+        howdy_mem_free(cap);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // The ISR touches both; PSRAM (a HOT placement override) is unreachable with the cache off
+    if (config->source == I2S_DMA_SOURCE_I2S && (!esp_ptr_internal(cap) || !esp_ptr_internal(cap->descs))) {
+        ESP_LOGE(TAG, "Capture state must be in internal RAM for the DMA ISR");
+        audio_frame_ring_destroy(cap->descs);
+        howdy_mem_free(cap);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t ret = ESP_OK;
+    if (config->source == I2S_DMA_SOURCE_I2S) {
+        i2s_event_callbacks_t cbs = {
+            .on_recv = on_dma_recv,
+        };
+        ret = i2s_channel_register_event_callback(config->rx_handle, &cbs, cap);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to register on_recv callback: %s", esp_err_to_name(ret));
+        }
+    } else {
+        cap->fake_pool = (int16_t *)howdy_mem_calloc(HOWDY_MEM_DMA, config->dma_desc_num * config->frame_samples, sizeof(int16_t));
+        const esp_timer_create_args_t timer_args = {
+            .callback = fake_dma_timer_cb,
+            .arg = cap,
+            .name = "fake_dma",
+        };
+        ret = cap->fake_pool ? esp_timer_create(&timer_args, &cap->fake_timer) : ESP_ERR_NO_MEM;
+    }
+
+    if (ret != ESP_OK) {
+        howdy_mem_free(cap->fake_pool);
+        audio_frame_ring_destroy(cap->descs);
+        howdy_mem_free(cap);
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "DMA capture ready (%s source, %lu buffers)",
+             config->source == I2S_DMA_SOURCE_I2S ? "I2S" : "fake", config->dma_desc_num);
+    *out_capture = cap;
+    return ESP_OK;
+}
+
+esp_err_t i2s_dma_capture_destroy(i2s_dma_capture_handle_t capture)
+{
+    if (!capture) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2s_dma_capture_stop(capture);
+
+    if (capture->config.source == I2S_DMA_SOURCE_I2S) {
+        i2s_event_callbacks_t none = {0};
+        i2s_channel_register_event_callback(capture->config.rx_handle, &none, NULL);
+    } else {
+        esp_timer_delete(capture->fake_timer);
+        howdy_mem_free(capture->fake_pool);
+    }
+
+    audio_frame_ring_destroy(capture->descs);
+    howdy_mem_free(capture);
+    return ESP_OK;
+}
+
+esp_err_t i2s_dma_capture_start(i2s_dma_capture_handle_t capture)
+{
+    if (!capture) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (capture->running) {
+        return ESP_OK;
+    }
+
+    // Descriptors left from a previous run point at recycled buffers
+    audio_frame_ring_reset(capture->descs);
+
+    if (capture->config.source == I2S_DMA_SOURCE_I2S) {
+        ESP_RETURN_ON_ERROR(i2s_channel_enable(capture->config.rx_handle), TAG, "Failed to enable RX channel");
+    } else {
+        uint64_t period_us = (uint64_t)capture->config.frame_samples * 1000000ULL / capture->config.sample_rate;
+        ESP_RETURN_ON_ERROR(esp_timer_start_periodic(capture->fake_timer, period_us), TAG, "Failed to start fake DMA");
+    }
+
+    capture->running = true;
+    return ESP_OK;
+}
+
+esp_err_t i2s_dma_capture_stop(i2s_dma_capture_handle_t capture)
+{
+    if (!capture) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!capture->running) {
+        return ESP_OK;
+    }
+
+    capture->running = false;
+    if (capture->config.source == I2S_DMA_SOURCE_I2S) {
+        return i2s_channel_disable(capture->config.rx_handle);
+    }
+    return esp_timer_stop(capture->fake_timer);
+}
+
+esp_err_t i2s_dma_capture_subscribe(i2s_dma_capture_handle_t capture, TaskHandle_t task)
+{
+    if (!capture) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    capture->consumer = task ? task : xTaskGetCurrentTaskHandle();
+    return ESP_OK;
+}
+
+esp_err_t i2s_dma_capture_acquire(i2s_dma_capture_handle_t capture, i2s_dma_frame_t *frame, uint32_t timeout_ms)
+{
+    if (!capture || !frame) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!capture->consumer) {
+        capture->consumer = xTaskGetCurrentTaskHandle();
+    }
+
+    for (;;) {
+        i2s_dma_frame_t next;
+        while (audio_frame_ring_pop(capture->descs, &next, NULL)) {
+            if (frame_is_stale(capture, next.seq)) {
+                capture->stale_skipped++;
+                continue;
+            }
+
+            uint32_t wake_us = (uint32_t)(esp_timer_get_time() - next.timestamp_us);
+            if (wake_us > capture->max_wake_us) {
+                capture->max_wake_us = wake_us;
+            }
+            capture->avg_wake_us += ((float)wake_us - capture->avg_wake_us) / 16.0f;
+            capture->delivered++;
+
+            *frame = next;
+            return ESP_OK;
+        }
+
+        // Notifications taken here may belong to descriptors already popped; harmless
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms)) == 0) {
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+}
+
+bool i2s_dma_capture_release(i2s_dma_capture_handle_t capture, const i2s_dma_frame_t *frame)
+{
+    if (!capture || !frame) {
+        return false;
+    }
+    if (frame_is_stale(capture, frame->seq)) {
+        atomic_fetch_add_explicit(&capture->lapped, 1, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+esp_err_t i2s_dma_capture_get_stats(i2s_dma_capture_handle_t capture, i2s_dma_capture_stats_t *stats)
+{
+    if (!capture || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    audio_frame_ring_stats_t ring_stats;
+    audio_frame_ring_get_stats(capture->descs, &ring_stats);
+
+    stats->frames = atomic_load_explicit(&capture->next_seq, memory_order_relaxed);
+    stats->delivered = capture->delivered;
+    stats->queue_overruns = ring_stats.overruns;
+    stats->stale_skipped = capture->stale_skipped;
+    stats->lapped = atomic_load_explicit(&capture->lapped, memory_order_relaxed);
+    stats->max_wake_us = capture->max_wake_us;
+    stats->avg_wake_us = capture->avg_wake_us;
+    return ESP_OK;
+}
@@ -0,0 +1,519 @@
+#include "rtp_session.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define RTP_SEQ_MOD         (1u << 16)
+#define RTP_MAX_DROPOUT     3000
+#define RTP_MAX_MISORDER    100
+#define RTP_EXT_ELEM_LEN    10
+#define NTP_UNIX_OFFSET     2208988800u
+#define RTCP_CNAME_MAX      32
+
+typedef struct rtp_session_t {
+    rtp_session_config_t config;
+    char cname[RTCP_CNAME_MAX];
+
+    // Sender state
+    uint16_t next_seq;
+    uint32_t next_ts;
+    uint32_t packets_at_last_report;
+    uint64_t last_rtcp_us;
+    bool rtcp_sent;
+
+    // Receiver state for the remote SSRC (RFC 3550 A.1/A.3/A.8)
+    bool have_remote;
+    uint16_t max_seq;
+    uint32_t cycles;
+    uint32_t base_seq;
+    uint32_t bad_seq;
+    uint32_t received;
+    uint32_t expected_prior;
+    uint32_t received_prior;
+    uint32_t last_transit;
+    bool have_transit;
+    uint32_t jitter_q4;             // Jitter in timestamp units * 16
+
+    // Last SR received from the peer, echoed in our report block
+    uint32_t remote_lsr;
+    uint64_t remote_sr_arrival_us;
+
+    rtp_session_stats_t stats;
+} rtp_session_t;
+
+static inline void put_be16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v >> 8);
+    p[1] = (uint8_t)v;
+}
+
+static inline void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint16_t get_be16(const uint8_t *p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static inline uint32_t get_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Monotonic clock expressed as NTP seconds/fraction; only differences matter for RTT
+static void us_to_ntp(uint64_t us, uint32_t *sec, uint32_t *frac)
+{
+    *sec = (uint32_t)(us / 1000000ULL) + NTP_UNIX_OFFSET;
+    *frac = (uint32_t)(((us % 1000000ULL) << 32) / 1000000ULL);
+}
+
+static uint32_t ntp_middle(uint64_t us)
+{
+    uint32_t sec, frac;
+    us_to_ntp(us, &sec, &frac);
+    return (sec << 16) | (frac >> 16);
+}
+
+static float ts_units_to_ms(const rtp_session_t *s, uint32_t units)
+{
+    return (float)units * 1000.0f / (float)s->config.clock_rate;
+}
+
+rtp_session_t *rtp_session_create(const rtp_session_config_t *config)
+{
+    if (!config || config->clock_rate == 0) return NULL;
+
+    rtp_session_t *s = (rtp_session_t *)calloc(1, sizeof(*s));
+    if (!s) return NULL;
+
+    s->config = *config;
+    if (s->config.payload_type == 0) s->config.payload_type = RTP_PAYLOAD_TYPE_L16;
+    if (config->cname) {
+        strncpy(s->cname, config->cname, sizeof(s->cname) - 1);
+    }
+    s->config.cname = s->cname;
+
+    // Initial sequence and timestamp are derived from the (random) SSRC
+    s->next_seq = (uint16_t)(config->ssrc ^ (config->ssrc >> 16));
+    s->next_ts = config->ssrc * 2654435761u;
+    s->stats.ssrc = config->ssrc;
+    return s;
+}
+
+void rtp_session_destroy(rtp_session_t *session)
+{
+    free(session);
+}
+
+static uint8_t *put_vad_ext(uint8_t *p, const rtp_vad_ext_t *vad)
+{
+    *p++ = (RTP_EXT_ID_VAD << 4) | (RTP_EXT_ELEM_LEN - 1);
+    *p++ = vad->vad_flags;
+    *p++ = vad->vad_confidence;
+    *p++ = vad->detection_quality;
+    *p++ = vad->snr_db_scaled;
+    put_be16(p, vad->max_amplitude);      p += 2;
+    put_be16(p, vad->noise_floor);        p += 2;
+    put_be16(p, vad->zero_crossing_rate); p += 2;
+    return p;
+}
+
+static uint8_t *put_wake_word_ext(uint8_t *p, const rtp_wake_word_ext_t *ww)
+{
+    *p++ = (RTP_EXT_ID_WAKE_WORD << 4) | (RTP_EXT_ELEM_LEN - 1);
+    put_be32(p, ww->detection_id); p += 4;
+    *p++ = ww->flags;
+    *p++ = ww->confidence;
+    put_be16(p, ww->pattern_match_score); p += 2;
+    *p++ = ww->syllable_count;
+    *p++ = ww->detection_duration_ms;
+    return p;
+}
+
+size_t rtp_session_build_packet(rtp_session_t *session,
+                                const int16_t *samples, size_t sample_count,
+                                const rtp_vad_ext_t *vad,
+                                const rtp_wake_word_ext_t *wake_word,
+                                bool marker,
+                                uint8_t *buf, size_t buf_len)
+{
+    if (!session || !samples || sample_count == 0 || !buf) return 0;
+
+    size_t ext_data = (vad ? RTP_EXT_ELEM_LEN + 1 : 0) + (wake_word ? RTP_EXT_ELEM_LEN + 1 : 0);
+    size_t ext_words = (ext_data + 3) / 4;
+    size_t ext_len = ext_data ? 4 + ext_words * 4 : 0;
+    size_t payload_len = sample_count * sizeof(int16_t);
+    size_t total = RTP_HEADER_SIZE + ext_len + payload_len;
+    if (total > buf_len) return 0;
+
+    uint8_t *p = buf;
+    *p++ = (RTP_VERSION << 6) | (ext_len ? 0x10 : 0x00);
+    *p++ = (marker ? 0x80 : 0x00) | (session->config.payload_type & 0x7F);
+    put_be16(p, session->next_seq); p += 2;
+    put_be32(p, session->next_ts);  p += 4;
+    put_be32(p, session->config.ssrc); p += 4;
+
+    if (ext_len) {
+        uint8_t *ext_start = p;
+        put_be16(p, RTP_EXT_PROFILE_ONE_BYTE); p += 2;
+        put_be16(p, (uint16_t)ext_words);      p += 2;
+        if (vad) p = put_vad_ext(p, vad);
+        if (wake_word) p = put_wake_word_ext(p, wake_word);
+        while ((size_t)(p - ext_start) < ext_len) *p++ = 0; // padding
+    }
+
+    // L16 is network byte order
+    for (size_t i = 0; i < sample_count; i++) {
+        put_be16(p, (uint16_t)samples[i]);
+        p += 2;
+    }
+
+    session->next_seq++;
+    session->next_ts += (uint32_t)sample_count;
+    session->stats.packets_sent++;
+    session->stats.octets_sent += (uint32_t)payload_len;
+    return total;
+}
+
+static void init_seq(rtp_session_t *s, uint16_t seq)
+{
+    s->base_seq = seq;
+    s->max_seq = seq;
+    s->bad_seq = RTP_SEQ_MOD + 1;
+    s->cycles = 0;
+    s->received = 0;
+    s->received_prior = 0;
+    s->expected_prior = 0;
+    s->have_transit = false;
+    s->jitter_q4 = 0;
+}
+
+// RFC 3550 A.1 without probation; returns false for packets that restart tracking
+static bool update_seq(rtp_session_t *s, uint16_t seq)
+{
+    uint16_t udelta = (uint16_t)(seq - s->max_seq);
+
+    if (udelta < RTP_MAX_DROPOUT) {
+        if (seq < s->max_seq) {
+            s->cycles += RTP_SEQ_MOD;
+        }
+        s->max_seq = seq;
+    } else if (udelta <= RTP_SEQ_MOD - RTP_MAX_MISORDER) {
+        if (seq == s->bad_seq) {
+            // Two sequential packets after a big jump: the sender restarted
+            init_seq(s, seq);
+        } else {
+            s->bad_seq = (seq + 1) & (RTP_SEQ_MOD - 1);
+            return false;
+        }
+    }
+    // else duplicate or reordered packet
+    s->received++;
+    return true;
+}
+
+static bool parse_extensions(const uint8_t *p, size_t len, rtp_packet_info_t *info)
+{
+    size_t i = 0;
+    while (i < len) {
+        uint8_t b = p[i];
+        if (b == 0) { i++; continue; }          // padding
+        uint8_t id = b >> 4;
+        size_t elen = (b & 0x0F) + 1;
+        if (id == 15) break;
+        if (i + 1 + elen > len) return false;
+        const uint8_t *d = p + i + 1;
+
+        if (id == RTP_EXT_ID_VAD && elen == RTP_EXT_ELEM_LEN) {
+            info->has_vad = true;
+            info->vad.vad_flags = d[0];
+            info->vad.vad_confidence = d[1];
+            info->vad.detection_quality = d[2];
+            info->vad.snr_db_scaled = d[3];
+            info->vad.max_amplitude = get_be16(d + 4);
+            info->vad.noise_floor = get_be16(d + 6);
+            info->vad.zero_crossing_rate = get_be16(d + 8);
+        } else if (id == RTP_EXT_ID_WAKE_WORD && elen == RTP_EXT_ELEM_LEN) {
+            info->has_wake_word = true;
+            info->wake_word.detection_id = get_be32(d);
+            info->wake_word.flags = d[4];
+            info->wake_word.confidence = d[5];
+            info->wake_word.pattern_match_score = get_be16(d + 6);
+            info->wake_word.syllable_count = d[8];
+            info->wake_word.detection_duration_ms = d[9];
+        }
+        i += 1 + elen;
+    }
+    return true;
+}
+
+bool rtp_session_parse_packet(rtp_session_t *session, uint8_t *packet, size_t len,
+                              uint64_t arrival_us, rtp_packet_info_t *info)
+{
+    if (!session || !packet || !info) return false;
+    memset(info, 0, sizeof(*info));
+
+    if (len < RTP_HEADER_SIZE || (packet[0] >> 6) != RTP_VERSION || rtp_is_rtcp(packet, len)) {
+        session->stats.bad_packets++;
+        return false;
+    }
+
+    bool has_padding = packet[0] & 0x20;
+    bool has_ext = packet[0] & 0x10;
+    size_t csrc_count = packet[0] & 0x0F;
+    size_t off = RTP_HEADER_SIZE + csrc_count * 4;
+    size_t end = len;
+
+    // The CSRC list must fit before len - off is used below
+    if (off > len) {
+        session->stats.bad_packets++;
+        return false;
+    }
+    if (has_padding) {
+        uint8_t pad = packet[len - 1];
+        if (pad == 0 || pad > len - off) {
+            session->stats.bad_packets++;
+            return false;
+        }
+        end -= pad;
+    }
+
+    if (has_ext) {
+        if (off + 4 > end) {
+            session->stats.bad_packets++;
+            return false;
+        }
+        uint16_t profile = get_be16(packet + off);
+        size_t ext_len = (size_t)get_be16(packet + off + 2) * 4;
+        off += 4;
+        if (off + ext_len > end) {
+            session->stats.bad_packets++;
+            return false;
+        }
+        if (profile == RTP_EXT_PROFILE_ONE_BYTE && !parse_extensions(packet + off, ext_len, info)) {
+            session->stats.bad_packets++;
+            return false;
+        }
+        off += ext_len;
+    }
+
+    size_t payload_len = end - off;
+    if (payload_len % 2 != 0) {
+        session->stats.bad_packets++;
+        return false;
+    }
+
+    info->marker = packet[1] & 0x80;
+    info->sequence = get_be16(packet + 2);
+    info->timestamp = get_be32(packet + 4);
+    info->ssrc = get_be32(packet + 8);
+
+    // L16 payload back to host order, in place
+    uint8_t *payload = packet + off;
+    for (size_t i = 0; i < payload_len; i += 2) {
+        uint16_t v = get_be16(payload + i);
+        memcpy(payload + i, &v, sizeof(v));
+    }
+    info->samples = (int16_t *)payload;
+    info->sample_count = payload_len / 2;
+
+    // Receiver statistics
+    if (!session->have_remote || info->ssrc != session->stats.remote_ssrc) {
+        session->have_remote = true;
+        session->stats.remote_ssrc = info->ssrc;
+        init_seq(session, info->sequence);
+        session->max_seq = info->sequence - 1;
+    }
+    if (!update_seq(session, info->sequence)) {
+        return true;
+    }
+    session->stats.packets_received++;
+
+    uint32_t arrival_ts = (uint32_t)((arrival_us * session->config.clock_rate) / 1000000ULL);
+    uint32_t transit = arrival_ts - info->timestamp;
+    if (session->have_transit) {
+        int32_t d = (int32_t)(transit - session->last_transit);
+        if (d < 0) d = -d;
+        session->jitter_q4 += (uint32_t)d - ((session->jitter_q4 + 8) >> 4);
+    }
+    session->last_transit = transit;
+    session->have_transit = true;
+    session->stats.jitter_ms = ts_units_to_ms(session, session->jitter_q4 >> 4);
+    return true;
+}
+
+static uint8_t *put_report_block(rtp_session_t *s, uint8_t *p, uint64_t now_us)
+{
+    uint32_t extended_max = s->cycles + s->max_seq;
+    uint32_t expected = extended_max - s->base_seq + 1;
+    int32_t lost = (int32_t)(expected - s->received);
+    if (lost > 0x7FFFFF) lost = 0x7FFFFF;
+    if (lost < -0x800000) lost = -0x800000;
+
+    uint32_t expected_interval = expected - s->expected_prior;
+    uint32_t received_interval = s->received - s->received_prior;
+    int32_t lost_interval = (int32_t)(expected_interval - received_interval);
+    uint8_t fraction = 0;
+    if (expected_interval != 0 && lost_interval > 0) {
+        fraction = (uint8_t)(((uint32_t)lost_interval << 8) / expected_interval);
+    }
+    s->expected_prior = expected;
+    s->received_prior = s->received;
+
+    s->stats.packets_expected = expected;
+    s->stats.cumulative_lost = lost;
+    s->stats.fraction_lost = fraction;
+
+    uint32_t dlsr = 0;
+    if (s->remote_lsr != 0) {
+        dlsr = (uint32_t)(((now_us - s->remote_sr_arrival_us) << 16) / 1000000ULL);
+    }
+
+    put_be32(p, s->stats.remote_ssrc); p += 4;
+    put_be32(p, ((uint32_t)fraction << 24) | ((uint32_t)lost & 0xFFFFFF)); p += 4;
+    put_be32(p, extended_max); p += 4;
+    put_be32(p, s->jitter_q4 >> 4); p += 4;
+    put_be32(p, s->remote_lsr); p += 4;
+    put_be32(p, dlsr); p += 4;
+    return p;
+}
+
+size_t rtp_session_build_rtcp(rtp_session_t *session, uint64_t now_us, uint8_t *buf, size_t buf_len)
+{
+    if (!session || !buf) return 0;
+
+    bool is_sr = session->stats.packets_sent != session->packets_at_last_report;
+    uint8_t rc = session->have_remote ? 1 : 0;
+    size_t report_len = (is_sr ? 28 : 8) + rc * 24;
+
+    size_t cname_len = strlen(session->cname);
+    size_t sdes_len = 8 + 2 + cname_len + 1;    // header + ssrc + item + at least one null
+    sdes_len = (sdes_len + 3) & ~(size_t)3;
+
+    if (report_len + sdes_len > buf_len) return 0;
+
+    uint8_t *p = buf;
+    *p++ = (RTP_VERSION << 6) | rc;
+    *p++ = is_sr ? RTCP_PT_SR : RTCP_PT_RR;
+    put_be16(p, (uint16_t)(report_len / 4 - 1)); p += 2;
+    put_be32(p, session->config.ssrc); p += 4;
+
+    if (is_sr) {
+        uint32_t sec, frac;
+        us_to_ntp(now_us, &sec, &frac);
+        put_be32(p, sec);  p += 4;
+        put_be32(p, frac); p += 4;
+        // Streaming is continuous, so the next packet's timestamp tracks "now"
+        put_be32(p, session->next_ts); p += 4;
+        put_be32(p, session->stats.packets_sent); p += 4;
+        put_be32(p, session->stats.octets_sent);  p += 4;
+        session->packets_at_last_report = session->stats.packets_sent;
+    }
+    if (rc) {
+        p = put_report_block(session, p, now_us);
+    }
+
+    // SDES with CNAME
+    uint8_t *sdes = p;
+    *p++ = (RTP_VERSION << 6) | 1;
+    *p++ = RTCP_PT_SDES;
+    put_be16(p, (uint16_t)(sdes_len / 4 - 1)); p += 2;
+    put_be32(p, session->config.ssrc); p += 4;
+    *p++ = RTCP_SDES_CNAME;
+    *p++ = (uint8_t)cname_len;
+    memcpy(p, session->cname, cname_len); p += cname_len;
+    while ((size_t)(p - sdes) < sdes_len) *p++ = 0;
+
+    session->last_rtcp_us = now_us;
+    session->rtcp_sent = true;
+    session->stats.reports_sent++;
+    return report_len + sdes_len;
+}
+
+static void handle_report_block(rtp_session_t *s, const uint8_t *b, uint64_t now_us)
+{
+    if (get_be32(b) != s->config.ssrc) return;
+
+    uint32_t lost_word = get_be32(b + 4);
+    int32_t cum = (int32_t)(lost_word & 0xFFFFFF);
+    if (cum & 0x800000) cum -= 0x1000000;
+
+    s->stats.remote_fraction_lost = (uint8_t)(lost_word >> 24);
+    s->stats.remote_cumulative_lost = cum;
+    s->stats.remote_jitter_ms = ts_units_to_ms(s, get_be32(b + 12));
+    s->stats.reports_received++;
+
+    uint32_t lsr = get_be32(b + 16);
+    uint32_t dlsr = get_be32(b + 20);
+    if (lsr != 0) {
+        uint32_t rtt = ntp_middle(now_us) - lsr - dlsr;
+        if (rtt < 0x80000000u) {
+            s->stats.rtt_ms = (float)rtt * 1000.0f / 65536.0f;
+        }
+    }
+}
+
+bool rtp_session_handle_rtcp(rtp_session_t *session, const uint8_t *packet, size_t len, uint64_t now_us)
+{
+    if (!session || !packet) return false;
+
+    bool any = false;
+    size_t off = 0;
+    while (off + 4 <= len) {
+        const uint8_t *p = packet + off;
+        if ((p[0] >> 6) != RTP_VERSION) break;
+        uint8_t count = p[0] & 0x1F;
+        uint8_t pt = p[1];
+        size_t plen = ((size_t)get_be16(p + 2) + 1) * 4;
+        if (off + plen > len) break;
+
+        size_t blocks = 0;
+        if (pt == RTCP_PT_SR && plen >= 28) {
+            uint32_t sec = get_be32(p + 8);
+            uint32_t frac = get_be32(p + 12);
+            session->remote_lsr = (sec << 16) | (frac >> 16);
+            session->remote_sr_arrival_us = now_us;
+            blocks = 28;
+        } else if (pt == RTCP_PT_RR && plen >= 8) {
+            blocks = 8;
+        }
+
+        if (blocks) {
+            for (uint8_t i = 0; i < count && blocks + 24 <= plen; i++, blocks += 24) {
+                handle_report_block(session, p + blocks, now_us);
+            }
+        }
+        any = true;
+        off += plen;
+    }
+
+    if (!any) session->stats.bad_packets++;
+    return any;
+}
+
+bool rtp_session_rtcp_due(const rtp_session_t *session, uint64_t now_us)
+{
+    if (!session) return false;
+    if (!session->rtcp_sent) return true;
+    return now_us - session->last_rtcp_us >= (uint64_t)RTCP_REPORT_INTERVAL_MS * 1000ULL;
+}
+
+bool rtp_is_rtcp(const uint8_t *packet, size_t len)
+{
+    if (!packet || len < 2) return false;
+    return packet[1] >= 192 && packet[1] <= 223;
+}
+
+void rtp_session_get_stats(const rtp_session_t *session, rtp_session_stats_t *stats)
+{
+    if (!stats) return;
+    if (!session) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = session->stats;
+}
@@ -1,5 +1,8 @@
 #include "stt_audio_handler.h"
 #include "audio_processor.h"
+#include "howdy_heap_tags.h"
+#include "howdy_mem_placement.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -89,7 +92,8 @@ esp_err_t stt_audio_init(const stt_audio_config_t *config,
     
     // Allocate audio buffer for processing
     s_stt_audio.buffer_size = config->chunk_size;
-    s_stt_audio.audio_buffer = malloc(s_stt_audio.buffer_size * sizeof(float));
+    s_stt_audio.audio_buffer = HOWDY_MALLOC(HOWDY_HEAP_TAG_AUDIO, s_stt_audio.buffer_size * sizeof(float),
+                                         howdy_mem_caps(HOWDY_MEM_HOT));
     if (!s_stt_audio.audio_buffer) {
         ESP_LOGE(TAG, "Failed to allocate audio buffer");
         vSemaphoreDelete(s_stt_audio.state_mutex);
@@ -101,7 +105,7 @@ esp_err_t stt_audio_init(const stt_audio_config_t *config,
                                         pdFALSE, NULL, vad_timer_callback);
     if (!s_stt_audio.vad_timer) {
         ESP_LOGE(TAG, "Failed to create VAD timer");
-        free(s_stt_audio.audio_buffer);
+        HOWDY_FREE(s_stt_audio.audio_buffer);
         vSemaphoreDelete(s_stt_audio.state_mutex);
         return ESP_ERR_NO_MEM;
     }
@@ -120,7 +124,7 @@ esp_err_t stt_audio_init(const stt_audio_config_t *config,
     if (task_ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create STT capture task");
         xTimerDelete(s_stt_audio.vad_timer, 0);
-        free(s_stt_audio.audio_buffer);
+        HOWDY_FREE(s_stt_audio.audio_buffer);
         vSemaphoreDelete(s_stt_audio.state_mutex);
         return ESP_ERR_NO_MEM;
     }
@@ -169,7 +173,7 @@ esp_err_t stt_audio_deinit(void)
     }
     
     if (s_stt_audio.audio_buffer) {
-        free(s_stt_audio.audio_buffer);
+        HOWDY_FREE(s_stt_audio.audio_buffer);
         s_stt_audio.audio_buffer = NULL;
     }
     
@@ -197,10 +201,19 @@ esp_err_t stt_audio_start_capture(void)
     if (!s_stt_audio.capturing) {
         ESP_LOGI(TAG, "Starting STT audio capture");
         
+        // The capture task is the single consumer of captured frames
+        esp_err_t ret = audio_processor_subscribe_buffer(s_stt_audio.capture_task_handle);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Microphone frames are taken by another consumer");
+            xSemaphoreGive(s_stt_audio.state_mutex);
+            return ret;
+        }
+        
         // Start audio processor capture
-        esp_err_t ret = audio_processor_start_capture();
+        ret = audio_processor_start_capture();
         if (ret != ESP_OK) {
             ESP_LOGE(TAG, "Failed to start audio processor capture: %s", esp_err_to_name(ret));
+            audio_processor_unsubscribe_buffer(s_stt_audio.capture_task_handle);
             xSemaphoreGive(s_stt_audio.state_mutex);
             return ret;
         }
@@ -241,6 +254,7 @@ esp_err_t stt_audio_stop_capture(void)
         
         // Stop audio processor capture
         audio_processor_stop_capture();
+        audio_processor_unsubscribe_buffer(s_stt_audio.capture_task_handle);
         
         notify_event(STT_AUDIO_EVENT_STOPPED, NULL, 0, NULL);
     }
@@ -362,8 +376,8 @@ static void stt_capture_task(void *pvParameters)
     
     while (1) {
         if (s_stt_audio.capturing) {
-            // Get audio buffer from processor
-            esp_err_t ret = audio_processor_get_buffer(&audio_buffer, &buffer_length);
+            // Wait for the capture task to publish a frame (notified, no polling)
+            esp_err_t ret = audio_processor_wait_buffer(&audio_buffer, &buffer_length, 100);
             if (ret == ESP_OK && audio_buffer && buffer_length > 0) {
                 
                 // Process audio data
@@ -430,14 +444,15 @@ static void stt_capture_task(void *pvParameters)
                 ESP_LOGD(TAG, "STT chunk: %zu bytes, RMS: %.3f, Voice: %s", 
                         buffer_length, rms_level, s_stt_audio.voice_detected ? "YES" : "NO");
                 
-            } else if (ret != ESP_ERR_TIMEOUT) {
+            } else if (ret != ESP_ERR_TIMEOUT && s_stt_audio.capturing) {
+                // (INVALID_STATE is expected once stop_capture has unsubscribed us)
                 ESP_LOGW(TAG, "Failed to get audio buffer: %s", esp_err_to_name(ret));
                 notify_event(STT_AUDIO_EVENT_ERROR, (const uint8_t*)&ret, sizeof(ret), NULL);
             }
+        } else {
+            // Idle until the microphone is switched on
+            vTaskDelay(pdMS_TO_TICKS(10));
         }
-        
-        // Short delay to prevent busy waiting
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
     
     ESP_LOGI(TAG, "STT capture task ended");
@@ -1,8 +1,15 @@
 #include "tts_audio_handler.h"
 #include "audio_processor.h"
 #include "dual_i2s_manager.h"
+#include "howdy_memory_pool.h"
+#include "howdy_heap_tags.h"
+#include "howdy_mem_placement.h"
+#include "howdy_latency.h"
+#include "howdy_trace.h"
+#include "howdy_sched_monitor.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -23,6 +30,7 @@ static struct {
     // Audio processing
     QueueHandle_t audio_queue;
     TaskHandle_t playback_task_handle;
+    howdy_sched_handle_t playback_sched;
     SemaphoreHandle_t state_mutex;
     
     // Statistics
@@ -37,11 +45,7 @@ static struct {
 #define MAX_TTS_HANDLER_CHUNK_SIZE 1024
 
 // Pre-allocated audio chunk pool for zero-malloc TTS processing
-static struct {
-    uint8_t buffer[MAX_TTS_HANDLER_CHUNK_SIZE];
-    bool in_use;
-    uint64_t alloc_time;
-} s_tts_handler_chunk_pool[TTS_HANDLER_CHUNK_POOL_SIZE] = {0};
+static howdy_pool_t *s_tts_handler_chunk_pool = NULL;
 
 // Performance metrics for TTS handler
 static struct {
@@ -62,6 +66,7 @@ typedef struct {
 } tts_audio_chunk_t;
 
 // Forward declarations
+static void release_chunk(const tts_audio_chunk_t *chunk);
 static void tts_playback_task(void *pvParameters);
 static esp_err_t apply_volume(uint8_t *audio_data, size_t length, float volume);
 static void notify_event(tts_audio_event_t event, const void *data, size_t data_len);
@@ -91,6 +96,18 @@ esp_err_t tts_audio_init(const tts_audio_config_t *config,
     s_tts_audio.callback = callback;
     s_tts_audio.user_data = user_data;
     
+    if (!s_tts_handler_chunk_pool) {
+        howdy_pool_config_t pool_cfg = {
+            .name = "tts_handler",
+            .block_size = MAX_TTS_HANDLER_CHUNK_SIZE,
+            .block_count = TTS_HANDLER_CHUNK_POOL_SIZE,
+            .caps = howdy_mem_caps(HOWDY_MEM_BULK),
+        };
+        if (howdy_pool_create(&pool_cfg, &s_tts_handler_chunk_pool) != ESP_OK) {
+            ESP_LOGW(TAG, "Chunk pool unavailable, TTS chunks will use malloc");
+        }
+    }
+    
     // Create mutex for state protection
     s_tts_audio.state_mutex = xSemaphoreCreateMutex();
     if (!s_tts_audio.state_mutex) {
@@ -149,6 +166,8 @@ esp_err_t tts_audio_deinit(void)
     
     // Delete task
     if (s_tts_audio.playback_task_handle) {
+        howdy_sched_unregister(s_tts_audio.playback_sched);
+        s_tts_audio.playback_sched = NULL;
         vTaskDelete(s_tts_audio.playback_task_handle);
         s_tts_audio.playback_task_handle = NULL;
     }
@@ -158,7 +177,7 @@ esp_err_t tts_audio_deinit(void)
         // Clear any remaining audio chunks
         tts_audio_chunk_t chunk;
         while (xQueueReceive(s_tts_audio.audio_queue, &chunk, 0) == pdTRUE) {
-            free(chunk.data);
+            release_chunk(&chunk);
         }
         vQueueDelete(s_tts_audio.audio_queue);
         s_tts_audio.audio_queue = NULL;
@@ -169,6 +188,10 @@ esp_err_t tts_audio_deinit(void)
         s_tts_audio.state_mutex = NULL;
     }
     
+    if (s_tts_handler_chunk_pool && howdy_pool_destroy(s_tts_handler_chunk_pool) == ESP_OK) {
+        s_tts_handler_chunk_pool = NULL;
+    }
+    
     s_tts_audio.initialized = false;
     ESP_LOGI(TAG, "TTS audio handler deinitialized");
     
@@ -181,29 +204,25 @@ esp_err_t tts_audio_play_chunk(const uint8_t *audio_data, size_t data_len)
         return ESP_ERR_INVALID_ARG;
     }
     
+    howdy_lat_mark(HOWDY_LAT_TTS_CHUNK);
+    
     uint64_t start_time = esp_timer_get_time();
     
     // Performance optimized memory allocation: try pool first
     uint8_t *chunk_data = NULL;
     uint8_t pool_index = 0xFF;
     
-    if (data_len <= MAX_TTS_HANDLER_CHUNK_SIZE) {
-        // Find available pool buffer
-        for (uint8_t i = 0; i < TTS_HANDLER_CHUNK_POOL_SIZE; i++) {
-            if (!s_tts_handler_chunk_pool[i].in_use) {
-                s_tts_handler_chunk_pool[i].in_use = true;
-                s_tts_handler_chunk_pool[i].alloc_time = start_time;
-                chunk_data = s_tts_handler_chunk_pool[i].buffer;
-                pool_index = i;
-                s_tts_perf_metrics.pool_hits++;
-                break;
-            }
+    if (s_tts_handler_chunk_pool && data_len <= MAX_TTS_HANDLER_CHUNK_SIZE) {
+        chunk_data = howdy_pool_alloc(s_tts_handler_chunk_pool);
+        if (chunk_data) {
+            pool_index = (uint8_t)howdy_pool_index(s_tts_handler_chunk_pool, chunk_data);
+            s_tts_perf_metrics.pool_hits++;
         }
     }
     
     // Fallback to malloc if pool exhausted or chunk too large
     if (!chunk_data) {
-        chunk_data = malloc(data_len);
+        chunk_data = HOWDY_MALLOC(HOWDY_HEAP_TAG_TTS, data_len, howdy_mem_caps(HOWDY_MEM_BULK));
         if (!chunk_data) {
             ESP_LOGE(TAG, "Failed to allocate memory for audio chunk (%zu bytes)", data_len);
             s_tts_perf_metrics.memory_allocation_failures++;
@@ -213,15 +232,10 @@ esp_err_t tts_audio_play_chunk(const uint8_t *audio_data, size_t data_len)
         ESP_LOGV(TAG, "Using malloc for TTS chunk (pool exhausted: %zu bytes)", data_len);
     }
     
-    // High-speed memory copy with performance tracking
-    uint64_t copy_start = esp_timer_get_time();
     memcpy(chunk_data, audio_data, data_len);
-    uint64_t copy_time = esp_timer_get_time() - copy_start;
     
     // Apply volume scaling with optimized processing
-    uint64_t volume_start = esp_timer_get_time();
     apply_volume(chunk_data, data_len, s_tts_audio.config.volume);
-    uint64_t volume_time = esp_timer_get_time() - volume_start;
     
     // Create optimized chunk structure
     tts_audio_chunk_t chunk = {
@@ -236,11 +250,7 @@ esp_err_t tts_audio_play_chunk(const uint8_t *audio_data, size_t data_len)
         ESP_LOGW(TAG, "Failed to queue audio chunk - buffer full");
         
         // Cleanup on queue failure
-        if (pool_index != 0xFF) {
-            s_tts_handler_chunk_pool[pool_index].in_use = false;
-        } else {
-            free(chunk_data);
-        }
+        release_chunk(&chunk);
         s_tts_audio.buffer_underruns++;
         return ESP_ERR_TIMEOUT;
     }
@@ -253,9 +263,7 @@ esp_err_t tts_audio_play_chunk(const uint8_t *audio_data, size_t data_len)
         s_tts_perf_metrics.max_processing_time_us = total_time;
     }
     
-    ESP_LOGV(TAG, "🎵 TTS chunk queued: %zu bytes (%.1fμs total: copy=%.1fμs, vol=%.1fμs, pool=%s)", 
-             data_len, (float)total_time, (float)copy_time, (float)volume_time, 
-             pool_index != 0xFF ? "yes" : "no");
+    HOWDY_TRACE(HOWDY_TRACE_TTS_CHUNK, data_len, total_time);
     
     // Performance reporting every 100 chunks
     if (s_tts_perf_metrics.total_chunks_processed % 100 == 0) {
@@ -368,7 +376,7 @@ esp_err_t tts_audio_clear_buffer(void)
     int cleared_chunks = 0;
     
     while (xQueueReceive(s_tts_audio.audio_queue, &chunk, 0) == pdTRUE) {
-        free(chunk.data);
+        release_chunk(&chunk);
         cleared_chunks++;
     }
     
@@ -395,24 +403,55 @@ esp_err_t tts_audio_get_stats(uint32_t *chunks_played,
     return ESP_OK;
 }
 
+// Return a chunk buffer to the pool, or free it if it was malloc'd
+static void release_chunk(const tts_audio_chunk_t *chunk)
+{
+    if (chunk->pool_index == 0xFF) {
+        HOWDY_FREE(chunk->data);
+        ESP_LOGV(TAG, "Freed malloc'd TTS chunk buffer");
+        return;
+    }
+
+    uint64_t usage_time = esp_timer_get_time() - chunk->timestamp;
+    esp_err_t ret = howdy_pool_free(s_tts_handler_chunk_pool, chunk->data);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "TTS chunk pool free failed (index: %d): %s", chunk->pool_index, esp_err_to_name(ret));
+        return;
+    }
+    ESP_LOGV(TAG, "Returned TTS chunk to pool (index: %d, used: %.1fμs)",
+             chunk->pool_index, (float)usage_time);
+}
+
 static void tts_playback_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "TTS playback task started");
     
     tts_audio_chunk_t chunk;
     
+    // Cadence follows the chunks: each blocking I2S write lasts as long as its audio,
+    // which is also why there is no howdy_sched_done() (the write would count as overrun)
+    s_tts_audio.playback_sched = howdy_sched_register("tts_playback", 20000);
+    
     while (1) {
         // Wait for audio chunks to play
         if (xQueueReceive(s_tts_audio.audio_queue, &chunk, pdMS_TO_TICKS(100)) == pdTRUE) {
             
             if (s_tts_audio.playing) {
+                howdy_sched_wake(s_tts_audio.playback_sched);
+                howdy_lat_mark(HOWDY_LAT_PLAYOUT_POP);
+                
                 // Write audio data directly to I2S speaker via dual I2S manager
                 size_t samples = chunk.length / sizeof(int16_t);
+                if (s_tts_audio.config.sample_rate) {
+                    howdy_sched_set_period(s_tts_audio.playback_sched,
+                                           (uint32_t)((uint64_t)samples * 1000000 / s_tts_audio.config.sample_rate));
+                }
                 size_t bytes_written = 0;
                 
                 esp_err_t ret = dual_i2s_write_speaker((const int16_t*)chunk.data, samples, 
                                                       &bytes_written, 100);
                 if (ret == ESP_OK && bytes_written > 0) {
+                    howdy_lat_mark(HOWDY_LAT_I2S_WRITE);
                     s_tts_audio.chunks_played++;
                     s_tts_audio.bytes_played += bytes_written;
                     
@@ -434,17 +473,10 @@ static void tts_playback_task(void *pvParameters)
             }
             
             // Performance optimized cleanup: use pool or free as appropriate
-            if (chunk.pool_index != 0xFF && chunk.pool_index < TTS_HANDLER_CHUNK_POOL_SIZE) {
-                // Return buffer to pool with usage tracking
-                uint64_t usage_time = esp_timer_get_time() - s_tts_handler_chunk_pool[chunk.pool_index].alloc_time;
-                s_tts_handler_chunk_pool[chunk.pool_index].in_use = false;
-                ESP_LOGV(TAG, "Returned TTS chunk to pool (index: %d, used: %.1fμs)", 
-                        chunk.pool_index, (float)usage_time);
-            } else {
-                // Free malloc'd buffer
-                free(chunk.data);
-                ESP_LOGV(TAG, "Freed malloc'd TTS chunk buffer");
-            }
+            release_chunk(&chunk);
+        } else {
+            // Queue ran dry: the next chunk starts a new cadence rather than a miss
+            howdy_sched_idle(s_tts_audio.playback_sched);
         }
     }
     
@@ -1,4 +1,6 @@
 #include "tts_jitter_buffer.h"
+#include "tts_plc.h"
+#include "howdy_mem_placement.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -9,10 +11,13 @@ typedef struct tts_jitter_buffer_t {
     size_t head;   // read index
     size_t tail;   // write index
     size_t depth;  // frames queued
-    int16_t *frames; // contiguous buffer: capacity_frames * frame_samples
+    size_t frame_stride; // samples between frame starts (cache-set padded)
+    int16_t *frames; // contiguous buffer: capacity_frames * frame_stride
     // partial accumulation buffer for non-frame-aligned pushes
     int16_t *accum;
     size_t accum_count;
+    // optional packet loss concealment applied on pop
+    tts_plc_t *plc;
 } tts_jitter_buffer_t;
 
 tts_jitter_buffer_t *tts_jb_create(size_t frame_samples, size_t min_frames, size_t max_frames)
@@ -20,18 +25,19 @@ tts_jitter_buffer_t *tts_jb_create(size_t frame_samples, size_t min_frames, size
     (void)min_frames; // For now, only use max capacity; playout target handled by caller timing
     if (frame_samples == 0 || max_frames == 0) return NULL;
 
-    tts_jitter_buffer_t *jb = (tts_jitter_buffer_t *)calloc(1, sizeof(*jb));
+    tts_jitter_buffer_t *jb = (tts_jitter_buffer_t *)howdy_mem_calloc(HOWDY_MEM_HOT, 1, sizeof(*jb));
     if (!jb) return NULL;
 
     jb->frame_samples = frame_samples;
     jb->frame_bytes = frame_samples * sizeof(int16_t);
     jb->capacity_frames = max_frames;
-    jb->frames = (int16_t *)malloc(jb->capacity_frames * jb->frame_bytes);
-    jb->accum = (int16_t *)malloc(jb->frame_bytes);
+    jb->frame_stride = howdy_mem_stride(HOWDY_MEM_BULK, jb->frame_bytes) / sizeof(int16_t);
+    jb->frames = (int16_t *)howdy_mem_alloc(HOWDY_MEM_BULK, jb->capacity_frames * jb->frame_stride * sizeof(int16_t));
+    jb->accum = (int16_t *)howdy_mem_alloc(HOWDY_MEM_HOT, jb->frame_bytes);
     if (!jb->frames || !jb->accum) {
-        free(jb->frames);
-        free(jb->accum);
-        free(jb);
+        howdy_mem_free(jb->frames);
+        howdy_mem_free(jb->accum);
+        howdy_mem_free(jb);
         return NULL;
     }
     return jb;
@@ -40,9 +46,10 @@ tts_jitter_buffer_t *tts_jb_create(size_t frame_samples, size_t min_frames, size
 void tts_jb_destroy(tts_jitter_buffer_t *jb)
 {
     if (!jb) return;
-    free(jb->frames);
-    free(jb->accum);
-    free(jb);
+    tts_plc_destroy(jb->plc);
+    howdy_mem_free(jb->frames);
+    howdy_mem_free(jb->accum);
+    howdy_mem_free(jb);
 }
 
 void tts_jb_reset(tts_jitter_buffer_t *jb)
@@ -50,6 +57,15 @@ void tts_jb_reset(tts_jitter_buffer_t *jb)
     if (!jb) return;
     jb->head = jb->tail = jb->depth = 0;
     jb->accum_count = 0;
+    tts_plc_reset(jb->plc);
+}
+
+bool tts_jb_enable_plc(tts_jitter_buffer_t *jb, uint32_t sample_rate)
+{
+    if (!jb) return false;
+    if (jb->plc) return true;
+    jb->plc = tts_plc_create(sample_rate, jb->frame_samples);
+    return jb->plc != NULL;
 }
 
 static void push_frame(tts_jitter_buffer_t *jb, const int16_t *frame)
@@ -59,7 +75,7 @@ static void push_frame(tts_jitter_buffer_t *jb, const int16_t *frame)
         jb->head = (jb->head + 1) % jb->capacity_frames;
         jb->depth--;
     }
-    int16_t *dst = jb->frames + (jb->tail * jb->frame_samples);
+    int16_t *dst = jb->frames + (jb->tail * jb->frame_stride);
     memcpy(dst, frame, jb->frame_bytes);
     jb->tail = (jb->tail + 1) % jb->capacity_frames;
     jb->depth++;
@@ -108,15 +124,22 @@ bool tts_jb_pop_frame(tts_jitter_buffer_t *jb, int16_t *out_frame, bool *false_u
 {
     if (!jb || !out_frame) return false;
     if (jb->depth == 0) {
-        // underrun: provide silence
-        memset(out_frame, 0, jb->frame_bytes);
+        // underrun: conceal from pitch history when enabled, otherwise silence
+        if (jb->plc) {
+            tts_plc_conceal_frame(jb->plc, out_frame);
+        } else {
+            memset(out_frame, 0, jb->frame_bytes);
+        }
         if (false_underrun) *false_underrun = true;
         return false;
     }
-    int16_t *src = jb->frames + (jb->head * jb->frame_samples);
+    int16_t *src = jb->frames + (jb->head * jb->frame_stride);
     memcpy(out_frame, src, jb->frame_bytes);
     jb->head = (jb->head + 1) % jb->capacity_frames;
     jb->depth--;
+    if (jb->plc) {
+        tts_plc_good_frame(jb->plc, out_frame);
+    }
     if (false_underrun) *false_underrun = false;
     return true;
 }
@@ -127,3 +150,10 @@ size_t tts_jb_depth(tts_jitter_buffer_t *jb)
     return jb->depth;
 }
 
+
+bool tts_jb_get_plc_stats(tts_jitter_buffer_t *jb, tts_plc_stats_t *stats)
+{
+    if (!jb || !jb->plc || !stats) return false;
+    tts_plc_get_stats(jb->plc, stats);
+    return true;
+}
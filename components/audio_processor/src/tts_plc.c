@@ -0,0 +1,262 @@
+#include "tts_plc.h"
+#include "howdy_mem_placement.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PLC_Q15_ONE 32768
+
+typedef struct tts_plc_t {
+    size_t frame_samples;
+    uint16_t pitch_min;      // shortest period searched (2.5 ms, 400 Hz)
+    uint16_t pitch_max;      // longest period searched (15 ms, ~66 Hz)
+    size_t corr_len;         // correlation window for the pitch search
+    size_t hold_samples;     // concealment played at full level (10 ms)
+    size_t max_samples;      // concealment fades to silence by here (60 ms)
+    size_t ola_len;          // crossfade length on recovery (4 ms)
+    size_t talkspurt_gap;    // an underrun this long ends the talkspurt (500 ms)
+
+    // history of played audio, newest sample last
+    int16_t *hist;
+    size_t hist_len;
+    size_t hist_fill;
+
+    // one pitch period with a smoothed loop point
+    int16_t *pbuf;
+    uint16_t pitch;
+    uint16_t pos;
+
+    bool in_loss;            // last output was concealment (or silence)
+    bool exhausted;          // concealment ran out; emitting silence
+    size_t conceal_samples;  // synthetic samples emitted in this burst
+    size_t silence_samples;  // silence emitted in this burst, up to talkspurt_gap
+
+    tts_plc_stats_t stats;
+} tts_plc_t;
+
+tts_plc_t *tts_plc_create(uint32_t sample_rate, size_t frame_samples)
+{
+    if (sample_rate < 8000 || frame_samples == 0) return NULL;
+
+    tts_plc_t *plc = (tts_plc_t *)howdy_mem_calloc(HOWDY_MEM_HOT, 1, sizeof(*plc));
+    if (!plc) return NULL;
+
+    plc->frame_samples = frame_samples;
+    plc->pitch_min = (uint16_t)(sample_rate / 400);
+    plc->pitch_max = (uint16_t)(sample_rate * 15 / 1000);
+    plc->corr_len = plc->pitch_max;
+    plc->hold_samples = sample_rate / 100;
+    plc->max_samples = sample_rate * 60 / 1000;
+    plc->ola_len = sample_rate / 250;
+    plc->talkspurt_gap = sample_rate / 2;
+    plc->hist_len = plc->corr_len + plc->pitch_max;
+
+    plc->hist = (int16_t *)howdy_mem_calloc(HOWDY_MEM_HOT, plc->hist_len, sizeof(int16_t));
+    plc->pbuf = (int16_t *)howdy_mem_calloc(HOWDY_MEM_HOT, plc->pitch_max, sizeof(int16_t));
+    if (!plc->hist || !plc->pbuf) {
+        howdy_mem_free(plc->hist);
+        howdy_mem_free(plc->pbuf);
+        howdy_mem_free(plc);
+        return NULL;
+    }
+    return plc;
+}
+
+void tts_plc_destroy(tts_plc_t *plc)
+{
+    if (!plc) return;
+    howdy_mem_free(plc->hist);
+    howdy_mem_free(plc->pbuf);
+    howdy_mem_free(plc);
+}
+
+void tts_plc_reset(tts_plc_t *plc)
+{
+    if (!plc) return;
+    plc->hist_fill = 0;
+    plc->in_loss = false;
+    plc->exhausted = false;
+    plc->conceal_samples = 0;
+    plc->silence_samples = 0;
+    plc->pos = 0;
+}
+
+static void push_history(tts_plc_t *plc, const int16_t *frame)
+{
+    size_t n = plc->frame_samples;
+    if (n >= plc->hist_len) {
+        memcpy(plc->hist, frame + (n - plc->hist_len), plc->hist_len * sizeof(int16_t));
+    } else {
+        memmove(plc->hist, plc->hist + n, (plc->hist_len - n) * sizeof(int16_t));
+        memcpy(plc->hist + (plc->hist_len - n), frame, n * sizeof(int16_t));
+    }
+    plc->hist_fill += n;
+    if (plc->hist_fill > plc->hist_len) plc->hist_fill = plc->hist_len;
+}
+
+// Normalized cross-correlation of a against b (b scaled only), every step-th sample
+static float norm_corr(const int16_t *a, const int16_t *b, size_t n, size_t step)
+{
+    int64_t cross = 0;
+    int64_t energy = 0;
+    for (size_t i = 0; i < n; i += step) {
+        cross += (int32_t)a[i] * b[i];
+        energy += (int32_t)b[i] * b[i];
+    }
+    if (energy == 0 || cross <= 0) return 0.0f;
+    return (float)cross / sqrtf((float)energy);
+}
+
+static uint16_t estimate_pitch(const tts_plc_t *plc)
+{
+    const int16_t *ref = plc->hist + plc->hist_len - plc->corr_len;
+
+    // Coarse search on every other lag and sample, then refine around the best
+    uint16_t best = plc->pitch_max;
+    float best_score = 0.0f;
+    for (uint16_t lag = plc->pitch_min; lag <= plc->pitch_max; lag += 2) {
+        float score = norm_corr(ref, ref - lag, plc->corr_len, 2);
+        if (score > best_score) {
+            best_score = score;
+            best = lag;
+        }
+    }
+
+    uint16_t lo = (best > plc->pitch_min) ? best - 1 : best;
+    uint16_t hi = (best < plc->pitch_max) ? best + 1 : best;
+    uint16_t coarse = best;
+    best_score = 0.0f;
+    for (uint16_t lag = lo; lag <= hi; lag++) {
+        float score = norm_corr(ref, ref - lag, plc->corr_len, 1);
+        if (score > best_score) {
+            best_score = score;
+            best = lag;
+        }
+    }
+    return (best_score > 0.0f) ? best : coarse;
+}
+
+static bool history_is_silent(const tts_plc_t *plc)
+{
+    const int16_t *ref = plc->hist + plc->hist_len - plc->corr_len;
+    for (size_t i = 0; i < plc->corr_len; i++) {
+        if (ref[i] != 0) return false;
+    }
+    return true;
+}
+
+static void start_loss(tts_plc_t *plc)
+{
+    plc->in_loss = true;
+    plc->conceal_samples = 0;
+    plc->silence_samples = 0;
+    plc->pos = 0;
+
+    if (plc->hist_fill < plc->hist_len || history_is_silent(plc)) {
+        // Nothing was playing, so this is not a gap in a talkspurt
+        plc->silence_samples = plc->talkspurt_gap;
+        plc->exhausted = true;
+        return;
+    }
+    plc->exhausted = false;
+
+    uint16_t p = estimate_pitch(plc);
+    uint16_t q = p / 4;
+    const int16_t *end = plc->hist + plc->hist_len;
+
+    // Repeat the last period; blend its final quarter into the samples that
+    // precede the period so the loop point wraps without a discontinuity.
+    memcpy(plc->pbuf, end - p, p * sizeof(int16_t));
+    for (uint16_t i = 0; i < q; i++) {
+        int32_t w = ((int32_t)(i + 1) * PLC_Q15_ONE) / (q + 1);
+        int32_t tail = end[(int)i - q];
+        int32_t before = end[(int)i - p - q];
+        plc->pbuf[p - q + i] = (int16_t)((tail * (PLC_Q15_ONE - w) + before * w) >> 15);
+    }
+
+    plc->pitch = p;
+    plc->stats.last_pitch_samples = p;
+    plc->stats.concealment_events++;
+}
+
+static int16_t next_synth_sample(tts_plc_t *plc)
+{
+    int32_t gain;
+    if (plc->conceal_samples < plc->hold_samples) {
+        gain = PLC_Q15_ONE;
+    } else if (plc->conceal_samples >= plc->max_samples) {
+        gain = 0;
+    } else {
+        gain = (int32_t)(((int64_t)(plc->max_samples - plc->conceal_samples) * PLC_Q15_ONE) /
+                         (int64_t)(plc->max_samples - plc->hold_samples));
+    }
+
+    int32_t s = plc->pbuf[plc->pos];
+    if (++plc->pos >= plc->pitch) plc->pos = 0;
+    plc->conceal_samples++;
+    return (int16_t)((s * gain) >> 15);
+}
+
+void tts_plc_conceal_frame(tts_plc_t *plc, int16_t *out_frame)
+{
+    if (!plc || !out_frame) return;
+
+    if (!plc->in_loss) {
+        start_loss(plc);
+    }
+    if (plc->exhausted) {
+        // Counted when audio resumes; idle time between replies is not a gap
+        memset(out_frame, 0, plc->frame_samples * sizeof(int16_t));
+        if (plc->silence_samples < plc->talkspurt_gap) {
+            plc->silence_samples += plc->frame_samples;
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < plc->frame_samples; i++) {
+        out_frame[i] = next_synth_sample(plc);
+    }
+    plc->stats.concealed_frames++;
+
+    if (plc->conceal_samples >= plc->max_samples) {
+        // Faded out: drop history so idle periods don't re-trigger concealment
+        plc->exhausted = true;
+        plc->hist_fill = 0;
+    } else {
+        push_history(plc, out_frame);
+    }
+}
+
+void tts_plc_good_frame(tts_plc_t *plc, int16_t *frame)
+{
+    if (!plc || !frame) return;
+
+    if (plc->in_loss) {
+        // Crossfade from the synthetic continuation (or from silence) into real audio
+        size_t n = (plc->ola_len < plc->frame_samples) ? plc->ola_len : plc->frame_samples;
+        for (size_t i = 0; i < n; i++) {
+            int32_t synth = plc->exhausted ? 0 : next_synth_sample(plc);
+            int32_t w = (int32_t)(((i + 1) * PLC_Q15_ONE) / (n + 1));
+            frame[i] = (int16_t)((synth * (PLC_Q15_ONE - w) + (int32_t)frame[i] * w) >> 15);
+        }
+        if (!plc->exhausted) {
+            plc->stats.crossfades++;
+        } else if (plc->silence_samples < plc->talkspurt_gap) {
+            plc->stats.silence_frames += plc->silence_samples / plc->frame_samples;
+        }
+        plc->in_loss = false;
+        plc->exhausted = false;
+    }
+
+    push_history(plc, frame);
+}
+
+void tts_plc_get_stats(const tts_plc_t *plc, tts_plc_stats_t *stats)
+{
+    if (!stats) return;
+    if (!plc) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = plc->stats;
+}
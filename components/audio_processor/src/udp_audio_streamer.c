@@ -1,10 +1,15 @@
 #include "udp_audio_streamer.h"
+#include "audio_frame_ring.h"
+#include "howdy_latency.h"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "lwip/sockets.h"
 #include "lwip/inet.h"
+#include <stdio.h>
 #include <string.h>
 #include <sys/param.h>
 
@@ -14,6 +19,11 @@ static const char *TAG = "UDPAudio";
 #define UDP_RECV_TASK_PRIORITY      18
 #define UDP_MAX_PACKET_SIZE         1472  // Typical MTU - IP/UDP headers
 #define UDP_RECV_TIMEOUT_MS         100
+#define UDP_SAMPLE_RATE             16000
+#define UDP_SEND_TASK_STACK_SIZE    4096
+#define UDP_SEND_TASK_PRIORITY      18
+#define UDP_SEND_RING_FRAMES        16    // 320 ms of 20 ms packets
+#define UDP_SEND_BATCH              4     // Packets sent per mutex hold
 
 // UDP audio streamer state
 static struct {
@@ -33,15 +43,22 @@ static struct {
     // Statistics
     udp_audio_stats_t stats;
     
-    // Thread safety
+    // Thread safety (send task, receive task and control calls; not the capture path)
     SemaphoreHandle_t mutex;
     
-    // Packet buffer for assembly
-    uint8_t packet_buffer[UDP_MAX_PACKET_SIZE];
-    size_t packet_buffer_used;
+    // Capture -> network handoff; udp_audio_send() is the single producer
+    audio_frame_ring_t *send_ring;
+    audio_frame_span_t fill_slot;       // Packet being assembled by the producer
+    size_t fill_bytes;
+    TaskHandle_t send_task_handle;
     uint32_t samples_per_packet;
     // Store a safe copy of server IP
     char server_ip_str[16];
+    
+    // RTP mode (enable_rtp)
+    rtp_session_t *rtp;
+    bool rtp_marker_pending;
+    char rtp_cname[24];
 } s_udp_audio = {
     .send_socket = -1,
     .recv_socket = -1,
@@ -53,9 +70,14 @@ static struct {
 
 // Forward declarations
 static void udp_receive_task(void *pvParameters);
+static void udp_send_task(void *pvParameters);
+static esp_err_t send_frame_locked(const int16_t *samples, size_t sample_count);
 static esp_err_t create_sockets(void);
 static void close_sockets(void);
 static size_t calculate_packet_size(uint32_t packet_ms, uint32_t sample_rate);
+static esp_err_t send_rtp_locked(const int16_t *samples, size_t sample_count,
+                                 const rtp_vad_ext_t *vad, const rtp_wake_word_ext_t *wake_word);
+static void handle_rtp_datagram(uint8_t *data, size_t len);
 
 esp_err_t udp_audio_init(const udp_audio_config_t *config)
 {
@@ -92,12 +114,42 @@ esp_err_t udp_audio_init(const udp_audio_config_t *config)
         config->packet_size_ms, 16000  // 16kHz sample rate
     );
     
+    s_udp_audio.send_ring = audio_frame_ring_create(s_udp_audio.samples_per_packet * sizeof(int16_t),
+                                                    UDP_SEND_RING_FRAMES);
+    if (!s_udp_audio.send_ring) {
+        ESP_LOGE(TAG, "Failed to create send ring");
+        vSemaphoreDelete(s_udp_audio.mutex);
+        s_udp_audio.mutex = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    
     // Setup server address
     memset(&s_udp_audio.server_addr, 0, sizeof(s_udp_audio.server_addr));
     s_udp_audio.server_addr.sin_family = AF_INET;
     s_udp_audio.server_addr.sin_port = htons(config->server_port);
     inet_pton(AF_INET, s_udp_audio.config.server_ip, &s_udp_audio.server_addr.sin_addr);
     
+    if (config->enable_rtp) {
+        uint32_t ssrc = esp_random();
+        snprintf(s_udp_audio.rtp_cname, sizeof(s_udp_audio.rtp_cname), "howdyscreen-%08lx", ssrc);
+        rtp_session_config_t rtp_cfg = {
+            .ssrc = ssrc,
+            .clock_rate = UDP_SAMPLE_RATE,
+            .payload_type = RTP_PAYLOAD_TYPE_L16,
+            .cname = s_udp_audio.rtp_cname
+        };
+        s_udp_audio.rtp = rtp_session_create(&rtp_cfg);
+        if (!s_udp_audio.rtp) {
+            ESP_LOGE(TAG, "Failed to create RTP session");
+            audio_frame_ring_destroy(s_udp_audio.send_ring);
+            s_udp_audio.send_ring = NULL;
+            vSemaphoreDelete(s_udp_audio.mutex);
+            s_udp_audio.mutex = NULL;
+            return ESP_ERR_NO_MEM;
+        }
+        ESP_LOGI(TAG, "RTP mode enabled - SSRC 0x%08lx, PT %d, RTCP muxed", ssrc, RTP_PAYLOAD_TYPE_L16);
+    }
+    
     s_udp_audio.is_initialized = true;
     
     ESP_LOGI(TAG, "UDP audio initialized - Server: %s:%d, Packet: %lums (%lu samples)",
@@ -121,6 +173,12 @@ esp_err_t udp_audio_deinit(void)
         s_udp_audio.mutex = NULL;
     }
     
+    rtp_session_destroy(s_udp_audio.rtp);
+    s_udp_audio.rtp = NULL;
+    
+    audio_frame_ring_destroy(s_udp_audio.send_ring);
+    s_udp_audio.send_ring = NULL;
+    
     s_udp_audio.is_initialized = false;
     
     ESP_LOGI(TAG, "UDP audio deinitialized");
@@ -150,8 +208,14 @@ esp_err_t udp_audio_start(udp_audio_receive_cb_t receive_cb, void *user_data)
     s_udp_audio.receive_callback = receive_cb;
     s_udp_audio.callback_user_data = user_data;
     
-    // Create receive task if callback provided
-    if (receive_cb) {
+    // Both tasks are stopped, so the ring can be emptied safely
+    audio_frame_ring_reset(s_udp_audio.send_ring);
+    s_udp_audio.fill_slot.count = 0;
+    s_udp_audio.fill_bytes = 0;
+    s_udp_audio.is_streaming = true;
+    
+    // Create receive task if callback provided (RTP mode always needs it for RTCP)
+    if (receive_cb || s_udp_audio.rtp) {
         BaseType_t task_ret = xTaskCreatePinnedToCore(
             udp_receive_task,
             "udp_audio_rx",
@@ -164,14 +228,30 @@ esp_err_t udp_audio_start(udp_audio_receive_cb_t receive_cb, void *user_data)
         
         if (task_ret != pdPASS) {
             ESP_LOGE(TAG, "Failed to create receive task");
+            s_udp_audio.is_streaming = false;
             close_sockets();
             return ESP_FAIL;
         }
     }
     
-    s_udp_audio.is_streaming = true;
     s_udp_audio.sequence_number = 0;
-    s_udp_audio.packet_buffer_used = 0;
+    s_udp_audio.rtp_marker_pending = true;
+    
+    BaseType_t send_ret = xTaskCreatePinnedToCore(
+        udp_send_task,
+        "udp_audio_tx",
+        UDP_SEND_TASK_STACK_SIZE,
+        NULL,
+        UDP_SEND_TASK_PRIORITY,
+        &s_udp_audio.send_task_handle,
+        1  // Core 1 for network tasks
+    );
+    
+    if (send_ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create send task");
+        udp_audio_stop();
+        return ESP_FAIL;
+    }
     
     ESP_LOGI(TAG, "UDP audio streaming started");
     return ESP_OK;
@@ -185,11 +265,12 @@ esp_err_t udp_audio_stop(void)
     
     s_udp_audio.is_streaming = false;
     
-    // Stop receive task
-    if (s_udp_audio.receive_task_handle) {
-        // Task will exit on next receive timeout
+    // Stop receive and send tasks
+    if (s_udp_audio.receive_task_handle || s_udp_audio.send_task_handle) {
+        // Tasks exit on their next timeout
         vTaskDelay(pdMS_TO_TICKS(UDP_RECV_TIMEOUT_MS + 50));
         s_udp_audio.receive_task_handle = NULL;
+        s_udp_audio.send_task_handle = NULL;
     }
     
     // Close sockets
@@ -205,7 +286,7 @@ esp_err_t udp_audio_stop(void)
 
 esp_err_t udp_audio_send(const int16_t *samples, size_t sample_count)
 {
-    if (!s_udp_audio.is_streaming || s_udp_audio.send_socket < 0) {
+    if (!s_udp_audio.is_streaming || !s_udp_audio.send_ring) {
         return ESP_ERR_INVALID_STATE;
     }
     
@@ -213,70 +294,122 @@ esp_err_t udp_audio_send(const int16_t *samples, size_t sample_count)
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (xSemaphoreTake(s_udp_audio.mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
-        return ESP_ERR_TIMEOUT;
-    }
-    
+    // Wait-free: assemble packets directly in ring slots and leave the
+    // socket work to udp_send_task, so capture never blocks on the network
+    const size_t packet_bytes = s_udp_audio.samples_per_packet * sizeof(int16_t);
     size_t samples_processed = 0;
+    size_t packets_committed = 0;
     esp_err_t ret = ESP_OK;
     
-    while (samples_processed < sample_count && ret == ESP_OK) {
+    while (samples_processed < sample_count) {
+        if (s_udp_audio.fill_slot.count == 0) {
+            if (audio_frame_ring_claim(s_udp_audio.send_ring, 1, &s_udp_audio.fill_slot) == 0) {
+                // Sender is behind: drop the rest of this call
+                size_t remaining = sample_count - samples_processed;
+                audio_frame_ring_note_overrun(s_udp_audio.send_ring,
+                    (remaining + s_udp_audio.samples_per_packet - 1) / s_udp_audio.samples_per_packet);
+                ret = ESP_ERR_NO_MEM;
+                break;
+            }
+            s_udp_audio.fill_bytes = 0;
+        }
+        
         // Calculate how many samples to add to current packet
-        size_t current_packet_samples = s_udp_audio.packet_buffer_used / sizeof(int16_t);
-        size_t samples_needed = s_udp_audio.samples_per_packet - current_packet_samples;
+        size_t samples_needed = (packet_bytes - s_udp_audio.fill_bytes) / sizeof(int16_t);
         size_t samples_to_copy = MIN(samples_needed, sample_count - samples_processed);
         
-        // Copy samples to packet buffer
-        memcpy(s_udp_audio.packet_buffer + s_udp_audio.packet_buffer_used,
+        memcpy(s_udp_audio.fill_slot.data + s_udp_audio.fill_bytes,
                &samples[samples_processed],
                samples_to_copy * sizeof(int16_t));
         
-        s_udp_audio.packet_buffer_used += samples_to_copy * sizeof(int16_t);
+        s_udp_audio.fill_bytes += samples_to_copy * sizeof(int16_t);
         samples_processed += samples_to_copy;
         
-        // Send packet if full
-        if (s_udp_audio.packet_buffer_used >= s_udp_audio.samples_per_packet * sizeof(int16_t)) {
-            // Create header
-            udp_audio_header_t header = {
-                .sequence = s_udp_audio.sequence_number++,
-                .sample_count = s_udp_audio.samples_per_packet,
-                .sample_rate = 16000,
-                .channels = 1,
-                .bits_per_sample = 16,
-                .flags = s_udp_audio.config.enable_compression ? 0x0001 : 0x0000
-            };
-            
-            // Build complete packet
-            uint8_t packet[UDP_MAX_PACKET_SIZE];
-            memcpy(packet, &header, sizeof(header));
-            memcpy(packet + sizeof(header), s_udp_audio.packet_buffer, s_udp_audio.packet_buffer_used);
-            
-            size_t packet_size = sizeof(header) + s_udp_audio.packet_buffer_used;
-            
-            // Send packet
-            ssize_t sent = sendto(s_udp_audio.send_socket, packet, packet_size, 0,
-                                 (struct sockaddr *)&s_udp_audio.server_addr,
-                                 sizeof(s_udp_audio.server_addr));
-            
-            if (sent < 0) {
-                ESP_LOGE(TAG, "Failed to send UDP packet: %d", errno);
-                s_udp_audio.stats.socket_errors++;
-                ret = ESP_FAIL;
-            } else {
-                s_udp_audio.stats.packets_sent++;
-                s_udp_audio.stats.bytes_sent += sent;
-                ESP_LOGV(TAG, "Sent UDP packet %lu (%zd bytes)", header.sequence, sent);
-            }
-            
-            // Reset packet buffer
-            s_udp_audio.packet_buffer_used = 0;
+        // Publish packet if full
+        if (s_udp_audio.fill_bytes >= packet_bytes) {
+            s_udp_audio.fill_slot.lengths[0] = (uint32_t)s_udp_audio.fill_bytes;
+            audio_frame_ring_commit(s_udp_audio.send_ring, 1);
+            s_udp_audio.fill_slot.count = 0;
+            packets_committed++;
         }
     }
     
-    xSemaphoreGive(s_udp_audio.mutex);
+    TaskHandle_t sender = s_udp_audio.send_task_handle;
+    if (packets_committed > 0 && sender) {
+        xTaskNotifyGive(sender);
+    }
+    
     return ret;
 }
 
+// Caller holds the mutex
+static esp_err_t send_frame_locked(const int16_t *samples, size_t sample_count)
+{
+    if (s_udp_audio.rtp) {
+        return send_rtp_locked(samples, sample_count, NULL, NULL);
+    }
+    
+    udp_audio_header_t header = {
+        .sequence = s_udp_audio.sequence_number++,
+        .sample_count = sample_count,
+        .sample_rate = UDP_SAMPLE_RATE,
+        .channels = 1,
+        .bits_per_sample = 16,
+        .flags = s_udp_audio.config.enable_compression ? 0x0001 : 0x0000
+    };
+    
+    // Build complete packet
+    uint8_t packet[UDP_MAX_PACKET_SIZE];
+    size_t payload_size = sample_count * sizeof(int16_t);
+    memcpy(packet, &header, sizeof(header));
+    memcpy(packet + sizeof(header), samples, payload_size);
+    
+    ssize_t sent = sendto(s_udp_audio.send_socket, packet, sizeof(header) + payload_size, 0,
+                         (struct sockaddr *)&s_udp_audio.server_addr,
+                         sizeof(s_udp_audio.server_addr));
+    
+    if (sent < 0) {
+        ESP_LOGE(TAG, "Failed to send UDP packet: %d", errno);
+        s_udp_audio.stats.socket_errors++;
+        return ESP_FAIL;
+    }
+    
+    s_udp_audio.stats.packets_sent++;
+    s_udp_audio.stats.bytes_sent += sent;
+    ESP_LOGV(TAG, "Sent UDP packet %lu (%zd bytes)", header.sequence, sent);
+    return ESP_OK;
+}
+
+static void udp_send_task(void *pvParameters)
+{
+    ESP_LOGI(TAG, "UDP send task started");
+    
+    while (s_udp_audio.is_streaming) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(UDP_RECV_TIMEOUT_MS));
+        
+        audio_frame_span_t span;
+        while (s_udp_audio.is_streaming &&
+               audio_frame_ring_peek(s_udp_audio.send_ring, UDP_SEND_BATCH, &span) > 0) {
+            if (xSemaphoreTake(s_udp_audio.mutex, pdMS_TO_TICKS(UDP_RECV_TIMEOUT_MS)) != pdTRUE) {
+                break;
+            }
+            bool sent = false;
+            for (size_t i = 0; i < span.count; i++) {
+                sent |= send_frame_locked((const int16_t *)(span.data + i * span.stride),
+                                          span.lengths[i] / sizeof(int16_t)) == ESP_OK;
+            }
+            xSemaphoreGive(s_udp_audio.mutex);
+            if (sent) {
+                howdy_lat_mark(HOWDY_LAT_UPLINK);
+            }
+            audio_frame_ring_release(s_udp_audio.send_ring, span.count);
+        }
+    }
+    
+    ESP_LOGI(TAG, "UDP send task stopped");
+    vTaskDelete(NULL);
+}
+
 esp_err_t udp_audio_send_packet(const udp_audio_header_t *header, 
                                const uint8_t *audio_data, 
                                size_t audio_size)
@@ -289,6 +422,11 @@ esp_err_t udp_audio_send_packet(const udp_audio_header_t *header,
         return ESP_ERR_INVALID_ARG;
     }
     
+    if (s_udp_audio.rtp) {
+        // RTP carries its own sequence/timestamp; the custom header is dropped
+        return udp_audio_send_rtp((const int16_t *)audio_data, audio_size / sizeof(int16_t), NULL, NULL);
+    }
+    
     // Build complete packet
     uint8_t packet[UDP_MAX_PACKET_SIZE];
     size_t header_size = sizeof(udp_audio_header_t);
@@ -317,6 +455,108 @@ esp_err_t udp_audio_send_packet(const udp_audio_header_t *header,
     return ESP_OK;
 }
 
+esp_err_t udp_audio_send_rtp(const int16_t *samples, size_t sample_count,
+                             const rtp_vad_ext_t *vad,
+                             const rtp_wake_word_ext_t *wake_word)
+{
+    if (!s_udp_audio.rtp) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    
+    if (!s_udp_audio.is_streaming || s_udp_audio.recv_socket < 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!samples || sample_count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (xSemaphoreTake(s_udp_audio.mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    
+    esp_err_t ret = send_rtp_locked(samples, sample_count, vad, wake_word);
+    
+    xSemaphoreGive(s_udp_audio.mutex);
+    return ret;
+}
+
+// Caller holds the mutex. RTP goes out of the bound receive socket so the
+// server's RTP/RTCP replies come back to the same port (symmetric RTP).
+static esp_err_t send_rtp_locked(const int16_t *samples, size_t sample_count,
+                                 const rtp_vad_ext_t *vad, const rtp_wake_word_ext_t *wake_word)
+{
+    uint8_t packet[UDP_MAX_PACKET_SIZE];
+    bool marker = s_udp_audio.rtp_marker_pending || wake_word != NULL;
+    
+    size_t packet_size = rtp_session_build_packet(s_udp_audio.rtp, samples, sample_count,
+                                                  vad, wake_word, marker,
+                                                  packet, sizeof(packet));
+    if (packet_size == 0) {
+        ESP_LOGE(TAG, "RTP packet too large: %zu samples", sample_count);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    
+    ssize_t sent = sendto(s_udp_audio.recv_socket, packet, packet_size, 0,
+                         (struct sockaddr *)&s_udp_audio.server_addr,
+                         sizeof(s_udp_audio.server_addr));
+    if (sent < 0) {
+        ESP_LOGE(TAG, "Failed to send RTP packet: %d", errno);
+        s_udp_audio.stats.socket_errors++;
+        return ESP_FAIL;
+    }
+    
+    s_udp_audio.rtp_marker_pending = false;
+    s_udp_audio.stats.packets_sent++;
+    s_udp_audio.stats.bytes_sent += sent;
+    
+    uint64_t now_us = esp_timer_get_time();
+    if (rtp_session_rtcp_due(s_udp_audio.rtp, now_us)) {
+        uint8_t rtcp[RTCP_MAX_PACKET_SIZE];
+        size_t rtcp_size = rtp_session_build_rtcp(s_udp_audio.rtp, now_us, rtcp, sizeof(rtcp));
+        if (rtcp_size > 0 &&
+            sendto(s_udp_audio.recv_socket, rtcp, rtcp_size, 0,
+                   (struct sockaddr *)&s_udp_audio.server_addr,
+                   sizeof(s_udp_audio.server_addr)) < 0) {
+            s_udp_audio.stats.socket_errors++;
+        }
+    }
+    
+    return ESP_OK;
+}
+
+static void handle_rtp_datagram(uint8_t *data, size_t len)
+{
+    uint64_t now_us = esp_timer_get_time();
+    
+    if (xSemaphoreTake(s_udp_audio.mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return;
+    }
+    
+    if (rtp_is_rtcp(data, len)) {
+        rtp_session_handle_rtcp(s_udp_audio.rtp, data, len, now_us);
+        xSemaphoreGive(s_udp_audio.mutex);
+        return;
+    }
+    
+    rtp_packet_info_t info;
+    bool valid = rtp_session_parse_packet(s_udp_audio.rtp, data, len, now_us, &info);
+    xSemaphoreGive(s_udp_audio.mutex);
+    
+    if (!valid) {
+        ESP_LOGW(TAG, "Dropped invalid RTP packet (%zu bytes)", len);
+        return;
+    }
+    
+    s_udp_audio.stats.packets_received++;
+    s_udp_audio.stats.bytes_received += len;
+    
+    if (s_udp_audio.receive_callback && info.sample_count > 0) {
+        s_udp_audio.receive_callback(info.samples, info.sample_count,
+                                   s_udp_audio.callback_user_data);
+    }
+}
+
 static void udp_receive_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "UDP receive task started");
@@ -344,6 +584,11 @@ static void udp_receive_task(void *pvParameters)
             continue;
         }
         
+        if (s_udp_audio.rtp) {
+            handle_rtp_datagram(recv_buffer, received);
+            continue;
+        }
+        
         // Validate packet size
         if (received < sizeof(udp_audio_header_t)) {
             ESP_LOGW(TAG, "Received packet too small: %zd bytes", received);
@@ -477,6 +722,10 @@ esp_err_t udp_audio_get_stats(udp_audio_stats_t *stats)
     }
     
     *stats = s_udp_audio.stats;
+    
+    audio_frame_ring_stats_t ring_stats;
+    audio_frame_ring_get_stats(s_udp_audio.send_ring, &ring_stats);
+    stats->ring_overruns = ring_stats.overruns;
     return ESP_OK;
 }
 
@@ -486,6 +735,29 @@ esp_err_t udp_audio_reset_stats(void)
     return ESP_OK;
 }
 
+bool udp_audio_is_rtp_enabled(void)
+{
+    return s_udp_audio.rtp != NULL;
+}
+
+esp_err_t udp_audio_get_rtp_stats(rtp_session_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    if (!s_udp_audio.rtp) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (xSemaphoreTake(s_udp_audio.mutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    rtp_session_get_stats(s_udp_audio.rtp, stats);
+    xSemaphoreGive(s_udp_audio.mutex);
+    return ESP_OK;
+}
+
 bool udp_audio_is_streaming(void)
 {
     return s_udp_audio.is_streaming;
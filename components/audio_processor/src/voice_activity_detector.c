@@ -1,6 +1,7 @@
 #include "voice_activity_detector.h"
 #include "esp_log.h"
 #include "esp_heap_caps.h"
+#include "howdy_mem_placement.h"
 #include "esp_timer.h"
 #include <string.h>
 #include <math.h>
@@ -34,7 +35,7 @@ vad_handle_t vad_init(const vad_config_t *config)
         return NULL;
     }
     
-    struct vad_instance *vad = heap_caps_malloc(sizeof(struct vad_instance), MALLOC_CAP_DEFAULT);
+    struct vad_instance *vad = howdy_mem_alloc(HOWDY_MEM_HOT, sizeof(struct vad_instance));
     if (!vad) {
         ESP_LOGE(TAG, "Failed to allocate VAD instance");
         return NULL;
@@ -58,7 +59,7 @@ esp_err_t vad_deinit(vad_handle_t handle)
     }
     
     ESP_LOGI(TAG, "VAD deinitialized - total detections: %lu", handle->detection_count);
-    heap_caps_free(handle);
+    howdy_mem_free(handle);
     return ESP_OK;
 }
 
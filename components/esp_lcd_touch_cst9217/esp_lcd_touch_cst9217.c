@@ -7,9 +7,11 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <stdatomic.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
+#include "esp_attr.h"
 #include "esp_err.h"
 #include "esp_log.h"
 #include "esp_check.h"
@@ -32,6 +34,45 @@ static const char *TAG = "CST9217";
 #define CST9217_MAX_TOUCH_POINTS 1
 #define CST9217_DATA_LENGTH (CST9217_MAX_TOUCH_POINTS * 5 + 5)
 
+/* Interrupt mode */
+#define CST9217_QUEUE_LEN           16      // Power of two
+#define CST9217_RELEASE_CHECK_MS    60      // Re-read if INT goes quiet with a finger down
+#define CST9217_RETRY_MS            10      // Queue full: retry the held sample this often
+#define CST9217_TASK_STACK          3072
+#define CST9217_TASK_PRIORITY       5       // Above the LVGL task, below the audio stages
+#define CST9217_TASK_CORE           0
+
+#ifndef CONFIG_ESP_LCD_TOUCH_CST9217_INT_GPIO
+#define CONFIG_ESP_LCD_TOUCH_CST9217_INT_GPIO -1
+#endif
+
+/* One read of the point registers */
+typedef struct {
+    uint8_t points;
+    uint16_t x[CST9217_MAX_TOUCH_POINTS];
+    uint16_t y[CST9217_MAX_TOUCH_POINTS];
+} cst9217_sample_t;
+
+/*
+ * Driver state behind the generic handle. In interrupt mode the INT edge
+ * wakes a task that does the I2C read and queues the sample; the indev
+ * read (LVGL task) only drains the queue. Single producer, single
+ * consumer: the task writes head, the reader writes tail.
+ */
+typedef struct {
+    esp_lcd_touch_t base;           // Must be first: the handle points here
+    gpio_num_t int_gpio;            // GPIO_NUM_NC when polling
+    TaskHandle_t task;
+    volatile bool stopping;
+    cst9217_sample_t queue[CST9217_QUEUE_LEN];
+    atomic_uint head;
+    atomic_uint tail;
+    bool down;                      // Reader: press state last handed to LVGL
+    esp_lcd_touch_cst9217_stats_t stats;
+} cst9217_dev_t;
+
+static cst9217_dev_t *s_last_dev;   // For get_stats(NULL, ...)
+
 /*******************************************************************************
  * Function definitions
  *******************************************************************************/
@@ -42,6 +83,8 @@ static esp_err_t cst9217_read_reg(esp_lcd_touch_handle_t tp, uint16_t reg, uint8
 static esp_err_t cst9217_write_reg(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t *data, size_t len);
 static esp_err_t cst9217_reset(esp_lcd_touch_handle_t tp);
 static esp_err_t cst9217_read_config(esp_lcd_touch_handle_t tp);
+static esp_err_t cst9217_int_start(cst9217_dev_t *dev);
+static void cst9217_int_stop(cst9217_dev_t *dev);
 
 /*******************************************************************************
  * Public API functions
@@ -55,8 +98,10 @@ esp_err_t esp_lcd_touch_new_i2c_cst9217(const esp_lcd_panel_io_handle_t io, cons
     ESP_RETURN_ON_FALSE(io && config && out_touch, ESP_ERR_INVALID_ARG, TAG, "Invalid arguments");
 
     /* Allocate memory for controller */
-    cst9217 = heap_caps_calloc(1, sizeof(esp_lcd_touch_t), MALLOC_CAP_DEFAULT);
-    ESP_RETURN_ON_FALSE(cst9217, ESP_ERR_NO_MEM, TAG, "No memory for CST9217");
+    cst9217_dev_t *dev = heap_caps_calloc(1, sizeof(cst9217_dev_t), MALLOC_CAP_DEFAULT);
+    ESP_RETURN_ON_FALSE(dev, ESP_ERR_NO_MEM, TAG, "No memory for CST9217");
+    dev->int_gpio = GPIO_NUM_NC;
+    cst9217 = &dev->base;
 
     /* Communication interface */
     cst9217->io = io;
@@ -88,6 +133,14 @@ esp_err_t esp_lcd_touch_new_i2c_cst9217(const esp_lcd_panel_io_handle_t io, cons
     /* Read chip configuration */
     ESP_GOTO_ON_ERROR(cst9217_read_config(cst9217), err, TAG, "Read config failed");
 
+#if CONFIG_ESP_LCD_TOUCH_CST9217_INT_MODE
+    /* Read on the INT pin; without one, keep polling */
+    if (cst9217_int_start(dev) != ESP_OK) {
+        ESP_LOGW(TAG, "No usable INT pin, polling on every indev read");
+    }
+#endif
+
+    s_last_dev = dev;
     *out_touch = cst9217;
     return ESP_OK;
 
@@ -103,11 +156,14 @@ err:
  * Private functions
  *******************************************************************************/
 
-static esp_err_t esp_lcd_touch_cst9217_read_data(esp_lcd_touch_handle_t tp)
+/* I2C read and parse of the point registers */
+static esp_err_t cst9217_read_points(esp_lcd_touch_handle_t tp, cst9217_sample_t *sample)
 {
+    cst9217_dev_t *dev = __containerof(tp, cst9217_dev_t, base);
     uint8_t data[CST9217_DATA_LENGTH] = {0};
     esp_err_t ret = ESP_OK;
 
+    dev->stats.i2c_reads++;
     ESP_GOTO_ON_ERROR(
         cst9217_read_reg(tp, ESP_LCD_TOUCH_CST9217_DATA_REG, data, sizeof(data)),
         err, TAG, "Read data failed");
@@ -120,22 +176,19 @@ static esp_err_t esp_lcd_touch_cst9217_read_data(esp_lcd_touch_handle_t tp)
     uint8_t points = data[5] & 0x7F;
     points = (points > CST9217_MAX_TOUCH_POINTS) ? CST9217_MAX_TOUCH_POINTS : points;
 
-    portENTER_CRITICAL(&tp->data.lock);
-    tp->data.points = 0;
+    sample->points = 0;
     for (int i = 0; i < points; i++) {
         uint8_t *p = &data[i * 5 + (i ? 2 : 0)];
         uint8_t status = p[0] & 0x0F;
 
         if (status == 0x06) {
-            tp->data.coords[i].x = ((p[1] << 4) | (p[3] >> 4));
-            tp->data.coords[i].y = ((p[2] << 4) | (p[3] & 0x0F));
-            tp->data.points++;
-
+            sample->x[sample->points] = ((p[1] << 4) | (p[3] >> 4));
+            sample->y[sample->points] = ((p[2] << 4) | (p[3] & 0x0F));
             ESP_LOGV(TAG, "Point %d: X=%d, Y=%d",
-                    i, tp->data.coords[i].x, tp->data.coords[i].y);
+                    i, sample->x[sample->points], sample->y[sample->points]);
+            sample->points++;
         }
     }
-    portEXIT_CRITICAL(&tp->data.lock);
 
     return ret;
 
@@ -149,6 +202,200 @@ err:
     return ESP_FAIL;
 }
 
+static void cst9217_store_points(esp_lcd_touch_handle_t tp, const cst9217_sample_t *sample)
+{
+    portENTER_CRITICAL(&tp->data.lock);
+    tp->data.points = sample->points;
+    for (int i = 0; i < sample->points; i++) {
+        tp->data.coords[i].x = sample->x[i];
+        tp->data.coords[i].y = sample->y[i];
+    }
+    portEXIT_CRITICAL(&tp->data.lock);
+}
+
+/*
+ * Hand LVGL the queued samples. Moves between two indev reads collapse
+ * into the latest position, but a press or release is never merged past:
+ * each read delivers at most one change of press state, so a tap shorter
+ * than the indev period still arrives as a press followed by a release.
+ */
+static void cst9217_drain_queue(cst9217_dev_t *dev)
+{
+    unsigned tail = atomic_load_explicit(&dev->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&dev->head, memory_order_acquire);
+    const cst9217_sample_t *latest = NULL;
+
+    if (tail == head) {
+        dev->stats.reads_skipped++;
+        return;
+    }
+    while (tail != head) {
+        const cst9217_sample_t *next = &dev->queue[tail % CST9217_QUEUE_LEN];
+        bool down = next->points > 0;
+        if (latest && down != dev->down) {
+            break;
+        }
+        if (latest) {
+            dev->stats.coalesced++;
+        }
+        if (down != dev->down) {
+            dev->stats.transitions++;
+        }
+        latest = next;
+        dev->down = down;
+        tail++;
+    }
+
+    cst9217_store_points(&dev->base, latest);
+    atomic_store_explicit(&dev->tail, tail, memory_order_release);
+}
+
+static esp_err_t esp_lcd_touch_cst9217_read_data(esp_lcd_touch_handle_t tp)
+{
+    cst9217_dev_t *dev = __containerof(tp, cst9217_dev_t, base);
+
+    if (dev->task) {
+        /* Interrupt mode: no I2C here */
+        cst9217_drain_queue(dev);
+        return ESP_OK;
+    }
+
+    cst9217_sample_t sample;
+    esp_err_t ret = cst9217_read_points(tp, &sample);
+    if (ret == ESP_OK) {
+        cst9217_store_points(tp, &sample);
+    }
+    return ret;
+}
+
+static bool cst9217_queue_push(cst9217_dev_t *dev, const cst9217_sample_t *sample)
+{
+    unsigned head = atomic_load_explicit(&dev->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&dev->tail, memory_order_acquire);
+    if (head - tail == CST9217_QUEUE_LEN) {
+        return false;
+    }
+    dev->queue[head % CST9217_QUEUE_LEN] = *sample;
+    atomic_store_explicit(&dev->head, head + 1, memory_order_release);
+    dev->stats.samples++;
+    return true;
+}
+
+static void IRAM_ATTR cst9217_isr(void *arg)
+{
+    cst9217_dev_t *dev = arg;
+    BaseType_t woken = pdFALSE;
+
+    dev->stats.interrupts++;
+    vTaskNotifyGiveFromISR(dev->task, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void cst9217_touch_task(void *arg)
+{
+    cst9217_dev_t *dev = arg;
+    cst9217_sample_t sample;
+    bool held = false;              // A sample the full queue refused
+    bool down = false;
+
+    while (!dev->stopping) {
+        /* While a finger is down, make sure a lost release edge can't leave it stuck */
+        TickType_t wait = held ? pdMS_TO_TICKS(CST9217_RETRY_MS) :
+                          down ? pdMS_TO_TICKS(CST9217_RELEASE_CHECK_MS) : portMAX_DELAY;
+        uint32_t edges = ulTaskNotifyTake(pdTRUE, wait);
+        if (dev->stopping) {
+            break;
+        }
+
+        if (edges || !held) {
+            /* One burst read per wake, however many edges arrived meanwhile */
+            if (cst9217_read_points(&dev->base, &sample) != ESP_OK) {
+                continue;
+            }
+            if (held) {
+                dev->stats.overflows++;     // The newer sample replaces the held one
+            }
+            down = sample.points > 0;
+        }
+        held = !cst9217_queue_push(dev, &sample);
+    }
+
+    dev->task = NULL;
+    vTaskDelete(NULL);
+}
+
+static esp_err_t cst9217_int_start(cst9217_dev_t *dev)
+{
+    esp_lcd_touch_handle_t tp = &dev->base;
+    gpio_num_t pin = CONFIG_ESP_LCD_TOUCH_CST9217_INT_GPIO >= 0 ?
+                     (gpio_num_t)CONFIG_ESP_LCD_TOUCH_CST9217_INT_GPIO : tp->config.int_gpio_num;
+    if (pin == GPIO_NUM_NC) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    gpio_config_t int_gpio_cfg = {
+        .pin_bit_mask = BIT64(pin),
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = tp->config.levels.interrupt ? GPIO_PULLUP_DISABLE : GPIO_PULLUP_ENABLE,
+        .intr_type = tp->config.levels.interrupt ? GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE,
+    };
+    ESP_RETURN_ON_ERROR(gpio_config(&int_gpio_cfg), TAG, "INT GPIO config failed");
+
+    esp_err_t ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        return ret;     // INVALID_STATE: already installed by someone else
+    }
+
+    if (xTaskCreatePinnedToCore(cst9217_touch_task, "touch_cst9217", CST9217_TASK_STACK, dev,
+                                CST9217_TASK_PRIORITY, &dev->task, CST9217_TASK_CORE) != pdPASS) {
+        dev->task = NULL;
+        gpio_reset_pin(pin);
+        return ESP_ERR_NO_MEM;
+    }
+    dev->int_gpio = pin;
+    ret = gpio_isr_handler_add(pin, cst9217_isr, dev);
+    if (ret != ESP_OK) {
+        cst9217_int_stop(dev);
+        return ret;
+    }
+
+    /*
+     * The pin is ours now. Hide it from esp_lcd_touch and the LVGL port so
+     * neither registers its own handler over this one.
+     */
+    tp->config.int_gpio_num = GPIO_NUM_NC;
+    dev->stats.interrupt_mode = true;
+    ESP_LOGI(TAG, "Interrupt mode on GPIO %d", pin);
+    return ESP_OK;
+}
+
+static void cst9217_int_stop(cst9217_dev_t *dev)
+{
+    if (dev->int_gpio != GPIO_NUM_NC) {
+        gpio_isr_handler_remove(dev->int_gpio);
+        gpio_reset_pin(dev->int_gpio);
+        dev->int_gpio = GPIO_NUM_NC;
+    }
+    if (dev->task) {
+        dev->stopping = true;
+        xTaskNotifyGive(dev->task);
+        while (dev->task) {
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
+    }
+    dev->stats.interrupt_mode = false;
+}
+
+esp_err_t esp_lcd_touch_cst9217_get_stats(esp_lcd_touch_handle_t tp, esp_lcd_touch_cst9217_stats_t *stats)
+{
+    cst9217_dev_t *dev = tp ? __containerof(tp, cst9217_dev_t, base) : s_last_dev;
+    ESP_RETURN_ON_FALSE(dev && stats, ESP_ERR_INVALID_ARG, TAG, "No CST9217");
+    *stats = dev->stats;
+    return ESP_OK;
+}
+
 static bool esp_lcd_touch_cst9217_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
 {
     assert(tp && x && y && point_num);
@@ -170,6 +417,12 @@ static bool esp_lcd_touch_cst9217_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x,
 
 static esp_err_t esp_lcd_touch_cst9217_del(esp_lcd_touch_handle_t tp)
 {
+    cst9217_dev_t *dev = __containerof(tp, cst9217_dev_t, base);
+    cst9217_int_stop(dev);
+    if (s_last_dev == dev)
+    {
+        s_last_dev = NULL;
+    }
     if (tp->config.rst_gpio_num != GPIO_NUM_NC)
     {
         gpio_reset_pin(tp->config.rst_gpio_num);
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include "esp_lcd_touch.h"
 
 #ifdef __cplusplus
@@ -21,6 +22,33 @@ extern "C" {
 
 esp_err_t esp_lcd_touch_new_i2c_cst9217(const esp_lcd_panel_io_handle_t io, const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch);
 
+/**
+ * @brief Touch read counters since the controller was created
+ *
+ * In interrupt mode (CONFIG_ESP_LCD_TOUCH_CST9217_INT_MODE with an INT pin)
+ * the I2C bus is only read after an INT edge, and esp_lcd_touch_read_data()
+ * drains a queue of those reads instead of touching the bus.
+ */
+typedef struct {
+    bool interrupt_mode;        ///< INT pin claimed; false means polling
+    uint32_t interrupts;        ///< INT edges seen
+    uint32_t i2c_reads;         ///< Point register reads on the bus
+    uint32_t samples;           ///< Reads queued for the indev
+    uint32_t coalesced;         ///< Queued moves merged into a later one
+    uint32_t transitions;       ///< Press/release changes handed over
+    uint32_t overflows;         ///< Samples replaced because the queue was full
+    uint32_t reads_skipped;     ///< Indev reads that found nothing new, no I2C
+} esp_lcd_touch_cst9217_stats_t;
+
+/**
+ * @brief Copy the read counters
+ *
+ * @param tp Touch handle, or NULL for the most recently created CST9217
+ * @param stats Filled in
+ * @return ESP_OK, ESP_ERR_INVALID_ARG without a controller
+ */
+esp_err_t esp_lcd_touch_cst9217_get_stats(esp_lcd_touch_handle_t tp, esp_lcd_touch_cst9217_stats_t *stats);
+
 #define ESP_LCD_TOUCH_IO_I2C_CST9217_ADDRESS    (0x5A)
 
 #define ESP_LCD_TOUCH_IO_I2C_CST9217_CONFIG()             \
@@ -1,18 +1,31 @@
-/* Combined header for all Howdy images */
-#pragma once
+/* Auto-generated by tools/convert_images_to_lvgl.py --pack */
+/* IDs of the images in howdy_assets.bin; load them with howdy_asset_img() */
 
-#include "lvgl.h"
+#pragma once
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-#include "howdy_img_howdybackward.h"
-#include "howdy_img_howdyleft.h"
-#include "howdy_img_howdyright2.h"
-#include "howdy_img_armraisehowdy.h"
-#include "howdy_img_howdyright.h"
-#include "howdy_img_howdymidget.h"
+typedef enum {
+    HOWDY_IMG_ARMRAISEHOWDY,
+    HOWDY_IMG_HOWDYBACKWARD,
+    HOWDY_IMG_HOWDYLEFT,
+    HOWDY_IMG_HOWDYMIDGET,
+    HOWDY_IMG_HOWDYRIGHT,
+    HOWDY_IMG_HOWDYRIGHT2,
+    HOWDY_IMG_COUNT
+} howdy_img_id_t;
+
+/* Pack entry name for each ID, in ID order */
+#define HOWDY_IMG_NAMES { \
+    "armraisehowdy", \
+    "howdybackward", \
+    "howdyleft", \
+    "howdymidget", \
+    "howdyright", \
+    "howdyright2", \
+}
 
 #ifdef __cplusplus
 }
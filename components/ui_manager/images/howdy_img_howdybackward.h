@@ -1,16 +0,0 @@
-/* Auto-generated LVGL image data from howdybackward.png */
-/* Original size: 1024x1024, Scaled: 128x128 */
-
-#pragma once
-
-#include "lvgl.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-extern const lv_img_dsc_t howdy_img_howdybackward;
-
-#ifdef __cplusplus
-}
-#endif
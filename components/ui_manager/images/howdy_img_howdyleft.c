@@ -1,2068 +0,0 @@
-/* Auto-generated LVGL image data from HowdyLeft.png */
-/* Original size: 1024x1024, Scaled: 128x128 */
-
-#include "howdy_img_howdyleft.h"
-
-/* Image data in RGB565 format */
-static const uint8_t howdy_img_howdyleft_data[] = {
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x39, 0x42, 0x72, 0x22, 0x6A, 0x43, 0x72, 0xE2, 0x61, 0xC2, 0x59, 
-    0xE2, 0x61, 0xC2, 0x59, 0x22, 0x41, 0x01, 0x39, 0x02, 0x41, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC3, 0x8A, 0xC5, 0xEC, 0x64, 0xDC, 0x44, 0xD4, 0x22, 0xAB, 0x02, 0xA3, 
-    0x22, 0xAB, 0xA2, 0x9A, 0x62, 0x69, 0x82, 0x69, 0xA2, 0x71, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x7A, 0x44, 0xD4, 0x04, 0xC4, 0xE4, 0xC3, 0xE2, 0x9A, 0xC2, 0x9A, 
-    0xE2, 0x9A, 0x62, 0x8A, 0x41, 0x59, 0x61, 0x61, 0x82, 0x69, 0xA1, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA3, 0x82, 0x44, 0xDC, 0x04, 0xC4, 0xE4, 0xC3, 0xE2, 0xA2, 0xC2, 0x9A, 
-    0x02, 0xA3, 0x82, 0x92, 0x62, 0x61, 0x61, 0x61, 0x82, 0x69, 0xC1, 0x28, 0x20, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x30, 0x62, 0x92, 
-    0x42, 0x8A, 0x62, 0x92, 0xE2, 0x79, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 
-    0xE2, 0x79, 0xC2, 0x71, 0x42, 0x59, 0x42, 0x61, 0x41, 0x61, 0x42, 0x59, 0x42, 0x59, 0x42, 0x59, 
-    0x42, 0x51, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x41, 0xE2, 0xBA, 
-    0xA2, 0xAA, 0xC2, 0xB2, 0xC1, 0x79, 0x41, 0x61, 0x61, 0x61, 0x61, 0x61, 0xA2, 0x69, 0xA2, 0x69, 
-    0xA1, 0x69, 0x81, 0x69, 0x42, 0x59, 0x41, 0x59, 0x41, 0x61, 0x41, 0x61, 0x41, 0x61, 0x41, 0x61, 
-    0x42, 0x59, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0xE2, 0xB2, 
-    0x82, 0xA2, 0xA2, 0xAA, 0xC2, 0x79, 0x61, 0x61, 0x61, 0x69, 0x61, 0x61, 0xA2, 0x69, 0xA2, 0x69, 
-    0xA2, 0x71, 0x81, 0x69, 0x41, 0x59, 0x41, 0x59, 0x41, 0x59, 0x41, 0x59, 0x41, 0x59, 0x41, 0x61, 
-    0x42, 0x59, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x28, 0xC0, 0x28, 0xA0, 0x28, 0x62, 0x51, 0x62, 0x9A, 
-    0x22, 0x92, 0x42, 0x92, 0xC2, 0x79, 0x82, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xC2, 0x71, 0xC2, 0x71, 
-    0xC2, 0x71, 0xA2, 0x69, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x41, 0x59, 0x42, 0x61, 
-    0x42, 0x59, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x08, 0x42, 0x10, 0x22, 0x10, 0x42, 0x18, 0x83, 0x30, 0x83, 0x30, 0x83, 0x30, 0xA3, 0x30, 
-    0x01, 0x31, 0xE1, 0x30, 0xC1, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x82, 0x9A, 0xA2, 0xA2, 0xC2, 0xAA, 0x22, 0x8A, 0x01, 0x51, 
-    0x41, 0x59, 0x21, 0x59, 0xC2, 0x71, 0x02, 0x7A, 0x02, 0x7A, 0x02, 0x7A, 0x02, 0x7A, 0x02, 0x7A, 
-    0x22, 0x7A, 0xE2, 0x79, 0xA2, 0x69, 0xC2, 0x71, 0xC2, 0x71, 0x82, 0x69, 0x41, 0x59, 0x41, 0x61, 
-    0x42, 0x59, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA6, 0x38, 0xE9, 0x50, 0xC9, 0x48, 0xE9, 0x58, 0x29, 0x99, 0x29, 0xA1, 0x09, 0x99, 0x87, 0xA1, 
-    0xA2, 0xA2, 0x82, 0xA2, 0xC3, 0xAA, 0xC1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x62, 0x8A, 0x82, 0x9A, 0x82, 0x9A, 0x02, 0x82, 0x21, 0x59, 
-    0x42, 0x61, 0x41, 0x59, 0xC2, 0x71, 0x02, 0x7A, 0xE2, 0x79, 0x02, 0x7A, 0x02, 0x7A, 0x02, 0x7A, 
-    0x02, 0x7A, 0xE2, 0x79, 0xA2, 0x69, 0xA2, 0x71, 0xC2, 0x71, 0x82, 0x69, 0x41, 0x59, 0x42, 0x61, 
-    0x42, 0x59, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA6, 0x30, 0xC9, 0x50, 0xC8, 0x48, 0xC8, 0x48, 0xE8, 0x88, 0x08, 0x89, 0xE8, 0x88, 0x67, 0x91, 
-    0x62, 0x92, 0x22, 0x92, 0x63, 0x9A, 0xE1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x8A, 0x82, 0x9A, 0x82, 0x9A, 0x02, 0x82, 0x01, 0x51, 
-    0x42, 0x59, 0x21, 0x51, 0xA2, 0x69, 0x02, 0x7A, 0xE2, 0x79, 0x02, 0x7A, 0x02, 0x7A, 0x02, 0x7A, 
-    0x02, 0x7A, 0xE2, 0x79, 0xA2, 0x69, 0xC2, 0x71, 0xC2, 0x71, 0x82, 0x69, 0x41, 0x61, 0x61, 0x61, 
-    0x62, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x85, 0x30, 0xA9, 0x58, 0xA8, 0x48, 0xA8, 0x50, 0xE8, 0x90, 0xE8, 0x98, 0xC8, 0x98, 0xA8, 0xA1, 
-    0x04, 0xA3, 0x41, 0x9A, 0xA2, 0xA2, 0xE1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0xA2, 0x59, 0x62, 0x51, 0x62, 0x51, 0xA4, 0x30, 0x85, 0x28, 
-    0xA5, 0x28, 0xA5, 0x28, 0xA5, 0x28, 0xA5, 0x28, 0xA6, 0x30, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 
-    0x22, 0x41, 0x01, 0x39, 0x22, 0x41, 0x62, 0x92, 0xA2, 0x9A, 0xA2, 0x9A, 0x62, 0x92, 0xE2, 0x79, 
-    0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 0x02, 0x7A, 0x02, 0x7A, 
-    0x02, 0x7A, 0xE2, 0x79, 0xA2, 0x69, 0xC2, 0x71, 0xC2, 0x71, 0x62, 0x59, 0x22, 0x49, 0x22, 0x49, 
-    0x23, 0x49, 0x03, 0x31, 0xE3, 0x28, 0xE3, 0x28, 0x23, 0x41, 0x82, 0x59, 0x41, 0x49, 0x41, 0x59, 
-    0xE8, 0x39, 0x2C, 0x22, 0x0B, 0x22, 0x0B, 0x2A, 0xAB, 0x51, 0xAA, 0x49, 0xAB, 0x49, 0xCA, 0x59, 
-    0x09, 0x82, 0xA7, 0x71, 0x87, 0x71, 0xC4, 0x69, 0xC2, 0x61, 0xA2, 0x61, 0x82, 0x59, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE1, 0x30, 0xA3, 0xAA, 0x62, 0x9A, 0x82, 0xA2, 0x08, 0x51, 0xA9, 0x40, 
-    0xC9, 0x48, 0xC9, 0x48, 0xC9, 0x48, 0xC9, 0x48, 0xE9, 0x50, 0x83, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x30, 
-    0xC2, 0x79, 0xA2, 0x71, 0xC2, 0x71, 0x82, 0x92, 0xA2, 0x9A, 0xA2, 0x92, 0x82, 0x9A, 0x82, 0x9A, 
-    0x82, 0x9A, 0x82, 0x9A, 0x02, 0x82, 0xE2, 0x71, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 0x02, 0x7A, 
-    0x02, 0x7A, 0xE2, 0x79, 0xA2, 0x69, 0xA2, 0x69, 0xC2, 0x71, 0x43, 0x51, 0xE3, 0x38, 0x03, 0x39, 
-    0x03, 0x39, 0x23, 0x41, 0x24, 0x41, 0x04, 0x39, 0xA3, 0x69, 0xA2, 0xAA, 0x83, 0xA2, 0x62, 0xB2, 
-    0xEA, 0x3A, 0x2F, 0x03, 0x2E, 0x03, 0x0E, 0x03, 0x4C, 0x12, 0x4C, 0x12, 0x8C, 0x0A, 0xEC, 0x21, 
-    0xCA, 0x58, 0xEA, 0x50, 0xCB, 0x50, 0xE5, 0x89, 0xA2, 0xA2, 0xC4, 0xAA, 0xC4, 0x9A, 0x40, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE2, 0x30, 0x63, 0x9A, 0x22, 0x8A, 0x42, 0x92, 0xE7, 0x48, 0xA8, 0x38, 
-    0xA8, 0x40, 0xA8, 0x40, 0xC8, 0x40, 0xA8, 0x40, 0xC9, 0x48, 0x63, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x30, 
-    0xA2, 0x71, 0x82, 0x61, 0x82, 0x69, 0x82, 0x92, 0xA2, 0x9A, 0x82, 0x9A, 0x62, 0x9A, 0x62, 0x9A, 
-    0x62, 0x92, 0x62, 0x9A, 0x02, 0x82, 0xE2, 0x71, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x79, 
-    0xE2, 0x79, 0xE2, 0x79, 0xA2, 0x71, 0xA2, 0x71, 0xC2, 0x71, 0x43, 0x51, 0x03, 0x39, 0x03, 0x41, 
-    0x03, 0x39, 0x03, 0x39, 0x03, 0x39, 0xE3, 0x30, 0x83, 0x61, 0x62, 0x9A, 0x42, 0x92, 0x41, 0xA2, 
-    0xA9, 0x3A, 0x0E, 0x03, 0xED, 0x0A, 0xED, 0x0A, 0x4C, 0x1A, 0x4C, 0x1A, 0x6C, 0x12, 0xEB, 0x29, 
-    0xEA, 0x60, 0x0A, 0x59, 0xEA, 0x58, 0xE5, 0x81, 0xA3, 0x9A, 0x83, 0x9A, 0x63, 0x8A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x39, 0x83, 0x9A, 0x22, 0x92, 0x23, 0x92, 0xE8, 0x48, 0xC8, 0x38, 
-    0xC8, 0x40, 0xC8, 0x40, 0xC8, 0x40, 0xC8, 0x40, 0xE9, 0x48, 0x84, 0x18, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x39, 
-    0xC3, 0x71, 0x62, 0x69, 0xA2, 0x71, 0x63, 0x8A, 0x83, 0x8A, 0x83, 0x8A, 0x63, 0x92, 0x43, 0x9A, 
-    0x42, 0x92, 0x42, 0x9A, 0x02, 0x82, 0xC2, 0x71, 0xC3, 0x79, 0xE3, 0x79, 0x03, 0x72, 0x03, 0x72, 
-    0x03, 0x72, 0xE3, 0x69, 0xC3, 0x69, 0xA3, 0x69, 0xC3, 0x69, 0x43, 0x51, 0xE4, 0x38, 0x04, 0x41, 
-    0x03, 0x41, 0x23, 0x41, 0x23, 0x41, 0x04, 0x39, 0x83, 0x61, 0x63, 0x9A, 0x43, 0x92, 0x42, 0xA2, 
-    0xA9, 0x42, 0x0E, 0x03, 0x0D, 0x0B, 0xED, 0x0A, 0x2C, 0x1A, 0x2C, 0x1A, 0x4C, 0x1A, 0xEB, 0x29, 
-    0xEA, 0x58, 0x0A, 0x59, 0xEA, 0x50, 0x67, 0x8A, 0x83, 0x92, 0x63, 0x92, 0xA5, 0x8A, 0x81, 0x18, 
-    0x40, 0x08, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x20, 0x09, 0x59, 0xE8, 0x50, 0x08, 0x51, 0x8A, 0x21, 0x8A, 0x19, 
-    0xAA, 0x21, 0x69, 0x21, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0x68, 0x19, 0x69, 0x19, 0x89, 0x21, 
-    0x27, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x30, 
-    0x28, 0x71, 0xE7, 0x68, 0x08, 0x69, 0x4B, 0x22, 0x4B, 0x1A, 0x6B, 0x1A, 0x0A, 0x3A, 0x28, 0x99, 
-    0x28, 0x91, 0x28, 0x91, 0x28, 0x91, 0x28, 0x91, 0x08, 0x91, 0x28, 0x89, 0x2B, 0x22, 0x2B, 0x1A, 
-    0x2B, 0x22, 0x0A, 0x22, 0xA9, 0x19, 0xA8, 0x19, 0xC8, 0x19, 0x07, 0x31, 0xA6, 0x40, 0xA7, 0x38, 
-    0xC6, 0x40, 0x23, 0x8A, 0x22, 0x92, 0x42, 0x92, 0xA4, 0x71, 0xC7, 0x48, 0xE7, 0x50, 0xC6, 0x50, 
-    0xA9, 0x29, 0x2B, 0x12, 0x2B, 0x12, 0x0B, 0x1A, 0x2B, 0x59, 0x0B, 0x61, 0x0B, 0x61, 0x4B, 0x51, 
-    0x0B, 0x1A, 0x0B, 0x22, 0x0B, 0x1A, 0xEA, 0x21, 0xC9, 0x21, 0xCA, 0x21, 0xC9, 0x29, 0xC3, 0x71, 
-    0xC2, 0x71, 0xE3, 0x79, 0x22, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x63, 0x18, 0xE9, 0x50, 0xC8, 0x40, 0xC9, 0x48, 0x8A, 0x21, 0xAA, 0x19, 
-    0xAA, 0x19, 0x89, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x69, 0x19, 0x89, 0x19, 0x8A, 0x19, 
-    0x27, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 
-    0x09, 0x71, 0xE8, 0x68, 0x08, 0x61, 0x2C, 0x1A, 0x4C, 0x12, 0x4C, 0x0A, 0x0B, 0x32, 0x09, 0x91, 
-    0x09, 0x91, 0x09, 0x91, 0x09, 0x91, 0x09, 0x91, 0x09, 0x91, 0x29, 0x81, 0x2B, 0x22, 0x2B, 0x1A, 
-    0x2B, 0x1A, 0x0A, 0x1A, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x11, 0x08, 0x31, 0xA7, 0x40, 0xA7, 0x40, 
-    0xC6, 0x40, 0x22, 0x8A, 0x42, 0x92, 0x62, 0x9A, 0xA4, 0x71, 0xA8, 0x40, 0xC7, 0x48, 0xA7, 0x48, 
-    0x69, 0x29, 0x0B, 0x12, 0x0B, 0x12, 0xEB, 0x19, 0x0A, 0x61, 0xEA, 0x60, 0xEA, 0x68, 0x2B, 0x51, 
-    0x4B, 0x12, 0x2B, 0x1A, 0x2B, 0x1A, 0xCA, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x19, 0xA2, 0x71, 
-    0xA1, 0x71, 0xC2, 0x79, 0x22, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x63, 0x18, 0xE9, 0x48, 0xC8, 0x40, 0xC8, 0x40, 0x8A, 0x21, 0xAA, 0x19, 
-    0xAA, 0x19, 0x89, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x68, 0x19, 0x89, 0x19, 0x8A, 0x19, 
-    0x27, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 
-    0x09, 0x69, 0xC8, 0x60, 0xE8, 0x60, 0x2C, 0x1A, 0x6C, 0x0A, 0x6C, 0x02, 0x0B, 0x32, 0xE8, 0xA0, 
-    0xE8, 0x98, 0xE8, 0x98, 0xE8, 0x98, 0x08, 0x99, 0xE8, 0x98, 0x29, 0x89, 0x4B, 0x1A, 0x4B, 0x12, 
-    0x4B, 0x1A, 0x0A, 0x1A, 0xA9, 0x11, 0xA9, 0x11, 0xC9, 0x11, 0x08, 0x29, 0x87, 0x38, 0x87, 0x38, 
-    0xA7, 0x40, 0x63, 0x9A, 0x42, 0x9A, 0x62, 0xA2, 0xA4, 0x79, 0x87, 0x40, 0xC7, 0x48, 0x86, 0x48, 
-    0x69, 0x29, 0x2B, 0x0A, 0x2B, 0x0A, 0x0B, 0x12, 0x0B, 0x61, 0xEA, 0x68, 0xCA, 0x68, 0x4B, 0x51, 
-    0x4C, 0x12, 0x2B, 0x12, 0x4B, 0x12, 0xCA, 0x19, 0x89, 0x19, 0x89, 0x11, 0x89, 0x19, 0xA2, 0x71, 
-    0xA1, 0x71, 0xC1, 0x79, 0x42, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x63, 0x20, 0x09, 0x69, 0xE8, 0x58, 0xE8, 0x58, 0x69, 0x21, 0x89, 0x19, 
-    0x89, 0x19, 0x68, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 
-    0x27, 0x19, 0xA3, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xC3, 0x18, 0xA3, 0x10, 0x45, 0x49, 
-    0x86, 0x81, 0x66, 0x71, 0x86, 0x79, 0xAA, 0x51, 0xAA, 0x51, 0xAA, 0x51, 0xCA, 0x51, 0xA9, 0x59, 
-    0xAA, 0x59, 0xAA, 0x59, 0x89, 0x59, 0x69, 0x59, 0x69, 0x59, 0x69, 0x59, 0xAA, 0x41, 0xAA, 0x39, 
-    0xAA, 0x39, 0x89, 0x31, 0x48, 0x29, 0x48, 0x29, 0x28, 0x29, 0x87, 0x51, 0xA5, 0x69, 0x85, 0x61, 
-    0xC6, 0x69, 0x87, 0x6A, 0x05, 0x62, 0xE4, 0x61, 0xA6, 0x51, 0x29, 0x39, 0x48, 0x39, 0x48, 0x39, 
-    0x69, 0x39, 0x8A, 0x39, 0x8A, 0x39, 0x8A, 0x39, 0x4A, 0x41, 0x4A, 0x41, 0x4A, 0x41, 0x6A, 0x39, 
-    0xAB, 0x31, 0xAB, 0x31, 0xAB, 0x31, 0xAA, 0x21, 0xAA, 0x11, 0xAA, 0x11, 0xAA, 0x19, 0x45, 0x61, 
-    0x44, 0x61, 0x65, 0x69, 0x03, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x30, 0x2A, 0x99, 0x09, 0x89, 0x09, 0x91, 0x48, 0x29, 0x68, 0x11, 
-    0x68, 0x19, 0x48, 0x19, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 
-    0xE6, 0x18, 0x06, 0x21, 0x06, 0x21, 0x06, 0x21, 0x06, 0x21, 0x06, 0x21, 0x06, 0x11, 0xC4, 0x51, 
-    0xA2, 0xA2, 0x62, 0x92, 0x62, 0x9A, 0x08, 0x99, 0xE8, 0x98, 0xE8, 0xA0, 0x69, 0x71, 0xAB, 0x02, 
-    0x6B, 0x12, 0x8B, 0x0A, 0x0A, 0x0A, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x11, 0xE9, 0x60, 0xE8, 0x68, 
-    0xE9, 0x68, 0xE8, 0x58, 0xA7, 0x40, 0xA7, 0x40, 0x87, 0x38, 0x05, 0x72, 0xC1, 0x9A, 0xA2, 0x92, 
-    0xA3, 0x8A, 0x88, 0x19, 0x48, 0x09, 0x48, 0x09, 0xA9, 0x19, 0x0B, 0x2A, 0x0A, 0x2A, 0x2B, 0x22, 
-    0x4A, 0x51, 0xCA, 0x68, 0xCA, 0x68, 0xEA, 0x60, 0xCA, 0x11, 0xEA, 0x09, 0xEA, 0x09, 0xAA, 0x21, 
-    0xAA, 0x60, 0xCA, 0x58, 0xAA, 0x60, 0x8A, 0x29, 0xEA, 0x11, 0xEA, 0x11, 0xCA, 0x19, 0xCA, 0x40, 
-    0x8A, 0x40, 0xAA, 0x48, 0x86, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x30, 0x29, 0x91, 0x08, 0x81, 0x09, 0x89, 0x48, 0x29, 0x68, 0x11, 
-    0x68, 0x19, 0x48, 0x19, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 0x06, 0x19, 0xE6, 0x18, 0xE6, 0x18, 
-    0xE6, 0x18, 0xE5, 0x18, 0xE5, 0x18, 0xE5, 0x18, 0xC5, 0x18, 0xE5, 0x18, 0xC5, 0x10, 0x84, 0x51, 
-    0x82, 0x9A, 0x42, 0x92, 0x43, 0x92, 0x28, 0x89, 0x09, 0x89, 0x08, 0x91, 0x69, 0x71, 0x6B, 0x12, 
-    0x4A, 0x1A, 0x6B, 0x1A, 0xEA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x21, 0x09, 0x61, 0x09, 0x61, 
-    0x09, 0x61, 0x08, 0x51, 0xC7, 0x38, 0xC7, 0x40, 0xA8, 0x38, 0xE5, 0x71, 0x82, 0x92, 0x62, 0x8A, 
-    0x63, 0x82, 0x88, 0x21, 0x68, 0x19, 0x67, 0x19, 0xA8, 0x21, 0xEA, 0x29, 0xEA, 0x29, 0xEA, 0x29, 
-    0x4A, 0x49, 0xEA, 0x60, 0xEA, 0x60, 0x0A, 0x59, 0xCA, 0x19, 0xCA, 0x11, 0xEA, 0x11, 0x8A, 0x29, 
-    0xCA, 0x58, 0xEA, 0x50, 0xCA, 0x58, 0x8A, 0x21, 0xEA, 0x11, 0xEA, 0x11, 0xCA, 0x19, 0xC9, 0x48, 
-    0xA9, 0x48, 0xCA, 0x48, 0xA6, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x30, 0x4A, 0xA1, 0x29, 0x91, 0x2A, 0x99, 0x89, 0x39, 0xC9, 0x19, 
-    0x89, 0x19, 0x68, 0x19, 0x06, 0x19, 0x06, 0x19, 0x06, 0x19, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 
-    0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 0xE5, 0x18, 0xE5, 0x18, 0xE5, 0x18, 0xC6, 0x10, 0xA4, 0x51, 
-    0x82, 0xA2, 0x62, 0x9A, 0x42, 0x9A, 0x08, 0x91, 0x09, 0x91, 0xE8, 0xA0, 0x69, 0x71, 0x8B, 0x12, 
-    0x6B, 0x1A, 0x8B, 0x1A, 0x0A, 0x12, 0xCA, 0x11, 0xEA, 0x11, 0xEA, 0x19, 0x09, 0x61, 0xE9, 0x60, 
-    0x09, 0x61, 0xE8, 0x58, 0xA7, 0x40, 0xA7, 0x40, 0x87, 0x38, 0x04, 0x7A, 0xA2, 0x92, 0x82, 0x92, 
-    0x83, 0x8A, 0x87, 0x21, 0x48, 0x11, 0x47, 0x11, 0xA9, 0x19, 0x0B, 0x2A, 0xEA, 0x29, 0x0A, 0x22, 
-    0x4A, 0x51, 0xCA, 0x68, 0xEA, 0x60, 0xEA, 0x60, 0xCA, 0x19, 0xEA, 0x11, 0xEA, 0x09, 0x8A, 0x21, 
-    0xAA, 0x60, 0xCA, 0x58, 0xAA, 0x60, 0xAA, 0x21, 0x0A, 0x0A, 0xEA, 0x11, 0xCA, 0x11, 0xC9, 0x48, 
-    0x89, 0x48, 0xAA, 0x50, 0x86, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x21, 0x10, 0x84, 0x30, 0x83, 0x30, 0x84, 0x30, 0xA5, 0x82, 0x45, 0x9B, 
-    0x25, 0x9B, 0xC7, 0x82, 0xC8, 0x38, 0xC8, 0x38, 0xA7, 0x38, 0x48, 0x21, 0x88, 0x11, 0x88, 0x11, 
-    0x68, 0x11, 0xE6, 0x18, 0xE6, 0x18, 0xE6, 0x18, 0x47, 0x19, 0x68, 0x21, 0x68, 0x19, 0xC8, 0x21, 
-    0x49, 0x32, 0x48, 0x32, 0x48, 0x32, 0xCA, 0x31, 0xCA, 0x31, 0xCA, 0x31, 0xA9, 0x21, 0x88, 0x11, 
-    0x88, 0x19, 0xA8, 0x11, 0x49, 0x31, 0x29, 0x41, 0x29, 0x39, 0x48, 0x41, 0x04, 0x82, 0x23, 0x8A, 
-    0x23, 0x8A, 0x25, 0x72, 0x2B, 0x2A, 0x0B, 0x32, 0x2B, 0x32, 0xA8, 0x49, 0x26, 0x59, 0x46, 0x59, 
-    0x47, 0x51, 0x89, 0x29, 0xA9, 0x29, 0xA9, 0x21, 0x89, 0x31, 0x08, 0x51, 0x28, 0x49, 0x08, 0x51, 
-    0x69, 0x39, 0xAA, 0x29, 0xAA, 0x29, 0x8A, 0x29, 0x09, 0x41, 0x09, 0x41, 0xE9, 0x40, 0x09, 0x39, 
-    0x6A, 0x21, 0x69, 0x29, 0x6A, 0x21, 0x2A, 0x31, 0xE9, 0x40, 0x0A, 0x41, 0x09, 0x39, 0x29, 0x21, 
-    0x29, 0x21, 0x49, 0x29, 0xE6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x7A, 0x02, 0xAB, 
-    0x01, 0xAB, 0xC5, 0x92, 0xC9, 0x40, 0xA8, 0x40, 0xA8, 0x40, 0x69, 0x21, 0xC9, 0x11, 0xC9, 0x11, 
-    0x89, 0x11, 0xE6, 0x18, 0x06, 0x19, 0xE6, 0x18, 0x68, 0x21, 0xA9, 0x21, 0x89, 0x21, 0xEA, 0x19, 
-    0x2B, 0x0A, 0x2B, 0x0A, 0x2B, 0x0A, 0x0A, 0x0A, 0xEA, 0x09, 0x0A, 0x0A, 0xC9, 0x11, 0x27, 0x19, 
-    0x27, 0x19, 0x47, 0x11, 0xE8, 0x40, 0xC8, 0x50, 0xC8, 0x50, 0xE8, 0x50, 0x42, 0x8A, 0x82, 0x92, 
-    0x61, 0x9A, 0x84, 0x72, 0xAD, 0x22, 0x8C, 0x2A, 0xCD, 0x2A, 0x69, 0x39, 0x87, 0x40, 0xA8, 0x40, 
-    0xC7, 0x40, 0x89, 0x31, 0xA9, 0x29, 0xC9, 0x29, 0x69, 0x39, 0xA7, 0x60, 0xC7, 0x58, 0xA7, 0x60, 
-    0x69, 0x31, 0xEA, 0x11, 0xEA, 0x11, 0xCA, 0x19, 0xC9, 0x50, 0xA9, 0x50, 0xA9, 0x50, 0xE9, 0x40, 
-    0xA9, 0x09, 0x89, 0x11, 0xA9, 0x09, 0x09, 0x39, 0x89, 0x50, 0xA9, 0x48, 0xA9, 0x48, 0x69, 0x11, 
-    0x68, 0x09, 0x89, 0x11, 0x06, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x82, 0x43, 0xB3, 
-    0x22, 0xAB, 0xE5, 0x9A, 0xA9, 0x30, 0xA8, 0x38, 0x88, 0x38, 0x69, 0x19, 0xAA, 0x01, 0xAA, 0x09, 
-    0x69, 0x09, 0xC6, 0x10, 0xE6, 0x10, 0xE6, 0x10, 0x48, 0x19, 0x89, 0x19, 0x89, 0x19, 0xEA, 0x11, 
-    0x4B, 0x0A, 0x2B, 0x0A, 0x2B, 0x0A, 0xEA, 0x09, 0xEA, 0x09, 0xEB, 0x09, 0xAA, 0x09, 0x28, 0x09, 
-    0x28, 0x11, 0x48, 0x09, 0xE8, 0x38, 0xC9, 0x48, 0xC9, 0x48, 0xE8, 0x50, 0x42, 0x92, 0x61, 0x92, 
-    0x61, 0x9A, 0x84, 0x7A, 0xAD, 0x22, 0x8C, 0x2A, 0xAD, 0x2A, 0x89, 0x39, 0xA7, 0x48, 0xC7, 0x48, 
-    0xC7, 0x48, 0xA9, 0x29, 0xC9, 0x29, 0xC9, 0x29, 0x69, 0x39, 0xC8, 0x60, 0xC8, 0x58, 0xA8, 0x60, 
-    0x69, 0x31, 0xEA, 0x11, 0xEA, 0x11, 0xCA, 0x19, 0xC9, 0x50, 0xA9, 0x50, 0xA9, 0x50, 0xE9, 0x40, 
-    0xA9, 0x09, 0x89, 0x11, 0x89, 0x09, 0xE9, 0x38, 0x89, 0x50, 0xA9, 0x48, 0xA9, 0x48, 0x69, 0x19, 
-    0x68, 0x09, 0x89, 0x11, 0x06, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x59, 0x82, 0x8A, 
-    0x62, 0x82, 0x85, 0x82, 0x47, 0x59, 0x26, 0x51, 0x26, 0x59, 0xC7, 0x41, 0x28, 0x32, 0x28, 0x32, 
-    0xE7, 0x31, 0x45, 0x31, 0x45, 0x39, 0x45, 0x39, 0xA6, 0x39, 0xA8, 0x39, 0x69, 0x31, 0xA9, 0x31, 
-    0xEA, 0x29, 0x29, 0x2A, 0x48, 0x32, 0x28, 0x32, 0x08, 0x32, 0x28, 0x32, 0xE8, 0x31, 0x86, 0x39, 
-    0x86, 0x39, 0xA6, 0x31, 0x46, 0x51, 0x27, 0x59, 0x27, 0x59, 0x47, 0x59, 0x44, 0x72, 0x64, 0x72, 
-    0x64, 0x7A, 0x46, 0x62, 0x2B, 0x32, 0x2B, 0x3A, 0x2B, 0x3A, 0x89, 0x39, 0x07, 0x41, 0x08, 0x41, 
-    0x28, 0x41, 0x68, 0x39, 0x69, 0x39, 0x69, 0x39, 0x48, 0x41, 0xE8, 0x48, 0xE8, 0x48, 0xE8, 0x48, 
-    0x49, 0x31, 0xAA, 0x21, 0x8A, 0x21, 0x8A, 0x29, 0x09, 0x41, 0xE9, 0x40, 0xE9, 0x40, 0x09, 0x39, 
-    0x49, 0x21, 0x49, 0x21, 0x49, 0x21, 0xE9, 0x30, 0xC9, 0x40, 0xC9, 0x38, 0xE9, 0x38, 0x29, 0x21, 
-    0x28, 0x19, 0x49, 0x21, 0xE5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x28, 0x83, 0x9A, 0x42, 0x8A, 0x42, 0x8A, 0x03, 0xAB, 0x63, 0xBB, 0x63, 0xBB, 
-    0x22, 0xAB, 0x42, 0x92, 0x62, 0x92, 0x62, 0x92, 0x81, 0x92, 0xE5, 0x89, 0x09, 0x79, 0x29, 0x79, 
-    0x29, 0x79, 0x23, 0x8A, 0x82, 0x92, 0x82, 0x92, 0x82, 0x9A, 0x82, 0x9A, 0x82, 0xA2, 0xA2, 0xA2, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0x42, 0x8A, 0x02, 0x7A, 0x02, 0x82, 0x23, 0x72, 0x2B, 0x1A, 0x2B, 0x12, 
-    0x2C, 0x12, 0xCA, 0x29, 0xA7, 0x58, 0xC7, 0x50, 0xA7, 0x58, 0x68, 0x39, 0xE9, 0x29, 0xC9, 0x29, 
-    0xC9, 0x29, 0xC7, 0x50, 0xA7, 0x58, 0xA7, 0x58, 0xE7, 0x40, 0x47, 0x11, 0x47, 0x19, 0x47, 0x11, 
-    0xE8, 0x38, 0xA8, 0x50, 0xC8, 0x50, 0xC8, 0x48, 0x89, 0x11, 0x89, 0x11, 0x89, 0x09, 0x49, 0x21, 
-    0xA9, 0x50, 0xA9, 0x50, 0xA9, 0x50, 0x29, 0x21, 0x89, 0x11, 0x69, 0x11, 0x89, 0x11, 0xC9, 0x40, 
-    0x88, 0x48, 0xA9, 0x48, 0x85, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xC2, 0x28, 0x43, 0x8A, 0x02, 0x82, 0x02, 0x82, 0xC3, 0x9A, 0x43, 0xAB, 0x23, 0xAB, 
-    0xE2, 0xA2, 0x22, 0x8A, 0x42, 0x8A, 0x22, 0x8A, 0x62, 0x8A, 0xC5, 0x81, 0x09, 0x79, 0x29, 0x79, 
-    0x29, 0x71, 0x23, 0x8A, 0x62, 0x8A, 0x62, 0x8A, 0x62, 0x92, 0x62, 0x92, 0x82, 0x92, 0x82, 0x9A, 
-    0x82, 0x9A, 0x82, 0x9A, 0x22, 0x82, 0xE2, 0x71, 0xE2, 0x79, 0x03, 0x72, 0x2A, 0x1A, 0x0B, 0x1A, 
-    0x2B, 0x1A, 0xCA, 0x29, 0xC7, 0x50, 0xE8, 0x50, 0xC7, 0x50, 0x68, 0x39, 0xC9, 0x29, 0xA9, 0x29, 
-    0xA9, 0x31, 0xE7, 0x50, 0xC7, 0x50, 0xC7, 0x58, 0x07, 0x39, 0x47, 0x11, 0x27, 0x19, 0x47, 0x11, 
-    0xE8, 0x38, 0xC8, 0x50, 0xC8, 0x48, 0xC8, 0x48, 0x69, 0x19, 0x69, 0x11, 0x89, 0x11, 0x49, 0x21, 
-    0xA9, 0x50, 0xC9, 0x48, 0xA9, 0x48, 0x29, 0x21, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 0xC8, 0x38, 
-    0x88, 0x40, 0xA9, 0x48, 0x65, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x28, 0xA4, 0x9A, 0x63, 0x92, 0x43, 0x92, 0x23, 0xB3, 0x83, 0xC3, 0x83, 0xC3, 
-    0x43, 0xB3, 0x83, 0x9A, 0x83, 0x9A, 0x83, 0x9A, 0x62, 0x92, 0xC5, 0x81, 0x0A, 0x79, 0x29, 0x79, 
-    0x49, 0x79, 0x43, 0x8A, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0xA2, 0x9A, 0xA2, 0xA2, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0x42, 0x8A, 0x02, 0x7A, 0x02, 0x82, 0x03, 0x72, 0x2B, 0x1A, 0x2C, 0x12, 
-    0x4C, 0x12, 0xEB, 0x29, 0xC8, 0x58, 0xE8, 0x50, 0xC8, 0x58, 0x68, 0x39, 0xC9, 0x29, 0xC9, 0x29, 
-    0xA9, 0x31, 0xE8, 0x50, 0xC7, 0x50, 0xC8, 0x58, 0x08, 0x39, 0x47, 0x11, 0x47, 0x19, 0x47, 0x11, 
-    0xE8, 0x38, 0xC9, 0x50, 0xC9, 0x50, 0xC9, 0x48, 0x89, 0x11, 0x89, 0x11, 0x89, 0x09, 0x49, 0x21, 
-    0xA9, 0x50, 0xA9, 0x48, 0xA9, 0x50, 0x29, 0x21, 0x89, 0x09, 0x89, 0x11, 0x69, 0x11, 0xC9, 0x40, 
-    0xA9, 0x48, 0xCA, 0x50, 0x65, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x08, 0x02, 0x39, 0x02, 0x31, 0x02, 0x31, 0x22, 0x39, 0x42, 0x41, 0x42, 0x41, 
-    0x22, 0x39, 0x02, 0x31, 0x02, 0x39, 0x02, 0x39, 0xE3, 0x69, 0xC3, 0x79, 0x84, 0x71, 0x44, 0x69, 
-    0x04, 0x49, 0x42, 0x51, 0x42, 0x51, 0x42, 0x59, 0x42, 0x59, 0x42, 0x59, 0x62, 0x59, 0x62, 0x59, 
-    0x62, 0x59, 0x62, 0x61, 0x42, 0x51, 0x42, 0x51, 0x42, 0x51, 0x42, 0x51, 0x65, 0x31, 0x66, 0x31, 
-    0x66, 0x31, 0x45, 0x39, 0xC4, 0x48, 0xE4, 0x40, 0xE4, 0x48, 0x04, 0x39, 0x04, 0x39, 0x04, 0x39, 
-    0x04, 0x39, 0xE4, 0x40, 0xE4, 0x40, 0xC4, 0x48, 0xE4, 0x38, 0x04, 0x31, 0xE4, 0x30, 0x04, 0x31, 
-    0xE4, 0x38, 0xC4, 0x40, 0xC4, 0x40, 0xC5, 0x40, 0x08, 0x39, 0x09, 0x39, 0xE9, 0x38, 0x09, 0x31, 
-    0x49, 0x21, 0x49, 0x21, 0x49, 0x21, 0x09, 0x29, 0xE9, 0x30, 0xE9, 0x30, 0x09, 0x31, 0xA5, 0x28, 
-    0x84, 0x20, 0x85, 0x28, 0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x51, 0xC2, 0x79, 0xA1, 0x71, 0x62, 0x61, 
-    0xE2, 0x38, 0xE2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0xC2, 0x40, 
-    0xC2, 0x40, 0xC2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 
-    0xC2, 0x40, 0xE2, 0x38, 0xE2, 0x38, 0xE2, 0x38, 0xE2, 0x40, 0xC2, 0x40, 0x23, 0x49, 0x44, 0x49, 
-    0x44, 0x49, 0x64, 0x49, 0x23, 0x41, 0xC2, 0x40, 0xA8, 0x50, 0xA9, 0x50, 0x89, 0x50, 0xE9, 0x38, 
-    0x88, 0x09, 0x68, 0x11, 0x88, 0x09, 0xE9, 0x30, 0x89, 0x48, 0x88, 0x40, 0xA9, 0x48, 0x21, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x59, 0xA2, 0x79, 0xA2, 0x71, 0x42, 0x61, 
-    0xC2, 0x38, 0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x38, 0xE2, 0x40, 0xE2, 0x40, 
-    0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x38, 0xE2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0xE2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0x44, 0x49, 0x03, 0x41, 
-    0xE2, 0x38, 0xE3, 0x40, 0x24, 0x49, 0x04, 0x41, 0xA8, 0x48, 0xA9, 0x48, 0xA9, 0x50, 0xE9, 0x38, 
-    0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0x09, 0x31, 0xA9, 0x48, 0xA9, 0x40, 0xC9, 0x40, 0x21, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x61, 0xE2, 0x81, 0xC2, 0x79, 0xA3, 0x69, 
-    0x44, 0x49, 0x64, 0x49, 0x64, 0x49, 0x64, 0x49, 0x85, 0x51, 0x03, 0x41, 0xE2, 0x40, 0x23, 0x49, 
-    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x49, 
-    0x23, 0x49, 0x23, 0x49, 0x03, 0x41, 0x23, 0x41, 0x03, 0x41, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 
-    0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x64, 0x51, 0x23, 0x49, 
-    0xC2, 0x40, 0xC2, 0x38, 0xE2, 0x40, 0x44, 0x49, 0xC8, 0x48, 0xC8, 0x40, 0xA8, 0x48, 0xE8, 0x30, 
-    0x68, 0x11, 0x68, 0x11, 0x68, 0x09, 0xE8, 0x30, 0x88, 0x40, 0xA8, 0x40, 0xA8, 0x38, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x82, 0x65, 0xBB, 0xE3, 0xAA, 0x4A, 0xBC, 
-    0xF9, 0xDE, 0xB7, 0xDE, 0xB7, 0xDE, 0xB7, 0xDE, 0xD8, 0xDE, 0x15, 0xCE, 0x25, 0x7A, 0x62, 0x69, 
-    0x82, 0x69, 0x62, 0x69, 0xE3, 0x79, 0x23, 0x8A, 0x02, 0x82, 0x02, 0x82, 0x02, 0x8A, 0x02, 0x8A, 
-    0x02, 0x8A, 0x03, 0x7A, 0x64, 0x59, 0x63, 0x59, 0x64, 0x59, 0xA3, 0x61, 0xA2, 0x71, 0xA2, 0x71, 
-    0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 
-    0x22, 0x59, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x40, 0x08, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x82, 0x85, 0xBB, 0x03, 0xAB, 0x6B, 0xBC, 
-    0x59, 0xE7, 0xF8, 0xE6, 0x18, 0xE7, 0x18, 0xE7, 0xF8, 0xE6, 0x9A, 0xEF, 0xF0, 0xB4, 0x00, 0x61, 
-    0x82, 0x69, 0x61, 0x69, 0xC2, 0x81, 0x22, 0x92, 0x02, 0x8A, 0x02, 0x8A, 0x02, 0x8A, 0x02, 0x8A, 
-    0x22, 0x92, 0xC2, 0x79, 0xC1, 0x48, 0xE1, 0x48, 0xE1, 0x48, 0x41, 0x59, 0xA2, 0x71, 0x82, 0x69, 
-    0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x71, 0xA2, 0x69, 0xA2, 0x71, 
-    0x22, 0x59, 0xE1, 0x48, 0x02, 0x49, 0xE1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x7A, 0x85, 0xBB, 0xE3, 0xAA, 0xAB, 0xC4, 
-    0xDB, 0xF7, 0x7A, 0xF7, 0x7A, 0xF7, 0x18, 0xE7, 0xD8, 0xE6, 0x39, 0xE7, 0x92, 0xC5, 0x21, 0x61, 
-    0x82, 0x69, 0x62, 0x69, 0xC2, 0x81, 0x02, 0x8A, 0x02, 0x8A, 0xE2, 0x89, 0x02, 0x8A, 0xE2, 0x89, 
-    0x02, 0x8A, 0xC2, 0x79, 0xE2, 0x48, 0x02, 0x51, 0xE2, 0x48, 0x42, 0x59, 0xA2, 0x71, 0x82, 0x69, 
-    0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x62, 0x61, 0x62, 0x61, 0x82, 0x69, 
-    0x22, 0x59, 0xE1, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x22, 0x39, 0xC3, 0x59, 0xA2, 0x51, 0xA3, 0x51, 0xE4, 0x9A, 0x64, 0xB3, 0x24, 0xB3, 0x87, 0xA3, 
-    0xCE, 0x7B, 0xCD, 0x7B, 0xCD, 0x7B, 0x76, 0xD6, 0x18, 0xE7, 0x39, 0xE7, 0x93, 0xCD, 0x81, 0x79, 
-    0xC2, 0x79, 0xA2, 0x79, 0x22, 0x92, 0x83, 0x9A, 0x63, 0x9A, 0x63, 0x9A, 0x63, 0x9A, 0x63, 0x9A, 
-    0x83, 0x9A, 0x22, 0x8A, 0x02, 0x51, 0x22, 0x59, 0x02, 0x51, 0x62, 0x61, 0xA2, 0x71, 0x82, 0x69, 
-    0xA2, 0x71, 0x22, 0x8A, 0x42, 0x8A, 0x22, 0x8A, 0x63, 0x92, 0xA3, 0x92, 0x83, 0x92, 0xA3, 0x9A, 
-    0xA2, 0x69, 0xC1, 0x40, 0xE2, 0x48, 0xE1, 0x48, 0x61, 0x28, 0x61, 0x20, 0x60, 0x18, 0x00, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE5, 0x92, 0x06, 0xD4, 0xC5, 0xC3, 0xC5, 0xC3, 0x85, 0xBB, 0x44, 0xB3, 0x85, 0xBB, 0x43, 0x7A, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xBD, 0x39, 0xEF, 0x39, 0xE7, 0xB2, 0xCD, 0xE1, 0x89, 
-    0x22, 0x92, 0x02, 0x8A, 0xC3, 0xA2, 0x24, 0xB3, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 
-    0x24, 0xB3, 0xA3, 0xA2, 0x21, 0x61, 0x42, 0x61, 0x21, 0x61, 0x62, 0x69, 0xA2, 0x71, 0x82, 0x69, 
-    0xA2, 0x71, 0xA3, 0xA2, 0xC3, 0xAA, 0xC3, 0xA2, 0x43, 0xB3, 0x04, 0xCC, 0xE4, 0xCB, 0x24, 0xD4, 
-    0x43, 0x82, 0xC1, 0x40, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x81, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA4, 0x82, 0xA5, 0xBB, 0x65, 0xB3, 0x65, 0xB3, 0x65, 0xB3, 0x65, 0xB3, 0x85, 0xBB, 0x64, 0x7A, 
-    0x62, 0x08, 0xA2, 0x18, 0x82, 0x10, 0x15, 0xC6, 0x39, 0xEF, 0x39, 0xE7, 0xB2, 0xCD, 0xC1, 0x89, 
-    0x02, 0x8A, 0xE2, 0x89, 0xA3, 0x9A, 0x04, 0xAB, 0xE3, 0xAA, 0xE3, 0xAA, 0x04, 0xAB, 0xE3, 0xAA, 
-    0x04, 0xB3, 0xA3, 0x9A, 0x21, 0x59, 0x42, 0x61, 0x21, 0x59, 0x62, 0x69, 0xA2, 0x71, 0x82, 0x69, 
-    0xA2, 0x71, 0xA3, 0xA2, 0xA3, 0xA2, 0x83, 0xA2, 0x03, 0xB3, 0xE4, 0xC3, 0xA4, 0xC3, 0xE4, 0xCB, 
-    0x23, 0x7A, 0xC1, 0x40, 0x02, 0x49, 0xE2, 0x48, 0xE1, 0x48, 0xE1, 0x40, 0xE2, 0x48, 0x61, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA4, 0x82, 0xA5, 0xC3, 0x65, 0xB3, 0x85, 0xBB, 0x65, 0xB3, 0x45, 0xB3, 0x85, 0xBB, 0x44, 0x7A, 
-    0x42, 0x08, 0x82, 0x10, 0x82, 0x10, 0xF5, 0xC5, 0x38, 0xEF, 0x39, 0xE7, 0xB2, 0xCD, 0xC1, 0x89, 
-    0x22, 0x8A, 0x02, 0x8A, 0xA3, 0xA2, 0x04, 0xAB, 0xE3, 0xAA, 0xE3, 0xAA, 0x04, 0xAB, 0x04, 0xAB, 
-    0x24, 0xB3, 0xA3, 0x9A, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x62, 0x69, 0xA2, 0x69, 0x82, 0x69, 
-    0xA2, 0x71, 0x83, 0x9A, 0xA3, 0xA2, 0xA3, 0xA2, 0x23, 0xB3, 0xE4, 0xCB, 0xC4, 0xC3, 0x04, 0xCC, 
-    0x23, 0x7A, 0xC1, 0x40, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0x02, 0x51, 0x60, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x45, 0x9B, 0x65, 0xA3, 0x45, 0xA3, 
-    0x06, 0xC4, 0x47, 0xCC, 0x47, 0xCC, 0x47, 0xCC, 0x85, 0xBB, 0x44, 0xB3, 0x85, 0xBB, 0x44, 0x7A, 
-    0x42, 0x08, 0x82, 0x10, 0x82, 0x10, 0x15, 0xC6, 0x18, 0xEF, 0x18, 0xE7, 0x13, 0xD6, 0xC3, 0xAA, 
-    0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 
-    0x04, 0xAB, 0x04, 0xAB, 0xE3, 0xA2, 0xE3, 0xA2, 0xE4, 0xAA, 0x43, 0x92, 0xE2, 0x81, 0xE2, 0x81, 
-    0x02, 0x82, 0x24, 0xB3, 0x44, 0xB3, 0x24, 0xB3, 0x84, 0xBB, 0xE4, 0xCB, 0xA4, 0xC3, 0xE4, 0xCB, 
-    0x23, 0x7A, 0xC1, 0x40, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0x02, 0x51, 0x61, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0xC6, 0xBB, 0x06, 0xCC, 0xE6, 0xC3, 
-    0x46, 0xCC, 0x67, 0xCC, 0x67, 0xCC, 0x87, 0xCC, 0x85, 0xBB, 0x44, 0xB3, 0x85, 0xBB, 0x44, 0x7A, 
-    0x62, 0x08, 0x82, 0x18, 0x82, 0x10, 0xF4, 0xC5, 0xF8, 0xE6, 0x5A, 0xE7, 0x70, 0xCD, 0xE3, 0xAA, 
-    0x44, 0xB3, 0x24, 0xB3, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 
-    0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x24, 0xB3, 0x63, 0x92, 0xE2, 0x81, 0x02, 0x82, 
-    0x22, 0x8A, 0x44, 0xB3, 0x64, 0xB3, 0x44, 0xB3, 0x84, 0xBB, 0xC4, 0xC3, 0xA4, 0xC3, 0xE4, 0xCB, 
-    0x02, 0x7A, 0xC1, 0x40, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0xE2, 0x48, 0x61, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0xE6, 0xC3, 0x26, 0xCC, 0x06, 0xCC, 
-    0x47, 0xCC, 0x87, 0xD4, 0x87, 0xD4, 0xA7, 0xD4, 0x85, 0xBB, 0x44, 0xB3, 0x84, 0xBB, 0x64, 0x7A, 
-    0x22, 0x00, 0x42, 0x08, 0x62, 0x08, 0x56, 0xC6, 0x9A, 0xEF, 0xF4, 0xCD, 0x84, 0x92, 0x24, 0xB3, 
-    0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x44, 0xBB, 0x44, 0xB3, 0x24, 0xB3, 0x04, 0xAB, 0x04, 0xAB, 
-    0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x24, 0xB3, 0x42, 0x92, 0xC2, 0x79, 0xE2, 0x81, 
-    0x02, 0x82, 0x24, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 0x84, 0xBB, 0x04, 0xD4, 0xE4, 0xCB, 0x24, 0xD4, 
-    0x23, 0x7A, 0xA1, 0x40, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x51, 0x81, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x25, 0x9B, 0x66, 0xA3, 0x46, 0xA3, 
-    0xA6, 0xB3, 0xC6, 0xBB, 0xA6, 0xBB, 0xC6, 0xBB, 0x65, 0xB3, 0x65, 0xB3, 0x85, 0xBB, 0x05, 0x9B, 
-    0x26, 0x62, 0x46, 0x62, 0x25, 0x62, 0xEF, 0xBC, 0xAD, 0xBC, 0x44, 0x92, 0x62, 0x9A, 0x64, 0xB3, 
-    0x24, 0xB3, 0x44, 0xB3, 0x84, 0x8A, 0x23, 0x72, 0x43, 0x7A, 0x63, 0x82, 0x04, 0xAB, 0x04, 0xAB, 
-    0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0xA3, 0x9A, 0x63, 0x92, 0x63, 0x92, 
-    0x63, 0x92, 0x24, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 0x04, 0xAB, 0xA3, 0x92, 0xC3, 0x9A, 0xE3, 0x9A, 
-    0x82, 0x69, 0xC1, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0xA1, 0x38, 0xA1, 0x30, 0xA1, 0x38, 0x40, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x61, 0xE2, 0x81, 0xA2, 0x79, 0xC2, 0x81, 0x67, 0xAB, 0xA6, 0xBB, 0x45, 0xB3, 0x44, 0xB3, 
-    0x64, 0xBB, 0x65, 0xBB, 0x64, 0xBB, 0x03, 0xB3, 0xE3, 0xAA, 0x44, 0xB3, 0x44, 0xB3, 0x24, 0xB3, 
-    0x24, 0xAB, 0x64, 0xBB, 0x63, 0x49, 0x22, 0x00, 0x62, 0x08, 0x82, 0x10, 0xE3, 0xA2, 0x03, 0xAB, 
-    0x03, 0xAB, 0x04, 0xAB, 0x03, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x24, 0xB3, 0x24, 0xB3, 
-    0x24, 0xB3, 0x44, 0xB3, 0x24, 0xB3, 0x64, 0xBB, 0x43, 0x8A, 0x81, 0x38, 0xC2, 0x40, 0xA2, 0x40, 
-    0xC2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x59, 0xE2, 0x89, 0xE2, 0x81, 0xC2, 0x81, 0xE4, 0xA2, 0x44, 0xB3, 0x24, 0xAB, 0x24, 0xAB, 
-    0x24, 0xAB, 0x24, 0xAB, 0x24, 0xAB, 0x24, 0xB3, 0x44, 0xB3, 0x24, 0xAB, 0x24, 0xAB, 0x24, 0xB3, 
-    0x24, 0xAB, 0x44, 0xBB, 0x83, 0x51, 0x62, 0x08, 0x82, 0x10, 0xA2, 0x20, 0xE3, 0xA2, 0x03, 0xAB, 
-    0x03, 0xAB, 0x03, 0xAB, 0x04, 0xAB, 0x03, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 
-    0x04, 0xAB, 0x24, 0xB3, 0x24, 0xB3, 0x64, 0xBB, 0x63, 0x8A, 0xC2, 0x40, 0x02, 0x49, 0xE2, 0x48, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x61, 0x02, 0x8A, 0xE2, 0x81, 0xE2, 0x81, 0xE4, 0xAA, 0x44, 0xB3, 0x24, 0xB3, 0x44, 0xB3, 
-    0x44, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 0x24, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 
-    0x24, 0xB3, 0x64, 0xC3, 0x83, 0x49, 0x42, 0x00, 0x82, 0x10, 0xA2, 0x18, 0xC3, 0xA2, 0x03, 0xAB, 
-    0x03, 0xAB, 0x03, 0xAB, 0xE3, 0xAA, 0x03, 0xAB, 0x03, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x24, 0xAB, 
-    0x24, 0xAB, 0x44, 0xB3, 0x24, 0xB3, 0x64, 0xBB, 0x63, 0x92, 0xC2, 0x40, 0xE2, 0x48, 0xE2, 0x48, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x40, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0xE2, 0x28, 0x23, 0x31, 0x03, 0x31, 0x23, 0x31, 
-    0x23, 0x31, 0x23, 0x31, 0x23, 0x31, 0x23, 0x31, 0x23, 0x39, 0x23, 0x39, 0x23, 0x39, 0x23, 0x39, 
-    0x23, 0x39, 0x03, 0x31, 0x03, 0x6A, 0xA3, 0x92, 0x83, 0x8A, 0x83, 0x92, 0x03, 0xAB, 0x03, 0xAB, 
-    0x03, 0xAB, 0xC3, 0xA2, 0x62, 0x92, 0x62, 0x9A, 0x82, 0x9A, 0x22, 0x82, 0xC2, 0x79, 0xE2, 0x79, 
-    0xE2, 0x79, 0x42, 0x59, 0x42, 0x59, 0x42, 0x59, 0x22, 0x51, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 
-    0x61, 0x20, 0x20, 0x08, 0x00, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0x83, 0x10, 0x62, 0x08, 0x62, 0x08, 
-    0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 
-    0x82, 0x10, 0x42, 0x00, 0x23, 0x72, 0x43, 0xBB, 0x03, 0xAB, 0x03, 0xB3, 0x03, 0xAB, 0x03, 0xAB, 
-    0x03, 0xAB, 0xC3, 0xA2, 0x41, 0x92, 0x42, 0x92, 0x62, 0x92, 0xE1, 0x79, 0x81, 0x69, 0xA1, 0x71, 
-    0x81, 0x69, 0xE1, 0x48, 0xC1, 0x40, 0xC1, 0x40, 0xC2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 
-    0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0xA3, 0x10, 0x62, 0x08, 0x82, 0x08, 
-    0x82, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 
-    0x82, 0x10, 0x42, 0x00, 0x03, 0x72, 0x23, 0xB3, 0xE3, 0xA2, 0xE3, 0xAA, 0x03, 0xAB, 0x03, 0xAB, 
-    0x03, 0xAB, 0xC3, 0xA2, 0x42, 0x92, 0x42, 0x92, 0x62, 0x9A, 0x02, 0x82, 0xA1, 0x69, 0xA2, 0x71, 
-    0xA2, 0x71, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0xE2, 0x50, 
-    0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x20, 0x03, 0x31, 0x02, 0x31, 0x03, 0x31, 
-    0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 0x02, 0x31, 
-    0x02, 0x31, 0xE2, 0x28, 0x43, 0x82, 0x23, 0xB3, 0xE3, 0xAA, 0xE3, 0xAA, 0xC3, 0xA2, 0xC3, 0xA2, 
-    0xC3, 0xA2, 0x82, 0x9A, 0x22, 0x8A, 0x22, 0x8A, 0x42, 0x8A, 0xC2, 0x79, 0x61, 0x69, 0x82, 0x69, 
-    0x82, 0x69, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0xC2, 0x40, 0xE2, 0x48, 
-    0xA1, 0x30, 0x60, 0x28, 0x60, 0x28, 0x60, 0x28, 0x80, 0x28, 0x80, 0x20, 0x80, 0x20, 0x40, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x82, 0xE3, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 
-    0xC2, 0xA2, 0xC2, 0xA2, 0xC2, 0xA2, 0xC2, 0xA2, 0xC2, 0xA2, 0xC2, 0xA2, 0xC2, 0xA2, 0xC2, 0xA2, 
-    0xC2, 0xA2, 0xE2, 0xA2, 0x03, 0xAB, 0xE3, 0xAA, 0x03, 0xAB, 0xE3, 0xA2, 0xE2, 0x79, 0xE2, 0x79, 
-    0xE2, 0x79, 0xC2, 0x71, 0x81, 0x69, 0x81, 0x69, 0x81, 0x69, 0x21, 0x59, 0xE1, 0x48, 0xE1, 0x48, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0xA2, 0x30, 0xC2, 0x30, 0xA2, 0x28, 
-    0x61, 0x81, 0xE1, 0xB1, 0xC1, 0xA1, 0xE1, 0xB1, 0xE1, 0xDA, 0xC1, 0xD2, 0x01, 0xE3, 0xE1, 0x81, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7A, 0xC2, 0xA2, 0xA2, 0x9A, 0xA2, 0x9A, 
-    0xA2, 0x9A, 0xA2, 0x9A, 0xA2, 0x9A, 0xA2, 0x9A, 0xA2, 0x9A, 0xA2, 0x9A, 0xA2, 0x9A, 0xA2, 0x9A, 
-    0xA2, 0x9A, 0xC2, 0xA2, 0xE3, 0xA2, 0xE3, 0xAA, 0xE3, 0xAA, 0xE3, 0xA2, 0xE2, 0x79, 0xE2, 0x79, 
-    0xE2, 0x79, 0xC2, 0x79, 0x81, 0x69, 0x81, 0x69, 0x81, 0x69, 0x21, 0x59, 0xE2, 0x48, 0x02, 0x51, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xC2, 0x40, 0xA2, 0x30, 0xC2, 0x30, 0xA2, 0x28, 
-    0x41, 0x79, 0xC1, 0xA1, 0x81, 0x99, 0xC1, 0xA1, 0xA1, 0xD2, 0xA1, 0xCA, 0xE1, 0xE2, 0xC1, 0x81, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x82, 0x03, 0xB3, 0xE3, 0xAA, 0xE2, 0xA2, 
-    0xC2, 0xA2, 0xC2, 0xA2, 0xE2, 0xA2, 0xE2, 0xA2, 0xE2, 0xA2, 0xE2, 0xA2, 0xE2, 0xA2, 0xE2, 0xA2, 
-    0xE2, 0xA2, 0xE3, 0xA2, 0x03, 0xAB, 0x03, 0xAB, 0x03, 0xAB, 0x03, 0xAB, 0x02, 0x7A, 0xE2, 0x71, 
-    0xE2, 0x79, 0xC2, 0x71, 0x61, 0x61, 0x61, 0x61, 0x81, 0x61, 0x22, 0x51, 0xE2, 0x48, 0xE2, 0x48, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xC2, 0x40, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x28, 
-    0x61, 0x79, 0xC1, 0xA9, 0xA1, 0xA1, 0xE1, 0xA9, 0xE1, 0xE2, 0xE1, 0xE2, 0x41, 0xF3, 0xE1, 0x89, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x28, 0x21, 0x41, 0x21, 0x41, 0x61, 0x59, 
-    0xC2, 0x91, 0xC2, 0x89, 0xC2, 0x89, 0xE2, 0x91, 0xE2, 0x99, 0xE2, 0x99, 0xE2, 0x91, 0xE2, 0x91, 
-    0xE2, 0x91, 0x02, 0x9A, 0x02, 0x9A, 0x02, 0x9A, 0x02, 0x9A, 0x02, 0x9A, 0xE1, 0x91, 0x01, 0x92, 
-    0x01, 0x92, 0xE1, 0x91, 0xC1, 0x89, 0xC1, 0x89, 0xC1, 0x89, 0x61, 0x79, 0x41, 0x71, 0x41, 0x71, 
-    0x41, 0x71, 0x01, 0x61, 0xE2, 0x58, 0x01, 0x61, 0xE3, 0x48, 0x84, 0x30, 0xA4, 0x38, 0x84, 0x30, 
-    0x22, 0x71, 0x81, 0x99, 0x61, 0x91, 0x81, 0x91, 0xA1, 0x79, 0x81, 0x69, 0xA1, 0x79, 0xE1, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 
-    0x21, 0x81, 0xE1, 0x78, 0x01, 0x79, 0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 
-    0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 0x21, 0x89, 0xE1, 0xB1, 0x00, 0xBA, 
-    0x01, 0xBA, 0x01, 0xBA, 0x21, 0xBA, 0x01, 0xBA, 0x21, 0xBA, 0xE1, 0xA9, 0xA1, 0xA1, 0xC1, 0xA1, 
-    0xA1, 0xA1, 0x22, 0x81, 0x02, 0x79, 0x21, 0x81, 0xC4, 0x60, 0x48, 0x38, 0x68, 0x38, 0x48, 0x38, 
-    0xE4, 0x68, 0x21, 0x81, 0x22, 0x79, 0x01, 0x71, 0x21, 0x08, 0x01, 0x00, 0x21, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 
-    0x21, 0x81, 0x21, 0x79, 0x21, 0x81, 0x41, 0x89, 0x41, 0x91, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 
-    0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0xE1, 0xB1, 0x01, 0xBA, 
-    0x01, 0xB2, 0x01, 0xB2, 0x01, 0xB2, 0x01, 0xB2, 0x21, 0xBA, 0xC1, 0xA1, 0xA1, 0x99, 0xA1, 0x99, 
-    0xA1, 0x99, 0x22, 0x79, 0x02, 0x71, 0x21, 0x79, 0xC4, 0x60, 0x68, 0x30, 0x67, 0x38, 0x68, 0x38, 
-    0xE3, 0x68, 0x41, 0x81, 0x22, 0x79, 0x21, 0x71, 0x61, 0x18, 0x41, 0x08, 0x61, 0x10, 0x40, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 
-    0x21, 0x81, 0x21, 0x79, 0x21, 0x81, 0x41, 0x91, 0x41, 0x91, 0x41, 0x91, 0x41, 0x89, 0x41, 0x89, 
-    0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0x41, 0x89, 0xE1, 0xB1, 0x01, 0xBA, 
-    0x01, 0xB2, 0x01, 0xB2, 0x01, 0xB2, 0x01, 0xB2, 0x01, 0xB2, 0xC1, 0xA1, 0xA1, 0x99, 0xA1, 0x99, 
-    0xA1, 0x99, 0x01, 0x79, 0x02, 0x79, 0x01, 0x81, 0xC4, 0x60, 0x68, 0x30, 0x67, 0x38, 0x68, 0x30, 
-    0xE3, 0x68, 0x21, 0x89, 0x01, 0x81, 0x01, 0x79, 0x61, 0x10, 0x40, 0x08, 0x61, 0x08, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 
-    0xE1, 0xDA, 0xA1, 0xCA, 0xA1, 0xCA, 0x01, 0xBA, 0x01, 0xBA, 0x01, 0xBA, 0x01, 0xB2, 0x01, 0xB2, 
-    0xE1, 0xB1, 0xE1, 0xB1, 0xE1, 0xB1, 0xE1, 0xB1, 0x01, 0xB2, 0xE1, 0xB1, 0x81, 0x99, 0x81, 0x91, 
-    0x81, 0x99, 0x61, 0x89, 0xE2, 0x70, 0xE2, 0x70, 0xE1, 0x78, 0x66, 0x39, 0xC9, 0x19, 0xA8, 0x21, 
-    0xA8, 0x21, 0xE9, 0x29, 0xEA, 0x29, 0x0A, 0x22, 0xA9, 0x41, 0xE8, 0x90, 0xE8, 0x88, 0xE8, 0x90, 
-    0xA9, 0x51, 0x09, 0x22, 0x09, 0x2A, 0xE9, 0x29, 0xA6, 0x38, 0x86, 0x38, 0xA7, 0x40, 0x43, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 
-    0x21, 0xEB, 0xE0, 0xDA, 0xE1, 0xDA, 0x21, 0xC2, 0x01, 0xBA, 0x21, 0xBA, 0x21, 0xBA, 0x21, 0xBA, 
-    0x20, 0xBA, 0x21, 0xBA, 0x20, 0xBA, 0x21, 0xBA, 0x20, 0xBA, 0x21, 0xBA, 0x81, 0x91, 0x61, 0x89, 
-    0x61, 0x91, 0x42, 0x81, 0xC2, 0x68, 0xE2, 0x68, 0xC1, 0x70, 0x47, 0x29, 0xCA, 0x01, 0xAA, 0x01, 
-    0xAA, 0x09, 0x0C, 0x12, 0x2C, 0x12, 0x4C, 0x0A, 0xEB, 0x39, 0xE8, 0xA0, 0x08, 0x99, 0xE8, 0xA8, 
-    0xCB, 0x49, 0x6C, 0x02, 0x6C, 0x02, 0x4C, 0x0A, 0xE9, 0x50, 0xA8, 0x50, 0xC9, 0x58, 0x65, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 
-    0x21, 0xEB, 0xC0, 0xD2, 0xE1, 0xD2, 0x21, 0xBA, 0x01, 0xBA, 0x01, 0xBA, 0x01, 0xBA, 0x00, 0xBA, 
-    0x01, 0xBA, 0x00, 0xBA, 0x00, 0xBA, 0x20, 0xBA, 0x21, 0xBA, 0x21, 0xBA, 0x81, 0x99, 0x81, 0x91, 
-    0x81, 0x99, 0x41, 0x89, 0xC1, 0x70, 0xC2, 0x70, 0xA1, 0x78, 0x46, 0x31, 0xCA, 0x01, 0xA9, 0x09, 
-    0xAA, 0x09, 0x2B, 0x12, 0x2B, 0x1A, 0x4C, 0x0A, 0xEB, 0x39, 0xE8, 0xA8, 0x08, 0xA1, 0xE8, 0xA8, 
-    0xCA, 0x49, 0x6C, 0x02, 0x6B, 0x02, 0x4B, 0x02, 0xA8, 0x50, 0x87, 0x50, 0xA8, 0x58, 0x44, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x24, 0x21, 
-    0x04, 0x21, 0xE3, 0x20, 0x82, 0x10, 0x82, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xC2, 0x18, 
-    0xC3, 0x18, 0xC2, 0x18, 0xC3, 0x18, 0xC2, 0x18, 0xC2, 0x18, 0xC2, 0x18, 0xC2, 0x18, 0xC2, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 
-    0x21, 0xEB, 0xE1, 0xD2, 0xE1, 0xDA, 0x81, 0xCA, 0x61, 0xC2, 0x61, 0xC2, 0x41, 0xC2, 0x20, 0xBA, 
-    0x21, 0xC2, 0x20, 0xC2, 0x01, 0xB2, 0xE1, 0xB1, 0xE1, 0xB1, 0xE1, 0xA9, 0x43, 0x79, 0x23, 0x79, 
-    0x43, 0x79, 0x23, 0x71, 0x24, 0x51, 0x24, 0x51, 0x04, 0x59, 0x47, 0x31, 0x6A, 0x19, 0x69, 0x19, 
-    0x69, 0x19, 0xAA, 0x21, 0xAA, 0x21, 0xCB, 0x19, 0xAA, 0x31, 0x08, 0x79, 0x28, 0x79, 0x08, 0x79, 
-    0x8A, 0x51, 0xEB, 0x31, 0xEA, 0x31, 0xEB, 0x31, 0x6A, 0x39, 0x29, 0x39, 0x4A, 0x41, 0xC6, 0x30, 
-    0x21, 0x10, 0x21, 0x10, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xB5, 0xD7, 0xDE, 
-    0x76, 0xD6, 0x76, 0xD6, 0xD4, 0xC5, 0xD1, 0x9C, 0x4F, 0x8C, 0x70, 0x94, 0x70, 0x8C, 0x70, 0x94, 
-    0x90, 0x94, 0x90, 0x94, 0xB1, 0x9C, 0xB1, 0x9C, 0xB1, 0x9C, 0xB1, 0x9C, 0x90, 0x94, 0xD1, 0x9C, 
-    0xC7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 
-    0x21, 0xEB, 0xE1, 0xD2, 0x01, 0xDB, 0x01, 0xDB, 0x01, 0xDB, 0x01, 0xDB, 0xC1, 0xD2, 0x21, 0xC2, 
-    0x41, 0xC2, 0x41, 0xC2, 0xC1, 0xA9, 0x81, 0x99, 0xA1, 0xA1, 0x81, 0x99, 0x88, 0x38, 0x68, 0x30, 
-    0x68, 0x38, 0xE8, 0x28, 0x2B, 0x02, 0x0B, 0x02, 0x2B, 0x02, 0x49, 0x29, 0x88, 0x50, 0xA8, 0x48, 
-    0xA8, 0x48, 0x68, 0x38, 0x68, 0x38, 0x48, 0x40, 0xC8, 0x30, 0x88, 0x09, 0x68, 0x11, 0x68, 0x01, 
-    0x28, 0x61, 0xE8, 0xB0, 0xE8, 0xA0, 0x09, 0x99, 0x0E, 0x13, 0x2F, 0x03, 0x6F, 0x03, 0x6D, 0x3A, 
-    0xE8, 0x88, 0x09, 0x81, 0x29, 0x89, 0x63, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0xB3, 0xBD, 0xB7, 0xDE, 
-    0x76, 0xD6, 0x96, 0xD6, 0xB7, 0xDE, 0x97, 0xDE, 0x32, 0xAD, 0x4F, 0x8C, 0x70, 0x94, 0x70, 0x8C, 
-    0x70, 0x94, 0x90, 0x94, 0xB1, 0x9C, 0xB1, 0x9C, 0xD1, 0x9C, 0xB1, 0x9C, 0x90, 0x94, 0xD1, 0x9C, 
-    0xCA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x49, 
-    0x21, 0xEB, 0xE1, 0xD2, 0x01, 0xDB, 0x01, 0xDB, 0xE1, 0xDA, 0x01, 0xDB, 0xC1, 0xD2, 0x21, 0xC2, 
-    0x41, 0xC2, 0x41, 0xC2, 0xC1, 0xA9, 0x81, 0x99, 0xA1, 0xA1, 0x82, 0x99, 0x87, 0x40, 0x88, 0x38, 
-    0x68, 0x40, 0xE8, 0x30, 0x0A, 0x02, 0xEA, 0x09, 0x0A, 0x02, 0x49, 0x29, 0x88, 0x50, 0xA8, 0x48, 
-    0xA8, 0x48, 0x88, 0x38, 0x88, 0x38, 0x68, 0x38, 0xC8, 0x30, 0x68, 0x19, 0x48, 0x19, 0x68, 0x11, 
-    0x28, 0x59, 0x08, 0xA1, 0xE8, 0x98, 0x29, 0x91, 0xEE, 0x12, 0x0F, 0x0B, 0x2F, 0x03, 0x6D, 0x32, 
-    0xE8, 0x88, 0x09, 0x79, 0x29, 0x89, 0x63, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xBD, 0xB7, 0xDE, 
-    0x76, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0x96, 0xD6, 0xB0, 0x94, 0x2F, 0x84, 0x4F, 0x8C, 
-    0x2F, 0x8C, 0x4F, 0x8C, 0x50, 0x8C, 0x70, 0x94, 0x70, 0x94, 0x70, 0x8C, 0x2F, 0x8C, 0x90, 0x94, 
-    0xCA, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x49, 
-    0x41, 0xEB, 0x00, 0xDB, 0x21, 0xE3, 0x01, 0xDB, 0x01, 0xDB, 0x01, 0xDB, 0xE1, 0xD2, 0x41, 0xCA, 
-    0x60, 0xCA, 0x61, 0xCA, 0xE1, 0xB1, 0xA1, 0xA1, 0xC1, 0xA1, 0xA1, 0x99, 0x67, 0x40, 0x67, 0x38, 
-    0x47, 0x40, 0xC8, 0x30, 0x2B, 0x02, 0x0B, 0x02, 0x2B, 0x02, 0x49, 0x31, 0x68, 0x50, 0xA8, 0x50, 
-    0x88, 0x50, 0x88, 0x40, 0x88, 0x38, 0x68, 0x40, 0xC8, 0x30, 0x68, 0x11, 0x68, 0x19, 0x88, 0x11, 
-    0x28, 0x69, 0xE8, 0xB0, 0xE8, 0xA0, 0x29, 0x99, 0x0F, 0x0B, 0x4F, 0x03, 0x70, 0x03, 0x8D, 0x2A, 
-    0xC8, 0x90, 0xE8, 0x88, 0x09, 0x91, 0x63, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x8C, 0x73, 0x4C, 0x6B, 0x8C, 0x73, 0x35, 0xCE, 0x97, 0xDE, 
-    0x76, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0x97, 0xDE, 0xF5, 0xC5, 0x90, 0x94, 0xB1, 0x9C, 
-    0x90, 0x94, 0x12, 0xA5, 0xD4, 0xBD, 0xB4, 0xBD, 0xB4, 0xBD, 0xB4, 0xBD, 0x73, 0xB5, 0xD4, 0xBD, 
-    0xCD, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 
-    0x86, 0x79, 0x65, 0x71, 0x66, 0x71, 0x82, 0xC2, 0xC1, 0xD2, 0xC1, 0xD2, 0x81, 0xC2, 0x81, 0x91, 
-    0xA1, 0x99, 0xA1, 0x99, 0x24, 0x79, 0x06, 0x69, 0x05, 0x69, 0x06, 0x61, 0x2C, 0x22, 0x4C, 0x1A, 
-    0x6D, 0x1A, 0x0C, 0x2A, 0x29, 0x59, 0x49, 0x59, 0x29, 0x59, 0x6A, 0x31, 0x8A, 0x19, 0x8A, 0x21, 
-    0x69, 0x19, 0xA6, 0x18, 0xA5, 0x18, 0x85, 0x18, 0xA5, 0x18, 0xC6, 0x10, 0xC6, 0x10, 0xA3, 0x10, 
-    0xE5, 0x30, 0x07, 0x49, 0x07, 0x41, 0x28, 0x41, 0xAB, 0x61, 0xEB, 0x61, 0xEB, 0x61, 0xEB, 0x59, 
-    0x6D, 0x2A, 0x4C, 0x2A, 0x6D, 0x32, 0x07, 0x39, 0x64, 0x38, 0x85, 0x38, 0x64, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE6, 0x39, 0x59, 0xF7, 0xD8, 0xE6, 0xF8, 0xE6, 0x96, 0xD6, 0x76, 0xD6, 
-    0x76, 0xD6, 0x76, 0xD6, 0x96, 0xD6, 0x76, 0xD6, 0x97, 0xDE, 0x35, 0xCE, 0xF1, 0xA4, 0x12, 0xAD, 
-    0xD1, 0xA4, 0x94, 0xBD, 0xD8, 0xE6, 0xB7, 0xDE, 0xB7, 0xDE, 0xB7, 0xDE, 0x97, 0xDE, 0x18, 0xE7, 
-    0x11, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x10, 
-    0xA8, 0x50, 0xA7, 0x48, 0xA7, 0x48, 0x42, 0xB2, 0xA1, 0xD2, 0xA1, 0xD2, 0x41, 0xB2, 0x02, 0x71, 
-    0x22, 0x79, 0x21, 0x79, 0xC6, 0x50, 0xA9, 0x40, 0xA8, 0x48, 0xC9, 0x40, 0xEE, 0x0A, 0x0E, 0x0B, 
-    0x2F, 0x03, 0x6D, 0x2A, 0xC8, 0x78, 0xE9, 0x70, 0xC8, 0x78, 0x8A, 0x31, 0x2B, 0x02, 0x0B, 0x02, 
-    0xEA, 0x01, 0xA5, 0x08, 0xA4, 0x10, 0xA5, 0x10, 0xA4, 0x10, 0x84, 0x10, 0xA5, 0x10, 0x41, 0x08, 
-    0xA3, 0x08, 0x27, 0x09, 0x06, 0x09, 0x26, 0x19, 0xE8, 0x98, 0xE8, 0xA0, 0xC8, 0xA8, 0x6A, 0x79, 
-    0x2F, 0x03, 0x0E, 0x03, 0x2F, 0x03, 0x8A, 0x41, 0xA7, 0x60, 0xE8, 0x58, 0xA6, 0x48, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xB7, 0xDE, 0x35, 0xCE, 0x56, 0xD6, 0x97, 0xDE, 0x97, 0xDE, 
-    0x97, 0xDE, 0x97, 0xDE, 0x97, 0xD6, 0x76, 0xD6, 0x97, 0xDE, 0x35, 0xCE, 0xD1, 0xA4, 0xF2, 0xA4, 
-    0xD1, 0x9C, 0x93, 0xB5, 0xB7, 0xDE, 0x76, 0xD6, 0x96, 0xD6, 0x96, 0xD6, 0x76, 0xD6, 0xD8, 0xE6, 
-    0xF1, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x10, 
-    0xC7, 0x58, 0xC7, 0x58, 0xC7, 0x50, 0x42, 0xBA, 0xC0, 0xDA, 0xC1, 0xD2, 0x61, 0xBA, 0x02, 0x79, 
-    0x21, 0x81, 0x21, 0x81, 0xC6, 0x60, 0xA8, 0x50, 0x87, 0x50, 0xC8, 0x48, 0xCE, 0x0A, 0xEE, 0x0A, 
-    0x0E, 0x03, 0x6D, 0x22, 0xC8, 0x70, 0xE9, 0x68, 0xC8, 0x70, 0x8A, 0x31, 0xEB, 0x01, 0xEB, 0x09, 
-    0xCA, 0x09, 0xA5, 0x10, 0x85, 0x10, 0x85, 0x10, 0xA5, 0x10, 0xA5, 0x10, 0xA5, 0x10, 0x41, 0x08, 
-    0xA4, 0x10, 0x27, 0x11, 0x06, 0x11, 0x06, 0x19, 0x08, 0x91, 0x09, 0x99, 0xE8, 0x98, 0x8A, 0x71, 
-    0x0F, 0x03, 0xEE, 0x02, 0x2F, 0x03, 0x69, 0x41, 0x87, 0x58, 0xC8, 0x50, 0xA6, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x76, 0xD6, 0x15, 0xCE, 0xF5, 0xC5, 
-    0x15, 0xC6, 0x15, 0xC6, 0x76, 0xD6, 0x76, 0xD6, 0x97, 0xDE, 0x35, 0xCE, 0xF1, 0xA4, 0xF2, 0xA4, 
-    0xD1, 0x9C, 0x94, 0xBD, 0xB7, 0xDE, 0x96, 0xD6, 0x97, 0xD6, 0x97, 0xD6, 0x76, 0xD6, 0xD7, 0xE6, 
-    0x11, 0xA5, 0x20, 0x10, 0x40, 0x10, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x10, 
-    0xE8, 0x48, 0xE7, 0x40, 0xC7, 0x40, 0x04, 0x9A, 0x62, 0xBA, 0x62, 0xBA, 0x22, 0xAA, 0x23, 0x71, 
-    0x43, 0x79, 0x42, 0x79, 0x07, 0x51, 0x09, 0x41, 0x09, 0x49, 0x29, 0x41, 0x8D, 0x22, 0xAD, 0x1A, 
-    0xCE, 0x1A, 0x4C, 0x32, 0x09, 0x69, 0x09, 0x61, 0xE9, 0x68, 0x6A, 0x31, 0xCA, 0x09, 0xCA, 0x09, 
-    0xA9, 0x09, 0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xA5, 0x10, 0x84, 0x10, 0xA4, 0x10, 0x41, 0x08, 
-    0xA4, 0x18, 0x07, 0x29, 0x06, 0x21, 0x07, 0x29, 0x29, 0x89, 0x29, 0x91, 0x08, 0x91, 0x8A, 0x69, 
-    0xEE, 0x0A, 0xCE, 0x12, 0xCE, 0x1A, 0x49, 0x41, 0xA7, 0x50, 0xC8, 0x50, 0xA6, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x96, 0xD6, 0xEE, 0x7B, 0x2C, 0x63, 
-    0x4D, 0x63, 0x6D, 0x6B, 0x35, 0xCE, 0x97, 0xDE, 0x97, 0xD6, 0x15, 0xCE, 0xD1, 0xA4, 0xF2, 0xA4, 
-    0xD1, 0x9C, 0xB4, 0xBD, 0xB7, 0xDE, 0x96, 0xD6, 0x97, 0xDE, 0x96, 0xD6, 0x76, 0xD6, 0xD7, 0xDE, 
-    0x52, 0xBD, 0x21, 0x59, 0x62, 0x61, 0x42, 0x61, 0xA2, 0x30, 0xA2, 0x28, 0xA2, 0x30, 0xC3, 0x20, 
-    0x68, 0x11, 0x67, 0x11, 0x68, 0x11, 0xC8, 0x30, 0xA8, 0x40, 0x88, 0x48, 0x6A, 0x31, 0xAD, 0x12, 
-    0x8C, 0x12, 0x8C, 0x12, 0xCD, 0x12, 0xEE, 0x0A, 0xEE, 0x0A, 0xAD, 0x1A, 0x29, 0x89, 0x29, 0x89, 
-    0x09, 0x91, 0x49, 0x71, 0xCA, 0x11, 0xAA, 0x11, 0xCA, 0x11, 0x29, 0x39, 0xA8, 0x50, 0xC8, 0x48, 
-    0xC8, 0x48, 0x48, 0x19, 0x48, 0x11, 0x48, 0x19, 0x06, 0x11, 0x40, 0x08, 0x61, 0x10, 0x40, 0x00, 
-    0xC5, 0x58, 0x09, 0xA1, 0x08, 0x91, 0x29, 0x89, 0x4C, 0x32, 0x6C, 0x2A, 0x6C, 0x22, 0xEB, 0x51, 
-    0x09, 0x99, 0x29, 0x91, 0x09, 0x99, 0x07, 0x39, 0x06, 0x09, 0x06, 0x19, 0xC5, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x96, 0xD6, 0xEE, 0x7B, 0x2C, 0x63, 
-    0x4D, 0x63, 0x6D, 0x6B, 0x35, 0xCE, 0x96, 0xDE, 0x96, 0xD6, 0x15, 0xCE, 0xD1, 0xA4, 0xF2, 0xA4, 
-    0xD1, 0x9C, 0xB4, 0xBD, 0xB7, 0xDE, 0x96, 0xD6, 0x97, 0xDE, 0x76, 0xD6, 0x76, 0xD6, 0xD7, 0xDE, 
-    0x31, 0xBD, 0x01, 0x59, 0x42, 0x61, 0x22, 0x59, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xE3, 0x28, 
-    0x47, 0x11, 0x47, 0x11, 0x67, 0x11, 0xE8, 0x38, 0xA8, 0x48, 0x88, 0x48, 0x6A, 0x31, 0xCD, 0x0A, 
-    0xAD, 0x0A, 0xAD, 0x0A, 0xCE, 0x0A, 0xCE, 0x0A, 0xCE, 0x02, 0xAD, 0x1A, 0x29, 0x89, 0x09, 0x91, 
-    0x09, 0x91, 0x49, 0x71, 0xCA, 0x09, 0xA9, 0x11, 0xCA, 0x09, 0x08, 0x31, 0xA7, 0x50, 0xA7, 0x50, 
-    0xC7, 0x48, 0x27, 0x19, 0x27, 0x11, 0x48, 0x19, 0x06, 0x11, 0x41, 0x10, 0x61, 0x10, 0x40, 0x00, 
-    0xC5, 0x58, 0x09, 0x99, 0x08, 0x91, 0x29, 0x89, 0x4C, 0x2A, 0x6C, 0x22, 0x8C, 0x1A, 0xEB, 0x49, 
-    0xE8, 0x98, 0x08, 0x91, 0xE9, 0x98, 0x07, 0x39, 0xE6, 0x08, 0x06, 0x11, 0xC5, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x96, 0xD6, 0xEE, 0x7B, 0x2C, 0x63, 
-    0x4D, 0x63, 0x6D, 0x6B, 0x35, 0xCE, 0x96, 0xD6, 0x96, 0xD6, 0x15, 0xCE, 0xD1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0x9C, 0xB4, 0xBD, 0xB7, 0xDE, 0x96, 0xD6, 0x97, 0xD6, 0x97, 0xDE, 0x97, 0xDE, 0xD8, 0xDE, 
-    0x31, 0xBD, 0x01, 0x59, 0x62, 0x61, 0x42, 0x59, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xC3, 0x28, 
-    0x48, 0x11, 0x47, 0x11, 0x68, 0x11, 0xA8, 0x30, 0x68, 0x38, 0x48, 0x38, 0x2A, 0x29, 0xCE, 0x02, 
-    0x8E, 0x02, 0x8E, 0x02, 0xEE, 0x02, 0x0E, 0x0B, 0x0E, 0x03, 0xCE, 0x12, 0x29, 0x91, 0xE8, 0x98, 
-    0x09, 0xA1, 0x49, 0x79, 0xCA, 0x09, 0xAA, 0x11, 0xCA, 0x09, 0x29, 0x39, 0xA8, 0x58, 0xA8, 0x50, 
-    0xC8, 0x50, 0x48, 0x19, 0x48, 0x11, 0x48, 0x11, 0x06, 0x11, 0x20, 0x08, 0x41, 0x08, 0x20, 0x00, 
-    0xA5, 0x60, 0xE9, 0xA8, 0xE8, 0xA0, 0x08, 0x99, 0x6C, 0x22, 0x8C, 0x1A, 0x8C, 0x12, 0xEB, 0x49, 
-    0xE8, 0xA8, 0x08, 0x99, 0xE9, 0xA0, 0x07, 0x41, 0x06, 0x11, 0x27, 0x19, 0xC5, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x96, 0xD6, 0xEE, 0x7B, 0x2C, 0x63, 
-    0x4D, 0x63, 0x6D, 0x63, 0x35, 0xCE, 0x96, 0xD6, 0x97, 0xD6, 0x15, 0xC6, 0xD1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0x9C, 0xB4, 0xBD, 0xB7, 0xDE, 0x76, 0xD6, 0x97, 0xD6, 0xB4, 0xBD, 0x73, 0xB5, 0xD4, 0xBD, 
-    0x6F, 0x9C, 0xC1, 0x40, 0x02, 0x51, 0x02, 0x51, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xE3, 0x28, 
-    0x27, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x6A, 0x45, 0x8A, 0x25, 0x82, 0x66, 0x7A, 0xA8, 0x52, 
-    0xA8, 0x4A, 0xA8, 0x4A, 0xEA, 0x29, 0xAB, 0x21, 0xCB, 0x21, 0xAB, 0x29, 0x49, 0x51, 0x49, 0x51, 
-    0x49, 0x59, 0x69, 0x41, 0xA9, 0x11, 0x89, 0x11, 0x89, 0x11, 0x28, 0x29, 0xC7, 0x38, 0xE7, 0x30, 
-    0xE6, 0x30, 0xE5, 0x20, 0xE5, 0x20, 0xE5, 0x20, 0xE4, 0x28, 0xC1, 0x38, 0xC1, 0x38, 0xC1, 0x30, 
-    0x46, 0x49, 0xAA, 0x59, 0x89, 0x59, 0xAA, 0x59, 0xCA, 0x59, 0xAA, 0x59, 0xAA, 0x59, 0x89, 0x59, 
-    0x28, 0x51, 0x28, 0x51, 0x28, 0x59, 0xA4, 0x20, 0x83, 0x08, 0x83, 0x08, 0x62, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x97, 0xDE, 0xEE, 0x7B, 0x2C, 0x63, 
-    0x4D, 0x63, 0x6D, 0x6B, 0x35, 0xCE, 0x97, 0xDE, 0x97, 0xDE, 0x15, 0xC6, 0xD1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0x9C, 0xD4, 0xBD, 0xB7, 0xDE, 0x76, 0xD6, 0x97, 0xD6, 0x12, 0xA5, 0x90, 0x9C, 0xF2, 0xA4, 
-    0xAD, 0x83, 0x61, 0x28, 0xE2, 0x48, 0xC2, 0x48, 0xC2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xC3, 0x28, 
-    0x05, 0x11, 0x05, 0x11, 0xE5, 0x08, 0x63, 0xA3, 0x42, 0xDC, 0x23, 0xD4, 0xC2, 0xCB, 0x81, 0xAA, 
-    0x81, 0xAA, 0xC1, 0xAA, 0xE6, 0x58, 0x48, 0x38, 0x67, 0x40, 0x67, 0x38, 0x69, 0x09, 0x89, 0x09, 
-    0x89, 0x09, 0x88, 0x09, 0x47, 0x19, 0x47, 0x19, 0x27, 0x19, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 
-    0x05, 0x11, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xE2, 0x40, 0x42, 0x61, 0x42, 0x61, 0x21, 0x61, 
-    0xC7, 0x31, 0x4C, 0x0A, 0x4B, 0x0A, 0x2B, 0x1A, 0x08, 0x91, 0xE8, 0x98, 0xE8, 0xA0, 0x08, 0x69, 
-    0x47, 0x01, 0x27, 0x09, 0x47, 0x09, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x96, 0xD6, 0xEE, 0x7B, 0x2C, 0x63, 
-    0x4C, 0x63, 0x6D, 0x63, 0x35, 0xCE, 0x97, 0xDE, 0x97, 0xDE, 0x15, 0xCE, 0xD1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0x9C, 0xD4, 0xC5, 0xB7, 0xDE, 0x97, 0xD6, 0x97, 0xDE, 0x32, 0xAD, 0xB1, 0x9C, 0x12, 0xA5, 
-    0xCD, 0x83, 0x81, 0x30, 0xE2, 0x48, 0xE2, 0x48, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xC3, 0x28, 
-    0x06, 0x11, 0x25, 0x11, 0x05, 0x09, 0x24, 0x9B, 0xE3, 0xCB, 0xC3, 0xC3, 0x83, 0xBB, 0x82, 0x9A, 
-    0x82, 0x9A, 0xC2, 0xA2, 0x07, 0x51, 0x68, 0x30, 0x88, 0x38, 0x88, 0x30, 0x69, 0x19, 0x89, 0x11, 
-    0x89, 0x11, 0x69, 0x11, 0x47, 0x19, 0x48, 0x19, 0x48, 0x19, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 
-    0x06, 0x19, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xE2, 0x38, 0x42, 0x59, 0x22, 0x59, 0x21, 0x61, 
-    0xA7, 0x31, 0x2C, 0x12, 0x2B, 0x12, 0x2B, 0x22, 0x29, 0x89, 0x08, 0x91, 0x09, 0x99, 0x28, 0x69, 
-    0x47, 0x09, 0x27, 0x19, 0x47, 0x19, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x96, 0xD6, 0xEE, 0x7B, 0x4C, 0x63, 
-    0x6D, 0x6B, 0x6D, 0x6B, 0x35, 0xCE, 0x97, 0xD6, 0x97, 0xDE, 0x15, 0xCE, 0xD1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0x9C, 0xB4, 0xBD, 0x96, 0xD6, 0x56, 0xD6, 0x56, 0xD6, 0x12, 0xAD, 0xB1, 0x9C, 0x12, 0xA5, 
-    0x8C, 0x7B, 0x81, 0x30, 0xE2, 0x48, 0xE2, 0x48, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xC3, 0x28, 
-    0x25, 0x11, 0x25, 0x19, 0x05, 0x09, 0x23, 0x9B, 0xE3, 0xD3, 0xE3, 0xCB, 0x83, 0xBB, 0x82, 0x9A, 
-    0xA2, 0xA2, 0xA2, 0xA2, 0x26, 0x59, 0x68, 0x38, 0xA8, 0x40, 0xA8, 0x40, 0x68, 0x19, 0x68, 0x11, 
-    0x68, 0x19, 0x68, 0x19, 0x27, 0x19, 0x47, 0x19, 0x47, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 
-    0x05, 0x19, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xE2, 0x40, 0x42, 0x59, 0x22, 0x59, 0x21, 0x61, 
-    0xA6, 0x31, 0x2B, 0x12, 0x0A, 0x12, 0x0A, 0x1A, 0x09, 0x81, 0xE8, 0x88, 0xE8, 0x90, 0x08, 0x61, 
-    0x26, 0x09, 0x06, 0x11, 0x26, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA6, 0x39, 0xD7, 0xDE, 0x56, 0xD6, 0x76, 0xD6, 0x35, 0xCE, 0x15, 0xC6, 
-    0x15, 0xCE, 0x35, 0xCE, 0x76, 0xD6, 0x76, 0xD6, 0x97, 0xDE, 0x15, 0xC6, 0xD1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0xA4, 0xD1, 0xA4, 0xF1, 0xA4, 0xF1, 0xA4, 0xD1, 0xA4, 0xD1, 0x9C, 0xB0, 0x9C, 0x32, 0xA5, 
-    0x68, 0x62, 0x61, 0x28, 0xC2, 0x38, 0xC2, 0x30, 0xA2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xC2, 0x38, 
-    0x22, 0x59, 0x22, 0x59, 0x22, 0x51, 0xE2, 0xA2, 0x82, 0xBB, 0x02, 0x82, 0xA2, 0x71, 0x62, 0x69, 
-    0x22, 0x8A, 0xE2, 0xB2, 0xA2, 0xA2, 0x43, 0xB3, 0x84, 0xBB, 0x63, 0xB3, 0x42, 0x59, 0x02, 0x49, 
-    0x22, 0x51, 0x03, 0x41, 0xC5, 0x10, 0xE5, 0x18, 0xC5, 0x10, 0xE3, 0x30, 0xE2, 0x48, 0xE2, 0x40, 
-    0xE2, 0x48, 0xC2, 0x38, 0xE2, 0x48, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x59, 0x22, 0x51, 0x22, 0x51, 0x23, 0x51, 0x87, 0x40, 0x88, 0x38, 0x88, 0x40, 0x45, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC6, 0x39, 0xB7, 0xDE, 0x35, 0xCE, 0x56, 0xD6, 0x76, 0xD6, 0x96, 0xD6, 
-    0x97, 0xDE, 0x97, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0xB7, 0xDE, 0xF4, 0xC5, 0xB1, 0x9C, 0xD1, 0xA4, 
-    0xD1, 0xA4, 0xD1, 0x9C, 0xD1, 0x9C, 0xB1, 0x9C, 0xB1, 0x9C, 0x90, 0x9C, 0xF2, 0xA4, 0x2F, 0x8C, 
-    0xC2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xC2, 0x38, 
-    0x21, 0x61, 0x21, 0x59, 0x21, 0x59, 0xE2, 0xA2, 0x42, 0xBB, 0x82, 0x71, 0x41, 0x61, 0x21, 0x61, 
-    0x02, 0x82, 0x02, 0xB3, 0xC2, 0xAA, 0xA3, 0xC3, 0x03, 0xCC, 0xA3, 0xC3, 0x42, 0x59, 0x02, 0x51, 
-    0x01, 0x59, 0xE2, 0x40, 0xC5, 0x10, 0xC4, 0x18, 0xC5, 0x10, 0xE2, 0x38, 0xE1, 0x50, 0xE1, 0x50, 
-    0xE1, 0x50, 0xC2, 0x40, 0xE2, 0x48, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x21, 0x59, 0x22, 0x59, 0x21, 0x59, 0x02, 0x59, 0x87, 0x38, 0x67, 0x38, 0x68, 0x38, 0x44, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x44, 0x29, 0xD7, 0xE6, 0xD8, 0xE6, 0xF8, 0xE6, 0x97, 0xDE, 0x96, 0xD6, 
-    0x97, 0xDE, 0x97, 0xD6, 0x97, 0xDE, 0xB7, 0xDE, 0x56, 0xD6, 0x12, 0xAD, 0xD1, 0xA4, 0xF2, 0xA4, 
-    0xF1, 0xA4, 0xF1, 0xA4, 0xF2, 0xA4, 0x32, 0xAD, 0x12, 0xAD, 0x32, 0xAD, 0x4F, 0x94, 0x24, 0x41, 
-    0xA2, 0x30, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x38, 0xC2, 0x30, 0xE2, 0x40, 
-    0x21, 0x61, 0x21, 0x61, 0x21, 0x59, 0xE2, 0xA2, 0x42, 0xBB, 0x82, 0x71, 0x21, 0x61, 0x21, 0x59, 
-    0x02, 0x82, 0xE2, 0xB2, 0xE2, 0xAA, 0xC3, 0xCB, 0x23, 0xD4, 0xC3, 0xCB, 0x41, 0x61, 0x01, 0x51, 
-    0x01, 0x59, 0xE2, 0x40, 0xC5, 0x10, 0xC4, 0x18, 0xC5, 0x10, 0xE2, 0x38, 0xE1, 0x58, 0xE1, 0x50, 
-    0xE1, 0x50, 0xC2, 0x40, 0xE2, 0x48, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x02, 0x59, 0x88, 0x40, 0x88, 0x38, 0x89, 0x40, 0x44, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x52, 0x4F, 0x8C, 0x0E, 0x84, 0x93, 0xB5, 0xF5, 0xC5, 
-    0xF4, 0xC5, 0xF5, 0xC5, 0xF5, 0xC5, 0xF4, 0xC5, 0x12, 0xAD, 0x70, 0x94, 0x4F, 0x8C, 0x50, 0x8C, 
-    0x50, 0x8C, 0x50, 0x8C, 0x2F, 0x8C, 0x2B, 0x6B, 0x2B, 0x6B, 0xA9, 0x52, 0x81, 0x18, 0x40, 0x18, 
-    0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0x61, 0x18, 0xA1, 0x28, 
-    0x22, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0xA2, 0x42, 0xBB, 0x02, 0x82, 0xC2, 0x79, 0xC2, 0x79, 
-    0x62, 0x92, 0x02, 0xB3, 0x42, 0x82, 0xC3, 0x8A, 0x04, 0x93, 0xC4, 0x8A, 0x23, 0x49, 0x03, 0x41, 
-    0x03, 0x41, 0x03, 0x31, 0xE5, 0x10, 0xE5, 0x18, 0xE5, 0x10, 0xE4, 0x30, 0xE3, 0x40, 0xE3, 0x40, 
-    0x03, 0x41, 0xC2, 0x40, 0xC2, 0x40, 0x02, 0x51, 0x02, 0x51, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x02, 0x51, 0x65, 0x28, 0x45, 0x28, 0x45, 0x28, 0x22, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x7B, 0xF1, 0xA4, 
-    0xB1, 0x9C, 0xB1, 0x9C, 0xD1, 0x9C, 0xB1, 0x9C, 0xF2, 0xA4, 0xEF, 0x7B, 0x0C, 0x5B, 0x2C, 0x63, 
-    0x2C, 0x5B, 0x2C, 0x63, 0x0B, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 
-    0x05, 0x11, 0xE5, 0x08, 0xE5, 0x10, 0xE3, 0x9A, 0x42, 0xBB, 0x22, 0xB3, 0x42, 0xB3, 0x42, 0xB3, 
-    0x42, 0xB3, 0x42, 0xB3, 0x04, 0x21, 0x84, 0x08, 0xA4, 0x08, 0xA4, 0x08, 0x06, 0x11, 0x26, 0x11, 
-    0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x06, 0x11, 0x26, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 
-    0x26, 0x19, 0xC2, 0x38, 0xC2, 0x38, 0xA2, 0x38, 0xC2, 0x40, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x59, 0x21, 0x59, 0x22, 0x59, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x84, 0x12, 0xA5, 
-    0xD1, 0xA4, 0xF1, 0xA4, 0xF1, 0xA4, 0xF1, 0xA4, 0x12, 0xAD, 0x0F, 0x84, 0x2C, 0x63, 0x6D, 0x63, 
-    0x4C, 0x63, 0x6D, 0x63, 0x2C, 0x63, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 
-    0xE5, 0x10, 0xE4, 0x10, 0xE4, 0x10, 0xC3, 0x92, 0x22, 0xB3, 0x02, 0xAB, 0x22, 0xAB, 0x22, 0xB3, 
-    0x22, 0xAB, 0x22, 0xB3, 0x24, 0x31, 0xC4, 0x10, 0xC4, 0x18, 0xC4, 0x18, 0x06, 0x11, 0x26, 0x11, 
-    0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x19, 0x26, 0x19, 0x27, 0x19, 
-    0x26, 0x19, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0x21, 0x59, 0x22, 0x59, 0x21, 0x59, 
-    0x21, 0x59, 0x21, 0x59, 0x22, 0x59, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x83, 0xF1, 0xA4, 
-    0xB1, 0x9C, 0xB1, 0x9C, 0xB1, 0x9C, 0xB1, 0x9C, 0xD1, 0xA4, 0xEE, 0x7B, 0x0C, 0x5B, 0x2C, 0x63, 
-    0x2C, 0x5B, 0x2C, 0x63, 0xEB, 0x52, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 
-    0x05, 0x11, 0xE5, 0x10, 0xE5, 0x10, 0xE3, 0xA2, 0x62, 0xBB, 0x62, 0xBB, 0xA2, 0xA2, 0x82, 0x9A, 
-    0x62, 0xC3, 0x42, 0xBB, 0x24, 0x31, 0xA4, 0x10, 0xC4, 0x18, 0xC4, 0x10, 0x06, 0x11, 0x06, 0x11, 
-    0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x27, 0x11, 
-    0x26, 0x19, 0xC2, 0x38, 0xC2, 0x40, 0xC2, 0x38, 0xE2, 0x48, 0x42, 0x61, 0x42, 0x59, 0x42, 0x59, 
-    0x22, 0x59, 0x22, 0x59, 0x42, 0x59, 0x22, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xAD, 0x56, 0xCE, 
-    0xF5, 0xC5, 0xF4, 0xC5, 0xD4, 0xC5, 0xB4, 0xBD, 0xF4, 0xC5, 0xD1, 0x9C, 0xEE, 0x7B, 0x0F, 0x84, 
-    0xEE, 0x7B, 0x0F, 0x84, 0xAD, 0x73, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x00, 0x41, 0x00, 0x41, 0x00, 0x43, 0x39, 0xA4, 0x49, 0x84, 0x49, 0x64, 0x41, 0x45, 0x31, 
-    0xE5, 0x49, 0xE5, 0x49, 0x26, 0x21, 0x06, 0x11, 0x06, 0x19, 0x06, 0x19, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x47, 0x19, 0x26, 0x11, 0x27, 0x11, 
-    0x26, 0x19, 0xC4, 0x18, 0xA3, 0x18, 0xC4, 0x20, 0x82, 0x18, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 
-    0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xB5, 0xB7, 0xDE, 
-    0x76, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0x76, 0xD6, 0x97, 0xDE, 0x94, 0xBD, 0xB1, 0x9C, 0xF1, 0xA4, 
-    0xD1, 0xA4, 0xD1, 0xA4, 0xF2, 0xA4, 0xE3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x08, 0xA4, 0x08, 0x84, 0x08, 0xC5, 0x08, 0x27, 0x11, 
-    0x07, 0x09, 0x07, 0x09, 0x26, 0x11, 0x47, 0x19, 0x26, 0x11, 0x27, 0x11, 0xC9, 0x19, 0xE9, 0x19, 
-    0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0x47, 0x19, 0x26, 0x11, 0x27, 0x11, 
-    0x26, 0x19, 0xC4, 0x10, 0xA4, 0x10, 0xC4, 0x10, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0xBD, 0xD7, 0xE6, 
-    0x97, 0xDE, 0x97, 0xDE, 0x97, 0xDE, 0x97, 0xDE, 0xB7, 0xDE, 0xD4, 0xBD, 0xD1, 0x9C, 0xF2, 0xA4, 
-    0xF1, 0xA4, 0xD1, 0x9C, 0x53, 0xAD, 0x68, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x10, 0xE4, 0x18, 0xC4, 0x18, 0xE5, 0x18, 0x26, 0x19, 
-    0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x19, 0x26, 0x11, 0x26, 0x19, 0xA9, 0x19, 0xC9, 0x19, 
-    0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0x47, 0x19, 0x26, 0x11, 0x27, 0x11, 
-    0x26, 0x19, 0xC4, 0x10, 0xA4, 0x10, 0xC4, 0x10, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x9C, 0xD4, 0xBD, 
-    0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0xB4, 0xBD, 0xD1, 0x9C, 0xEE, 0x83, 0x2F, 0x8C, 
-    0x2F, 0x8C, 0x0F, 0x84, 0x4F, 0x8C, 0x6C, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0x83, 0x10, 0x83, 0x08, 0xA4, 0x10, 0x26, 0x11, 
-    0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x11, 0xA9, 0x19, 0xC9, 0x19, 
-    0xC9, 0x19, 0xC9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0x47, 0x19, 0x06, 0x11, 0x26, 0x11, 
-    0x26, 0x11, 0xC4, 0x10, 0xA4, 0x10, 0xC4, 0x10, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0xE5, 0x18, 
-    0xC4, 0x10, 0xC4, 0x10, 0x67, 0x19, 0xC9, 0x19, 0xA9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 
-    0xC9, 0x19, 0x88, 0x19, 0x26, 0x11, 0x26, 0x11, 0x27, 0x11, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xC4, 0x10, 
-    0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0xE5, 0x18, 
-    0xC5, 0x10, 0xC4, 0x10, 0x67, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 
-    0xC9, 0x19, 0x88, 0x11, 0x06, 0x11, 0x26, 0x11, 0x27, 0x11, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE5, 0x10, 
-    0xC4, 0x10, 0xC4, 0x10, 0x67, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 
-    0xC9, 0x19, 0xA8, 0x19, 0x27, 0x19, 0x47, 0x19, 0x47, 0x19, 0xE5, 0x10, 0xA4, 0x10, 0xC4, 0x10, 
-    0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x88, 0x19, 
-    0x67, 0x11, 0x67, 0x19, 0xA8, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0x88, 0x19, 0x68, 0x11, 
-    0x88, 0x19, 0x26, 0x11, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0xC4, 0x10, 0x05, 0x11, 0xE5, 0x10, 
-    0x05, 0x11, 0x05, 0x11, 0xE5, 0x10, 0x05, 0x11, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0xA2, 0x20, 0xA1, 0x30, 0xA1, 0x28, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x08, 0xEA, 0x19, 
-    0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0x27, 0x11, 0x06, 0x11, 
-    0x27, 0x19, 0xC4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x08, 0x26, 0x11, 0x06, 0x11, 
-    0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0x26, 0x11, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0x03, 0x39, 0x02, 0x51, 0x02, 0x51, 0xE2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0xC9, 0x19, 
-    0xA9, 0x11, 0xA9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 0xA9, 0x19, 0x47, 0x11, 0x26, 0x11, 
-    0x47, 0x19, 0xC4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x26, 0x19, 0x26, 0x11, 
-    0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0xE3, 0x38, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x08, 0x82, 0x08, 0xC9, 0x19, 
-    0xA8, 0x19, 0xA8, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0xA8, 0x19, 0x26, 0x11, 0x06, 0x11, 
-    0x27, 0x19, 0xA4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x08, 0x06, 0x11, 0xE5, 0x10, 
-    0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x05, 0x19, 0xC4, 0x18, 0xC4, 0x18, 0xC4, 0x10, 
-    0xE3, 0x38, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 0x62, 0x61, 0x41, 0x61, 
-    0x21, 0x59, 0xC1, 0x40, 0xC1, 0x40, 0xE1, 0x48, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x51, 0x81, 0x69, 0x61, 0x61, 0x81, 0x69, 0x82, 0x69, 
-    0x82, 0x61, 0x82, 0x69, 0x04, 0x29, 0xE5, 0x10, 0xE5, 0x18, 0xE5, 0x10, 0xC4, 0x10, 0xC4, 0x10, 
-    0xE5, 0x18, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x06, 0x11, 0x06, 0x19, 0x06, 0x11, 0x05, 0x29, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x40, 0xE2, 0x40, 0xA2, 0x38, 0x62, 0x61, 
-    0x82, 0xA2, 0x62, 0x9A, 0x62, 0x92, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x59, 0x62, 0x69, 0x62, 0x69, 
-    0x42, 0x61, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x50, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x59, 0xA2, 0x71, 0x82, 0x69, 0x82, 0x71, 0x81, 0x69, 
-    0x81, 0x69, 0x81, 0x71, 0x04, 0x29, 0xC4, 0x10, 0xC4, 0x18, 0xC4, 0x18, 0xC4, 0x10, 0xC4, 0x10, 
-    0xC4, 0x10, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x05, 0x11, 0x26, 0x19, 0x06, 0x11, 0x04, 0x29, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x40, 0xA2, 0x69, 
-    0xA2, 0xAA, 0x82, 0xA2, 0x82, 0x9A, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x59, 0x82, 0x69, 0x82, 0x69, 
-    0x42, 0x61, 0xC2, 0x48, 0xC1, 0x48, 0xC2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x59, 0x81, 0x71, 0x81, 0x69, 0x81, 0x69, 0xA2, 0x71, 
-    0x82, 0x69, 0xA1, 0x71, 0x04, 0x29, 0xC5, 0x08, 0xE5, 0x10, 0xC5, 0x10, 0xE4, 0x18, 0xC4, 0x18, 
-    0xE5, 0x18, 0x83, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x06, 0x11, 0x26, 0x11, 0x06, 0x09, 0x05, 0x29, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x40, 0xE2, 0x40, 0xC2, 0x38, 0xA2, 0x69, 
-    0xC2, 0xAA, 0xA2, 0xAA, 0xA2, 0xA2, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x40, 0x22, 0x51, 0x02, 0x51, 
-    0x22, 0x51, 0x22, 0x59, 0x21, 0x51, 0x22, 0x59, 0xC1, 0x30, 0xA1, 0x28, 0xA1, 0x28, 0x81, 0x20, 
-    0x40, 0x18, 0x40, 0x10, 0x40, 0x10, 0x41, 0x59, 0x82, 0x71, 0x81, 0x69, 0x62, 0x69, 0x42, 0x59, 
-    0x42, 0x61, 0x41, 0x61, 0x03, 0x39, 0xE3, 0x28, 0xE3, 0x30, 0xE3, 0x28, 0x62, 0x10, 0x62, 0x08, 
-    0x62, 0x08, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE4, 0x28, 0x04, 0x31, 0x04, 0x29, 0x03, 0x39, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x22, 0x51, 0x22, 0x59, 0x22, 0x51, 0x62, 0x61, 
-    0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x71, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xA2, 0x30, 0x82, 0x28, 
-    0xE2, 0x40, 0xA2, 0x71, 0x82, 0x71, 0xA2, 0x71, 0xC2, 0x79, 0xC2, 0x79, 0xE2, 0x79, 0x62, 0x69, 
-    0xE2, 0x48, 0x02, 0x51, 0x02, 0x49, 0x62, 0x69, 0x82, 0x69, 0x82, 0x69, 0x42, 0x61, 0xC1, 0x40, 
-    0xC1, 0x48, 0xE1, 0x48, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x48, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x48, 0x02, 0x51, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 0x82, 0x71, 0x82, 0x71, 0xA2, 0x71, 0x22, 0x59, 
-    0x82, 0x30, 0xA2, 0x38, 0x81, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xC2, 0x38, 0xA2, 0x30, 
-    0xE2, 0x40, 0x82, 0x71, 0x82, 0x69, 0x82, 0x69, 0x82, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0x42, 0x59, 
-    0xC2, 0x40, 0xE2, 0x48, 0xE1, 0x48, 0x62, 0x69, 0x82, 0x69, 0x82, 0x71, 0x62, 0x61, 0xC1, 0x48, 
-    0xE1, 0x48, 0xE1, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0xE2, 0x50, 0xE1, 0x48, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x40, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 0x82, 0x69, 0x82, 0x69, 0x82, 0x71, 0x42, 0x59, 
-    0xC2, 0x40, 0xC2, 0x40, 0xC1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xA2, 0x30, 0xA2, 0x30, 
-    0xE2, 0x40, 0xA2, 0x71, 0x82, 0x71, 0x82, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0xC2, 0x71, 0x62, 0x61, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x62, 0x69, 0x82, 0x69, 0x82, 0x69, 0x42, 0x61, 0xC1, 0x40, 
-    0xE1, 0x48, 0xE1, 0x48, 0xE2, 0x48, 0xE1, 0x48, 0xE2, 0x50, 0xE1, 0x48, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x48, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x49, 0x82, 0x69, 0x82, 0x71, 0xA2, 0x71, 0x42, 0x59, 
-    0xC2, 0x38, 0xC2, 0x40, 0xC2, 0x38, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-    0x40, 0x10, 0xE2, 0x40, 0xC2, 0x38, 0xE2, 0x40, 0x82, 0x61, 0xA2, 0x71, 0x82, 0x71, 0x82, 0x69, 
-    0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x02, 0x51, 0xE2, 0x48, 0xE1, 0x48, 0xE1, 0x48, 0xC1, 0x48, 
-    0xE1, 0x48, 0xE1, 0x48, 0xC2, 0x38, 0xA2, 0x30, 0xC2, 0x38, 0xA1, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x18, 0x81, 0x20, 0x61, 0x18, 0xA2, 0x30, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0xC2, 0x40, 0xA2, 0x30, 0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xC2, 0x40, 
-    0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xA2, 0x38, 0xA1, 0x30, 0xA2, 0x38, 0x61, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0xA2, 0x30, 0xA2, 0x28, 0x82, 0x28, 0x62, 0x61, 0xA2, 0x71, 0x82, 0x69, 0x82, 0x69, 
-    0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0xE2, 0x48, 0xC2, 0x40, 0xE2, 0x40, 0xE1, 0x40, 0xE1, 0x48, 
-    0xE1, 0x48, 0xE1, 0x48, 0xA2, 0x30, 0xA2, 0x28, 0xA2, 0x30, 0x82, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x21, 0x00, 0x81, 0x20, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 
-    0xC2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 
-    0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0x61, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0xC2, 0x38, 0xC2, 0x30, 0xA2, 0x30, 0x62, 0x61, 0xA2, 0x71, 0x82, 0x71, 0x82, 0x71, 
-    0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0xE2, 0x48, 0xC2, 0x40, 0xC2, 0x40, 0xC1, 0x40, 0xE1, 0x48, 
-    0xE1, 0x48, 0xE1, 0x48, 0xC2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x21, 0x00, 0x81, 0x20, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 
-    0xC2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x40, 0x61, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0x81, 0x28, 0x81, 0x28, 0x81, 0x20, 0x22, 0x51, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 
-    0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0x22, 0x51, 0x02, 0x51, 0x02, 0x51, 0x02, 0x49, 0xC2, 0x40, 
-    0xC2, 0x40, 0xC2, 0x40, 0x81, 0x28, 0x81, 0x20, 0x81, 0x28, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x18, 0x81, 0x20, 0x81, 0x20, 0xC2, 0x30, 0x22, 0x51, 0x02, 0x51, 0x22, 0x51, 
-    0xE2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xA2, 0x38, 0xA2, 0x30, 0xA2, 0x38, 0x81, 0x30, 
-    0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x30, 0x40, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xC2, 0x38, 0xA2, 0x30, 0xC2, 0x38, 
-    0xE1, 0x50, 0xE2, 0x50, 0xE1, 0x50, 0x82, 0x69, 0xC2, 0x71, 0xC2, 0x79, 0x62, 0x61, 0xA2, 0x28, 
-    0xA2, 0x30, 0xA2, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x59, 0x42, 0x61, 0x22, 0x61, 0x42, 0x61, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 
-    0x22, 0x59, 0xE2, 0x50, 0x02, 0x51, 0xE2, 0x50, 0xA2, 0x38, 0xA2, 0x30, 0xC2, 0x38, 0x61, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xC2, 0x38, 0xA2, 0x30, 0xC2, 0x38, 
-    0xE2, 0x50, 0xE2, 0x50, 0xE2, 0x48, 0x82, 0x69, 0xA2, 0x71, 0xC2, 0x71, 0x62, 0x61, 0xA2, 0x30, 
-    0xA2, 0x30, 0xC2, 0x38, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x62, 0x61, 0x62, 0x61, 0x62, 0x69, 
-    0x22, 0x59, 0xE2, 0x50, 0x02, 0x51, 0xE2, 0x48, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 0x61, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x30, 0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x40, 
-    0x01, 0x51, 0xE2, 0x50, 0xE2, 0x50, 0x82, 0x69, 0xC2, 0x79, 0xC2, 0x79, 0x62, 0x61, 0x82, 0x28, 
-    0x82, 0x28, 0xA2, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x59, 0x42, 0x61, 0x22, 0x59, 0x42, 0x61, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 
-    0x22, 0x59, 0xE2, 0x50, 0x02, 0x51, 0xE2, 0x50, 0xC2, 0x38, 0xA2, 0x30, 0xC2, 0x38, 0x61, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x61, 0x18, 0x41, 0x18, 0x81, 0x20, 
-    0xE2, 0x40, 0xC2, 0x40, 0xE2, 0x40, 0x02, 0x51, 0x22, 0x51, 0x22, 0x51, 0x42, 0x51, 0x62, 0x59, 
-    0x62, 0x59, 0x82, 0x61, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 
-    0xE2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x38, 0x40, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xC2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x82, 0x28, 0x02, 0x41, 0x01, 0x82, 
-    0xE1, 0x81, 0x22, 0x8A, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xA2, 0x30, 0x02, 0x49, 0x02, 0x82, 
-    0xE2, 0x79, 0x02, 0x82, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA2, 0x30, 0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xA2, 0x28, 0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x28, 0xA2, 0x28, 0x82, 0x28, 0xE2, 0x40, 0xC1, 0x71, 
-    0xC1, 0x71, 0xE2, 0x79, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x81, 0x28, 0xA2, 0x30, 0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x28, 0x82, 0x28, 0xA2, 0x30, 0x81, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-/* LVGL image descriptor */
-const lv_img_dsc_t howdy_img_howdyleft = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 128,
-    .header.h = 128,
-    .data_size = 32768,
-    .data = howdy_img_howdyleft_data,
-};
@@ -1,1428 +0,0 @@
-/* Auto-generated LVGL image data from HowdyMidget.png */
-/* Original size: 521x762, Scaled: 88x128 */
-
-#include "howdy_img_howdymidget.h"
-
-/* Image data in RGB565 format */
-static const uint8_t howdy_img_howdymidget_data[] = {
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x46, 0x4A, 0xAA, 0x83, 0xE6, 0x72, 0xE4, 0x59, 0x22, 0x31, 
-    0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x43, 0x29, 0x4A, 0xAC, 0x0A, 0xD5, 0x0F, 0xE6, 0x73, 0xE6, 0xA9, 0xCC, 0x65, 0xB3, 
-    0xC5, 0x82, 0x65, 0x41, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x10, 0x45, 0x93, 0x61, 0x51, 0x20, 0x49, 0x01, 0xA3, 0xEA, 0xCC, 0xF1, 0xCD, 0x28, 0xB4, 
-    0x44, 0xAB, 0x26, 0x9B, 0x89, 0x72, 0x05, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x41, 0x21, 0x39, 0x00, 0x00, 0x00, 0x00, 0x62, 0x41, 0xC3, 0xBB, 0x2D, 0xC5, 0x2E, 0xC5, 
-    0x85, 0xAB, 0x03, 0x9B, 0xC4, 0x8A, 0x0A, 0x8B, 0x29, 0x52, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xE2, 0x20, 0xA4, 0x41, 
-    0x05, 0x52, 0x45, 0x62, 0x46, 0x62, 0x46, 0x5A, 0xC5, 0x41, 0x44, 0x29, 0x82, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x93, 0xC9, 0xCC, 0x2D, 0xC5, 
-    0xC6, 0xB3, 0x44, 0xA3, 0xC3, 0x92, 0xA3, 0x8A, 0xE9, 0x8A, 0xAC, 0x62, 0x62, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x31, 0xA5, 0x6A, 0x26, 0x8B, 0x26, 0x93, 0xE5, 0x8A, 
-    0x85, 0x7A, 0x65, 0x72, 0x65, 0x62, 0x65, 0x6A, 0x65, 0x72, 0xA6, 0x7A, 0xA6, 0x7A, 0x26, 0x5A, 
-    0xC2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x7A, 0xE9, 0xD4, 0x0C, 0xC5, 
-    0xA5, 0xAB, 0x24, 0x9B, 0xE3, 0x9A, 0xE3, 0x92, 0x83, 0x8A, 0xC9, 0x82, 0xCE, 0x62, 0x41, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA4, 0x39, 0x87, 0x93, 0x85, 0xAB, 0xA4, 0x82, 0xE4, 0x59, 0xA5, 0x31, 0x86, 0x19, 
-    0xA8, 0x01, 0x88, 0x09, 0x47, 0x21, 0xA9, 0x01, 0xA9, 0x01, 0xA7, 0x19, 0xA6, 0x31, 0x05, 0x62, 
-    0x46, 0x6A, 0xE5, 0x49, 0x81, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xAB, 0xE9, 0xCC, 0x68, 0xBC, 
-    0x64, 0xAB, 0x03, 0x9B, 0x03, 0x9B, 0x04, 0x9B, 0xA3, 0x8A, 0x45, 0x72, 0xCC, 0x72, 0xAD, 0x52, 
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x18, 
-    0x47, 0x83, 0xE6, 0xB3, 0x63, 0x82, 0x84, 0x31, 0x46, 0x21, 0xA9, 0x01, 0xC8, 0x11, 0xC2, 0x71, 
-    0xC8, 0x21, 0x08, 0x39, 0x08, 0x39, 0x09, 0x31, 0xE8, 0x21, 0xC2, 0x69, 0xA9, 0x09, 0x89, 0x01, 
-    0x46, 0x31, 0x06, 0x5A, 0x46, 0x6A, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x62, 0x67, 0xC4, 0x47, 0xBC, 0x26, 0xBC, 
-    0x64, 0xAB, 0x44, 0xA3, 0x65, 0xA3, 0x04, 0x9B, 0x63, 0x82, 0x23, 0x72, 0x06, 0x62, 0x0E, 0x63, 
-    0xAE, 0x4A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x41, 0x08, 0xAC, 
-    0x04, 0x9B, 0x64, 0x31, 0x88, 0x01, 0x28, 0x21, 0x86, 0x58, 0xC7, 0x58, 0x66, 0x49, 0xA0, 0x81, 
-    0x05, 0x59, 0xA7, 0x50, 0xA7, 0x39, 0x46, 0x60, 0x25, 0x59, 0x60, 0x81, 0x65, 0x49, 0xC8, 0x40, 
-    0x67, 0x60, 0x48, 0x19, 0xE7, 0x39, 0x05, 0x6A, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x72, 0x87, 0xCC, 0xC9, 0xC4, 0x05, 0x8B, 0xE8, 0xAB, 
-    0x48, 0xBC, 0xA6, 0xAB, 0x44, 0x9B, 0xE4, 0x92, 0x63, 0x82, 0x03, 0x72, 0xE4, 0x61, 0x29, 0x5A, 
-    0x51, 0x63, 0x88, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x6A, 0x26, 0xBC, 0x44, 0x72, 
-    0x66, 0x21, 0xA5, 0x39, 0x87, 0x29, 0xE7, 0x48, 0xA4, 0x61, 0xA6, 0x58, 0xE7, 0x48, 0xA6, 0x49, 
-    0xAA, 0x21, 0x8B, 0x21, 0x69, 0x29, 0x09, 0x31, 0x49, 0x29, 0xE4, 0x49, 0x26, 0x51, 0xE7, 0x50, 
-    0x05, 0x59, 0x29, 0x31, 0x0B, 0x02, 0xC8, 0x29, 0xE5, 0x61, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x08, 0x46, 0x8B, 0x86, 0xD4, 0x05, 0xBC, 0x6B, 0xD5, 0x65, 0x9B, 0x86, 0x72, 
-    0xC8, 0xAB, 0x65, 0xA3, 0x24, 0x9B, 0xE4, 0x92, 0xA3, 0x8A, 0x23, 0x72, 0xE4, 0x61, 0x07, 0x5A, 
-    0x0E, 0x63, 0x6C, 0x42, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7B, 0xC6, 0xB3, 0xE4, 0x41, 0xA9, 0x01, 
-    0xC8, 0x21, 0x81, 0x89, 0x63, 0x69, 0xC7, 0x50, 0x07, 0x59, 0x88, 0x29, 0x2A, 0x12, 0x08, 0x32, 
-    0x28, 0x32, 0x27, 0x32, 0x27, 0x3A, 0x07, 0x32, 0x08, 0x2A, 0x09, 0x12, 0x0B, 0x02, 0xAA, 0x21, 
-    0xE6, 0x58, 0x08, 0x39, 0xE5, 0x41, 0xA5, 0x31, 0xE8, 0x39, 0xC5, 0x59, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x86, 0x93, 0x86, 0xD4, 0xE4, 0xBB, 0xA7, 0xC4, 0xE8, 0xCC, 0x83, 0x8A, 0x63, 0x49, 
-    0x83, 0x51, 0xE5, 0x8A, 0x86, 0xA3, 0x04, 0x93, 0xA3, 0x8A, 0x63, 0x7A, 0x04, 0x6A, 0x06, 0x5A, 
-    0xCD, 0x62, 0x8D, 0x42, 0x82, 0x08, 0x47, 0x83, 0x85, 0xB3, 0x85, 0x39, 0xC7, 0x38, 0x08, 0x41, 
-    0x47, 0x39, 0x43, 0x79, 0x09, 0x32, 0x0B, 0x1A, 0x07, 0x42, 0x05, 0x5A, 0xC5, 0x59, 0xE5, 0x41, 
-    0xA7, 0x49, 0xA8, 0x41, 0xC7, 0x29, 0xC6, 0x29, 0xC6, 0x41, 0xA4, 0x51, 0xC5, 0x51, 0x09, 0x22, 
-    0xCB, 0x09, 0x67, 0x41, 0x41, 0x79, 0x84, 0x51, 0xAA, 0x01, 0x27, 0x5A, 0xE3, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE5, 0x7A, 0x65, 0xCC, 0xA4, 0xB3, 0x46, 0xC4, 0x4A, 0xCD, 0x04, 0x93, 0x21, 0x49, 0xE2, 0x38, 
-    0x02, 0x41, 0xC3, 0x61, 0x05, 0x93, 0x24, 0x9B, 0xA3, 0x8A, 0x43, 0x7A, 0x04, 0x6A, 0x26, 0x62, 
-    0x8B, 0x52, 0x50, 0x5B, 0x8C, 0xAC, 0x84, 0xB3, 0xC6, 0x31, 0x49, 0x21, 0x47, 0x49, 0x68, 0x41, 
-    0x29, 0x39, 0xEA, 0x19, 0x28, 0x32, 0xE4, 0x69, 0x45, 0x61, 0x88, 0x29, 0x2B, 0x0A, 0x6E, 0x59, 
-    0x6F, 0x59, 0x4F, 0x61, 0x4E, 0x59, 0x4D, 0x02, 0x8D, 0x02, 0x2C, 0x02, 0x46, 0x31, 0xA3, 0x59, 
-    0xC5, 0x49, 0xE9, 0x11, 0x83, 0x61, 0x24, 0x51, 0xA7, 0x40, 0x68, 0x29, 0x06, 0x52, 0x20, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x39, 
-    0x66, 0xC4, 0xE5, 0xBB, 0x29, 0xD5, 0x91, 0xE6, 0xEF, 0xD5, 0x25, 0x93, 0xC4, 0x8A, 0x86, 0x72, 
-    0xE2, 0x38, 0x03, 0x6A, 0x25, 0x9B, 0xE4, 0x92, 0x63, 0x82, 0x23, 0x7A, 0x23, 0x6A, 0x05, 0x62, 
-    0xEA, 0x51, 0x2B, 0xA4, 0xA5, 0xB3, 0xA5, 0x31, 0xCA, 0x01, 0x08, 0x49, 0x25, 0x61, 0xC9, 0x29, 
-    0x8C, 0x0A, 0x05, 0x5A, 0xC1, 0x81, 0x24, 0x69, 0xCB, 0x48, 0x8A, 0x29, 0x6D, 0x61, 0xCD, 0x41, 
-    0xAD, 0x02, 0xAD, 0x02, 0xAE, 0x49, 0xAF, 0x51, 0xAD, 0x02, 0x6B, 0x41, 0x89, 0x78, 0x48, 0x19, 
-    0xA5, 0x31, 0xA4, 0x59, 0xA9, 0x11, 0x28, 0x31, 0xA5, 0x58, 0x07, 0x29, 0x28, 0x32, 0x23, 0x39, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x08, 0xC2, 0x18, 0x81, 0x10, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x82, 
-    0x25, 0xC4, 0x87, 0xC4, 0x0B, 0xB5, 0x51, 0xD6, 0xAE, 0xD5, 0x07, 0xA4, 0xA6, 0x93, 0x66, 0x9B, 
-    0x47, 0x62, 0x23, 0x72, 0x04, 0x9B, 0x83, 0x8A, 0x42, 0x82, 0x21, 0x72, 0xA4, 0x79, 0x0A, 0x71, 
-    0xAE, 0xB3, 0xE6, 0xB3, 0xC6, 0x31, 0xE6, 0x39, 0xC3, 0x69, 0x86, 0x60, 0xE9, 0x48, 0x29, 0x2A, 
-    0xC3, 0x71, 0x80, 0x81, 0x80, 0x9A, 0xA5, 0x71, 0xEA, 0x38, 0x0B, 0x61, 0x8C, 0x49, 0x8D, 0x02, 
-    0x8D, 0x51, 0x2D, 0x22, 0x2D, 0x12, 0x4F, 0x61, 0x8B, 0x31, 0x89, 0x80, 0x69, 0x80, 0x29, 0x41, 
-    0x0B, 0x02, 0xA6, 0x19, 0xA4, 0x49, 0xC9, 0x11, 0xE7, 0x48, 0x48, 0x21, 0x0A, 0x02, 0xE6, 0x51, 
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x42, 
-    0xAB, 0x8B, 0x4B, 0x7B, 0x0B, 0x73, 0x0B, 0x6B, 0x68, 0x52, 0x44, 0x31, 0x20, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x18, 0xC5, 0xB3, 
-    0xE4, 0xBB, 0x29, 0xCD, 0x12, 0xC6, 0xF1, 0xCD, 0x0B, 0xBD, 0x51, 0xAD, 0xAE, 0x94, 0x47, 0xAC, 
-    0x07, 0x8B, 0xC5, 0x51, 0x23, 0x7A, 0xA2, 0x82, 0x22, 0x7A, 0x47, 0x89, 0x6E, 0x51, 0x10, 0x74, 
-    0x68, 0xBC, 0x05, 0x42, 0xEA, 0x01, 0xE1, 0x81, 0x43, 0x71, 0xCA, 0x19, 0x48, 0x2A, 0x83, 0x69, 
-    0x42, 0x69, 0x46, 0x4A, 0x44, 0x62, 0x65, 0x61, 0xEA, 0x40, 0x4B, 0x59, 0x6C, 0x02, 0xAB, 0x29, 
-    0xCB, 0x80, 0xEC, 0x21, 0x2D, 0x12, 0x2E, 0x71, 0xAB, 0x70, 0x89, 0x78, 0x69, 0x78, 0x2A, 0x41, 
-    0xAA, 0x11, 0x08, 0x41, 0x27, 0x31, 0xA5, 0x39, 0x89, 0x19, 0x25, 0x51, 0x63, 0x49, 0xC8, 0x39, 
-    0x24, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x29, 0xAC, 0xB4, 
-    0x2C, 0x63, 0xED, 0x42, 0xEE, 0x32, 0x6D, 0x4A, 0xCD, 0x52, 0x2D, 0x5B, 0xAA, 0x5A, 0x64, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x41, 0x05, 0xC4, 
-    0x45, 0xBC, 0x70, 0xDE, 0xAD, 0x73, 0xC8, 0x5A, 0x6E, 0xC5, 0xAD, 0x73, 0xA6, 0x31, 0x0B, 0xBD, 
-    0x25, 0x93, 0xE5, 0x51, 0x41, 0x49, 0xA4, 0x89, 0x6C, 0x91, 0xB3, 0x32, 0xD3, 0x4C, 0xEA, 0xC4, 
-    0x04, 0x62, 0x08, 0x29, 0x68, 0x31, 0xC2, 0x81, 0xE7, 0x39, 0x27, 0x2A, 0x24, 0x69, 0xA4, 0x68, 
-    0x47, 0x42, 0x6F, 0x02, 0x4A, 0x12, 0x26, 0x51, 0xCA, 0x50, 0xEC, 0x19, 0x8D, 0x02, 0x4C, 0x02, 
-    0xEB, 0x11, 0x6C, 0x02, 0xEC, 0x31, 0xCE, 0x80, 0x08, 0x79, 0xC2, 0x81, 0xA7, 0x78, 0xC9, 0x40, 
-    0xC8, 0x48, 0x08, 0x41, 0xE9, 0x40, 0x67, 0x29, 0x85, 0x31, 0x44, 0x51, 0x01, 0x71, 0xA7, 0x11, 
-    0xC6, 0x49, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x72, 0x2A, 0xA4, 
-    0x8C, 0x52, 0xCC, 0x61, 0x6D, 0x3A, 0x0D, 0x52, 0x6B, 0x61, 0x6B, 0x59, 0x0C, 0x52, 0xAC, 0x5A, 
-    0x68, 0x52, 0xC2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x59, 0x05, 0xBC, 
-    0xC7, 0xC4, 0xB0, 0xC5, 0xAD, 0x7B, 0xEB, 0x8B, 0x0B, 0xCD, 0x8D, 0xAC, 0x0B, 0x8C, 0x88, 0xBC, 
-    0x83, 0x82, 0xA4, 0x49, 0x44, 0x40, 0xAE, 0x61, 0xB5, 0x1B, 0x13, 0x55, 0xEB, 0xD4, 0x44, 0x62, 
-    0x08, 0x29, 0x05, 0x69, 0xC5, 0x68, 0x88, 0x29, 0x26, 0x3A, 0x03, 0x69, 0x85, 0x60, 0x83, 0x69, 
-    0x89, 0x29, 0x6A, 0x21, 0x29, 0x22, 0xC7, 0x58, 0x2A, 0x31, 0x48, 0x2A, 0x24, 0x5A, 0x27, 0x3A, 
-    0x6C, 0x02, 0x8C, 0x02, 0x4C, 0x49, 0x09, 0x79, 0x41, 0x8A, 0x41, 0x8A, 0xE6, 0x70, 0x89, 0x58, 
-    0xAA, 0x19, 0x2B, 0x02, 0x29, 0x39, 0x69, 0x19, 0x65, 0x31, 0x85, 0x39, 0x44, 0x49, 0x47, 0x19, 
-    0xE8, 0x31, 0xA2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x8B, 0x0A, 0x9C, 
-    0x4D, 0x52, 0xED, 0x59, 0x2D, 0x4A, 0x8C, 0x4A, 0x4D, 0x4A, 0xAB, 0x59, 0xCB, 0x49, 0xCC, 0x41, 
-    0xEC, 0x59, 0xCB, 0x52, 0xC5, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x6A, 0x04, 0xBC, 
-    0xA7, 0xC4, 0x8C, 0xD5, 0xCA, 0x93, 0x6B, 0xC5, 0x29, 0xCD, 0xC2, 0x59, 0xE4, 0x7A, 0xC5, 0xB3, 
-    0xC2, 0x61, 0x64, 0x41, 0x8A, 0x09, 0xD0, 0x02, 0x70, 0x6C, 0xEA, 0xD4, 0x65, 0x62, 0xEA, 0x01, 
-    0x08, 0x41, 0xC5, 0x68, 0x87, 0x31, 0x06, 0x32, 0x04, 0x69, 0xA4, 0x58, 0x00, 0x92, 0x25, 0x52, 
-    0xE8, 0x30, 0x49, 0x31, 0x29, 0x39, 0x88, 0x40, 0xC5, 0x51, 0xA2, 0x81, 0x62, 0x79, 0xE0, 0x89, 
-    0x29, 0x22, 0x4D, 0x02, 0x07, 0x59, 0x01, 0x8A, 0x41, 0x92, 0xE1, 0x81, 0xA7, 0x78, 0x4A, 0x31, 
-    0x8A, 0x21, 0x49, 0x39, 0x49, 0x31, 0x49, 0x29, 0x68, 0x19, 0x86, 0x31, 0x27, 0x21, 0xA5, 0x50, 
-    0x27, 0x49, 0x44, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x8B, 0x09, 0xA4, 
-    0xAE, 0x3A, 0x8E, 0x4A, 0xAF, 0x3A, 0xCE, 0x2A, 0x0F, 0x2B, 0x0E, 0x23, 0xEE, 0x22, 0xED, 0x22, 
-    0x4A, 0x61, 0xAB, 0x49, 0xAC, 0x4A, 0x68, 0x52, 0x81, 0x10, 0x21, 0x00, 0xCD, 0xA9, 0xC6, 0xB2, 
-    0xC3, 0xA3, 0x69, 0xD5, 0x46, 0x9B, 0xC5, 0x69, 0x84, 0x61, 0x05, 0x6A, 0xC5, 0xAB, 0x22, 0x72, 
-    0x81, 0x59, 0x06, 0x19, 0x6C, 0x31, 0x8D, 0xAB, 0xEA, 0xDC, 0x65, 0x62, 0x87, 0x19, 0xE7, 0x29, 
-    0xE7, 0x40, 0xE7, 0x38, 0xC4, 0x49, 0x46, 0x61, 0x67, 0x50, 0xA1, 0x79, 0xE1, 0x81, 0xC7, 0x29, 
-    0x08, 0x21, 0xC9, 0x30, 0xA7, 0x48, 0xA2, 0x69, 0x00, 0x8A, 0x88, 0x60, 0x05, 0x69, 0x00, 0x8A, 
-    0x08, 0x22, 0xEA, 0x11, 0x23, 0x71, 0xE6, 0x68, 0x44, 0x71, 0x82, 0x79, 0xA8, 0x58, 0x0A, 0x02, 
-    0x89, 0x21, 0xA9, 0x19, 0x29, 0x41, 0x69, 0x21, 0xCA, 0x01, 0xC7, 0x29, 0xA6, 0x31, 0xE4, 0x48, 
-    0x27, 0x31, 0xA6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x72, 0x29, 0xAC, 
-    0x6E, 0x52, 0xCE, 0x32, 0x0E, 0x1B, 0xEB, 0x4A, 0xAA, 0x4A, 0x8A, 0x42, 0xAB, 0x3A, 0xCC, 0x2A, 
-    0x8C, 0x3A, 0xEB, 0x49, 0xAB, 0x49, 0x4D, 0x4A, 0x8A, 0x4A, 0xAC, 0x4A, 0x74, 0x5B, 0x33, 0xA2, 
-    0x89, 0xA1, 0x23, 0xA3, 0xC7, 0xCC, 0x89, 0xC4, 0x2A, 0xB4, 0x07, 0xAC, 0xE2, 0x69, 0x21, 0x49, 
-    0xA3, 0x20, 0x8B, 0x39, 0x2E, 0xB4, 0xEA, 0xCC, 0x45, 0x52, 0x86, 0x21, 0x42, 0x79, 0x23, 0x59, 
-    0xE9, 0x09, 0xC4, 0x41, 0xE5, 0x58, 0xA9, 0x48, 0xC4, 0x68, 0xC3, 0x51, 0xC9, 0x09, 0xC9, 0x01, 
-    0xE8, 0x20, 0xA6, 0x40, 0x42, 0x61, 0x23, 0x71, 0xC1, 0x81, 0x43, 0x79, 0xE1, 0x81, 0xC2, 0x69, 
-    0xA8, 0x11, 0x66, 0x31, 0x8A, 0x21, 0x8B, 0x11, 0xC5, 0x60, 0xC5, 0x68, 0xAA, 0x19, 0x4B, 0x02, 
-    0x4C, 0x02, 0xCA, 0x19, 0x09, 0x41, 0x28, 0x39, 0x08, 0x39, 0x67, 0x31, 0xA5, 0x41, 0xA6, 0x50, 
-    0x89, 0x09, 0xE7, 0x31, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x67, 0x5A, 0xA8, 0x6A, 0xE8, 0x72, 0xC7, 0x72, 
-    0xE8, 0x51, 0x2A, 0x42, 0xA8, 0x62, 0x4A, 0x5A, 0xAB, 0x42, 0x8A, 0x42, 0x6A, 0x3A, 0x6A, 0x42, 
-    0x6A, 0x42, 0x6B, 0x3A, 0x6B, 0x3A, 0xCB, 0x51, 0xEC, 0x49, 0x30, 0x63, 0x33, 0x73, 0x36, 0x44, 
-    0x18, 0x6C, 0xAC, 0x5A, 0x02, 0x5A, 0x22, 0x6A, 0xE1, 0x61, 0xE0, 0x38, 0xC3, 0x10, 0x27, 0x01, 
-    0x4D, 0x3B, 0x91, 0xB5, 0x28, 0xB4, 0xC4, 0x41, 0x69, 0x01, 0x65, 0x41, 0x23, 0x61, 0xA5, 0x31, 
-    0x63, 0x49, 0x64, 0x50, 0x45, 0x48, 0x45, 0x50, 0xA4, 0x60, 0xC7, 0x19, 0xEA, 0x01, 0x08, 0x11, 
-    0xA4, 0x48, 0x61, 0x69, 0x84, 0x60, 0xC4, 0x58, 0xA5, 0x51, 0xA3, 0x61, 0xC1, 0x79, 0x65, 0x29, 
-    0x46, 0x21, 0x08, 0x29, 0x89, 0x11, 0x69, 0x19, 0x66, 0x60, 0xE8, 0x38, 0x6A, 0x29, 0x0A, 0x59, 
-    0x6B, 0x39, 0x08, 0x41, 0x66, 0x60, 0x66, 0x68, 0x67, 0x70, 0xC7, 0x50, 0xA6, 0x39, 0x66, 0x31, 
-    0x64, 0x41, 0xE7, 0x31, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xA7, 0x6A, 0x69, 0x93, 0x09, 0x83, 0xA8, 0x72, 0x67, 0x6A, 
-    0xE4, 0x51, 0x63, 0x41, 0xEA, 0x49, 0xAE, 0x59, 0x6D, 0x42, 0xCD, 0x2A, 0xCD, 0x22, 0xCD, 0x1A, 
-    0x6B, 0x32, 0x2C, 0x2A, 0x6B, 0x2A, 0x6C, 0x32, 0x4D, 0x32, 0xEF, 0x52, 0xB1, 0x82, 0x56, 0x44, 
-    0x92, 0x54, 0x12, 0x2C, 0x50, 0x0B, 0x49, 0x2A, 0x64, 0x30, 0x02, 0x51, 0x86, 0x52, 0xD0, 0x84, 
-    0x4C, 0xCD, 0xE5, 0x8A, 0x03, 0x39, 0x85, 0x48, 0xA5, 0x58, 0xE6, 0x30, 0x84, 0x39, 0x03, 0x51, 
-    0x44, 0x50, 0xC3, 0x50, 0x21, 0x61, 0xC2, 0x58, 0x85, 0x50, 0x87, 0x09, 0x06, 0x09, 0xA3, 0x40, 
-    0x61, 0x71, 0x61, 0x69, 0xE3, 0x48, 0xA7, 0x31, 0xA8, 0x31, 0x64, 0x51, 0x24, 0x39, 0xE7, 0x20, 
-    0x07, 0x29, 0x28, 0x19, 0x48, 0x29, 0xE6, 0x60, 0x65, 0x51, 0xC6, 0x39, 0x09, 0x12, 0x6A, 0x29, 
-    0x88, 0x60, 0xA8, 0x60, 0xEA, 0x60, 0xC8, 0x60, 0x86, 0x70, 0xC7, 0x48, 0xE7, 0x29, 0x84, 0x49, 
-    0x01, 0x61, 0xC7, 0x39, 0xC2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA2, 0x10, 0xC8, 0x6A, 0xAA, 0x93, 0x29, 0x83, 0x87, 0x6A, 0xC4, 0x51, 0xE2, 0x28, 
-    0xC2, 0x28, 0x02, 0x29, 0x0D, 0x3A, 0xAF, 0x59, 0x6C, 0x61, 0x0D, 0x3A, 0xEC, 0x49, 0x4D, 0x3A, 
-    0xAD, 0x2A, 0xAC, 0x49, 0xCC, 0x39, 0x4C, 0x22, 0x8D, 0x32, 0xF0, 0x5A, 0xD1, 0x6A, 0xD3, 0x82, 
-    0x6A, 0xCA, 0x4C, 0x7C, 0xD9, 0x04, 0x8B, 0x6B, 0x0A, 0xA2, 0x6C, 0xC4, 0xAC, 0xDD, 0xE7, 0xAB, 
-    0xC3, 0x49, 0x66, 0x11, 0x66, 0x50, 0x46, 0x21, 0xE6, 0x21, 0xA4, 0x39, 0xA3, 0x48, 0x44, 0x48, 
-    0x21, 0x69, 0x62, 0x49, 0x67, 0x09, 0x43, 0x41, 0xE4, 0x30, 0xC5, 0x10, 0x82, 0x40, 0x82, 0x50, 
-    0xC2, 0x50, 0x61, 0x69, 0xA1, 0x71, 0x81, 0x69, 0x22, 0x59, 0xC4, 0x38, 0xA6, 0x28, 0x07, 0x31, 
-    0x26, 0x31, 0xE5, 0x50, 0xC3, 0x70, 0x63, 0x71, 0x01, 0x82, 0x00, 0x92, 0xE6, 0x31, 0xCA, 0x09, 
-    0x69, 0x31, 0x6B, 0x49, 0x4D, 0x61, 0xC9, 0x60, 0x66, 0x68, 0x8A, 0x19, 0x29, 0x22, 0xA5, 0x49, 
-    0x64, 0x41, 0xE8, 0x21, 0xC2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x82, 0x10, 0xE9, 0x72, 0x28, 0x8B, 0xC4, 0x51, 0x43, 0x41, 0x22, 0x41, 0xA0, 0x30, 0x40, 0x10, 
-    0x20, 0x08, 0xA4, 0x10, 0xF0, 0x12, 0x10, 0x4A, 0x6F, 0x71, 0x0C, 0x81, 0x0A, 0x79, 0xCC, 0x51, 
-    0xAC, 0x51, 0x8B, 0x59, 0x0B, 0x81, 0x6B, 0x59, 0xCC, 0x49, 0x73, 0x3B, 0x93, 0x62, 0xF2, 0xB9, 
-    0xEB, 0xCA, 0x0B, 0x74, 0xD1, 0x64, 0x2D, 0xAD, 0x0B, 0xCD, 0x07, 0xAC, 0x24, 0x5A, 0xC3, 0x38, 
-    0xC5, 0x40, 0xC5, 0x50, 0x66, 0x29, 0xA6, 0x29, 0x23, 0x49, 0x83, 0x48, 0x44, 0x48, 0xA5, 0x40, 
-    0x05, 0x39, 0x25, 0x29, 0x47, 0x01, 0x04, 0x11, 0xA4, 0x20, 0x43, 0x38, 0x44, 0x40, 0x24, 0x40, 
-    0x43, 0x40, 0xC2, 0x40, 0xE2, 0x48, 0xA3, 0x38, 0x65, 0x30, 0xC6, 0x28, 0x27, 0x19, 0x47, 0x19, 
-    0x88, 0x11, 0xA8, 0x11, 0x69, 0x21, 0x48, 0x58, 0x82, 0x79, 0xE2, 0x71, 0xA9, 0x21, 0x8B, 0x41, 
-    0xEB, 0x21, 0xCA, 0x21, 0xCA, 0x60, 0xA7, 0x58, 0x89, 0x21, 0x4C, 0x02, 0x09, 0x22, 0xA6, 0x31, 
-    0x64, 0x41, 0xE6, 0x41, 0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 
-    0xC8, 0x6A, 0x89, 0x9B, 0x83, 0x51, 0x61, 0x18, 0x20, 0x08, 0x61, 0x10, 0xB1, 0x53, 0xA3, 0x20, 
-    0xC2, 0x61, 0x65, 0xA3, 0x8A, 0x63, 0x8F, 0x43, 0x90, 0x52, 0xD0, 0x69, 0x2D, 0x71, 0xCE, 0x41, 
-    0x2E, 0x2A, 0x6C, 0x51, 0x2B, 0x69, 0x0A, 0x91, 0x6D, 0x6A, 0xB5, 0x3C, 0x33, 0x55, 0xCB, 0xBC, 
-    0x09, 0xD5, 0xCA, 0xCC, 0x27, 0xBC, 0x25, 0x83, 0xE4, 0x49, 0x65, 0x19, 0xE6, 0x20, 0xE4, 0x58, 
-    0x84, 0x49, 0x44, 0x41, 0x04, 0x41, 0xA3, 0x48, 0x62, 0x40, 0xA4, 0x30, 0x84, 0x28, 0x84, 0x20, 
-    0xA4, 0x10, 0x83, 0x00, 0x62, 0x08, 0x41, 0x08, 0x21, 0x10, 0x21, 0x10, 0x21, 0x18, 0x21, 0x18, 
-    0x41, 0x18, 0x42, 0x18, 0x43, 0x10, 0x84, 0x10, 0xE5, 0x08, 0x06, 0x11, 0xE6, 0x28, 0xE6, 0x28, 
-    0xE9, 0x01, 0x2B, 0x02, 0x88, 0x19, 0x03, 0x61, 0xC2, 0x61, 0xE8, 0x19, 0xAA, 0x19, 0x8A, 0x31, 
-    0x8A, 0x31, 0x09, 0x51, 0x87, 0x60, 0x87, 0x60, 0xE7, 0x50, 0xCA, 0x11, 0x09, 0x1A, 0x84, 0x51, 
-    0x22, 0x61, 0xC4, 0x59, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0x49, 
-    0xA9, 0x9B, 0xA3, 0x51, 0xC2, 0x30, 0x81, 0x20, 0x00, 0x08, 0x09, 0x2A, 0xF6, 0x64, 0x61, 0x10, 
-    0x01, 0x39, 0x85, 0xA3, 0x86, 0xD4, 0xA6, 0xCC, 0xC8, 0xC4, 0xA9, 0xB4, 0x2B, 0xBC, 0xCA, 0xC3, 
-    0x2A, 0xA4, 0x4A, 0xA4, 0x4A, 0xBC, 0x89, 0xC4, 0xC9, 0xC4, 0xA8, 0xC4, 0x26, 0xBC, 0x85, 0x93, 
-    0xC5, 0x6A, 0x25, 0x42, 0x85, 0x21, 0xC5, 0x40, 0x06, 0x41, 0x46, 0x51, 0x25, 0x51, 0x04, 0x41, 
-    0xC3, 0x38, 0x82, 0x30, 0x42, 0x30, 0x42, 0x20, 0x21, 0x18, 0x21, 0x10, 0x21, 0x08, 0x20, 0x10, 
-    0x20, 0x10, 0x20, 0x18, 0x40, 0x18, 0x40, 0x18, 0x40, 0x18, 0x60, 0x20, 0x60, 0x18, 0x40, 0x18, 
-    0x40, 0x10, 0x20, 0x10, 0x20, 0x08, 0x62, 0x08, 0xA4, 0x08, 0x84, 0x28, 0x84, 0x38, 0xE6, 0x20, 
-    0x68, 0x19, 0x27, 0x29, 0xE4, 0x48, 0x44, 0x49, 0x46, 0x49, 0x66, 0x51, 0xC4, 0x51, 0xA4, 0x51, 
-    0x28, 0x49, 0x0A, 0x51, 0x2A, 0x51, 0xA8, 0x60, 0x66, 0x70, 0x49, 0x29, 0x08, 0x2A, 0x85, 0x49, 
-    0xA4, 0x51, 0xA5, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x5A, 
-    0xC6, 0x82, 0xC1, 0x28, 0x81, 0x20, 0x61, 0x18, 0x20, 0x08, 0x25, 0x21, 0x04, 0x21, 0x00, 0x08, 
-    0x41, 0x18, 0xA2, 0x20, 0xC4, 0x49, 0xC6, 0x7A, 0xC4, 0x82, 0x24, 0x93, 0x65, 0x93, 0x85, 0x93, 
-    0x65, 0x9B, 0x25, 0x8B, 0x25, 0x83, 0xE6, 0x72, 0x45, 0x6A, 0xA5, 0x61, 0x45, 0x51, 0x27, 0x41, 
-    0x07, 0x41, 0x27, 0x31, 0x46, 0x41, 0xE4, 0x58, 0xA3, 0x48, 0xA2, 0x30, 0x62, 0x18, 0x41, 0x10, 
-    0x21, 0x10, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x60, 0x20, 0xA1, 0x30, 0xE2, 0x38, 
-    0x22, 0x41, 0x43, 0x49, 0x43, 0x49, 0x23, 0x41, 0xC2, 0x30, 0xC1, 0x38, 0x02, 0x41, 0x02, 0x41, 
-    0xE1, 0x40, 0xC1, 0x38, 0xA1, 0x30, 0x60, 0x20, 0x41, 0x08, 0x62, 0x08, 0xA4, 0x10, 0xC5, 0x10, 
-    0xC5, 0x18, 0xE6, 0x18, 0x47, 0x11, 0x68, 0x11, 0x68, 0x21, 0x29, 0x49, 0xE7, 0x68, 0xE1, 0x89, 
-    0xC4, 0x51, 0xAB, 0x19, 0x8B, 0x39, 0xC7, 0x60, 0x86, 0x60, 0xA9, 0x21, 0x07, 0x3A, 0x86, 0x31, 
-    0xE6, 0x41, 0x24, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x52, 
-    0x65, 0x72, 0xC1, 0x30, 0x61, 0x18, 0x41, 0x18, 0x40, 0x10, 0x00, 0x08, 0x20, 0x08, 0x60, 0x18, 
-    0xC2, 0x28, 0x41, 0x08, 0x00, 0x00, 0xA6, 0x41, 0x28, 0x5A, 0x85, 0x49, 0x45, 0x49, 0x66, 0x49, 
-    0x66, 0x49, 0x46, 0x41, 0x67, 0x39, 0x88, 0x19, 0xE6, 0x40, 0x04, 0x51, 0xC3, 0x40, 0x83, 0x38, 
-    0x82, 0x30, 0x82, 0x28, 0x81, 0x20, 0x61, 0x10, 0x20, 0x08, 0x20, 0x08, 0x40, 0x10, 0x40, 0x18, 
-    0x40, 0x18, 0x40, 0x18, 0x40, 0x18, 0x61, 0x18, 0xC1, 0x30, 0x02, 0x41, 0xE1, 0x38, 0xA1, 0x30, 
-    0xA1, 0x30, 0xC1, 0x38, 0x02, 0x49, 0x83, 0x59, 0xC5, 0x59, 0x64, 0x41, 0xA4, 0x51, 0x83, 0x59, 
-    0x83, 0x51, 0x63, 0x51, 0x42, 0x49, 0x02, 0x41, 0xA1, 0x30, 0x61, 0x10, 0x42, 0x08, 0x62, 0x18, 
-    0x64, 0x28, 0x84, 0x30, 0xA6, 0x48, 0xA8, 0x11, 0x2A, 0x02, 0xAA, 0x19, 0xE8, 0x60, 0xE1, 0x79, 
-    0x85, 0x49, 0xE8, 0x48, 0xA7, 0x60, 0xE7, 0x50, 0xC9, 0x19, 0x28, 0x2A, 0xC6, 0x41, 0x43, 0x59, 
-    0xC4, 0x61, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x49, 
-    0x85, 0x7A, 0xE1, 0x38, 0xA1, 0x28, 0x61, 0x18, 0x40, 0x10, 0x40, 0x10, 0x41, 0x10, 0x60, 0x18, 
-    0xA2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x84, 0x41, 0x47, 0x62, 0xE5, 0x51, 0x64, 0x49, 
-    0x44, 0x39, 0x03, 0x29, 0x82, 0x18, 0x41, 0x18, 0x60, 0x18, 0x40, 0x18, 0x61, 0x20, 0xC1, 0x30, 
-    0xC1, 0x30, 0xC1, 0x30, 0xE1, 0x38, 0xE1, 0x38, 0xA1, 0x30, 0x60, 0x20, 0x81, 0x28, 0xA1, 0x30, 
-    0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x28, 0x02, 0x41, 0xE1, 0x40, 0x60, 0x28, 0xC2, 0x30, 0x45, 0x41, 
-    0x65, 0x41, 0x24, 0x41, 0x81, 0x30, 0x80, 0x30, 0x42, 0x59, 0xE4, 0x61, 0xE5, 0x61, 0xE5, 0x61, 
-    0xE5, 0x61, 0xE5, 0x59, 0xC5, 0x59, 0xA4, 0x51, 0x83, 0x51, 0xE1, 0x38, 0x61, 0x10, 0x82, 0x10, 
-    0x84, 0x20, 0xC5, 0x28, 0x47, 0x21, 0x88, 0x11, 0x28, 0x31, 0xE7, 0x60, 0x63, 0x69, 0x63, 0x61, 
-    0xA7, 0x60, 0xA7, 0x60, 0xA9, 0x21, 0x2B, 0x02, 0x29, 0x1A, 0x07, 0x42, 0xA6, 0x31, 0xE4, 0x61, 
-    0x23, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x39, 
-    0x65, 0x72, 0xA3, 0x51, 0x02, 0x41, 0x81, 0x20, 0x41, 0x10, 0x41, 0x10, 0x61, 0x20, 0x81, 0x20, 
-    0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x20, 0xE6, 0x49, 0x47, 0x5A, 
-    0x06, 0x4A, 0x44, 0x29, 0x81, 0x18, 0xA1, 0x30, 0xC1, 0x30, 0x02, 0x41, 0x42, 0x49, 0xC1, 0x38, 
-    0xA1, 0x30, 0xE2, 0x38, 0xE2, 0x38, 0xC1, 0x38, 0x01, 0x49, 0x22, 0x49, 0xE1, 0x38, 0x22, 0x49, 
-    0x22, 0x49, 0x22, 0x49, 0x22, 0x49, 0xE1, 0x40, 0xA1, 0x30, 0x28, 0x5A, 0x6E, 0x7B, 0xF0, 0x83, 
-    0x11, 0x84, 0x11, 0x84, 0xAE, 0x7B, 0xE7, 0x59, 0xA0, 0x38, 0xA2, 0x69, 0x04, 0x72, 0x04, 0x6A, 
-    0x05, 0x6A, 0x26, 0x62, 0x47, 0x62, 0x88, 0x62, 0x88, 0x62, 0x06, 0x5A, 0x02, 0x31, 0xA3, 0x10, 
-    0xE4, 0x18, 0x06, 0x19, 0x06, 0x31, 0xC6, 0x50, 0xE5, 0x58, 0x85, 0x49, 0x06, 0x59, 0x09, 0x49, 
-    0x8A, 0x41, 0xC7, 0x68, 0x48, 0x39, 0x2A, 0x0A, 0xE6, 0x49, 0xC6, 0x31, 0x06, 0x4A, 0xA5, 0x31, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 
-    0x86, 0x7A, 0xE4, 0x61, 0x22, 0x49, 0x81, 0x20, 0x61, 0x18, 0x61, 0x18, 0x60, 0x20, 0xA1, 0x28, 
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x20, 
-    0xC6, 0x41, 0xC5, 0x41, 0x42, 0x49, 0x42, 0x49, 0x63, 0x49, 0x82, 0x59, 0xA1, 0x38, 0x85, 0x49, 
-    0xEB, 0x6A, 0x4C, 0x73, 0xEB, 0x6A, 0x48, 0x5A, 0x23, 0x41, 0x01, 0x49, 0xA3, 0x59, 0xC4, 0x59, 
-    0xC4, 0x61, 0xA3, 0x59, 0x21, 0x49, 0xC2, 0x38, 0x2C, 0x73, 0x91, 0x94, 0x95, 0xAD, 0x98, 0xCE, 
-    0xB8, 0xCE, 0x16, 0xBE, 0x33, 0x9D, 0x71, 0x94, 0x28, 0x62, 0x01, 0x51, 0x43, 0x82, 0x43, 0x7A, 
-    0x24, 0x72, 0x04, 0x6A, 0x25, 0x6A, 0x68, 0x6A, 0xEB, 0x72, 0x0B, 0x73, 0x06, 0x5A, 0xC4, 0x28, 
-    0xC5, 0x30, 0x06, 0x29, 0x88, 0x09, 0xA8, 0x21, 0x48, 0x61, 0x89, 0x41, 0x49, 0x41, 0x08, 0x59, 
-    0x28, 0x61, 0xE7, 0x60, 0x88, 0x39, 0xE6, 0x49, 0xA5, 0x41, 0xE4, 0x69, 0xA4, 0x59, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x28, 
-    0x65, 0x7A, 0x04, 0x62, 0x83, 0x59, 0x81, 0x28, 0x61, 0x18, 0x41, 0x10, 0x60, 0x20, 0xE2, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xC4, 0x51, 0x64, 0x7A, 0x44, 0x72, 0x64, 0x7A, 0x21, 0x51, 0x48, 0x62, 0xF2, 0x9C, 
-    0x12, 0xA5, 0x32, 0xA5, 0x94, 0xAD, 0x12, 0x9D, 0xCE, 0x83, 0x85, 0x51, 0x82, 0x61, 0x85, 0x7A, 
-    0x45, 0x72, 0xE3, 0x69, 0xA0, 0x38, 0x0B, 0x73, 0xB5, 0xAD, 0xF9, 0xD6, 0x57, 0xBE, 0x50, 0x94, 
-    0x6F, 0x9C, 0x36, 0xBE, 0x77, 0xC6, 0xF2, 0x9C, 0x30, 0x8C, 0x84, 0x59, 0x22, 0x7A, 0xA3, 0x8A, 
-    0x63, 0x82, 0x23, 0x72, 0x04, 0x6A, 0x04, 0x62, 0x47, 0x62, 0xEA, 0x6A, 0xC9, 0x6A, 0x86, 0x41, 
-    0x26, 0x31, 0x26, 0x39, 0x88, 0x21, 0xC9, 0x39, 0x89, 0x69, 0xC9, 0x41, 0x68, 0x51, 0x68, 0x49, 
-    0xEA, 0x19, 0xE9, 0x29, 0x06, 0x42, 0xC6, 0x41, 0x05, 0x62, 0x83, 0x49, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x18, 
-    0x25, 0x6A, 0x83, 0x51, 0x62, 0x49, 0xA1, 0x28, 0x81, 0x20, 0x61, 0x18, 0xA1, 0x28, 0xA2, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x18, 0x05, 0x93, 0x65, 0xA3, 0xC6, 0xAB, 0xC3, 0x92, 0x05, 0x72, 0x35, 0xCE, 0xD8, 0xD6, 
-    0x39, 0xDF, 0xD8, 0xD6, 0xB0, 0xA4, 0x2E, 0x9C, 0xF1, 0xA4, 0x0F, 0x84, 0xC3, 0x61, 0x66, 0x9B, 
-    0x46, 0x93, 0xC2, 0x69, 0x84, 0x51, 0x15, 0xC6, 0x9A, 0xE7, 0xFA, 0xCE, 0xB2, 0x9C, 0x43, 0x71, 
-    0xC0, 0x70, 0x23, 0x69, 0x73, 0xAD, 0xB4, 0xB5, 0x50, 0x94, 0x69, 0x62, 0xA1, 0x69, 0xE4, 0x92, 
-    0x63, 0x82, 0x22, 0x72, 0xC3, 0x69, 0xA3, 0x61, 0xC3, 0x59, 0x05, 0x62, 0x67, 0x6A, 0xC7, 0x41, 
-    0x67, 0x39, 0x88, 0x51, 0x88, 0x59, 0x88, 0x69, 0x68, 0x69, 0x68, 0x69, 0x28, 0x71, 0xEA, 0x41, 
-    0x49, 0x32, 0x26, 0x5A, 0x25, 0x62, 0x05, 0x5A, 0x03, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 
-    0x45, 0x62, 0xA4, 0x51, 0x22, 0x41, 0xC1, 0x30, 0x81, 0x20, 0xA1, 0x28, 0xC2, 0x28, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA3, 0x49, 0xE5, 0xBB, 0xE5, 0xB3, 0xE6, 0xB3, 0xE1, 0x79, 0xB0, 0xB4, 0xDB, 0xEF, 0xBB, 0xEF, 
-    0x1A, 0xD7, 0x34, 0xA5, 0x68, 0x82, 0xE0, 0x70, 0x84, 0x71, 0x2F, 0x94, 0xC8, 0x7A, 0x85, 0xAB, 
-    0xA7, 0xAB, 0xA1, 0x69, 0x0A, 0x83, 0x79, 0xE7, 0xDC, 0xDF, 0x4C, 0x8B, 0xCE, 0x93, 0x45, 0x39, 
-    0x81, 0x28, 0xE1, 0x70, 0x88, 0x82, 0xD5, 0xB5, 0x30, 0x8C, 0x0B, 0x73, 0x21, 0x51, 0x83, 0x8A, 
-    0x63, 0x82, 0xC2, 0x69, 0x82, 0x59, 0x62, 0x59, 0x62, 0x51, 0x83, 0x51, 0x05, 0x62, 0xE9, 0x69, 
-    0xA9, 0x59, 0xA9, 0x61, 0x4B, 0x32, 0x2C, 0x32, 0x2B, 0x42, 0x4A, 0x4A, 0x89, 0x52, 0xA8, 0x62, 
-    0x87, 0x62, 0x05, 0x5A, 0x42, 0x41, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 
-    0x66, 0x6A, 0xC4, 0x51, 0xE2, 0x38, 0xA1, 0x28, 0x81, 0x20, 0x81, 0x20, 0x82, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x43, 0x62, 0xC4, 0xBB, 0x84, 0xAB, 0x84, 0xAB, 0x03, 0x7A, 0x56, 0xD6, 0xBB, 0xE7, 0xFC, 0xF7, 
-    0xAD, 0x8B, 0x6D, 0x93, 0x28, 0x4A, 0x40, 0x08, 0x81, 0x50, 0x06, 0x7A, 0x4A, 0x83, 0x65, 0xA3, 
-    0xA6, 0xAB, 0xA1, 0x69, 0x8B, 0x93, 0xBA, 0xEF, 0x19, 0xCF, 0x64, 0x71, 0x40, 0x40, 0x01, 0x00, 
-    0x01, 0x00, 0xC1, 0x50, 0xC5, 0x81, 0xF2, 0x9C, 0x0F, 0x8C, 0xEA, 0x72, 0x01, 0x49, 0x23, 0x7A, 
-    0x02, 0x72, 0x61, 0x59, 0x01, 0x49, 0xE1, 0x40, 0xE1, 0x38, 0xE1, 0x30, 0x84, 0x49, 0x6A, 0x7A, 
-    0xAA, 0x6A, 0xEB, 0x5A, 0x2C, 0x43, 0x4B, 0x5B, 0x29, 0x6B, 0xE8, 0x6A, 0x86, 0x6A, 0xC4, 0x51, 
-    0xE2, 0x28, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x20, 
-    0xC7, 0x7A, 0x84, 0x51, 0xE2, 0x30, 0xA1, 0x20, 0x81, 0x20, 0x61, 0x18, 0xC2, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE3, 0x59, 0xA4, 0xBB, 0x64, 0xAB, 0x84, 0xAB, 0x64, 0x7A, 0x97, 0xD6, 0xBB, 0xE7, 0xDC, 0xEF, 
-    0x47, 0x7A, 0x60, 0x58, 0x00, 0x00, 0x01, 0x00, 0xA1, 0x38, 0xA5, 0x81, 0xC9, 0x7A, 0x85, 0xAB, 
-    0x86, 0xA3, 0xA1, 0x69, 0x09, 0x83, 0x59, 0xE7, 0x3A, 0xD7, 0xC5, 0x71, 0xC1, 0x58, 0x41, 0x08, 
-    0x41, 0x08, 0x01, 0x69, 0x26, 0x7A, 0xB1, 0x94, 0xAD, 0x8B, 0x27, 0x62, 0x01, 0x41, 0xC2, 0x61, 
-    0x41, 0x59, 0x21, 0x51, 0x41, 0x51, 0x41, 0x51, 0x62, 0x51, 0x62, 0x51, 0x83, 0x51, 0x83, 0x51, 
-    0xA4, 0x51, 0xA8, 0x62, 0x09, 0x63, 0xC4, 0x41, 0x43, 0x31, 0xA1, 0x18, 0x20, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x20, 
-    0xA7, 0x7A, 0xA4, 0x51, 0x63, 0x49, 0xC2, 0x28, 0x81, 0x20, 0x81, 0x20, 0x04, 0x29, 0x82, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x02, 0x31, 0xA4, 0xB3, 0x64, 0xAB, 0xA5, 0xAB, 0x23, 0x7A, 0x93, 0xC5, 0x9A, 0xE7, 0xFC, 0xEF, 
-    0x6B, 0x8B, 0x60, 0x68, 0xC2, 0x30, 0x82, 0x18, 0x42, 0x79, 0x07, 0x7A, 0xC8, 0x7A, 0x06, 0xB4, 
-    0x86, 0xA3, 0x02, 0x72, 0xA4, 0x61, 0x75, 0xD6, 0x79, 0xDF, 0x4F, 0x94, 0xA0, 0x70, 0x21, 0x71, 
-    0x21, 0x71, 0x42, 0x79, 0xED, 0x8B, 0x2E, 0x94, 0xC9, 0x7A, 0xC2, 0x38, 0x21, 0x49, 0xC2, 0x69, 
-    0x62, 0x82, 0xC3, 0x92, 0xE3, 0x9A, 0xC3, 0x92, 0xC3, 0x92, 0xA4, 0x8A, 0x84, 0x82, 0x65, 0x7A, 
-    0x25, 0x6A, 0x47, 0x62, 0x08, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x29, 
-    0x86, 0x72, 0x25, 0x62, 0xE5, 0x61, 0xE2, 0x38, 0xA1, 0x28, 0xA1, 0x28, 0x04, 0x29, 0x25, 0x21, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x83, 0x7A, 0x23, 0xA3, 0x23, 0x9B, 0x82, 0x8A, 0x6A, 0x9B, 0x18, 0xDF, 0x39, 0xDF, 
-    0x97, 0xCE, 0xC6, 0x71, 0xC1, 0x70, 0x02, 0x79, 0x84, 0x71, 0x0B, 0x7B, 0x05, 0x93, 0x89, 0xC4, 
-    0x86, 0xA3, 0xA3, 0x8A, 0x21, 0x59, 0xAC, 0x9B, 0x96, 0xD6, 0xD7, 0xCE, 0x2E, 0x94, 0x47, 0x7A, 
-    0x68, 0x7A, 0x0E, 0x8C, 0x4E, 0x94, 0x88, 0x7A, 0x02, 0x49, 0x41, 0x51, 0xA2, 0x92, 0x03, 0x9B, 
-    0x44, 0xA3, 0x44, 0xAB, 0x44, 0xA3, 0x24, 0x9B, 0xE4, 0x92, 0xC4, 0x8A, 0x85, 0x82, 0x86, 0x7A, 
-    0xA8, 0x72, 0xAA, 0x6A, 0x4D, 0x73, 0xE8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x31, 
-    0x86, 0x72, 0x45, 0x6A, 0x84, 0x51, 0x02, 0x39, 0xE2, 0x38, 0xA1, 0x28, 0xA2, 0x20, 0x25, 0x29, 
-    0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x81, 0x10, 0x83, 0x82, 0xA2, 0x8A, 0x64, 0xA3, 0xC5, 0x9A, 0x4E, 0xAC, 0x75, 0xCE, 
-    0xB6, 0xD6, 0x55, 0xC6, 0x4E, 0x9C, 0x8D, 0x8B, 0x6C, 0x83, 0xC6, 0x82, 0x06, 0xBC, 0x27, 0xBC, 
-    0x85, 0xA3, 0xE3, 0x92, 0x83, 0x82, 0x82, 0x69, 0x4B, 0x93, 0x31, 0xAD, 0xD4, 0xB5, 0x53, 0xA5, 
-    0x90, 0x94, 0x6C, 0x83, 0xE6, 0x69, 0xA2, 0x69, 0xE3, 0x92, 0x25, 0xBC, 0x06, 0xB4, 0x65, 0xA3, 
-    0x45, 0x9B, 0x86, 0xAB, 0xA6, 0xAB, 0x44, 0x9B, 0xE4, 0x92, 0xA4, 0x8A, 0x85, 0x7A, 0x86, 0x7A, 
-    0xA9, 0x6A, 0x0C, 0x6B, 0x4E, 0x6B, 0xAF, 0x73, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x41, 
-    0xA6, 0x7A, 0x25, 0x6A, 0xC4, 0x59, 0x83, 0x51, 0x02, 0x41, 0xC2, 0x30, 0xA1, 0x28, 0xC2, 0x20, 
-    0x46, 0x29, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xE3, 0x59, 0xA3, 0x82, 0xE3, 0x92, 0x03, 0x9B, 0x23, 0xA3, 0x43, 0xA3, 0x64, 0x8A, 0x29, 0x93, 
-    0x0D, 0x9C, 0x4E, 0x9C, 0x0E, 0x94, 0x2A, 0x7B, 0x85, 0x82, 0x84, 0xAB, 0x06, 0xB4, 0xA5, 0xAB, 
-    0x64, 0xA3, 0x23, 0xA3, 0x03, 0x9B, 0xE3, 0x92, 0xC1, 0x71, 0xE4, 0x71, 0x66, 0x72, 0x46, 0x72, 
-    0x04, 0x6A, 0x23, 0x7A, 0x24, 0x9B, 0x67, 0xC4, 0x67, 0xC4, 0x25, 0x9B, 0x43, 0x7A, 0x03, 0x72, 
-    0xC4, 0x8A, 0x85, 0xA3, 0x65, 0xA3, 0x24, 0x9B, 0xC4, 0x92, 0x84, 0x82, 0x64, 0x7A, 0x45, 0x72, 
-    0x67, 0x6A, 0xAA, 0x6A, 0x0B, 0x6B, 0x6E, 0x73, 0x29, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x51, 
-    0x86, 0x7A, 0x45, 0x6A, 0xE5, 0x61, 0x63, 0x51, 0x22, 0x41, 0xC2, 0x38, 0xA1, 0x28, 0x81, 0x20, 
-    0xE3, 0x28, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0x24, 0x93, 
-    0x04, 0xC4, 0x46, 0xC4, 0x67, 0xC4, 0x46, 0xBC, 0x26, 0xBC, 0xA5, 0xAB, 0x64, 0xA3, 0xC2, 0x92, 
-    0x62, 0x8A, 0x43, 0x82, 0x62, 0x8A, 0xC2, 0x9A, 0xA3, 0xB3, 0xE5, 0xB3, 0xA5, 0xB3, 0xA5, 0xAB, 
-    0xA5, 0xAB, 0x85, 0xAB, 0x64, 0xAB, 0x44, 0xA3, 0x44, 0xA3, 0x23, 0xA3, 0x43, 0xA3, 0x84, 0xAB, 
-    0xE5, 0xB3, 0x26, 0xBC, 0xE5, 0xB3, 0xC3, 0x92, 0x61, 0x59, 0x80, 0x30, 0x40, 0x20, 0x40, 0x18, 
-    0x80, 0x28, 0x02, 0x72, 0x03, 0x9B, 0xE4, 0x92, 0xA3, 0x8A, 0x63, 0x82, 0x23, 0x72, 0x03, 0x6A, 
-    0x04, 0x6A, 0x25, 0x62, 0x68, 0x62, 0xCA, 0x6A, 0x69, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0x25, 0x6A, 
-    0x25, 0x6A, 0xE4, 0x61, 0xC4, 0x61, 0x63, 0x51, 0x22, 0x49, 0xE2, 0x38, 0xE2, 0x30, 0xE2, 0x28, 
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x8B, 0x25, 0xCC, 
-    0x67, 0xBC, 0x68, 0xBC, 0xE4, 0x92, 0x23, 0x7A, 0x24, 0x9B, 0x06, 0xBC, 0x67, 0xC4, 0x88, 0xC4, 
-    0x67, 0xC4, 0x47, 0xBC, 0x88, 0xC4, 0xA9, 0xC4, 0xAA, 0xC4, 0xAA, 0xC4, 0xCA, 0xC4, 0xAA, 0xBC, 
-    0x89, 0xBC, 0x48, 0xBC, 0x07, 0xB4, 0x07, 0xB4, 0x07, 0xB4, 0x07, 0xB4, 0xC6, 0xAB, 0x85, 0xAB, 
-    0x04, 0x9B, 0x42, 0x7A, 0x61, 0x59, 0xA1, 0x30, 0x81, 0x20, 0x41, 0x10, 0x00, 0x08, 0x20, 0x08, 
-    0x20, 0x08, 0x21, 0x51, 0xA3, 0x92, 0xA3, 0x8A, 0x83, 0x82, 0x43, 0x7A, 0x02, 0x72, 0xE3, 0x69, 
-    0xC3, 0x61, 0xE4, 0x61, 0xE5, 0x59, 0x47, 0x62, 0x27, 0x5A, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x39, 0xA6, 0x82, 
-    0xE4, 0x59, 0xA4, 0x51, 0x25, 0x72, 0xC4, 0x61, 0x83, 0x51, 0xE2, 0x38, 0x82, 0x30, 0x83, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x39, 0x45, 0xC4, 0xE5, 0xB3, 
-    0xE6, 0xB3, 0xE1, 0x79, 0x80, 0x30, 0x00, 0x10, 0x40, 0x18, 0x21, 0x49, 0x22, 0x7A, 0x03, 0x9B, 
-    0x64, 0xAB, 0xA5, 0xAB, 0xE6, 0xB3, 0x48, 0xBC, 0x68, 0xBC, 0x68, 0xBC, 0x68, 0xBC, 0x47, 0xBC, 
-    0xE6, 0xB3, 0xA5, 0xAB, 0x44, 0xA3, 0x04, 0x9B, 0xA3, 0x8A, 0xE1, 0x71, 0x81, 0x61, 0x21, 0x51, 
-    0xC1, 0x38, 0xE2, 0x38, 0x03, 0x29, 0xC2, 0x20, 0x64, 0x39, 0xE2, 0x28, 0x20, 0x08, 0x20, 0x08, 
-    0xC1, 0x38, 0x42, 0x7A, 0x03, 0x9B, 0xA3, 0x8A, 0x42, 0x7A, 0x02, 0x72, 0xC2, 0x69, 0xA2, 0x61, 
-    0xA3, 0x61, 0xA3, 0x59, 0xC4, 0x59, 0xE4, 0x61, 0xC5, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0xC4, 0x51, 
-    0x63, 0x49, 0xC2, 0x28, 0x05, 0x52, 0x85, 0x39, 0x83, 0x30, 0x03, 0x38, 0x04, 0x40, 0x84, 0x40, 
-    0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x62, 0x05, 0xC4, 0xC4, 0xB3, 
-    0xA2, 0x92, 0xC1, 0x40, 0x41, 0x18, 0x61, 0x18, 0x20, 0x08, 0x00, 0x00, 0xA2, 0x20, 0x84, 0x49, 
-    0xA3, 0x59, 0xA2, 0x59, 0xE2, 0x69, 0xE1, 0x71, 0x01, 0x72, 0x01, 0x7A, 0x01, 0x7A, 0xC1, 0x71, 
-    0xA1, 0x69, 0x81, 0x61, 0x61, 0x61, 0x62, 0x59, 0x21, 0x49, 0x63, 0x49, 0xA5, 0x49, 0xE6, 0x49, 
-    0xA5, 0x41, 0xA9, 0x5A, 0xE9, 0x62, 0x26, 0x52, 0x26, 0x52, 0xC2, 0x20, 0x00, 0x08, 0x20, 0x10, 
-    0x22, 0x7A, 0x27, 0xB4, 0xC6, 0xAB, 0xC3, 0x92, 0x43, 0x7A, 0xE2, 0x69, 0xA2, 0x61, 0x82, 0x59, 
-    0x82, 0x59, 0x82, 0x59, 0x83, 0x51, 0xC3, 0x61, 0x63, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x42, 0x10, 0xA4, 0x20, 0xE5, 0x00, 0x27, 0x01, 0x45, 0x38, 0x25, 0x50, 0x65, 0x30, 0x84, 0x30, 
-    0xA2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x6A, 0xC4, 0xBB, 0x64, 0xA3, 
-    0x42, 0x82, 0xC1, 0x40, 0xA1, 0x30, 0xA1, 0x30, 0x40, 0x18, 0x00, 0x08, 0xC3, 0x20, 0x8C, 0x73, 
-    0x0D, 0x84, 0xCD, 0x7B, 0x2F, 0x84, 0xCA, 0x62, 0x69, 0x5A, 0xAA, 0x62, 0x89, 0x62, 0x07, 0x52, 
-    0xA6, 0x41, 0x69, 0x5A, 0x8A, 0x5A, 0xCB, 0x62, 0x69, 0x5A, 0x6D, 0x73, 0xCE, 0x7B, 0xCD, 0x7B, 
-    0x2A, 0x6B, 0xED, 0x83, 0x8B, 0x7B, 0x64, 0x31, 0x82, 0x18, 0x20, 0x08, 0x00, 0x00, 0x01, 0x39, 
-    0xE6, 0xB3, 0x89, 0xBC, 0x66, 0xA3, 0xA3, 0x8A, 0x43, 0x7A, 0xC2, 0x61, 0x62, 0x59, 0x42, 0x51, 
-    0x62, 0x51, 0x62, 0x51, 0x82, 0x51, 0xE4, 0x61, 0xC2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x08, 0x28, 0x31, 0x2B, 0x02, 0x0B, 0x02, 0x88, 0x60, 0xC7, 0x48, 0xC5, 0x28, 0x84, 0x28, 
-    0xC3, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x62, 0x84, 0xB3, 0x44, 0xA3, 
-    0xA3, 0x92, 0x82, 0x61, 0x42, 0x59, 0x21, 0x51, 0x81, 0x28, 0x20, 0x08, 0x00, 0x00, 0x27, 0x4A, 
-    0x90, 0xBD, 0x32, 0xC6, 0x17, 0xDF, 0xD3, 0xBD, 0xB3, 0xB5, 0xD5, 0xB5, 0xB4, 0xAD, 0x8F, 0x94, 
-    0x2E, 0x8C, 0x32, 0xA5, 0x12, 0x9D, 0xD1, 0x94, 0xCC, 0x7B, 0xD3, 0xB5, 0xF3, 0xBD, 0xEF, 0x9C, 
-    0x88, 0x52, 0x47, 0x4A, 0x03, 0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x20, 0x10, 0x24, 0x9B, 
-    0xC9, 0xBC, 0xC6, 0xAB, 0xE3, 0x92, 0x42, 0x82, 0xC2, 0x69, 0x41, 0x51, 0x21, 0x49, 0x22, 0x49, 
-    0x42, 0x49, 0x42, 0x49, 0xA3, 0x59, 0x84, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x08, 0xCF, 0x22, 0xF2, 0x03, 0xD0, 0x22, 0x8B, 0x98, 0x27, 0x61, 0x61, 0x69, 0xC3, 0x50, 
-    0xA4, 0x40, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x39, 0x44, 0xAB, 0x23, 0x9B, 
-    0xC3, 0x92, 0x43, 0x82, 0x43, 0x7A, 0x23, 0x7A, 0x61, 0x59, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 
-    0x23, 0x29, 0x06, 0x4A, 0x10, 0xA5, 0x30, 0xA5, 0x92, 0xB5, 0xF7, 0xD6, 0xF6, 0xD6, 0xB1, 0xB5, 
-    0x70, 0xB5, 0x16, 0xDF, 0x95, 0xCE, 0x91, 0xB5, 0x2A, 0x6B, 0x2D, 0x84, 0x6A, 0x73, 0x64, 0x39, 
-    0x00, 0x10, 0x00, 0x08, 0x41, 0x18, 0x02, 0x29, 0x23, 0x31, 0x81, 0x20, 0xA3, 0x82, 0xC9, 0xC4, 
-    0xE7, 0xAB, 0xC3, 0x92, 0x22, 0x7A, 0xA2, 0x61, 0x41, 0x59, 0x21, 0x49, 0x21, 0x49, 0x01, 0x41, 
-    0x21, 0x49, 0xA3, 0x59, 0xA4, 0x49, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xB1, 0x13, 0x14, 0x1C, 0x6E, 0x91, 0x8E, 0xC0, 0x89, 0x90, 0x02, 0x79, 0xE2, 0x60, 
-    0x44, 0x38, 0xA4, 0x38, 0x64, 0x28, 0x62, 0x18, 0x00, 0x00, 0x20, 0x00, 0x42, 0x7A, 0xC3, 0x92, 
-    0xC3, 0x92, 0xC3, 0x8A, 0xC4, 0x8A, 0x66, 0x9B, 0x25, 0x9B, 0x01, 0x41, 0x00, 0x00, 0x84, 0x41, 
-    0x26, 0x5A, 0x64, 0x39, 0x82, 0x30, 0x20, 0x30, 0xE3, 0x48, 0x27, 0x62, 0x67, 0x62, 0xE6, 0x49, 
-    0x44, 0x39, 0x48, 0x5A, 0xE6, 0x51, 0x24, 0x41, 0x41, 0x28, 0x00, 0x20, 0x00, 0x20, 0x20, 0x28, 
-    0x43, 0x41, 0xE5, 0x51, 0x29, 0x73, 0x46, 0x62, 0x62, 0x49, 0x65, 0x9B, 0x68, 0xBC, 0x85, 0xA3, 
-    0x83, 0x8A, 0xE2, 0x71, 0x81, 0x61, 0x41, 0x51, 0x21, 0x49, 0x01, 0x41, 0x01, 0x41, 0x42, 0x49, 
-    0x83, 0x51, 0x63, 0x39, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x0F, 0x13, 0x10, 0x92, 0x8E, 0xD0, 0xAE, 0xB0, 0x89, 0x70, 0x22, 0x79, 0xA3, 0x50, 
-    0x44, 0x30, 0x43, 0x20, 0x65, 0x48, 0x65, 0x48, 0x84, 0x38, 0xC4, 0x20, 0x4C, 0x73, 0x83, 0x8A, 
-    0x62, 0x8A, 0x83, 0x8A, 0xC3, 0x92, 0x45, 0x9B, 0x49, 0xB4, 0xC8, 0xAB, 0x41, 0x51, 0xC4, 0x51, 
-    0x69, 0x83, 0x32, 0xCE, 0xEF, 0xAC, 0xE9, 0x82, 0xA8, 0x8A, 0x64, 0x71, 0x44, 0x69, 0x24, 0x61, 
-    0xE3, 0x58, 0xC2, 0x50, 0x23, 0x59, 0x64, 0x61, 0xE5, 0x71, 0x8B, 0x93, 0x29, 0x83, 0x8B, 0x83, 
-    0xCF, 0x9C, 0x29, 0x73, 0x86, 0x6A, 0xC4, 0x82, 0xC5, 0xAB, 0xC6, 0xAB, 0x83, 0x82, 0x02, 0x72, 
-    0x61, 0x61, 0x21, 0x51, 0x01, 0x49, 0x01, 0x41, 0x01, 0x41, 0x22, 0x41, 0x42, 0x41, 0x02, 0x31, 
-    0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE9, 0x21, 0x70, 0xC1, 0x8E, 0xC0, 0xEB, 0x70, 0xA4, 0x71, 0x01, 0x71, 0x44, 0x38, 
-    0x43, 0x30, 0x43, 0x20, 0x45, 0x40, 0x24, 0x48, 0x84, 0x30, 0xC4, 0x40, 0xA9, 0x49, 0x84, 0x51, 
-    0x02, 0x72, 0x42, 0x82, 0x42, 0x7A, 0x62, 0x82, 0x24, 0x9B, 0x48, 0xB4, 0x28, 0xB4, 0xC4, 0x8A, 
-    0x44, 0x6A, 0x6B, 0x9C, 0xCE, 0x9C, 0x54, 0xC6, 0x95, 0xCE, 0x71, 0xB5, 0x55, 0xCE, 0xD2, 0xBD, 
-    0xCF, 0xAC, 0x92, 0xBD, 0xB2, 0xBD, 0xEF, 0xAC, 0x8E, 0x94, 0x14, 0xBE, 0xAF, 0x94, 0x8A, 0x7B, 
-    0x89, 0x8B, 0x05, 0x8B, 0x84, 0xA3, 0xC5, 0xB3, 0xE4, 0x8A, 0xA2, 0x61, 0x41, 0x59, 0x21, 0x49, 
-    0xE1, 0x38, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xA1, 0x20, 0x81, 0x10, 0x41, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA4, 0x18, 0x2F, 0xC1, 0xCD, 0xA0, 0xC7, 0x71, 0x81, 0x89, 0x64, 0x40, 0x85, 0x28, 
-    0x64, 0x38, 0x45, 0x38, 0xA6, 0x68, 0xE5, 0x70, 0xA7, 0x40, 0x01, 0x59, 0xC0, 0x58, 0x82, 0x38, 
-    0x83, 0x28, 0x42, 0x49, 0xC2, 0x69, 0xE2, 0x71, 0xE2, 0x71, 0x22, 0x82, 0x24, 0x9B, 0x27, 0xBC, 
-    0x07, 0xB4, 0x85, 0xA3, 0x05, 0x8B, 0xE9, 0x93, 0x6C, 0x9C, 0xEB, 0x8B, 0x30, 0xA5, 0xEF, 0xA4, 
-    0x0C, 0x8C, 0xCF, 0x9C, 0x6D, 0x94, 0x8A, 0x83, 0x08, 0x73, 0xE9, 0x93, 0x86, 0x9B, 0x65, 0x9B, 
-    0xA5, 0xAB, 0x45, 0xA3, 0xA3, 0x8A, 0xC2, 0x69, 0x21, 0x51, 0xE1, 0x40, 0xA1, 0x30, 0x60, 0x20, 
-    0x40, 0x18, 0x40, 0x20, 0x40, 0x20, 0x82, 0x10, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x21, 0x08, 0xEE, 0xB0, 0xEC, 0x98, 0x23, 0x92, 0xC2, 0x60, 0x67, 0x48, 0x87, 0x58, 
-    0x45, 0x50, 0x48, 0x68, 0x09, 0x99, 0x03, 0x92, 0x29, 0x61, 0x08, 0x49, 0x47, 0x51, 0x07, 0x41, 
-    0x84, 0x18, 0x22, 0x18, 0x62, 0x28, 0xC1, 0x38, 0x01, 0x41, 0x21, 0x49, 0x41, 0x61, 0x02, 0x7A, 
-    0xE4, 0x9A, 0xA5, 0xB3, 0x06, 0xBC, 0x07, 0xB4, 0x07, 0xB4, 0xA6, 0xA3, 0xC7, 0xA3, 0xC7, 0xA3, 
-    0x86, 0x9B, 0x85, 0x9B, 0x85, 0xA3, 0xA5, 0xAB, 0xC6, 0xAB, 0xA5, 0xAB, 0x44, 0xA3, 0xE4, 0x92, 
-    0x43, 0x7A, 0xA2, 0x61, 0x01, 0x51, 0xC1, 0x38, 0x60, 0x20, 0x40, 0x18, 0x20, 0x18, 0x00, 0x18, 
-    0x20, 0x30, 0x20, 0x20, 0x62, 0x00, 0x83, 0x08, 0xC4, 0x08, 0xC4, 0x10, 0x63, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xCC, 0x90, 0x4C, 0xB1, 0xC1, 0x81, 0xA4, 0x48, 0xA9, 0x58, 0x8A, 0x88, 
-    0x47, 0x70, 0x8B, 0x98, 0x6C, 0xA0, 0xEA, 0x98, 0x28, 0x89, 0x4A, 0x59, 0x2A, 0x51, 0xE8, 0x58, 
-    0x86, 0x50, 0x24, 0x50, 0x03, 0x30, 0x22, 0x18, 0x42, 0x00, 0x62, 0x00, 0x61, 0x38, 0x61, 0x40, 
-    0xA1, 0x48, 0x01, 0x51, 0x81, 0x69, 0xA3, 0x8A, 0x45, 0xA3, 0xC6, 0xAB, 0x07, 0xB4, 0x07, 0xB4, 
-    0xE7, 0xB3, 0xA6, 0xAB, 0x85, 0xAB, 0x65, 0xA3, 0xA4, 0x8A, 0x02, 0x72, 0x81, 0x61, 0x01, 0x51, 
-    0xC1, 0x40, 0x81, 0x30, 0x41, 0x20, 0x20, 0x20, 0x20, 0x28, 0x20, 0x28, 0x40, 0x30, 0x40, 0x40, 
-    0x21, 0x20, 0x83, 0x00, 0x63, 0x10, 0x23, 0x28, 0x84, 0x10, 0x65, 0x30, 0x08, 0x31, 0x48, 0x29, 
-    0x62, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x44, 0x28, 0x87, 0x91, 0xA1, 0x71, 0xE4, 0x60, 0x88, 0x78, 0x49, 0x78, 
-    0x89, 0x68, 0xCC, 0x31, 0xCD, 0x51, 0x6B, 0x90, 0x6B, 0x90, 0x8A, 0x80, 0x8A, 0x80, 0x69, 0x88, 
-    0x47, 0x68, 0x85, 0x40, 0x64, 0x38, 0x43, 0x30, 0x22, 0x20, 0xA4, 0x00, 0x23, 0x51, 0x20, 0x89, 
-    0x81, 0x60, 0xC1, 0x68, 0x61, 0x48, 0x41, 0x30, 0xC1, 0x48, 0x20, 0x59, 0x41, 0x61, 0x61, 0x61, 
-    0x61, 0x61, 0x61, 0x61, 0x41, 0x59, 0x01, 0x51, 0xC1, 0x40, 0x81, 0x30, 0x41, 0x20, 0x21, 0x20, 
-    0x21, 0x28, 0x41, 0x38, 0x61, 0x50, 0x41, 0x48, 0x41, 0x40, 0x41, 0x40, 0x41, 0x48, 0x40, 0x40, 
-    0x61, 0x40, 0xE5, 0x00, 0xA4, 0x20, 0x25, 0x60, 0x49, 0x68, 0x0B, 0x39, 0xCC, 0x09, 0x4C, 0x41, 
-    0xAA, 0x80, 0xA5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x49, 0x23, 0x49, 0xE2, 0x48, 0x03, 0x61, 0xA6, 0x70, 
-    0xC7, 0x50, 0x4B, 0x02, 0x8D, 0x02, 0x2A, 0x49, 0x48, 0x88, 0xE7, 0x80, 0x4A, 0x78, 0x68, 0x68, 
-    0x68, 0x19, 0x88, 0x01, 0x67, 0x01, 0xC5, 0x30, 0x02, 0x30, 0x29, 0x29, 0xA9, 0x5A, 0x60, 0xC2, 
-    0xE1, 0xB1, 0xC0, 0xA9, 0x61, 0xC2, 0xA1, 0x91, 0xA1, 0x58, 0x41, 0x48, 0x41, 0x40, 0x41, 0x40, 
-    0x41, 0x38, 0x21, 0x30, 0x21, 0x28, 0x01, 0x28, 0x21, 0x30, 0x41, 0x40, 0x81, 0x50, 0xA1, 0x68, 
-    0xA1, 0x68, 0x81, 0x68, 0x41, 0x50, 0x61, 0x48, 0x61, 0x50, 0x40, 0x50, 0x41, 0x30, 0xA2, 0x30, 
-    0x03, 0x39, 0x47, 0x01, 0x2B, 0x02, 0x89, 0x51, 0x67, 0xB9, 0x8A, 0xA9, 0xCC, 0x98, 0x0E, 0x91, 
-    0xB0, 0x32, 0xF1, 0x1A, 0x28, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x59, 0x41, 0x10, 0x00, 0x00, 0x40, 0x08, 0xA2, 0x28, 
-    0xC4, 0x48, 0x88, 0x49, 0x2B, 0x12, 0xEA, 0x11, 0xA6, 0x60, 0x61, 0x79, 0x03, 0x79, 0x25, 0x51, 
-    0xC9, 0x01, 0xA6, 0x38, 0xC6, 0x28, 0x26, 0x29, 0x44, 0x40, 0xAC, 0x61, 0x94, 0x03, 0x08, 0x6B, 
-    0xC0, 0xD2, 0x41, 0xB2, 0xE0, 0xB1, 0xE0, 0xD2, 0xC0, 0xCA, 0x61, 0xB2, 0x01, 0xA2, 0xE1, 0x99, 
-    0xC1, 0x99, 0xA1, 0x99, 0xC1, 0x99, 0xC1, 0xA1, 0xA1, 0xA1, 0x61, 0xA1, 0x21, 0x91, 0xA1, 0x70, 
-    0x61, 0x50, 0xA1, 0x58, 0xE1, 0x70, 0x81, 0x60, 0x61, 0x58, 0x61, 0x40, 0x43, 0x18, 0xC5, 0x00, 
-    0x67, 0x01, 0x2A, 0x02, 0xEE, 0x02, 0x70, 0x13, 0x48, 0x83, 0x24, 0xA3, 0xC4, 0xC2, 0xEB, 0xA1, 
-    0x53, 0x2B, 0x0E, 0x91, 0x0D, 0x99, 0x69, 0x59, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x83, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x41, 0x18, 0xC4, 0x30, 0x87, 0x21, 0x67, 0x41, 0x25, 0x51, 0x62, 0x59, 0x23, 0x41, 
-    0x87, 0x01, 0xA5, 0x20, 0xE5, 0x18, 0x66, 0x11, 0xC8, 0x58, 0xED, 0xB0, 0x32, 0x72, 0x13, 0x1C, 
-    0x41, 0xC3, 0x20, 0xCB, 0x60, 0xBA, 0x80, 0xA9, 0x81, 0xBA, 0xA0, 0xC2, 0x80, 0xC2, 0x80, 0xBA, 
-    0x80, 0xBA, 0x60, 0xBA, 0x20, 0xB2, 0xA0, 0xA1, 0x01, 0x89, 0x81, 0x68, 0x61, 0x60, 0xE1, 0x68, 
-    0xA1, 0x99, 0xA0, 0xA9, 0xC1, 0x70, 0xA1, 0x68, 0x80, 0x58, 0x63, 0x20, 0x25, 0x48, 0x48, 0x21, 
-    0x6B, 0x02, 0xAD, 0x02, 0xCD, 0x02, 0x91, 0x03, 0x14, 0x04, 0xD3, 0x0B, 0x85, 0xA3, 0x46, 0xA3, 
-    0xF2, 0x42, 0x6D, 0xD0, 0xA5, 0xC2, 0xC5, 0xBA, 0xEC, 0x90, 0xA6, 0x38, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x42, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xC4, 0x10, 0x26, 0x19, 0x26, 0x31, 
-    0x05, 0x39, 0x46, 0x31, 0x45, 0x11, 0x04, 0x09, 0x8A, 0x31, 0x31, 0x8A, 0xB1, 0x99, 0x93, 0x6A, 
-    0x85, 0xDA, 0x80, 0xCB, 0x00, 0xCB, 0x60, 0xBA, 0x81, 0xA1, 0xA1, 0xA9, 0xA1, 0xA1, 0x81, 0xA1, 
-    0x41, 0x91, 0x01, 0x89, 0xE1, 0x80, 0xA1, 0x68, 0xC1, 0x68, 0x81, 0x89, 0x21, 0xAA, 0x60, 0xC2, 
-    0x80, 0xA1, 0x81, 0x68, 0xC1, 0x70, 0xA0, 0x68, 0x43, 0x28, 0x66, 0x48, 0x28, 0x80, 0xCB, 0x31, 
-    0x2F, 0x03, 0x2B, 0x02, 0x8C, 0x02, 0xCC, 0x41, 0xAD, 0x71, 0x73, 0x03, 0x8A, 0x73, 0x44, 0xB3, 
-    0x15, 0x04, 0xD2, 0x42, 0xAE, 0xA1, 0x8D, 0xA9, 0xF0, 0x71, 0x53, 0x23, 0x10, 0x13, 0x27, 0x09, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0x61, 0x18, 0xC3, 0x28, 0xE4, 0x30, 0x0A, 0x12, 0x33, 0x53, 0xCF, 0xC8, 0x90, 0xD8, 
-    0x2E, 0x9A, 0xA1, 0xCB, 0xC0, 0xC2, 0xC0, 0xC2, 0xE0, 0xC2, 0x41, 0xBA, 0xE0, 0xB1, 0x80, 0xA9, 
-    0x60, 0xA1, 0xA1, 0xA1, 0x00, 0xAA, 0x21, 0xAA, 0x80, 0xC2, 0x80, 0xC2, 0xE0, 0xB1, 0xE0, 0x80, 
-    0x81, 0x60, 0x21, 0x81, 0xE0, 0x78, 0x62, 0x28, 0x47, 0x48, 0x4A, 0x90, 0x8B, 0x98, 0x69, 0x80, 
-    0x6A, 0x39, 0x0B, 0x02, 0x88, 0x01, 0x89, 0x68, 0x09, 0x98, 0xCE, 0x51, 0x8D, 0x3B, 0x61, 0xCB, 
-    0xAD, 0x4B, 0xF5, 0x03, 0xD4, 0x0B, 0xB2, 0x2B, 0xAE, 0x4B, 0x6D, 0x72, 0x2C, 0x92, 0x6B, 0x9A, 
-    0x88, 0x71, 0x62, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x62, 0x49, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x01, 0x72, 0x7A, 0xAF, 0xC8, 0xB3, 0x5A, 
-    0x58, 0x04, 0xA9, 0x83, 0x40, 0xD3, 0xA1, 0xBA, 0x40, 0xBA, 0x21, 0xCB, 0x00, 0xCB, 0xA0, 0xC2, 
-    0xA0, 0xC2, 0x00, 0xCB, 0xE0, 0xCA, 0x80, 0xC2, 0xC0, 0xA9, 0x21, 0x91, 0xC1, 0x78, 0xC1, 0x68, 
-    0x61, 0x99, 0x20, 0x89, 0x41, 0x28, 0x47, 0x48, 0xA9, 0x98, 0xCA, 0xA0, 0x8A, 0xA0, 0x68, 0x88, 
-    0x4A, 0x31, 0x0A, 0x02, 0xE6, 0x00, 0x64, 0x20, 0x47, 0x48, 0xEC, 0x80, 0xED, 0x59, 0xC5, 0xB9, 
-    0x22, 0xBB, 0x26, 0x9B, 0x26, 0x93, 0xA6, 0xB2, 0x69, 0xC1, 0xEC, 0xC0, 0xC9, 0xB1, 0x2B, 0x99, 
-    0x2F, 0xA9, 0x6D, 0x99, 0xE6, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0xA3, 0x51, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x90, 0xA1, 0x92, 0x6A, 0xAB, 0x83, 
-    0x75, 0x14, 0x34, 0x1C, 0x01, 0xCB, 0x60, 0xCB, 0x81, 0xBA, 0xE0, 0xB1, 0x40, 0xBA, 0xA0, 0xC2, 
-    0x81, 0xBA, 0x01, 0xB2, 0xC1, 0xA9, 0x81, 0x99, 0x01, 0x81, 0xE1, 0x78, 0x01, 0x79, 0xA1, 0xA1, 
-    0x40, 0x89, 0x01, 0x30, 0x67, 0x48, 0x29, 0x89, 0x04, 0x9A, 0xE9, 0xA0, 0x2C, 0x69, 0x6D, 0x1A, 
-    0x6B, 0x02, 0x27, 0x11, 0xA4, 0x10, 0x62, 0x10, 0x83, 0x08, 0xA7, 0x48, 0xAA, 0x88, 0xCB, 0x78, 
-    0xC9, 0x90, 0xE8, 0xB8, 0x2A, 0xB9, 0xAB, 0xA0, 0x8D, 0x90, 0x0E, 0xA9, 0xCB, 0x68, 0xCB, 0x70, 
-    0xCB, 0x78, 0xEE, 0x88, 0x90, 0x99, 0xE9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x60, 0x10, 0x83, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x20, 0xD1, 0x79, 0x0B, 0x8B, 0xA0, 0xFB, 
-    0x0E, 0x64, 0xF4, 0x4A, 0xA9, 0xC9, 0x60, 0xCB, 0x40, 0xCB, 0xE0, 0xC2, 0x00, 0xB2, 0xC0, 0xA9, 
-    0xE0, 0xB1, 0xC1, 0xA9, 0x61, 0x99, 0x01, 0x89, 0x21, 0x89, 0x81, 0x91, 0xC0, 0xA9, 0x40, 0x81, 
-    0xA4, 0x18, 0xAA, 0x19, 0x11, 0x13, 0xE8, 0x6A, 0x07, 0xB1, 0x8F, 0x51, 0x70, 0x03, 0xEE, 0x02, 
-    0x89, 0x11, 0x45, 0x48, 0x23, 0x38, 0xA4, 0x10, 0xA3, 0x00, 0x00, 0x00, 0x63, 0x20, 0xE9, 0x11, 
-    0x0D, 0x22, 0xCC, 0x70, 0x4C, 0x90, 0xA9, 0x48, 0x0F, 0x22, 0x09, 0x41, 0xA9, 0x78, 0xAC, 0xA0, 
-    0xCD, 0xB0, 0xEF, 0xB8, 0x0F, 0x99, 0xB0, 0x89, 0xE6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x81, 0x18, 0x43, 0x39, 0x00, 0x00, 0xA2, 0x10, 0x2C, 0x63, 0xAE, 0x73, 0x28, 0x42, 
-    0xA6, 0x31, 0x66, 0x29, 0x24, 0x21, 0xE3, 0x18, 0x82, 0x10, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x6A, 0x09, 0x9B, 0xAC, 0x73, 
-    0x14, 0x24, 0x8F, 0xB1, 0x53, 0x7A, 0x0D, 0x5C, 0x40, 0xD3, 0x41, 0xC3, 0x00, 0xC3, 0x60, 0xBA, 
-    0x20, 0xBA, 0xA1, 0xA1, 0x61, 0x99, 0xC1, 0xA1, 0xE1, 0xA9, 0xE0, 0xB1, 0x01, 0x69, 0x47, 0x01, 
-    0xAE, 0x0A, 0x92, 0x13, 0xD4, 0x03, 0x08, 0x73, 0xA8, 0xB0, 0x8F, 0x49, 0xD0, 0x0A, 0xCA, 0x58, 
-    0x08, 0x29, 0x65, 0x40, 0x44, 0x30, 0x06, 0x01, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x25, 0x01, 0xC9, 0x11, 0x69, 0x29, 0x6A, 0x21, 0x2A, 0x29, 0x2D, 0x79, 0x13, 0x4B, 0x92, 0x62, 
-    0x2F, 0xB1, 0x4E, 0x99, 0xB1, 0x1A, 0xF0, 0x02, 0x4D, 0x2A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x10, 0x61, 0x18, 0x04, 0x19, 0x98, 0xCE, 0xDD, 0xEF, 0xDD, 0xEF, 0xDD, 0xEF, 
-    0x9A, 0xBE, 0x5A, 0xBE, 0x5A, 0xBE, 0x19, 0xB6, 0xD8, 0xB5, 0xB7, 0xAD, 0xB7, 0xAD, 0xD3, 0x94, 
-    0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x59, 0xCF, 0x72, 0xD1, 0x4B, 
-    0x36, 0x1C, 0xEF, 0xD8, 0xD1, 0xA1, 0xB6, 0x2B, 0xC8, 0x9A, 0x20, 0xCB, 0x21, 0xC3, 0xE0, 0xC2, 
-    0xA0, 0xC2, 0x60, 0xBA, 0x80, 0xBA, 0x60, 0xBA, 0x00, 0xAA, 0x01, 0x41, 0xA8, 0x01, 0x4E, 0x32, 
-    0xAC, 0xB8, 0xEE, 0x71, 0x14, 0x04, 0x2C, 0x3B, 0xE4, 0xA1, 0x8A, 0x90, 0x88, 0x78, 0x46, 0x90, 
-    0x28, 0x29, 0x65, 0x38, 0xA5, 0x20, 0x26, 0x09, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0x83, 0x08, 0xAD, 0x61, 0x54, 0x53, 0x97, 0x04, 0x75, 0x04, 
-    0x72, 0x13, 0x11, 0x13, 0x8C, 0x32, 0x4C, 0x22, 0x6E, 0x0A, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x08, 0xC2, 0x20, 0x16, 0xB6, 0xBD, 0xEF, 0xFA, 0xD6, 0x1A, 0xD7, 0x5B, 0xDF, 
-    0x3B, 0xD7, 0xD7, 0xAD, 0xF8, 0xB5, 0x18, 0xB6, 0x19, 0xB6, 0x19, 0xB6, 0x19, 0xB6, 0x7A, 0xC6, 
-    0x76, 0xA5, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x79, 0x53, 0x33, 0x93, 0x43, 
-    0x94, 0x4B, 0xCF, 0xD0, 0xCF, 0xC8, 0xF0, 0xC8, 0xD0, 0xC0, 0xA7, 0xB1, 0xA0, 0xC2, 0xC0, 0xCA, 
-    0xC1, 0xBA, 0xA0, 0xBA, 0x80, 0xC2, 0x00, 0xA2, 0xE2, 0x28, 0xEA, 0x01, 0x11, 0x1B, 0xCD, 0xB0, 
-    0x0D, 0xA9, 0x92, 0x1B, 0xF3, 0x03, 0x2A, 0x53, 0xA1, 0xB2, 0x04, 0x8A, 0xA3, 0x81, 0x85, 0x41, 
-    0x88, 0x01, 0x44, 0x40, 0xA5, 0x20, 0xC5, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x10, 0xAC, 0x73, 0xE8, 0x93, 0xAC, 0x6B, 0x15, 0x0C, 
-    0x51, 0x03, 0x66, 0x72, 0xE0, 0xA1, 0xE2, 0x81, 0xE8, 0x31, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x8D, 0x73, 0xDD, 0xEF, 0x1A, 0xD7, 0x3B, 0xDF, 0x3B, 0xD7, 0x3B, 0xDF, 
-    0x9C, 0xE7, 0x38, 0xBE, 0x77, 0xA5, 0xB7, 0xAD, 0xB7, 0xAD, 0xB7, 0xAD, 0xB7, 0xAD, 0x76, 0xA5, 
-    0x18, 0xBE, 0x6E, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x89, 0x91, 0x6A, 0xF3, 0x4A, 
-    0x30, 0xB1, 0x2C, 0xD1, 0x64, 0xCB, 0x25, 0xD3, 0x44, 0xCB, 0x89, 0xC1, 0xCA, 0x71, 0xE1, 0xB2, 
-    0xC0, 0xD2, 0xC0, 0xCA, 0xA0, 0x89, 0x63, 0x28, 0xCA, 0x01, 0xF3, 0x03, 0xCF, 0x71, 0x4D, 0xC0, 
-    0x93, 0x1B, 0x34, 0x04, 0x8F, 0x1B, 0xE7, 0x72, 0xCC, 0x32, 0xEE, 0x0A, 0x8C, 0x02, 0xE9, 0x01, 
-    0x68, 0x11, 0x64, 0x38, 0x65, 0x38, 0xC5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x29, 0x92, 0x44, 0xC3, 0xA5, 0xBA, 0x02, 0xC3, 0x50, 0x2B, 
-    0xAA, 0x4A, 0xC1, 0xA1, 0xA7, 0x68, 0x06, 0x71, 0x43, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xF6, 0xB5, 0x7B, 0xE7, 0x3B, 0xDF, 0x9C, 0xDF, 0x7C, 0xDF, 0x3B, 0xD7, 
-    0x9C, 0xE7, 0xDA, 0xCE, 0x15, 0x9D, 0x76, 0xA5, 0x76, 0xA5, 0x76, 0xA5, 0x56, 0xA5, 0x56, 0xA5, 
-    0x56, 0xA5, 0x15, 0x9D, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x46, 0x79, 0xAE, 0xC8, 0x2A, 0xC9, 
-    0x2C, 0xC9, 0x8E, 0xB9, 0x0F, 0x4C, 0xCE, 0x53, 0x4B, 0x6B, 0x4F, 0x72, 0x95, 0x0B, 0xB1, 0x1B, 
-    0x65, 0x7A, 0x43, 0x49, 0xA6, 0x10, 0x0A, 0x61, 0xF0, 0x32, 0x33, 0x04, 0x0E, 0x5A, 0x0B, 0xC0, 
-    0x70, 0x42, 0x13, 0x04, 0x71, 0x0B, 0x30, 0x03, 0x30, 0x03, 0xAF, 0x02, 0x29, 0x39, 0x46, 0x50, 
-    0x45, 0x40, 0xA5, 0x20, 0x27, 0x09, 0xE5, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x18, 0xE2, 0x20, 0xA7, 0x60, 0xEE, 0xD0, 0xAE, 0xC0, 0x0D, 0xB1, 0xC5, 0xA2, 0x0D, 0x4A, 
-    0xA5, 0x81, 0xC6, 0x78, 0x09, 0x68, 0xC9, 0x60, 0x62, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x24, 0x21, 0x3B, 0xDF, 0x5B, 0xDF, 0xB9, 0xCE, 0xE9, 0x72, 0xF2, 0x9C, 0x9C, 0xDF, 
-    0x5B, 0xDF, 0x1A, 0xD7, 0xD4, 0x94, 0xF5, 0x9C, 0x15, 0x9D, 0xF5, 0x9C, 0xF5, 0x9C, 0xF5, 0x9C, 
-    0xF4, 0x94, 0x35, 0xA5, 0x45, 0x29, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x70, 0xAA, 0xC1, 0xE4, 0xB3, 
-    0x25, 0xD3, 0x90, 0x99, 0x56, 0x04, 0x15, 0x04, 0xB2, 0x2A, 0x8F, 0x4A, 0xCF, 0x43, 0x71, 0x54, 
-    0xAC, 0x5B, 0xE9, 0x52, 0xAB, 0x62, 0xAC, 0x71, 0xEE, 0x61, 0x91, 0x0B, 0x70, 0x03, 0x8D, 0x61, 
-    0x4B, 0xA8, 0xED, 0x49, 0x70, 0x03, 0x0F, 0x03, 0xEF, 0x02, 0x0A, 0x49, 0x46, 0x50, 0xE5, 0x10, 
-    0x44, 0x40, 0x85, 0x28, 0x06, 0x09, 0xC4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA4, 0x49, 0x86, 0x72, 0x47, 0x82, 0x2C, 0x89, 0x70, 0x81, 0xED, 0xB0, 0xEC, 0x98, 0x8B, 0x88, 
-    0x87, 0x78, 0x46, 0x68, 0xA9, 0x60, 0x06, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x69, 0x4A, 0xBC, 0xE7, 0x7C, 0xDF, 0xCC, 0x8B, 0x80, 0x38, 0x84, 0x51, 0x1A, 0xD7, 
-    0x7B, 0xDF, 0x3B, 0xDF, 0xB3, 0x94, 0x73, 0x8C, 0x93, 0x94, 0x93, 0x94, 0xB3, 0x94, 0x93, 0x94, 
-    0x72, 0x8C, 0xD4, 0x9C, 0xC7, 0x39, 0x00, 0x00, 0x20, 0x00, 0xE7, 0x70, 0xC9, 0xBA, 0x12, 0x24, 
-    0x67, 0xB3, 0xEC, 0xC0, 0x53, 0x13, 0x2F, 0x52, 0xCB, 0xA1, 0x2D, 0x9C, 0x8C, 0xA4, 0xA8, 0x93, 
-    0xE7, 0xA3, 0xC8, 0x93, 0xC7, 0x9B, 0x27, 0x83, 0xC8, 0x59, 0x4B, 0x41, 0x2D, 0x42, 0x8E, 0x22, 
-    0xEC, 0x39, 0x4A, 0x90, 0xAC, 0x41, 0x2E, 0x03, 0xCB, 0x19, 0x46, 0x60, 0x06, 0x09, 0x05, 0x01, 
-    0x64, 0x30, 0x64, 0x30, 0xC5, 0x10, 0xE5, 0x28, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x81, 0x10, 
-    0x05, 0x62, 0x66, 0x6A, 0x86, 0x6A, 0xA6, 0x6A, 0xCD, 0x1A, 0x0E, 0x3A, 0x6B, 0x98, 0x89, 0x70, 
-    0x29, 0x21, 0x49, 0x29, 0x88, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x4C, 0x63, 0xDD, 0xEF, 0xFA, 0xD6, 0x86, 0x6A, 0x21, 0x49, 0x22, 0x41, 0x16, 0xBE, 
-    0x9C, 0xDF, 0x5B, 0xDF, 0x92, 0x94, 0x11, 0x84, 0x52, 0x8C, 0x52, 0x8C, 0x52, 0x8C, 0x31, 0x8C, 
-    0x11, 0x84, 0x72, 0x94, 0xE7, 0x41, 0x00, 0x00, 0x81, 0x08, 0xA6, 0x59, 0x2A, 0x8A, 0x56, 0x04, 
-    0x11, 0x24, 0x0D, 0x7A, 0x4E, 0x71, 0xCA, 0x79, 0x2A, 0x94, 0x2A, 0x94, 0x88, 0x8B, 0xE6, 0x6A, 
-    0x47, 0x83, 0x28, 0x83, 0x48, 0x83, 0x48, 0x83, 0x66, 0x8B, 0x86, 0x31, 0x4B, 0x31, 0xE9, 0x78, 
-    0x8A, 0x41, 0x4A, 0x41, 0x68, 0x70, 0x09, 0x39, 0x66, 0x50, 0x85, 0x30, 0x05, 0x01, 0x84, 0x08, 
-    0x23, 0x30, 0x23, 0x20, 0x42, 0x08, 0xE4, 0x18, 0xC3, 0x18, 0x00, 0x00, 0x20, 0x00, 0xC4, 0x51, 
-    0x66, 0x6A, 0xA8, 0x7A, 0xC8, 0x7A, 0x26, 0x6A, 0x25, 0x62, 0xA8, 0x31, 0x49, 0x78, 0x09, 0x29, 
-    0xC9, 0x01, 0xC9, 0x19, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x6D, 0x6B, 0xDD, 0xEF, 0xF9, 0xCE, 0x86, 0x6A, 0x21, 0x49, 0x42, 0x49, 0x37, 0xBE, 
-    0x9C, 0xE7, 0x3A, 0xDF, 0x51, 0x8C, 0xF0, 0x83, 0x11, 0x84, 0x11, 0x84, 0xF0, 0x83, 0xF0, 0x83, 
-    0xCF, 0x83, 0x31, 0x8C, 0x86, 0x31, 0x00, 0x00, 0xA1, 0x18, 0xE5, 0x51, 0x85, 0x49, 0xCB, 0x3A, 
-    0x0C, 0x2B, 0xAC, 0x02, 0x8B, 0x51, 0x49, 0x93, 0x89, 0x8B, 0xA8, 0x93, 0x87, 0x83, 0x07, 0x73, 
-    0x06, 0x7B, 0x07, 0x7B, 0x27, 0x7B, 0x29, 0x9C, 0xE7, 0x72, 0xA5, 0x72, 0xA7, 0x11, 0xE8, 0x28, 
-    0xC7, 0x40, 0xE7, 0x30, 0x66, 0x48, 0x24, 0x50, 0x63, 0x38, 0x83, 0x08, 0x83, 0x08, 0x41, 0x18, 
-    0x61, 0x18, 0x81, 0x10, 0x82, 0x10, 0x04, 0x29, 0x82, 0x10, 0x00, 0x00, 0x23, 0x31, 0x66, 0x6A, 
-    0x87, 0x72, 0xE9, 0x7A, 0x87, 0x72, 0x05, 0x62, 0xA4, 0x51, 0x84, 0x51, 0x85, 0x48, 0x05, 0x49, 
-    0x83, 0x59, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x6D, 0x6B, 0xDD, 0xEF, 0x5C, 0xDF, 0x0C, 0x94, 0x40, 0x59, 0x87, 0x6A, 0x1A, 0xD7, 
-    0x5B, 0xDF, 0xD9, 0xD6, 0xF0, 0x83, 0xF0, 0x83, 0xF0, 0x83, 0xCF, 0x83, 0xCF, 0x83, 0xCF, 0x83, 
-    0xCF, 0x83, 0xEF, 0x8B, 0xC3, 0x18, 0x00, 0x00, 0xA1, 0x20, 0x04, 0x6A, 0xE4, 0x61, 0x44, 0x82, 
-    0x42, 0x51, 0x03, 0x31, 0x46, 0x4A, 0x29, 0xA4, 0x49, 0xAC, 0x88, 0x8B, 0x67, 0x83, 0x89, 0xAC, 
-    0x05, 0x83, 0xA6, 0x93, 0x26, 0x83, 0x26, 0x7B, 0xC8, 0x8B, 0xA7, 0x9B, 0x82, 0x49, 0x82, 0x10, 
-    0xE2, 0x28, 0xC2, 0x28, 0x02, 0x31, 0xA3, 0x51, 0x63, 0x49, 0xA2, 0x20, 0xA2, 0x20, 0xA2, 0x20, 
-    0x82, 0x18, 0xA2, 0x18, 0x82, 0x20, 0x25, 0x31, 0x69, 0x52, 0x64, 0x39, 0xA4, 0x51, 0x05, 0x62, 
-    0xC8, 0x7A, 0xE8, 0x7A, 0xE5, 0x61, 0x83, 0x51, 0x43, 0x49, 0x02, 0x39, 0x23, 0x39, 0x22, 0x59, 
-    0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0xEB, 0x52, 0xDD, 0xEF, 0x3B, 0xD7, 0xF9, 0xD6, 0x8E, 0xA4, 0x56, 0xCE, 0x5B, 0xDF, 
-    0x7B, 0xE7, 0x37, 0xC6, 0xAE, 0x7B, 0xEF, 0x83, 0xCF, 0x83, 0xAE, 0x83, 0xAE, 0x83, 0xAE, 0x83, 
-    0xCF, 0x8B, 0x4C, 0x7B, 0x20, 0x00, 0x00, 0x00, 0xA1, 0x18, 0xE3, 0x69, 0xE4, 0x61, 0x04, 0x6A, 
-    0xE2, 0x28, 0x83, 0x51, 0x84, 0x72, 0x08, 0xA4, 0x28, 0xAC, 0xE6, 0x7A, 0x89, 0xAC, 0xE9, 0xBC, 
-    0x65, 0x93, 0x25, 0x83, 0xC6, 0x9B, 0xE5, 0x7A, 0x08, 0xA4, 0xA7, 0x93, 0x03, 0x5A, 0x81, 0x18, 
-    0xE2, 0x30, 0x02, 0x39, 0x02, 0x39, 0x63, 0x49, 0x23, 0x41, 0xE2, 0x30, 0x23, 0x39, 0x02, 0x39, 
-    0x81, 0x20, 0x41, 0x18, 0xA2, 0x20, 0x26, 0x29, 0x8C, 0x7B, 0x67, 0x6A, 0xA4, 0x51, 0x46, 0x6A, 
-    0xA7, 0x7A, 0x05, 0x6A, 0x83, 0x51, 0x43, 0x49, 0x23, 0x41, 0xE2, 0x30, 0xE2, 0x30, 0xE3, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x44, 0x21, 0x7C, 0xE7, 0x3B, 0xD7, 0x5B, 0xDF, 0x7C, 0xDF, 0x5B, 0xDF, 0x1A, 0xD7, 
-    0x7C, 0xE7, 0xD2, 0x9C, 0x8E, 0x83, 0xCE, 0x8B, 0xAE, 0x83, 0xAE, 0x83, 0xAE, 0x83, 0x8E, 0x83, 
-    0xEF, 0x93, 0x27, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x20, 0xE3, 0x69, 0x04, 0x6A, 0x24, 0x6A, 
-    0xA1, 0x20, 0x22, 0x41, 0x84, 0x72, 0x49, 0xAC, 0xA7, 0x93, 0xC4, 0x7A, 0x89, 0xAC, 0x4B, 0xC5, 
-    0x46, 0xB4, 0xA5, 0x9B, 0xC3, 0x7A, 0xC3, 0x51, 0x66, 0x93, 0x66, 0x93, 0x44, 0x6A, 0x81, 0x20, 
-    0xA1, 0x28, 0xE2, 0x38, 0xE2, 0x38, 0x22, 0x39, 0xE2, 0x38, 0xC2, 0x28, 0xE2, 0x38, 0x02, 0x41, 
-    0xC1, 0x28, 0x41, 0x10, 0x82, 0x18, 0x23, 0x39, 0x63, 0x51, 0xA4, 0x51, 0x05, 0x62, 0xE5, 0x59, 
-    0x05, 0x62, 0x83, 0x51, 0x43, 0x49, 0x43, 0x41, 0xE2, 0x30, 0xE2, 0x30, 0xC2, 0x28, 0x23, 0x39, 
-    0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x95, 0xAD, 0xDD, 0xEF, 0xFA, 0xD6, 0x1A, 0xD7, 0x1A, 0xD7, 0x7B, 0xE7, 
-    0x98, 0xCE, 0xAD, 0x83, 0xAE, 0x8B, 0xAE, 0x8B, 0x8D, 0x83, 0x8D, 0x83, 0x8D, 0x83, 0xAE, 0x8B, 
-    0x8D, 0x83, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0xC3, 0x59, 0x04, 0x6A, 0x04, 0x6A, 
-    0xA1, 0x28, 0xA3, 0x59, 0x84, 0x72, 0xC7, 0x9B, 0x25, 0x83, 0x05, 0x83, 0x04, 0x93, 0xA4, 0xA3, 
-    0x05, 0xB4, 0x02, 0x6A, 0xA2, 0x51, 0x44, 0x6A, 0x46, 0x93, 0x05, 0x83, 0xE3, 0x59, 0xA1, 0x28, 
-    0x81, 0x20, 0xE2, 0x38, 0xE1, 0x38, 0x02, 0x39, 0xE2, 0x30, 0xA1, 0x28, 0xC2, 0x30, 0xE2, 0x38, 
-    0xA1, 0x28, 0x20, 0x08, 0xA1, 0x28, 0x83, 0x59, 0x25, 0x6A, 0x25, 0x62, 0x46, 0x6A, 0xE4, 0x61, 
-    0x43, 0x49, 0x02, 0x39, 0x02, 0x39, 0xE2, 0x30, 0xE2, 0x30, 0x03, 0x31, 0xC2, 0x20, 0x81, 0x10, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x44, 0x29, 0x1A, 0xD7, 0x7C, 0xE7, 0x3B, 0xDF, 0x7C, 0xDF, 0x1A, 0xD7, 
-    0x50, 0x94, 0xAD, 0x8B, 0xCE, 0x8B, 0xAD, 0x8B, 0xAD, 0x8B, 0xAD, 0x8B, 0xAD, 0x8B, 0x0F, 0x9C, 
-    0xA6, 0x39, 0x03, 0x21, 0x65, 0x31, 0x00, 0x00, 0x20, 0x08, 0x23, 0x31, 0x04, 0x5A, 0x03, 0x6A, 
-    0xA1, 0x20, 0xC3, 0x59, 0x44, 0x6A, 0x66, 0x93, 0xA6, 0x9B, 0x64, 0x6A, 0x65, 0x9B, 0x63, 0x72, 
-    0xC2, 0x61, 0xA2, 0x59, 0x84, 0x72, 0xA4, 0x7A, 0x25, 0x8B, 0x64, 0x72, 0xE3, 0x59, 0x81, 0x20, 
-    0xC1, 0x28, 0xE2, 0x38, 0xE1, 0x30, 0x02, 0x39, 0xE2, 0x30, 0xA1, 0x28, 0xC1, 0x28, 0xC2, 0x30, 
-    0x40, 0x10, 0x81, 0x18, 0x63, 0x51, 0x45, 0x72, 0xA7, 0x72, 0x87, 0x72, 0xE8, 0x7A, 0x05, 0x62, 
-    0x43, 0x41, 0xC2, 0x30, 0xA1, 0x20, 0xE2, 0x30, 0xE2, 0x28, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x6B, 0xB9, 0xCE, 0x1A, 0xD7, 0x78, 0xC6, 0x2F, 0x94, 
-    0x8C, 0x83, 0xCD, 0x8B, 0xCD, 0x8B, 0xAD, 0x8B, 0x8D, 0x83, 0xAD, 0x8B, 0x8D, 0x83, 0x85, 0x39, 
-    0x00, 0x00, 0x64, 0x39, 0x22, 0x39, 0x00, 0x00, 0xA1, 0x20, 0xC3, 0x20, 0x0A, 0x22, 0xE5, 0x51, 
-    0x80, 0x20, 0x22, 0x31, 0xC4, 0x59, 0x45, 0x8B, 0x25, 0x83, 0x65, 0x6A, 0x43, 0x6A, 0x43, 0x6A, 
-    0xC4, 0x82, 0xE2, 0x69, 0xC3, 0x59, 0xC4, 0x7A, 0xE4, 0x82, 0x63, 0x72, 0x82, 0x49, 0x61, 0x18, 
-    0xC1, 0x28, 0xE2, 0x30, 0xC1, 0x30, 0x22, 0x41, 0xE1, 0x30, 0x61, 0x18, 0x61, 0x18, 0x41, 0x08, 
-    0x40, 0x08, 0x22, 0x41, 0xE4, 0x61, 0xA7, 0x72, 0xA8, 0x72, 0xC8, 0x72, 0x66, 0x72, 0xE5, 0x61, 
-    0x23, 0x41, 0xC2, 0x28, 0x03, 0x31, 0xA2, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x4F, 0x8C, 0x2E, 0x94, 0x6C, 0x7B, 0xEA, 0x6A, 0xA9, 0x62, 
-    0xEA, 0x6A, 0xC9, 0x6A, 0x0A, 0x73, 0xE7, 0x49, 0x61, 0x08, 0x81, 0x10, 0x40, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x08, 0x02, 0x41, 0x61, 0x18, 0x23, 0x39, 0xA1, 0x28, 0xEA, 0x19, 0x6D, 0x22, 
-    0x87, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0x85, 0x62, 0x05, 0x83, 0xE5, 0x7A, 0xE6, 0x82, 0x46, 0x8B, 
-    0x86, 0x93, 0x26, 0x83, 0x26, 0x83, 0x03, 0x5A, 0x63, 0x72, 0x43, 0x6A, 0xE1, 0x28, 0x41, 0x08, 
-    0x61, 0x10, 0x61, 0x08, 0x61, 0x10, 0xA2, 0x20, 0x61, 0x10, 0x62, 0x00, 0x63, 0x00, 0x42, 0x00, 
-    0x81, 0x18, 0x63, 0x51, 0x45, 0x72, 0xA7, 0x72, 0x67, 0x6A, 0x67, 0x6A, 0x05, 0x6A, 0xC4, 0x61, 
-    0x43, 0x49, 0xE2, 0x30, 0xC2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x12, 0xA5, 0x12, 0xAD, 0xEE, 0x8B, 0x4C, 0x73, 0x4C, 0x73, 
-    0x2C, 0x73, 0x2B, 0x6B, 0x6D, 0x7B, 0x85, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x10, 0x62, 0x51, 0xA1, 0x28, 0x23, 0x41, 0x63, 0x51, 0x46, 0x19, 0x6D, 0x1A, 
-    0x6C, 0x22, 0x6C, 0x2A, 0x6E, 0x22, 0x0A, 0x2A, 0x04, 0x8B, 0xC4, 0x7A, 0x64, 0x6A, 0xC4, 0x7A, 
-    0xA5, 0x72, 0x64, 0x6A, 0x63, 0x72, 0x84, 0x72, 0x84, 0x72, 0xA2, 0x51, 0x42, 0x00, 0x83, 0x00, 
-    0xE5, 0x08, 0x47, 0x11, 0x05, 0x19, 0x83, 0x00, 0x83, 0x00, 0xA4, 0x08, 0x83, 0x08, 0x63, 0x00, 
-    0x61, 0x10, 0x22, 0x49, 0x04, 0x6A, 0x26, 0x62, 0x46, 0x6A, 0x25, 0x6A, 0xC4, 0x61, 0xA3, 0x59, 
-    0x22, 0x41, 0xE2, 0x30, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC3, 0x10, 0x54, 0xAD, 0x33, 0xAD, 0xF2, 0xA4, 0xEF, 0x83, 0x8E, 0x7B, 
-    0x8E, 0x7B, 0x6D, 0x73, 0xEF, 0x83, 0xA6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xC4, 0x51, 0x22, 0x39, 0xC1, 0x30, 0xC4, 0x51, 0xC1, 0x28, 0x26, 0x19, 0x4C, 0x2A, 
-    0x2A, 0x2A, 0x4C, 0x22, 0x4C, 0x22, 0x6E, 0x1A, 0x08, 0x32, 0x85, 0x72, 0xE5, 0x82, 0xC4, 0x82, 
-    0xA4, 0x72, 0x63, 0x6A, 0x64, 0x6A, 0x05, 0x8B, 0xE4, 0x51, 0x62, 0x08, 0xA4, 0x00, 0xE5, 0x08, 
-    0xA9, 0x11, 0xCA, 0x19, 0xA8, 0x21, 0x26, 0x19, 0xA4, 0x08, 0xA3, 0x08, 0x83, 0x08, 0x83, 0x08, 
-    0x41, 0x00, 0xA1, 0x28, 0x63, 0x59, 0xE4, 0x61, 0x25, 0x62, 0xC4, 0x61, 0xA3, 0x59, 0x42, 0x49, 
-    0xE2, 0x38, 0xE3, 0x28, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xD6, 0xBD, 0x33, 0xAD, 0x53, 0xAD, 0x12, 0xA5, 0x10, 0x84, 
-    0xAF, 0x7B, 0xAF, 0x73, 0x11, 0x84, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x43, 0x39, 0x24, 0x62, 0xE4, 0x61, 0x63, 0x49, 0x40, 0x10, 0xC4, 0x10, 0x4C, 0x2A, 
-    0x6D, 0x22, 0x4C, 0x1A, 0x0B, 0x1A, 0x4C, 0x1A, 0x2D, 0x1A, 0xEA, 0x21, 0x26, 0x4A, 0x85, 0x6A, 
-    0xA4, 0x72, 0xC5, 0x7A, 0x45, 0x5A, 0x03, 0x31, 0x62, 0x00, 0xA4, 0x00, 0x06, 0x09, 0x88, 0x11, 
-    0xEA, 0x11, 0xC9, 0x11, 0x88, 0x11, 0x67, 0x19, 0x67, 0x19, 0x25, 0x19, 0xE4, 0x18, 0xA3, 0x10, 
-    0x62, 0x08, 0x61, 0x10, 0xE1, 0x38, 0x42, 0x49, 0x83, 0x59, 0xA3, 0x59, 0x63, 0x51, 0x02, 0x39, 
-    0xC2, 0x28, 0xA2, 0x20, 0xC3, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x4A, 0xF6, 0xBD, 0x75, 0xAD, 0x95, 0xAD, 0x94, 0xB5, 0x34, 0xAD, 
-    0x31, 0x84, 0xD0, 0x73, 0x31, 0x84, 0xEC, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x08, 0x83, 0x51, 0x62, 0x51, 0xE2, 0x38, 0x40, 0x18, 0x05, 0x11, 0x4C, 0x1A, 
-    0x4C, 0x1A, 0x4C, 0x1A, 0x0B, 0x1A, 0x0B, 0x1A, 0x2B, 0x1A, 0x0B, 0x1A, 0xCA, 0x11, 0x47, 0x11, 
-    0x25, 0x21, 0x66, 0x19, 0xE4, 0x10, 0xE5, 0x08, 0x47, 0x11, 0x88, 0x11, 0xEA, 0x11, 0xEA, 0x11, 
-    0xCA, 0x19, 0xCA, 0x19, 0x88, 0x11, 0x26, 0x09, 0x05, 0x11, 0xE5, 0x10, 0xC4, 0x10, 0x83, 0x08, 
-    0x62, 0x08, 0x41, 0x08, 0x61, 0x10, 0xE2, 0x30, 0x02, 0x39, 0x42, 0x49, 0x42, 0x49, 0xC2, 0x28, 
-    0x61, 0x10, 0xC3, 0x28, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x42, 0x58, 0xC6, 0xD6, 0xB5, 0xF6, 0xB5, 0xD6, 0xB5, 0xD6, 0xB5, 
-    0x95, 0xAD, 0xD3, 0x94, 0x32, 0x84, 0xD1, 0x73, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x41, 0xA3, 0x59, 0x02, 0x41, 0x60, 0x20, 0x25, 0x11, 0x6D, 0x22, 
-    0x2B, 0x22, 0xEA, 0x19, 0x0B, 0x1A, 0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x19, 0xCA, 0x11, 
-    0x87, 0x19, 0x0A, 0x22, 0xC8, 0x21, 0x88, 0x21, 0xC9, 0x11, 0xEA, 0x19, 0xC9, 0x11, 0xA9, 0x11, 
-    0xA9, 0x11, 0x46, 0x11, 0xE5, 0x08, 0xC5, 0x08, 0xC4, 0x08, 0xA3, 0x08, 0x83, 0x08, 0x83, 0x08, 
-    0x83, 0x08, 0x62, 0x08, 0xA3, 0x08, 0xE4, 0x18, 0x81, 0x20, 0xE2, 0x38, 0x22, 0x39, 0xC2, 0x28, 
-    0xC2, 0x28, 0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0x58, 0xC6, 0x37, 0xBE, 0x17, 0xBE, 0x17, 0xBE, 0xF7, 0xB5, 
-    0xF7, 0xBD, 0x18, 0xBE, 0xD7, 0xB5, 0xB8, 0xAD, 0x4E, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0xC3, 0x61, 0x42, 0x49, 0x81, 0x28, 0xC3, 0x10, 0x4C, 0x22, 
-    0x6D, 0x22, 0x4C, 0x1A, 0xA9, 0x11, 0x88, 0x11, 0xA9, 0x19, 0xA8, 0x19, 0xC9, 0x19, 0xC9, 0x19, 
-    0x87, 0x19, 0xA8, 0x21, 0x87, 0x19, 0x87, 0x19, 0xA9, 0x11, 0x88, 0x11, 0x88, 0x11, 0x67, 0x11, 
-    0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0xC4, 0x08, 0xA3, 0x08, 0xC4, 0x08, 0x06, 0x09, 0xC5, 0x08, 
-    0xC4, 0x08, 0x83, 0x08, 0xE5, 0x10, 0x61, 0x08, 0x00, 0x00, 0x20, 0x08, 0x61, 0x10, 0x81, 0x18, 
-    0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x9D, 0x3B, 0xDF, 0xDA, 0xCE, 0xBA, 0xCE, 0x9A, 0xCE, 
-    0x59, 0xC6, 0xF7, 0xB5, 0x55, 0xA5, 0xD3, 0x94, 0x6D, 0x6B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x51, 0x82, 0x59, 0xA1, 0x30, 0xA2, 0x10, 0x6D, 0x22, 
-    0x6D, 0x22, 0x2C, 0x1A, 0x2B, 0x1A, 0x88, 0x11, 0x06, 0x11, 0x26, 0x11, 0x47, 0x11, 0x46, 0x11, 
-    0x26, 0x19, 0x46, 0x21, 0x05, 0x11, 0x05, 0x19, 0x06, 0x11, 0x05, 0x11, 0xE5, 0x10, 0xE5, 0x10, 
-    0xE5, 0x08, 0xE5, 0x08, 0xC4, 0x08, 0x06, 0x11, 0x67, 0x11, 0x47, 0x11, 0xE5, 0x08, 0xC4, 0x08, 
-    0xC4, 0x08, 0xA4, 0x08, 0x05, 0x11, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x31, 0x95, 0xAD, 0x0B, 0x5B, 0x08, 0x3A, 0xA6, 0x31, 
-    0x45, 0x21, 0xA2, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x28, 0xA3, 0x59, 0xE1, 0x38, 0xA2, 0x18, 0x4C, 0x22, 
-    0xCF, 0x2A, 0x8D, 0x22, 0x0B, 0x1A, 0xCA, 0x19, 0x47, 0x11, 0xE5, 0x08, 0xC4, 0x08, 0xA4, 0x08, 
-    0xC4, 0x08, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xE4, 0x18, 0xC4, 0x10, 0xA4, 0x10, 0xA3, 0x08, 
-    0xA3, 0x08, 0xC4, 0x08, 0x26, 0x09, 0x47, 0x11, 0x27, 0x11, 0x47, 0x11, 0x47, 0x11, 0x26, 0x09, 
-    0x05, 0x09, 0xE5, 0x08, 0x05, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x82, 0x51, 0x22, 0x49, 0x81, 0x20, 0xA9, 0x19, 
-    0x8E, 0x22, 0x6D, 0x22, 0xCA, 0x19, 0x88, 0x11, 0x47, 0x11, 0xE5, 0x08, 0xA3, 0x08, 0x83, 0x08, 
-    0x62, 0x08, 0x62, 0x08, 0xA3, 0x10, 0xA2, 0x10, 0x82, 0x10, 0x62, 0x10, 0x82, 0x08, 0x83, 0x08, 
-    0xE5, 0x08, 0x47, 0x11, 0xA9, 0x11, 0xEA, 0x19, 0xEB, 0x19, 0xCA, 0x11, 0x88, 0x11, 0x26, 0x11, 
-    0x06, 0x09, 0xE5, 0x10, 0x05, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x49, 0x04, 0x62, 0x02, 0x39, 0x29, 0x3A, 
-    0x6D, 0x1A, 0x8D, 0x22, 0x6D, 0x1A, 0xA9, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x11, 0x05, 0x09, 
-    0x82, 0x08, 0xA3, 0x10, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0xE5, 0x08, 
-    0xE5, 0x08, 0xA9, 0x11, 0x2B, 0x1A, 0x0B, 0x1A, 0xEB, 0x19, 0xA9, 0x11, 0x68, 0x11, 0x26, 0x11, 
-    0xE5, 0x08, 0xE5, 0x10, 0xE4, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x43, 0x41, 0x22, 0x39, 0x0D, 0x8C, 
-    0xAD, 0x32, 0x8D, 0x22, 0x8D, 0x22, 0x6D, 0x1A, 0x4C, 0x1A, 0xCA, 0x11, 0x26, 0x09, 0xA3, 0x08, 
-    0xA4, 0x08, 0xE4, 0x18, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x68, 0x11, 
-    0xCA, 0x11, 0xCA, 0x19, 0xEA, 0x19, 0x4C, 0x1A, 0x0B, 0x1A, 0xA9, 0x11, 0xA9, 0x11, 0x26, 0x11, 
-    0xE5, 0x08, 0xE5, 0x10, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x20, 0x43, 0x29, 
-    0x6B, 0x3A, 0x8D, 0x22, 0x2B, 0x1A, 0x88, 0x11, 0x06, 0x11, 0xA4, 0x08, 0xC4, 0x08, 0xE5, 0x08, 
-    0xC4, 0x10, 0xE4, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x08, 
-    0x88, 0x11, 0x0B, 0x1A, 0x4D, 0x1A, 0x6D, 0x1A, 0x2C, 0x1A, 0xEB, 0x19, 0x88, 0x11, 0x26, 0x11, 
-    0xE5, 0x08, 0x05, 0x11, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0x4C, 0x2A, 0x6D, 0x22, 0x0B, 0x1A, 0x26, 0x11, 0xC4, 0x08, 0xC4, 0x08, 0xC4, 0x08, 0xA3, 0x08, 
-    0xC4, 0x10, 0x05, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 
-    0x88, 0x11, 0x68, 0x11, 0xA9, 0x11, 0x2B, 0x1A, 0x2B, 0x1A, 0x88, 0x11, 0x06, 0x11, 0x05, 0x11, 
-    0x05, 0x09, 0x05, 0x11, 0xC4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x22, 0x39, 
-    0x2B, 0x22, 0xAE, 0x2A, 0x4C, 0x22, 0x67, 0x11, 0x47, 0x11, 0x88, 0x11, 0x88, 0x11, 0x06, 0x09, 
-    0xA4, 0x08, 0xC4, 0x10, 0xE3, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0x87, 0x21, 0x2C, 0x1A, 0x2C, 0x1A, 0x2C, 0x1A, 0xEA, 0x19, 0x88, 0x11, 0x47, 0x11, 0x67, 0x11, 
-    0x26, 0x09, 0xC5, 0x08, 0xE4, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x41, 0x60, 0x18, 
-    0x05, 0x09, 0x6D, 0x2A, 0x6D, 0x22, 0x4C, 0x1A, 0x0B, 0x1A, 0x88, 0x11, 0x05, 0x11, 0xC3, 0x20, 
-    0xC2, 0x28, 0xA2, 0x20, 0x03, 0x31, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x41, 
-    0xA3, 0x10, 0x06, 0x09, 0xA9, 0x11, 0x2C, 0x1A, 0x4C, 0x1A, 0x0A, 0x1A, 0xEA, 0x19, 0x88, 0x11, 
-    0xC4, 0x08, 0x83, 0x08, 0xA3, 0x10, 0x61, 0x18, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31, 0xC1, 0x30, 
-    0xC5, 0x00, 0xA9, 0x19, 0x26, 0x11, 0xC4, 0x08, 0xA3, 0x08, 0x03, 0x39, 0x42, 0x49, 0xE2, 0x38, 
-    0xE2, 0x38, 0x02, 0x39, 0x03, 0x31, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x22, 0x41, 
-    0x83, 0x49, 0x66, 0x29, 0x27, 0x09, 0x68, 0x11, 0x88, 0x19, 0xEA, 0x19, 0x67, 0x11, 0xA3, 0x08, 
-    0x82, 0x08, 0x83, 0x00, 0x41, 0x08, 0xC2, 0x28, 0xC2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0xA3, 0x59, 
-    0xE5, 0x10, 0x2C, 0x1A, 0xCA, 0x11, 0x66, 0x21, 0x63, 0x49, 0x42, 0x49, 0xE2, 0x38, 0xA1, 0x28, 
-    0xC1, 0x30, 0x02, 0x39, 0xE2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x30, 
-    0x83, 0x59, 0x04, 0x6A, 0xE5, 0x49, 0x67, 0x19, 0xAA, 0x11, 0x88, 0x19, 0xC4, 0x08, 0xC4, 0x08, 
-    0xC4, 0x00, 0x82, 0x10, 0xE2, 0x30, 0x03, 0x31, 0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x51, 
-    0x43, 0x41, 0xC4, 0x00, 0xA7, 0x31, 0x63, 0x51, 0x22, 0x49, 0xE1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 
-    0xE2, 0x38, 0x03, 0x39, 0xC2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x20, 
-    0x43, 0x49, 0x42, 0x51, 0xC3, 0x61, 0xC4, 0x59, 0x04, 0x21, 0xA4, 0x00, 0xE5, 0x08, 0xC5, 0x08, 
-    0xA2, 0x10, 0x02, 0x39, 0xE2, 0x30, 0xE3, 0x30, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x39, 
-    0xE4, 0x69, 0x22, 0x39, 0x42, 0x49, 0x42, 0x51, 0x42, 0x51, 0xE2, 0x38, 0xC1, 0x30, 0xC1, 0x30, 
-    0xE2, 0x30, 0x43, 0x41, 0xA2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0x22, 0x41, 0x42, 0x51, 0x83, 0x59, 0xA3, 0x59, 0xC4, 0x61, 0x23, 0x31, 0x42, 0x00, 0x62, 0x10, 
-    0x22, 0x41, 0xE1, 0x30, 0x02, 0x31, 0xE3, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x18, 
-    0x24, 0x6A, 0xA3, 0x59, 0x83, 0x59, 0x62, 0x59, 0x22, 0x49, 0x02, 0x41, 0xC2, 0x30, 0xE2, 0x38, 
-    0xC2, 0x28, 0x44, 0x39, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC2, 0x30, 0x62, 0x51, 0x62, 0x51, 0x83, 0x59, 0x83, 0x59, 0xA3, 0x59, 0x02, 0x31, 0x02, 0x39, 
-    0xE1, 0x30, 0xC2, 0x30, 0x03, 0x39, 0xC2, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0xE4, 0x61, 0xE4, 0x61, 0xA3, 0x59, 0x62, 0x51, 0x22, 0x41, 0x02, 0x41, 0xE2, 0x38, 0xE2, 0x38, 
-    0xE2, 0x28, 0x66, 0x31, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x20, 0x63, 0x51, 0x83, 0x59, 0xC3, 0x61, 0xA3, 0x61, 0x62, 0x51, 0x63, 0x51, 0xE2, 0x30, 
-    0xC2, 0x30, 0xE2, 0x38, 0x03, 0x39, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 
-    0x45, 0x6A, 0x66, 0x72, 0x04, 0x62, 0x63, 0x51, 0x22, 0x41, 0x22, 0x41, 0x02, 0x41, 0xE2, 0x38, 
-    0x03, 0x31, 0x24, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x18, 0x83, 0x59, 0x62, 0x59, 0xA3, 0x59, 0x83, 0x59, 0x82, 0x59, 0x62, 0x51, 0x02, 0x41, 
-    0xE2, 0x38, 0xE2, 0x30, 0x23, 0x39, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xA3, 0x51, 0x25, 0x62, 0xC4, 0x61, 0xC3, 0x59, 0xA3, 0x59, 0x42, 0x49, 0xE2, 0x38, 0xC1, 0x30, 
-    0xC2, 0x28, 0xE4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0xC3, 0x61, 0xE4, 0x61, 0xC4, 0x59, 0xA3, 0x59, 0xC3, 0x61, 0x83, 0x59, 0x02, 0x41, 
-    0xE2, 0x30, 0xC1, 0x30, 0x03, 0x31, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x43, 0x39, 0x63, 0x49, 0x02, 0x41, 0x22, 0x41, 0x22, 0x49, 0xC2, 0x30, 0x81, 0x20, 0xA1, 0x20, 
-    0xA2, 0x18, 0x66, 0x29, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x41, 0x05, 0x6A, 0x25, 0x62, 0xC8, 0x7A, 0xC8, 0x7A, 0xE4, 0x61, 0x43, 0x49, 
-    0x24, 0x39, 0x04, 0x29, 0x24, 0x29, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 
-    0x05, 0x62, 0x05, 0x62, 0xA4, 0x51, 0x42, 0x41, 0xC1, 0x30, 0xA1, 0x28, 0xC1, 0x28, 0xC1, 0x28, 
-    0x03, 0x29, 0x87, 0x31, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x31, 0x63, 0x51, 0x83, 0x51, 0x66, 0x72, 0x05, 0x62, 0x02, 0x41, 0xC1, 0x30, 
-    0xE2, 0x30, 0x04, 0x31, 0x45, 0x31, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x39, 
-    0x68, 0x62, 0xA7, 0x72, 0xE4, 0x59, 0x63, 0x49, 0x42, 0x49, 0xE2, 0x30, 0xC1, 0x28, 0xA1, 0x28, 
-    0x81, 0x20, 0x45, 0x29, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x83, 0x51, 0xA3, 0x59, 0x04, 0x62, 0x83, 0x51, 0xC1, 0x30, 0xE2, 0x30, 0xA1, 0x28, 
-    0x61, 0x20, 0x60, 0x20, 0xA1, 0x28, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x29, 0x26, 0x5A, 
-    0xE5, 0x59, 0xE5, 0x59, 0xA4, 0x59, 0x23, 0x41, 0xE2, 0x30, 0xA1, 0x28, 0x81, 0x18, 0x81, 0x18, 
-    0x81, 0x18, 0x24, 0x31, 0xA2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x30, 0x82, 0x51, 0xA3, 0x59, 0xE4, 0x61, 0xA4, 0x59, 0xA4, 0x59, 0x22, 0x41, 
-    0xE2, 0x38, 0xC2, 0x30, 0x03, 0x31, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x31, 0x67, 0x6A, 0x25, 0x6A, 
-    0x24, 0x72, 0xC3, 0x61, 0x62, 0x51, 0x22, 0x41, 0xE2, 0x38, 0xE2, 0x30, 0xC1, 0x28, 0xC1, 0x28, 
-    0xA1, 0x28, 0x03, 0x39, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x30, 0x43, 0x49, 0x22, 0x41, 0xA4, 0x51, 0xC4, 0x59, 0xC4, 0x59, 0x42, 0x49, 
-    0xE2, 0x38, 0xC2, 0x28, 0x04, 0x31, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x85, 0x41, 0x66, 0x6A, 0xE4, 0x61, 0xC7, 0x7A, 
-    0x46, 0x6A, 0x83, 0x59, 0x62, 0x51, 0x02, 0x39, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x28, 
-    0xA1, 0x28, 0x02, 0x31, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x22, 0x39, 0x63, 0x51, 0x83, 0x51, 0xE4, 0x61, 0x66, 0x72, 0x04, 0x62, 0x63, 0x51, 
-    0x02, 0x39, 0xE2, 0x30, 0x24, 0x31, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x08, 0x25, 0x21, 0x29, 0x4A, 0x49, 0x5A, 0xE5, 0x59, 0x46, 0x6A, 0x05, 0x5A, 
-    0xC4, 0x59, 0x83, 0x51, 0x02, 0x41, 0xE2, 0x30, 0xA1, 0x28, 0xA1, 0x28, 0xC1, 0x30, 0xA1, 0x28, 
-    0x81, 0x20, 0xC2, 0x28, 0xA2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x02, 0x39, 0x83, 0x59, 0xA3, 0x59, 0x04, 0x6A, 0x45, 0x72, 0x46, 0x6A, 0xC4, 0x59, 
-    0x63, 0x49, 0x43, 0x41, 0x45, 0x31, 0x67, 0x31, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x44, 0x39, 0x06, 0x5A, 0x07, 0x5A, 0xE7, 0x49, 0xC6, 0x49, 0xA5, 0x49, 0xA4, 0x51, 0x05, 0x6A, 
-    0x43, 0x49, 0x42, 0x49, 0x02, 0x39, 0xA1, 0x28, 0xA1, 0x28, 0x81, 0x20, 0x81, 0x20, 0x81, 0x20, 
-    0x81, 0x20, 0xC2, 0x28, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE2, 0x30, 0x83, 0x59, 0xA3, 0x59, 0x03, 0x6A, 0x86, 0x7A, 0x86, 0x72, 0xC4, 0x59, 
-    0x83, 0x51, 0x43, 0x49, 0x44, 0x39, 0x87, 0x31, 0x05, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x39, 
-    0x07, 0x8B, 0x07, 0x8B, 0x65, 0x7A, 0xE3, 0x61, 0x83, 0x51, 0x63, 0x49, 0x22, 0x41, 0x22, 0x41, 
-    0x83, 0x51, 0x02, 0x39, 0xC1, 0x30, 0xC1, 0x28, 0x81, 0x20, 0x81, 0x20, 0x81, 0x20, 0x81, 0x20, 
-    0xA1, 0x20, 0xC2, 0x28, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xC1, 0x28, 0x63, 0x51, 0x83, 0x59, 0xE3, 0x69, 0x45, 0x72, 0x87, 0x72, 0xC4, 0x59, 
-    0x83, 0x51, 0x63, 0x49, 0x43, 0x49, 0x44, 0x39, 0x86, 0x39, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0x59, 
-    0xC6, 0x8A, 0x8A, 0x93, 0x07, 0x8B, 0x64, 0x7A, 0xC3, 0x61, 0x62, 0x51, 0x22, 0x41, 0xE2, 0x38, 
-    0x02, 0x41, 0xE2, 0x38, 0xA1, 0x20, 0xA1, 0x20, 0x81, 0x20, 0x40, 0x10, 0x20, 0x10, 0xC1, 0x28, 
-    0xC1, 0x28, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xE1, 0x30, 0x83, 0x59, 0x42, 0x49, 0xE3, 0x69, 0x24, 0x6A, 0xE4, 0x61, 0xC4, 0x59, 
-    0xA4, 0x59, 0x83, 0x51, 0xA5, 0x49, 0xC7, 0x41, 0xE8, 0x49, 0x45, 0x29, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x28, 0x25, 0x6A, 
-    0xA3, 0x59, 0xC3, 0x61, 0x83, 0x51, 0x82, 0x59, 0x62, 0x51, 0x22, 0x41, 0xE2, 0x38, 0xE2, 0x30, 
-    0xE2, 0x30, 0xA1, 0x28, 0xA1, 0x20, 0x81, 0x20, 0x40, 0x18, 0x41, 0x10, 0xC2, 0x28, 0xA1, 0x20, 
-    0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x20, 0x83, 0x59, 0xC2, 0x30, 0xE3, 0x61, 0x24, 0x72, 0x04, 0x6A, 0xC3, 0x59, 
-    0xA3, 0x59, 0x83, 0x51, 0xA4, 0x51, 0xC7, 0x49, 0x09, 0x42, 0x2A, 0x4A, 0xA2, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0x04, 0x5A, 
-    0x66, 0x6A, 0xE5, 0x59, 0x63, 0x49, 0x02, 0x41, 0xE2, 0x38, 0xC2, 0x30, 0xA1, 0x28, 0xA1, 0x28, 
-    0xC1, 0x28, 0xA1, 0x28, 0x81, 0x20, 0xA2, 0x20, 0x44, 0x39, 0xC5, 0x49, 0x64, 0x39, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA1, 0x28, 0xA1, 0x28, 0xE3, 0x61, 0x04, 0x72, 0x24, 0x72, 0x65, 0x7A, 
-    0x65, 0x72, 0xA7, 0x7A, 0x04, 0x62, 0x62, 0x51, 0x45, 0x39, 0x87, 0x39, 0x45, 0x31, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x42, 0x41, 0xE5, 0x59, 0xA4, 0x51, 0x83, 0x51, 0x43, 0x41, 0x23, 0x41, 0xE2, 0x30, 0xE2, 0x30, 
-    0xE2, 0x30, 0xE2, 0x30, 0xE2, 0x30, 0x23, 0x31, 0x23, 0x29, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0xC3, 0x61, 0x03, 0x6A, 0x44, 0x72, 0x45, 0x72, 
-    0x29, 0x83, 0xEC, 0x93, 0xE4, 0x69, 0x62, 0x51, 0x02, 0x39, 0xE2, 0x30, 0x44, 0x39, 0x41, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xC2, 0x20, 0x23, 0x31, 0x43, 0x39, 0x43, 0x39, 0x23, 0x39, 0x02, 0x31, 0xE2, 0x28, 
-    0xC2, 0x28, 0xC2, 0x20, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0xC4, 0x59, 0xA3, 0x59, 0xC3, 0x61, 0xE3, 0x61, 
-    0xC3, 0x61, 0x62, 0x51, 0x42, 0x51, 0x22, 0x41, 0xC2, 0x30, 0xA2, 0x28, 0x24, 0x31, 0xC2, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x40, 0x08, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x30, 0xE4, 0x61, 0xC4, 0x59, 0xA4, 0x59, 
-    0xA4, 0x59, 0xA5, 0x51, 0x64, 0x49, 0x22, 0x41, 0xE2, 0x38, 0xE2, 0x30, 0x03, 0x31, 0xE3, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x63, 0x49, 0xE4, 0x59, 
-    0x25, 0x62, 0x05, 0x62, 0x63, 0x49, 0x22, 0x41, 0x02, 0x39, 0x03, 0x39, 0x85, 0x41, 0x27, 0x52, 
-    0xC2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 
-    0xC1, 0x20, 0x02, 0x31, 0x43, 0x39, 0x43, 0x39, 0x64, 0x39, 0xA5, 0x41, 0x64, 0x31, 0xC2, 0x18, 
-    0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-/* LVGL image descriptor */
-const lv_img_dsc_t howdy_img_howdymidget = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 88,
-    .header.h = 128,
-    .data_size = 22528,
-    .data = howdy_img_howdymidget_data,
-};
@@ -1,16 +0,0 @@
-/* Auto-generated LVGL image data from HowdyMidget.png */
-/* Original size: 521x762, Scaled: 88x128 */
-
-#pragma once
-
-#include "lvgl.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-extern const lv_img_dsc_t howdy_img_howdymidget;
-
-#ifdef __cplusplus
-}
-#endif
@@ -1,2068 +0,0 @@
-/* Auto-generated LVGL image data from howdyRight.png */
-/* Original size: 1024x1024, Scaled: 128x128 */
-
-#include "howdy_img_howdyright.h"
-
-/* Image data in RGB565 format */
-static const uint8_t howdy_img_howdyright_data[] = {
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x80, 0x28, 0x80, 0x28, 
-    0xA0, 0x30, 0xA0, 0x30, 0xC1, 0x30, 0x01, 0x39, 0xE1, 0x30, 0xE1, 0x30, 0xA0, 0x20, 0x80, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x40, 0x63, 0xB2, 0x43, 0xA2, 
-    0x83, 0xB2, 0xA3, 0xB2, 0xC3, 0xBA, 0xE5, 0xDB, 0xE5, 0xDB, 0xC5, 0xD3, 0xC5, 0xD3, 0x64, 0xBB, 
-    0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x38, 0x42, 0xBA, 0x22, 0xAA, 
-    0x62, 0xAA, 0x82, 0xAA, 0xA2, 0xB2, 0xE4, 0xD3, 0xE5, 0xD3, 0xE4, 0xD3, 0xE5, 0xD3, 0x64, 0xBB, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x40, 0x01, 0x51, 0x43, 0x59, 0x06, 0x72, 0xE5, 0x69, 
-    0xE5, 0x81, 0xC5, 0x91, 0xE5, 0x91, 0x04, 0xB3, 0x24, 0xBB, 0x04, 0xBB, 0xA4, 0xCB, 0x84, 0xCB, 
-    0xA2, 0x61, 0x62, 0x51, 0xC1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x03, 0x9A, 0x62, 0xBA, 0x06, 0x6A, 0x8B, 0x01, 0xCA, 0x01, 
-    0x0A, 0x31, 0x49, 0x68, 0x69, 0x58, 0x83, 0x81, 0xA2, 0x89, 0xC2, 0x89, 0x24, 0xC3, 0x64, 0xCB, 
-    0x85, 0xD3, 0xE5, 0xE3, 0x43, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x99, 0x41, 0xBA, 0xE4, 0x79, 0xAA, 0x01, 0xEA, 0x01, 
-    0x2A, 0x31, 0x69, 0x68, 0xA9, 0x60, 0x83, 0x91, 0xC1, 0x99, 0xC2, 0x99, 0x44, 0xCB, 0x85, 0xD3, 
-    0x44, 0xC3, 0x84, 0xD3, 0x02, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x20, 0xA0, 0x30, 0xA1, 0x28, 0x86, 0x59, 0xC6, 0x69, 0x87, 0x51, 0x4A, 0x19, 0x6A, 0x19, 
-    0x0A, 0x49, 0x69, 0x78, 0x89, 0x68, 0xC7, 0x51, 0xE6, 0x59, 0xE6, 0x59, 0xC4, 0xB2, 0xE4, 0xBA, 
-    0x04, 0xBB, 0xA5, 0xD3, 0xA3, 0x9A, 0x01, 0x39, 0x21, 0x39, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0xC1, 0x38, 
-    0xE1, 0x38, 0x01, 0x49, 0x01, 0x41, 0x21, 0x41, 0x41, 0x49, 0x42, 0x49, 0x80, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC2, 0x79, 0x82, 0xBA, 0x05, 0x82, 0x4B, 0x01, 0x8A, 0x01, 0x0A, 0x21, 0x8A, 0x68, 0x8A, 0x58, 
-    0x89, 0x88, 0x89, 0xA8, 0x89, 0x90, 0x2B, 0x02, 0x4C, 0x02, 0x2B, 0x0A, 0x03, 0x8A, 0xE2, 0x91, 
-    0x63, 0xA2, 0xE5, 0xD3, 0xE5, 0xD3, 0xE5, 0xD3, 0x25, 0xEC, 0x83, 0x8A, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x92, 0xE4, 0xC2, 
-    0xC3, 0xBA, 0xE4, 0xC2, 0xC3, 0xBA, 0x64, 0xCB, 0x45, 0xE4, 0x86, 0xF4, 0x23, 0x72, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x81, 0x61, 0xBA, 0xE3, 0x81, 0x6A, 0x01, 0xA9, 0x01, 0x2A, 0x21, 0x8A, 0x58, 0xAA, 0x48, 
-    0x89, 0x80, 0x49, 0xB0, 0x89, 0x98, 0x4B, 0x02, 0x6B, 0x02, 0x4A, 0x0A, 0x02, 0x9A, 0xE1, 0xA1, 
-    0x82, 0xAA, 0x25, 0xD4, 0x04, 0xD4, 0xE4, 0xCB, 0x25, 0xE4, 0x83, 0x8A, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x81, 0xC3, 0xC2, 
-    0xA3, 0xB2, 0xA3, 0xB2, 0x83, 0xB2, 0x23, 0xC3, 0x24, 0xDC, 0x65, 0xEC, 0x02, 0x6A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 
-    0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x40, 0x18, 0x40, 0x18, 
-    0x44, 0x49, 0xC5, 0x69, 0x86, 0x51, 0x2A, 0x19, 0x4A, 0x19, 0x29, 0x41, 0xE9, 0x80, 0xE9, 0x70, 
-    0xE9, 0x70, 0x09, 0x79, 0x09, 0x69, 0x8A, 0x31, 0x8A, 0x31, 0xAA, 0x31, 0x05, 0x72, 0x05, 0x72, 
-    0x45, 0x8A, 0x24, 0xC3, 0x25, 0xBB, 0x24, 0xBB, 0x84, 0xCB, 0x43, 0x82, 0x40, 0x10, 0x40, 0x18, 
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x18, 0x01, 0x18, 0x63, 0x71, 0x44, 0xAA, 
-    0x24, 0x9A, 0x44, 0x9A, 0x44, 0x9A, 0xA4, 0xA2, 0x45, 0xB3, 0x85, 0xBB, 0x83, 0x92, 0xA2, 0x69, 
-    0x82, 0x61, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 
-    0x63, 0xAA, 0x42, 0xAA, 0x83, 0xB2, 0x04, 0xC3, 0x04, 0xC3, 0x24, 0xC3, 0x44, 0xC3, 0x85, 0xDB, 
-    0x41, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 0x22, 0xA2, 0xE3, 0x91, 
-    0x49, 0x09, 0x4A, 0x01, 0x2A, 0x09, 0xAA, 0x60, 0xAA, 0x58, 0x09, 0x89, 0x68, 0xB9, 0x27, 0xC1, 
-    0xA9, 0x49, 0x4B, 0x02, 0x4B, 0x02, 0x49, 0x78, 0x08, 0xA0, 0x49, 0x80, 0x4B, 0x02, 0x6C, 0x02, 
-    0x0A, 0x22, 0x04, 0x91, 0x25, 0x81, 0x43, 0x89, 0x62, 0x91, 0x82, 0x91, 0xE2, 0x99, 0x02, 0xA2, 
-    0xC1, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x38, 0x4A, 0xA0, 0x29, 0x98, 0x48, 0x68, 0x28, 0x58, 
-    0x48, 0x58, 0x88, 0x28, 0x88, 0x20, 0x68, 0x20, 0x67, 0x28, 0x48, 0x18, 0x65, 0x92, 0xA4, 0xDB, 
-    0x45, 0xD3, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 
-    0x62, 0xAA, 0x62, 0xAA, 0xA3, 0xB2, 0x24, 0xCB, 0x24, 0xCB, 0x44, 0xCB, 0x44, 0xCB, 0xA4, 0xDB, 
-    0x21, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x40, 0x42, 0xAA, 0x02, 0x92, 
-    0x69, 0x11, 0x69, 0x01, 0x49, 0x11, 0xAA, 0x58, 0xAA, 0x50, 0xE9, 0x80, 0x48, 0xC1, 0x08, 0xC1, 
-    0xA9, 0x49, 0x6B, 0x02, 0x4B, 0x02, 0x49, 0x78, 0x08, 0xA0, 0x29, 0x80, 0x4B, 0x02, 0x6B, 0x02, 
-    0x09, 0x2A, 0x24, 0xA1, 0x24, 0x99, 0x63, 0x99, 0x82, 0x91, 0x82, 0x99, 0xC2, 0xA1, 0x02, 0xB2, 
-    0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x03, 0x38, 0x2A, 0xA8, 0x29, 0x98, 0x48, 0x70, 0x27, 0x60, 
-    0x48, 0x60, 0x67, 0x28, 0x67, 0x28, 0x67, 0x28, 0x87, 0x28, 0x68, 0x18, 0x45, 0x92, 0x63, 0xD3, 
-    0x24, 0xCB, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x20, 0x80, 0x28, 0xA1, 0x30, 
-    0xC4, 0x91, 0xC4, 0x91, 0x04, 0x9A, 0x64, 0xA2, 0x64, 0xA2, 0x85, 0xAA, 0x85, 0xAA, 0xC5, 0xBA, 
-    0x82, 0x61, 0xA0, 0x28, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x30, 0xA2, 0x81, 0x82, 0x71, 
-    0x28, 0x19, 0x09, 0x11, 0x09, 0x21, 0xAA, 0x50, 0xAA, 0x48, 0x09, 0x61, 0x68, 0x89, 0x49, 0x81, 
-    0x49, 0x49, 0x8A, 0x31, 0x8A, 0x31, 0xE9, 0x58, 0xC9, 0x68, 0xE9, 0x58, 0xCA, 0x31, 0xCA, 0x41, 
-    0xA9, 0x49, 0x87, 0x71, 0x88, 0x69, 0x85, 0x81, 0x62, 0x99, 0x83, 0x91, 0xC5, 0x81, 0x05, 0x8A, 
-    0xE3, 0x40, 0x01, 0x18, 0x01, 0x18, 0x24, 0x40, 0x49, 0x90, 0x49, 0x80, 0x48, 0x60, 0x47, 0x58, 
-    0x68, 0x58, 0xE9, 0x20, 0x09, 0x19, 0xE9, 0x20, 0x87, 0x38, 0x68, 0x28, 0x27, 0x7A, 0x26, 0xB3, 
-    0xC5, 0xAA, 0x82, 0x69, 0x62, 0x61, 0xC1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x81, 0x02, 0xA2, 0x64, 0x79, 
-    0x28, 0x50, 0x48, 0x58, 0x67, 0x48, 0x65, 0x38, 0x65, 0x38, 0x89, 0x48, 0x8B, 0x50, 0xAA, 0x58, 
-    0x43, 0xAA, 0xA3, 0xBA, 0xC2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x82, 0x30, 0x82, 0x28, 
-    0xA7, 0x30, 0x89, 0x38, 0x88, 0x38, 0xA9, 0x30, 0x89, 0x38, 0x2A, 0x19, 0xAA, 0x01, 0xCA, 0x01, 
-    0xC9, 0x50, 0x08, 0xA0, 0x08, 0x90, 0xEA, 0x11, 0x4B, 0x02, 0x4B, 0x02, 0x29, 0x91, 0xC8, 0xC8, 
-    0x6A, 0x81, 0x4D, 0x0A, 0x4E, 0x0A, 0xA7, 0x61, 0x41, 0x99, 0x84, 0x79, 0x2D, 0x1A, 0x4D, 0x12, 
-    0xAB, 0x41, 0x29, 0x98, 0x49, 0x98, 0x48, 0x68, 0x67, 0x48, 0x68, 0x50, 0x86, 0x38, 0x66, 0x38, 
-    0xE8, 0x28, 0x4E, 0x12, 0x6E, 0x12, 0xCC, 0x29, 0x48, 0x58, 0x48, 0x60, 0xAA, 0x21, 0x6C, 0x02, 
-    0xCA, 0x31, 0xE4, 0xCA, 0x65, 0xDB, 0xE3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x81, 0xE1, 0x99, 0x43, 0x71, 
-    0x27, 0x60, 0x47, 0x60, 0x66, 0x48, 0x85, 0x38, 0x85, 0x38, 0xA9, 0x50, 0x8A, 0x60, 0xC9, 0x60, 
-    0x43, 0xA2, 0xA2, 0xBA, 0xC2, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA2, 0x38, 0xA1, 0x30, 
-    0xA7, 0x28, 0x89, 0x30, 0x89, 0x30, 0xA9, 0x30, 0x89, 0x38, 0x2A, 0x19, 0xCA, 0x01, 0xCA, 0x01, 
-    0xA9, 0x58, 0x08, 0xA0, 0x08, 0x90, 0xEB, 0x19, 0x4B, 0x02, 0x2B, 0x02, 0x29, 0x91, 0xE8, 0xC8, 
-    0x69, 0x89, 0x2D, 0x12, 0x2D, 0x12, 0xA7, 0x61, 0x41, 0x99, 0x84, 0x79, 0x2D, 0x1A, 0x4D, 0x0A, 
-    0xAC, 0x39, 0x09, 0xA0, 0x49, 0xA0, 0x49, 0x70, 0x68, 0x50, 0x68, 0x50, 0x86, 0x38, 0x66, 0x38, 
-    0xE8, 0x28, 0x4E, 0x12, 0x6E, 0x12, 0xCC, 0x29, 0x48, 0x58, 0x28, 0x60, 0xAA, 0x21, 0xAC, 0x02, 
-    0x0A, 0x32, 0xA4, 0xC2, 0x04, 0xCB, 0xC3, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x71, 0x63, 0x89, 0x05, 0x69, 
-    0xA8, 0x40, 0xA8, 0x48, 0x87, 0x50, 0x66, 0x50, 0x86, 0x50, 0xE9, 0x48, 0x0A, 0x41, 0x0A, 0x51, 
-    0xC4, 0x99, 0x04, 0xA2, 0xA3, 0x81, 0xA0, 0x28, 0xA0, 0x30, 0x81, 0x28, 0xA2, 0x30, 0xA1, 0x30, 
-    0xA5, 0x30, 0x87, 0x38, 0xA7, 0x38, 0xA8, 0x40, 0x87, 0x48, 0x09, 0x29, 0x6A, 0x11, 0x8A, 0x11, 
-    0xE9, 0x48, 0x69, 0x78, 0x69, 0x70, 0x6A, 0x29, 0xAA, 0x19, 0xAA, 0x11, 0x49, 0x71, 0x29, 0x91, 
-    0x69, 0x71, 0x0A, 0x42, 0x2A, 0x42, 0xA6, 0x71, 0x41, 0x91, 0x63, 0x81, 0xEA, 0x41, 0xEA, 0x39, 
-    0x69, 0x59, 0x29, 0x90, 0x49, 0x90, 0x68, 0x70, 0x67, 0x50, 0x87, 0x50, 0x86, 0x40, 0x85, 0x40, 
-    0xC7, 0x38, 0xCC, 0x19, 0xED, 0x19, 0x8C, 0x29, 0x68, 0x48, 0x68, 0x50, 0x4A, 0x31, 0xEB, 0x19, 
-    0xAA, 0x41, 0xC4, 0xBA, 0x24, 0xCB, 0xE3, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x48, 0x28, 0x58, 0x68, 0x48, 
-    0xAA, 0x01, 0xCA, 0x01, 0xEA, 0x50, 0x09, 0xA0, 0x09, 0x98, 0xAB, 0x29, 0x6B, 0x02, 0xCA, 0x19, 
-    0x28, 0x78, 0x49, 0x68, 0x07, 0x79, 0x62, 0xAA, 0x63, 0xB2, 0xC2, 0x79, 0xA1, 0x20, 0xC1, 0x30, 
-    0xC2, 0x38, 0xA2, 0x38, 0xA2, 0x40, 0xA2, 0x58, 0xA2, 0x58, 0x86, 0x50, 0x47, 0x50, 0x47, 0x60, 
-    0x29, 0x19, 0xAA, 0x01, 0xAA, 0x01, 0x67, 0x50, 0x26, 0x68, 0x67, 0x50, 0xCA, 0x01, 0xAA, 0x01, 
-    0xC7, 0x39, 0x42, 0xBA, 0x42, 0xB2, 0x83, 0x99, 0x42, 0x89, 0x43, 0x91, 0x23, 0x91, 0x23, 0x99, 
-    0xE5, 0x88, 0x69, 0x70, 0x69, 0x78, 0x87, 0x58, 0x84, 0x40, 0x84, 0x48, 0x84, 0x48, 0x83, 0x50, 
-    0x84, 0x50, 0xA9, 0x30, 0xCA, 0x30, 0xC9, 0x28, 0xC9, 0x28, 0xC9, 0x28, 0xCA, 0x38, 0xAB, 0x38, 
-    0x49, 0x59, 0x04, 0xD4, 0x65, 0xE4, 0xA3, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x50, 0x27, 0x68, 0x68, 0x50, 
-    0xAA, 0x01, 0xCA, 0x01, 0xE9, 0x50, 0x09, 0xA0, 0x09, 0xA0, 0xAB, 0x29, 0x6B, 0x02, 0xEA, 0x19, 
-    0x28, 0x88, 0x49, 0x70, 0xE7, 0x80, 0x42, 0xA2, 0x62, 0xAA, 0xA2, 0x71, 0x81, 0x18, 0xC1, 0x28, 
-    0xA1, 0x30, 0xA1, 0x38, 0xA2, 0x40, 0xA3, 0x58, 0xA2, 0x58, 0x86, 0x50, 0x68, 0x50, 0x47, 0x60, 
-    0x09, 0x19, 0xAA, 0x01, 0x8A, 0x01, 0x68, 0x50, 0x07, 0x60, 0x68, 0x50, 0xAA, 0x01, 0x8B, 0x01, 
-    0xC7, 0x49, 0x62, 0xB2, 0x63, 0xA2, 0xA3, 0x99, 0x42, 0x89, 0x63, 0x91, 0x43, 0x91, 0x43, 0x91, 
-    0xE5, 0x88, 0x49, 0x70, 0x69, 0x78, 0x67, 0x50, 0x64, 0x30, 0x64, 0x38, 0x83, 0x48, 0x83, 0x50, 
-    0x84, 0x48, 0xCA, 0x28, 0xEA, 0x28, 0xC9, 0x28, 0xA9, 0x28, 0xC9, 0x28, 0xCA, 0x38, 0xAB, 0x30, 
-    0x68, 0x61, 0x84, 0xE4, 0xE5, 0xF4, 0xE3, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 0x60, 0x28, 0x61, 0x28, 0x87, 0x40, 0xA8, 0x48, 0xA8, 0x40, 
-    0x4A, 0x19, 0x6A, 0x19, 0xEA, 0x48, 0x89, 0x70, 0x89, 0x70, 0x4A, 0x39, 0xCA, 0x29, 0x6A, 0x31, 
-    0xC9, 0x60, 0xC9, 0x58, 0x28, 0x61, 0xC4, 0x91, 0xC4, 0x99, 0x83, 0x71, 0x02, 0x41, 0x22, 0x49, 
-    0xE3, 0x38, 0xA4, 0x30, 0xA4, 0x38, 0xA3, 0x40, 0xA2, 0x40, 0xA5, 0x40, 0x86, 0x48, 0x66, 0x48, 
-    0xE7, 0x30, 0x47, 0x29, 0x27, 0x29, 0xA6, 0x60, 0x85, 0x68, 0xC6, 0x60, 0xA8, 0x39, 0x88, 0x39, 
-    0xC6, 0x69, 0x23, 0xAA, 0x03, 0xA2, 0x84, 0x91, 0x24, 0x89, 0x24, 0x89, 0x04, 0x79, 0x04, 0x79, 
-    0xC6, 0x70, 0x88, 0x60, 0x68, 0x60, 0xE7, 0x70, 0x26, 0x79, 0x06, 0x71, 0xE6, 0x40, 0xE6, 0x38, 
-    0xC7, 0x38, 0xCA, 0x30, 0xCA, 0x30, 0xA9, 0x30, 0x89, 0x40, 0x88, 0x38, 0xEA, 0x30, 0xEB, 0x28, 
-    0x69, 0x51, 0xA4, 0xCB, 0xE4, 0xD3, 0x63, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x50, 0x22, 0x71, 0x03, 0x69, 0x69, 0x09, 0xAA, 0x01, 0x6A, 0x19, 
-    0x69, 0x68, 0x69, 0x68, 0x2A, 0x31, 0xEA, 0x01, 0xEA, 0x01, 0xA9, 0x60, 0x08, 0xA0, 0x28, 0x88, 
-    0x0B, 0x0A, 0x2B, 0x02, 0x2B, 0x02, 0xC9, 0x50, 0x29, 0x60, 0x67, 0x81, 0x04, 0xC3, 0xE4, 0xCA, 
-    0x08, 0x52, 0xAB, 0x01, 0x69, 0x11, 0xC1, 0x28, 0xC1, 0x20, 0xC1, 0x28, 0xA1, 0x38, 0xA2, 0x30, 
-    0xE2, 0x50, 0x02, 0x81, 0x02, 0x79, 0xC2, 0x91, 0xC2, 0x89, 0xE2, 0x91, 0x43, 0xBA, 0x43, 0xBA, 
-    0x03, 0xAA, 0xA5, 0x91, 0xA5, 0x99, 0x26, 0x89, 0x06, 0x89, 0x06, 0x89, 0x85, 0x40, 0x65, 0x40, 
-    0x85, 0x40, 0xA5, 0x40, 0x65, 0x30, 0x87, 0x91, 0x28, 0xD2, 0xE8, 0xC9, 0x0B, 0x1A, 0x2B, 0x02, 
-    0xCB, 0x11, 0xAA, 0x48, 0xEA, 0x40, 0x89, 0x50, 0x07, 0x70, 0x07, 0x78, 0xAA, 0x21, 0x6B, 0x02, 
-    0xEA, 0x21, 0x03, 0xA2, 0x63, 0xAA, 0xA2, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x48, 0x02, 0x69, 0xE3, 0x60, 0x49, 0x11, 0xAA, 0x01, 0x4A, 0x19, 
-    0x69, 0x60, 0x69, 0x68, 0x2A, 0x31, 0xCA, 0x01, 0xCA, 0x01, 0xA9, 0x60, 0x08, 0xA0, 0x09, 0x88, 
-    0x0B, 0x0A, 0x2B, 0x02, 0x2B, 0x02, 0xE9, 0x50, 0x49, 0x68, 0xA7, 0x89, 0x23, 0xC3, 0x03, 0xD3, 
-    0x28, 0x4A, 0xCB, 0x01, 0x88, 0x09, 0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x28, 0xA2, 0x38, 0xA2, 0x30, 
-    0xE2, 0x50, 0x22, 0x79, 0x22, 0x79, 0xC2, 0x91, 0xE2, 0x91, 0x02, 0x9A, 0x63, 0xB2, 0x43, 0xB2, 
-    0x23, 0xAA, 0xC4, 0x99, 0xC4, 0x99, 0x25, 0x91, 0x06, 0x91, 0x06, 0x91, 0x85, 0x40, 0x64, 0x38, 
-    0x65, 0x38, 0x85, 0x48, 0x45, 0x38, 0x47, 0x91, 0xE8, 0xD1, 0xA7, 0xC9, 0x2A, 0x22, 0x4B, 0x02, 
-    0xEA, 0x09, 0xCA, 0x48, 0xEA, 0x40, 0x89, 0x50, 0x07, 0x78, 0x07, 0x78, 0xAA, 0x19, 0x4B, 0x02, 
-    0xEB, 0x11, 0x23, 0xAA, 0xA2, 0xBA, 0xC2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA1, 0x48, 0x02, 0x69, 0xE3, 0x60, 0x49, 0x11, 0x89, 0x01, 0x4A, 0x19, 
-    0xEB, 0x50, 0xCB, 0x50, 0x4A, 0x29, 0xAA, 0x09, 0xAA, 0x09, 0xC9, 0x50, 0x68, 0x80, 0x89, 0x70, 
-    0xAA, 0x21, 0xAA, 0x19, 0xCA, 0x19, 0xE9, 0x58, 0x49, 0x60, 0x47, 0x81, 0xA4, 0xB2, 0x84, 0xBA, 
-    0xE8, 0x41, 0x8A, 0x01, 0x68, 0x11, 0x02, 0x39, 0x02, 0x39, 0xE2, 0x38, 0xA2, 0x38, 0xA2, 0x30, 
-    0xC3, 0x50, 0xE3, 0x68, 0xE3, 0x68, 0x64, 0x79, 0x64, 0x79, 0x84, 0x79, 0xC4, 0x89, 0xC4, 0x89, 
-    0xA4, 0x89, 0x65, 0x91, 0x65, 0x91, 0x46, 0x79, 0x47, 0x79, 0x47, 0x79, 0xC5, 0x58, 0xC5, 0x60, 
-    0xE6, 0x50, 0xE7, 0x30, 0xC7, 0x28, 0x68, 0x69, 0x08, 0xA2, 0xC8, 0x99, 0xEA, 0x29, 0xCA, 0x21, 
-    0x8A, 0x29, 0x0A, 0x39, 0x2A, 0x31, 0xEA, 0x40, 0x88, 0x60, 0x68, 0x60, 0x89, 0x41, 0x49, 0x32, 
-    0xE9, 0x39, 0xE5, 0x91, 0x25, 0xA2, 0x84, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA1, 0x48, 0x02, 0x69, 0xE2, 0x60, 0x28, 0x09, 0x68, 0x01, 0x8A, 0x09, 
-    0x2E, 0x1A, 0x4E, 0x1A, 0xAC, 0x21, 0x2A, 0x21, 0x2A, 0x21, 0x6A, 0x11, 0xCA, 0x01, 0xCA, 0x01, 
-    0x69, 0x70, 0x09, 0xA0, 0x28, 0x80, 0x65, 0x50, 0x65, 0x58, 0x46, 0x58, 0x46, 0x58, 0x46, 0x58, 
-    0xE5, 0x60, 0x03, 0x69, 0x64, 0x71, 0xA5, 0xC3, 0x04, 0xD4, 0xA5, 0x92, 0x46, 0x28, 0x86, 0x30, 
-    0x87, 0x30, 0x67, 0x30, 0x88, 0x30, 0x89, 0x40, 0x8A, 0x40, 0x89, 0x40, 0x86, 0x30, 0x86, 0x28, 
-    0x87, 0x48, 0x69, 0x78, 0x49, 0x80, 0xCA, 0x29, 0x6B, 0x02, 0x2B, 0x02, 0xA8, 0x89, 0x86, 0xC1, 
-    0xC8, 0x79, 0x4B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x4B, 0x02, 0xE9, 0x58, 0x09, 0xA8, 
-    0x49, 0x88, 0xCA, 0x09, 0xEA, 0x01, 0x0A, 0x02, 0x4B, 0x02, 0x2B, 0x02, 0x46, 0x82, 0xE3, 0xD2, 
-    0x84, 0xBA, 0xAB, 0x39, 0x0D, 0x1A, 0x6A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA1, 0x48, 0x02, 0x69, 0xE2, 0x60, 0x48, 0x09, 0x68, 0x01, 0xAA, 0x09, 
-    0x2E, 0x1A, 0x4E, 0x1A, 0xAC, 0x19, 0x6B, 0x19, 0x4B, 0x21, 0x6A, 0x11, 0xCA, 0x01, 0xEA, 0x01, 
-    0x69, 0x70, 0x09, 0xA0, 0x28, 0x80, 0x65, 0x50, 0x65, 0x58, 0x65, 0x58, 0x45, 0x58, 0x46, 0x58, 
-    0xE3, 0x70, 0x21, 0x81, 0x82, 0x81, 0x25, 0xDC, 0xA5, 0xF4, 0x05, 0xA3, 0x26, 0x20, 0x86, 0x30, 
-    0x67, 0x28, 0x47, 0x28, 0x68, 0x28, 0x8A, 0x40, 0x8A, 0x40, 0x89, 0x40, 0x66, 0x28, 0x66, 0x20, 
-    0x87, 0x50, 0x69, 0x80, 0x48, 0x90, 0xAA, 0x31, 0x8B, 0x02, 0x6B, 0x02, 0xA7, 0x81, 0x45, 0xC9, 
-    0xA8, 0x79, 0x6B, 0x02, 0x4B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x4B, 0x02, 0x0A, 0x61, 0x09, 0xB0, 
-    0x09, 0x98, 0xCA, 0x09, 0xEB, 0x01, 0x0B, 0x02, 0x2B, 0x02, 0x0C, 0x02, 0x66, 0x7A, 0x03, 0xCB, 
-    0x84, 0xBA, 0xEC, 0x39, 0x6E, 0x1A, 0xCB, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x38, 0xE2, 0x60, 0xC2, 0x50, 0x28, 0x19, 0x28, 0x11, 0x6A, 0x19, 
-    0x0D, 0x1A, 0x0D, 0x1A, 0x8B, 0x21, 0x0A, 0x29, 0x0A, 0x31, 0x29, 0x21, 0x69, 0x11, 0x89, 0x11, 
-    0xA9, 0x68, 0x49, 0x88, 0x68, 0x70, 0x86, 0x50, 0x65, 0x50, 0x65, 0x50, 0x66, 0x50, 0x46, 0x50, 
-    0xC4, 0x60, 0x03, 0x71, 0x43, 0x69, 0xC5, 0x92, 0x04, 0xA3, 0x05, 0x7A, 0x47, 0x38, 0x87, 0x40, 
-    0xC6, 0x50, 0x06, 0x51, 0x06, 0x59, 0x07, 0x61, 0x07, 0x61, 0x27, 0x61, 0x45, 0x61, 0x44, 0x61, 
-    0xE7, 0x60, 0x8A, 0x70, 0x89, 0x70, 0x6A, 0x39, 0xCA, 0x21, 0xAA, 0x21, 0xC9, 0x61, 0xA8, 0x81, 
-    0xA9, 0x61, 0xAA, 0x39, 0xAA, 0x39, 0xCB, 0x29, 0x0B, 0x0A, 0x0B, 0x12, 0x4A, 0x41, 0xC9, 0x70, 
-    0xC9, 0x68, 0xA9, 0x29, 0xE9, 0x19, 0xEA, 0x19, 0x2A, 0x22, 0x0A, 0x22, 0x27, 0x82, 0x84, 0xB2, 
-    0x45, 0xA2, 0x28, 0x29, 0x48, 0x11, 0xE6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0xE2, 0x60, 0xC2, 0x50, 0x67, 0x68, 0x28, 0x78, 0x88, 0x50, 
-    0x89, 0x01, 0x89, 0x01, 0x09, 0x31, 0x08, 0x80, 0x28, 0x70, 0x47, 0x58, 0x47, 0x60, 0x27, 0x60, 
-    0x2A, 0x29, 0x6B, 0x19, 0x2A, 0x21, 0xA9, 0x30, 0xA9, 0x30, 0xA8, 0x28, 0x88, 0x20, 0x88, 0x20, 
-    0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x68, 0x20, 0x68, 0x18, 0x68, 0x40, 0x89, 0x70, 0x69, 0x60, 
-    0x45, 0xAA, 0x44, 0xD3, 0xE4, 0xC2, 0x22, 0x9A, 0x02, 0x9A, 0x42, 0xA2, 0xC3, 0xBA, 0xC2, 0xC2, 
-    0x48, 0x72, 0x0C, 0x1A, 0x2C, 0x22, 0xC9, 0x68, 0x08, 0x98, 0x08, 0x98, 0xAB, 0x39, 0x6C, 0x0A, 
-    0x8A, 0x51, 0x88, 0xB8, 0x68, 0xB8, 0x2A, 0x71, 0x2C, 0x1A, 0x0C, 0x2A, 0x2B, 0x0A, 0x8B, 0x02, 
-    0x2A, 0x1A, 0x03, 0xA2, 0x22, 0x9A, 0x83, 0xB2, 0xE4, 0xBA, 0xE3, 0xCA, 0x09, 0x62, 0xED, 0x19, 
-    0xCB, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x30, 0xE2, 0x68, 0xE2, 0x58, 0x67, 0x68, 0x28, 0x78, 0x88, 0x50, 
-    0xAA, 0x01, 0xCA, 0x01, 0x09, 0x29, 0x08, 0x88, 0x08, 0x78, 0x47, 0x58, 0x47, 0x60, 0x47, 0x60, 
-    0x0A, 0x29, 0x4B, 0x19, 0x2A, 0x21, 0xA9, 0x30, 0xA9, 0x30, 0x89, 0x28, 0x88, 0x18, 0x88, 0x20, 
-    0x89, 0x18, 0x89, 0x18, 0x89, 0x20, 0x89, 0x20, 0x89, 0x20, 0x89, 0x40, 0x89, 0x70, 0x49, 0x60, 
-    0x66, 0xAA, 0x64, 0xDB, 0x04, 0xCB, 0x22, 0x9A, 0x02, 0x9A, 0x43, 0xA2, 0xC3, 0xB2, 0xC2, 0xC2, 
-    0x68, 0x6A, 0x0D, 0x0A, 0x4D, 0x12, 0xCA, 0x60, 0x09, 0x90, 0x09, 0x90, 0xAB, 0x31, 0x4C, 0x0A, 
-    0x4B, 0x51, 0x68, 0xA8, 0x68, 0xA8, 0x2B, 0x61, 0x2D, 0x0A, 0xEC, 0x19, 0xEC, 0x09, 0x4C, 0x02, 
-    0x0A, 0x1A, 0x42, 0xAA, 0x62, 0xAA, 0xC3, 0xBA, 0x24, 0xC3, 0x23, 0xD3, 0x49, 0x72, 0x4E, 0x12, 
-    0x0C, 0x22, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0xA1, 0x48, 0x81, 0x38, 0x65, 0x58, 0x66, 0x68, 0x87, 0x50, 
-    0x29, 0x21, 0x29, 0x29, 0xE9, 0x38, 0x89, 0x60, 0x89, 0x58, 0x88, 0x40, 0x68, 0x48, 0x68, 0x50, 
-    0x0A, 0x29, 0x0A, 0x21, 0xE9, 0x20, 0xA7, 0x30, 0xA8, 0x30, 0xA7, 0x28, 0xA7, 0x20, 0xA7, 0x20, 
-    0xA7, 0x20, 0xA6, 0x20, 0x87, 0x20, 0x87, 0x20, 0x87, 0x20, 0x87, 0x38, 0xA7, 0x60, 0x87, 0x58, 
-    0xA5, 0x81, 0x23, 0x92, 0x03, 0x82, 0x82, 0x71, 0x82, 0x71, 0xA2, 0x71, 0xE3, 0x81, 0xE2, 0x81, 
-    0x06, 0x72, 0x6A, 0x52, 0x89, 0x52, 0x68, 0x81, 0xE7, 0xA0, 0xE7, 0x98, 0xE8, 0x61, 0x48, 0x4A, 
-    0xC8, 0x71, 0x47, 0xA9, 0x47, 0xA9, 0xC8, 0x81, 0x69, 0x52, 0x29, 0x5A, 0x29, 0x52, 0x69, 0x4A, 
-    0x48, 0x52, 0x82, 0x79, 0x82, 0x71, 0xE3, 0x81, 0x23, 0x8A, 0x23, 0x92, 0x66, 0x51, 0x4A, 0x21, 
-    0x28, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x48, 0xC1, 0x50, 0xA2, 0x50, 
-    0x47, 0x60, 0x27, 0x68, 0xC8, 0x40, 0xCA, 0x01, 0xAA, 0x01, 0x2A, 0x09, 0xC9, 0x18, 0xA9, 0x18, 
-    0x89, 0x18, 0x89, 0x20, 0xA6, 0x20, 0xC1, 0x28, 0xC2, 0x28, 0xC1, 0x28, 0xC1, 0x30, 0xC1, 0x30, 
-    0xE1, 0x30, 0xE1, 0x30, 0xC1, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC1, 0x30, 0xC1, 0x38, 
-    0x81, 0x28, 0x81, 0x20, 0x82, 0x20, 0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x62, 0x20, 
-    0xC3, 0x71, 0xA4, 0xDB, 0x64, 0xCB, 0x44, 0xCB, 0x44, 0xC3, 0x24, 0xC3, 0xE3, 0xC2, 0xE3, 0xC2, 
-    0x43, 0xC3, 0x85, 0xDC, 0x85, 0xDC, 0x65, 0xDC, 0x44, 0xE4, 0x64, 0xE4, 0x24, 0xDC, 0x24, 0xE4, 
-    0xC4, 0xD3, 0xC2, 0x30, 0x82, 0x30, 0x82, 0x30, 0x82, 0x38, 0x82, 0x40, 0x20, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x50, 0xE2, 0x60, 0xC3, 0x58, 
-    0x47, 0x58, 0x27, 0x60, 0xA9, 0x38, 0xAB, 0x01, 0xAA, 0x01, 0x0A, 0x11, 0xA9, 0x18, 0xA9, 0x18, 
-    0x89, 0x18, 0x8A, 0x18, 0xA7, 0x20, 0xC1, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC1, 0x30, 0xC2, 0x30, 
-    0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x30, 0xC2, 0x30, 
-    0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x81, 0x30, 0x61, 0x28, 0x21, 0x20, 
-    0x82, 0x71, 0x43, 0xD3, 0x03, 0xC3, 0xC2, 0xC2, 0xA2, 0xC2, 0xA2, 0xBA, 0x04, 0xC3, 0x04, 0xBB, 
-    0x44, 0xC3, 0xC5, 0xEC, 0xC5, 0xEC, 0xA5, 0xEC, 0xA5, 0xE4, 0xC6, 0xEC, 0x04, 0xDC, 0xE4, 0xD3, 
-    0x83, 0xC3, 0x61, 0x30, 0x20, 0x28, 0x61, 0x38, 0xC2, 0x48, 0xC2, 0x50, 0x40, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0x61, 0x30, 0x61, 0x30, 
-    0x85, 0x50, 0x85, 0x58, 0xE6, 0x48, 0x66, 0x31, 0x47, 0x29, 0xC8, 0x18, 0x89, 0x18, 0xA8, 0x18, 
-    0xA6, 0x20, 0xA7, 0x20, 0xA4, 0x28, 0xC1, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xE2, 0x38, 0xE2, 0x38, 
-    0xE2, 0x38, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x38, 0xE2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x40, 0xE2, 0x48, 0xC2, 0x40, 0xE2, 0x48, 0xC2, 0x48, 0x44, 0x51, 0xEA, 0x72, 0xA9, 0x6A, 
-    0x8A, 0x9B, 0xAB, 0xD4, 0x8B, 0xD4, 0xCD, 0xD4, 0xEE, 0xDC, 0x8D, 0xD4, 0x43, 0x92, 0x22, 0x92, 
-    0x43, 0x92, 0x04, 0xA3, 0x24, 0x9B, 0x04, 0x9B, 0x24, 0x9B, 0x03, 0x9B, 0x49, 0xC4, 0x2C, 0xE5, 
-    0xCB, 0xD4, 0x4B, 0x83, 0x6B, 0x83, 0x48, 0x62, 0x41, 0x20, 0x41, 0x20, 0x00, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE1, 0x50, 0x01, 0x51, 0x21, 0x61, 0x21, 0x69, 0x21, 0x69, 0x87, 0x20, 0x89, 0x18, 0xA6, 0x20, 
-    0xC1, 0x30, 0xC1, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x38, 0x02, 0x51, 0x02, 0x51, 
-    0x22, 0x59, 0x42, 0x61, 0x22, 0x61, 0x22, 0x59, 0x22, 0x59, 0x02, 0x51, 0x02, 0x51, 0x02, 0x49, 
-    0x22, 0x61, 0x22, 0x69, 0x22, 0x69, 0x43, 0x79, 0x01, 0x71, 0xA8, 0x92, 0xB6, 0xEE, 0x75, 0xE6, 
-    0x96, 0xE6, 0x96, 0xDE, 0x96, 0xDE, 0x19, 0xEF, 0x5A, 0xF7, 0xB8, 0xE6, 0xC4, 0x71, 0x62, 0x69, 
-    0x42, 0x59, 0x82, 0x30, 0x81, 0x30, 0xA2, 0x28, 0xC2, 0x28, 0x40, 0x18, 0x90, 0x9C, 0x59, 0xF7, 
-    0x96, 0xE6, 0x34, 0xDE, 0xB5, 0xEE, 0x4E, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0x02, 0x59, 0x22, 0x61, 0x42, 0x69, 0x42, 0x69, 0x42, 0x69, 0xA8, 0x28, 0x89, 0x18, 0xA7, 0x20, 
-    0xC2, 0x28, 0xA2, 0x30, 0xA2, 0x28, 0x82, 0x28, 0x82, 0x28, 0xA2, 0x28, 0xE2, 0x48, 0x02, 0x49, 
-    0x22, 0x59, 0x42, 0x61, 0x22, 0x59, 0x22, 0x51, 0x22, 0x59, 0x02, 0x51, 0xE2, 0x48, 0xE2, 0x48, 
-    0x02, 0x59, 0x02, 0x61, 0x02, 0x61, 0xE1, 0x68, 0x80, 0x60, 0x26, 0x82, 0x34, 0xDE, 0xD3, 0xD5, 
-    0x55, 0xDE, 0xD7, 0xEE, 0xD7, 0xEE, 0x59, 0xF7, 0x9A, 0xFF, 0xD8, 0xEE, 0x62, 0x69, 0x00, 0x69, 
-    0x01, 0x59, 0xC2, 0x38, 0xC2, 0x38, 0x81, 0x28, 0x80, 0x28, 0x00, 0x18, 0xB0, 0xA4, 0x9A, 0xFF, 
-    0xB7, 0xE6, 0x14, 0xDE, 0x95, 0xEE, 0x4E, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x30, 0xA1, 0x38, 0xA1, 0x38, 0xC1, 0x40, 0xA1, 0x38, 0x84, 0x28, 0xA6, 0x30, 0x85, 0x30, 
-    0xE2, 0x40, 0xE2, 0x40, 0x22, 0x51, 0xA3, 0x71, 0xA3, 0x69, 0xA3, 0x69, 0xA2, 0x71, 0xA2, 0x71, 
-    0x42, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x59, 0x22, 0x51, 0x42, 0x61, 0x42, 0x69, 0x42, 0x61, 
-    0x42, 0x69, 0x42, 0x71, 0x42, 0x71, 0x09, 0x9B, 0x2A, 0x9B, 0x0D, 0xAC, 0x96, 0xE6, 0x96, 0xE6, 
-    0x92, 0xC5, 0x4E, 0xAC, 0x8F, 0xB4, 0xB0, 0xB4, 0xD0, 0xAC, 0x90, 0xAC, 0xCC, 0xA3, 0x0D, 0xAC, 
-    0x4A, 0x93, 0x42, 0x61, 0x21, 0x61, 0xC9, 0x7A, 0x4F, 0x9C, 0x0E, 0x8C, 0xD0, 0xBC, 0x50, 0xDD, 
-    0x0F, 0xD5, 0xCC, 0xA3, 0xED, 0xA3, 0xA8, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0xA2, 0x50, 0xA2, 0x48, 
-    0x22, 0x59, 0x22, 0x59, 0xC3, 0x79, 0xA4, 0xD3, 0x84, 0xD3, 0x64, 0xD3, 0x24, 0xCB, 0x64, 0xD3, 
-    0xE3, 0x81, 0x02, 0x59, 0x22, 0x61, 0x22, 0x59, 0x22, 0x51, 0x82, 0x81, 0xC2, 0x99, 0xC2, 0x99, 
-    0x82, 0x81, 0x62, 0x79, 0x83, 0x79, 0x14, 0xDE, 0xD7, 0xEE, 0x96, 0xE6, 0xD7, 0xE6, 0x9A, 0xF7, 
-    0xED, 0x9B, 0x40, 0x48, 0xE1, 0x58, 0x61, 0x40, 0x20, 0x38, 0xC2, 0x40, 0xB7, 0xE6, 0x9A, 0xFF, 
-    0xD3, 0xDD, 0xE2, 0xA1, 0xA1, 0x99, 0x31, 0xDD, 0xFC, 0xFF, 0xFC, 0xFF, 0x0B, 0xCC, 0xA0, 0xA9, 
-    0x03, 0xB2, 0xA1, 0x58, 0x81, 0x50, 0x81, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x28, 0xC2, 0x58, 0xC2, 0x48, 
-    0xE2, 0x50, 0xC1, 0x48, 0x82, 0x69, 0x84, 0xCB, 0x84, 0xC3, 0x64, 0xCB, 0x24, 0xC3, 0x44, 0xD3, 
-    0x03, 0x8A, 0x02, 0x59, 0x22, 0x61, 0x22, 0x59, 0x22, 0x59, 0x62, 0x79, 0xA2, 0x91, 0xA2, 0x91, 
-    0x82, 0x81, 0x62, 0x79, 0x62, 0x79, 0x72, 0xCD, 0x34, 0xDE, 0x14, 0xDE, 0xD7, 0xE6, 0x59, 0xF7, 
-    0x0D, 0xA4, 0xC0, 0x50, 0x63, 0x61, 0x02, 0x49, 0xC2, 0x40, 0x23, 0x51, 0x35, 0xDE, 0x38, 0xEF, 
-    0x72, 0xD5, 0xA2, 0x99, 0x81, 0x91, 0xF0, 0xCC, 0x7A, 0xF7, 0x5A, 0xEF, 0x0C, 0xCC, 0x03, 0xB2, 
-    0x64, 0xB2, 0xA1, 0x58, 0x61, 0x50, 0x61, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x81, 0x38, 0x81, 0x38, 
-    0x03, 0x82, 0x23, 0x82, 0x63, 0x92, 0x44, 0xCB, 0x44, 0xC3, 0x04, 0xBB, 0xC3, 0xB2, 0xE4, 0xC2, 
-    0xE2, 0x81, 0x02, 0x59, 0x22, 0x61, 0x22, 0x59, 0x02, 0x51, 0xA2, 0x81, 0x02, 0xA2, 0x02, 0x9A, 
-    0x82, 0x79, 0x42, 0x69, 0xC4, 0x79, 0xF4, 0xD5, 0x75, 0xE6, 0x55, 0xDE, 0xD7, 0xEE, 0x7A, 0xF7, 
-    0x0D, 0xA4, 0xE0, 0x58, 0x62, 0x69, 0xE2, 0x48, 0x81, 0x38, 0x44, 0x51, 0x76, 0xDE, 0x18, 0xEF, 
-    0x71, 0xD5, 0x02, 0xA2, 0xE1, 0xA1, 0x10, 0xD5, 0x7A, 0xF7, 0x7A, 0xF7, 0x0B, 0xC4, 0xC1, 0xA1, 
-    0x84, 0xAA, 0x4B, 0x93, 0x8C, 0x93, 0x88, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0xE4, 0xCB, 0x65, 0xE4, 0xC4, 0xD3, 0xC3, 0xBA, 0x04, 0xC3, 0x63, 0xAA, 0xE2, 0x91, 0x02, 0x9A, 
-    0x82, 0x71, 0x22, 0x59, 0x22, 0x59, 0x22, 0x51, 0x02, 0x51, 0xE2, 0x89, 0x83, 0xB2, 0x83, 0xAA, 
-    0xA2, 0x71, 0xE1, 0x50, 0x87, 0x82, 0xB7, 0xE6, 0x55, 0xDE, 0x76, 0xE6, 0xF8, 0xEE, 0x7A, 0xF7, 
-    0x4E, 0xAC, 0x21, 0x69, 0xA3, 0x79, 0xE3, 0x48, 0x61, 0x30, 0xC6, 0x59, 0x96, 0xE6, 0xB6, 0xE6, 
-    0x30, 0xD5, 0x62, 0xB2, 0x41, 0xAA, 0x30, 0xD5, 0x7A, 0xF7, 0x7A, 0xF7, 0x0B, 0xBC, 0xA0, 0x89, 
-    0xC5, 0xA2, 0x96, 0xE6, 0x17, 0xF7, 0x31, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 
-    0xA4, 0xC3, 0x25, 0xDC, 0x84, 0xCB, 0xC3, 0xBA, 0x04, 0xC3, 0x63, 0xAA, 0x02, 0x9A, 0x22, 0xA2, 
-    0x82, 0x79, 0x22, 0x59, 0x22, 0x59, 0x02, 0x51, 0xE2, 0x48, 0xE2, 0x89, 0x63, 0xAA, 0x63, 0xAA, 
-    0x82, 0x71, 0xC1, 0x50, 0x47, 0x7A, 0x18, 0xEF, 0xB7, 0xE6, 0xB7, 0xE6, 0xF8, 0xEE, 0x9A, 0xF7, 
-    0x0D, 0xAC, 0x80, 0x60, 0x21, 0x69, 0x61, 0x38, 0x00, 0x20, 0x45, 0x49, 0xD7, 0xE6, 0x18, 0xE7, 
-    0x50, 0xD5, 0x42, 0xAA, 0x21, 0xAA, 0x50, 0xD5, 0xBB, 0xF7, 0xBB, 0xFF, 0xEB, 0xBB, 0x40, 0x89, 
-    0x44, 0x9A, 0x14, 0xD6, 0x96, 0xE6, 0xB0, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0xC4, 0xC3, 0x25, 0xDC, 0x84, 0xCB, 0xC3, 0xBA, 0xE4, 0xC2, 0x43, 0xA2, 0x82, 0x69, 0x82, 0x71, 
-    0x62, 0x69, 0x22, 0x61, 0x42, 0x69, 0xA2, 0x79, 0x82, 0x71, 0x23, 0x9A, 0x83, 0xB2, 0x83, 0xAA, 
-    0x03, 0x92, 0xA2, 0x81, 0x65, 0x92, 0x8F, 0xC4, 0x4E, 0xBC, 0x31, 0xCD, 0x18, 0xEF, 0x39, 0xF7, 
-    0x72, 0xCD, 0xCC, 0xA3, 0x0D, 0xAC, 0xCD, 0x93, 0x8C, 0x8B, 0x0D, 0x9C, 0x71, 0xDD, 0xB2, 0xDD, 
-    0x8C, 0xCC, 0xA3, 0xB2, 0x82, 0xB2, 0xCE, 0xD4, 0xB7, 0xEE, 0x96, 0xEE, 0x0F, 0xD5, 0x2C, 0xBC, 
-    0xAE, 0xC4, 0x55, 0xDE, 0xB6, 0xE6, 0x71, 0xC5, 0x82, 0x51, 0xA2, 0x51, 0x80, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0xA4, 0xC3, 0x25, 0xD4, 0x64, 0xC3, 0xA3, 0xBA, 0xE4, 0xC2, 0x63, 0x9A, 0xA1, 0x28, 0xC2, 0x28, 
-    0x22, 0x59, 0x42, 0x71, 0x82, 0x79, 0x83, 0xB2, 0x83, 0xB2, 0x83, 0xB2, 0xA3, 0xB2, 0xA3, 0xB2, 
-    0xA3, 0xBA, 0xC3, 0xBA, 0x83, 0xB2, 0x01, 0x81, 0xA0, 0x78, 0x87, 0x9A, 0x39, 0xEF, 0xD7, 0xEE, 
-    0x18, 0xEF, 0x18, 0xEF, 0xF8, 0xEE, 0xF7, 0xEE, 0x18, 0xEF, 0x75, 0xEE, 0xC3, 0xBA, 0xC2, 0xBA, 
-    0x03, 0xC3, 0x64, 0xCB, 0x64, 0xC3, 0x24, 0xC3, 0x04, 0xC3, 0xA2, 0xBA, 0xEE, 0xD4, 0x39, 0xEF, 
-    0xB6, 0xE6, 0x55, 0xDE, 0x75, 0xDE, 0x12, 0xE6, 0x65, 0xE4, 0xE6, 0xFC, 0x43, 0x72, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 
-    0xE5, 0xD3, 0x45, 0xE4, 0xA4, 0xD3, 0xC3, 0xBA, 0x04, 0xC3, 0x63, 0x9A, 0xA1, 0x20, 0xA1, 0x28, 
-    0x22, 0x59, 0x42, 0x69, 0x82, 0x79, 0x63, 0xAA, 0x63, 0xA2, 0x83, 0xAA, 0xA3, 0xBA, 0xA3, 0xB2, 
-    0xA3, 0xBA, 0xC3, 0xC2, 0xA3, 0xBA, 0x83, 0x89, 0x02, 0x79, 0xC9, 0xA2, 0x9B, 0xF7, 0x59, 0xF7, 
-    0x39, 0xEF, 0xF7, 0xEE, 0xF8, 0xEE, 0xB7, 0xE6, 0xB7, 0xE6, 0x55, 0xDE, 0x25, 0xC3, 0x04, 0xC3, 
-    0x04, 0xC3, 0x44, 0xC3, 0x44, 0xC3, 0x24, 0xC3, 0x24, 0xC3, 0xC2, 0xBA, 0xCD, 0xD4, 0xD8, 0xE6, 
-    0x96, 0xDE, 0x76, 0xDE, 0x97, 0xE6, 0x13, 0xDE, 0x05, 0xD4, 0x85, 0xEC, 0x43, 0x72, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE3, 0x71, 0x63, 0x8A, 0x43, 0x92, 0xC3, 0xBA, 0xE3, 0xBA, 0x83, 0xAA, 0xA2, 0x69, 0xC2, 0x71, 
-    0x62, 0x71, 0x42, 0x69, 0xA2, 0x79, 0x63, 0xAA, 0x63, 0xAA, 0x63, 0xAA, 0x63, 0xAA, 0x83, 0xB2, 
-    0x23, 0x92, 0xE3, 0x89, 0xE3, 0x81, 0xC3, 0x91, 0xC2, 0x99, 0xE7, 0xB2, 0x71, 0xD5, 0x30, 0xD5, 
-    0xEF, 0xC4, 0x8F, 0xB4, 0x8F, 0xB4, 0xCE, 0xC4, 0x0F, 0xCD, 0xCE, 0xCC, 0x44, 0xC3, 0x24, 0xBB, 
-    0x44, 0xC3, 0x84, 0xCB, 0xA4, 0xCB, 0x84, 0xCB, 0x44, 0xC3, 0x43, 0xC3, 0xE7, 0xCB, 0xAB, 0xCC, 
-    0x8A, 0xD4, 0xAA, 0xD4, 0xAB, 0xD4, 0xAA, 0xDC, 0x65, 0xDC, 0xA5, 0xEC, 0x04, 0x9B, 0x40, 0x20, 
-    0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0xE4, 0xC2, 0xA3, 0xB2, 0xC3, 0xBA, 0xE4, 0xC2, 0x04, 0xCB, 
-    0xE2, 0x89, 0x42, 0x61, 0xA2, 0x79, 0x63, 0xAA, 0x63, 0xAA, 0x42, 0xA2, 0x02, 0x9A, 0x42, 0xA2, 
-    0x22, 0x59, 0xC1, 0x30, 0xA1, 0x30, 0x23, 0x92, 0x04, 0xC3, 0xC3, 0xBA, 0x82, 0xBA, 0xA2, 0xC2, 
-    0xE1, 0x91, 0x41, 0x69, 0x21, 0x69, 0x02, 0xAB, 0x44, 0xDC, 0x04, 0xD4, 0x65, 0xDC, 0x65, 0xDC, 
-    0x65, 0xDC, 0x85, 0xDC, 0x85, 0xDC, 0x85, 0xDC, 0x65, 0xDC, 0x85, 0xDC, 0x44, 0xDC, 0x44, 0xDC, 
-    0x44, 0xDC, 0x64, 0xE4, 0x64, 0xE4, 0x64, 0xE4, 0x85, 0xE4, 0xA5, 0xEC, 0x64, 0xBB, 0x22, 0x61, 
-    0x22, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x38, 0x04, 0xD3, 0xE4, 0xC2, 0xE4, 0xC2, 0xE4, 0xC2, 0x04, 0xCB, 
-    0xE2, 0x89, 0x62, 0x69, 0xC2, 0x81, 0x83, 0xB2, 0x83, 0xB2, 0x43, 0xAA, 0x22, 0x9A, 0x42, 0xA2, 
-    0x42, 0x61, 0xA2, 0x38, 0xA2, 0x38, 0x43, 0x9A, 0x04, 0xCB, 0xE4, 0xC2, 0x24, 0xCB, 0x44, 0xD3, 
-    0x83, 0xA2, 0xE2, 0x79, 0xA2, 0x71, 0x84, 0xBB, 0xE6, 0xF4, 0xA5, 0xEC, 0xC5, 0xEC, 0xC5, 0xEC, 
-    0xC5, 0xEC, 0xC5, 0xEC, 0xC5, 0xEC, 0xC5, 0xEC, 0xC5, 0xEC, 0xC5, 0xEC, 0xA5, 0xEC, 0xC6, 0xEC, 
-    0xC6, 0xEC, 0xC6, 0xEC, 0xC6, 0xEC, 0xC6, 0xEC, 0xC5, 0xEC, 0x06, 0xF5, 0xA5, 0xC3, 0x22, 0x61, 
-    0x22, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x20, 0x23, 0x92, 0x03, 0x8A, 0x02, 0x8A, 0x03, 0x8A, 0x03, 0x8A, 
-    0x82, 0x69, 0x22, 0x59, 0x62, 0x61, 0xA2, 0x79, 0xA2, 0x71, 0xE2, 0x89, 0x22, 0x9A, 0x22, 0x9A, 
-    0xC2, 0x81, 0x82, 0x71, 0x82, 0x71, 0xE3, 0x81, 0x03, 0x8A, 0x03, 0x8A, 0x03, 0x92, 0x03, 0x92, 
-    0xC3, 0x81, 0x82, 0x71, 0x82, 0x71, 0x63, 0x82, 0xE4, 0x92, 0xE4, 0x9A, 0x04, 0x9B, 0x04, 0x9B, 
-    0x24, 0x9B, 0x24, 0x9B, 0x24, 0x9B, 0x24, 0x9B, 0x04, 0x93, 0xC3, 0x8A, 0xC4, 0x92, 0xE4, 0x9A, 
-    0x04, 0x9B, 0x24, 0xAB, 0x24, 0xAB, 0x24, 0xAB, 0x04, 0xB3, 0x44, 0xBB, 0x43, 0x82, 0x81, 0x30, 
-    0xA1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x21, 0x00, 0x41, 0x08, 0x21, 0x00, 
-    0x81, 0x18, 0xC1, 0x28, 0xA1, 0x28, 0xA2, 0x28, 0xA2, 0x20, 0x62, 0x61, 0x42, 0xA2, 0x02, 0x9A, 
-    0x42, 0xA2, 0x63, 0xAA, 0x63, 0xAA, 0x02, 0x51, 0xA2, 0x38, 0xC2, 0x40, 0xE2, 0x48, 0xE2, 0x48, 
-    0xE2, 0x50, 0xE2, 0x50, 0xE2, 0x50, 0xA1, 0x30, 0x81, 0x20, 0x81, 0x28, 0x81, 0x28, 0xA1, 0x28, 
-    0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x20, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 
-    0x81, 0x28, 0xE2, 0x50, 0xC2, 0x58, 0xC2, 0x58, 0xA2, 0x58, 0xA2, 0x60, 0x40, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x41, 0x00, 0x41, 0x08, 0x41, 0x00, 
-    0xA1, 0x20, 0xC1, 0x28, 0xC1, 0x28, 0xE2, 0x30, 0xC2, 0x28, 0x62, 0x61, 0x62, 0xAA, 0x22, 0x9A, 
-    0x42, 0xA2, 0x62, 0xA2, 0x62, 0xA2, 0x02, 0x51, 0xA2, 0x40, 0xC2, 0x48, 0xE2, 0x50, 0xE2, 0x50, 
-    0xE2, 0x50, 0xE2, 0x48, 0xE2, 0x50, 0xC2, 0x38, 0xC2, 0x30, 0xC1, 0x28, 0xA1, 0x28, 0xA1, 0x28, 
-    0xA1, 0x28, 0xA1, 0x28, 0x81, 0x20, 0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x28, 0xA1, 0x28, 0xC2, 0x30, 
-    0xC2, 0x30, 0x22, 0x59, 0x22, 0x61, 0x22, 0x61, 0x02, 0x69, 0x22, 0x79, 0x81, 0x38, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x38, 0xC2, 0x40, 0xC1, 0x40, 0xC1, 0x40, 0xC1, 0x38, 
-    0xA1, 0x20, 0xA1, 0x20, 0xA1, 0x20, 0xC2, 0x30, 0xA2, 0x28, 0x02, 0x51, 0xC2, 0x89, 0xA2, 0x79, 
-    0xE2, 0x89, 0xE2, 0x91, 0xC2, 0x89, 0x82, 0x71, 0x62, 0x71, 0x62, 0x71, 0x62, 0x71, 0x62, 0x71, 
-    0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0x62, 0x61, 0x62, 0x61, 0x82, 0x61, 0x43, 0x82, 0x63, 0x82, 
-    0x63, 0x82, 0x63, 0x82, 0x63, 0x82, 0x23, 0x82, 0xE3, 0x79, 0x03, 0x7A, 0xA2, 0x71, 0x62, 0x69, 
-    0x62, 0x69, 0x82, 0x79, 0x82, 0x79, 0x62, 0x71, 0x81, 0x30, 0x81, 0x30, 0x20, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x42, 0x79, 0x42, 0x79, 0x22, 0x79, 0x22, 0x71, 0x42, 0x79, 
-    0x81, 0x20, 0x41, 0x08, 0x61, 0x10, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 0x82, 0x40, 0x82, 0x38, 
-    0x22, 0x71, 0x62, 0x81, 0x62, 0x79, 0x43, 0xAA, 0x83, 0xB2, 0x63, 0xAA, 0x42, 0x9A, 0x42, 0x9A, 
-    0x42, 0x9A, 0x22, 0x9A, 0x22, 0x9A, 0x42, 0x9A, 0x42, 0x9A, 0x82, 0xA2, 0x05, 0xDC, 0x25, 0xE4, 
-    0x25, 0xE4, 0x25, 0xDC, 0x45, 0xE4, 0xC5, 0xDB, 0x44, 0xD3, 0x64, 0xD3, 0xC3, 0xBA, 0x22, 0xA2, 
-    0x42, 0xA2, 0xE2, 0x91, 0x02, 0x9A, 0xA2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x22, 0x71, 0x22, 0x71, 0x22, 0x71, 0x22, 0x71, 0x22, 0x71, 
-    0x61, 0x18, 0x21, 0x00, 0x41, 0x10, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 0xA2, 0x48, 0xA2, 0x40, 
-    0x42, 0x79, 0xA2, 0x89, 0x82, 0x81, 0x63, 0xAA, 0x83, 0xB2, 0x63, 0xAA, 0x22, 0x9A, 0x42, 0x9A, 
-    0x22, 0x9A, 0x22, 0x9A, 0x22, 0x9A, 0x22, 0x9A, 0x22, 0x9A, 0x62, 0xA2, 0xE4, 0xD3, 0x05, 0xDC, 
-    0x05, 0xDC, 0x05, 0xDC, 0x25, 0xDC, 0xC5, 0xD3, 0x24, 0xCB, 0x64, 0xD3, 0xA3, 0xB2, 0x22, 0x9A, 
-    0x43, 0xA2, 0x02, 0x9A, 0x22, 0xA2, 0xA2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x10, 0x20, 0x18, 0x60, 0x30, 0x42, 0x79, 0x42, 0x79, 0x22, 0x71, 0x02, 0x61, 0x02, 0x69, 
-    0x81, 0x30, 0x81, 0x20, 0x81, 0x28, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0x82, 0x38, 0x82, 0x38, 
-    0xE2, 0x58, 0x02, 0x61, 0x02, 0x61, 0xE2, 0x89, 0x02, 0x92, 0xE2, 0x89, 0xC2, 0x81, 0xC2, 0x81, 
-    0xC2, 0x79, 0xC2, 0x81, 0xC2, 0x81, 0xC2, 0x81, 0xC2, 0x81, 0xE2, 0x81, 0xC3, 0xAA, 0xE4, 0xAA, 
-    0xE3, 0xA2, 0xC4, 0xA2, 0xC4, 0xA2, 0x83, 0x9A, 0x63, 0x9A, 0x63, 0xA2, 0x23, 0x92, 0xE2, 0x89, 
-    0xE2, 0x91, 0x61, 0x69, 0x41, 0x61, 0x01, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0x42, 0x81, 0x62, 0x89, 0x62, 0x89, 0x42, 0x81, 0x62, 0x89, 0x02, 0x61, 0xC2, 0x30, 0xC2, 0x38, 
-    0xE2, 0x50, 0xE2, 0x60, 0x02, 0x61, 0x02, 0x59, 0x02, 0x61, 0xC2, 0x48, 0x82, 0x30, 0x82, 0x38, 
-    0x82, 0x30, 0x82, 0x30, 0x82, 0x38, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x51, 0x22, 0x51, 
-    0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x02, 0x51, 0xC2, 0x48, 0xE2, 0x48, 0xC1, 0x48, 0xE1, 0x48, 0xE1, 0x48, 0x02, 0x51, 0x22, 0x59, 
-    0x22, 0x59, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0x62, 0x91, 0x82, 0x91, 0x82, 0x91, 0x62, 0x89, 0x62, 0x91, 0x02, 0x69, 0x81, 0x38, 0xA1, 0x40, 
-    0xC2, 0x48, 0xE2, 0x50, 0xE2, 0x50, 0xE1, 0x60, 0xE1, 0x68, 0xA1, 0x48, 0x62, 0x30, 0x82, 0x30, 
-    0x82, 0x30, 0x82, 0x30, 0x82, 0x38, 0x02, 0x51, 0x22, 0x59, 0x22, 0x59, 0x22, 0x51, 0x02, 0x51, 
-    0x02, 0x51, 0x02, 0x49, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x22, 0x51, 0x22, 0x59, 
-    0x02, 0x51, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x51, 0x22, 0x61, 0x22, 0x61, 0x42, 0x69, 0x42, 0x69, 
-    0x42, 0x69, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC1, 0x50, 0xE1, 0x58, 0xE2, 0x58, 0xE5, 0x58, 0xC5, 0x58, 0x06, 0x49, 0x67, 0x21, 0x67, 0x21, 
-    0x06, 0x69, 0x05, 0x81, 0x05, 0x79, 0x47, 0x41, 0x67, 0x41, 0x25, 0x49, 0xE2, 0x60, 0xE2, 0x60, 
-    0x02, 0x69, 0x02, 0x69, 0x02, 0x69, 0x42, 0x69, 0x62, 0x69, 0x42, 0x69, 0xC3, 0x79, 0x03, 0x82, 
-    0x03, 0x82, 0x23, 0x8A, 0x23, 0x8A, 0x23, 0x8A, 0x43, 0x8A, 0x23, 0x8A, 0x43, 0x8A, 0x43, 0x8A, 
-    0x23, 0x8A, 0xE3, 0x81, 0x03, 0x8A, 0x22, 0x51, 0x81, 0x28, 0x81, 0x28, 0x80, 0x28, 0x81, 0x30, 
-    0x81, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x89, 0x20, 0x48, 0x20, 0x6A, 0x19, 0x6C, 0x02, 0x6C, 0x02, 
-    0x69, 0x89, 0x08, 0xC1, 0x29, 0xA9, 0x0D, 0x2A, 0x4E, 0x12, 0xCA, 0x41, 0x42, 0x91, 0x62, 0x89, 
-    0x82, 0x91, 0xA2, 0x99, 0xA2, 0x99, 0xA2, 0x91, 0xA2, 0x91, 0x82, 0x89, 0xC4, 0xBA, 0x44, 0xCB, 
-    0x24, 0xCB, 0x44, 0xCB, 0x44, 0xCB, 0xA4, 0xD3, 0xE4, 0xD3, 0xC4, 0xD3, 0xE4, 0xD3, 0xE5, 0xD3, 
-    0xC4, 0xD3, 0x84, 0xCB, 0xE5, 0xE3, 0xC2, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x67, 0x28, 0x27, 0x28, 0x69, 0x19, 0x6B, 0x02, 0x4B, 0x02, 
-    0x48, 0x89, 0xE8, 0xC8, 0x28, 0xA9, 0x2C, 0x22, 0x4D, 0x12, 0xCA, 0x41, 0x21, 0x99, 0x42, 0x91, 
-    0x62, 0x91, 0xA2, 0x99, 0xA2, 0x99, 0x82, 0x89, 0x82, 0x81, 0x62, 0x79, 0xC4, 0xBA, 0x44, 0xCB, 
-    0x24, 0xCB, 0x44, 0xCB, 0x44, 0xCB, 0x64, 0xCB, 0x84, 0xCB, 0xA4, 0xCB, 0xA4, 0xD3, 0xC4, 0xD3, 
-    0xA4, 0xCB, 0x64, 0xC3, 0xA5, 0xD3, 0xA2, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x43, 0x40, 0x43, 0x48, 0x64, 0x38, 0x2A, 0x21, 0x2A, 0x21, 0x6A, 0x39, 0xA9, 0x59, 0x89, 0x51, 
-    0x69, 0x69, 0x89, 0x79, 0x69, 0x69, 0x6B, 0x49, 0x4B, 0x49, 0x6A, 0x49, 0x66, 0x59, 0x67, 0x49, 
-    0x65, 0x61, 0x42, 0x79, 0x42, 0x71, 0x03, 0x9A, 0x63, 0xAA, 0x23, 0xA2, 0x23, 0x92, 0x43, 0x9A, 
-    0x43, 0x9A, 0x43, 0x9A, 0x43, 0x9A, 0xC4, 0xBA, 0x24, 0xCB, 0x24, 0xC3, 0xC3, 0xB2, 0xE3, 0xB2, 
-    0xA3, 0xAA, 0xC3, 0x91, 0xE2, 0x99, 0xC7, 0x59, 0x8B, 0x11, 0x6A, 0x21, 0x21, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-    0xC8, 0xA8, 0xC9, 0xB8, 0x09, 0x89, 0x4D, 0x22, 0x4D, 0x1A, 0xAB, 0x61, 0xC8, 0xC0, 0xC8, 0xC0, 
-    0xAA, 0x39, 0x6B, 0x02, 0xCA, 0x19, 0x08, 0x90, 0x08, 0xA0, 0xA9, 0x58, 0xCB, 0x01, 0xAB, 0x01, 
-    0x47, 0x21, 0xC1, 0x50, 0xA2, 0x40, 0x43, 0x9A, 0x24, 0xCB, 0xE4, 0xC2, 0x82, 0x79, 0x62, 0x69, 
-    0x62, 0x71, 0x62, 0x69, 0x42, 0x69, 0x63, 0xAA, 0xC4, 0xC2, 0xA4, 0xBA, 0x02, 0x9A, 0x02, 0x9A, 
-    0xC2, 0x91, 0x22, 0x79, 0x21, 0x81, 0xA8, 0x51, 0x6F, 0x12, 0x4E, 0x1A, 0x42, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x87, 0xA8, 0x88, 0xB8, 0xE8, 0x88, 0x2D, 0x12, 0x2D, 0x0A, 0xAA, 0x61, 0xE7, 0xC0, 0xE8, 0xC0, 
-    0xCA, 0x41, 0x8C, 0x02, 0xEB, 0x19, 0x09, 0x98, 0x08, 0xA0, 0xA9, 0x58, 0xEA, 0x01, 0xEA, 0x01, 
-    0x46, 0x29, 0xA0, 0x60, 0xA1, 0x48, 0x63, 0xA2, 0x24, 0xD3, 0xE4, 0xC2, 0xA2, 0x79, 0x62, 0x71, 
-    0x62, 0x71, 0x62, 0x71, 0x42, 0x69, 0x63, 0xAA, 0xE4, 0xCA, 0xC4, 0xC2, 0x23, 0xA2, 0x22, 0x9A, 
-    0xE2, 0x99, 0x62, 0x89, 0x41, 0x91, 0x87, 0x51, 0x2E, 0x12, 0x0D, 0x22, 0x62, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x69, 0x38, 0x69, 0x30, 0x66, 0x58, 0x65, 0x68, 0x85, 0x68, 
-    0x69, 0x61, 0x8A, 0x59, 0x6A, 0x59, 0x8A, 0x61, 0x8A, 0x61, 0x8A, 0x61, 0x8A, 0x69, 0xAA, 0x71, 
-    0x49, 0x49, 0x49, 0x39, 0x49, 0x39, 0xE9, 0x50, 0xE9, 0x50, 0xE9, 0x48, 0x09, 0x41, 0x09, 0x49, 
-    0x48, 0x39, 0xA7, 0x29, 0x88, 0x21, 0x64, 0x61, 0x82, 0x71, 0x62, 0x71, 0xA2, 0x81, 0xC2, 0x81, 
-    0xC2, 0x89, 0x03, 0x92, 0x02, 0x92, 0x43, 0xA2, 0x43, 0xA2, 0x43, 0xA2, 0x02, 0x9A, 0x22, 0xA2, 
-    0xC3, 0x81, 0xE4, 0x30, 0xC3, 0x38, 0x68, 0x29, 0x4E, 0x1A, 0x2D, 0x1A, 0xC7, 0x28, 0x45, 0x28, 
-    0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x29, 0x6A, 0x73, 
-    0x29, 0x6B, 0x4B, 0x6B, 0x6C, 0x6B, 0x0A, 0x63, 0xA9, 0x52, 0xA9, 0x52, 0xA9, 0x52, 0x48, 0x4A, 
-    0xC6, 0x39, 0xE6, 0x39, 0xE7, 0x41, 0x07, 0x42, 0xC2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x18, 0xF0, 0x60, 0xF0, 0x58, 0xCB, 0x98, 0xC9, 0xB8, 0xC9, 0xA8, 
-    0x0B, 0x0A, 0x8B, 0x02, 0x0B, 0x22, 0x07, 0xB9, 0x07, 0xC1, 0xAA, 0x51, 0x2D, 0x0A, 0x4D, 0x12, 
-    0xC8, 0x50, 0x06, 0x78, 0x47, 0x60, 0xAA, 0x01, 0xEA, 0x01, 0x0A, 0x39, 0x08, 0xA0, 0x08, 0xA0, 
-    0x2A, 0x51, 0x8C, 0x02, 0x4C, 0x02, 0x05, 0x39, 0xA1, 0x48, 0xE2, 0x48, 0xE2, 0x89, 0x02, 0x9A, 
-    0x22, 0xA2, 0xA3, 0xB2, 0xA3, 0xB2, 0x42, 0xA2, 0x02, 0x92, 0x02, 0x92, 0x23, 0xA2, 0x43, 0xAA, 
-    0xC3, 0x79, 0xA4, 0x00, 0x83, 0x08, 0x48, 0x11, 0x4E, 0x1A, 0x2D, 0x1A, 0xC9, 0x30, 0x67, 0x40, 
-    0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xE9, 0x62, 0x74, 0xD6, 
-    0xD2, 0xC5, 0x17, 0xEF, 0xBA, 0xFF, 0x99, 0xF7, 0x58, 0xF7, 0x58, 0xEF, 0x58, 0xF7, 0x58, 0xEF, 
-    0x37, 0xEF, 0x58, 0xEF, 0x79, 0xF7, 0xFB, 0xFF, 0xAC, 0x73, 0x20, 0x00, 0x40, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x23, 0x10, 0xCF, 0x50, 0xCF, 0x48, 0x8A, 0x90, 0x88, 0xB8, 0x88, 0xA8, 
-    0x0B, 0x1A, 0x8B, 0x02, 0x0B, 0x22, 0x29, 0xB9, 0x28, 0xC1, 0xAB, 0x59, 0x4D, 0x1A, 0x4D, 0x22, 
-    0xC9, 0x58, 0x27, 0x70, 0x68, 0x60, 0x6A, 0x09, 0xAA, 0x01, 0xE9, 0x40, 0x08, 0xA0, 0x08, 0xA0, 
-    0x2A, 0x51, 0x6B, 0x02, 0x2B, 0x02, 0x04, 0x41, 0xC1, 0x50, 0xE2, 0x58, 0xE2, 0x99, 0xE1, 0xA1, 
-    0x22, 0xA2, 0xA3, 0xB2, 0x83, 0xB2, 0x42, 0xA2, 0xE2, 0x91, 0xE2, 0x91, 0x42, 0xAA, 0x62, 0xB2, 
-    0xE3, 0x81, 0xA4, 0x08, 0xA3, 0x10, 0x48, 0x11, 0x4E, 0x1A, 0x2D, 0x1A, 0xC8, 0x30, 0x66, 0x38, 
-    0x65, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x52, 0xF2, 0xC5, 
-    0x50, 0xAD, 0x75, 0xD6, 0x17, 0xE7, 0xF7, 0xE6, 0xB5, 0xDE, 0x95, 0xDE, 0xB5, 0xDE, 0x17, 0xE7, 
-    0x37, 0xEF, 0x37, 0xEF, 0xF7, 0xE6, 0xB9, 0xFF, 0x8C, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x45, 0x48, 0x45, 0x48, 0x67, 0x60, 0xCB, 0x80, 0xAB, 0x80, 0x2A, 0x61, 0x6A, 0x49, 0x29, 0x51, 
-    0x09, 0x41, 0x49, 0x31, 0x07, 0x21, 0x84, 0x48, 0xA4, 0x50, 0xC5, 0x28, 0x05, 0x11, 0x05, 0x11, 
-    0x63, 0x28, 0x43, 0x30, 0x64, 0x30, 0x4A, 0x19, 0x4A, 0x19, 0x2A, 0x29, 0x4A, 0x39, 0x4A, 0x39, 
-    0x4A, 0x49, 0x6A, 0x59, 0x2A, 0x59, 0x8A, 0x39, 0xCA, 0x29, 0xAA, 0x31, 0xE8, 0x39, 0x28, 0x3A, 
-    0xC7, 0x49, 0x43, 0x71, 0x22, 0x61, 0x63, 0x92, 0xC4, 0xCB, 0x24, 0xB3, 0x66, 0x79, 0x67, 0x89, 
-    0x26, 0x61, 0xA3, 0x08, 0xA2, 0x10, 0x47, 0x11, 0x4E, 0x1A, 0x2D, 0x1A, 0xC9, 0x48, 0x27, 0x58, 
-    0x87, 0x40, 0x07, 0x01, 0xE6, 0x00, 0xE5, 0x18, 0x62, 0x71, 0x01, 0x69, 0x8A, 0x93, 0xB5, 0xDE, 
-    0x33, 0xCE, 0xF7, 0xE6, 0x38, 0xEF, 0x38, 0xEF, 0x17, 0xEF, 0x17, 0xE7, 0x17, 0xEF, 0xD3, 0xC5, 
-    0x51, 0xBD, 0x14, 0xCE, 0x38, 0xEF, 0x58, 0xF7, 0xF4, 0xC5, 0x4F, 0x8C, 0xED, 0x83, 0x81, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 
-    0x8A, 0x88, 0x89, 0x78, 0xA9, 0x98, 0xE8, 0xA8, 0xC8, 0xB8, 0xCA, 0x31, 0x6B, 0x02, 0xCA, 0x09, 
-    0x46, 0x40, 0x47, 0x40, 0x43, 0x20, 0x40, 0x00, 0x40, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 
-    0x40, 0x08, 0x40, 0x00, 0x62, 0x08, 0x2A, 0x29, 0x0A, 0x29, 0x4A, 0x21, 0x2B, 0x02, 0x2B, 0x02, 
-    0x8A, 0x41, 0xE8, 0xB8, 0xE8, 0xB0, 0xEC, 0x39, 0x4E, 0x12, 0x2D, 0x1A, 0x2C, 0x02, 0x6C, 0x02, 
-    0xAA, 0x19, 0xA2, 0x48, 0x82, 0x38, 0x84, 0x8A, 0xE5, 0xF4, 0xE5, 0xC3, 0xA9, 0x58, 0x6A, 0x60, 
-    0x88, 0x48, 0xA3, 0x08, 0x82, 0x10, 0x27, 0x11, 0x2E, 0x1A, 0x2D, 0x12, 0xA9, 0x50, 0x07, 0x70, 
-    0x88, 0x50, 0xCB, 0x01, 0xAB, 0x01, 0xA9, 0x21, 0xE3, 0x99, 0x61, 0x91, 0x0C, 0xB4, 0xF7, 0xE6, 
-    0x75, 0xDE, 0xF7, 0xE6, 0x18, 0xEF, 0x18, 0xEF, 0x59, 0xEF, 0x59, 0xF7, 0x9A, 0xF7, 0x67, 0x72, 
-    0x60, 0x40, 0x09, 0x83, 0x99, 0xF7, 0x17, 0xEF, 0x79, 0xF7, 0xDA, 0xFF, 0xDB, 0xFF, 0x24, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x18, 
-    0x69, 0x78, 0x69, 0x68, 0x89, 0x90, 0xA8, 0xB8, 0x88, 0xB8, 0xEA, 0x31, 0x8C, 0x02, 0xCB, 0x11, 
-    0x67, 0x48, 0x88, 0x48, 0x64, 0x20, 0x40, 0x08, 0x41, 0x10, 0x41, 0x10, 0x41, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x62, 0x10, 0x2A, 0x29, 0x2A, 0x29, 0x4A, 0x21, 0xEA, 0x01, 0x0A, 0x02, 
-    0x8A, 0x41, 0xE8, 0xC0, 0x08, 0xB1, 0xEC, 0x31, 0x2D, 0x12, 0x0D, 0x1A, 0x2B, 0x0A, 0x4B, 0x02, 
-    0x69, 0x29, 0xA2, 0x58, 0x82, 0x40, 0x84, 0x92, 0xE4, 0xF4, 0x24, 0xD4, 0xA9, 0x68, 0x69, 0x70, 
-    0x87, 0x58, 0xA3, 0x08, 0x82, 0x10, 0x26, 0x11, 0x4E, 0x1A, 0x4D, 0x12, 0xC9, 0x50, 0x07, 0x68, 
-    0x88, 0x50, 0xAA, 0x01, 0x8A, 0x01, 0x88, 0x19, 0xC2, 0x91, 0x61, 0x89, 0xCB, 0xAB, 0x78, 0xEF, 
-    0xF6, 0xE6, 0x79, 0xF7, 0x9A, 0xF7, 0x99, 0xF7, 0x59, 0xF7, 0x59, 0xEF, 0x9A, 0xF7, 0x67, 0x72, 
-    0x20, 0x40, 0xA8, 0x72, 0x99, 0xF7, 0x38, 0xEF, 0x38, 0xEF, 0x38, 0xEF, 0x38, 0xEF, 0x03, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 
-    0x49, 0x78, 0x49, 0x80, 0xC9, 0x70, 0x6A, 0x61, 0x4A, 0x69, 0x29, 0x49, 0x4A, 0x39, 0xE9, 0x40, 
-    0x44, 0x28, 0x45, 0x28, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x40, 0x08, 0x62, 0x10, 0xC9, 0x20, 0xA9, 0x28, 0x6B, 0x19, 0x2C, 0x0A, 0x2C, 0x0A, 
-    0xCC, 0x31, 0x8B, 0x69, 0x6A, 0x69, 0x6A, 0x71, 0x6A, 0x71, 0x4A, 0x71, 0xCC, 0x29, 0x0D, 0x1A, 
-    0xCC, 0x21, 0x89, 0x19, 0xA9, 0x09, 0x88, 0x39, 0x06, 0x72, 0x27, 0x72, 0x4B, 0x41, 0x4B, 0x41, 
-    0x0A, 0x31, 0xA6, 0x10, 0xA6, 0x10, 0xC7, 0x18, 0x2A, 0x19, 0x2A, 0x19, 0x89, 0x50, 0x28, 0x68, 
-    0xA9, 0x48, 0x8A, 0x01, 0x8A, 0x01, 0x68, 0x19, 0x82, 0x81, 0x61, 0x81, 0x25, 0x82, 0x0A, 0x83, 
-    0xE9, 0x82, 0x6B, 0x93, 0x6B, 0x9B, 0x4B, 0x9B, 0xB7, 0xE6, 0x58, 0xEF, 0x58, 0xEF, 0x72, 0xBD, 
-    0xAF, 0xAC, 0x92, 0xBD, 0x59, 0xEF, 0x38, 0xEF, 0x38, 0xEF, 0x59, 0xF7, 0x59, 0xEF, 0x04, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 
-    0x49, 0x88, 0x08, 0x98, 0x49, 0x49, 0x8B, 0x02, 0x4B, 0x02, 0x68, 0x60, 0x07, 0x70, 0x27, 0x58, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x10, 0x88, 0x18, 0x68, 0x18, 0x6B, 0x19, 0x6E, 0x1A, 0x4E, 0x1A, 
-    0x0D, 0x22, 0x2D, 0x12, 0xEC, 0x29, 0x08, 0xB1, 0x08, 0xB9, 0x08, 0xB1, 0x0D, 0x32, 0x4E, 0x1A, 
-    0x2D, 0x1A, 0x0B, 0x02, 0x2B, 0x02, 0xE9, 0x10, 0x08, 0x18, 0x69, 0x10, 0x2D, 0x0A, 0x6E, 0x0A, 
-    0xAC, 0x11, 0x89, 0x18, 0xA9, 0x18, 0x88, 0x18, 0x67, 0x20, 0x67, 0x18, 0x69, 0x50, 0x69, 0x68, 
-    0xA9, 0x50, 0x8A, 0x01, 0x8A, 0x01, 0x68, 0x19, 0x42, 0x79, 0x62, 0x79, 0x01, 0x69, 0x81, 0x48, 
-    0x81, 0x40, 0xA1, 0x58, 0xA1, 0x60, 0xA2, 0x60, 0x35, 0xD6, 0x58, 0xEF, 0x17, 0xEF, 0x58, 0xEF, 
-    0x79, 0xF7, 0x78, 0xF7, 0x38, 0xEF, 0x38, 0xEF, 0x58, 0xEF, 0x59, 0xF7, 0x59, 0xEF, 0x24, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 
-    0x49, 0x90, 0x09, 0x98, 0x4A, 0x49, 0x8B, 0x02, 0x4B, 0x02, 0x68, 0x58, 0x07, 0x70, 0x26, 0x58, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x08, 0x40, 0x08, 0x41, 0x08, 0x88, 0x18, 0x68, 0x18, 0x6B, 0x19, 0x8E, 0x1A, 0x6E, 0x1A, 
-    0x2D, 0x22, 0x2D, 0x22, 0xCC, 0x39, 0x08, 0xB1, 0x08, 0xB9, 0x08, 0xB9, 0x0D, 0x32, 0x4E, 0x1A, 
-    0x2D, 0x1A, 0x0A, 0x02, 0x2B, 0x02, 0xE9, 0x10, 0x28, 0x20, 0xA9, 0x18, 0x0D, 0x1A, 0x4D, 0x12, 
-    0xAB, 0x11, 0x88, 0x10, 0xA9, 0x10, 0x88, 0x18, 0x88, 0x20, 0x88, 0x18, 0x69, 0x50, 0x69, 0x68, 
-    0xA9, 0x50, 0xAA, 0x01, 0xAB, 0x01, 0x89, 0x11, 0x42, 0x79, 0x62, 0x79, 0x42, 0x71, 0x02, 0x51, 
-    0x02, 0x51, 0xE2, 0x58, 0x81, 0x60, 0xC2, 0x60, 0x55, 0xD6, 0x58, 0xEF, 0x18, 0xEF, 0x17, 0xEF, 
-    0x17, 0xE7, 0x38, 0xEF, 0x59, 0xF7, 0x59, 0xF7, 0x79, 0xF7, 0x79, 0xF7, 0x7A, 0xF7, 0x24, 0x21, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 
-    0x87, 0x70, 0x66, 0x70, 0x09, 0x61, 0xAA, 0x51, 0x8A, 0x51, 0x09, 0x51, 0x0A, 0x49, 0x09, 0x39, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x20, 0x68, 0x28, 0xEA, 0x28, 0x8C, 0x29, 0x6B, 0x29, 
-    0x0D, 0x1A, 0x4E, 0x1A, 0x0D, 0x22, 0xAA, 0x51, 0xAA, 0x51, 0xAA, 0x51, 0x0D, 0x22, 0x4E, 0x1A, 
-    0xAB, 0x29, 0xC8, 0x40, 0xC9, 0x38, 0x46, 0x69, 0xC4, 0x91, 0x86, 0x71, 0xAB, 0x09, 0xCB, 0x09, 
-    0x6A, 0x11, 0xA9, 0x20, 0xCA, 0x20, 0x86, 0x18, 0x42, 0x10, 0x62, 0x10, 0x86, 0x30, 0x88, 0x40, 
-    0x87, 0x38, 0xE5, 0x30, 0xE5, 0x30, 0xE4, 0x30, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x51, 0x22, 0x61, 
-    0xE1, 0x58, 0xE9, 0x8A, 0xB0, 0xBC, 0x8F, 0xB4, 0x96, 0xDE, 0x17, 0xEF, 0xD6, 0xDE, 0x54, 0xCE, 
-    0x74, 0xD6, 0x54, 0xCE, 0xD2, 0xBD, 0xD2, 0xBD, 0xD2, 0xBD, 0xD3, 0xBD, 0xD3, 0xBD, 0xE3, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 
-    0xE2, 0x48, 0xE1, 0x38, 0xC7, 0x70, 0xE8, 0xC0, 0xE8, 0xB0, 0xEB, 0x29, 0x4D, 0x12, 0x0C, 0x12, 
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x28, 0x67, 0x30, 0x88, 0x30, 0xAA, 0x38, 0xA9, 0x38, 
-    0xED, 0x19, 0x6E, 0x12, 0x4D, 0x12, 0x2B, 0x02, 0x4B, 0x02, 0x2B, 0x02, 0x0D, 0x1A, 0x4D, 0x1A, 
-    0x4B, 0x31, 0x27, 0x58, 0x28, 0x50, 0xA4, 0x89, 0x81, 0xBA, 0x24, 0x9A, 0x8A, 0x09, 0x8A, 0x09, 
-    0x4A, 0x11, 0xC9, 0x28, 0xEA, 0x28, 0x85, 0x18, 0x40, 0x08, 0x40, 0x08, 0x65, 0x28, 0x87, 0x38, 
-    0x86, 0x38, 0xA2, 0x48, 0xA1, 0x50, 0xA1, 0x48, 0xA2, 0x28, 0xA2, 0x28, 0xC2, 0x40, 0x62, 0x71, 
-    0xC0, 0x60, 0xD0, 0xBC, 0xFC, 0xFF, 0x79, 0xF7, 0xF6, 0xE6, 0xF6, 0xE6, 0x95, 0xD6, 0xD2, 0xBD, 
-    0xF2, 0xC5, 0xD2, 0xBD, 0x2F, 0xAD, 0x2F, 0xAD, 0x0F, 0xA5, 0x30, 0xA5, 0x30, 0xAD, 0xC2, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 
-    0xC2, 0x50, 0xC1, 0x40, 0xC7, 0x70, 0x09, 0xB9, 0xE9, 0xA8, 0xCC, 0x39, 0x2E, 0x22, 0xEC, 0x19, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x28, 0x68, 0x28, 0x89, 0x30, 0xCA, 0x38, 0xCA, 0x38, 
-    0xED, 0x19, 0x4E, 0x12, 0x2E, 0x12, 0x2B, 0x02, 0x2B, 0x02, 0x0B, 0x0A, 0x0D, 0x22, 0x4E, 0x22, 
-    0x6B, 0x39, 0x47, 0x50, 0x48, 0x48, 0xA4, 0x89, 0x62, 0xB2, 0x24, 0x92, 0x6B, 0x01, 0x6B, 0x01, 
-    0x2A, 0x11, 0xC9, 0x28, 0xCA, 0x28, 0x85, 0x18, 0x20, 0x08, 0x00, 0x00, 0x44, 0x28, 0x87, 0x38, 
-    0x86, 0x38, 0xA2, 0x48, 0xA2, 0x48, 0xA2, 0x40, 0xC2, 0x30, 0xC2, 0x30, 0xC1, 0x40, 0x01, 0x69, 
-    0x80, 0x58, 0x6F, 0xB4, 0x99, 0xF7, 0xF7, 0xE6, 0xD6, 0xDE, 0xF6, 0xE6, 0x95, 0xD6, 0xF2, 0xC5, 
-    0x13, 0xC6, 0xD2, 0xBD, 0x50, 0xAD, 0x30, 0xAD, 0x51, 0xB5, 0x31, 0xAD, 0xF1, 0xA4, 0xC2, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 
-    0xC2, 0x48, 0xC2, 0x48, 0xE4, 0x60, 0xE6, 0x80, 0xE5, 0x78, 0xC6, 0x48, 0xE6, 0x40, 0xE5, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x40, 0x20, 0x81, 0x30, 0x81, 0x30, 0xC3, 0x40, 0xC3, 0x48, 0xC5, 0x30, 0xC8, 0x10, 0xC7, 0x18, 
-    0xE6, 0x10, 0xE5, 0x10, 0xE5, 0x10, 0x49, 0x09, 0x69, 0x09, 0x49, 0x09, 0xE6, 0x18, 0xC6, 0x10, 
-    0x45, 0x49, 0x84, 0xB2, 0x84, 0xAA, 0xA3, 0x79, 0x22, 0x61, 0x42, 0x69, 0x45, 0x8A, 0x85, 0x9A, 
-    0xE6, 0x69, 0xC8, 0x08, 0x08, 0x11, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 
-    0x01, 0x08, 0x00, 0x08, 0x00, 0x08, 0x20, 0x18, 0xC2, 0x48, 0x61, 0x40, 0x47, 0x6A, 0xCE, 0xAC, 
-    0x4D, 0xA4, 0x34, 0xD6, 0x79, 0xF7, 0x38, 0xEF, 0x17, 0xE7, 0x38, 0xEF, 0xD6, 0xDE, 0xF2, 0xC5, 
-    0x12, 0xC6, 0xF2, 0xC5, 0xB2, 0xBD, 0x13, 0xC6, 0x68, 0x52, 0xA3, 0x18, 0x83, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x50, 0x01, 0x51, 0xE2, 0x50, 0x81, 0x30, 0x81, 0x30, 0x61, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE1, 0x48, 0x42, 0x69, 0x22, 0x61, 0x02, 0x51, 0x02, 0x59, 0xE4, 0x30, 0xC6, 0x00, 0xE6, 0x08, 
-    0xA4, 0x10, 0x82, 0x10, 0xA3, 0x10, 0x08, 0x09, 0x29, 0x01, 0x08, 0x01, 0x83, 0x10, 0x62, 0x00, 
-    0x43, 0x49, 0x24, 0xCB, 0x04, 0xCB, 0x82, 0x79, 0xE2, 0x50, 0x22, 0x59, 0xA3, 0xBA, 0x03, 0xD3, 
-    0x44, 0x8A, 0xC7, 0x00, 0x07, 0x11, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0xC2, 0x50, 0x41, 0x40, 0xE9, 0x82, 0x53, 0xCE, 
-    0xB1, 0xBD, 0xB6, 0xDE, 0x58, 0xF7, 0x38, 0xEF, 0x38, 0xEF, 0x59, 0xF7, 0xF7, 0xE6, 0xF2, 0xC5, 
-    0x13, 0xC6, 0xF2, 0xC5, 0xD2, 0xBD, 0x54, 0xCE, 0x84, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC2, 0x40, 0xC2, 0x48, 0xE2, 0x50, 0xE2, 0x58, 0xE2, 0x58, 0x82, 0x30, 0x82, 0x30, 0x82, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE1, 0x48, 0x22, 0x61, 0x02, 0x59, 0xC2, 0x48, 0xC2, 0x48, 0xC4, 0x28, 0xE7, 0x00, 0xE7, 0x08, 
-    0xC5, 0x08, 0xA3, 0x10, 0xA4, 0x08, 0x28, 0x01, 0x49, 0x01, 0x28, 0x01, 0xA3, 0x10, 0x82, 0x00, 
-    0x43, 0x49, 0x04, 0xCB, 0xE4, 0xC2, 0x83, 0x79, 0xE2, 0x50, 0x22, 0x61, 0xA3, 0xB2, 0xE3, 0xCA, 
-    0x25, 0x82, 0xC8, 0x00, 0x08, 0x09, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0xE3, 0x58, 0x61, 0x48, 0xC8, 0x7A, 0xF2, 0xC5, 
-    0x70, 0xB5, 0x95, 0xDE, 0x59, 0xF7, 0x38, 0xEF, 0x38, 0xEF, 0x58, 0xEF, 0xF7, 0xE6, 0xF2, 0xC5, 
-    0x13, 0xC6, 0x12, 0xC6, 0xF2, 0xC5, 0x54, 0xCE, 0xC5, 0x39, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x28, 0x81, 0x38, 0xA1, 0x40, 
-    0x42, 0x71, 0x62, 0x71, 0x42, 0x71, 0x42, 0x69, 0x42, 0x69, 0x02, 0x59, 0x02, 0x59, 0xE2, 0x50, 
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x38, 0xE2, 0x48, 0xC2, 0x48, 0xC3, 0x81, 0x23, 0x92, 0x43, 0x51, 0xA4, 0x20, 0xA4, 0x28, 
-    0xA3, 0x28, 0xA2, 0x28, 0xA3, 0x28, 0xC8, 0x28, 0xC9, 0x28, 0xC8, 0x28, 0xA6, 0x28, 0x66, 0x20, 
-    0x26, 0x59, 0xC4, 0xC2, 0xC4, 0xC2, 0xA2, 0x81, 0x02, 0x69, 0x22, 0x69, 0x23, 0x9A, 0x63, 0xB2, 
-    0xE3, 0x89, 0xA5, 0x30, 0xE5, 0x38, 0x41, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x18, 0x00, 0x10, 0x47, 0x52, 0xD2, 0xBD, 
-    0x50, 0xAD, 0xB6, 0xDE, 0x79, 0xF7, 0x38, 0xEF, 0x38, 0xEF, 0x59, 0xF7, 0xF7, 0xE6, 0xF2, 0xC5, 
-    0x12, 0xC6, 0xD2, 0xBD, 0x31, 0xAD, 0x92, 0xB5, 0x85, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x48, 0xE2, 0x60, 0x02, 0x69, 
-    0xC2, 0x91, 0xC2, 0x89, 0xA2, 0x81, 0x82, 0x79, 0x82, 0x79, 0x62, 0x79, 0x82, 0x79, 0x42, 0x71, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x30, 0xA2, 0x40, 0xC2, 0x40, 0xE4, 0xBA, 0x64, 0xDB, 0xC3, 0x79, 0x62, 0x30, 0xA2, 0x40, 
-    0xA2, 0x38, 0xA2, 0x40, 0xA2, 0x40, 0x87, 0x48, 0x68, 0x48, 0x88, 0x40, 0x88, 0x40, 0x68, 0x38, 
-    0x07, 0x61, 0xC3, 0xBA, 0xC4, 0xBA, 0xC3, 0x89, 0x22, 0x71, 0x22, 0x71, 0xC2, 0x89, 0x22, 0xA2, 
-    0xC2, 0x91, 0xC1, 0x60, 0xE2, 0x70, 0x61, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42, 0xF2, 0xC5, 
-    0x50, 0xAD, 0xD6, 0xDE, 0x79, 0xF7, 0x58, 0xEF, 0x58, 0xEF, 0x79, 0xF7, 0x17, 0xE7, 0xF2, 0xC5, 
-    0xF2, 0xC5, 0xD2, 0xBD, 0xF0, 0x9C, 0x52, 0xAD, 0x85, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x48, 0xC2, 0x58, 0xE2, 0x60, 
-    0xC2, 0x89, 0xC2, 0x89, 0xA2, 0x81, 0x62, 0x79, 0x62, 0x79, 0x62, 0x79, 0x62, 0x79, 0x42, 0x69, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x30, 0xA2, 0x40, 0xA2, 0x40, 0xC4, 0xB2, 0x44, 0xD3, 0xA3, 0x71, 0x62, 0x30, 0xA2, 0x40, 
-    0xA2, 0x38, 0xA1, 0x38, 0xA2, 0x40, 0x88, 0x40, 0x89, 0x48, 0x89, 0x40, 0x88, 0x40, 0x48, 0x38, 
-    0x07, 0x61, 0xE4, 0xCA, 0xE4, 0xCA, 0xC3, 0x91, 0x02, 0x69, 0x22, 0x69, 0xE2, 0x91, 0x62, 0xB2, 
-    0xC2, 0x91, 0xA2, 0x50, 0xC2, 0x58, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42, 0xF2, 0xC5, 
-    0x50, 0xAD, 0xD6, 0xDE, 0x79, 0xF7, 0x58, 0xEF, 0x38, 0xEF, 0x58, 0xEF, 0x17, 0xE7, 0xF2, 0xC5, 
-    0xF2, 0xC5, 0xD2, 0xBD, 0x11, 0xA5, 0x92, 0xB5, 0x85, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x50, 0xC2, 0x58, 0xE2, 0x58, 
-    0x42, 0x71, 0x42, 0x69, 0x82, 0x79, 0xA2, 0x81, 0xA2, 0x81, 0x42, 0x69, 0x22, 0x61, 0x02, 0x51, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x40, 0xE2, 0x58, 0xE2, 0x50, 0x63, 0x71, 0x82, 0x81, 0x04, 0x49, 0xC6, 0x18, 0xC6, 0x20, 
-    0xC5, 0x20, 0xC5, 0x18, 0xC5, 0x20, 0xA5, 0x20, 0xA5, 0x20, 0xA5, 0x20, 0xA5, 0x20, 0x85, 0x20, 
-    0xC4, 0x28, 0x63, 0x51, 0x43, 0x49, 0x83, 0x71, 0x02, 0x9A, 0xC3, 0x89, 0xE5, 0x60, 0x26, 0x71, 
-    0xC4, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x03, 0x21, 
-    0xE2, 0x18, 0xD1, 0x9C, 0xBA, 0xFF, 0xD7, 0xE6, 0x71, 0xB5, 0x71, 0xB5, 0x91, 0xB5, 0xD2, 0xBD, 
-    0xD2, 0xBD, 0xB2, 0xBD, 0x31, 0xA5, 0xB3, 0xB5, 0x85, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x50, 0xE2, 0x60, 0xE2, 0x58, 
-    0xE2, 0x58, 0xE2, 0x58, 0x62, 0x79, 0xC2, 0x89, 0xC2, 0x89, 0x22, 0x61, 0xC2, 0x40, 0xC1, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC1, 0x48, 0x22, 0x61, 0x02, 0x61, 0x02, 0x59, 0x01, 0x61, 0xE5, 0x30, 0x08, 0x01, 0x08, 0x09, 
-    0x08, 0x09, 0xE7, 0x08, 0xE6, 0x08, 0xA3, 0x08, 0xA3, 0x08, 0xA3, 0x08, 0xA3, 0x08, 0xA3, 0x08, 
-    0xA2, 0x08, 0x82, 0x08, 0x62, 0x00, 0x63, 0x59, 0xA2, 0xC2, 0x23, 0x9A, 0x68, 0x40, 0x68, 0x40, 
-    0x46, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x90, 0x94, 0xFB, 0xFF, 0x18, 0xEF, 0x70, 0xB5, 0x70, 0xB5, 0x91, 0xB5, 0xD2, 0xBD, 
-    0xF2, 0xBD, 0xD2, 0xBD, 0x72, 0xAD, 0xF4, 0xBD, 0xA5, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x58, 0x02, 0x69, 0x02, 0x61, 
-    0x02, 0x61, 0x02, 0x59, 0x82, 0x79, 0xC2, 0x89, 0xC2, 0x89, 0x42, 0x61, 0xE2, 0x50, 0xE2, 0x48, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC1, 0x48, 0x22, 0x61, 0x02, 0x59, 0x02, 0x59, 0x22, 0x61, 0x05, 0x39, 0xE8, 0x08, 0x07, 0x11, 
-    0xE7, 0x10, 0xC7, 0x10, 0xC6, 0x10, 0x83, 0x10, 0x82, 0x10, 0x83, 0x10, 0x82, 0x10, 0x82, 0x10, 
-    0xA2, 0x10, 0xA2, 0x18, 0x82, 0x08, 0x83, 0x61, 0xA3, 0xC2, 0x03, 0xA2, 0x67, 0x48, 0x68, 0x50, 
-    0x45, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x0E, 0x84, 0xF8, 0xE6, 0x14, 0xC6, 0xEF, 0xA4, 0x2F, 0xAD, 0x30, 0xAD, 0x91, 0xB5, 
-    0x91, 0xB5, 0x71, 0xB5, 0xD0, 0x9C, 0x31, 0xA5, 0x65, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x81, 0x30, 0x81, 0x38, 
-    0xE2, 0x58, 0xC2, 0x58, 0x22, 0x61, 0x22, 0x61, 0x42, 0x69, 0x81, 0x30, 0x40, 0x20, 0x40, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC1, 0x48, 0x22, 0x61, 0x02, 0x59, 0x02, 0x59, 0x02, 0x61, 0x04, 0x41, 0xE8, 0x08, 0xE7, 0x10, 
-    0x08, 0x09, 0x49, 0x09, 0x49, 0x09, 0x28, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x09, 
-    0xC5, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xC4, 0x20, 0x04, 0x39, 0xE5, 0x30, 0xC8, 0x20, 0xE9, 0x20, 
-    0x85, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x20, 0x00, 0x40, 0x08, 0x61, 0x08, 0x61, 0x08, 0xA2, 0x10, 
-    0xA2, 0x10, 0xA2, 0x10, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 
-    0xC2, 0x50, 0xC2, 0x50, 0xA2, 0x48, 0xA2, 0x40, 0xC2, 0x48, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC1, 0x48, 0x22, 0x61, 0x02, 0x59, 0x02, 0x59, 0x02, 0x61, 0x04, 0x41, 0x08, 0x09, 0xE7, 0x10, 
-    0x49, 0x09, 0xEC, 0x09, 0xEB, 0x09, 0x0C, 0x12, 0x0C, 0x12, 0x0C, 0x12, 0xEC, 0x09, 0x0C, 0x0A, 
-    0x27, 0x09, 0x82, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0x82, 0x08, 0xA3, 0x08, 0x08, 0x09, 0x29, 0x09, 
-    0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x18, 
-    0xC2, 0x58, 0xC2, 0x50, 0xC2, 0x48, 0xC2, 0x48, 0xE2, 0x50, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE1, 0x48, 0x22, 0x69, 0x02, 0x61, 0x02, 0x59, 0x02, 0x61, 0xE4, 0x40, 0x08, 0x09, 0xE7, 0x10, 
-    0x49, 0x09, 0xEC, 0x09, 0xCB, 0x09, 0xEC, 0x11, 0x0C, 0x12, 0xEB, 0x11, 0xCB, 0x09, 0xEC, 0x09, 
-    0x27, 0x09, 0x82, 0x10, 0x82, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA3, 0x10, 0xE7, 0x08, 0x08, 0x11, 
-    0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x08, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x18, 0xA1, 0x30, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0xA3, 0x18, 0xE7, 0x08, 0xE7, 0x10, 
-    0xE7, 0x08, 0x29, 0x09, 0x29, 0x09, 0xCB, 0x11, 0xEB, 0x09, 0xEB, 0x09, 0xCB, 0x09, 0xEB, 0x09, 
-    0xAA, 0x09, 0x69, 0x11, 0x89, 0x11, 0x07, 0x11, 0xC5, 0x10, 0xC6, 0x10, 0x62, 0x08, 0x62, 0x08, 
-    0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x41, 0x08, 0x21, 0x08, 0x41, 0x08, 0x40, 0x08, 0x83, 0x08, 0xE7, 0x10, 0xE7, 0x10, 
-    0xE7, 0x10, 0xE7, 0x10, 0xC7, 0x10, 0xAB, 0x09, 0xEC, 0x09, 0xCB, 0x09, 0xEB, 0x09, 0xEB, 0x09, 
-    0x0C, 0x0A, 0x0C, 0x12, 0x2D, 0x12, 0x49, 0x09, 0xC7, 0x08, 0xE7, 0x08, 0x41, 0x08, 0x40, 0x08, 
-    0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x61, 0x10, 0x41, 0x08, 0x41, 0x10, 0x40, 0x08, 0x83, 0x10, 0xE7, 0x10, 0xE7, 0x10, 
-    0xE7, 0x10, 0xE7, 0x10, 0xE7, 0x10, 0xAB, 0x09, 0xEB, 0x09, 0xCB, 0x09, 0xEB, 0x09, 0xEB, 0x09, 
-    0xEC, 0x11, 0xEC, 0x11, 0x0C, 0x12, 0x29, 0x09, 0xC7, 0x08, 0xE7, 0x08, 0x41, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x30, 0xC2, 0x48, 0xA3, 0x30, 0xC6, 0x08, 0xC6, 0x10, 0xC6, 0x10, 0xE7, 0x10, 0xE7, 0x10, 
-    0xC5, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xE6, 0x10, 0xE7, 0x10, 0x07, 0x11, 0xCB, 0x09, 0xEB, 0x09, 
-    0xEB, 0x09, 0xCB, 0x09, 0xEC, 0x09, 0x49, 0x09, 0x08, 0x09, 0x08, 0x09, 0x61, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA1, 0x40, 0xE2, 0x60, 0xC4, 0x38, 0xE7, 0x08, 0xE7, 0x10, 0xE7, 0x10, 0xE7, 0x10, 0xE7, 0x10, 
-    0xA4, 0x10, 0xA2, 0x10, 0xA2, 0x10, 0xA5, 0x10, 0xA5, 0x10, 0xC6, 0x08, 0xCB, 0x09, 0xEB, 0x09, 
-    0xCB, 0x09, 0xCB, 0x09, 0xEB, 0x09, 0x49, 0x09, 0x28, 0x09, 0x08, 0x09, 0x41, 0x08, 0x41, 0x08, 
-    0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-    0xA1, 0x38, 0xE2, 0x58, 0xC3, 0x38, 0xE7, 0x08, 0xE6, 0x10, 0xE7, 0x10, 0xE7, 0x10, 0xE7, 0x10, 
-    0xC4, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xC5, 0x10, 0xC6, 0x10, 0xE6, 0x10, 0xCB, 0x09, 0xCB, 0x09, 
-    0xCB, 0x09, 0xCB, 0x09, 0xCB, 0x09, 0x49, 0x09, 0x28, 0x09, 0x08, 0x09, 0x61, 0x10, 0x61, 0x10, 
-    0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x30, 0xC2, 0x48, 0xA2, 0x40, 
-    0xC2, 0x48, 0xE2, 0x58, 0xE4, 0x38, 0xE8, 0x08, 0xE7, 0x10, 0xE7, 0x08, 0xE7, 0x10, 0xE7, 0x10, 
-    0xC5, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0x41, 0x00, 0x21, 0x00, 0x62, 0x08, 0xE6, 0x10, 0xC6, 0x10, 
-    0x07, 0x09, 0x6A, 0x09, 0x6A, 0x09, 0x28, 0x09, 0x08, 0x09, 0x07, 0x19, 0x42, 0x71, 0x62, 0x81, 
-    0xC1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x38, 0xE2, 0x50, 0xC2, 0x48, 
-    0xE2, 0x50, 0xE2, 0x58, 0xE4, 0x38, 0xE8, 0x08, 0xE7, 0x10, 0xE7, 0x08, 0xE7, 0x10, 0xE7, 0x10, 
-    0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x08, 0xA5, 0x10, 
-    0xC6, 0x08, 0x49, 0x09, 0x6A, 0x09, 0x28, 0x09, 0x08, 0x09, 0x07, 0x21, 0x62, 0x81, 0x82, 0x89, 
-    0xC1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA1, 0x38, 0xE2, 0x50, 0xC2, 0x48, 
-    0xE2, 0x50, 0xE2, 0x58, 0xE4, 0x38, 0xE8, 0x08, 0xE7, 0x10, 0xE7, 0x08, 0xE7, 0x10, 0xE7, 0x10, 
-    0xC5, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x08, 0xC5, 0x10, 
-    0xC6, 0x08, 0x4A, 0x09, 0x4A, 0x09, 0x09, 0x09, 0xE8, 0x00, 0x07, 0x19, 0x62, 0x79, 0x82, 0x89, 
-    0xE1, 0x50, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xC2, 0x71, 0x43, 0x9A, 0x82, 0x69, 0x81, 0x38, 0xA2, 0x40, 0xE2, 0x50, 0xE2, 0x58, 0xE2, 0x50, 
-    0xE2, 0x50, 0xE2, 0x58, 0xC2, 0x50, 0xC3, 0x40, 0xC3, 0x48, 0xC4, 0x30, 0xE7, 0x08, 0xE7, 0x10, 
-    0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10, 0xA2, 0x10, 
-    0xA3, 0x20, 0xE4, 0x50, 0xE3, 0x48, 0x03, 0x59, 0x63, 0x69, 0x63, 0x69, 0x82, 0x81, 0x82, 0x81, 
-    0x62, 0x79, 0x02, 0x61, 0x22, 0x69, 0xC1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xE4, 0xBA, 0x64, 0xDB, 0x03, 0x92, 0x82, 0x38, 0xC2, 0x48, 0xE2, 0x50, 0xE2, 0x58, 0xE2, 0x58, 
-    0xE2, 0x58, 0xE2, 0x58, 0xE2, 0x50, 0xE2, 0x50, 0xE2, 0x58, 0xE3, 0x40, 0xE7, 0x08, 0xE7, 0x10, 
-    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10, 0xA2, 0x10, 
-    0xA2, 0x20, 0xE2, 0x68, 0xE2, 0x60, 0x42, 0x71, 0xA2, 0x89, 0xA2, 0x81, 0xA2, 0x81, 0xA2, 0x81, 
-    0x82, 0x81, 0x42, 0x71, 0x42, 0x79, 0xE1, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xE4, 0xBA, 0x44, 0xDB, 0x03, 0x92, 0x82, 0x38, 0xA2, 0x40, 0xE2, 0x50, 0x02, 0x59, 0x02, 0x59, 
-    0x02, 0x59, 0xE2, 0x58, 0xE2, 0x50, 0xE2, 0x50, 0xE2, 0x58, 0xE4, 0x40, 0xC6, 0x00, 0xE7, 0x08, 
-    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0xA2, 0x10, 
-    0xC2, 0x28, 0xE2, 0x60, 0xE2, 0x58, 0x42, 0x71, 0xA2, 0x89, 0xA2, 0x81, 0xA2, 0x81, 0xA2, 0x81, 
-    0x82, 0x81, 0x22, 0x69, 0x42, 0x71, 0xC1, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x61, 0xA3, 0x71, 0x62, 0x69, 0x42, 0x69, 0x42, 0x71, 0x02, 0x59, 0xE2, 0x48, 0xE2, 0x50, 
-    0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x40, 0xA2, 0x40, 0xA2, 0x40, 0xC3, 0x40, 0xC3, 0x40, 
-    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0x61, 0x20, 0xC2, 0x50, 0xA2, 0x48, 0xE2, 0x58, 0x02, 0x61, 0x22, 0x69, 0xA2, 0x81, 0x82, 0x81, 
-    0x82, 0x81, 0x62, 0x79, 0x82, 0x81, 0x21, 0x61, 0x60, 0x28, 0x81, 0x30, 0x00, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0xC1, 0x48, 0xC1, 0x48, 0xE1, 0x48, 0xE1, 0x50, 0x01, 0x61, 0x80, 0x30, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x61, 0x28, 0x62, 0x28, 0xC2, 0x48, 0x62, 0x79, 0x62, 0x79, 0x22, 0x61, 0xE2, 0x48, 0xE2, 0x48, 
-    0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x38, 0xA2, 0x30, 0xA2, 0x40, 0xC2, 0x50, 0xE2, 0x58, 
-    0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x40, 0x18, 0xC2, 0x50, 0xA2, 0x48, 0xC2, 0x50, 0xA2, 0x50, 0xE2, 0x58, 0xA2, 0x81, 0xA2, 0x81, 
-    0x82, 0x81, 0x82, 0x81, 0x82, 0x81, 0x62, 0x79, 0x22, 0x61, 0x42, 0x71, 0x60, 0x20, 0x00, 0x00, 
-    0x20, 0x08, 0x42, 0x79, 0x62, 0x79, 0x62, 0x79, 0x62, 0x79, 0x62, 0x81, 0xC1, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x82, 0x30, 0xA2, 0x38, 0xE2, 0x48, 0x62, 0x79, 0x62, 0x79, 0x22, 0x61, 0xE2, 0x48, 0xE2, 0x48, 
-    0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x30, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x40, 0xC2, 0x50, 0xC2, 0x50, 
-    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x18, 0xA2, 0x48, 0xA2, 0x40, 0xC2, 0x50, 0xC2, 0x50, 0xE2, 0x60, 0xA2, 0x81, 0xA2, 0x81, 
-    0xA2, 0x81, 0x82, 0x81, 0xA2, 0x81, 0x62, 0x79, 0xE2, 0x50, 0x02, 0x61, 0x61, 0x20, 0x20, 0x00, 
-    0x41, 0x08, 0x22, 0x69, 0x42, 0x71, 0x42, 0x71, 0x42, 0x71, 0x42, 0x79, 0xA1, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA2, 0x38, 0xC2, 0x40, 0xE2, 0x50, 0x42, 0x69, 0x42, 0x69, 0x22, 0x61, 0x02, 0x59, 0x22, 0x61, 
-    0xC2, 0x40, 0xA2, 0x38, 0xA2, 0x38, 0x82, 0x30, 0xA2, 0x38, 0x61, 0x20, 0x20, 0x08, 0x00, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x61, 0x28, 0xA2, 0x38, 0xA2, 0x38, 0x22, 0x61, 0x22, 0x61, 
-    0x22, 0x69, 0x42, 0x69, 0x42, 0x69, 0x82, 0x71, 0x43, 0x9A, 0x43, 0xA2, 0x82, 0x71, 0x22, 0x59, 
-    0x22, 0x59, 0x22, 0x69, 0x42, 0x71, 0x42, 0x69, 0xC2, 0x40, 0xC2, 0x48, 0x61, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA2, 0x40, 0xC2, 0x48, 0xE2, 0x50, 0x22, 0x61, 0x22, 0x61, 0x02, 0x59, 0x02, 0x61, 0x22, 0x61, 
-    0xC2, 0x40, 0xA2, 0x30, 0xA2, 0x30, 0x82, 0x30, 0xA2, 0x38, 0x41, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x18, 0x82, 0x28, 0x82, 0x30, 0x02, 0x59, 0x02, 0x59, 
-    0x02, 0x59, 0x02, 0x59, 0x02, 0x59, 0x62, 0x71, 0xA3, 0xB2, 0xC3, 0xBA, 0x02, 0x92, 0x82, 0x79, 
-    0x82, 0x79, 0x22, 0x69, 0x42, 0x69, 0x22, 0x69, 0xA2, 0x38, 0xA2, 0x38, 0x61, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA2, 0x40, 0xC2, 0x48, 0xE2, 0x50, 0x22, 0x61, 0x22, 0x61, 0x02, 0x59, 0x02, 0x59, 0x22, 0x61, 
-    0xC2, 0x40, 0xA2, 0x30, 0xA2, 0x30, 0x82, 0x30, 0x82, 0x30, 0x41, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x18, 0x81, 0x28, 0x82, 0x30, 0x02, 0x59, 0x02, 0x61, 
-    0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x62, 0x71, 0x83, 0xAA, 0xA3, 0xB2, 0xE2, 0x89, 0x62, 0x71, 
-    0x82, 0x71, 0x22, 0x69, 0x22, 0x69, 0x22, 0x61, 0xA2, 0x38, 0xA2, 0x38, 0x61, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x82, 0x28, 0xA2, 0x30, 0xA2, 0x38, 0xC2, 0x40, 0xC2, 0x40, 0xE2, 0x48, 0xE2, 0x58, 0x02, 0x59, 
-    0xE2, 0x50, 0xC2, 0x48, 0xC2, 0x48, 0x20, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0xE2, 0x50, 0xE2, 0x50, 
-    0x02, 0x61, 0xA2, 0x81, 0xA2, 0x81, 0x82, 0x71, 0x22, 0x51, 0x42, 0x59, 0x22, 0x59, 0xE2, 0x58, 
-    0xE2, 0x50, 0xA2, 0x30, 0xA2, 0x30, 0x81, 0x28, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x20, 0xA2, 0x28, 0xA2, 0x30, 0xC2, 0x38, 0xA2, 0x38, 0xC2, 0x48, 0xE2, 0x58, 0xE2, 0x50, 
-    0xE2, 0x50, 0xE2, 0x50, 0xC2, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xE2, 0x50, 0xE2, 0x50, 
-    0x02, 0x59, 0xA2, 0x81, 0xC2, 0x81, 0x62, 0x71, 0xE2, 0x40, 0xE2, 0x40, 0x02, 0x51, 0xE2, 0x50, 
-    0xE2, 0x50, 0x82, 0x28, 0xA2, 0x28, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x28, 0x81, 0x28, 0x82, 0x30, 0xC2, 0x38, 0xA2, 0x38, 0xC2, 0x48, 0xE2, 0x50, 0xE2, 0x50, 
-    0xE2, 0x50, 0xE2, 0x50, 0xC2, 0x50, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0x48, 0xC2, 0x48, 
-    0x02, 0x59, 0xA2, 0x81, 0xA2, 0x81, 0x62, 0x71, 0xE2, 0x40, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x50, 
-    0xE2, 0x50, 0x82, 0x28, 0x82, 0x28, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0xA2, 0x40, 0xA2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x48, 
-    0x02, 0x59, 0x02, 0x61, 0x02, 0x59, 0x02, 0x59, 0x02, 0x59, 0xE2, 0x50, 0xC2, 0x48, 0xC2, 0x50, 
-    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x81, 0x23, 0xA2, 
-    0xA2, 0x79, 0xC2, 0x38, 0xE2, 0x40, 0xE2, 0x40, 0xC2, 0x48, 0xE2, 0x50, 0x40, 0x18, 0x20, 0x08, 
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x40, 0xA2, 0x40, 0xE2, 0x48, 
-    0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x69, 0x42, 0x69, 0x22, 0x61, 0xE2, 0x58, 0x02, 0x61, 
-    0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x9A, 0xE4, 0xCA, 
-    0xE3, 0x89, 0x82, 0x28, 0xC2, 0x30, 0xC2, 0x38, 0xC2, 0x50, 0xE2, 0x50, 0x20, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xC2, 0x40, 0xA2, 0x40, 0xA2, 0x40, 0xC2, 0x48, 0x02, 0x59, 
-    0x62, 0x71, 0x62, 0x71, 0x62, 0x71, 0x42, 0x69, 0x22, 0x69, 0x02, 0x61, 0xE2, 0x58, 0x02, 0x61, 
-    0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x9A, 0xA4, 0xC2, 
-    0xE3, 0x89, 0xA2, 0x28, 0xC2, 0x30, 0xC2, 0x38, 0xC2, 0x48, 0xE2, 0x50, 0x20, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x61, 0x28, 0xC2, 0x48, 0xC2, 0x48, 
-    0x02, 0x59, 0x22, 0x61, 0x22, 0x61, 0x02, 0x59, 0xE2, 0x58, 0xE2, 0x58, 0xC2, 0x50, 0xE2, 0x58, 
-    0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x18, 0x60, 0x18, 
-    0x60, 0x18, 0xA2, 0x20, 0xA2, 0x20, 0x81, 0x18, 0x00, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 0xC2, 0x40, 0xA2, 0x38, 
-    0xC2, 0x48, 0xC2, 0x50, 0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x50, 0xC2, 0x50, 0xC2, 0x50, 
-    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA2, 0x20, 0xC2, 0x20, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 0xC2, 0x40, 0xA2, 0x38, 
-    0xA2, 0x40, 0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x48, 0xA2, 0x48, 0xA2, 0x48, 0xA2, 0x48, 0xC2, 0x48, 
-    0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x81, 0x18, 0x81, 0x18, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-/* LVGL image descriptor */
-const lv_img_dsc_t howdy_img_howdyright = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 128,
-    .header.h = 128,
-    .data_size = 32768,
-    .data = howdy_img_howdyright_data,
-};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief On-flash layout of the image asset pack
+ *
+ * Written by tools/convert_images_to_lvgl.py --pack. Little-endian:
+ * a header, a table of entries, then each image's pixel data, raw or as
+ * one LZ4 block. Offsets are from the start of the pack. No ESP-IDF or
+ * LVGL dependencies, so host tools can read packs too.
+ */
+
+#define HOWDY_ASSET_PACK_MAGIC      0x474D4948  ///< "HIMG"
+#define HOWDY_ASSET_PACK_VERSION    1
+#define HOWDY_ASSET_NAME_LEN        24
+
+#define HOWDY_ASSET_CODEC_RAW       0
+#define HOWDY_ASSET_CODEC_LZ4       1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;                 ///< Entries in the table
+    uint32_t total_size;            ///< Header, table and data
+    uint32_t reserved;
+} howdy_asset_pack_header_t;
+
+typedef struct {
+    char name[HOWDY_ASSET_NAME_LEN];    ///< NUL-terminated
+    uint16_t width;
+    uint16_t height;
+    uint8_t cf;                     ///< LVGL colour format (LV_IMG_CF_*)
+    uint8_t codec;                  ///< HOWDY_ASSET_CODEC_*
+    uint16_t reserved;
+    uint32_t offset;                ///< Stored data, from the start of the pack
+    uint32_t size;                  ///< Stored bytes
+    uint32_t raw_size;              ///< Decoded bytes
+    uint32_t crc32;                 ///< CRC-32 (zlib) of the decoded bytes
+} howdy_asset_entry_t;
+
+_Static_assert(sizeof(howdy_asset_pack_header_t) == 16, "asset pack header layout");
+_Static_assert(sizeof(howdy_asset_entry_t) == 48, "asset entry layout");
+
+/**
+ * @brief Decode one LZ4 block
+ *
+ * Bounds-checked against both buffers, so a corrupt block fails instead
+ * of overrunning.
+ *
+ * @return Bytes written to dst, or -1 if the block is malformed or does
+ *         not fit in dst_cap
+ */
+int howdy_lz4_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_cap);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include "howdy_images.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Character images from the "assets" flash partition
+ *
+ * The images are built into one pack (tools/convert_images_to_lvgl.py
+ * --pack) and flashed to their own partition instead of being compiled
+ * into the app. The partition is memory-mapped; LZ4 entries are decoded
+ * into PSRAM the first time they are asked for and kept in an LRU cache
+ * capped by CONFIG_HOWDY_UI_ASSET_CACHE_KB. Raw entries are used in
+ * place from flash.
+ *
+ * Each image keeps one descriptor for its lifetime, so pointers returned
+ * by howdy_asset_img() are stable and can key other caches. Its pixel
+ * data may be evicted and decoded again; the most recently returned
+ * image is never evicted, so the one just passed to lv_img_set_src()
+ * stays valid.
+ *
+ * LVGL task only, except howdy_asset_get_stats().
+ */
+
+/**
+ * @brief Cache counters
+ */
+typedef struct {
+    uint32_t hits;
+    uint32_t decodes;
+    uint32_t evictions;
+    uint32_t failures;          ///< Missing, corrupt or out of memory
+    uint32_t decode_us_max;
+    uint64_t decode_us_total;
+    size_t bytes;               ///< Decoded pixel data held
+    size_t capacity;
+} howdy_asset_stats_t;
+
+/**
+ * @brief Map the asset partition and check the pack
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the partition is missing,
+ *         ESP_ERR_INVALID_VERSION or ESP_ERR_INVALID_SIZE if the pack is
+ *         not usable. Every image then returns NULL.
+ */
+esp_err_t howdy_asset_pack_init(void);
+
+/**
+ * @brief Get an image, decoding it on first use
+ *
+ * @return Image descriptor, or NULL if the pack or entry is unusable
+ */
+const lv_img_dsc_t *howdy_asset_img(howdy_img_id_t id);
+
+/**
+ * @brief Copy the cache counters
+ */
+void howdy_asset_get_stats(howdy_asset_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include "ui_manager.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Display frame pacing by conversation state and audio load
+ *
+ * LVGL refreshes every LV_DISP_DEF_REFR_PERIOD whatever the screen shows,
+ * and the UI's animation timers tick at fixed rates of their own. The
+ * governor picks one refresh period per ui_state_t instead: 10 fps while
+ * idle (the breathing ring is all that moves), the spinner's 20 fps while
+ * processing, the full rate only while the waveform follows live audio.
+ * ui_manager runs its mailbox and animation timers no faster than that.
+ *
+ * The audio path reports deadline pressure through
+ * ui_frame_governor_report_audio_pressure(). Elevated pressure halves the
+ * frame rate; critical pressure, or any pressure during wake word,
+ * listening and speaking, where audio must not slip, drops it to 10 fps.
+ * A report lapses if it is not renewed, so a stalled reporter cannot leave
+ * the display throttled.
+ *
+ * LVGL task only, except ui_frame_governor_report_audio_pressure() and
+ * ui_frame_governor_get_stats().
+ */
+
+/**
+ * @brief Audio deadline pressure, as judged by the audio pipeline
+ */
+typedef enum {
+    UI_AUDIO_PRESSURE_NONE = 0,
+    UI_AUDIO_PRESSURE_ELEVATED,     ///< Occasional missed deadlines
+    UI_AUDIO_PRESSURE_CRITICAL,     ///< Sustained misses or dropped audio
+} ui_audio_pressure_t;
+
+/**
+ * @brief Pacing counters since init
+ */
+typedef struct {
+    uint32_t period_ms;             ///< Refresh period in force
+    uint32_t target_period_ms;      ///< Period the current state asks for
+    ui_audio_pressure_t pressure;   ///< Pressure applied at the last update
+    float fps;                      ///< Refreshes that drew something, over the last second
+    uint32_t frames;                ///< Refreshes that drew something
+    uint32_t skipped;               ///< Frames the state's rate allowed but pressure held back
+    uint32_t period_changes;
+    float render_ms_avg;            ///< Render + flush, smoothed over roughly 16 frames
+    uint32_t render_ms_max;
+} ui_frame_governor_stats_t;
+
+/**
+ * @brief Take over the display's refresh period
+ *
+ * @param disp Display to pace, NULL for the default
+ * @return ESP_OK, ESP_ERR_INVALID_STATE without a display
+ */
+esp_err_t ui_frame_governor_init(lv_disp_t *disp);
+
+/**
+ * @brief The UI entered a state; its rate applies from the next update
+ */
+void ui_frame_governor_set_state(ui_state_t state);
+
+/**
+ * @brief Re-evaluate the refresh period, once per frame
+ *
+ * @param[out] period_ms New period when it changed
+ * @return true if the period changed and paced timers should follow it
+ */
+bool ui_frame_governor_update(uint32_t *period_ms);
+
+/**
+ * @brief Report audio deadline pressure
+ *
+ * Safe from any task and never blocks. Renew it at least every second or
+ * two while it holds; it lapses to none otherwise.
+ */
+void ui_frame_governor_report_audio_pressure(ui_audio_pressure_t pressure);
+
+/**
+ * @brief Copy the pacing counters
+ *
+ * Safe from any task; the counters may be a frame out of date.
+ */
+void ui_frame_governor_get_stats(ui_frame_governor_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -98,6 +98,11 @@ typedef void (*ui_voice_activation_callback_t)(bool start_voice);
 
 /**
  * @brief Initialize UI manager
+ *
+ * State, status and level updates are posted to a mailbox that the LVGL
+ * task applies once per display refresh, so they can be called from any
+ * task without taking the LVGL lock. Only the latest value of each field
+ * is shown.
  * 
  * @return esp_err_t ESP_OK on success
  */
@@ -111,6 +116,19 @@ esp_err_t ui_manager_init(void);
  */
 esp_err_t ui_manager_set_voice_callback(ui_voice_activation_callback_t callback);
 
+/**
+ * @brief Set how often LVGL reads the touch panel
+ *
+ * The default period suits a driver that polls the bus on every read. A
+ * driver that reads on its INT pin makes each indev read a queue check,
+ * so a shorter period costs nothing and lowers tap latency.
+ * Call with the display lock held.
+ *
+ * @param period_ms Read period of every pointer input device
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if there is no pointer device
+ */
+esp_err_t ui_manager_set_touch_read_period(uint32_t period_ms);
+
 /**
  * @brief Set UI state
  * 
@@ -276,6 +294,8 @@ esp_err_t ui_manager_show_protocol_switch(const char *from_protocol, const char
 
 /**
  * @brief Update microphone audio level with real-time display
+ *
+ * Never blocks; safe from the audio tasks.
  * 
  * @param level Microphone level (0-100)
  * @param vad_confidence VAD confidence (0.0-1.0)
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "esp_err.h"
+#include "lvgl.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Clip redraws to the visible circle of the round panel
+ *
+ * LVGL invalidates, renders and flushes rectangles, so a full-screen
+ * background change on the 800x800 round panel also draws and sends the
+ * four corners nobody can see (about 21% of the pixels). Just before each
+ * refresh this splits every invalidated area into horizontal bands
+ * fitted to a per-scanline table of the circle's visible span, and drops
+ * areas that lie wholly in the corners. The bands are what LVGL renders
+ * and flushes.
+ *
+ * Bands are merged while their spans stay within a step of each other;
+ * the step grows until the bands fit in LVGL's invalidation buffer, and an
+ * area that still does not fit is reduced to its visible bounding box.
+ *
+ * LVGL task only, except ui_round_display_get_stats().
+ */
+
+/**
+ * @brief Redraw counters since init
+ */
+typedef struct {
+    uint32_t refreshes;             ///< Refreshes that drew something
+    uint32_t areas_split;           ///< Areas replaced by circle bands
+    uint32_t areas_dropped;         ///< Areas wholly outside the circle
+    uint64_t px_requested;          ///< Pixels invalidated, before clipping
+    uint64_t px_rendered;           ///< Pixels rendered and flushed
+    uint32_t large_refreshes;       ///< Refreshes that invalidated over half the screen
+    uint32_t large_time_ms_total;   ///< Render + flush time of those
+    uint32_t large_time_ms_max;
+} ui_round_display_stats_t;
+
+/**
+ * @brief Hook the display's refresh
+ *
+ * @param disp Display to hook, NULL for the default
+ * @return ESP_OK, ESP_ERR_INVALID_STATE without a display, ESP_ERR_NO_MEM
+ */
+esp_err_t ui_round_display_init(lv_disp_t *disp);
+
+/**
+ * @brief Copy the redraw counters
+ *
+ * Safe from any task; the counters may be a frame out of date.
+ */
+void ui_round_display_get_stats(ui_round_display_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
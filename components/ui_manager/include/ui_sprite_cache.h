@@ -0,0 +1,70 @@
+#pragma once
+
+#include "lvgl.h"
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Pre-rendered zoom keyframes for the character images
+ *
+ * Zooming an lv_img with transform_zoom makes LVGL rescale the image in
+ * software on every frame. The breathing and listening animations only
+ * cycle through a handful of zoom levels, so each level is rendered once
+ * into PSRAM and the animation swaps image sources instead.
+ *
+ * Keyframes keep the source's size and zoom about its centre, so swapping
+ * them does not move the object or grow its invalidated area. Only
+ * LV_IMG_CF_TRUE_COLOR sources are supported. Entries are evicted least
+ * recently used once the CONFIG_HOWDY_UI_SPRITE_CACHE_KB cap is reached;
+ * the most recently returned keyframe is never evicted, so the one on
+ * screen stays valid.
+ *
+ * LVGL task only, except ui_sprite_cache_get_stats().
+ */
+
+#define UI_SPRITE_ZOOM_STEP     2       ///< Zoom quantisation (256 = 1.0x)
+
+/**
+ * @brief Cache counters
+ */
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;            ///< Keyframes rendered
+    uint32_t evictions;
+    uint32_t failures;          ///< Unsupported source or out of memory
+    uint32_t entries;
+    size_t bytes;               ///< Pixel data held
+    size_t capacity;            ///< Cap in bytes, 0 if disabled
+} ui_sprite_cache_stats_t;
+
+/**
+ * @brief Get the keyframe for a source image at a zoom level
+ *
+ * @param src Source image (must outlive the cache)
+ * @param zoom LVGL zoom, 256 = 1.0x; quantised to UI_SPRITE_ZOOM_STEP
+ * @return Keyframe, src itself at 1.0x, or NULL if it cannot be cached
+ *         (the caller should fall back to transform_zoom)
+ */
+const lv_img_dsc_t *ui_sprite_cache_get_zoomed(const lv_img_dsc_t *src, uint16_t zoom);
+
+/**
+ * @brief Free every keyframe
+ *
+ * The caller must first point any image showing a keyframe back at its source.
+ */
+void ui_sprite_cache_clear(void);
+
+/**
+ * @brief Copy the cache counters
+ *
+ * Safe from any task; the counters may be a frame out of date.
+ */
+void ui_sprite_cache_get_stats(ui_sprite_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
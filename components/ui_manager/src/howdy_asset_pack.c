@@ -0,0 +1,228 @@
+#include "howdy_asset_pack.h"
+#include "howdy_asset_format.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static const char *TAG = "AssetPack";
+
+#ifndef CONFIG_HOWDY_UI_ASSET_CACHE_KB
+#define CONFIG_HOWDY_UI_ASSET_CACHE_KB 256
+#endif
+
+#define ASSET_PARTITION_LABEL   "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40
+#define ASSET_CACHE_CAPACITY    ((size_t)CONFIG_HOWDY_UI_ASSET_CACHE_KB * 1024)
+
+static const char *const s_names[HOWDY_IMG_COUNT] = HOWDY_IMG_NAMES;
+
+static struct {
+    bool ready;
+    const uint8_t *base;
+    esp_partition_mmap_handle_t mmap;
+    const howdy_asset_entry_t *entries[HOWDY_IMG_COUNT];   // NULL if not in the pack
+    lv_img_dsc_t dsc[HOWDY_IMG_COUNT];      // data is NULL while not decoded
+    uint8_t *decoded[HOWDY_IMG_COUNT];      // Owned buffers (LZ4 entries only)
+    uint32_t last_used[HOWDY_IMG_COUNT];
+    int last_returned;
+    uint32_t use_clock;
+    howdy_asset_stats_t stats;
+} s_pack = {
+    .last_returned = -1,
+    .stats.capacity = ASSET_CACHE_CAPACITY,
+};
+
+static bool asset_entry_valid(const howdy_asset_entry_t *e, uint32_t total_size)
+{
+    if (!memchr(e->name, '\0', sizeof(e->name))) {
+        return false;
+    }
+    if (e->cf != LV_IMG_CF_TRUE_COLOR ||
+        e->raw_size != (uint32_t)e->width * e->height * sizeof(lv_color_t)) {
+        return false;
+    }
+    if (e->offset > total_size || e->size > total_size - e->offset) {
+        return false;
+    }
+    if (e->codec == HOWDY_ASSET_CODEC_RAW) {
+        return e->size == e->raw_size && (e->offset % 4) == 0;
+    }
+    return e->codec == HOWDY_ASSET_CODEC_LZ4;
+}
+
+esp_err_t howdy_asset_pack_init(void)
+{
+    if (s_pack.ready) {
+        return ESP_OK;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                            ASSET_PARTITION_SUBTYPE,
+                                                            ASSET_PARTITION_LABEL);
+    if (!part) {
+        ESP_LOGE(TAG, "No '%s' partition; flash it with idf.py flash", ASSET_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    const void *ptr = NULL;
+    esp_err_t ret = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &s_pack.mmap);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map asset partition: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    s_pack.base = ptr;
+
+    const howdy_asset_pack_header_t *hdr = ptr;
+    if (hdr->magic != HOWDY_ASSET_PACK_MAGIC || hdr->version != HOWDY_ASSET_PACK_VERSION) {
+        ESP_LOGE(TAG, "Asset partition holds no v%d pack (magic 0x%08lx, version %u)",
+                 HOWDY_ASSET_PACK_VERSION, hdr->magic, hdr->version);
+        ret = ESP_ERR_INVALID_VERSION;
+        goto fail;
+    }
+    if (hdr->total_size > part->size ||
+        sizeof(*hdr) + (size_t)hdr->count * sizeof(howdy_asset_entry_t) > hdr->total_size) {
+        ESP_LOGE(TAG, "Asset pack size %lu does not fit partition (%lu)", hdr->total_size, part->size);
+        ret = ESP_ERR_INVALID_SIZE;
+        goto fail;
+    }
+
+    const howdy_asset_entry_t *table = (const howdy_asset_entry_t *)(s_pack.base + sizeof(*hdr));
+    int found = 0;
+    for (int id = 0; id < HOWDY_IMG_COUNT; id++) {
+        for (int i = 0; i < hdr->count; i++) {
+            const howdy_asset_entry_t *e = &table[i];
+            if (strncmp(e->name, s_names[id], sizeof(e->name)) != 0) {
+                continue;
+            }
+            if (!asset_entry_valid(e, hdr->total_size)) {
+                ESP_LOGE(TAG, "Asset '%s' has a bad table entry", s_names[id]);
+                break;
+            }
+            s_pack.entries[id] = e;
+            s_pack.dsc[id].header.cf = e->cf;
+            s_pack.dsc[id].header.w = e->width;
+            s_pack.dsc[id].header.h = e->height;
+            s_pack.dsc[id].data_size = e->raw_size;
+            found++;
+            break;
+        }
+        if (!s_pack.entries[id]) {
+            ESP_LOGW(TAG, "Asset '%s' missing from pack", s_names[id]);
+        }
+    }
+
+    s_pack.ready = true;
+    ESP_LOGI(TAG, "Asset pack: %d/%d images, %lu bytes in flash, %u KB decode cache",
+             found, HOWDY_IMG_COUNT, hdr->total_size, (unsigned)(ASSET_CACHE_CAPACITY / 1024));
+    return ESP_OK;
+
+fail:
+    esp_partition_munmap(s_pack.mmap);
+    s_pack.base = NULL;
+    return ret;
+}
+
+static void asset_evict(int id)
+{
+    lv_img_cache_invalidate_src(&s_pack.dsc[id]);
+    heap_caps_free(s_pack.decoded[id]);
+    s_pack.decoded[id] = NULL;
+    s_pack.dsc[id].data = NULL;
+    s_pack.stats.bytes -= s_pack.entries[id]->raw_size;
+    s_pack.stats.evictions++;
+}
+
+// Evict least recently used images, never the one on screen
+static bool asset_make_room(size_t need)
+{
+    while (s_pack.stats.bytes + need > ASSET_CACHE_CAPACITY) {
+        int victim = -1;
+        for (int id = 0; id < HOWDY_IMG_COUNT; id++) {
+            if (!s_pack.decoded[id] || id == s_pack.last_returned) {
+                continue;
+            }
+            if (victim < 0 || (int32_t)(s_pack.last_used[id] - s_pack.last_used[victim]) < 0) {
+                victim = id;
+            }
+        }
+        if (victim < 0) {
+            return false;
+        }
+        asset_evict(victim);
+    }
+    return true;
+}
+
+static esp_err_t asset_decode(int id)
+{
+    const howdy_asset_entry_t *e = s_pack.entries[id];
+    const uint8_t *stored = s_pack.base + e->offset;
+
+    if (e->codec == HOWDY_ASSET_CODEC_RAW) {
+        // Used in place from flash; nothing to cache
+        s_pack.dsc[id].data = stored;
+        return ESP_OK;
+    }
+
+    if (e->raw_size > ASSET_CACHE_CAPACITY || !asset_make_room(e->raw_size)) {
+        ESP_LOGW(TAG, "No room to decode '%s' (%lu bytes)", e->name, e->raw_size);
+        return ESP_ERR_NO_MEM;
+    }
+    uint8_t *buf = heap_caps_malloc(e->raw_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!buf) {
+        buf = heap_caps_malloc(e->raw_size, MALLOC_CAP_8BIT);
+    }
+    if (!buf) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    int64_t start = esp_timer_get_time();
+    int len = howdy_lz4_decompress(stored, e->size, buf, e->raw_size);
+    uint32_t decode_us = (uint32_t)(esp_timer_get_time() - start);
+    if (len != (int)e->raw_size || esp_rom_crc32_le(0, buf, e->raw_size) != e->crc32) {
+        ESP_LOGE(TAG, "Asset '%s' is corrupt (%d of %lu bytes decoded)", e->name, len, e->raw_size);
+        heap_caps_free(buf);
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    s_pack.decoded[id] = buf;
+    s_pack.dsc[id].data = buf;
+    s_pack.stats.bytes += e->raw_size;
+    s_pack.stats.decodes++;
+    s_pack.stats.decode_us_total += decode_us;
+    if (decode_us > s_pack.stats.decode_us_max) {
+        s_pack.stats.decode_us_max = decode_us;
+    }
+    ESP_LOGD(TAG, "Decoded '%s' %lu -> %lu bytes in %luμs", e->name, e->size, e->raw_size, decode_us);
+    return ESP_OK;
+}
+
+const lv_img_dsc_t *howdy_asset_img(howdy_img_id_t id)
+{
+    if (!s_pack.ready || (int)id < 0 || id >= HOWDY_IMG_COUNT || !s_pack.entries[id]) {
+        s_pack.stats.failures++;
+        return NULL;
+    }
+
+    if (s_pack.dsc[id].data) {
+        s_pack.stats.hits++;
+    } else if (asset_decode(id) != ESP_OK) {
+        s_pack.stats.failures++;
+        return NULL;
+    }
+
+    s_pack.last_used[id] = ++s_pack.use_clock;
+    s_pack.last_returned = id;
+    return &s_pack.dsc[id];
+}
+
+void howdy_asset_get_stats(howdy_asset_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_pack.stats;
+    }
+}
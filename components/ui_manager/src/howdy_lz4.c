@@ -0,0 +1,77 @@
+#include "howdy_asset_format.h"
+#include <string.h>
+
+#define LZ4_MIN_MATCH   4
+
+// Extended length: bytes of 255 continue, the first smaller byte ends it
+static int lz4_read_length(const uint8_t **ip, const uint8_t *iend, size_t *len)
+{
+    uint8_t b;
+    do {
+        if (*ip >= iend) {
+            return -1;
+        }
+        b = *(*ip)++;
+        *len += b;
+    } while (b == 255);
+    return 0;
+}
+
+int howdy_lz4_decompress(const uint8_t *src, size_t src_len, uint8_t *dst, size_t dst_cap)
+{
+    const uint8_t *ip = src;
+    const uint8_t *iend = src + src_len;
+    uint8_t *op = dst;
+    uint8_t *oend = dst + dst_cap;
+
+    while (ip < iend) {
+        uint8_t token = *ip++;
+
+        size_t lit = token >> 4;
+        if (lit == 15 && lz4_read_length(&ip, iend, &lit) != 0) {
+            return -1;
+        }
+        if ((size_t)(iend - ip) < lit || (size_t)(oend - op) < lit) {
+            return -1;
+        }
+        memcpy(op, ip, lit);
+        op += lit;
+        ip += lit;
+
+        // The last sequence is literals only
+        if (ip == iend) {
+            break;
+        }
+
+        if (iend - ip < 2) {
+            return -1;
+        }
+        size_t offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - dst)) {
+            return -1;
+        }
+
+        size_t match_len = token & 0x0F;
+        if (match_len == 15 && lz4_read_length(&ip, iend, &match_len) != 0) {
+            return -1;
+        }
+        match_len += LZ4_MIN_MATCH;
+        if ((size_t)(oend - op) < match_len) {
+            return -1;
+        }
+
+        const uint8_t *match = op - offset;
+        if (offset >= match_len) {
+            memcpy(op, match, match_len);
+            op += match_len;
+        } else {
+            // Overlapping copy repeats the last `offset` bytes (runs of black)
+            while (match_len--) {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return (int)(op - dst);
+}
@@ -0,0 +1,184 @@
+#include "ui_frame_governor.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <stdatomic.h>
+
+static const char *TAG = "FrameGov";
+
+#define GOV_PERIOD_MIN_MS       LV_DISP_DEF_REFR_PERIOD     // LVGL's own rate, ~33 fps
+#define GOV_PERIOD_MAX_MS       100                         // 10 fps floor
+#define GOV_PRESSURE_HOLD_MS    2000    // A report lapses after this without renewal
+#define GOV_FPS_WINDOW_MS       1000
+#define GOV_RENDER_AVG_WEIGHT   16.0f
+
+static struct {
+    lv_disp_t *disp;
+    ui_state_t state;
+    void (*prev_monitor_cb)(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px);
+    atomic_uint pressure;           // ui_audio_pressure_t, written by the audio path
+    atomic_uint pressure_time_ms;   // When it was last reported
+    uint32_t skip_debt_ms;          // Target-rate time not yet counted as a skipped frame
+    uint32_t last_update_ms;
+    uint32_t window_start_ms;
+    uint32_t window_frames;
+    ui_frame_governor_stats_t stats;
+} s_gov;
+
+static uint32_t gov_now_ms(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+static uint32_t gov_state_period(ui_state_t state)
+{
+    switch (state) {
+        case UI_STATE_LISTENING:
+        case UI_STATE_SPEECH_DETECTED:
+        case UI_STATE_SPEAKING:
+        case UI_STATE_RESPONDING:
+            return GOV_PERIOD_MIN_MS;       // Waveform and level rings follow live audio
+        case UI_STATE_WAKE_WORD_DETECTED:
+        case UI_STATE_SESSION_ENDING:
+            return 67;                      // Wake pulse rate
+        case UI_STATE_PROCESSING:
+        case UI_STATE_THINKING:
+        case UI_STATE_CONVERSATION_ACTIVE:
+        case UI_STATE_CONNECTING:
+        case UI_STATE_DISCOVERING:
+            return 50;                      // Spinner rate
+        default:
+            return GOV_PERIOD_MAX_MS;       // Idle and error screens: breathing ring only
+    }
+}
+
+// States where the capture and playback deadlines come before the display
+static bool gov_audio_priority(ui_state_t state)
+{
+    return state == UI_STATE_WAKE_WORD_DETECTED || state == UI_STATE_LISTENING ||
+           state == UI_STATE_SPEECH_DETECTED || state == UI_STATE_SPEAKING ||
+           state == UI_STATE_RESPONDING;
+}
+
+static ui_audio_pressure_t gov_current_pressure(uint32_t now_ms)
+{
+    ui_audio_pressure_t pressure = atomic_load_explicit(&s_gov.pressure, memory_order_relaxed);
+    uint32_t reported = atomic_load_explicit(&s_gov.pressure_time_ms, memory_order_relaxed);
+    // Signed: the audio path may stamp a report just after this update read the clock
+    if (pressure != UI_AUDIO_PRESSURE_NONE && (int32_t)(now_ms - reported) > GOV_PRESSURE_HOLD_MS) {
+        return UI_AUDIO_PRESSURE_NONE;
+    }
+    return pressure;
+}
+
+static void gov_monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+    ui_frame_governor_stats_t *st = &s_gov.stats;
+    st->frames++;
+    s_gov.window_frames++;
+    st->render_ms_avg += (time_ms - st->render_ms_avg) / GOV_RENDER_AVG_WEIGHT;
+    if (time_ms > st->render_ms_max) {
+        st->render_ms_max = time_ms;
+    }
+
+    if (s_gov.prev_monitor_cb) {
+        s_gov.prev_monitor_cb(drv, time_ms, px);
+    }
+}
+
+esp_err_t ui_frame_governor_init(lv_disp_t *disp)
+{
+    if (!disp) {
+        disp = lv_disp_get_default();
+    }
+    if (!disp || !disp->driver || !disp->refr_timer) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_gov.disp) {
+        return s_gov.disp == disp ? ESP_OK : ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t now = gov_now_ms();
+    s_gov.disp = disp;
+    s_gov.state = UI_STATE_INIT;
+    s_gov.last_update_ms = now;
+    s_gov.window_start_ms = now;
+    s_gov.stats.period_ms = disp->refr_timer->period;
+    s_gov.stats.target_period_ms = disp->refr_timer->period;
+    s_gov.prev_monitor_cb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = gov_monitor_cb;
+
+    ESP_LOGI(TAG, "Frame pacing %d-%d ms by UI state", GOV_PERIOD_MIN_MS, GOV_PERIOD_MAX_MS);
+    return ESP_OK;
+}
+
+void ui_frame_governor_set_state(ui_state_t state)
+{
+    s_gov.state = state;
+}
+
+bool ui_frame_governor_update(uint32_t *period_ms)
+{
+    if (!s_gov.disp) {
+        return false;
+    }
+
+    ui_frame_governor_stats_t *st = &s_gov.stats;
+    uint32_t now = gov_now_ms();
+    uint32_t target = gov_state_period(s_gov.state);
+    ui_audio_pressure_t pressure = gov_current_pressure(now);
+
+    uint32_t period = target;
+    if (pressure == UI_AUDIO_PRESSURE_CRITICAL ||
+        (pressure == UI_AUDIO_PRESSURE_ELEVATED && gov_audio_priority(s_gov.state))) {
+        period = GOV_PERIOD_MAX_MS;
+    } else if (pressure == UI_AUDIO_PRESSURE_ELEVATED) {
+        period = LV_MIN(target * 2, GOV_PERIOD_MAX_MS);
+    }
+
+    // Each throttled frame stands in for period/target frames at the state's rate
+    if (st->period_ms > st->target_period_ms) {
+        s_gov.skip_debt_ms += LV_MIN(now - s_gov.last_update_ms, GOV_PERIOD_MAX_MS * 2) *
+                              (st->period_ms - st->target_period_ms) / st->period_ms;
+        while (s_gov.skip_debt_ms >= st->target_period_ms) {
+            s_gov.skip_debt_ms -= st->target_period_ms;
+            st->skipped++;
+        }
+    } else {
+        s_gov.skip_debt_ms = 0;
+    }
+    s_gov.last_update_ms = now;
+
+    uint32_t window = now - s_gov.window_start_ms;
+    if (window >= GOV_FPS_WINDOW_MS) {
+        st->fps = s_gov.window_frames * 1000.0f / window;
+        s_gov.window_frames = 0;
+        s_gov.window_start_ms = now;
+    }
+
+    st->target_period_ms = target;
+    st->pressure = pressure;
+    if (period == st->period_ms) {
+        return false;
+    }
+
+    lv_timer_set_period(s_gov.disp->refr_timer, period);
+    ESP_LOGD(TAG, "Refresh %lu -> %lu ms (state %d, pressure %d)",
+             st->period_ms, period, s_gov.state, pressure);
+    st->period_ms = period;
+    st->period_changes++;
+    *period_ms = period;
+    return true;
+}
+
+void ui_frame_governor_report_audio_pressure(ui_audio_pressure_t pressure)
+{
+    atomic_store_explicit(&s_gov.pressure_time_ms, gov_now_ms(), memory_order_relaxed);
+    atomic_store_explicit(&s_gov.pressure, pressure, memory_order_relaxed);
+}
+
+void ui_frame_governor_get_stats(ui_frame_governor_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_gov.stats;
+    }
+}
@@ -1,9 +1,14 @@
 #include "ui_manager.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <stdatomic.h>
 #include <string.h>
 #include <math.h>
-#include "howdy_images.h"
+#include "howdy_asset_pack.h"
+#include "ui_sprite_cache.h"
+#include "ui_round_display.h"
+#include "ui_frame_governor.h"
 
 static const char *TAG = "UIManager";
 
@@ -13,19 +18,67 @@ static bool s_initialized = false;
 static ui_voice_activation_callback_t s_voice_callback = NULL;
 
 // Performance tracking
-static uint32_t s_last_update_time = 0;
 static uint32_t s_update_count = 0;
 static float s_average_fps = 0.0f;
 
-// Performance optimization - limit update frequency
-#define MIN_UPDATE_INTERVAL_MS 16  // ~60 FPS max update rate
+// Performance optimization
 #define MAX_ANIMATION_OBJECTS 4    // Limit concurrent animations
 
-// Animation timers
+// UI state mailbox. Audio and network tasks post the latest values without
+// touching LVGL; a timer in the LVGL task applies whatever changed once per
+// display refresh. Producers are serialised by a spinlock and bump the
+// sequence around each write, so the reader never blocks them and retries
+// if it raced one. Each field group has its own generation so the reader
+// can tell what changed without writing to shared state.
+#define UI_MAILBOX_PERIOD_MS    LV_DISP_DEF_REFR_PERIOD
+#define UI_MAILBOX_READ_TRIES   4
+#define UI_STATUS_TEXT_LEN      96
+#define UI_DETAIL_TEXT_LEN      128
+
+typedef struct {
+    uint32_t state_gen;
+    uint32_t status_gen;
+    uint32_t status_state_gen;      // state_gen when status was posted
+    uint32_t detail_gen;
+    uint32_t mic_gen;
+    uint32_t tts_gen;
+    uint32_t confidence_gen;
+    uint32_t wake_gen;
+    ui_state_t state;
+    int mic_level;
+    float vad_confidence;
+    int tts_level;
+    float tts_progress;
+    float meter_confidence;
+    float wake_confidence;
+    char status[UI_STATUS_TEXT_LEN];
+    char detail[UI_DETAIL_TEXT_LEN];
+} ui_mailbox_data_t;
+
+static struct {
+    portMUX_TYPE writer_lock;
+    atomic_uint seq;                // Odd while a producer is writing
+    ui_mailbox_data_t data;
+} s_mailbox = {
+    .writer_lock = portMUX_INITIALIZER_UNLOCKED,
+};
+
+static ui_mailbox_data_t s_applied;    // LVGL task only
+static lv_timer_t *s_mailbox_timer = NULL;
+
+// Animation timers. Each steps at its own rate but never faster than the
+// display refreshes; the frame governor slows the refresh when idle or
+// when audio needs the CPU.
+#define ANIM_BREATHING_MS       100     // 10fps
+#define ANIM_LISTENING_MS       40      // 25fps
+#define ANIM_PROCESSING_MS      50      // 20fps
+#define ANIM_WAKE_WORD_MS       67      // ~15fps
+
 static lv_timer_t *s_listening_animation_timer = NULL;
 static lv_timer_t *s_processing_animation_timer = NULL;
 static lv_timer_t *s_wake_word_animation_timer = NULL;
 static lv_timer_t *s_breathing_animation_timer = NULL;
+static uint32_t s_frame_period_ms = UI_MAILBOX_PERIOD_MS;
 
 // Touch gesture handling
 static lv_point_t s_last_touch_point = {0, 0};
@@ -50,10 +103,26 @@ static uint32_t s_touch_start_time = 0;
 #define HOWDY_BG_PROCESSING        lv_color_hex(0x533a7b)  // Purple thinking
 #define HOWDY_COLOR_WAVEFORM       lv_color_hex(0x00d1ff)  // Cyan for TTS waveform
 
-// Waveform visualization state
-#define WAVE_SEGMENTS 64
+// Waveform visualization state. Each segment sits at a fixed angle and the
+// write head sweeps round the ring, so a new level only changes one
+// segment; the mailbox timer invalidates just those segments' boxes.
+#define WAVE_SEGMENTS           64      // Power of two
+#define WAVE_BASE_RADIUS        300     // Around the inner ring
+#define WAVE_MAX_AMPLITUDE      30      // Thickness outward at level 100
+#define WAVE_LINE_WIDTH         4
+#define WAVE_FULL_REDRAW        16      // Changed segments before one full invalidate is cheaper
+#define WAVE_TRIG_SHIFT         14      // Q14 unit vectors
+
+typedef struct {
+    int16_t x0, y0;                     // Inner end, relative to the centre
+    int16_t dx, dy;                     // Unit direction, Q14
+    lv_area_t bounds;                   // Box at full amplitude incl. line caps, relative
+} wave_segment_geom_t;
+
+static wave_segment_geom_t s_wave_geom[WAVE_SEGMENTS];
 static uint8_t s_wave_levels[WAVE_SEGMENTS] = {0};
-static uint8_t s_wave_index = 0;
+static uint32_t s_wave_count = 0;              // Levels pushed; written by producers under the mailbox lock
+static uint32_t s_wave_drawn_count = 0;        // LVGL task only
 static lv_obj_t *s_wave_obj = NULL;
 #define HOWDY_BG_SPEAKING          lv_color_hex(0x1e4d72)  // Teal speaking
 #define HOWDY_BG_CONVERSATION      lv_color_hex(0x2a4f3e)  // Green conversation
@@ -71,8 +140,46 @@ static lv_obj_t *s_wave_obj = NULL;
 static void wave_draw_event_cb(lv_event_t * e);
 static void wave_init(lv_obj_t *parent);
 static void wave_push_level(uint8_t level);
+static void ui_mailbox_apply_cb(lv_timer_t *timer);
+
+static uint32_t anim_period(uint32_t base_ms)
+{
+    return LV_MAX(base_ms, s_frame_period_ms);
+}
+
+// Character image as chosen by the state, before any animation zoom
+static const lv_img_dsc_t *s_character_src = NULL;
+
+static void character_show(const lv_img_dsc_t *img)
+{
+    if (lv_img_get_src(s_ui_manager.howdy_character) != img) {
+        lv_img_set_src(s_ui_manager.howdy_character, img);
+    }
+}
+
+static void character_set_src(const lv_img_dsc_t *src)
+{
+    s_character_src = src;
+    lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, LV_IMG_ZOOM_NONE, 0);
+    character_show(src);
+}
 
-// Enhanced touch gesture handling for round display
+// Swap in a pre-rendered keyframe instead of rescaling every frame
+static void character_set_zoom(uint16_t zoom)
+{
+    const lv_img_dsc_t *sprite = ui_sprite_cache_get_zoomed(s_character_src, zoom);
+    if (sprite) {
+        lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, LV_IMG_ZOOM_NONE, 0);
+        character_show(sprite);
+    } else {
+        character_show(s_character_src);
+        lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, zoom, 0);
+    }
+}
+
+// Enhanced touch gesture handling for round display.
+// Press and release each arrive on their own indev read, so a quick tap
+// is classified on release without waiting for a later poll.
 static void gesture_zone_event_cb(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
@@ -100,12 +207,12 @@ static void gesture_zone_event_cb(lv_event_t * e)
             int center_x = 400, center_y = 400; // Center of 800x800 display
             int dx = point.x - center_x;
             int dy = point.y - center_y;
-            int distance = sqrt(dx*dx + dy*dy);
+            int distance_sq = dx*dx + dy*dy;    // Compare squared, no sqrt on the tap path
             
-            ESP_LOGI(TAG, "Touch released: duration=%lums, distance from center=%d", touch_duration, distance);
+            ESP_LOGD(TAG, "Touch released: duration=%lums, distance^2 from center=%d", touch_duration, distance_sq);
             
             // Center tap (within 120px of center)
-            if (distance < 120) {
+            if (distance_sq < 120 * 120) {
                 if (touch_duration > 1000) {
                     // Long press - reset conversation or return to idle
                     ESP_LOGI(TAG, "Long press detected - resetting conversation");
@@ -121,7 +228,7 @@ static void gesture_zone_event_cb(lv_event_t * e)
                 }
             }
             // Volume control gestures (outer ring)
-            else if (distance > 200 && distance < 350) {
+            else if (distance_sq > 200 * 200 && distance_sq < 350 * 350) {
                 if (dy < -50) {
                     // Upper arc - volume up
                     ESP_LOGI(TAG, "Volume up gesture");
@@ -153,14 +260,14 @@ static void center_button_event_cb(lv_event_t * e)
     
     if (code == LV_EVENT_PRESSING) {
         // Visual feedback - scale the character image slightly
-        lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, 240, 0);
+        character_set_zoom(240);
         // Add glow effect
         if (s_ui_manager.character_glow) {
             lv_obj_set_style_bg_opa(s_ui_manager.character_glow, LV_OPA_50, 0);
         }
     } else if (code == LV_EVENT_RELEASED || code == LV_EVENT_PRESS_LOST) {
         // Return character to normal size
-        lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, 256, 0);
+        character_set_zoom(256);
         // Remove glow effect
         if (s_ui_manager.character_glow) {
             lv_obj_set_style_bg_opa(s_ui_manager.character_glow, LV_OPA_TRANSP, 0);
@@ -275,7 +382,7 @@ static void create_main_screen(void)
     
     // Howdy character image (center of circular display) - optimized for round display
     s_ui_manager.howdy_character = lv_img_create(s_ui_manager.main_container);
-    lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_armraisehowdy);
+    character_set_src(howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY));
     lv_obj_set_size(s_ui_manager.howdy_character, 264, 384);  // 3x scale for visibility
     lv_img_set_antialias(s_ui_manager.howdy_character, true);
     lv_obj_center(s_ui_manager.howdy_character);
@@ -396,6 +503,9 @@ static void update_ui_for_state(ui_state_t state)
     s_ui_manager.previous_state = s_ui_manager.current_state;
     s_ui_manager.current_state = state;
     s_ui_manager.state_change_time = esp_timer_get_time() / 1000;
+#ifdef CONFIG_HOWDY_UI_FRAME_GOVERNOR
+    ui_frame_governor_set_state(state);
+#endif
     
     // Stop all animations by default (specific states will restart as needed)
     ui_manager_stop_listening_animation();
@@ -406,7 +516,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_INIT:
             lv_label_set_text(s_ui_manager.status_label, "Initializing HowdyScreen...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SURFACE, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdybackward);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD));
             lv_label_set_text(s_ui_manager.mic_icon, "");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_INIT, 0);
             s_ui_manager.in_conversation = false;
@@ -415,7 +525,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_IDLE:
             lv_label_set_text(s_ui_manager.status_label, "Say 'Hey Howdy' or tap center");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_PRIMARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_armraisehowdy);
+            character_set_src(howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY));
             lv_label_set_text(s_ui_manager.mic_icon, s_ui_manager.muted ? "🔇" : "🎤");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_IDLE, 0);
             s_ui_manager.in_conversation = false;
@@ -426,7 +536,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_WAKE_WORD_DETECTED:
             lv_label_set_text(s_ui_manager.status_label, "Wake word detected!");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_WAKE_WORD, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdyleft);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYLEFT));
             lv_label_set_text(s_ui_manager.mic_icon, "👂");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_WAKE_WORD, 0);
             lv_obj_clear_flag(s_ui_manager.wake_word_ring, LV_OBJ_FLAG_HIDDEN);
@@ -437,7 +547,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_LISTENING:
             lv_label_set_text(s_ui_manager.status_label, "Listening for your voice...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SECONDARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdyleft);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYLEFT));
             lv_label_set_text(s_ui_manager.mic_icon, "🎧");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_LISTENING, 0);
             lv_obj_clear_flag(s_ui_manager.confidence_meter, LV_OBJ_FLAG_HIDDEN);
@@ -448,7 +558,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_SPEECH_DETECTED:
             lv_label_set_text(s_ui_manager.status_label, "Speech detected - keep talking");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SECONDARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdyleft);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYLEFT));
             lv_label_set_text(s_ui_manager.mic_icon, "🗣️");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_SPEECH_DETECTED, 0);
             ui_manager_start_listening_animation();
@@ -458,7 +568,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_PROCESSING:
             lv_label_set_text(s_ui_manager.status_label, "Processing your request...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_ACCENT, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdymidget);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYMIDGET));
             lv_label_set_text(s_ui_manager.mic_icon, "🤔");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_PROCESSING, 0);
             ui_manager_start_processing_animation();
@@ -468,7 +578,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_THINKING:
             lv_label_set_text(s_ui_manager.status_label, "Thinking...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_ACCENT, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdymidget);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYMIDGET));
             lv_label_set_text(s_ui_manager.mic_icon, "🧠");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_PROCESSING, 0);
             ui_manager_start_processing_animation();
@@ -478,7 +588,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_SPEAKING:
             lv_label_set_text(s_ui_manager.status_label, "Howdy is speaking...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SECONDARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdyright2);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYRIGHT2));
             lv_label_set_text(s_ui_manager.mic_icon, "🔊");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_SPEAKING, 0);
             s_ui_manager.in_conversation = true;
@@ -487,7 +597,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_RESPONDING:
             lv_label_set_text(s_ui_manager.status_label, "Howdy is responding...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SECONDARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdyright2);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYRIGHT2));
             lv_label_set_text(s_ui_manager.mic_icon, "💬");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_SPEAKING, 0);
             s_ui_manager.in_conversation = true;
@@ -496,7 +606,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_CONVERSATION_ACTIVE:
             lv_label_set_text(s_ui_manager.status_label, "Conversation active - continue");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SECONDARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_armraisehowdy);
+            character_set_src(howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY));
             lv_label_set_text(s_ui_manager.mic_icon, "🎙️");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_CONVERSATION, 0);
             s_ui_manager.in_conversation = true;
@@ -505,7 +615,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_SESSION_ENDING:
             lv_label_set_text(s_ui_manager.status_label, "Session ending...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_PRIMARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_armraisehowdy);
+            character_set_src(howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY));
             lv_label_set_text(s_ui_manager.mic_icon, "👋");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_IDLE, 0);
             s_ui_manager.in_conversation = false;
@@ -514,7 +624,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_ERROR:
             lv_label_set_text(s_ui_manager.status_label, "Error - Check connection");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_ERROR, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdybackward);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD));
             lv_label_set_text(s_ui_manager.mic_icon, "⚠️");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_ERROR, 0);
             s_ui_manager.in_conversation = false;
@@ -524,7 +634,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_CONNECTING:
             lv_label_set_text(s_ui_manager.status_label, "Connecting to HowdyTTS server...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_ACCENT, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdybackward);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD));
             lv_label_set_text(s_ui_manager.mic_icon, "🔗");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_INIT, 0);
             s_ui_manager.in_conversation = false;
@@ -533,7 +643,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_DISCOVERING:
             lv_label_set_text(s_ui_manager.status_label, "Discovering HowdyTTS servers...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_ACCENT, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdybackward);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD));
             lv_label_set_text(s_ui_manager.mic_icon, "🔍");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_INIT, 0);
             ui_manager_start_processing_animation();
@@ -543,7 +653,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_REGISTERED:
             lv_label_set_text(s_ui_manager.status_label, "Connected to HowdyTTS server");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, HOWDY_COLOR_SECONDARY, LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_armraisehowdy);
+            character_set_src(howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY));
             lv_label_set_text(s_ui_manager.mic_icon, "✅");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_IDLE, 0);
             s_ui_manager.in_conversation = false;
@@ -552,7 +662,7 @@ static void update_ui_for_state(ui_state_t state)
         case UI_STATE_DISCONNECTED:
             lv_label_set_text(s_ui_manager.status_label, "Disconnected - reconnecting...");
             lv_obj_set_style_arc_color(s_ui_manager.level_arc, lv_color_hex(0x666666), LV_PART_INDICATOR);
-            lv_img_set_src(s_ui_manager.howdy_character, &howdy_img_howdybackward);
+            character_set_src(howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD));
             lv_label_set_text(s_ui_manager.mic_icon, "❌");
             lv_obj_set_style_bg_color(s_ui_manager.screen, HOWDY_BG_DISCONNECTED, 0);
             s_ui_manager.in_conversation = false;
@@ -578,6 +688,37 @@ static void update_ui_for_state(ui_state_t state)
             s_ui_manager.in_conversation ? "active" : "inactive");
 }
 
+static ui_mailbox_data_t *mailbox_write_begin(void)
+{
+    portENTER_CRITICAL(&s_mailbox.writer_lock);
+    atomic_fetch_add_explicit(&s_mailbox.seq, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    return &s_mailbox.data;
+}
+
+static void mailbox_write_end(void)
+{
+    atomic_fetch_add_explicit(&s_mailbox.seq, 1, memory_order_release);
+    portEXIT_CRITICAL(&s_mailbox.writer_lock);
+}
+
+// Consistent copy of the mailbox; false if producers kept it busy
+static bool mailbox_read(ui_mailbox_data_t *out)
+{
+    for (int i = 0; i < UI_MAILBOX_READ_TRIES; i++) {
+        unsigned seq = atomic_load_explicit(&s_mailbox.seq, memory_order_acquire);
+        if (seq & 1) {
+            continue;
+        }
+        memcpy(out, &s_mailbox.data, sizeof(*out));
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&s_mailbox.seq, memory_order_relaxed) == seq) {
+            return true;
+        }
+    }
+    return false;
+}
+
 esp_err_t ui_manager_init(void)
 {
     if (s_initialized) {
@@ -593,12 +734,37 @@ esp_err_t ui_manager_init(void)
     s_ui_manager.muted = false;
     s_ui_manager.wifi_signal_strength = 0;
     
+    // Character images come from the asset partition; without it the UI
+    // still runs, just with no character
+    if (howdy_asset_pack_init() != ESP_OK) {
+        ESP_LOGW(TAG, "Character images unavailable");
+    }
+    
+#ifdef CONFIG_HOWDY_UI_ROUND_CLIP
+    // Don't render or flush the corners the round panel can't show
+    if (ui_round_display_init(NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "Round display clipping unavailable");
+    }
+#endif
+    
+#ifdef CONFIG_HOWDY_UI_FRAME_GOVERNOR
+    // Refresh only as fast as the current state needs
+    if (ui_frame_governor_init(NULL) != ESP_OK) {
+        ESP_LOGW(TAG, "Frame governor unavailable");
+    }
+#endif
+    
     // Create main screen
     create_main_screen();
     
     // Load the screen
     lv_scr_load(s_ui_manager.screen);
     
+    memset(&s_mailbox.data, 0, sizeof(s_mailbox.data));
+    s_mailbox.data.state = UI_STATE_INIT;
+    s_applied = s_mailbox.data;
+    s_mailbox_timer = lv_timer_create(ui_mailbox_apply_cb, UI_MAILBOX_PERIOD_MS, NULL);
+    
     s_initialized = true;
     ESP_LOGI(TAG, "UI manager initialized successfully");
     
@@ -612,7 +778,10 @@ esp_err_t ui_manager_set_state(ui_state_t state)
         return ESP_ERR_INVALID_STATE;
     }
     
-    update_ui_for_state(state);
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    mb->state = state;
+    mb->state_gen++;
+    mailbox_write_end();
     return ESP_OK;
 }
 
@@ -683,13 +852,18 @@ esp_err_t ui_manager_update_status(const char *status)
         return ESP_ERR_INVALID_ARG;
     }
     
-    lv_label_set_text(s_ui_manager.status_label, status);
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    strlcpy(mb->status, status, sizeof(mb->status));
+    mb->status_gen++;
+    mb->status_state_gen = mb->state_gen;
+    mailbox_write_end();
     return ESP_OK;
 }
 
 ui_state_t ui_manager_get_state(void)
 {
-    return s_ui_manager.current_state;
+    // Latest requested state, which the display shows from its next refresh
+    return s_initialized ? s_mailbox.data.state : s_ui_manager.current_state;
 }
 
 bool ui_manager_is_muted(void)
@@ -711,7 +885,7 @@ static void breathing_animation_cb(lv_timer_t *timer)
     float scale_factor = 1.0f + 0.02f * sinf(s_ui_manager.animation_step * 3.14159f / 180.0f);
     uint16_t scale = (uint16_t)(256 * scale_factor);
     
-    lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, scale, 0);
+    character_set_zoom(scale);
 }
 
 /**
@@ -735,7 +909,7 @@ static void listening_animation_cb(lv_timer_t *timer)
     // Also pulse the character slightly
     float scale_factor = 1.0f + 0.05f * sinf(s_ui_manager.animation_step * 3.14159f / 180.0f);
     uint16_t scale = (uint16_t)(256 * scale_factor);
-    lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, scale, 0);
+    character_set_zoom(scale);
 }
 
 /**
@@ -747,13 +921,15 @@ static void processing_animation_cb(lv_timer_t *timer)
         return;
     }
     
-    // Rotate the main level arc to create spinner effect
+    // Rotate the main level arc to create spinner effect. Arc rotation just
+    // shifts the drawn angles; transform_angle would rasterise a layer and
+    // rotate it in software every frame.
     s_ui_manager.animation_step = (s_ui_manager.animation_step + 12) % 360;
-    lv_obj_set_style_transform_angle(s_ui_manager.level_arc, s_ui_manager.animation_step * 10, 0);
+    lv_arc_set_rotation(s_ui_manager.level_arc, s_ui_manager.animation_step);
     
     // Also rotate the confidence meter for visual interest
     if (s_ui_manager.confidence_meter) {
-        lv_obj_set_style_transform_angle(s_ui_manager.confidence_meter, -s_ui_manager.animation_step * 8, 0);
+        lv_arc_set_rotation(s_ui_manager.confidence_meter, (360 - (s_ui_manager.animation_step * 4 / 5) % 360) % 360);
     }
 }
 
@@ -793,36 +969,64 @@ static void wave_draw_event_cb(lv_event_t * e)
 
     lv_obj_t *obj = lv_event_get_target(e);
     lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
+    if (!draw_ctx->draw_line) return;
 
-    const int cx = obj->coords.x1 + lv_obj_get_width(obj)/2;
-    const int cy = obj->coords.y1 + lv_obj_get_height(obj)/2;
-    const float base_radius = 300.0f;   // around inner ring
-    const float max_amplitude = 30.0f;  // thickness outward
+    const lv_coord_t cx = obj->coords.x1 + lv_obj_get_width(obj)/2;
+    const lv_coord_t cy = obj->coords.y1 + lv_obj_get_height(obj)/2;
+    const lv_area_t *clip = draw_ctx->clip_area;
 
     lv_draw_line_dsc_t dsc;
     lv_draw_line_dsc_init(&dsc);
     dsc.color = HOWDY_COLOR_WAVEFORM;
-    dsc.width = 4;
+    dsc.width = WAVE_LINE_WIDTH;
     dsc.round_start = 1;
     dsc.round_end = 1;
 
     for (int i = 0; i < WAVE_SEGMENTS; i++) {
-        float t = (2.0f * 3.1415926f) * ((float)i / (float)WAVE_SEGMENTS);
-        // Recent history: map index so newest at angle 0
-        int idx = (s_wave_index + i) % WAVE_SEGMENTS;
-        float amp = ((float)s_wave_levels[idx] / 100.0f) * max_amplitude;
-        float r0 = base_radius;
-        float r1 = base_radius + amp;
-        lv_point_t p0 = { (lv_coord_t)(cx + r0 * cosf(t)), (lv_coord_t)(cy + r0 * sinf(t)) };
-        lv_point_t p1 = { (lv_coord_t)(cx + r1 * cosf(t)), (lv_coord_t)(cy + r1 * sinf(t)) };
-        if (draw_ctx->draw_line) {
-            draw_ctx->draw_line(draw_ctx, &dsc, &p0, &p1);
+        const wave_segment_geom_t *g = &s_wave_geom[i];
+        // Most redraws cover one or two segments; skip the rest outright
+        if (cx + g->bounds.x2 < clip->x1 || cx + g->bounds.x1 > clip->x2 ||
+            cy + g->bounds.y2 < clip->y1 || cy + g->bounds.y1 > clip->y2) {
+            continue;
         }
+        int32_t amp = (int32_t)s_wave_levels[i] * WAVE_MAX_AMPLITUDE / 100;
+        lv_point_t p0 = { (lv_coord_t)(cx + g->x0), (lv_coord_t)(cy + g->y0) };
+        lv_point_t p1 = {
+            (lv_coord_t)(p0.x + ((amp * g->dx + (1 << (WAVE_TRIG_SHIFT - 1))) >> WAVE_TRIG_SHIFT)),
+            (lv_coord_t)(p0.y + ((amp * g->dy + (1 << (WAVE_TRIG_SHIFT - 1))) >> WAVE_TRIG_SHIFT)),
+        };
+        draw_ctx->draw_line(draw_ctx, &dsc, &p0, &p1);
+    }
+}
+
+// Segment geometry is fixed, so the trig runs once here instead of per frame
+static void wave_init_geometry(void)
+{
+    const lv_coord_t pad = WAVE_LINE_WIDTH / 2 + 1;
+
+    for (int i = 0; i < WAVE_SEGMENTS; i++) {
+        float t = (2.0f * 3.1415926f) * ((float)i / (float)WAVE_SEGMENTS);
+        float c = cosf(t);
+        float sn = sinf(t);
+        wave_segment_geom_t *g = &s_wave_geom[i];
+        g->x0 = (int16_t)lroundf(WAVE_BASE_RADIUS * c);
+        g->y0 = (int16_t)lroundf(WAVE_BASE_RADIUS * sn);
+        g->dx = (int16_t)lroundf(c * (1 << WAVE_TRIG_SHIFT));
+        g->dy = (int16_t)lroundf(sn * (1 << WAVE_TRIG_SHIFT));
+
+        lv_coord_t x1 = (lv_coord_t)lroundf((WAVE_BASE_RADIUS + WAVE_MAX_AMPLITUDE) * c);
+        lv_coord_t y1 = (lv_coord_t)lroundf((WAVE_BASE_RADIUS + WAVE_MAX_AMPLITUDE) * sn);
+        g->bounds.x1 = LV_MIN(g->x0, x1) - pad;
+        g->bounds.y1 = LV_MIN(g->y0, y1) - pad;
+        g->bounds.x2 = LV_MAX(g->x0, x1) + pad;
+        g->bounds.y2 = LV_MAX(g->y0, y1) + pad;
     }
 }
 
 static void wave_init(lv_obj_t *parent)
 {
+    wave_init_geometry();
+
     s_wave_obj = lv_obj_create(parent);
     lv_obj_set_size(s_wave_obj, 700, 700);
     lv_obj_center(s_wave_obj);
@@ -832,11 +1036,35 @@ static void wave_init(lv_obj_t *parent)
     lv_obj_move_to_index(s_wave_obj, 0);
 }
 
+// Called with the mailbox lock held; the mailbox timer redraws
 static void wave_push_level(uint8_t level)
 {
-    s_wave_levels[s_wave_index] = level > 100 ? 100 : level;
-    s_wave_index = (s_wave_index + 1) % WAVE_SEGMENTS;
-    if (s_wave_obj) lv_obj_invalidate(s_wave_obj);
+    s_wave_levels[s_wave_count % WAVE_SEGMENTS] = level > 100 ? 100 : level;
+    s_wave_count++;
+}
+
+// LVGL task: invalidate only the segments written since the last frame
+static void wave_invalidate_changed(void)
+{
+    uint32_t count = s_wave_count;
+    uint32_t changed = count - s_wave_drawn_count;
+    if (changed == 0 || !s_wave_obj) {
+        return;
+    }
+    s_wave_drawn_count = count;
+
+    if (changed >= WAVE_FULL_REDRAW) {
+        lv_obj_invalidate(s_wave_obj);
+        return;
+    }
+
+    const lv_coord_t cx = s_wave_obj->coords.x1 + lv_obj_get_width(s_wave_obj)/2;
+    const lv_coord_t cy = s_wave_obj->coords.y1 + lv_obj_get_height(s_wave_obj)/2;
+    for (uint32_t n = count - changed; n != count; n++) {
+        const lv_area_t *b = &s_wave_geom[n % WAVE_SEGMENTS].bounds;
+        lv_area_t area = { cx + b->x1, cy + b->y1, cx + b->x2, cy + b->y2 };
+        lv_obj_invalidate_area(s_wave_obj, &area);
+    }
 }
 
 esp_err_t ui_manager_update_conversation_state(ui_state_t state,
@@ -851,46 +1079,35 @@ esp_err_t ui_manager_update_conversation_state(ui_state_t state,
         return ESP_ERR_INVALID_STATE;
     }
     
-    // Update audio levels and confidence
-    s_ui_manager.mic_level = mic_level;
-    s_ui_manager.tts_level = tts_level;
-    s_ui_manager.vad_confidence = vad_confidence;
-    if (wake_word_confidence >= 0.0f) {
-        s_ui_manager.wake_word_confidence = wake_word_confidence;
-    }
-    
-    // Update UI state
-    ui_manager_set_state(state);
-    
-    // Update status text if provided
+    // Post everything in one write so the display never shows half an update
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    mb->state = state;
+    mb->state_gen++;
     if (status_text) {
-        lv_label_set_text(s_ui_manager.status_label, status_text);
+        strlcpy(mb->status, status_text, sizeof(mb->status));
+        mb->status_gen++;
+        mb->status_state_gen = mb->state_gen;
     }
-    
-    // Update detail text if provided
-    if (detail_text && strlen(detail_text) > 0) {
-        lv_label_set_text(s_ui_manager.status_detail, detail_text);
-        lv_obj_clear_flag(s_ui_manager.status_detail, LV_OBJ_FLAG_HIDDEN);
+    if (detail_text && detail_text[0]) {
+        strlcpy(mb->detail, detail_text, sizeof(mb->detail));
+        mb->detail_gen++;
     }
-    
-    // Update audio visualization
-    ui_manager_update_mic_level(mic_level, vad_confidence);
-    ui_manager_update_tts_level(tts_level, 0.0f);  // No progress info in this call
-    
-    // Update confidence meter if in conversation
-    if (s_ui_manager.in_conversation && vad_confidence > 0.0f) {
-        int confidence_percent = (int)(vad_confidence * 100);
-        lv_arc_set_value(s_ui_manager.confidence_meter, confidence_percent);
-        
-        // Change color based on confidence level
-        if (vad_confidence > 0.8f) {
-            lv_obj_set_style_arc_color(s_ui_manager.confidence_meter, HOWDY_COLOR_VAD_HIGH, LV_PART_INDICATOR);
-        } else {
-            lv_obj_set_style_arc_color(s_ui_manager.confidence_meter, HOWDY_COLOR_VAD_LOW, LV_PART_INDICATOR);
-        }
-        
-        lv_obj_clear_flag(s_ui_manager.confidence_meter, LV_OBJ_FLAG_HIDDEN);
+    mb->mic_level = mic_level < 0 ? 0 : (mic_level > 100 ? 100 : mic_level);
+    mb->vad_confidence = vad_confidence;
+    mb->mic_gen++;
+    mb->tts_level = tts_level < 0 ? 0 : (tts_level > 100 ? 100 : tts_level);
+    mb->tts_progress = 0.0f;  // No progress info in this call
+    mb->tts_gen++;
+    wave_push_level((uint8_t)mb->tts_level);
+    if (vad_confidence > 0.0f) {
+        mb->meter_confidence = vad_confidence;
+        mb->confidence_gen++;
+    }
+    // Feeds the ring animation only; a detection is posted by show_wake_word_detection
+    if (wake_word_confidence >= 0.0f) {
+        mb->wake_confidence = wake_word_confidence;
     }
+    mailbox_write_end();
     
     ESP_LOGD(TAG, "Conversation state updated: %s, mic:%d, tts:%d, vad:%.2f, wake:%.2f",
             status_text ? status_text : "(no status)", mic_level, tts_level, vad_confidence, wake_word_confidence);
@@ -948,7 +1165,7 @@ esp_err_t ui_manager_start_breathing_animation(void)
     
     // Start gentle breathing animation (low frequency for subtle effect)
     s_ui_manager.animation_step = 0;
-    s_breathing_animation_timer = lv_timer_create(breathing_animation_cb, 100, NULL);
+    s_breathing_animation_timer = lv_timer_create(breathing_animation_cb, anim_period(ANIM_BREATHING_MS), NULL);
     
     ESP_LOGD(TAG, "Started breathing animation");
     return ESP_OK;
@@ -962,7 +1179,7 @@ esp_err_t ui_manager_stop_breathing_animation(void)
         
         // Reset character scale
         if (s_initialized && s_ui_manager.howdy_character) {
-            lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, 256, 0);
+            character_set_zoom(256);
         }
         
         ESP_LOGD(TAG, "Stopped breathing animation");
@@ -989,7 +1206,7 @@ esp_err_t ui_manager_start_listening_animation(void)
     // Start listening animation (optimized for performance - 25fps for smooth pulsing)
     s_ui_manager.animation_step = 0;
     s_ui_manager.listening_animation_active = true;
-    s_listening_animation_timer = lv_timer_create(listening_animation_cb, 40, NULL); // 40ms = 25fps
+    s_listening_animation_timer = lv_timer_create(listening_animation_cb, anim_period(ANIM_LISTENING_MS), NULL);
     
     ESP_LOGI(TAG, "Started listening animation");
     return ESP_OK;
@@ -1008,7 +1225,7 @@ esp_err_t ui_manager_stop_listening_animation(void)
                 lv_obj_set_style_arc_opa(s_ui_manager.outer_audio_ring, LV_OPA_COVER, LV_PART_INDICATOR);
             }
             if (s_ui_manager.howdy_character) {
-                lv_obj_set_style_transform_zoom(s_ui_manager.howdy_character, 256, 0);
+                character_set_zoom(256);
             }
         }
         
@@ -1036,7 +1253,7 @@ esp_err_t ui_manager_start_processing_animation(void)
     // Start processing spinner animation (optimized - 20fps for smooth rotation)
     s_ui_manager.animation_step = 0;
     s_ui_manager.processing_animation_active = true;
-    s_processing_animation_timer = lv_timer_create(processing_animation_cb, 50, NULL); // 50ms = 20fps
+    s_processing_animation_timer = lv_timer_create(processing_animation_cb, anim_period(ANIM_PROCESSING_MS), NULL);
     
     ESP_LOGI(TAG, "Started processing animation");
     return ESP_OK;
@@ -1052,10 +1269,10 @@ esp_err_t ui_manager_stop_processing_animation(void)
         // Reset rotations
         if (s_initialized) {
             if (s_ui_manager.level_arc) {
-                lv_obj_set_style_transform_angle(s_ui_manager.level_arc, 0, 0);
+                lv_arc_set_rotation(s_ui_manager.level_arc, 0);
             }
             if (s_ui_manager.confidence_meter) {
-                lv_obj_set_style_transform_angle(s_ui_manager.confidence_meter, 0, 0);
+                lv_arc_set_rotation(s_ui_manager.confidence_meter, 0);
             }
         }
         
@@ -1079,7 +1296,7 @@ esp_err_t ui_manager_start_wake_word_animation(void)
     // Start wake word pulse animation (optimized - 15fps for dramatic effect)
     s_ui_manager.animation_step = 0;
     s_ui_manager.wake_word_animation_active = true;
-    s_wake_word_animation_timer = lv_timer_create(wake_word_animation_cb, 67, NULL); // 67ms = ~15fps
+    s_wake_word_animation_timer = lv_timer_create(wake_word_animation_cb, anim_period(ANIM_WAKE_WORD_MS), NULL);
     
     ESP_LOGI(TAG, "Started wake word animation");
     return ESP_OK;
@@ -1116,34 +1333,74 @@ esp_err_t ui_manager_set_voice_callback(ui_voice_activation_callback_t callback)
     return ESP_OK;
 }
 
+esp_err_t ui_manager_set_touch_read_period(uint32_t period_ms)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    for (lv_indev_t *indev = lv_indev_get_next(NULL); indev; indev = lv_indev_get_next(indev)) {
+        if (lv_indev_get_type(indev) == LV_INDEV_TYPE_POINTER && indev->driver->read_timer) {
+            lv_timer_set_period(indev->driver->read_timer, period_ms);
+            ret = ESP_OK;
+        }
+    }
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Touch read period %lums", period_ms);
+    }
+    return ret;
+}
+
 esp_err_t ui_manager_update_mic_level(int level, float vad_confidence)
 {
     if (!s_initialized) {
         return ESP_ERR_INVALID_STATE;
     }
     
-    // Performance optimization: Rate limit updates to maintain smooth FPS
-    uint32_t current_time = esp_timer_get_time() / 1000;
-    if (current_time - s_last_update_time < MIN_UPDATE_INTERVAL_MS) {
-        return ESP_OK; // Skip update to maintain performance
+    // Clamp level to 0-100
+    if (level < 0) level = 0;
+    if (level > 100) level = 100;
+    
+    // Called from the audio path: post only, the mailbox timer draws it
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    mb->mic_level = level;
+    mb->vad_confidence = vad_confidence;
+    mb->mic_gen++;
+    mailbox_write_end();
+    
+    return ESP_OK;
+}
+
+esp_err_t ui_manager_update_tts_level(int level, float progress)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
     }
-    s_last_update_time = current_time;
     
     // Clamp level to 0-100
     if (level < 0) level = 0;
     if (level > 100) level = 100;
     
+    // Called from the TTS event callback: post only, the mailbox timer draws it
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    mb->tts_level = level;
+    mb->tts_progress = progress;
+    mb->tts_gen++;
+    // Feed waveform history for visual effect
+    wave_push_level((uint8_t)level);
+    mailbox_write_end();
+    
+    return ESP_OK;
+}
+
+static void apply_mic_level(int level, float vad_confidence)
+{
     // Only update if values have changed significantly (reduce unnecessary redraws)
     if (abs(s_ui_manager.mic_level - level) < 3 && 
         fabsf(s_ui_manager.vad_confidence - vad_confidence) < 0.05f) {
-        return ESP_OK;
+        return;
     }
     
     s_ui_manager.mic_level = level;
     s_ui_manager.vad_confidence = vad_confidence;
     
-    // Batch UI updates for better performance
-    lv_obj_invalidate(s_ui_manager.outer_audio_ring);
     lv_arc_set_value(s_ui_manager.outer_audio_ring, level);
     
     // Change color based on VAD confidence (cache color to avoid frequent changes)
@@ -1168,6 +1425,7 @@ esp_err_t ui_manager_update_mic_level(int level, float vad_confidence)
     lv_arc_set_value(s_ui_manager.level_arc, level);
     
     // Performance tracking
+    uint32_t current_time = esp_timer_get_time() / 1000;
     s_update_count++;
     if (s_update_count % 30 == 0) { // Calculate FPS every 30 updates
         static uint32_t last_fps_calc = 0;
@@ -1178,26 +1436,14 @@ esp_err_t ui_manager_update_mic_level(int level, float vad_confidence)
     }
     
     ESP_LOGV(TAG, "Mic level updated: %d%%, VAD: %.2f, FPS: %.1f", level, vad_confidence, s_average_fps);
-    
-    return ESP_OK;
 }
 
-esp_err_t ui_manager_update_tts_level(int level, float progress)
+static void apply_tts_level(int level, float progress)
 {
-    if (!s_initialized) {
-        return ESP_ERR_INVALID_STATE;
-    }
-    
-    // Clamp level to 0-100
-    if (level < 0) level = 0;
-    if (level > 100) level = 100;
-    
     s_ui_manager.tts_level = level;
     
     // Update inner audio ring (TTS output)
     lv_arc_set_value(s_ui_manager.inner_audio_ring, level);
-    // Feed waveform history for visual effect
-    wave_push_level((uint8_t)level);
     
     // Show TTS progress if available (0.0-1.0)
     if (progress >= 0.0f && progress <= 1.0f) {
@@ -1207,36 +1453,125 @@ esp_err_t ui_manager_update_tts_level(int level, float progress)
     }
     
     ESP_LOGV(TAG, "TTS level updated: %d%%, progress: %.2f", level, progress);
+}
+
+static void apply_wake_word_detection(float confidence)
+{
+    // Update wake word ring value and show it
+    int confidence_percent = (int)(confidence * 100);
+    lv_arc_set_value(s_ui_manager.wake_word_ring, confidence_percent);
+    lv_obj_clear_flag(s_ui_manager.wake_word_ring, LV_OBJ_FLAG_HIDDEN);
     
-    return ESP_OK;
+    // Start wake word animation
+    ui_manager_start_wake_word_animation();
 }
 
-esp_err_t ui_manager_show_wake_word_detection(float confidence, const char *phrase_detected)
+static void apply_confidence_meter(float vad_confidence)
 {
-    if (!s_initialized) {
-        return ESP_ERR_INVALID_STATE;
+    // Update confidence meter if in conversation
+    if (!s_ui_manager.in_conversation) {
+        return;
     }
     
-    s_ui_manager.wake_word_confidence = confidence;
+    int confidence_percent = (int)(vad_confidence * 100);
+    lv_arc_set_value(s_ui_manager.confidence_meter, confidence_percent);
     
-    // Update wake word ring value
-    int confidence_percent = (int)(confidence * 100);
-    lv_arc_set_value(s_ui_manager.wake_word_ring, confidence_percent);
+    // Change color based on confidence level
+    if (vad_confidence > 0.8f) {
+        lv_obj_set_style_arc_color(s_ui_manager.confidence_meter, HOWDY_COLOR_VAD_HIGH, LV_PART_INDICATOR);
+    } else {
+        lv_obj_set_style_arc_color(s_ui_manager.confidence_meter, HOWDY_COLOR_VAD_LOW, LV_PART_INDICATOR);
+    }
     
-    // Show wake word ring
-    lv_obj_clear_flag(s_ui_manager.wake_word_ring, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(s_ui_manager.confidence_meter, LV_OBJ_FLAG_HIDDEN);
+}
+
+#ifdef CONFIG_HOWDY_UI_FRAME_GOVERNOR
+// The governor changed the refresh period: apply posts and step animations no faster
+static void frame_pacing_apply(uint32_t period_ms)
+{
+    s_frame_period_ms = period_ms;
+    lv_timer_set_period(s_mailbox_timer, period_ms);
+    if (s_breathing_animation_timer) {
+        lv_timer_set_period(s_breathing_animation_timer, anim_period(ANIM_BREATHING_MS));
+    }
+    if (s_listening_animation_timer) {
+        lv_timer_set_period(s_listening_animation_timer, anim_period(ANIM_LISTENING_MS));
+    }
+    if (s_processing_animation_timer) {
+        lv_timer_set_period(s_processing_animation_timer, anim_period(ANIM_PROCESSING_MS));
+    }
+    if (s_wake_word_animation_timer) {
+        lv_timer_set_period(s_wake_word_animation_timer, anim_period(ANIM_WAKE_WORD_MS));
+    }
+}
+#endif
+
+/**
+ * @brief Apply what producers posted since the last display frame (LVGL task)
+ */
+static void ui_mailbox_apply_cb(lv_timer_t *timer)
+{
+    ui_mailbox_data_t mb;
+    if (!s_initialized || !mailbox_read(&mb)) {
+        return;  // Try again next frame
+    }
     
-    // Update status if phrase detected
-    if (phrase_detected && strlen(phrase_detected) > 0) {
-        char wake_word_status[128];
-        snprintf(wake_word_status, sizeof(wake_word_status), 
-                "'%s' detected (%.0f%% confidence)", phrase_detected, confidence * 100);
-        lv_label_set_text(s_ui_manager.status_detail, wake_word_status);
+    // State first: it resets rings and labels the later fields may set
+    if (mb.state_gen != s_applied.state_gen) {
+        update_ui_for_state(mb.state);
+    }
+    // A state change posted after the text brings its own default text
+    if (mb.status_gen != s_applied.status_gen && mb.status_state_gen == mb.state_gen) {
+        lv_label_set_text(s_ui_manager.status_label, mb.status);
+    }
+    if (mb.detail_gen != s_applied.detail_gen) {
+        lv_label_set_text(s_ui_manager.status_detail, mb.detail);
         lv_obj_clear_flag(s_ui_manager.status_detail, LV_OBJ_FLAG_HIDDEN);
     }
+    if (mb.mic_gen != s_applied.mic_gen) {
+        apply_mic_level(mb.mic_level, mb.vad_confidence);
+    }
+    if (mb.tts_gen != s_applied.tts_gen) {
+        apply_tts_level(mb.tts_level, mb.tts_progress);
+    }
+    if (mb.confidence_gen != s_applied.confidence_gen) {
+        apply_confidence_meter(mb.meter_confidence);
+    }
+    if (mb.wake_gen != s_applied.wake_gen) {
+        apply_wake_word_detection(mb.wake_confidence);
+    }
+    s_ui_manager.wake_word_confidence = mb.wake_confidence;   // Read by the wake ring animation
     
-    // Start wake word animation
-    ui_manager_start_wake_word_animation();
+    wave_invalidate_changed();
+    
+    s_applied = mb;
+    
+#ifdef CONFIG_HOWDY_UI_FRAME_GOVERNOR
+    uint32_t period_ms;
+    if (ui_frame_governor_update(&period_ms)) {
+        frame_pacing_apply(period_ms);
+    }
+#endif
+}
+
+esp_err_t ui_manager_show_wake_word_detection(float confidence, const char *phrase_detected)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // Called from the wake word callback on the audio path: post only
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    mb->wake_confidence = confidence;
+    mb->wake_gen++;
+    // Update status if phrase detected
+    if (phrase_detected && phrase_detected[0]) {
+        snprintf(mb->detail, sizeof(mb->detail), 
+                "'%s' detected (%.0f%% confidence)", phrase_detected, confidence * 100);
+        mb->detail_gen++;
+    }
+    mailbox_write_end();
     
     ESP_LOGI(TAG, "Wake word detection shown: %.2f confidence, phrase: %s", 
             confidence, phrase_detected ? phrase_detected : "(none)");
@@ -1331,7 +1666,7 @@ esp_err_t ui_manager_set_conversation_context(int context)
     // Update UI based on conversation context
     switch (context) {
         case 0: // VAD_CONVERSATION_IDLE
-            if (s_ui_manager.current_state != UI_STATE_ERROR) {
+            if (ui_manager_get_state() != UI_STATE_ERROR) {
                 ui_manager_set_state(UI_STATE_IDLE);
             }
             break;
@@ -1390,27 +1725,29 @@ esp_err_t ui_manager_show_error_with_recovery(const char *error_type,
         return ESP_ERR_INVALID_STATE;
     }
     
-    // Set error state
-    ui_manager_set_state(UI_STATE_ERROR);
-    
-    // Update error message
-    if (error_message) {
-        lv_label_set_text(s_ui_manager.status_label, error_message);
-    }
-    
     // Show recovery information
+    char detail_text[UI_DETAIL_TEXT_LEN] = "";
     if (error_type && recovery_time > 0) {
-        char recovery_text[128];
-        snprintf(recovery_text, sizeof(recovery_text), 
+        snprintf(detail_text, sizeof(detail_text), 
                 "%s error - recovering in %ds", error_type, recovery_time);
-        lv_label_set_text(s_ui_manager.status_detail, recovery_text);
-        lv_obj_clear_flag(s_ui_manager.status_detail, LV_OBJ_FLAG_HIDDEN);
     } else if (error_type) {
-        char error_text[128];
-        snprintf(error_text, sizeof(error_text), "%s error - attempting recovery", error_type);
-        lv_label_set_text(s_ui_manager.status_detail, error_text);
-        lv_obj_clear_flag(s_ui_manager.status_detail, LV_OBJ_FLAG_HIDDEN);
+        snprintf(detail_text, sizeof(detail_text), "%s error - attempting recovery", error_type);
+    }
+    
+    // Error state, message and recovery detail land in the same display frame
+    ui_mailbox_data_t *mb = mailbox_write_begin();
+    mb->state = UI_STATE_ERROR;
+    mb->state_gen++;
+    if (error_message) {
+        strlcpy(mb->status, error_message, sizeof(mb->status));
+        mb->status_gen++;
+        mb->status_state_gen = mb->state_gen;
+    }
+    if (detail_text[0]) {
+        strlcpy(mb->detail, detail_text, sizeof(mb->detail));
+        mb->detail_gen++;
     }
+    mailbox_write_end();
     
     ESP_LOGE(TAG, "Error shown: %s - %s (recovery in %ds)",
             error_type ? error_type : "Unknown",
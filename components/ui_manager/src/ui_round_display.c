@@ -0,0 +1,208 @@
+#include "ui_round_display.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include <math.h>
+#include <string.h>
+
+static const char *TAG = "RoundDisplay";
+
+#define ROUND_BAND_STEP_MIN     8       // px of span change before a new band
+#define ROUND_BAND_STEP_MAX     256
+#define ROUND_SPLIT_MIN_SAVING  8       // Split only if it saves at least 1/8 of the area
+
+static struct {
+    lv_disp_t *disp;
+    lv_coord_t hres;
+    lv_coord_t vres;
+    lv_coord_t *span_x1;            // Visible span per scanline; x1 > x2 if none
+    lv_coord_t *span_x2;
+    void (*prev_monitor_cb)(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px);
+    uint32_t pending_requested;     // Pixels invalidated for the refresh in progress
+    ui_round_display_stats_t stats;
+} s_round;
+
+static void round_build_span_table(void)
+{
+    // Circle inscribed in the panel; one extra pixel each side for antialiased edges
+    const float cx = s_round.hres / 2.0f;
+    const float cy = s_round.vres / 2.0f;
+    const float r = LV_MIN(s_round.hres, s_round.vres) / 2.0f;
+
+    for (lv_coord_t y = 0; y < s_round.vres; y++) {
+        float dy = (y + 0.5f) - cy;
+        float half = r * r - dy * dy;
+        if (half < 0.0f) {
+            s_round.span_x1[y] = 1;
+            s_round.span_x2[y] = 0;
+            continue;
+        }
+        half = sqrtf(half);
+        s_round.span_x1[y] = LV_MAX(0, (lv_coord_t)floorf(cx - half) - 1);
+        s_round.span_x2[y] = LV_MIN(s_round.hres - 1, (lv_coord_t)ceilf(cx + half));
+    }
+}
+
+/*
+ * Cut an area into bands fitted to the circle. Rows join the current band
+ * while both span ends stay within `step` of the band's first row.
+ * Returns the number of bands, or -1 if more than max were needed.
+ */
+static int round_bands(const lv_area_t *a, lv_coord_t step, lv_area_t *bands, int max)
+{
+    int n = 0;
+    lv_area_t *cur = NULL;
+    lv_coord_t first_x1 = 0, first_x2 = 0;
+
+    for (lv_coord_t y = a->y1; y <= a->y2; y++) {
+        lv_coord_t x1 = LV_MAX(a->x1, s_round.span_x1[y]);
+        lv_coord_t x2 = LV_MIN(a->x2, s_round.span_x2[y]);
+        if (x1 > x2) {
+            cur = NULL;
+            continue;
+        }
+        if (cur && LV_ABS(x1 - first_x1) <= step && LV_ABS(x2 - first_x2) <= step) {
+            cur->x1 = LV_MIN(cur->x1, x1);
+            cur->x2 = LV_MAX(cur->x2, x2);
+            cur->y2 = y;
+            continue;
+        }
+        if (n == max) {
+            return -1;
+        }
+        cur = &bands[n++];
+        cur->x1 = x1;
+        cur->x2 = x2;
+        cur->y1 = y;
+        cur->y2 = y;
+        first_x1 = x1;
+        first_x2 = x2;
+    }
+    return n;
+}
+
+static uint32_t round_bands_size(const lv_area_t *bands, int n)
+{
+    uint32_t px = 0;
+    for (int i = 0; i < n; i++) {
+        px += lv_area_get_size(&bands[i]);
+    }
+    return px;
+}
+
+// Rewrite the display's invalidated areas before LVGL joins and draws them
+static void round_clip_invalid_areas(lv_disp_t *disp)
+{
+    lv_area_t out[LV_INV_BUF_SIZE];
+    lv_area_t bands[LV_INV_BUF_SIZE];
+    int n = 0;
+    uint32_t requested = 0;
+
+    for (int i = 0; i < disp->inv_p; i++) {
+        const lv_area_t *a = &disp->inv_areas[i];
+        uint32_t size = lv_area_get_size(a);
+        requested += size;
+
+        // Leave room for one slot per area still to come
+        int budget = LV_INV_BUF_SIZE - n - (disp->inv_p - 1 - i);
+        int count = -1;
+        for (lv_coord_t step = ROUND_BAND_STEP_MIN; step <= ROUND_BAND_STEP_MAX && count < 0; step *= 2) {
+            count = round_bands(a, step, bands, budget);
+        }
+        if (count < 0) {
+            // Too many bands: use their visible bounding box instead
+            count = round_bands(a, LV_MAX(s_round.hres, s_round.vres), bands, budget);
+        }
+
+        if (count == 0) {
+            s_round.stats.areas_dropped++;
+            continue;
+        }
+        if (count < 0 || size - round_bands_size(bands, count) < size / ROUND_SPLIT_MIN_SAVING) {
+            out[n++] = *a;
+            continue;
+        }
+        memcpy(&out[n], bands, count * sizeof(lv_area_t));
+        n += count;
+        s_round.stats.areas_split++;
+    }
+
+    memcpy(disp->inv_areas, out, n * sizeof(lv_area_t));
+    memset(disp->inv_area_joined, 0, sizeof(disp->inv_area_joined));
+    disp->inv_p = n;
+    s_round.pending_requested = requested;
+}
+
+static void round_refr_timer_cb(lv_timer_t *timer)
+{
+    lv_disp_t *disp = timer->user_data;
+    if (disp == s_round.disp && disp->inv_p > 0) {
+        round_clip_invalid_areas(disp);
+    }
+    _lv_disp_refr_timer(timer);
+}
+
+static void round_monitor_cb(lv_disp_drv_t *drv, uint32_t time_ms, uint32_t px)
+{
+    ui_round_display_stats_t *st = &s_round.stats;
+    st->refreshes++;
+    st->px_requested += s_round.pending_requested;
+    st->px_rendered += px;
+
+    if (s_round.pending_requested > (uint32_t)s_round.hres * s_round.vres / 2) {
+        st->large_refreshes++;
+        st->large_time_ms_total += time_ms;
+        if (time_ms > st->large_time_ms_max) {
+            st->large_time_ms_max = time_ms;
+        }
+    }
+    s_round.pending_requested = 0;
+
+    if (s_round.prev_monitor_cb) {
+        s_round.prev_monitor_cb(drv, time_ms, px);
+    }
+}
+
+esp_err_t ui_round_display_init(lv_disp_t *disp)
+{
+    if (!disp) {
+        disp = lv_disp_get_default();
+    }
+    if (!disp || !disp->driver || !disp->refr_timer) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_round.disp) {
+        return s_round.disp == disp ? ESP_OK : ESP_ERR_INVALID_STATE;
+    }
+    if (disp->driver->full_refresh || disp->driver->direct_mode) {
+        // Every frame is the whole buffer; nothing to clip
+        ESP_LOGI(TAG, "Display uses full refresh/direct mode, circle clipping off");
+        return ESP_OK;
+    }
+
+    s_round.hres = disp->driver->hor_res;
+    s_round.vres = disp->driver->ver_res;
+    s_round.span_x1 = heap_caps_malloc(s_round.vres * sizeof(lv_coord_t), MALLOC_CAP_INTERNAL);
+    s_round.span_x2 = heap_caps_malloc(s_round.vres * sizeof(lv_coord_t), MALLOC_CAP_INTERNAL);
+    if (!s_round.span_x1 || !s_round.span_x2) {
+        heap_caps_free(s_round.span_x1);
+        heap_caps_free(s_round.span_x2);
+        s_round.span_x1 = s_round.span_x2 = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    round_build_span_table();
+
+    s_round.disp = disp;
+    s_round.prev_monitor_cb = disp->driver->monitor_cb;
+    disp->driver->monitor_cb = round_monitor_cb;
+    lv_timer_set_cb(disp->refr_timer, round_refr_timer_cb);
+
+    ESP_LOGI(TAG, "Clipping redraws to the %dx%d circle", s_round.hres, s_round.vres);
+    return ESP_OK;
+}
+
+void ui_round_display_get_stats(ui_round_display_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_round.stats;
+    }
+}
@@ -0,0 +1,178 @@
+#include "ui_sprite_cache.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+#include <string.h>
+
+static const char *TAG = "SpriteCache";
+
+#ifndef CONFIG_HOWDY_UI_SPRITE_CACHE_KB
+#define CONFIG_HOWDY_UI_SPRITE_CACHE_KB 768
+#endif
+
+#define SPRITE_CACHE_MAX_ENTRIES    48
+#define SPRITE_CACHE_CAPACITY       ((size_t)CONFIG_HOWDY_UI_SPRITE_CACHE_KB * 1024)
+
+typedef struct {
+    const lv_img_dsc_t *src;        // NULL if the slot is free
+    uint16_t zoom;
+    uint32_t last_used;
+    lv_img_dsc_t dsc;               // Handed to lv_img_set_src(), so its address must stay put
+} sprite_entry_t;
+
+static sprite_entry_t s_entries[SPRITE_CACHE_MAX_ENTRIES];
+static const sprite_entry_t *s_last_returned = NULL;
+static uint32_t s_use_clock = 0;
+static ui_sprite_cache_stats_t s_stats = {
+    .capacity = SPRITE_CACHE_CAPACITY,
+};
+
+static inline lv_color_t sprite_pixel(const lv_color_t *px, int w, int h, int x, int y)
+{
+    if (x < 0 || y < 0 || x >= w || y >= h) {
+        return lv_color_black();    // The character images sit on black
+    }
+    return px[y * w + x];
+}
+
+// Bilinear zoom about the centre into a buffer the size of the source
+static void sprite_render_zoom(const lv_img_dsc_t *src, uint16_t zoom, lv_color_t *out)
+{
+    const lv_color_t *px = (const lv_color_t *)src->data;
+    const int w = src->header.w;
+    const int h = src->header.h;
+
+    for (int y = 0; y < h; y++) {
+        // Source position of this pixel's centre, Q8
+        int32_t v = ((2 * y + 1 - h) * 128 * 256) / zoom + h * 128 - 128;
+        int y0 = v >> 8;
+        lv_opa_t fy = (lv_opa_t)(v & 0xFF);
+
+        for (int x = 0; x < w; x++) {
+            int32_t u = ((2 * x + 1 - w) * 128 * 256) / zoom + w * 128 - 128;
+            int x0 = u >> 8;
+            lv_opa_t fx = (lv_opa_t)(u & 0xFF);
+
+            // lv_color_mix(a, b, mix) weights a by mix/255 and handles byte swapping
+            lv_color_t top = lv_color_mix(sprite_pixel(px, w, h, x0 + 1, y0),
+                                          sprite_pixel(px, w, h, x0, y0), fx);
+            lv_color_t bottom = lv_color_mix(sprite_pixel(px, w, h, x0 + 1, y0 + 1),
+                                             sprite_pixel(px, w, h, x0, y0 + 1), fx);
+            out[y * w + x] = lv_color_mix(bottom, top, fy);
+        }
+    }
+}
+
+static void sprite_evict(sprite_entry_t *entry)
+{
+    lv_img_cache_invalidate_src(&entry->dsc);
+    heap_caps_free((void *)entry->dsc.data);
+    s_stats.bytes -= entry->dsc.data_size;
+    s_stats.entries--;
+    s_stats.evictions++;
+    memset(entry, 0, sizeof(*entry));
+}
+
+// Least recently used entry other than the one on screen
+static sprite_entry_t *sprite_lru_victim(void)
+{
+    sprite_entry_t *victim = NULL;
+    for (int i = 0; i < SPRITE_CACHE_MAX_ENTRIES; i++) {
+        sprite_entry_t *e = &s_entries[i];
+        if (!e->src || e == s_last_returned) {
+            continue;
+        }
+        if (!victim || (int32_t)(e->last_used - victim->last_used) < 0) {
+            victim = e;
+        }
+    }
+    return victim;
+}
+
+static sprite_entry_t *sprite_free_slot(size_t need)
+{
+    while (s_stats.bytes + need > SPRITE_CACHE_CAPACITY || s_stats.entries >= SPRITE_CACHE_MAX_ENTRIES) {
+        sprite_entry_t *victim = sprite_lru_victim();
+        if (!victim) {
+            return NULL;
+        }
+        sprite_evict(victim);
+    }
+    for (int i = 0; i < SPRITE_CACHE_MAX_ENTRIES; i++) {
+        if (!s_entries[i].src) {
+            return &s_entries[i];
+        }
+    }
+    return NULL;
+}
+
+const lv_img_dsc_t *ui_sprite_cache_get_zoomed(const lv_img_dsc_t *src, uint16_t zoom)
+{
+    if (!src || zoom == 0 || SPRITE_CACHE_CAPACITY == 0) {
+        return NULL;
+    }
+
+    zoom = (uint16_t)((zoom + UI_SPRITE_ZOOM_STEP / 2) / UI_SPRITE_ZOOM_STEP * UI_SPRITE_ZOOM_STEP);
+    if (zoom == LV_IMG_ZOOM_NONE) {
+        return src;
+    }
+
+    for (int i = 0; i < SPRITE_CACHE_MAX_ENTRIES; i++) {
+        sprite_entry_t *e = &s_entries[i];
+        if (e->src == src && e->zoom == zoom) {
+            e->last_used = ++s_use_clock;
+            s_last_returned = e;
+            s_stats.hits++;
+            return &e->dsc;
+        }
+    }
+
+    size_t need = (size_t)src->header.w * src->header.h * sizeof(lv_color_t);
+    if (src->header.cf != LV_IMG_CF_TRUE_COLOR || src->data_size < need || need > SPRITE_CACHE_CAPACITY) {
+        s_stats.failures++;
+        return NULL;
+    }
+
+    sprite_entry_t *entry = sprite_free_slot(need);
+    lv_color_t *data = entry ? heap_caps_malloc(need, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT) : NULL;
+    if (!data) {
+        s_stats.failures++;
+        return NULL;
+    }
+
+    int64_t start = esp_timer_get_time();
+    sprite_render_zoom(src, zoom, data);
+    ESP_LOGD(TAG, "Rendered %ux%u at zoom %u in %lldμs", src->header.w, src->header.h, zoom,
+             esp_timer_get_time() - start);
+
+    entry->src = src;
+    entry->zoom = zoom;
+    entry->last_used = ++s_use_clock;
+    entry->dsc.header = src->header;
+    entry->dsc.data_size = need;
+    entry->dsc.data = (const uint8_t *)data;
+    s_last_returned = entry;
+
+    s_stats.misses++;
+    s_stats.entries++;
+    s_stats.bytes += need;
+    return &entry->dsc;
+}
+
+void ui_sprite_cache_clear(void)
+{
+    for (int i = 0; i < SPRITE_CACHE_MAX_ENTRIES; i++) {
+        if (s_entries[i].src) {
+            sprite_evict(&s_entries[i]);
+        }
+    }
+    s_last_returned = NULL;
+}
+
+void ui_sprite_cache_get_stats(ui_sprite_cache_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_stats;
+    }
+}
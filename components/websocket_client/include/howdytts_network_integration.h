@@ -3,7 +3,10 @@
  * @brief HowdyTTS Native Protocol Integration for ESP32-P4 HowdyScreen
  * 
  * Provides native HowdyTTS protocol support with:
- * - UDP discovery protocol (port 8001)
+ * - UDP discovery protocol (port 8001), probing servers cached in NVS and
+ *   found over mDNS by unicast alongside the broadcast
+ * - Continuous RTT/loss/load probing of known servers, moving audio to a
+ *   better server between conversations
  * - PCM audio streaming via UDP (port 8003) 
  * - HTTP state management server (port 8080)
  * - Automatic server discovery and device registration
@@ -49,6 +52,10 @@ extern "C" {
 #define HOWDYTTS_MAX_ROOM_NAME_LEN     32
 #define HOWDYTTS_MAX_DEVICE_NAME_LEN   64
 
+// Server Cache (NVS)
+#define HOWDYTTS_SERVER_CACHE_MAX      8       // Servers remembered across boots
+#define HOWDYTTS_SERVER_CACHE_MAX_AGE  16      // Answered discovery runs before an unheard server is dropped
+
 // Network Timeouts
 #define HOWDYTTS_DISCOVERY_TIMEOUT_MS  10000
 #define HOWDYTTS_CONNECTION_TIMEOUT_MS 5000
@@ -133,6 +140,8 @@ typedef struct {
     bool enable_fallback;                               ///< Enable WebSocket fallback
     uint32_t discovery_timeout_ms;                      ///< Discovery timeout
     uint8_t connection_retry_count;                     ///< Retry attempts
+    bool enable_rtp;                                    ///< Stream RTP/RTCP instead of the custom UDP header
+    bool enable_server_migration;                       ///< Move to a better-scoring server between conversations
 } howdytts_integration_config_t;
 
 /**
@@ -152,6 +161,63 @@ typedef struct {
     uint32_t last_update_time;         ///< Last statistics update
 } howdytts_audio_stats_t;
 
+/**
+ * @brief Which probe reached a discovered server first
+ */
+typedef enum {
+    HOWDYTTS_DISCOVERY_SOURCE_NONE = 0,
+    HOWDYTTS_DISCOVERY_SOURCE_CACHE,       ///< Unicast probe to a server cached in NVS
+    HOWDYTTS_DISCOVERY_SOURCE_MDNS,        ///< Unicast probe to a _howdytts._tcp mDNS answer
+    HOWDYTTS_DISCOVERY_SOURCE_BROADCAST    ///< Global or subnet broadcast
+} howdytts_discovery_source_t;
+
+/**
+ * @brief HowdyTTS Discovery Statistics
+ */
+typedef struct {
+    uint32_t runs;                         ///< Discovery runs started
+    uint32_t runs_answered;                ///< Runs that heard at least one server
+    uint32_t last_first_response_ms;       ///< Run start to first server response, last answered run
+    uint32_t best_first_response_ms;       ///< Fastest first response
+    uint32_t worst_first_response_ms;      ///< Slowest first response
+    howdytts_discovery_source_t last_source; ///< Probe that reached the last first responder
+    uint32_t cache_hits;                   ///< First responders reached through the NVS cache
+    uint32_t mdns_hits;                    ///< ... through mDNS
+    uint32_t broadcast_hits;               ///< ... through broadcast
+    uint8_t cached_servers;                ///< Servers currently in the NVS cache
+} howdytts_discovery_stats_t;
+
+/**
+ * @brief Health of one known server, from periodic unicast probes
+ *
+ * Lower score is better: RTT scaled up by loss, plus reported load.
+ */
+typedef struct {
+    char hostname[64];                 ///< Server hostname
+    char ip_address[16];               ///< Server IP address
+    float rtt_ms;                      ///< EWMA of probe round trips
+    float loss;                        ///< EWMA of unanswered probes (0.0-1.0)
+    int8_t load;                       ///< Server-reported load percent, -1 if not reported
+    float score;                       ///< Selection score, -1 until the server has answered
+    uint32_t probes_sent;              ///< Probes sent
+    uint32_t replies;                  ///< Probes answered
+    bool current;                      ///< Audio currently goes to this server
+} howdytts_server_metrics_t;
+
+/**
+ * @brief Server selection decisions
+ */
+typedef struct {
+    uint32_t migrations;               ///< Moves to a better server
+    uint32_t deferred;                 ///< Better server found while a conversation was running
+    char last_decision[16];            ///< "migrated", "deferred" or "" if none yet
+    char last_from[16];                ///< Server IP before the last decision
+    char last_to[16];                  ///< Candidate IP of the last decision
+    float last_from_score;             ///< Scores when the last decision was made
+    float last_to_score;
+    uint32_t last_decision_ms;         ///< Uptime of the last decision
+} howdytts_migration_stats_t;
+
 /**
  * @brief HowdyTTS PCM Audio Packet Structure
  */
@@ -175,6 +241,7 @@ typedef enum {
     HOWDYTTS_EVENT_AUDIO_STREAMING_STOPPED,///< Audio streaming stopped
     HOWDYTTS_EVENT_VA_STATE_CHANGED,       ///< Voice assistant state changed
     HOWDYTTS_EVENT_PROTOCOL_SWITCHED,      ///< Protocol switched (UDP/WebSocket)
+    HOWDYTTS_EVENT_SERVER_MIGRATED,        ///< Audio moved to a better server (data.server_info)
     HOWDYTTS_EVENT_ERROR                   ///< Error occurred
 } howdytts_event_type_t;
 
@@ -197,7 +264,11 @@ typedef struct {
 /**
  * @brief Audio Data Callback Function
  * 
- * Called when audio data is ready for streaming to HowdyTTS server
+ * Called from the streaming task for every captured frame while streaming
+ * is active. The samples are in DMA memory and only valid during the call,
+ * so copy them out and return quickly. When set, the callback owns the
+ * uplink: the streaming task no longer sends the frame itself, and the
+ * application passes it to howdytts_stream_audio() from one task.
  * 
  * @param audio_data Pointer to audio data (PCM 16-bit)
  * @param samples Number of samples
@@ -293,6 +364,10 @@ esp_err_t howdytts_disconnect(void);
 /**
  * @brief Stream audio data to HowdyTTS server
  * 
+ * While the UDP streamer is running (howdytts_start_audio_streaming) the
+ * samples go through udp_audio_send(), RTP-framed when enable_rtp is set.
+ * Otherwise a legacy howdytts_pcm_packet_t is sent; RTP sessions refuse that.
+ * 
  * @param audio_data Pointer to PCM audio data
  * @param samples Number of samples
  * @return ESP_OK on success
@@ -347,6 +422,49 @@ esp_err_t howdytts_get_discovered_servers(howdytts_server_info_t *servers,
                                          size_t max_servers, 
                                          size_t *server_count);
 
+/**
+ * @brief Get discovery latency statistics
+ * 
+ * @param stats Pointer to statistics structure
+ * @return ESP_OK on success
+ */
+esp_err_t howdytts_get_discovery_stats(howdytts_discovery_stats_t *stats);
+
+/**
+ * @brief Short name of a discovery source, e.g. "cache"
+ */
+const char *howdytts_discovery_source_name(howdytts_discovery_source_t source);
+
+/**
+ * @brief Get probe metrics for every known server
+ * 
+ * @param metrics Array of metrics structures
+ * @param max_servers Maximum number of servers
+ * @param server_count Actual number of servers returned
+ * @return ESP_OK on success
+ */
+esp_err_t howdytts_get_server_metrics(howdytts_server_metrics_t *metrics,
+                                     size_t max_servers,
+                                     size_t *server_count);
+
+/**
+ * @brief Get server selection statistics
+ * 
+ * @param stats Pointer to statistics structure
+ * @return ESP_OK on success
+ */
+esp_err_t howdytts_get_migration_stats(howdytts_migration_stats_t *stats);
+
+/**
+ * @brief Tell the integration whether a conversation is in progress locally
+ * 
+ * Server migration only happens while neither this nor the server-reported
+ * voice assistant state shows a conversation.
+ * 
+ * @param active true from wake word until the conversation returns to idle
+ */
+void howdytts_set_conversation_active(bool active);
+
 /**
  * @brief Update device status (audio level, battery, signal strength)
  * 
@@ -2,6 +2,10 @@
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "esp_websocket_client.h"
+#include "esp_heap_caps.h"
+#include "howdy_memory_pool.h"
+#include "howdy_heap_tags.h"
+#include "howdy_mem_placement.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
@@ -14,6 +18,7 @@ static const char *TAG = "VAD_Feedback";
 
 // Forward declarations for internal functions
 static esp_err_t decode_base64_audio_optimized(const char *base64_data, uint8_t **audio_data, size_t *audio_len, uint8_t *pool_index);
+static void release_tts_audio(uint8_t *audio_data, uint8_t pool_index);
 
 // JSON message templates
 #define JSON_WAKE_WORD_TEMPLATE \
@@ -113,18 +118,15 @@ typedef struct {
 #define TTS_AUDIO_CHUNK_POOL_SIZE 8
 #define MAX_TTS_CHUNK_SIZE 1024  // Max audio chunk size in bytes
 
-// Pre-allocated audio chunk pool for zero-malloc audio processing
-static struct {
-    uint8_t buffer[MAX_TTS_CHUNK_SIZE];
-    bool in_use;
-} s_tts_chunk_pool[TTS_AUDIO_CHUNK_POOL_SIZE] = {0};
+// Pre-allocated audio chunk pool for zero-malloc audio processing,
+// shared by all clients and created with the first one
+static howdy_pool_t *s_tts_chunk_pool = NULL;
 
 // TTS audio queue item (optimized for performance)
 typedef struct {
-    vad_feedback_tts_chunk_t chunk_data;
+    vad_feedback_tts_chunk_t chunk_data;  // chunk_data.pool_index tracks the buffer
     bool session_start;
     bool session_end;
-    uint8_t pool_index;  // Index in pre-allocated pool (0xFF if not using pool)
     vad_feedback_tts_session_t session_info;  // Only valid if session_start is true
     vad_feedback_tts_end_t end_info;          // Only valid if session_end is true
 } tts_audio_queue_item_t;
@@ -233,6 +235,18 @@ vad_feedback_handle_t vad_feedback_init(const vad_feedback_config_t *config,
         return NULL;
     }
     
+    if (!s_tts_chunk_pool) {
+        howdy_pool_config_t pool_cfg = {
+            .name = "vad_tts",
+            .block_size = MAX_TTS_CHUNK_SIZE,
+            .block_count = TTS_AUDIO_CHUNK_POOL_SIZE,
+            .caps = howdy_mem_caps(HOWDY_MEM_BULK),
+        };
+        if (howdy_pool_create(&pool_cfg, &s_tts_chunk_pool) != ESP_OK) {
+            ESP_LOGW(TAG, "TTS chunk pool unavailable, decoded audio will use malloc");
+        }
+    }
+    
     // Create TTS audio queue for streaming audio chunks
     client->tts_audio_queue = xQueueCreate(20, sizeof(tts_audio_queue_item_t));
     if (!client->tts_audio_queue) {
@@ -323,7 +337,7 @@ esp_err_t vad_feedback_deinit(vad_feedback_handle_t handle)
         while (xQueueReceive(client->tts_audio_queue, &tts_item, 0) == pdTRUE) {
             // Free audio data if allocated
             if (tts_item.chunk_data.audio_data) {
-                free(tts_item.chunk_data.audio_data);
+                release_tts_audio(tts_item.chunk_data.audio_data, tts_item.chunk_data.pool_index);
             }
         }
         vQueueDelete(client->tts_audio_queue);
@@ -332,7 +346,7 @@ esp_err_t vad_feedback_deinit(vad_feedback_handle_t handle)
     // Clean up message queue
     vad_feedback_message_t msg;
     while (xQueueReceive(client->send_queue, &msg, 0) == pdTRUE) {
-        free(msg.json_data);
+        HOWDY_FREE(msg.json_data);
     }
     vQueueDelete(client->send_queue);
     
@@ -628,7 +642,7 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
             
         case WEBSOCKET_EVENT_DATA:
             if (data->op_code == 0x01) { // Text frame
-                char *message = malloc(data->data_len + 1);
+                char *message = HOWDY_MALLOC(HOWDY_HEAP_TAG_VAD_FEEDBACK, data->data_len + 1, MALLOC_CAP_DEFAULT);
                 if (message) {
                     memcpy(message, data->data_ptr, data->data_len);
                     message[data->data_len] = '\0';
@@ -639,7 +653,7 @@ static void websocket_event_handler(void *handler_args, esp_event_base_t base,
                     ESP_LOGD(TAG, "Received VAD feedback message: %s", message);
                     process_server_message(client, message);
                     
-                    free(message);
+                    HOWDY_FREE(message);
                 }
             }
             break;
@@ -678,7 +692,7 @@ static void send_task(void *pvParameters)
             
             // Free message data
             if (msg.json_data) {
-                free(msg.json_data);
+                HOWDY_FREE(msg.json_data);
             }
         }
         
@@ -705,7 +719,7 @@ static esp_err_t queue_json_message(vad_feedback_client_t *client, const char *j
     
     vad_feedback_message_t msg;
     msg.json_len = strlen(json_data);
-    msg.json_data = malloc(msg.json_len + 1);
+    msg.json_data = HOWDY_MALLOC(HOWDY_HEAP_TAG_VAD_FEEDBACK, msg.json_len + 1, MALLOC_CAP_DEFAULT);
     
     if (!msg.json_data) {
         ESP_LOGE(TAG, "Failed to allocate memory for JSON message");
@@ -716,7 +730,7 @@ static esp_err_t queue_json_message(vad_feedback_client_t *client, const char *j
     
     if (xQueueSend(client->send_queue, &msg, pdMS_TO_TICKS(100)) != pdTRUE) {
         ESP_LOGW(TAG, "Failed to queue JSON message - queue full");
-        free(msg.json_data);
+        HOWDY_FREE(msg.json_data);
         return ESP_ERR_TIMEOUT;
     }
     
@@ -987,15 +1001,7 @@ static void tts_processing_task(void *pvParameters)
                 
                 // Performance optimized cleanup: use pool or free as appropriate
                 if (item.chunk_data.audio_data) {
-                    if (item.pool_index != 0xFF && item.pool_index < TTS_AUDIO_CHUNK_POOL_SIZE) {
-                        // Return buffer to pool
-                        s_tts_chunk_pool[item.pool_index].in_use = false;
-                        ESP_LOGV(TAG, "Returned TTS chunk to pool (index: %d)", item.pool_index);
-                    } else {
-                        // Free malloc'd buffer
-                        free(item.chunk_data.audio_data);
-                        ESP_LOGV(TAG, "Freed malloc'd TTS chunk buffer");
-                    }
+                    release_tts_audio(item.chunk_data.audio_data, item.chunk_data.pool_index);
                 }
             }
         }
@@ -1309,21 +1315,16 @@ static esp_err_t decode_base64_audio_optimized(const char *base64_data, uint8_t
     uint8_t *decoded_buffer = NULL;
     uint8_t selected_pool_index = 0xFF;
     
-    if (max_decoded_len <= MAX_TTS_CHUNK_SIZE) {
-        // Find available pool buffer
-        for (uint8_t i = 0; i < TTS_AUDIO_CHUNK_POOL_SIZE; i++) {
-            if (!s_tts_chunk_pool[i].in_use) {
-                s_tts_chunk_pool[i].in_use = true;
-                decoded_buffer = s_tts_chunk_pool[i].buffer;
-                selected_pool_index = i;
-                break;
-            }
+    if (s_tts_chunk_pool && max_decoded_len <= MAX_TTS_CHUNK_SIZE) {
+        decoded_buffer = howdy_pool_alloc(s_tts_chunk_pool);
+        if (decoded_buffer) {
+            selected_pool_index = (uint8_t)howdy_pool_index(s_tts_chunk_pool, decoded_buffer);
         }
     }
     
     // Fallback to malloc if pool is exhausted or chunk too large
     if (!decoded_buffer) {
-        decoded_buffer = malloc(max_decoded_len);
+        decoded_buffer = HOWDY_MALLOC(HOWDY_HEAP_TAG_VAD_FEEDBACK, max_decoded_len, MALLOC_CAP_DEFAULT);
         if (!decoded_buffer) {
             ESP_LOGE(TAG, "Failed to allocate buffer for decoded audio (%zu bytes)", max_decoded_len);
             return ESP_ERR_NO_MEM;
@@ -1340,21 +1341,13 @@ static esp_err_t decode_base64_audio_optimized(const char *base64_data, uint8_t
     
     if (ret != 0) {
         ESP_LOGE(TAG, "Base64 decode failed: %d (%.1fμs)", ret, (float)decode_time);
-        if (selected_pool_index != 0xFF) {
-            s_tts_chunk_pool[selected_pool_index].in_use = false;
-        } else {
-            free(decoded_buffer);
-        }
+        release_tts_audio(decoded_buffer, selected_pool_index);
         return ESP_ERR_INVALID_ARG;
     }
     
     if (decoded_len == 0) {
         ESP_LOGW(TAG, "Base64 decode resulted in zero bytes (%.1fμs)", (float)decode_time);
-        if (selected_pool_index != 0xFF) {
-            s_tts_chunk_pool[selected_pool_index].in_use = false;
-        } else {
-            free(decoded_buffer);
-        }
+        release_tts_audio(decoded_buffer, selected_pool_index);
         return ESP_ERR_INVALID_ARG;
     }
     
@@ -1367,6 +1360,23 @@ static esp_err_t decode_base64_audio_optimized(const char *base64_data, uint8_t
     return ESP_OK;
 }
 
+// Return decoded audio to the chunk pool, or free it if it was malloc'd
+static void release_tts_audio(uint8_t *audio_data, uint8_t pool_index)
+{
+    if (pool_index == 0xFF) {
+        HOWDY_FREE(audio_data);
+        ESP_LOGV(TAG, "Freed malloc'd TTS chunk buffer");
+        return;
+    }
+
+    esp_err_t ret = howdy_pool_free(s_tts_chunk_pool, audio_data);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "TTS chunk pool free failed (index: %d): %s", pool_index, esp_err_to_name(ret));
+        return;
+    }
+    ESP_LOGV(TAG, "Returned TTS chunk to pool (index: %d)", pool_index);
+}
+
 // Legacy wrapper for compatibility
 static esp_err_t decode_base64_audio(const char *base64_data, uint8_t **audio_data, size_t *audio_len)
 {
@@ -1385,7 +1395,7 @@ static esp_err_t queue_tts_audio_item(vad_feedback_client_t *client, const tts_a
         
         // Free audio data if this was a chunk item
         if (!item->session_start && !item->session_end && item->chunk_data.audio_data) {
-            free((void*)item->chunk_data.audio_data);
+            release_tts_audio(item->chunk_data.audio_data, item->chunk_data.pool_index);
         }
         
         return ESP_ERR_TIMEOUT;
@@ -1477,7 +1487,8 @@ esp_err_t vad_feedback_handle_tts_audio_chunk(vad_feedback_handle_t handle,
     
     // Allocate and copy audio data
     if (chunk_data->audio_data && chunk_data->chunk_size > 0) {
-        chunk_copy.audio_data = malloc(chunk_data->chunk_size);
+        chunk_copy.audio_data = HOWDY_MALLOC(HOWDY_HEAP_TAG_VAD_FEEDBACK, chunk_data->chunk_size, howdy_mem_caps(HOWDY_MEM_BULK));
+        chunk_copy.pool_index = 0xFF;
         if (!chunk_copy.audio_data) {
             ESP_LOGE(TAG, "Failed to allocate memory for TTS audio chunk");
             return ESP_ERR_NO_MEM;
@@ -1626,7 +1637,7 @@ esp_err_t vad_feedback_cancel_tts_session(vad_feedback_handle_t handle,
             tts_audio_queue_item_t item;
             while (xQueueReceive(client->tts_audio_queue, &item, 0) == pdTRUE) {
                 if (!item.session_start && !item.session_end && item.chunk_data.audio_data) {
-                    free((void*)item.chunk_data.audio_data);
+                    release_tts_audio(item.chunk_data.audio_data, item.chunk_data.pool_index);
                 }
             }
             
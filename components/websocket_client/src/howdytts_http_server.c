@@ -276,7 +276,7 @@ static esp_err_t status_handler(httpd_req_t *req)
     
     ESP_LOGD(TAG, "Status response sent");
     
-    free(json_string);
+    cJSON_free(json_string);
     cJSON_Delete(status_json);
     
     return ESP_OK;
@@ -355,7 +355,7 @@ static esp_err_t send_json_response(httpd_req_t *req, int status_code, const cha
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, json_string, strlen(json_string));
     
-    free(json_string);
+    cJSON_free(json_string);
     cJSON_Delete(response);
     
     return ESP_OK;
@@ -8,6 +8,12 @@
 #include "howdytts_network_integration.h"
 #include "udp_audio_streamer.h"
 #include "dual_i2s_manager.h"
+#include "audio_processor.h"
+#include "howdy_heap_tags.h"
+#include "howdy_latency.h"
+#include "howdy_trace.h"
+#include "howdy_sched_monitor.h"
+#include "howdy_boot.h"
 #include "esp_log.h"
 #include "esp_system.h"
 #include "esp_timer.h"
@@ -16,15 +22,76 @@
 #include "lwip/sockets.h"
 #include "lwip/netdb.h"
 #include "esp_http_server.h"
+#include "esp_heap_caps.h"
+#include "nvs.h"
+#include "mdns.h"
 #include "cJSON.h"
+#include <stdlib.h>
 #include <string.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <errno.h>
+#include <float.h>
 
 static const char *TAG = "HowdyTTS";
 
+// Discovery probing
+#define DISCOVERY_PROBE_INTERVAL_MS    2000    // Re-send broadcast and unicast probes
+#define DISCOVERY_MAX_PROBES           12      // Unicast targets per run (cache + mDNS)
+#define DISCOVERY_MDNS_TIMEOUT_MS      1500    // Per query; re-issued each probe round
+
+// Servers heard from, persisted so the next boot can probe them directly
+#define SERVER_CACHE_NAMESPACE         "howdytts"
+#define SERVER_CACHE_KEY               "servers"
+#define SERVER_CACHE_VERSION           1
+
+typedef struct {
+    uint32_t ip;                       // Network byte order
+    uint32_t last_seen_run;            // Discovery run that last heard from it
+    uint16_t rtt_ms;                   // Probe round trip when last heard
+    uint16_t reserved;
+    char hostname[32];
+} server_cache_entry_t;
+
+typedef struct {
+    uint8_t version;
+    uint8_t count;
+    uint16_t reserved;
+    uint32_t run;                      // Answered discovery runs so far
+    server_cache_entry_t entries[HOWDYTTS_SERVER_CACHE_MAX];
+} server_cache_t;
+
+typedef struct {
+    uint32_t ip;
+    int64_t sent_us;
+    howdytts_discovery_source_t source;
+} discovery_probe_t;
+
+// Server health probing and migration
+#define MONITOR_PROBE_INTERVAL_MS      2000    // One unicast probe per known server per round
+#define MONITOR_EWMA_ALPHA             0.2f
+#define MONITOR_LOSS_WEIGHT            10.0f   // 10% loss doubles a server's score
+#define MONITOR_LOAD_MS_PER_PCT        1.0f    // Reported load, as ms of RTT per percent
+#define MONITOR_MIN_REPLIES            3       // Before a server can be chosen
+#define MIGRATION_MARGIN               0.7f    // Candidate must score below 70% of the current server
+#define MIGRATION_MIN_GAIN_MS          10.0f   // ... and at least this much lower
+#define MIGRATION_CONFIRM_ROUNDS       3       // Consecutive rounds the candidate must stay best
+#define MIGRATION_IDLE_MS              5000    // Quiet time after a conversation before moving
+
+typedef struct {
+    uint32_t ip;                       // Network byte order
+    char ip_address[16];
+    char hostname[64];
+    float rtt_ms;                      // EWMA
+    float loss;                        // EWMA of unanswered probes
+    int8_t load;                       // -1 if the server doesn't report it
+    uint32_t probes_sent;
+    uint32_t replies;
+    int64_t probe_sent_us;
+    bool awaiting;                     // Probe of the current round not answered yet
+} server_health_t;
+
 // Global state structure
 typedef struct {
     // Configuration
@@ -53,6 +120,30 @@ typedef struct {
     // Tasks and timers
     TaskHandle_t discovery_task;
     TaskHandle_t audio_streaming_task;
+    
+    // Discovery (owned by discovery_task; stats, and server_cache changes the
+    // monitor task reads, under discovery_lock)
+    server_cache_t server_cache;
+    bool server_cache_dirty;
+    discovery_probe_t probes[DISCOVERY_MAX_PROBES];
+    size_t probe_count;
+    int64_t discovery_start_us;
+    int64_t broadcast_sent_us;
+    bool discovery_answered;
+    howdytts_discovery_stats_t discovery_stats;
+    
+    // Server health (written by server_monitor_task; copied out under monitor_lock)
+    TaskHandle_t monitor_task;
+    bool monitor_active;
+    server_health_t health[HOWDYTTS_SERVER_CACHE_MAX];
+    size_t health_count;
+    int migration_candidate;           // health[] index, -1 if none
+    int candidate_rounds;
+    bool candidate_deferred;
+    bool conversation_active;
+    int64_t last_activity_us;          // Last conversation or VA state change
+    howdytts_migration_stats_t migration_stats;
+    howdy_sched_handle_t streaming_sched;
     esp_timer_handle_t keepalive_timer;
     
     // Synchronization
@@ -64,6 +155,8 @@ typedef struct {
 } howdytts_integration_state_t;
 
 static howdytts_integration_state_t s_howdytts_state = {0};
+static portMUX_TYPE s_discovery_lock = portMUX_INITIALIZER_UNLOCKED;
+static portMUX_TYPE s_monitor_lock = portMUX_INITIALIZER_UNLOCKED;
 
 // Forward declarations
 static void discovery_task(void *pvParameters);
@@ -71,7 +164,8 @@ static void audio_streaming_task(void *pvParameters);
 static esp_err_t start_http_server(void);
 static esp_err_t stop_http_server(void);
 static esp_err_t send_discovery_request(void);
-static esp_err_t handle_discovery_response(const char *response, const char *from_ip);
+static esp_err_t handle_discovery_response(const char *response, const char *from_ip, float rtt_ms);
+static void server_monitor_task(void *pvParameters);
 static esp_err_t create_audio_packet(const int16_t *audio_data, size_t samples, 
                                    howdytts_pcm_packet_t **packet, size_t *packet_size);
 static void audio_streaming_task(void *pvParameters);
@@ -168,6 +262,7 @@ static void set_va_state(howdytts_va_state_t new_state, const char *state_text)
         if (s_howdytts_state.va_state != new_state) {
             howdytts_va_state_t old_state = s_howdytts_state.va_state;
             s_howdytts_state.va_state = new_state;
+            s_howdytts_state.last_activity_us = esp_timer_get_time();
             
             ESP_LOGI(TAG, "Voice assistant state: %s -> %s", 
                     va_state_to_string(old_state),
@@ -183,6 +278,30 @@ static void set_va_state(howdytts_va_state_t new_state, const char *state_text)
     }
 }
 
+// connected_server is rewritten by connect, disconnect and migration (on the
+// monitor task); everyone else works from a copy taken under state_mutex
+static bool get_connected_server(howdytts_server_info_t *out)
+{
+    if (xSemaphoreTake(s_howdytts_state.state_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return false;
+    }
+    *out = s_howdytts_state.connected_server;
+    xSemaphoreGive(s_howdytts_state.state_mutex);
+    return true;
+}
+
+static void set_connected_server(const howdytts_server_info_t *info)
+{
+    if (xSemaphoreTake(s_howdytts_state.state_mutex, pdMS_TO_TICKS(100)) == pdTRUE) {
+        if (info) {
+            s_howdytts_state.connected_server = *info;
+        } else {
+            memset(&s_howdytts_state.connected_server, 0, sizeof(s_howdytts_state.connected_server));
+        }
+        xSemaphoreGive(s_howdytts_state.state_mutex);
+    }
+}
+
 // HTTP Server Handlers
 static esp_err_t http_state_handler(httpd_req_t *req)
 {
@@ -274,12 +393,86 @@ static esp_err_t http_status_handler(httpd_req_t *req)
     cJSON_AddItemToArray(capabilities, cJSON_CreateString("lvgl"));
     cJSON_AddItemToObject(json, "capabilities", capabilities);
     
+    // Live bytes per subsystem; /heap has the full breakdown
+    howdy_heap_tag_stats_t tags[HOWDY_HEAP_TAG_COUNT];
+    if (howdy_heap_get_tag_stats(tags) == ESP_OK) {
+        cJSON *heap = cJSON_CreateObject();
+        for (int i = 0; i < HOWDY_HEAP_TAG_COUNT; i++) {
+            cJSON_AddNumberToObject(heap, tags[i].name, tags[i].live_bytes);
+        }
+        cJSON_AddItemToObject(json, "heap", heap);
+    }
+    
+    // TTS playout: underruns concealed from pitch history, and silent gaps
+    uint32_t frames_processed;
+    float avg_latency_ms;
+    uint8_t protocol_active;
+    tts_plc_stats_t plc;
+    if (audio_processor_get_stats(&frames_processed, &avg_latency_ms, &protocol_active, &plc) == ESP_OK) {
+        cJSON *playback = cJSON_CreateObject();
+        cJSON_AddNumberToObject(playback, "concealment_events", plc.concealment_events);
+        cJSON_AddNumberToObject(playback, "concealed_frames", plc.concealed_frames);
+        cJSON_AddNumberToObject(playback, "silence_frames", plc.silence_frames);
+        cJSON_AddNumberToObject(playback, "crossfades", plc.crossfades);
+        cJSON_AddNumberToObject(playback, "last_pitch_samples", plc.last_pitch_samples);
+        cJSON_AddItemToObject(json, "playback", playback);
+    }
+    
+    howdytts_discovery_stats_t disc;
+    howdytts_get_discovery_stats(&disc);
+    cJSON *discovery = cJSON_CreateObject();
+    cJSON_AddNumberToObject(discovery, "runs", disc.runs);
+    cJSON_AddNumberToObject(discovery, "runs_answered", disc.runs_answered);
+    cJSON_AddNumberToObject(discovery, "last_first_response_ms", disc.last_first_response_ms);
+    cJSON_AddNumberToObject(discovery, "best_first_response_ms", disc.best_first_response_ms);
+    cJSON_AddNumberToObject(discovery, "worst_first_response_ms", disc.worst_first_response_ms);
+    cJSON_AddStringToObject(discovery, "last_source", howdytts_discovery_source_name(disc.last_source));
+    cJSON_AddNumberToObject(discovery, "cache_hits", disc.cache_hits);
+    cJSON_AddNumberToObject(discovery, "mdns_hits", disc.mdns_hits);
+    cJSON_AddNumberToObject(discovery, "broadcast_hits", disc.broadcast_hits);
+    cJSON_AddNumberToObject(discovery, "cached_servers", disc.cached_servers);
+    cJSON_AddItemToObject(json, "discovery", discovery);
+    
+    // Per-server probe metrics and the last switching decision
+    howdytts_server_metrics_t metrics[HOWDYTTS_SERVER_CACHE_MAX];
+    size_t metric_count = 0;
+    howdytts_get_server_metrics(metrics, HOWDYTTS_SERVER_CACHE_MAX, &metric_count);
+    cJSON *servers = cJSON_CreateArray();
+    for (size_t i = 0; i < metric_count; i++) {
+        cJSON *server = cJSON_CreateObject();
+        cJSON_AddStringToObject(server, "hostname", metrics[i].hostname);
+        cJSON_AddStringToObject(server, "ip", metrics[i].ip_address);
+        cJSON_AddBoolToObject(server, "current", metrics[i].current);
+        cJSON_AddNumberToObject(server, "rtt_ms", metrics[i].rtt_ms);
+        cJSON_AddNumberToObject(server, "loss", metrics[i].loss);
+        cJSON_AddNumberToObject(server, "load", metrics[i].load);
+        cJSON_AddNumberToObject(server, "score", metrics[i].score);
+        cJSON_AddNumberToObject(server, "probes_sent", metrics[i].probes_sent);
+        cJSON_AddNumberToObject(server, "replies", metrics[i].replies);
+        cJSON_AddItemToArray(servers, server);
+    }
+    cJSON_AddItemToObject(json, "servers", servers);
+    
+    howdytts_migration_stats_t mig;
+    howdytts_get_migration_stats(&mig);
+    cJSON *selection = cJSON_CreateObject();
+    cJSON_AddBoolToObject(selection, "enabled", s_howdytts_state.config.enable_server_migration);
+    cJSON_AddNumberToObject(selection, "migrations", mig.migrations);
+    cJSON_AddNumberToObject(selection, "deferred", mig.deferred);
+    cJSON_AddStringToObject(selection, "last_decision", mig.last_decision);
+    cJSON_AddStringToObject(selection, "last_from", mig.last_from);
+    cJSON_AddStringToObject(selection, "last_to", mig.last_to);
+    cJSON_AddNumberToObject(selection, "last_from_score", mig.last_from_score);
+    cJSON_AddNumberToObject(selection, "last_to_score", mig.last_to_score);
+    cJSON_AddNumberToObject(selection, "last_decision_ms", mig.last_decision_ms);
+    cJSON_AddItemToObject(json, "selection", selection);
+    
     char *json_string = cJSON_Print(json);
     cJSON_Delete(json);
     
     httpd_resp_set_type(req, "application/json");
     httpd_resp_sendstr(req, json_string);
-    free(json_string);
+    cJSON_free(json_string);
     
     return ESP_OK;
 }
@@ -301,12 +494,294 @@ static esp_err_t http_health_handler(httpd_req_t *req)
     cJSON_AddNumberToObject(audio_stats, "average_latency_ms", s_howdytts_state.audio_stats.average_latency_ms);
     cJSON_AddItemToObject(json, "audio_stats", audio_stats);
     
+    // RTP transport statistics (RTCP loss/jitter/RTT)
+    rtp_session_stats_t rtp_stats;
+    if (udp_audio_get_rtp_stats(&rtp_stats) == ESP_OK) {
+        cJSON *rtp = cJSON_CreateObject();
+        cJSON_AddNumberToObject(rtp, "ssrc", rtp_stats.ssrc);
+        cJSON_AddNumberToObject(rtp, "packets_sent", rtp_stats.packets_sent);
+        cJSON_AddNumberToObject(rtp, "packets_received", rtp_stats.packets_received);
+        cJSON_AddNumberToObject(rtp, "cumulative_lost", rtp_stats.cumulative_lost);
+        cJSON_AddNumberToObject(rtp, "fraction_lost", rtp_stats.fraction_lost / 256.0);
+        cJSON_AddNumberToObject(rtp, "jitter_ms", rtp_stats.jitter_ms);
+        cJSON_AddNumberToObject(rtp, "remote_cumulative_lost", rtp_stats.remote_cumulative_lost);
+        cJSON_AddNumberToObject(rtp, "remote_fraction_lost", rtp_stats.remote_fraction_lost / 256.0);
+        cJSON_AddNumberToObject(rtp, "remote_jitter_ms", rtp_stats.remote_jitter_ms);
+        cJSON_AddNumberToObject(rtp, "rtt_ms", rtp_stats.rtt_ms);
+        cJSON_AddNumberToObject(rtp, "reports_sent", rtp_stats.reports_sent);
+        cJSON_AddNumberToObject(rtp, "reports_received", rtp_stats.reports_received);
+        cJSON_AddItemToObject(json, "rtp", rtp);
+    }
+    
+    char *json_string = cJSON_Print(json);
+    cJSON_Delete(json);
+    
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, json_string);
+    cJSON_free(json_string);
+    
+    return ESP_OK;
+}
+
+static esp_err_t http_latency_handler(httpd_req_t *req)
+{
+    // Optional ?reset=1 clears the histograms after this response
+    char query[32];
+    char value[8];
+    bool reset = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+                 httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK &&
+                 strcmp(value, "1") == 0;
+    
+    cJSON *json = cJSON_CreateObject();
+    
+    howdy_lat_counters_t counters;
+    howdy_lat_get_counters(&counters);
+    cJSON_AddNumberToObject(json, "utterances", counters.completed);
+    cJSON_AddNumberToObject(json, "abandoned", counters.abandoned);
+    cJSON_AddBoolToObject(json, "in_progress", counters.in_progress != 0);
+    
+    cJSON *span_array = cJSON_CreateArray();
+    for (int i = 0; i < HOWDY_LAT_SPAN_COUNT; i++) {
+        howdy_lat_summary_t lat;
+        if (howdy_lat_get_summary((howdy_lat_span_t)i, &lat) != ESP_OK) {
+            continue;
+        }
+        cJSON *span = cJSON_CreateObject();
+        cJSON_AddStringToObject(span, "span", lat.name);
+        cJSON_AddNumberToObject(span, "count", lat.count);
+        cJSON_AddNumberToObject(span, "min_us", lat.min_us);
+        cJSON_AddNumberToObject(span, "mean_us", lat.mean_us);
+        cJSON_AddNumberToObject(span, "p50_us", lat.p50_us);
+        cJSON_AddNumberToObject(span, "p95_us", lat.p95_us);
+        cJSON_AddNumberToObject(span, "p99_us", lat.p99_us);
+        cJSON_AddNumberToObject(span, "max_us", lat.max_us);
+        cJSON_AddItemToArray(span_array, span);
+    }
+    cJSON_AddItemToObject(json, "spans", span_array);
+    
+    char *json_string = cJSON_Print(json);
+    cJSON_Delete(json);
+    
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, json_string);
+    cJSON_free(json_string);
+    
+    if (reset) {
+        howdy_lat_reset();
+    }
+    return ESP_OK;
+}
+
+static esp_err_t http_tasks_handler(httpd_req_t *req)
+{
+    // Optional ?reset=1 clears the periodic counters after this response
+    char query[32];
+    char value[8];
+    bool reset = httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+                 httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK &&
+                 strcmp(value, "1") == 0;
+    
+    howdy_sched_periodic_stats_t *periodic = heap_caps_malloc(HOWDY_SCHED_MAX_PERIODIC * sizeof(*periodic), MALLOC_CAP_DEFAULT);
+    howdy_sched_task_stats_t *tasks = heap_caps_malloc(HOWDY_SCHED_MAX_TASKS * sizeof(*tasks), MALLOC_CAP_DEFAULT);
+    if (!periodic || !tasks) {
+        heap_caps_free(periodic);
+        heap_caps_free(tasks);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Out of memory");
+    }
+    size_t periodic_count = howdy_sched_get_periodic(periodic, HOWDY_SCHED_MAX_PERIODIC);
+    size_t task_count = howdy_sched_get_tasks(tasks, HOWDY_SCHED_MAX_TASKS);
+    howdy_sched_summary_t summary;
+    howdy_sched_get_summary(&summary);
+    
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, "window_ms", summary.window_ms);
+    if (summary.idle_percent >= 0.0f) {
+        cJSON_AddNumberToObject(json, "idle_percent", summary.idle_percent);
+    }
+    
+    cJSON *periodic_array = cJSON_CreateArray();
+    for (size_t i = 0; i < periodic_count; i++) {
+        const howdy_sched_periodic_stats_t *st = &periodic[i];
+        cJSON *task = cJSON_CreateObject();
+        cJSON_AddStringToObject(task, "name", st->name);
+        cJSON_AddBoolToObject(task, "running", st->running);
+        cJSON_AddNumberToObject(task, "period_us", st->period_us);
+        cJSON_AddNumberToObject(task, "cycles", st->cycles);
+        cJSON_AddNumberToObject(task, "misses", st->misses);
+        cJSON_AddNumberToObject(task, "consecutive_misses", st->consecutive_misses);
+        cJSON_AddNumberToObject(task, "max_consecutive_misses", st->max_consecutive_misses);
+        cJSON_AddNumberToObject(task, "overruns", st->overruns);
+        cJSON_AddNumberToObject(task, "jitter_avg_us", st->jitter_avg_us);
+        cJSON_AddNumberToObject(task, "jitter_max_us", st->jitter_max_us);
+        cJSON_AddNumberToObject(task, "work_avg_us", st->work_avg_us);
+        cJSON_AddNumberToObject(task, "work_max_us", st->work_max_us);
+        cJSON_AddNumberToObject(task, "stack_free_min", st->stack_free_min);
+        if (st->cpu_percent >= 0.0f) {
+            cJSON_AddNumberToObject(task, "cpu_percent", st->cpu_percent);
+        }
+        cJSON_AddItemToArray(periodic_array, task);
+    }
+    cJSON_AddItemToObject(json, "periodic", periodic_array);
+    
+    cJSON *task_array = cJSON_CreateArray();
+    for (size_t i = 0; i < task_count; i++) {
+        cJSON *task = cJSON_CreateObject();
+        cJSON_AddStringToObject(task, "name", tasks[i].name);
+        cJSON_AddNumberToObject(task, "priority", tasks[i].priority);
+        cJSON_AddNumberToObject(task, "core", tasks[i].core);
+        cJSON_AddNumberToObject(task, "stack_free_min", tasks[i].stack_free_min);
+        if (tasks[i].cpu_percent >= 0.0f) {
+            cJSON_AddNumberToObject(task, "cpu_percent", tasks[i].cpu_percent);
+        }
+        cJSON_AddItemToArray(task_array, task);
+    }
+    cJSON_AddItemToObject(json, "tasks", task_array);
+    
+    heap_caps_free(periodic);
+    heap_caps_free(tasks);
+    
+    char *json_string = cJSON_Print(json);
+    cJSON_Delete(json);
+    
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, json_string);
+    cJSON_free(json_string);
+    
+    if (reset) {
+        howdy_sched_reset();
+    }
+    return ESP_OK;
+}
+
+static esp_err_t http_boot_handler(httpd_req_t *req)
+{
+    howdy_boot_summary_t summary;
+    howdy_boot_get_summary(&summary);
+    howdy_boot_stage_stats_t stages[HOWDY_BOOT_MAX_STAGES];
+    size_t count = howdy_boot_get_stages(stages, HOWDY_BOOT_MAX_STAGES);
+    
+    // Times are ms since reset
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddBoolToObject(json, "parallel", summary.parallel);
+    cJSON_AddNumberToObject(json, "start_ms", summary.start_us / 1000.0);
+    if (summary.end_us) {
+        cJSON_AddNumberToObject(json, "end_ms", summary.end_us / 1000.0);
+        cJSON_AddNumberToObject(json, "serial_ms", summary.serial_us / 1000.0);
+    }
+    cJSON_AddNumberToObject(json, "failed", summary.failed);
+    
+    cJSON *stage_array = cJSON_CreateArray();
+    for (size_t i = 0; i < count; i++) {
+        const howdy_boot_stage_stats_t *st = &stages[i];
+        cJSON *stage = cJSON_CreateObject();
+        cJSON_AddStringToObject(stage, "name", st->name);
+        cJSON_AddStringToObject(stage, "status", howdy_boot_status_name(st->status));
+        cJSON_AddBoolToObject(stage, "milestone", st->milestone);
+        if (st->core >= 0) {
+            cJSON_AddNumberToObject(stage, "core", st->core);
+        }
+        if (st->ready_us) {
+            cJSON_AddNumberToObject(stage, "ready_ms", st->ready_us / 1000.0);
+        }
+        if (st->start_us) {
+            cJSON_AddNumberToObject(stage, "start_ms", st->start_us / 1000.0);
+        }
+        if (st->end_us) {
+            cJSON_AddNumberToObject(stage, "end_ms", st->end_us / 1000.0);
+        }
+        if (st->err != ESP_OK) {
+            cJSON_AddStringToObject(stage, "error", esp_err_to_name(st->err));
+        }
+        cJSON_AddItemToArray(stage_array, stage);
+    }
+    cJSON_AddItemToObject(json, "stages", stage_array);
+    
+    char *json_string = cJSON_Print(json);
+    cJSON_Delete(json);
+    
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_sendstr(req, json_string);
+    cJSON_free(json_string);
+    return ESP_OK;
+}
+
+static esp_err_t trace_send_chunk(void *ctx, const char *data, size_t len)
+{
+    return httpd_resp_send_chunk((httpd_req_t *)ctx, data, len);
+}
+
+static esp_err_t http_trace_handler(httpd_req_t *req)
+{
+    // Chrome trace-event JSON; open in ui.perfetto.dev or chrome://tracing
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"howdy_trace.json\"");
+    
+    esp_err_t ret = howdy_trace_dump(trace_send_chunk, req);
+    if (ret == ESP_ERR_INVALID_STATE) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_sendstr(req, "{\"error\":\"tracing disabled\"}");
+        return ESP_OK;
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Trace dump failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static esp_err_t http_heap_handler(httpd_req_t *req)
+{
+    // Optional ?sample=N switches call-site sampling (0 = off)
+    char query[32];
+    char value[12];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+        httpd_query_key_value(query, "sample", value, sizeof(value)) == ESP_OK) {
+        howdy_heap_set_sampling((uint32_t)strtoul(value, NULL, 10));
+    }
+    
+    cJSON *json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, "free_heap", esp_get_free_heap_size());
+    cJSON_AddNumberToObject(json, "min_free_heap", esp_get_minimum_free_heap_size());
+    cJSON_AddNumberToObject(json, "largest_free_block", heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT));
+    
+    howdy_heap_tag_stats_t tags[HOWDY_HEAP_TAG_COUNT];
+    howdy_heap_get_tag_stats(tags);
+    cJSON *tag_array = cJSON_CreateArray();
+    for (int i = 0; i < HOWDY_HEAP_TAG_COUNT; i++) {
+        cJSON *tag = cJSON_CreateObject();
+        cJSON_AddStringToObject(tag, "tag", tags[i].name);
+        cJSON_AddNumberToObject(tag, "live_bytes", tags[i].live_bytes);
+        cJSON_AddNumberToObject(tag, "peak_bytes", tags[i].peak_bytes);
+        cJSON_AddNumberToObject(tag, "live_blocks", tags[i].live_blocks);
+        cJSON_AddNumberToObject(tag, "allocs", tags[i].allocs);
+        cJSON_AddNumberToObject(tag, "frees", tags[i].frees);
+        cJSON_AddNumberToObject(tag, "failures", tags[i].failures);
+        cJSON_AddNumberToObject(tag, "alloc_rate", tags[i].alloc_rate);
+        cJSON_AddItemToArray(tag_array, tag);
+    }
+    cJSON_AddItemToObject(json, "tags", tag_array);
+    
+    howdy_heap_site_t sites[HOWDY_HEAP_SITE_COUNT];
+    size_t site_count = howdy_heap_get_sites(sites, HOWDY_HEAP_SITE_COUNT);
+    cJSON *site_array = cJSON_CreateArray();
+    for (size_t i = 0; i < site_count; i++) {
+        cJSON *site = cJSON_CreateObject();
+        cJSON_AddStringToObject(site, "file", sites[i].file);
+        cJSON_AddNumberToObject(site, "line", sites[i].line);
+        cJSON_AddStringToObject(site, "tag", howdy_heap_tag_name(sites[i].tag));
+        cJSON_AddNumberToObject(site, "samples", sites[i].samples);
+        cJSON_AddNumberToObject(site, "sampled_bytes", sites[i].sampled_bytes);
+        cJSON_AddNumberToObject(site, "live_bytes", sites[i].live_bytes);
+        cJSON_AddItemToArray(site_array, site);
+    }
+    cJSON_AddItemToObject(json, "sites", site_array);
+    
     char *json_string = cJSON_Print(json);
     cJSON_Delete(json);
     
     httpd_resp_set_type(req, "application/json");
     httpd_resp_sendstr(req, json_string);
-    free(json_string);
+    cJSON_free(json_string);
     
     return ESP_OK;
 }
@@ -315,7 +790,7 @@ static esp_err_t start_http_server(void)
 {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = HOWDYTTS_HTTP_PORT;
-    config.max_uri_handlers = 8;
+    config.max_uri_handlers = 10;
     
     if (httpd_start((httpd_handle_t*)&s_howdytts_state.http_server_handle, &config) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to start HTTP server");
@@ -355,6 +830,46 @@ static esp_err_t start_http_server(void)
     };
     httpd_register_uri_handler((httpd_handle_t)s_howdytts_state.http_server_handle, &health_uri);
     
+    httpd_uri_t heap_uri = {
+        .uri = "/heap",
+        .method = HTTP_GET,
+        .handler = http_heap_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler((httpd_handle_t)s_howdytts_state.http_server_handle, &heap_uri);
+    
+    httpd_uri_t latency_uri = {
+        .uri = "/latency",
+        .method = HTTP_GET,
+        .handler = http_latency_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler((httpd_handle_t)s_howdytts_state.http_server_handle, &latency_uri);
+    
+    httpd_uri_t trace_uri = {
+        .uri = "/trace",
+        .method = HTTP_GET,
+        .handler = http_trace_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler((httpd_handle_t)s_howdytts_state.http_server_handle, &trace_uri);
+    
+    httpd_uri_t tasks_uri = {
+        .uri = "/tasks",
+        .method = HTTP_GET,
+        .handler = http_tasks_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler((httpd_handle_t)s_howdytts_state.http_server_handle, &tasks_uri);
+    
+    httpd_uri_t boot_uri = {
+        .uri = "/boot",
+        .method = HTTP_GET,
+        .handler = http_boot_handler,
+        .user_ctx = NULL
+    };
+    httpd_register_uri_handler((httpd_handle_t)s_howdytts_state.http_server_handle, &boot_uri);
+    
     ESP_LOGI(TAG, "HTTP server started on port %d", HOWDYTTS_HTTP_PORT);
     return ESP_OK;
 }
@@ -385,6 +900,7 @@ static esp_err_t send_discovery_request(void)
     // Try multiple broadcast addresses to work around router restrictions
     // 1. Global broadcast (255.255.255.255)
     broadcast_addr.sin_addr.s_addr = INADDR_BROADCAST;
+    s_howdytts_state.broadcast_sent_us = esp_timer_get_time();
     int sent = sendto(s_howdytts_state.discovery_socket, discovery_msg, strlen(discovery_msg), 0,
                      (struct sockaddr*)&broadcast_addr, sizeof(broadcast_addr));
     if (sent > 0) {
@@ -411,18 +927,234 @@ static esp_err_t send_discovery_request(void)
         }
     }
     
-    // Future: Could add direct unicast to known server IPs if needed
+    // 3. Unicast to cached and mDNS-resolved servers; these usually answer first
+    for (size_t i = 0; i < s_howdytts_state.probe_count; i++) {
+        discovery_probe_t *probe = &s_howdytts_state.probes[i];
+        broadcast_addr.sin_addr.s_addr = probe->ip;
+        probe->sent_us = esp_timer_get_time();
+        sendto(s_howdytts_state.discovery_socket, discovery_msg, strlen(discovery_msg), 0,
+               (struct sockaddr*)&broadcast_addr, sizeof(broadcast_addr));
+    }
+    if (s_howdytts_state.probe_count) {
+        ESP_LOGI(TAG, "Sent discovery request to %d known servers", (int)s_howdytts_state.probe_count);
+    }
+    
     return ESP_OK;
 }
 
-static esp_err_t handle_discovery_response(const char *response, const char *from_ip)
+// Add a unicast target; a server already probed keeps its original source
+static void add_discovery_probe(uint32_t ip, howdytts_discovery_source_t source, bool send_now)
+{
+    discovery_probe_t *probe = NULL;
+    for (size_t i = 0; i < s_howdytts_state.probe_count; i++) {
+        if (s_howdytts_state.probes[i].ip == ip) {
+            probe = &s_howdytts_state.probes[i];
+            break;
+        }
+    }
+    if (!probe) {
+        if (s_howdytts_state.probe_count >= DISCOVERY_MAX_PROBES) {
+            return;
+        }
+        probe = &s_howdytts_state.probes[s_howdytts_state.probe_count++];
+        probe->ip = ip;
+        probe->source = source;
+    } else if (!send_now) {
+        return;
+    }
+    
+    if (send_now && s_howdytts_state.discovery_socket >= 0) {
+        struct sockaddr_in addr = {
+            .sin_family = AF_INET,
+            .sin_port = htons(HOWDYTTS_DISCOVERY_PORT),
+            .sin_addr.s_addr = ip,
+        };
+        probe->sent_us = esp_timer_get_time();
+        sendto(s_howdytts_state.discovery_socket, HOWDYTTS_DISCOVERY_REQUEST, strlen(HOWDYTTS_DISCOVERY_REQUEST), 0,
+               (struct sockaddr*)&addr, sizeof(addr));
+    }
+}
+
+// Which probe a response answers, and its round trip
+static howdytts_discovery_source_t match_discovery_probe(uint32_t ip, int64_t now_us, float *rtt_ms)
+{
+    for (size_t i = 0; i < s_howdytts_state.probe_count; i++) {
+        const discovery_probe_t *probe = &s_howdytts_state.probes[i];
+        if (probe->ip == ip && probe->sent_us) {
+            *rtt_ms = (now_us - probe->sent_us) / 1000.0f;
+            return probe->source;
+        }
+    }
+    *rtt_ms = (now_us - s_howdytts_state.broadcast_sent_us) / 1000.0f;
+    return HOWDYTTS_DISCOVERY_SOURCE_BROADCAST;
+}
+
+static void server_cache_load(void)
+{
+    server_cache_t loaded = { .version = SERVER_CACHE_VERSION };
+    
+    nvs_handle_t nvs;
+    if (nvs_open(SERVER_CACHE_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        server_cache_t stored;
+        size_t len = sizeof(stored);
+        if (nvs_get_blob(nvs, SERVER_CACHE_KEY, &stored, &len) == ESP_OK && len == sizeof(stored) &&
+            stored.version == SERVER_CACHE_VERSION && stored.count <= HOWDYTTS_SERVER_CACHE_MAX) {
+            loaded = stored;
+        }
+        nvs_close(nvs);
+    }
+    
+    portENTER_CRITICAL(&s_discovery_lock);
+    s_howdytts_state.server_cache = loaded;
+    portEXIT_CRITICAL(&s_discovery_lock);
+    s_howdytts_state.server_cache_dirty = false;
+}
+
+// Only called for answered runs, so an outage doesn't age servers out
+static void server_cache_save(void)
+{
+    server_cache_t *cache = &s_howdytts_state.server_cache;
+    
+    // Drop servers nobody has heard from in a while
+    portENTER_CRITICAL(&s_discovery_lock);
+    size_t kept = 0;
+    for (size_t i = 0; i < cache->count; i++) {
+        if (cache->run - cache->entries[i].last_seen_run < HOWDYTTS_SERVER_CACHE_MAX_AGE) {
+            cache->entries[kept++] = cache->entries[i];
+        }
+    }
+    cache->count = kept;
+    portEXIT_CRITICAL(&s_discovery_lock);
+    
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(SERVER_CACHE_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret == ESP_OK) {
+        ret = nvs_set_blob(nvs, SERVER_CACHE_KEY, cache, sizeof(*cache));
+        if (ret == ESP_OK) {
+            ret = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to save server cache: %s", esp_err_to_name(ret));
+    }
+    s_howdytts_state.server_cache_dirty = false;
+}
+
+static void server_cache_note(uint32_t ip, const char *hostname, float rtt_ms)
+{
+    server_cache_t *cache = &s_howdytts_state.server_cache;
+    server_cache_entry_t *entry = NULL;
+    portENTER_CRITICAL(&s_discovery_lock);
+    for (size_t i = 0; i < cache->count; i++) {
+        if (cache->entries[i].ip == ip) {
+            entry = &cache->entries[i];
+            break;
+        }
+    }
+    if (!entry) {
+        if (cache->count < HOWDYTTS_SERVER_CACHE_MAX) {
+            entry = &cache->entries[cache->count++];
+        } else {
+            // Full: replace the one heard from longest ago
+            entry = &cache->entries[0];
+            for (size_t i = 1; i < cache->count; i++) {
+                if (cache->entries[i].last_seen_run < entry->last_seen_run) {
+                    entry = &cache->entries[i];
+                }
+            }
+        }
+        memset(entry, 0, sizeof(*entry));
+        entry->ip = ip;
+    }
+    strncpy(entry->hostname, hostname, sizeof(entry->hostname) - 1);
+    entry->rtt_ms = rtt_ms > UINT16_MAX ? UINT16_MAX : (uint16_t)rtt_ms;
+    entry->last_seen_run = cache->run;
+    portEXIT_CRITICAL(&s_discovery_lock);
+    s_howdytts_state.server_cache_dirty = true;
+}
+
+static void record_first_response(howdytts_discovery_source_t source, int64_t now_us)
+{
+    uint32_t ms = (uint32_t)((now_us - s_howdytts_state.discovery_start_us) / 1000);
+    howdytts_discovery_stats_t *st = &s_howdytts_state.discovery_stats;
+    
+    portENTER_CRITICAL(&s_discovery_lock);
+    st->runs_answered++;
+    st->last_first_response_ms = ms;
+    st->last_source = source;
+    if (st->runs_answered == 1 || ms < st->best_first_response_ms) {
+        st->best_first_response_ms = ms;
+    }
+    if (ms > st->worst_first_response_ms) {
+        st->worst_first_response_ms = ms;
+    }
+    switch (source) {
+        case HOWDYTTS_DISCOVERY_SOURCE_CACHE: st->cache_hits++; break;
+        case HOWDYTTS_DISCOVERY_SOURCE_MDNS: st->mdns_hits++; break;
+        default: st->broadcast_hits++; break;
+    }
+    portEXIT_CRITICAL(&s_discovery_lock);
+    
+    ESP_LOGI(TAG, "First server answered %lu ms into discovery (%s)",
+             (unsigned long)ms, howdytts_discovery_source_name(source));
+}
+
+#ifdef CONFIG_MDNS_ENABLED
+// Probe every IPv4 address a finished _howdytts._tcp query returned;
+// false while the query is still running
+static bool probe_mdns_results(mdns_search_once_t *search)
+{
+    mdns_result_t *results = NULL;
+    uint8_t num_results = 0;
+    if (!mdns_query_async_get_results(search, 0, &results, &num_results)) {
+        return false;
+    }
+    for (mdns_result_t *r = results; r; r = r->next) {
+        for (mdns_ip_addr_t *a = r->addr; a; a = a->next) {
+            if (a->addr.type == ESP_IPADDR_TYPE_V4) {
+                ESP_LOGI(TAG, "mDNS found %s at " IPSTR, r->hostname ? r->hostname : "server",
+                         IP2STR(&a->addr.u_addr.ip4));
+                add_discovery_probe(a->addr.u_addr.ip4.addr, HOWDYTTS_DISCOVERY_SOURCE_MDNS, true);
+            }
+        }
+    }
+    mdns_query_results_free(results);
+    return true;
+}
+#endif
+
+// Hostname and optional load from "HOWDYTTS_SERVER_<name>[;load=<0-100>]"
+static void parse_server_reply(const char *response, const char *from_ip,
+                               char *hostname, size_t hostname_size, int8_t *load)
+{
+    const char *hostname_start = strchr(response, '_');
+    size_t hostname_len = hostname_start ? strcspn(hostname_start + 1, ";") : 0;
+    if (hostname_len > 0) {
+        if (hostname_len > hostname_size - 1) {
+            hostname_len = hostname_size - 1;
+        }
+        memcpy(hostname, hostname_start + 1, hostname_len);
+        hostname[hostname_len] = '\0';
+    } else {
+        snprintf(hostname, hostname_size, "howdytts-%s", from_ip);
+    }
+    
+    if (load) {
+        const char *load_str = strstr(response, ";load=");
+        int value = load_str ? atoi(load_str + 6) : -1;
+        *load = load_str ? (int8_t)(value < 0 ? 0 : value > 100 ? 100 : value) : -1;
+    }
+}
+
+static esp_err_t handle_discovery_response(const char *response, const char *from_ip, float rtt_ms)
 {
     ESP_LOGI(TAG, "🔍 Processing discovery response: '%s' from %s", response, from_ip);
     
     // Check if this is a HowdyTTS server response
     if (strncmp(response, "HOWDYTTS_SERVER", 15) != 0) {
         ESP_LOGW(TAG, "Not a HowdyTTS server response, ignoring: %s", response);
-        return ESP_OK; // Not a HowdyTTS server, ignore
+        return ESP_ERR_INVALID_RESPONSE; // Not a HowdyTTS server, ignore
     }
     
     ESP_LOGI(TAG, "✅ Discovered HowdyTTS server at %s: %s", from_ip, response);
@@ -444,19 +1176,14 @@ static esp_err_t handle_discovery_response(const char *response, const char *fro
     server_info.http_port = HOWDYTTS_HTTP_PORT;
     server_info.is_available = true;
     server_info.last_seen = esp_timer_get_time() / 1000;
+    server_info.latency_ms = rtt_ms;
     
     // Extract hostname from response if available
-    char *hostname_start = strchr(response, '_');
-    if (hostname_start && hostname_start[1]) {
-        size_t hostname_len = strlen(hostname_start + 1);
-        size_t max_hostname_len = sizeof(server_info.hostname) - 1;
-        if (hostname_len > max_hostname_len) {
-            hostname_len = max_hostname_len;
-        }
-        memcpy(server_info.hostname, hostname_start + 1, hostname_len);
-        server_info.hostname[hostname_len] = '\0';
-    } else {
-        snprintf(server_info.hostname, sizeof(server_info.hostname), "howdytts-%s", from_ip);
+    parse_server_reply(response, from_ip, server_info.hostname, sizeof(server_info.hostname), NULL);
+    
+    struct in_addr addr;
+    if (inet_aton(from_ip, &addr)) {
+        server_cache_note(addr.s_addr, server_info.hostname, rtt_ms);
     }
     
     // Add to discovered servers list
@@ -541,14 +1268,37 @@ static void discovery_task(void *pvParameters)
     
     ESP_LOGI(TAG, "Discovery socket bound and ready for responses");
     
-    // Set receive timeout
-    struct timeval timeout = {.tv_sec = 1, .tv_usec = 0};
+    // Short receive timeout so mDNS answers and probe rounds aren't held up
+    struct timeval timeout = {.tv_sec = 0, .tv_usec = 100000};
     setsockopt(s_howdytts_state.discovery_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
     
     set_connection_state(HOWDYTTS_STATE_DISCOVERING);
     
+    // Cached servers, mDNS and broadcast all run at once; whichever server
+    // answers first is reported first
+    server_cache_load();
+    s_howdytts_state.server_cache.run++;
+    s_howdytts_state.probe_count = 0;
+    s_howdytts_state.discovery_answered = false;
+    s_howdytts_state.discovery_start_us = esp_timer_get_time();
+    for (size_t i = 0; i < s_howdytts_state.server_cache.count; i++) {
+        add_discovery_probe(s_howdytts_state.server_cache.entries[i].ip, HOWDYTTS_DISCOVERY_SOURCE_CACHE, false);
+    }
+    portENTER_CRITICAL(&s_discovery_lock);
+    s_howdytts_state.discovery_stats.runs++;
+    s_howdytts_state.discovery_stats.cached_servers = s_howdytts_state.server_cache.count;
+    portEXIT_CRITICAL(&s_discovery_lock);
+    ESP_LOGI(TAG, "Probing %d cached servers alongside mDNS and broadcast",
+             (int)s_howdytts_state.server_cache.count);
+    
+#ifdef CONFIG_MDNS_ENABLED
+    // mdns_init() is a no-op when the responder is already running
+    mdns_search_once_t *mdns_search = NULL;
+    bool mdns_ready = mdns_init() == ESP_OK;
+#endif
+    
     uint32_t discovery_start = esp_timer_get_time() / 1000;
-    uint32_t last_broadcast = 0;
+    int64_t next_probe_us = 0;
     
     while (s_howdytts_state.discovery_active && 
            (esp_timer_get_time() / 1000 - discovery_start) < s_howdytts_state.config.discovery_timeout_ms) {
@@ -560,14 +1310,27 @@ static void discovery_task(void *pvParameters)
             break;
         }
         
-        uint32_t now = esp_timer_get_time() / 1000;
+        int64_t now_us = esp_timer_get_time();
         
-        // Send discovery request every 2 seconds
-        if (now - last_broadcast > 2000) {
+        // Send discovery requests every probe interval
+        if (now_us >= next_probe_us) {
             send_discovery_request();
-            last_broadcast = now;
+#ifdef CONFIG_MDNS_ENABLED
+            if (mdns_ready && !mdns_search) {
+                mdns_search = mdns_query_async_new(NULL, "_howdytts", "_tcp", MDNS_TYPE_PTR,
+                                                   DISCOVERY_MDNS_TIMEOUT_MS, 1, NULL);
+            }
+#endif
+            next_probe_us = now_us + DISCOVERY_PROBE_INTERVAL_MS * 1000LL;
         }
         
+#ifdef CONFIG_MDNS_ENABLED
+        if (mdns_search && probe_mdns_results(mdns_search)) {
+            mdns_query_async_delete(mdns_search);
+            mdns_search = NULL;
+        }
+#endif
+        
         // Listen for responses
         char response_buffer[256];
         struct sockaddr_in from_addr;
@@ -585,12 +1348,30 @@ static void discovery_task(void *pvParameters)
             ESP_LOGI(TAG, "📡 Received discovery response from %s:%d - '%s'", 
                      from_ip, ntohs(from_addr.sin_port), response_buffer);
             
-            handle_discovery_response(response_buffer, from_ip);
+            int64_t recv_us = esp_timer_get_time();
+            float rtt_ms;
+            howdytts_discovery_source_t source = match_discovery_probe(from_addr.sin_addr.s_addr, recv_us, &rtt_ms);
+            if (handle_discovery_response(response_buffer, from_ip, rtt_ms) == ESP_OK &&
+                !s_howdytts_state.discovery_answered) {
+                s_howdytts_state.discovery_answered = true;
+                record_first_response(source, recv_us);
+            }
         } else if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
             ESP_LOGW(TAG, "Discovery recvfrom error: %s", strerror(errno));
+            vTaskDelay(pdMS_TO_TICKS(100));
         }
-        
-        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    
+#ifdef CONFIG_MDNS_ENABLED
+    if (mdns_search) {
+        mdns_query_async_delete(mdns_search);
+    }
+#endif
+    if (s_howdytts_state.server_cache_dirty) {
+        server_cache_save();
+        portENTER_CRITICAL(&s_discovery_lock);
+        s_howdytts_state.discovery_stats.cached_servers = s_howdytts_state.server_cache.count;
+        portEXIT_CRITICAL(&s_discovery_lock);
     }
     
     close(s_howdytts_state.discovery_socket);
@@ -604,6 +1385,293 @@ static void discovery_task(void *pvParameters)
 }
 
 // PCM Audio Packet Creation
+// Server health monitor: probes every known server with the discovery
+// request each round and scores it from RTT, loss and reported load
+
+static float server_score(const server_health_t *h)
+{
+    if (h->replies == 0) {
+        return FLT_MAX;
+    }
+    float load = h->load > 0 ? h->load * MONITOR_LOAD_MS_PER_PCT : 0.0f;
+    return h->rtt_ms * (1.0f + MONITOR_LOSS_WEIGHT * h->loss) + load;
+}
+
+static void monitor_commit(size_t i, const server_health_t *h)
+{
+    portENTER_CRITICAL(&s_monitor_lock);
+    s_howdytts_state.health[i] = *h;
+    portEXIT_CRITICAL(&s_monitor_lock);
+}
+
+static int monitor_find(uint32_t ip)
+{
+    for (size_t i = 0; i < s_howdytts_state.health_count; i++) {
+        if (s_howdytts_state.health[i].ip == ip) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void monitor_track(const char *ip_address, const char *hostname)
+{
+    struct in_addr addr;
+    if (!ip_address[0] || !inet_aton(ip_address, &addr) || monitor_find(addr.s_addr) >= 0 ||
+        s_howdytts_state.health_count >= HOWDYTTS_SERVER_CACHE_MAX) {
+        return;
+    }
+    
+    server_health_t h = {
+        .ip = addr.s_addr,
+        .load = -1,
+    };
+    strncpy(h.ip_address, ip_address, sizeof(h.ip_address) - 1);
+    strncpy(h.hostname, hostname, sizeof(h.hostname) - 1);
+    
+    portENTER_CRITICAL(&s_monitor_lock);
+    s_howdytts_state.health[s_howdytts_state.health_count++] = h;
+    portEXIT_CRITICAL(&s_monitor_lock);
+    ESP_LOGI(TAG, "Monitoring server %s (%s)", h.hostname, h.ip_address);
+}
+
+static void monitor_handle_reply(uint32_t ip, const char *reply, int64_t now_us)
+{
+    int i = monitor_find(ip);
+    if (i < 0 || !s_howdytts_state.health[i].awaiting || strncmp(reply, "HOWDYTTS_SERVER", 15) != 0) {
+        return;
+    }
+    
+    server_health_t h = s_howdytts_state.health[i];
+    float rtt_ms = (now_us - h.probe_sent_us) / 1000.0f;
+    h.rtt_ms = h.replies ? h.rtt_ms + MONITOR_EWMA_ALPHA * (rtt_ms - h.rtt_ms) : rtt_ms;
+    h.loss -= MONITOR_EWMA_ALPHA * h.loss;
+    h.replies++;
+    h.awaiting = false;
+    parse_server_reply(reply, h.ip_address, h.hostname, sizeof(h.hostname), &h.load);
+    monitor_commit(i, &h);
+}
+
+static void record_decision(const char *decision, const server_health_t *from, const server_health_t *to,
+                            float from_score, float to_score, int64_t now_us)
+{
+    howdytts_migration_stats_t *st = &s_howdytts_state.migration_stats;
+    portENTER_CRITICAL(&s_monitor_lock);
+    if (strcmp(decision, "migrated") == 0) {
+        st->migrations++;
+    } else {
+        st->deferred++;
+    }
+    strncpy(st->last_decision, decision, sizeof(st->last_decision) - 1);
+    strncpy(st->last_from, from->ip_address, sizeof(st->last_from) - 1);
+    strncpy(st->last_to, to->ip_address, sizeof(st->last_to) - 1);
+    st->last_from_score = from_score;
+    st->last_to_score = to_score;
+    st->last_decision_ms = now_us / 1000;
+    portEXIT_CRITICAL(&s_monitor_lock);
+}
+
+// Point audio at another server without tearing the session down: the UDP
+// streamer and howdytts_stream_audio() both send to connected_server
+static void migrate_to_server(const server_health_t *target, int64_t now_us)
+{
+    if (xSemaphoreTake(s_howdytts_state.state_mutex, pdMS_TO_TICKS(100)) != pdTRUE) {
+        return;
+    }
+    howdytts_server_info_t info = s_howdytts_state.connected_server;  // Keeps the port numbers
+    strncpy(info.ip_address, target->ip_address, sizeof(info.ip_address) - 1);
+    info.ip_address[sizeof(info.ip_address) - 1] = '\0';
+    strncpy(info.hostname, target->hostname, sizeof(info.hostname) - 1);
+    info.hostname[sizeof(info.hostname) - 1] = '\0';
+    info.latency_ms = target->rtt_ms;
+    info.last_seen = now_us / 1000;
+    info.is_available = true;
+    s_howdytts_state.connected_server = info;
+    xSemaphoreGive(s_howdytts_state.state_mutex);
+    
+    if (s_howdytts_state.streaming_active) {
+        udp_audio_set_server(info.ip_address, info.audio_port);
+    }
+    
+    if (s_howdytts_state.callbacks.event_callback) {
+        howdytts_event_data_t event = {
+            .event_type = HOWDYTTS_EVENT_SERVER_MIGRATED,
+            .data.server_info = info,
+            .timestamp = now_us / 1000
+        };
+        snprintf(event.message, sizeof(event.message), "Moved to %s at %s (%.0f ms)",
+                info.hostname, info.ip_address, target->rtt_ms);
+        s_howdytts_state.callbacks.event_callback(&event, s_howdytts_state.callbacks.user_data);
+    }
+}
+
+static void monitor_evaluate(int64_t now_us)
+{
+    howdytts_connection_state_t conn = s_howdytts_state.connection_state;
+    howdytts_server_info_t current;
+    struct in_addr addr;
+    if (!s_howdytts_state.config.enable_server_migration ||
+        (conn != HOWDYTTS_STATE_CONNECTED && conn != HOWDYTTS_STATE_STREAMING) ||
+        !get_connected_server(&current) || !inet_aton(current.ip_address, &addr)) {
+        return;
+    }
+    int cur = monitor_find(addr.s_addr);
+    if (cur < 0 || s_howdytts_state.health[cur].probes_sent < MONITOR_MIN_REPLIES) {
+        return;
+    }
+    
+    float cur_score = server_score(&s_howdytts_state.health[cur]);
+    int best = -1;
+    float best_score = FLT_MAX;
+    for (size_t i = 0; i < s_howdytts_state.health_count; i++) {
+        const server_health_t *h = &s_howdytts_state.health[i];
+        if ((int)i == cur || h->replies < MONITOR_MIN_REPLIES || h->loss > 0.5f) {
+            continue;
+        }
+        float score = server_score(h);
+        if (score < best_score) {
+            best = i;
+            best_score = score;
+        }
+    }
+    
+    // Hysteresis: clearly better, and still best for a few rounds
+    if (best < 0 || best_score > cur_score * MIGRATION_MARGIN || cur_score - best_score < MIGRATION_MIN_GAIN_MS) {
+        s_howdytts_state.migration_candidate = -1;
+        s_howdytts_state.candidate_rounds = 0;
+        s_howdytts_state.candidate_deferred = false;
+        return;
+    }
+    if (best != s_howdytts_state.migration_candidate) {
+        s_howdytts_state.migration_candidate = best;
+        s_howdytts_state.candidate_rounds = 0;
+        s_howdytts_state.candidate_deferred = false;
+    }
+    if (++s_howdytts_state.candidate_rounds < MIGRATION_CONFIRM_ROUNDS) {
+        return;
+    }
+    
+    const server_health_t *from = &s_howdytts_state.health[cur];
+    const server_health_t *to = &s_howdytts_state.health[best];
+    
+    // Never in the middle of a conversation
+    bool busy = s_howdytts_state.va_state != HOWDYTTS_VA_STATE_WAITING ||
+                s_howdytts_state.conversation_active ||
+                now_us - s_howdytts_state.last_activity_us < MIGRATION_IDLE_MS * 1000LL;
+    if (busy) {
+        if (!s_howdytts_state.candidate_deferred) {
+            s_howdytts_state.candidate_deferred = true;
+            record_decision("deferred", from, to, cur_score, best_score, now_us);
+            ESP_LOGI(TAG, "Server %s scores better (%.1f vs %.1f); waiting for the conversation to end",
+                     to->ip_address, best_score, cur_score);
+        }
+        return;
+    }
+    
+    ESP_LOGI(TAG, "Migrating %s -> %s (score %.1f -> %.1f, rtt %.1f -> %.1f ms, loss %.0f%% -> %.0f%%)",
+             from->ip_address, to->ip_address, cur_score, best_score,
+             from->rtt_ms, to->rtt_ms, from->loss * 100, to->loss * 100);
+    record_decision("migrated", from, to, cur_score, best_score, now_us);
+    migrate_to_server(to, now_us);
+    s_howdytts_state.migration_candidate = -1;
+    s_howdytts_state.candidate_rounds = 0;
+    s_howdytts_state.candidate_deferred = false;
+}
+
+static void monitor_round(int sock, int64_t now_us)
+{
+    // Pick up servers discovery or the cache know about
+    if (xSemaphoreTake(s_howdytts_state.state_mutex, pdMS_TO_TICKS(50)) == pdTRUE) {
+        howdytts_server_info_t current = s_howdytts_state.connected_server;
+        size_t count = s_howdytts_state.discovered_server_count;
+        howdytts_server_info_t servers[8];
+        memcpy(servers, s_howdytts_state.discovered_servers, count * sizeof(servers[0]));
+        xSemaphoreGive(s_howdytts_state.state_mutex);
+        
+        monitor_track(current.ip_address, current.hostname);
+        for (size_t i = 0; i < count; i++) {
+            monitor_track(servers[i].ip_address, servers[i].hostname);
+        }
+    }
+    // The cache belongs to discovery_task, which loads and compacts it under the lock
+    server_cache_entry_t cached[HOWDYTTS_SERVER_CACHE_MAX];
+    portENTER_CRITICAL(&s_discovery_lock);
+    size_t cached_count = s_howdytts_state.server_cache.count;
+    memcpy(cached, s_howdytts_state.server_cache.entries, cached_count * sizeof(cached[0]));
+    portEXIT_CRITICAL(&s_discovery_lock);
+    for (size_t i = 0; i < cached_count; i++) {
+        char ip_address[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &cached[i].ip, ip_address, sizeof(ip_address));
+        monitor_track(ip_address, cached[i].hostname);
+    }
+    
+    // Probes of the last round still unanswered count as lost
+    for (size_t i = 0; i < s_howdytts_state.health_count; i++) {
+        server_health_t h = s_howdytts_state.health[i];
+        if (h.awaiting) {
+            h.loss += MONITOR_EWMA_ALPHA * (1.0f - h.loss);
+            h.awaiting = false;
+            monitor_commit(i, &h);
+        }
+    }
+    
+    monitor_evaluate(now_us);
+    
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(HOWDYTTS_DISCOVERY_PORT),
+    };
+    for (size_t i = 0; i < s_howdytts_state.health_count; i++) {
+        server_health_t h = s_howdytts_state.health[i];
+        addr.sin_addr.s_addr = h.ip;
+        h.probe_sent_us = esp_timer_get_time();
+        if (sendto(sock, HOWDYTTS_DISCOVERY_REQUEST, strlen(HOWDYTTS_DISCOVERY_REQUEST), 0,
+                   (struct sockaddr*)&addr, sizeof(addr)) > 0) {
+            h.probes_sent++;
+            h.awaiting = true;
+        }
+        monitor_commit(i, &h);
+    }
+}
+
+static void server_monitor_task(void *pvParameters)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        ESP_LOGE(TAG, "Failed to create server probe socket");
+        s_howdytts_state.monitor_active = false;
+        s_howdytts_state.monitor_task = NULL;
+        vTaskDelete(NULL);
+        return;
+    }
+    struct timeval timeout = {.tv_sec = 0, .tv_usec = 100000};
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    
+    ESP_LOGI(TAG, "Server monitor started (probe every %d ms)", MONITOR_PROBE_INTERVAL_MS);
+    
+    int64_t next_round_us = 0;
+    while (s_howdytts_state.monitor_active) {
+        int64_t now_us = esp_timer_get_time();
+        if (now_us >= next_round_us) {
+            monitor_round(sock, now_us);
+            next_round_us = now_us + MONITOR_PROBE_INTERVAL_MS * 1000LL;
+        }
+        
+        char reply[128];
+        struct sockaddr_in from_addr;
+        socklen_t from_len = sizeof(from_addr);
+        int received = recvfrom(sock, reply, sizeof(reply) - 1, 0, (struct sockaddr*)&from_addr, &from_len);
+        if (received > 0) {
+            reply[received] = '\0';
+            monitor_handle_reply(from_addr.sin_addr.s_addr, reply, esp_timer_get_time());
+        }
+    }
+    
+    close(sock);
+    s_howdytts_state.monitor_task = NULL;
+    vTaskDelete(NULL);
+}
+
 static esp_err_t create_audio_packet(const int16_t *audio_data, size_t samples, 
                                    howdytts_pcm_packet_t **packet, size_t *packet_size)
 {
@@ -616,7 +1684,8 @@ static esp_err_t create_audio_packet(const int16_t *audio_data, size_t samples,
     size_t total_size = sizeof(howdytts_pcm_packet_t) + data_size;
     
     // Allocate packet
-    howdytts_pcm_packet_t *pkt = (howdytts_pcm_packet_t*)malloc(total_size);
+    howdytts_pcm_packet_t *pkt = (howdytts_pcm_packet_t*)HOWDY_MALLOC(HOWDY_HEAP_TAG_NETWORK, total_size,
+                                                                      MALLOC_CAP_DEFAULT);
     if (!pkt) {
         ESP_LOGE(TAG, "Failed to allocate audio packet memory");
         return ESP_ERR_NO_MEM;
@@ -642,23 +1711,28 @@ static void audio_streaming_task(void *pvParameters)
 {
     ESP_LOGI(TAG, "Audio streaming task started - capturing audio from I2S");
     
-    const TickType_t frame_delay = pdMS_TO_TICKS(20); // 20ms frame interval (320 samples at 16kHz)
-    TickType_t last_wake_time = xTaskGetTickCount();
-    
-    // Audio capture buffer - 320 samples for 20ms at 16kHz
-    const size_t samples_per_frame = 320;
-    int16_t audio_buffer[samples_per_frame];
-    size_t bytes_read = 0;
+    // Frames arrive from the mic DMA capture engine (20 ms, 320 samples at 16kHz);
+    // each one wakes this task and is sent straight from DMA memory
+    i2s_dma_capture_handle_t mic = dual_i2s_get_mic_capture();
+    if (mic) {
+        i2s_dma_capture_subscribe(mic, NULL);
+    }
     
     uint32_t packets_sent = 0;
     uint32_t capture_errors = 0;
     uint32_t send_errors = 0;
     
-    ESP_LOGI(TAG, "Audio streaming: %zu samples per frame, %dms intervals", 
-             samples_per_frame, 20);
+    ESP_LOGI(TAG, "Audio streaming: event-driven DMA frames (%s)", mic ? "ready" : "no capture source");
+    s_howdytts_state.streaming_sched = howdy_sched_register("audio_stream", 20000);
     
     while (s_howdytts_state.streaming_active) {
-        vTaskDelayUntil(&last_wake_time, frame_delay);
+        i2s_dma_frame_t frame;
+        esp_err_t capture_ret = ESP_ERR_INVALID_STATE;
+        if (mic) {
+            capture_ret = i2s_dma_capture_acquire(mic, &frame, 100);
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(20));
+        }
         
         // Check if we're still connected
         if (s_howdytts_state.connection_state != HOWDYTTS_STATE_STREAMING &&
@@ -667,14 +1741,21 @@ static void audio_streaming_task(void *pvParameters)
             break;
         }
         
-        // Capture audio from I2S microphone using Dual I2S Manager
-        esp_err_t capture_ret = dual_i2s_read_mic(audio_buffer, samples_per_frame, &bytes_read, 10);
-        
-        if (capture_ret == ESP_OK && bytes_read > 0) {
-            size_t samples_read = bytes_read / sizeof(int16_t);
-            
-            // Send ESP32-P4 basic UDP packet to server via UDP streamer
-            esp_err_t send_ret = udp_audio_send(audio_buffer, samples_read);
+        if (capture_ret == ESP_OK && frame.sample_count > 0) {
+            howdy_sched_wake(s_howdytts_state.streaming_sched);
+            // Stamped before the callback so the pipeline can read it back with howdy_lat_last()
+            howdy_lat_mark_at(HOWDY_LAT_I2S_DMA, frame.timestamp_us);
+            esp_err_t send_ret;
+            if (s_howdytts_state.callbacks.audio_callback) {
+                // The application's pipeline takes the frame and owns the uplink
+                send_ret = s_howdytts_state.callbacks.audio_callback(frame.samples, frame.sample_count,
+                                                                     s_howdytts_state.callbacks.user_data);
+            } else {
+                // Send ESP32-P4 basic UDP packet to server via UDP streamer
+                send_ret = udp_audio_send(frame.samples, frame.sample_count);
+            }
+            i2s_dma_capture_release(mic, &frame);
+            howdy_sched_done(s_howdytts_state.streaming_sched);
             
             if (send_ret == ESP_OK) {
                 packets_sent++;
@@ -693,13 +1774,14 @@ static void audio_streaming_task(void *pvParameters)
         } else {
             capture_errors++;
             if (capture_errors % 50 == 0) { // Log every 50 capture errors
-                ESP_LOGW(TAG, "❌ Audio capture error #%lu: %s (bytes: %zu)", 
-                         capture_errors, esp_err_to_name(capture_ret), bytes_read);
+                ESP_LOGW(TAG, "❌ Audio capture error #%lu: %s", 
+                         capture_errors, esp_err_to_name(capture_ret));
             }
         }
     }
     
     ESP_LOGI(TAG, "Audio streaming task ended");
+    howdy_sched_unregister(s_howdytts_state.streaming_sched);
     s_howdytts_state.streaming_active = false;
     s_howdytts_state.audio_streaming_task = NULL;
     
@@ -740,6 +1822,7 @@ esp_err_t howdytts_integration_init(const howdytts_integration_config_t *config,
     s_howdytts_state.current_protocol = config->protocol_mode;
     s_howdytts_state.discovery_socket = -1;
     s_howdytts_state.audio_socket = -1;
+    s_howdytts_state.migration_candidate = -1;
     
     // Create mutex
     s_howdytts_state.state_mutex = xSemaphoreCreateMutex();
@@ -864,6 +1947,80 @@ esp_err_t howdytts_get_discovered_servers(howdytts_server_info_t *servers,
     return ESP_ERR_TIMEOUT;
 }
 
+esp_err_t howdytts_get_discovery_stats(howdytts_discovery_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_discovery_lock);
+    *stats = s_howdytts_state.discovery_stats;
+    portEXIT_CRITICAL(&s_discovery_lock);
+    return ESP_OK;
+}
+
+const char *howdytts_discovery_source_name(howdytts_discovery_source_t source)
+{
+    switch (source) {
+        case HOWDYTTS_DISCOVERY_SOURCE_CACHE:     return "cache";
+        case HOWDYTTS_DISCOVERY_SOURCE_MDNS:      return "mdns";
+        case HOWDYTTS_DISCOVERY_SOURCE_BROADCAST: return "broadcast";
+        default: return "none";
+    }
+}
+
+esp_err_t howdytts_get_server_metrics(howdytts_server_metrics_t *metrics,
+                                     size_t max_servers,
+                                     size_t *server_count)
+{
+    if (!metrics || !server_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    server_health_t health[HOWDYTTS_SERVER_CACHE_MAX];
+    portENTER_CRITICAL(&s_monitor_lock);
+    size_t count = MIN(s_howdytts_state.health_count, max_servers);
+    memcpy(health, s_howdytts_state.health, count * sizeof(health[0]));
+    portEXIT_CRITICAL(&s_monitor_lock);
+    
+    howdytts_server_info_t current = {0};
+    get_connected_server(&current);
+    
+    for (size_t i = 0; i < count; i++) {
+        howdytts_server_metrics_t *m = &metrics[i];
+        memset(m, 0, sizeof(*m));
+        strncpy(m->hostname, health[i].hostname, sizeof(m->hostname) - 1);
+        strncpy(m->ip_address, health[i].ip_address, sizeof(m->ip_address) - 1);
+        m->rtt_ms = health[i].rtt_ms;
+        m->loss = health[i].loss;
+        m->load = health[i].load;
+        m->score = health[i].replies ? server_score(&health[i]) : -1.0f;
+        m->probes_sent = health[i].probes_sent;
+        m->replies = health[i].replies;
+        m->current = strcmp(health[i].ip_address, current.ip_address) == 0;
+    }
+    *server_count = count;
+    return ESP_OK;
+}
+
+esp_err_t howdytts_get_migration_stats(howdytts_migration_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    portENTER_CRITICAL(&s_monitor_lock);
+    *stats = s_howdytts_state.migration_stats;
+    portEXIT_CRITICAL(&s_monitor_lock);
+    return ESP_OK;
+}
+
+void howdytts_set_conversation_active(bool active)
+{
+    if (s_howdytts_state.conversation_active != active) {
+        s_howdytts_state.conversation_active = active;
+        s_howdytts_state.last_activity_us = esp_timer_get_time();
+    }
+}
+
 esp_err_t howdytts_integration_deinit(void)
 {
     if (!s_howdytts_state.initialized) {
@@ -881,6 +2038,12 @@ esp_err_t howdytts_integration_deinit(void)
     // Stop discovery
     howdytts_discovery_stop();
     
+    // Stop the server monitor; it exits within one receive timeout
+    s_howdytts_state.monitor_active = false;
+    for (int i = 0; i < 10 && s_howdytts_state.monitor_task; i++) {
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+    
     // Stop HTTP server
     stop_http_server();
     
@@ -922,7 +2085,7 @@ esp_err_t howdytts_connect_to_server(const howdytts_server_info_t *server_info)
     setsockopt(s_howdytts_state.audio_socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
     
     // Store connected server info
-    s_howdytts_state.connected_server = *server_info;
+    set_connected_server(server_info);
     
     // Reset sequence number and statistics
     s_howdytts_state.sequence_number = 0;
@@ -931,6 +2094,18 @@ esp_err_t howdytts_connect_to_server(const howdytts_server_info_t *server_info)
     
     set_connection_state(HOWDYTTS_STATE_CONNECTED);
     
+    // Keep probing every known server for the rest of the session; the
+    // stack matches discovery_task since both run the app event callback
+    if (!s_howdytts_state.monitor_task) {
+        s_howdytts_state.monitor_active = true;
+        if (xTaskCreate(server_monitor_task, "howdytts_probe", 8192, NULL, 4,
+                        &s_howdytts_state.monitor_task) != pdPASS) {
+            ESP_LOGW(TAG, "Failed to start server monitor");
+            s_howdytts_state.monitor_active = false;
+            s_howdytts_state.monitor_task = NULL;
+        }
+    }
+    
     ESP_LOGI(TAG, "✅ Connected to HowdyTTS server successfully");
     return ESP_OK;
 }
@@ -955,7 +2130,7 @@ esp_err_t howdytts_disconnect(void)
     }
     
     // Clear server information
-    memset(&s_howdytts_state.connected_server, 0, sizeof(s_howdytts_state.connected_server));
+    set_connected_server(NULL);
     
     set_connection_state(HOWDYTTS_STATE_DISCONNECTED);
     
@@ -975,6 +2150,20 @@ esp_err_t howdytts_stream_audio(const int16_t *audio_data, size_t samples)
         return ESP_ERR_INVALID_STATE;
     }
     
+    // One uplink format per session: while the UDP streamer runs it does the
+    // framing (RTP or its own header), so legacy packets never go alongside
+    if (udp_audio_is_streaming()) {
+        esp_err_t ret = udp_audio_send(audio_data, samples);
+        if (ret == ESP_OK && s_howdytts_state.connection_state == HOWDYTTS_STATE_CONNECTED) {
+            set_connection_state(HOWDYTTS_STATE_STREAMING);
+        }
+        return ret;
+    }
+    if (s_howdytts_state.config.enable_rtp) {
+        ESP_LOGW(TAG, "Cannot stream audio - RTP mode needs the UDP streamer running");
+        return ESP_ERR_INVALID_STATE;
+    }
+    
     if (s_howdytts_state.audio_socket < 0) {
         ESP_LOGE(TAG, "Audio socket not available");
         return ESP_ERR_INVALID_STATE;
@@ -988,17 +2177,22 @@ esp_err_t howdytts_stream_audio(const int16_t *audio_data, size_t samples)
         return ret;
     }
     
-    // Send packet to server
+    // Send packet to server; migration may repoint it at any time
+    howdytts_server_info_t server;
+    if (!get_connected_server(&server)) {
+        HOWDY_FREE(packet);
+        return ESP_ERR_TIMEOUT;
+    }
     struct sockaddr_in server_addr;
     memset(&server_addr, 0, sizeof(server_addr));
     server_addr.sin_family = AF_INET;
-    server_addr.sin_port = htons(s_howdytts_state.connected_server.audio_port);
-    inet_pton(AF_INET, s_howdytts_state.connected_server.ip_address, &server_addr.sin_addr);
+    server_addr.sin_port = htons(server.audio_port);
+    inet_pton(AF_INET, server.ip_address, &server_addr.sin_addr);
     
     int sent = sendto(s_howdytts_state.audio_socket, packet, packet_size, 0,
                      (struct sockaddr*)&server_addr, sizeof(server_addr));
     
-    free(packet);
+    HOWDY_FREE(packet);
     
     if (sent < 0) {
         ESP_LOGE(TAG, "Failed to send audio packet: errno %d", errno);
@@ -1006,6 +2200,8 @@ esp_err_t howdytts_stream_audio(const int16_t *audio_data, size_t samples)
         return ESP_FAIL;
     }
     
+    howdy_lat_mark(HOWDY_LAT_UPLINK);
+    
     // Update statistics
     s_howdytts_state.audio_stats.packets_sent++;
     s_howdytts_state.audio_stats.bytes_sent += sent;
@@ -1044,16 +2240,22 @@ esp_err_t howdytts_start_audio_streaming(void)
     
     ESP_LOGI(TAG, "🎵 Starting HowdyTTS audio streaming");
     
+    howdytts_server_info_t server;
+    if (!get_connected_server(&server)) {
+        return ESP_ERR_TIMEOUT;
+    }
+    
     s_howdytts_state.streaming_active = true;
 
     // Initialize and start UDP audio streamer with discovered server
     udp_audio_config_t udp_cfg = {
-        .server_ip = s_howdytts_state.connected_server.ip_address,
-        .server_port = s_howdytts_state.connected_server.audio_port,
+        .server_ip = server.ip_address,
+        .server_port = server.audio_port,
         .local_port = 0,
         .buffer_size = 2048,
         .packet_size_ms = 20,
-        .enable_compression = false
+        .enable_compression = false,
+        .enable_rtp = s_howdytts_state.config.enable_rtp
     };
     (void)udp_audio_deinit();
     if (udp_audio_init(&udp_cfg) == ESP_OK) {
@@ -1079,7 +2281,7 @@ esp_err_t howdytts_start_audio_streaming(void)
             .timestamp = esp_timer_get_time() / 1000
         };
         snprintf(event.message, sizeof(event.message), "Audio streaming started to %s", 
-                s_howdytts_state.connected_server.hostname);
+                server.hostname);
         s_howdytts_state.callbacks.event_callback(&event, s_howdytts_state.callbacks.user_data);
     }
     
@@ -1112,6 +2314,7 @@ esp_err_t howdytts_stop_audio_streaming(void)
         
         // Force delete if task didn't exit cleanly
         if (s_howdytts_state.audio_streaming_task) {
+            howdy_sched_unregister(s_howdytts_state.streaming_sched);
             vTaskDelete(s_howdytts_state.audio_streaming_task);
             s_howdytts_state.audio_streaming_task = NULL;
         }
@@ -1,7 +1,9 @@
 #include "howdytts_protocol.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
 #include "esp_timer.h"
 #include "cJSON.h"
+#include "howdy_heap_tags.h"
 #include "mbedtls/base64.h"
 #include <string.h>
 #include <stdio.h>
@@ -103,14 +105,14 @@ esp_err_t howdytts_create_session_start_message(char *message_buffer, size_t buf
     size_t json_len = strlen(json_string);
     if (json_len >= buffer_size) {
         ESP_LOGE(TAG, "Message buffer too small: need %zu, have %zu", json_len, buffer_size);
-        free(json_string);
+        cJSON_free(json_string);
         cJSON_Delete(root);
         return ESP_ERR_INVALID_SIZE;
     }
 
     strcpy(message_buffer, json_string);
     
-    free(json_string);
+    cJSON_free(json_string);
     cJSON_Delete(root);
     
     s_protocol.messages_sent++;
@@ -140,7 +142,7 @@ esp_err_t howdytts_create_audio_message(const int16_t *audio_data, size_t sample
     // Get required buffer size
     mbedtls_base64_encode(NULL, 0, &encoded_len, (const unsigned char*)audio_data, audio_bytes);
     
-    char *encoded_audio = malloc(encoded_len + 1);
+    char *encoded_audio = HOWDY_MALLOC(HOWDY_HEAP_TAG_NETWORK, encoded_len + 1, MALLOC_CAP_DEFAULT);
     if (!encoded_audio) {
         ESP_LOGE(TAG, "Failed to allocate base64 buffer");
         cJSON_Delete(root);
@@ -153,7 +155,7 @@ esp_err_t howdytts_create_audio_message(const int16_t *audio_data, size_t sample
                                    (const unsigned char*)audio_data, audio_bytes);
     if (ret != 0) {
         ESP_LOGE(TAG, "Base64 encoding failed: %d", ret);
-        free(encoded_audio);
+        HOWDY_FREE(encoded_audio);
         cJSON_Delete(root);
         return ESP_FAIL;
     }
@@ -174,7 +176,7 @@ esp_err_t howdytts_create_audio_message(const int16_t *audio_data, size_t sample
     if (!event || !session_id || !timestamp || !sequence || !media || 
         !track || !payload || !sample_count || !sample_rate) {
         ESP_LOGE(TAG, "Failed to create JSON elements");
-        free(encoded_audio);
+        HOWDY_FREE(encoded_audio);
         cJSON_Delete(root);
         return ESP_ERR_NO_MEM;
     }
@@ -195,7 +197,7 @@ esp_err_t howdytts_create_audio_message(const int16_t *audio_data, size_t sample
     char *json_string = cJSON_Print(root);
     if (!json_string) {
         ESP_LOGE(TAG, "Failed to generate JSON string");
-        free(encoded_audio);
+        HOWDY_FREE(encoded_audio);
         cJSON_Delete(root);
         return ESP_ERR_NO_MEM;
     }
@@ -203,16 +205,16 @@ esp_err_t howdytts_create_audio_message(const int16_t *audio_data, size_t sample
     size_t json_len = strlen(json_string);
     if (json_len >= buffer_size) {
         ESP_LOGE(TAG, "Message buffer too small: need %zu, have %zu", json_len, buffer_size);
-        free(json_string);
-        free(encoded_audio);
+        cJSON_free(json_string);
+        HOWDY_FREE(encoded_audio);
         cJSON_Delete(root);
         return ESP_ERR_INVALID_SIZE;
     }
 
     strcpy(message_buffer, json_string);
     
-    free(json_string);
-    free(encoded_audio);
+    cJSON_free(json_string);
+    HOWDY_FREE(encoded_audio);
     cJSON_Delete(root);
     
     s_protocol.messages_sent++;
@@ -264,14 +266,14 @@ esp_err_t howdytts_create_voice_message(bool voice_detected, float confidence,
     size_t json_len = strlen(json_string);
     if (json_len >= buffer_size) {
         ESP_LOGE(TAG, "Message buffer too small: need %zu, have %zu", json_len, buffer_size);
-        free(json_string);
+        cJSON_free(json_string);
         cJSON_Delete(root);
         return ESP_ERR_INVALID_SIZE;
     }
 
     strcpy(message_buffer, json_string);
     
-    free(json_string);
+    cJSON_free(json_string);
     cJSON_Delete(root);
     
     s_protocol.messages_sent++;
@@ -317,14 +319,14 @@ esp_err_t howdytts_create_ping_message(char *message_buffer, size_t buffer_size)
     size_t json_len = strlen(json_string);
     if (json_len >= buffer_size) {
         ESP_LOGE(TAG, "Message buffer too small: need %zu, have %zu", json_len, buffer_size);
-        free(json_string);
+        cJSON_free(json_string);
         cJSON_Delete(root);
         return ESP_ERR_INVALID_SIZE;
     }
 
     strcpy(message_buffer, json_string);
     
-    free(json_string);
+    cJSON_free(json_string);
     cJSON_Delete(root);
     
     s_protocol.messages_sent++;
@@ -426,7 +428,7 @@ esp_err_t howdytts_batch_audio_frames(const int16_t **audio_frames, const size_t
     }
 
     // Concatenate audio frames
-    int16_t *batched_audio = malloc(total_samples * sizeof(int16_t));
+    int16_t *batched_audio = HOWDY_MALLOC(HOWDY_HEAP_TAG_NETWORK, total_samples * sizeof(int16_t), MALLOC_CAP_DEFAULT);
     if (!batched_audio) {
         ESP_LOGE(TAG, "Failed to allocate batched audio buffer");
         return ESP_ERR_NO_MEM;
@@ -442,7 +444,7 @@ esp_err_t howdytts_batch_audio_frames(const int16_t **audio_frames, const size_t
     esp_err_t ret = howdytts_create_audio_message(batched_audio, total_samples, 
                                                  message_buffer, buffer_size);
     
-    free(batched_audio);
+    HOWDY_FREE(batched_audio);
     
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "Batched %zu frames into single message (%zu samples)", num_frames, total_samples);
@@ -24,6 +24,26 @@ typedef enum {
     WIFI_EVENT_GOT_IP_ID,
 } wifi_event_id_t;
 
+// How the last connection was made
+typedef enum {
+    WIFI_CONNECT_PATH_NONE = 0,
+    WIFI_CONNECT_PATH_FAST,         // Directed to the cached BSSID and channel
+    WIFI_CONNECT_PATH_FULL,         // Scan of all channels
+} wifi_connect_path_t;
+
+// Connection timing; a connect runs from wifi_manager_connect() or a link
+// drop until the station has an address
+typedef struct {
+    wifi_connect_path_t last_path;
+    uint32_t last_connect_ms;
+    uint32_t fast_connects;
+    uint32_t full_connects;
+    uint32_t fast_failures;         // Cached AP unreachable, fell back to a scan
+    uint32_t fast_ms_max;
+    uint32_t full_ms_max;
+    bool lease_reused;              // DHCP handed back the cached address
+} wifi_manager_stats_t;
+
 // WiFi callback function
 typedef void (*wifi_event_callback_t)(wifi_event_id_t event_id, void *event_data);
 
@@ -95,6 +115,26 @@ bool wifi_manager_is_connected(void);
  */
 esp_err_t wifi_manager_start_scan(void);
 
+/**
+ * @brief Get connection timing and which path was taken
+ * 
+ * @param stats Output statistics
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t wifi_manager_get_stats(wifi_manager_stats_t *stats);
+
+/**
+ * @brief Short label for a connect path, e.g. "cached AP"
+ */
+const char *wifi_manager_path_name(wifi_connect_path_t path);
+
+/**
+ * @brief Forget the cached AP so the next connect scans all channels
+ * 
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t wifi_manager_forget_ap_cache(void);
+
 /**
  * @brief Auto-connect using stored credentials
  * 
@@ -4,7 +4,9 @@
 #include "esp_event.h"
 #include "esp_netif.h"
 #include "esp_mac.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
+#include "nvs.h"
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -52,6 +54,19 @@ static EventGroupHandle_t s_wifi_event_group = NULL;
 #define WIFI_CONNECTED_BIT BIT0
 #define WIFI_FAIL_BIT      BIT1
 
+// Last AP we got an address from, for a directed reconnect
+#define AP_CACHE_NAMESPACE  "wifi_mgr"
+#define AP_CACHE_KEY        "ap_cache"
+#define AP_CACHE_VERSION    1
+
+typedef struct {
+    uint8_t version;
+    uint8_t channel;
+    uint8_t bssid[6];
+    char ssid[33];
+    uint32_t ip;                    // Last lease, to tell whether DHCP gave it back
+} wifi_ap_cache_t;
+
 // WiFi manager state
 static struct {
     wifi_state_t state;
@@ -60,6 +75,15 @@ static struct {
     int max_retry;
     bool initialized;
     esp_netif_t *netif;
+    
+    // Fast reconnect
+    char ssid[33];
+    char password[65];
+    wifi_ap_cache_t ap_cache;
+    bool ap_cache_valid;
+    bool directed;                  // Current attempt is the cached BSSID/channel
+    int64_t connect_start_us;       // connect() or link drop; 0 once we have an address
+    wifi_manager_stats_t stats;
 } s_wifi_manager = {
     .state = WIFI_STATE_DISCONNECTED,
     .event_callback = NULL,
@@ -69,6 +93,84 @@ static struct {
     .netif = NULL
 };
 
+static bool ap_cache_load(const char *ssid)
+{
+    s_wifi_manager.ap_cache_valid = false;
+    nvs_handle_t nvs;
+    if (nvs_open(AP_CACHE_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        return false;
+    }
+    wifi_ap_cache_t cache;
+    size_t len = sizeof(cache);
+    esp_err_t ret = nvs_get_blob(nvs, AP_CACHE_KEY, &cache, &len);
+    nvs_close(nvs);
+    
+    if (ret != ESP_OK || len != sizeof(cache) || cache.version != AP_CACHE_VERSION ||
+        cache.channel == 0 || strncmp(cache.ssid, ssid, sizeof(cache.ssid)) != 0) {
+        return false;
+    }
+    s_wifi_manager.ap_cache = cache;
+    s_wifi_manager.ap_cache_valid = true;
+    return true;
+}
+
+// Remember the AP and lease we just got; only writes flash when they changed
+static void ap_cache_update(uint32_t ip)
+{
+    wifi_ap_record_t ap;
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK) {
+        return;
+    }
+    
+    // Zeroed so padding compares equal below
+    wifi_ap_cache_t cache;
+    memset(&cache, 0, sizeof(cache));
+    cache.version = AP_CACHE_VERSION;
+    cache.channel = ap.primary;
+    cache.ip = ip;
+    memcpy(cache.bssid, ap.bssid, sizeof(cache.bssid));
+    strncpy(cache.ssid, s_wifi_manager.ssid, sizeof(cache.ssid) - 1);
+    if (s_wifi_manager.ap_cache_valid && memcmp(&cache, &s_wifi_manager.ap_cache, sizeof(cache)) == 0) {
+        return;
+    }
+    
+    nvs_handle_t nvs;
+    if (nvs_open(AP_CACHE_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) {
+        return;
+    }
+    if (nvs_set_blob(nvs, AP_CACHE_KEY, &cache, sizeof(cache)) == ESP_OK && nvs_commit(nvs) == ESP_OK) {
+        s_wifi_manager.ap_cache = cache;
+        s_wifi_manager.ap_cache_valid = true;
+        ESP_LOGI(TAG, "Cached AP " MACSTR " on channel %d", MAC2STR(cache.bssid), cache.channel);
+    }
+    nvs_close(nvs);
+}
+
+// Station config for the saved network; directed pins the cached BSSID and
+// channel so the driver probes one channel instead of scanning them all
+static void apply_sta_config(bool directed)
+{
+    wifi_config_t wifi_config = {0};
+    strncpy((char*)wifi_config.sta.ssid, s_wifi_manager.ssid, sizeof(wifi_config.sta.ssid) - 1);
+    strncpy((char*)wifi_config.sta.password, s_wifi_manager.password, sizeof(wifi_config.sta.password) - 1);
+    if (directed) {
+        wifi_config.sta.bssid_set = true;
+        memcpy(wifi_config.sta.bssid, s_wifi_manager.ap_cache.bssid, sizeof(wifi_config.sta.bssid));
+        wifi_config.sta.channel = s_wifi_manager.ap_cache.channel;
+    }
+    s_wifi_manager.directed = directed;
+    esp_wifi_set_config(WIFI_IF_STA, &wifi_config);
+}
+
+static bool fast_reconnect_enabled(void)
+{
+#ifdef CONFIG_HOWDY_WIFI_FAST_RECONNECT
+    return s_wifi_manager.ap_cache_valid;
+#else
+    return false;
+#endif
+}
+
 // Event handler for WiFi and IP events
 static void wifi_event_handler(void* arg, esp_event_base_t event_base,
                               int32_t event_id, void* event_data)
@@ -88,9 +190,23 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
                     reason = disc->reason;
                 }
                 ESP_LOGW(TAG, "Disconnected from AP (reason=%d: %s)", reason, reason_to_str(reason));
+                bool dropped = s_wifi_manager.state == WIFI_STATE_CONNECTED;
                 s_wifi_manager.state = WIFI_STATE_DISCONNECTED;
                 
-                if (s_wifi_manager.retry_count < s_wifi_manager.max_retry) {
+                if (dropped) {
+                    s_wifi_manager.connect_start_us = esp_timer_get_time();
+                }
+                if (dropped && fast_reconnect_enabled()) {
+                    // Most drops are the same AP rebooting or roaming back: try it first
+                    apply_sta_config(true);
+                    esp_wifi_connect();
+                } else if (s_wifi_manager.directed) {
+                    // AP moved or is gone: fall back to a full scan without using up a retry
+                    ESP_LOGI(TAG, "Cached AP not reachable, scanning");
+                    s_wifi_manager.stats.fast_failures++;
+                    apply_sta_config(false);
+                    esp_wifi_connect();
+                } else if (s_wifi_manager.retry_count < s_wifi_manager.max_retry) {
                     esp_wifi_connect();
                     s_wifi_manager.retry_count++;
                     ESP_LOGI(TAG, "Retrying connection... (%d/%d)", 
@@ -125,6 +241,25 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         ESP_LOGI(TAG, "Got IP: " IPSTR, IP2STR(&event->ip_info.ip));
+        
+        wifi_manager_stats_t *st = &s_wifi_manager.stats;
+        if (s_wifi_manager.connect_start_us) {
+            uint32_t ms = (uint32_t)((esp_timer_get_time() - s_wifi_manager.connect_start_us) / 1000);
+            st->last_path = s_wifi_manager.directed ? WIFI_CONNECT_PATH_FAST : WIFI_CONNECT_PATH_FULL;
+            st->last_connect_ms = ms;
+            if (s_wifi_manager.directed) {
+                st->fast_connects++;
+                st->fast_ms_max = ms > st->fast_ms_max ? ms : st->fast_ms_max;
+            } else {
+                st->full_connects++;
+                st->full_ms_max = ms > st->full_ms_max ? ms : st->full_ms_max;
+            }
+            ESP_LOGI(TAG, "Connected in %lu ms (%s)", ms, wifi_manager_path_name(st->last_path));
+            s_wifi_manager.connect_start_us = 0;
+        }
+        st->lease_reused = s_wifi_manager.ap_cache_valid && s_wifi_manager.ap_cache.ip == event->ip_info.ip.addr;
+        ap_cache_update(event->ip_info.ip.addr);
+        
         s_wifi_manager.state = WIFI_STATE_CONNECTED;
         xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
         
@@ -218,14 +353,20 @@ esp_err_t wifi_manager_connect(const char *ssid, const char *password)
     ESP_LOGI(TAG, "Connecting to SSID: %s", ssid);
     
     // Configure WiFi
-    wifi_config_t wifi_config = {0};
-    strncpy((char*)wifi_config.sta.ssid, ssid, sizeof(wifi_config.sta.ssid) - 1);
-    if (password) {
-        strncpy((char*)wifi_config.sta.password, password, sizeof(wifi_config.sta.password) - 1);
+    strncpy(s_wifi_manager.ssid, ssid, sizeof(s_wifi_manager.ssid) - 1);
+    s_wifi_manager.ssid[sizeof(s_wifi_manager.ssid) - 1] = '\0';
+    strncpy(s_wifi_manager.password, password ? password : "", sizeof(s_wifi_manager.password) - 1);
+    s_wifi_manager.password[sizeof(s_wifi_manager.password) - 1] = '\0';
+    ap_cache_load(ssid);
+    bool directed = fast_reconnect_enabled();
+    if (directed) {
+        ESP_LOGI(TAG, "Trying cached AP " MACSTR " on channel %d first",
+                MAC2STR(s_wifi_manager.ap_cache.bssid), s_wifi_manager.ap_cache.channel);
     }
     
     // Set configuration and start WiFi
-    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_config));
+    s_wifi_manager.connect_start_us = esp_timer_get_time();
+    apply_sta_config(directed);
     ESP_ERROR_CHECK(esp_wifi_start());
     
     // Wait for connection or failure
@@ -346,6 +487,42 @@ esp_err_t wifi_manager_start_scan(void)
     return esp_wifi_scan_start(&scan_config, false);
 }
 
+esp_err_t wifi_manager_get_stats(wifi_manager_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = s_wifi_manager.stats;
+    return ESP_OK;
+}
+
+const char *wifi_manager_path_name(wifi_connect_path_t path)
+{
+    switch (path) {
+        case WIFI_CONNECT_PATH_FAST: return "cached AP";
+        case WIFI_CONNECT_PATH_FULL: return "full scan";
+        default: return "none";
+    }
+}
+
+esp_err_t wifi_manager_forget_ap_cache(void)
+{
+    s_wifi_manager.ap_cache_valid = false;
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(AP_CACHE_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_erase_key(nvs, AP_CACHE_KEY);
+    if (ret == ESP_OK) {
+        ret = nvs_commit(nvs);
+    } else if (ret == ESP_ERR_NVS_NOT_FOUND) {
+        ret = ESP_OK;
+    }
+    nvs_close(nvs);
+    return ret;
+}
+
 esp_err_t wifi_manager_auto_connect(void)
 {
     // Use configured WiFi credentials from Kconfig
@@ -174,6 +174,15 @@ esp_err_t run_audio_stream_test(void)
     
     ESP_LOGI(TAG, "🎤 Audio streaming started - recording for %d seconds...", TEST_DURATION_SECONDS);
     
+    // This task takes the captured frames itself
+    ret = audio_processor_subscribe_buffer(NULL);
+    if (ret != ESP_OK) {
+        audio_processor_stop_capture();
+        test_state.running = false;
+        close(test_state.socket_fd);
+        return ret;
+    }
+    
     // Run test for specified duration - actively get audio data  
     for (int i = 0; i < TEST_DURATION_SECONDS; i++) {
         // Try to get audio data directly from the audio processor
@@ -229,6 +238,7 @@ esp_err_t run_audio_stream_test(void)
     // Stop audio capture
     test_state.running = false;
     audio_processor_stop_capture();
+    audio_processor_unsubscribe_buffer(NULL);
     close(test_state.socket_fd);
     
     // Report results
@@ -16,10 +16,12 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <sys/param.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_system.h"
 #include "esp_log.h"
+#include "esp_check.h"
 #include "esp_timer.h"
 #include "nvs_flash.h"
 #include "esp_netif.h"
@@ -28,21 +30,33 @@
 
 // BSP includes for display initialization
 #include "bsp/esp32_p4_wifi6_touch_lcd_xc.h"
+#include "esp_lcd_touch_cst9217.h"
 #include "lvgl.h"
 
 // Component includes
 #include "audio_interface_coordinator.h"  // Must come first to define audio_interface_status_t
 #include "howdytts_network_integration.h"
 #include "ui_manager.h"
+#include "ui_sprite_cache.h"
+#include "ui_round_display.h"
+#include "ui_frame_governor.h"
 #include "wifi_manager.h"
 #include "audio_processor.h"
+#include "howdy_heap_tags.h"
+#include "howdy_mem_placement.h"
+#include "howdy_latency.h"
+#include "howdy_sched_monitor.h"
+#include "howdy_boot.h"
+#include "howdy_trace.h"
 #include "enhanced_vad.h"
 #include "enhanced_udp_audio.h"
 #include "esp32_p4_wake_word.h"
+#include "howdy_voice_tuning.h"
 #include "esp32_p4_vad_feedback.h"
 #include "tts_audio_handler.h"
 #include "websocket_client.h"
 #include "dual_i2s_manager.h"
+#include "audio_stage.h"
 
 static const char *TAG = "HowdyPhase6";
 
@@ -78,6 +92,17 @@ typedef struct {
 
 static app_state_t s_app_state = {0};
 
+// Boot graph milestone: UI up, capture running, wake word engine loaded
+#define BOOT_MILESTONE_WAKE_WORD    "wake_word_ready"
+
+// Indev read period once touch reads come from the INT pin (LVGL default 30 ms)
+#define TOUCH_INT_READ_PERIOD_MS    10
+
+// Audio pipeline stages (see init_audio_stages)
+static audio_stage_handle_t s_transport_stage = NULL;
+static audio_stage_handle_t s_analysis_stage = NULL;
+static audio_stage_handle_t s_ui_stage = NULL;
+
 // Performance monitoring task
 static void performance_monitoring_task(void *pvParameters)
 {
@@ -94,31 +119,74 @@ static void performance_monitoring_task(void *pvParameters)
         esp_err_t ret = dual_i2s_get_performance_metrics(&i2s_metrics);
         
         if (ret == ESP_OK) {
-            ESP_LOGI(TAG, "📊 === PERFORMANCE REPORT ===");
-            ESP_LOGI(TAG, "🎵 Audio Latency: %lu ms (Target: <30ms)", i2s_metrics.estimated_audio_latency_ms);
-            ESP_LOGI(TAG, "⚡ I2S Processing: avg=%.1fμs, max=%luμs", 
-                    i2s_metrics.average_processing_time_us, i2s_metrics.max_processing_time_us);
-            ESP_LOGI(TAG, "📈 Operations: %lu total, %lu underruns, %lu mode switches",
-                    i2s_metrics.total_operations, i2s_metrics.buffer_underruns, i2s_metrics.mode_switches);
-            ESP_LOGI(TAG, "💾 Memory Usage: %zu bytes I2S buffers", i2s_metrics.memory_usage_bytes);
-            
             // System memory info
             multi_heap_info_t heap_info;
             heap_caps_get_info(&heap_info, MALLOC_CAP_DEFAULT);
-            ESP_LOGI(TAG, "🧠 System Memory: %lu KB free, %lu KB largest", 
-                    heap_info.total_free_bytes / 1024, heap_info.largest_free_block / 1024);
             
-            // Audio stream statistics
-            ESP_LOGI(TAG, "🎤 Audio Stats: %lu packets sent, level=%.1f", 
-                    s_app_state.audio_packets_sent, s_app_state.current_audio_level);
-            ESP_LOGI(TAG, "🎯 Wake Words: %lu detections", s_app_state.wake_word_detections);
+            // LVGL manages its own pool; report its usage under the UI tag
+            if (bsp_display_lock(100)) {
+                lv_mem_monitor_t lv_mon;
+                lv_mem_monitor(&lv_mon);
+                bsp_display_unlock();
+                howdy_heap_set_external(HOWDY_HEAP_TAG_UI, lv_mon.total_size - lv_mon.free_size);
+            }
+            howdy_heap_sample_rates();
             
-            // Connection status
-            ESP_LOGI(TAG, "🌐 Connections: WiFi=%s, HowdyTTS=%s, VAD Feedback=%s",
-                    s_app_state.wifi_connected ? "✅" : "❌",
-                    s_app_state.howdytts_connected ? "✅" : "❌", 
-                    s_app_state.vad_feedback_connected ? "✅" : "❌");
-            ESP_LOGI(TAG, "📊 === END PERFORMANCE REPORT ===");
+            // One line per report; per-task detail is at GET /tasks, heap tags at GET /heap
+            howdy_sched_summary_t sched;
+            howdy_sched_get_summary(&sched);
+            ui_sprite_cache_stats_t sprites;
+            ui_sprite_cache_get_stats(&sprites);
+            uint32_t sprite_lookups = sprites.hits + sprites.misses;
+            ui_round_display_stats_t redraw;
+            ui_round_display_get_stats(&redraw);
+            ui_frame_governor_stats_t pacing;
+            ui_frame_governor_get_stats(&pacing);
+            esp_lcd_touch_cst9217_stats_t touch = {0};
+            esp_lcd_touch_cst9217_get_stats(NULL, &touch);
+            ESP_LOGI(TAG, "📊 I2S lat=%lums proc avg=%.0fμs max=%luμs underruns=%lu | heap %luKB free (%luKB block) | "
+                    "sched miss=%lu (run %lu) overrun=%lu jitter<=%luμs %s, stack min %luB %s, idle %.0f%% | "
+                    "sprites hit=%lu%% %uKB | redraw clipped %llu%%, full-screen %lums max %lums | "
+                    "ui %.0ffps @%lums (state %lums) skipped %lu, render avg %.1fms max %lums | "
+                    "touch %s i2c=%lu int=%lu taps=%lu idle reads=%lu",
+                    i2s_metrics.estimated_audio_latency_ms, i2s_metrics.average_processing_time_us,
+                    i2s_metrics.max_processing_time_us, i2s_metrics.buffer_underruns,
+                    heap_info.total_free_bytes / 1024, heap_info.largest_free_block / 1024,
+                    sched.misses, sched.max_consecutive_misses, sched.overruns,
+                    sched.jitter_max_us, sched.worst_jitter_task,
+                    sched.stack_free_min, sched.lowest_stack_task, sched.idle_percent,
+                    sprite_lookups ? sprites.hits * 100 / sprite_lookups : 0, (unsigned)(sprites.bytes / 1024),
+                    redraw.px_requested > redraw.px_rendered ? (redraw.px_requested - redraw.px_rendered) * 100 / redraw.px_requested : 0,
+                    redraw.large_refreshes ? redraw.large_time_ms_total / redraw.large_refreshes : 0,
+                    redraw.large_time_ms_max,
+                    pacing.fps, pacing.period_ms, pacing.target_period_ms, pacing.skipped,
+                    pacing.render_ms_avg, pacing.render_ms_max,
+                    touch.interrupt_mode ? "int" : "poll", touch.i2c_reads, touch.interrupts,
+                    touch.transitions / 2, touch.reads_skipped);
+            
+            // Pipeline stages only when they fell behind
+            audio_stage_handle_t stages[] = { s_transport_stage, s_analysis_stage, s_ui_stage };
+            for (size_t i = 0; i < sizeof(stages) / sizeof(stages[0]); i++) {
+                audio_stage_stats_t st;
+                if (audio_stage_get_stats(stages[i], &st) == ESP_OK &&
+                    (st.deadline_misses || st.dropped || st.overflows)) {
+                    ESP_LOGI(TAG, "🧵 Stage %s: %lu done, lat avg=%.0fμs max=%luμs, %lu misses, %lu dropped, %lu overflows, hw=%lu",
+                            st.name, st.processed, st.avg_latency_us, st.max_latency_us,
+                            st.deadline_misses, st.dropped, st.overflows, st.queue_high_water);
+                }
+            }
+            
+            // Playback concealment only once a reply has underrun
+            uint32_t frames_processed;
+            float avg_latency_ms;
+            uint8_t protocol_active;
+            tts_plc_stats_t plc;
+            if (audio_processor_get_stats(&frames_processed, &avg_latency_ms, &protocol_active, &plc) == ESP_OK &&
+                plc.concealment_events) {
+                ESP_LOGI(TAG, "🔊 PLC: %lu losses, %lu frames concealed, %lu silent in gaps, %lu crossfades, pitch %u",
+                        plc.concealment_events, plc.concealed_frames, plc.silence_frames, plc.crossfades,
+                        plc.last_pitch_samples);
+            }
             
             // Performance warning system
             if (i2s_metrics.estimated_audio_latency_ms > 50) {
@@ -130,6 +198,9 @@ static void performance_monitoring_task(void *pvParameters)
             if (heap_info.total_free_bytes < 100000) { // Less than 100KB
                 ESP_LOGW(TAG, "⚠️ Low memory warning: %lu bytes free", heap_info.total_free_bytes);
             }
+            if (sched.lowest_stack_task[0] && sched.stack_free_min < 512) {
+                ESP_LOGW(TAG, "⚠️ Task %s is down to %lu bytes of stack", sched.lowest_stack_task, sched.stack_free_min);
+            }
         }
     }
 }
@@ -139,6 +210,7 @@ static void wake_word_detection_callback(const esp32_p4_wake_word_result_t *resu
 {
     if (!result) return;
     
+    howdy_lat_mark(HOWDY_LAT_WAKE);
     s_app_state.wake_word_detections++;
     s_app_state.wake_word_confidence = result->confidence_score;
     
@@ -192,6 +264,9 @@ static void vad_feedback_event_callback(vad_feedback_message_type_t type,
             const vad_feedback_wake_word_validation_t *validation = 
                 (const vad_feedback_wake_word_validation_t*)data;
             
+            // detection_id is the wake timestamp we sent; its return closes the round trip
+            howdy_lat_server_echo(validation->detection_id);
+            
             ESP_LOGI(TAG, "%s Server %s wake word (ID: %lu, confidence: %.3f, time: %lums)",
                     validation->validated ? "✅" : "❌",
                     validation->validated ? "confirmed" : "rejected",
@@ -268,91 +343,243 @@ static void vad_feedback_event_callback(vad_feedback_message_type_t type,
     }
 }
 
-// HowdyTTS integration callbacks
-static esp_err_t howdytts_audio_callback(const int16_t *audio_data, size_t samples, void *user_data)
+// Staged audio pipeline: the capture callback (the HowdyTTS streaming task,
+// woken per DMA frame) only copies frames into the transport and analysis
+// stages. VAD, wake word, UI and status updates run on their own tasks so a
+// Wi-Fi stall or LVGL redraw can't delay the next I2S read.
+#define APP_STAGE_FRAME_SAMPLES 320     // 20 ms at 16 kHz
+
+typedef struct {
+    int16_t samples[APP_STAGE_FRAME_SAMPLES];
+    uint16_t count;
+    int64_t captured_us;                // DMA completion time, for latency tracing
+} app_audio_frame_t;
+
+typedef struct {
+    float audio_level;
+    bool vad_valid;
+    enhanced_vad_result_t vad;
+} app_ui_update_t;
+
+// Transport stage: never drops, sized to ride out short Wi-Fi stalls
+static void transport_stage_process(void *item, void *ctx)
 {
-    ESP_LOGD(TAG, "Audio callback: streaming %d samples to HowdyTTS server", (int)samples);
+    app_audio_frame_t *frame = (app_audio_frame_t *)item;
     
-    esp_err_t ret = ESP_OK;
+    // Stream audio using HowdyTTS native UDP PCM packet (align with server expectations)
+    // HOWDY_LAT_UPLINK is stamped by the UDP send task when the datagram goes out
+    if (howdytts_stream_audio(frame->samples, frame->count) == ESP_OK) {
+        s_app_state.audio_packets_sent++;
+    }
+}
+
+// Analysis stage: VAD and wake word, then a UI snapshot
+static void analysis_stage_process(void *item, void *ctx)
+{
+    app_audio_frame_t *frame = (app_audio_frame_t *)item;
+    esp_err_t ret;
     
     // Process audio with enhanced VAD if available
     enhanced_vad_result_t vad_result = {0};
     if (s_app_state.vad_initialized && s_app_state.vad_handle) {
-        ret = enhanced_vad_process_audio(s_app_state.vad_handle, audio_data, samples, &vad_result);
+        ret = enhanced_vad_process_audio(s_app_state.vad_handle, frame->samples, frame->count, &vad_result);
         if (ret != ESP_OK) {
             ESP_LOGW(TAG, "VAD processing failed: %s", esp_err_to_name(ret));
             // Continue without VAD data
             memset(&vad_result, 0, sizeof(enhanced_vad_result_t));
         }
+        howdy_lat_vad_decision(frame->captured_us);
     }
     
     // Process audio with wake word detection if available
     esp32_p4_wake_word_result_t wake_word_result = {0};
-    bool has_wake_word = false;
     if (s_app_state.wake_word_initialized && s_app_state.wake_word_handle) {
         ret = esp32_p4_wake_word_process(s_app_state.wake_word_handle, 
-                                        audio_data, samples, 
+                                        frame->samples, frame->count, 
                                         s_app_state.vad_initialized ? &vad_result : NULL,
                                         &wake_word_result);
         if (ret == ESP_OK && wake_word_result.state == WAKE_WORD_STATE_TRIGGERED) {
-            has_wake_word = true;
-            ESP_LOGI(TAG, "🎯 Wake word 'Hey Howdy' detected in audio callback!");
+            ESP_LOGI(TAG, "🎯 Wake word 'Hey Howdy' detected in audio pipeline!");
         }
     }
     
-    // Stream audio using HowdyTTS native UDP PCM packet (align with server expectations)
-    ret = howdytts_stream_audio(audio_data, samples);
+    // Calculate audio level for UI feedback
+    s_app_state.current_audio_level = vad_result.max_amplitude > 0 ? 
+        (float)vad_result.max_amplitude / 32768.0f : 0.0f;
     
-    if (ret == ESP_OK) {
-        s_app_state.audio_packets_sent++;
-        
-        // Calculate audio level for UI feedback
-        s_app_state.current_audio_level = vad_result.max_amplitude > 0 ? 
-            (float)vad_result.max_amplitude / 32768.0f : 0.0f;
-        
-        // Update audio visualization with enhanced feedback
-        ui_manager_update_mic_level((int)(s_app_state.current_audio_level * 100), 
-                                  s_app_state.vad_initialized ? vad_result.confidence : 0.0f);
-        
-        // Enhanced UI feedback with complete conversation state management
-        if (s_app_state.vad_initialized && vad_result.voice_detected) {
-            if (vad_result.speech_started) {
-                ESP_LOGI(TAG, "🗣️ Speech detected! Confidence: %.2f", vad_result.confidence);
-                
-                // Use enhanced conversation state update
-                char speech_status[128];
-                snprintf(speech_status, sizeof(speech_status), 
-                        "Speech detected - confidence %.0f%%", vad_result.confidence * 100);
-                        
-                ui_manager_update_conversation_state(UI_STATE_SPEECH_DETECTED,
-                                                    "Voice input detected",
-                                                    speech_status,
-                                                    (int)(s_app_state.current_audio_level * 100),
-                                                    0, // No TTS during listening
-                                                    vad_result.confidence,
-                                                    s_app_state.wake_word_confidence);
-            }
-            
-            // Continuous VAD confidence updates during speech
-            ui_manager_update_mic_level((int)(s_app_state.current_audio_level * 100), 
-                                      vad_result.confidence);
-                                      
-        } else if (s_app_state.vad_initialized && vad_result.speech_ended) {
-            ESP_LOGI(TAG, "🤫 Speech ended - transitioning to processing");
+    app_ui_update_t update = {
+        .audio_level = s_app_state.current_audio_level,
+        .vad_valid = s_app_state.vad_initialized,
+        .vad = vad_result
+    };
+    audio_stage_push(s_ui_stage, &update);
+}
+
+#define AUDIO_PRESSURE_REPORT_MS    250     // About 12 audio frames per judgement
+
+// Tell the display governor whether audio deadlines are slipping, from the
+// scheduler's missed wakes and the transport/analysis stages' misses
+static void report_audio_pressure(void)
+{
+    static int64_t s_last_report_us;
+    static uint32_t s_last_misses;
+    static uint32_t s_last_overflows;
+    
+    int64_t now = esp_timer_get_time();
+    if (now - s_last_report_us < AUDIO_PRESSURE_REPORT_MS * 1000) {
+        return;
+    }
+    s_last_report_us = now;
+    
+    howdy_sched_summary_t sched;
+    howdy_sched_get_summary(&sched);
+    uint32_t misses = sched.misses;
+    uint32_t overflows = 0;
+    audio_stage_handle_t stages[] = { s_transport_stage, s_analysis_stage };
+    for (size_t i = 0; i < sizeof(stages) / sizeof(stages[0]); i++) {
+        audio_stage_stats_t st;
+        if (audio_stage_get_stats(stages[i], &st) == ESP_OK) {
+            // Frames the analysis stage skipped count as misses: VAD fell behind
+            misses += st.deadline_misses + st.dropped;
+            overflows += st.overflows;
+        }
+    }
+    
+    // Counters only go down when someone resets them; start over from there
+    uint32_t new_misses = misses >= s_last_misses ? misses - s_last_misses : 0;
+    uint32_t new_overflows = overflows >= s_last_overflows ? overflows - s_last_overflows : 0;
+    s_last_misses = misses;
+    s_last_overflows = overflows;
+    
+    ui_audio_pressure_t pressure = UI_AUDIO_PRESSURE_NONE;
+    if (new_overflows > 0 || new_misses >= 3) {
+        pressure = UI_AUDIO_PRESSURE_CRITICAL;      // Audio was lost or kept slipping
+    } else if (new_misses > 0) {
+        pressure = UI_AUDIO_PRESSURE_ELEVATED;
+    }
+    ui_frame_governor_report_audio_pressure(pressure);
+}
+
+// UI stage: drop-oldest, only the latest meter/state matters
+static void ui_stage_process(void *item, void *ctx)
+{
+    app_ui_update_t *update = (app_ui_update_t *)item;
+    const enhanced_vad_result_t *vad_result = &update->vad;
+    
+    report_audio_pressure();
+    int level = (int)(update->audio_level * 100);
+    
+    // Update audio visualization with enhanced feedback
+    ui_manager_update_mic_level(level, update->vad_valid ? vad_result->confidence : 0.0f);
+    
+    // Enhanced UI feedback with complete conversation state management
+    if (update->vad_valid && vad_result->voice_detected) {
+        if (vad_result->speech_started) {
+            ESP_LOGI(TAG, "🗣️ Speech detected! Confidence: %.2f", vad_result->confidence);
             
-            ui_manager_update_conversation_state(UI_STATE_PROCESSING,
-                                                "Processing your request...",
-                                                "Speech analysis complete",
-                                                0, // No more mic input
-                                                0, // No TTS yet
-                                                0.0f, // No VAD during processing
-                                                -1.0f); // Wake word not applicable
+            // Use enhanced conversation state update
+            char speech_status[128];
+            snprintf(speech_status, sizeof(speech_status), 
+                    "Speech detected - confidence %.0f%%", vad_result->confidence * 100);
+                    
+            ui_manager_update_conversation_state(UI_STATE_SPEECH_DETECTED,
+                                                "Voice input detected",
+                                                speech_status,
+                                                level,
+                                                0, // No TTS during listening
+                                                vad_result->confidence,
+                                                s_app_state.wake_word_confidence);
         }
+    } else if (update->vad_valid && vad_result->speech_ended) {
+        ESP_LOGI(TAG, "🤫 Speech ended - transitioning to processing");
         
-        // Update device status with VAD metrics
-        int signal_strength = wifi_manager_get_signal_strength();
-        float noise_floor_db = vad_result.snr_db > 0 ? vad_result.snr_db : -1;
-        howdytts_update_device_status(s_app_state.current_audio_level, noise_floor_db, signal_strength);
+        ui_manager_update_conversation_state(UI_STATE_PROCESSING,
+                                            "Processing your request...",
+                                            "Speech analysis complete",
+                                            0, // No more mic input
+                                            0, // No TTS yet
+                                            0.0f, // No VAD during processing
+                                            -1.0f); // Wake word not applicable
+    }
+    
+    // Update device status with VAD metrics
+    int signal_strength = wifi_manager_get_signal_strength();
+    float noise_floor_db = vad_result->snr_db > 0 ? vad_result->snr_db : -1;
+    howdytts_update_device_status(update->audio_level, noise_floor_db, signal_strength);
+}
+
+static esp_err_t init_audio_stages(void)
+{
+    audio_stage_config_t transport = {
+        .name = "stage_net",
+        .process = transport_stage_process,
+        .item_size = sizeof(app_audio_frame_t),
+        .queue_depth = 25,                      // 500 ms of audio
+        .policy = AUDIO_STAGE_POLICY_NEVER_DROP,
+        .max_block_ms = 5,                      // Bound the capture-side wait
+        .deadline_us = 40000,                   // Two frame periods
+        .stack_size = 4096,
+        .priority = 7,
+        .core_id = 1
+    };
+    audio_stage_config_t ui = {
+        .name = "stage_ui",
+        .process = ui_stage_process,
+        .item_size = sizeof(app_ui_update_t),
+        .queue_depth = 2,
+        .policy = AUDIO_STAGE_POLICY_DROP_OLDEST,
+        .deadline_us = 100000,
+        .stack_size = 4096,
+        .priority = 4,
+        .core_id = 0
+    };
+    // Drop-oldest so a slow VAD or wake word pass can never stall capture;
+    // skipped frames show up as "dropped" in the stage stats
+    audio_stage_config_t analysis = {
+        .name = "stage_vad",
+        .process = analysis_stage_process,
+        .item_size = sizeof(app_audio_frame_t),
+        .queue_depth = 8,
+        .policy = AUDIO_STAGE_POLICY_DROP_OLDEST,
+        .deadline_us = 20000,                   // One frame period
+        .stack_size = 6144,
+        .priority = 6,
+        .core_id = 1
+    };
+    
+    ESP_RETURN_ON_ERROR(audio_stage_create(&transport, &s_transport_stage), TAG, "transport stage");
+    ESP_RETURN_ON_ERROR(audio_stage_create(&ui, &s_ui_stage), TAG, "UI stage");
+    ESP_RETURN_ON_ERROR(audio_stage_create(&analysis, &s_analysis_stage), TAG, "analysis stage");
+    
+    ESP_LOGI(TAG, "✅ Audio pipeline stages running (net, vad, ui)");
+    return ESP_OK;
+}
+
+// HowdyTTS integration callbacks
+
+// Runs on the streaming task for every DMA frame; must not block
+static esp_err_t howdytts_audio_callback(const int16_t *audio_data, size_t samples, void *user_data)
+{
+    if (!s_transport_stage || !s_analysis_stage) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t ret = ESP_OK;
+    app_audio_frame_t frame;
+    // Called from the capture task right after it stamped the DMA buffer
+    frame.captured_us = howdy_lat_last(HOWDY_LAT_I2S_DMA);
+    
+    for (size_t offset = 0; offset < samples; offset += frame.count) {
+        frame.count = (uint16_t)MIN(samples - offset, (size_t)APP_STAGE_FRAME_SAMPLES);
+        memcpy(frame.samples, audio_data + offset, frame.count * sizeof(int16_t));
+        
+        // Transport first so audio keeps flowing even if analysis is behind;
+        // the analysis push never waits, it evicts the oldest queued frame
+        esp_err_t push_ret = audio_stage_push(s_transport_stage, &frame);
+        if (push_ret != ESP_OK) {
+            ret = push_ret;
+        }
+        audio_stage_push(s_analysis_stage, &frame);
     }
     
     return ret;
@@ -598,6 +825,25 @@ static void howdytts_event_callback(const howdytts_event_data_t *event, void *us
                                               15); // 15 second reconnection estimate
             break;
             
+        case HOWDYTTS_EVENT_SERVER_MIGRATED:
+            ESP_LOGI(TAG, "🔀 %s", event->message);
+            s_app_state.selected_server = event->data.server_info;
+            
+            // Audio already follows the new server; move the VAD feedback / TTS socket too
+            if (s_app_state.vad_feedback_handle) {
+                vad_feedback_disconnect(s_app_state.vad_feedback_handle);
+                vad_feedback_deinit(s_app_state.vad_feedback_handle);
+                s_app_state.vad_feedback_handle = NULL;
+                s_app_state.vad_feedback_connected = false;
+            }
+            init_vad_feedback_client(s_app_state.selected_server.ip_address);
+            
+            char migrated_msg[96];
+            snprintf(migrated_msg, sizeof(migrated_msg), "Switched to %s",
+                    s_app_state.selected_server.hostname);
+            ui_manager_update_status(migrated_msg);
+            break;
+            
         case HOWDYTTS_EVENT_AUDIO_STREAMING_STARTED:
             ESP_LOGI(TAG, "🎵 Audio streaming started");
             
@@ -643,6 +889,9 @@ static void update_conversation_context(vad_conversation_context_t new_context)
         esp32_p4_wake_word_set_conversation_context(s_app_state.wake_word_handle, new_context);
     }
     
+    // Holds off server migration until the conversation is over
+    howdytts_set_conversation_active(new_context != VAD_CONVERSATION_IDLE);
+    
     ESP_LOGI(TAG, "🎯 Conversation context updated: %s",
             new_context == VAD_CONVERSATION_IDLE ? "idle" :
             new_context == VAD_CONVERSATION_LISTENING ? "listening" :
@@ -768,7 +1017,13 @@ static void wifi_monitor_task(void *pvParameters)
             s_app_state.wifi_connected = wifi_connected;
             
             if (wifi_connected) {
-                ESP_LOGI(TAG, "WiFi connected");
+                wifi_manager_stats_t wifi_stats;
+                wifi_manager_get_stats(&wifi_stats);
+                ESP_LOGI(TAG, "WiFi connected in %lu ms via %s%s (cached AP %lu/%lu, max %lu ms; full scan max %lu ms)",
+                        wifi_stats.last_connect_ms, wifi_manager_path_name(wifi_stats.last_path),
+                        wifi_stats.lease_reused ? ", same lease" : "",
+                        wifi_stats.fast_connects, wifi_stats.fast_connects + wifi_stats.fast_failures,
+                        wifi_stats.fast_ms_max, wifi_stats.full_ms_max);
                 
                 // Safely update UI if functions are available
                 int signal_strength = wifi_manager_get_signal_strength();
@@ -803,8 +1058,10 @@ static void wifi_monitor_task(void *pvParameters)
     }
 }
 
-// System initialization
-static esp_err_t system_init(void)
+// Boot stages (see app_main for the dependency graph)
+
+// NVS, TCP/IP stack and the default event loop
+static esp_err_t boot_system(void *arg)
 {
     ESP_LOGI(TAG, "🚀 Initializing HowdyTTS Phase 6 Application");
     
@@ -825,22 +1082,65 @@ static esp_err_t system_init(void)
     return ESP_OK;
 }
 
-static esp_err_t howdytts_integration_init_app(void)
+// BSP, panel, LVGL and backlight
+static esp_err_t boot_display(void *arg)
+{
+    ESP_LOGI(TAG, "🔧 Initializing BSP and display...");
+    lv_display_t *display = bsp_display_start();
+    if (display == NULL) {
+        ESP_LOGE(TAG, "❌ BSP display initialization failed");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "✅ BSP display initialized successfully");
+    
+    // Turn on display backlight
+    ESP_RETURN_ON_ERROR(bsp_display_backlight_on(), TAG, "Backlight failed");
+    ESP_LOGI(TAG, "✅ Display backlight enabled");
+    return ESP_OK;
+}
+
+static esp_err_t boot_ui(void *arg)
+{
+    ESP_LOGI(TAG, "🖥️ Initializing UI Manager");
+    ESP_RETURN_ON_ERROR(ui_manager_init(), TAG, "UI manager init failed");
+    ui_manager_set_voice_callback(voice_activation_callback);
+    
+    // With INT-driven touch an indev read is a queue check, not an I2C
+    // transaction, so read it more often for quicker tap-to-talk
+    esp_lcd_touch_cst9217_stats_t touch_stats;
+    if (esp_lcd_touch_cst9217_get_stats(NULL, &touch_stats) == ESP_OK && touch_stats.interrupt_mode &&
+        bsp_display_lock(0)) {
+        ui_manager_set_touch_read_period(TOUCH_INT_READ_PERIOD_MS);
+        bsp_display_unlock();
+    }
+    ui_manager_update_status(s_app_state.wifi_connected ? "WiFi connected" : "Initializing HowdyTTS...");
+    return ESP_OK;
+}
+
+// Association and DHCP; overlaps display, model and codec bring-up
+static esp_err_t boot_wifi(void *arg)
 {
-    ESP_LOGI(TAG, "🔧 Initializing HowdyTTS integration with Enhanced VAD and Wake Word Detection");
+    ESP_LOGI(TAG, "📶 Initializing WiFi");
+    ESP_RETURN_ON_ERROR(wifi_manager_init(NULL), TAG, "WiFi manager init failed");
+    
+    ui_manager_update_status("Connecting to WiFi...");
+    esp_err_t wifi_result = wifi_manager_auto_connect();
+    if (wifi_result != ESP_OK) {
+        // Not fatal: wifi_monitor_task picks up a later connection
+        ESP_LOGW(TAG, "⚠️ WiFi auto-connect failed: %s", esp_err_to_name(wifi_result));
+        ui_manager_update_status("WiFi connection failed - will retry");
+    }
+    return ESP_OK;
+}
+
+// VAD and wake word models; CPU-bound, runs while DHCP is pending
+static esp_err_t boot_voice_models(void *arg)
+{
+    ESP_LOGI(TAG, "🔧 Initializing Enhanced VAD and Wake Word Detection");
     
     // Initialize Enhanced VAD with conversation-aware configuration
     enhanced_vad_config_t vad_config;
-    enhanced_vad_get_conversation_config(16000, &vad_config);
-    
-    // Fine-tune for ESP32-P4 HowdyScreen environment and <50ms target latency
-    vad_config.amplitude_threshold = 2300;          // Slightly more sensitive for faster response
-    vad_config.silence_threshold_ms = 1000;         // 1.0s silence for faster conversation flow
-    vad_config.min_voice_duration_ms = 250;         // 250ms minimum for balance of speed/accuracy
-    vad_config.snr_threshold_db = 7.5f;            // Slightly lower SNR for faster response
-    vad_config.consistency_frames = 4;              // Reduce consistency frames for speed
-    vad_config.confidence_threshold = 0.65f;        // Balanced confidence for conversation flow
-    vad_config.processing_mode = 1;                 // Optimized mode for performance
+    howdy_voice_tuning_vad_config(16000, &vad_config);
     
     s_app_state.vad_handle = enhanced_vad_init(&vad_config);
     if (s_app_state.vad_handle) {
@@ -853,19 +1153,7 @@ static esp_err_t howdytts_integration_init_app(void)
     
     // Initialize Wake Word Detection Engine with conversation-aware configuration
     esp32_p4_wake_word_config_t wake_word_config;
-    esp32_p4_wake_word_get_conversation_config(&wake_word_config);
-    
-    // Optimize for ESP32-P4 HowdyScreen and <50ms target latency
-    wake_word_config.sample_rate = 16000;            // 16kHz audio
-    wake_word_config.frame_size = 320;               // 20ms frames
-    wake_word_config.energy_threshold = 2900;        // Slightly more sensitive for idle wake word detection
-    wake_word_config.confidence_threshold = 0.62f;   // Lower confidence for faster response in conversation
-    wake_word_config.silence_timeout_ms = 1600;      // Reduced timeout for conversation flow
-    wake_word_config.enable_adaptation = true;       // Enable adaptive learning
-    wake_word_config.adaptation_rate = 0.06f;        // Slightly faster adaptation
-    wake_word_config.max_detections_per_min = 15;    // Allow more frequent detections in conversation
-    wake_word_config.pattern_frames = 18;            // Reduce pattern frames for speed
-    wake_word_config.consistency_frames = 3;         // Reduce consistency for speed
+    howdy_voice_tuning_wake_word_config(&wake_word_config);
     
     s_app_state.wake_word_handle = esp32_p4_wake_word_init(&wake_word_config);
     if (s_app_state.wake_word_handle) {
@@ -884,6 +1172,13 @@ static esp_err_t howdytts_integration_init_app(void)
         ESP_LOGW(TAG, "⚠️ Wake word detection initialization failed - continuing without wake word");
         s_app_state.wake_word_initialized = false;
     }
+    return ESP_OK;
+}
+
+// UDP audio, pipeline stages and the HowdyTTS HTTP server
+static esp_err_t boot_howdytts(void *arg)
+{
+    ESP_LOGI(TAG, "🔧 Initializing HowdyTTS integration");
     
     // Initialize Enhanced UDP Audio if VAD is available
     if (s_app_state.vad_initialized) {
@@ -927,9 +1222,18 @@ static esp_err_t howdytts_integration_init_app(void)
         .enable_audio_stats = true,                 // Performance monitoring
         .enable_fallback = false,                   // No WebSocket fallback for now
         .discovery_timeout_ms = 15000,              // 15 second discovery
-        .connection_retry_count = 3                 // 3 retry attempts
+        .connection_retry_count = 3,                // 3 retry attempts
+#ifdef CONFIG_HOWDY_AUDIO_RTP
+        .enable_rtp = true,                         // RTP/RTCP transport
+#endif
+#ifdef CONFIG_HOWDY_SERVER_MIGRATION
+        .enable_server_migration = true,            // Move to a better server between conversations
+#endif
     };
     
+    // Start pipeline stages before the audio callback can fire
+    ESP_RETURN_ON_ERROR(init_audio_stages(), TAG, "Failed to start audio pipeline stages");
+    
     // Set up callbacks
     howdytts_integration_callbacks_t howdytts_callbacks = {
         .audio_callback = howdytts_audio_callback,
@@ -951,7 +1255,12 @@ static esp_err_t howdytts_integration_init_app(void)
     ESP_LOGI(TAG, "🎤 Wake Word: %s", s_app_state.wake_word_initialized ? "Hey Howdy Detection with Echo Cancellation" : "Disabled");
     ESP_LOGI(TAG, "⚡ Performance: Optimized for <50ms end-to-end conversation latency");
     ESP_LOGI(TAG, "🔊 Echo Suppression: Hardware (ES7210) + Software (Conversation-Aware)");
-    
+    return ESP_OK;
+}
+
+// Microphone capture and speaker output; needs the pipeline stages running
+static esp_err_t boot_audio_io(void *arg)
+{
     // Initialize Dual I2S Manager with Pure I2S mode (no codec initialization)
     ESP_LOGI(TAG, "🟨 Initializing Dual I2S Manager in Pure I2S mode (avoiding I2C driver conflicts)");
     ESP_LOGW(TAG, "🟨 Pure I2S Mode: ES8311 codec initialization bypassed to prevent I2C driver conflicts");
@@ -1007,6 +1316,21 @@ static esp_err_t howdytts_integration_init_app(void)
     return ESP_OK;
 }
 
+// Look for servers as soon as both the network and the integration are up,
+// rather than on wifi_monitor_task's next 10 s check
+static esp_err_t boot_discovery(void *arg)
+{
+    if (!wifi_manager_is_connected()) {
+        return ESP_OK;
+    }
+    s_app_state.wifi_connected = true;
+    ui_manager_update_status("WiFi connected");
+    ESP_LOGI(TAG, "Starting HowdyTTS discovery");
+    howdytts_discovery_start(15000);
+    s_app_state.discovery_completed = true;
+    return ESP_OK;
+}
+
 // Initialize VAD feedback client (called after server discovery)
 esp_err_t init_vad_feedback_client(const char *server_ip)
 {
@@ -1074,6 +1398,9 @@ static void stats_task(void *pvParameters)
         // Update every 10 seconds to reduce system load
         vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(10000));
         
+        // CPU shares at GET /tasks cover the time between these samples
+        howdy_sched_sample();
+        
         if (s_app_state.howdytts_connected) {
             // Get audio statistics
             howdytts_audio_stats_t stats;
@@ -1140,6 +1467,16 @@ static void stats_task(void *pvParameters)
                 }
             }
             
+            // Wake-to-first-audio only; per-stage histograms are at GET /latency
+            howdy_lat_counters_t lat_counters;
+            howdy_lat_get_counters(&lat_counters);
+            howdy_lat_summary_t lat;
+            if (howdy_lat_get_summary(HOWDY_LAT_SPAN_WAKE_TO_AUDIO, &lat) == ESP_OK && lat.count > 0) {
+                ESP_LOGI(TAG, "⏱️ Wake to audio: n=%lu p50=%.1fms p95=%.1fms max=%.1fms (%lu abandoned)",
+                        lat.count, lat.p50_us / 1000.0f, lat.p95_us / 1000.0f, lat.max_us / 1000.0f,
+                        lat_counters.abandoned);
+            }
+            
             // System health
             ESP_LOGI(TAG, "💾 System Health - Free heap: %d bytes, Min free: %d bytes",
                     (int)esp_get_free_heap_size(), (int)esp_get_minimum_free_heap_size());
@@ -1152,42 +1489,43 @@ void app_main(void)
     ESP_LOGI(TAG, "🎉 HowdyTTS Phase 6 - Native Protocol Integration");
     ESP_LOGI(TAG, "ESP32-P4 HowdyScreen with PCM Audio Streaming");
     
-    // System initialization
-    ESP_ERROR_CHECK(system_init());
+    // Before anything creates a cJSON object, so every node is tagged
+    howdy_heap_install_cjson_hooks();
+    
+#ifdef CONFIG_HOWDY_TRACE
+    // Early, so pipeline and boot activity land in the rings (GET /trace)
+    howdy_trace_init();
+#endif
+    
+#ifdef CONFIG_HOWDY_MEM_PLACEMENT_BENCHMARK
+    howdy_mem_bench_result_t bench[HOWDY_MEM_CLASS_COUNT + 1];
+    howdy_mem_benchmark(bench, sizeof(bench) / sizeof(bench[0]));
+#endif
+    
+    // Each subsystem starts as soon as the ones it needs are up; stage
+    // timings are logged at the end and served at GET /boot
+    static const howdy_boot_stage_t boot_stages[] = {
+        { .name = "system",        .fn = boot_system,       .core = -1 },
+        { .name = "display",       .fn = boot_display,      .core = 0 },
+        { .name = "ui",            .fn = boot_ui,           .core = 0,  .deps = { "display" } },
+        { .name = "wifi",          .fn = boot_wifi,         .core = -1, .deps = { "system" } },
+        { .name = "voice_models",  .fn = boot_voice_models, .core = 1 },
+        { .name = "howdytts",      .fn = boot_howdytts,     .core = -1, .deps = { "system", "voice_models" } },
+        { .name = "audio_io",      .fn = boot_audio_io,     .core = -1, .deps = { "howdytts" } },
+        { .name = "discovery",     .fn = boot_discovery,    .core = -1, .deps = { "wifi", "howdytts" } },
+        { .name = BOOT_MILESTONE_WAKE_WORD,                 .deps = { "ui", "audio_io" } },
+    };
+    esp_err_t boot_ret = howdy_boot_run(boot_stages, sizeof(boot_stages) / sizeof(boot_stages[0]));
     
-    // Initialize BSP (Board Support Package) and display
-    ESP_LOGI(TAG, "🔧 Initializing BSP and display...");
-    lv_display_t *display = bsp_display_start();
-    if (display == NULL) {
-        ESP_LOGE(TAG, "❌ BSP display initialization failed");
-        return;
+    howdy_boot_stage_stats_t ready;
+    if (howdy_boot_get_stage(BOOT_MILESTONE_WAKE_WORD, &ready) == ESP_OK && ready.status == HOWDY_BOOT_DONE) {
+        ESP_LOGI(TAG, "⏱️ Ready for wake word %lu ms after reset", ready.end_us / 1000);
     }
-    ESP_LOGI(TAG, "✅ BSP display initialized successfully");
-    
-    // Turn on display backlight
-    ESP_LOGI(TAG, "💡 Turning on display backlight...");
-    ESP_ERROR_CHECK(bsp_display_backlight_on());
-    ESP_LOGI(TAG, "✅ Display backlight enabled");
-    
-    // Initialize UI Manager
-    ESP_LOGI(TAG, "🖥️ Initializing UI Manager");
-    ESP_ERROR_CHECK(ui_manager_init());
-    ui_manager_set_voice_callback(voice_activation_callback);
-    ui_manager_update_status("Initializing HowdyTTS...");
-    
-    // Initialize HowdyTTS integration
-    ESP_ERROR_CHECK(howdytts_integration_init_app());
-    
-    // Initialize WiFi
-    ESP_LOGI(TAG, "📶 Initializing WiFi");
-    ESP_ERROR_CHECK(wifi_manager_init(NULL));
-    
-    ui_manager_update_status("Connecting to WiFi...");
-    esp_err_t wifi_result = wifi_manager_auto_connect();
-    if (wifi_result != ESP_OK) {
-        ESP_LOGW(TAG, "⚠️ WiFi auto-connect failed: %s", esp_err_to_name(wifi_result));
-        ui_manager_update_status("WiFi connection failed - will retry");
+    howdy_boot_stage_stats_t display_stage;
+    if (howdy_boot_get_stage("display", &display_stage) == ESP_OK && display_stage.status != HOWDY_BOOT_DONE) {
+        return;     // Nothing to show anything on
     }
+    ESP_ERROR_CHECK(boot_ret);
     
     // Start monitoring tasks
     xTaskCreate(stats_task, "stats_task", 4096, NULL, 2, NULL);
@@ -1,19 +0,0 @@
-/* Combined header for all Howdy images */
-#pragma once
-
-#include "lvgl.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "howdy_img_howdybackward.h"
-#include "howdy_img_howdyleft.h"
-#include "howdy_img_howdyright2.h"
-#include "howdy_img_armraisehowdy.h"
-#include "howdy_img_howdyright.h"
-#include "howdy_img_howdymidget.h"
-
-#ifdef __cplusplus
-}
-#endif
@@ -1,2068 +0,0 @@
-/* Auto-generated LVGL image data from ArmRaiseHowdy.png */
-/* Original size: 1024x1024, Scaled: 128x128 */
-
-#include "howdy_img_armraisehowdy.h"
-
-/* Image data in RGB565 format */
-static const uint8_t howdy_img_armraisehowdy_data[] = {
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x80, 0x18, 0x80, 0x18, 
-    0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0x80, 0x18, 0xA0, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE1, 0x30, 0x82, 0x61, 0x61, 0x61, 0x81, 0x61, 0xA2, 0x8A, 0xC2, 0x92, 
-    0xE2, 0x92, 0xE2, 0x92, 0x03, 0x93, 0x02, 0x9B, 0x43, 0xA3, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x30, 0x61, 0x61, 0x41, 0x59, 0x61, 0x59, 0x82, 0x8A, 0xA2, 0x8A, 
-    0xA2, 0x8A, 0xC2, 0x92, 0xE2, 0x92, 0xE2, 0x92, 0x23, 0x9B, 0xE0, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE1, 0x38, 0x82, 0x69, 0x61, 0x61, 0x81, 0x61, 0xA2, 0x8A, 0xC2, 0x92, 
-    0xE2, 0x92, 0xE2, 0x92, 0xE2, 0x92, 0xE2, 0x92, 0x23, 0xA3, 0xA0, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x80, 0x20, 0x80, 0x20, 0xA1, 0x28, 0x82, 0x61, 0xA2, 0x61, 
-    0x82, 0x61, 0x02, 0x72, 0xA2, 0x92, 0xA2, 0x8A, 0xC2, 0x92, 0x22, 0x6A, 0xE2, 0x59, 0x02, 0x62, 
-    0x61, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x84, 0x20, 
-    0x64, 0x20, 0x64, 0x20, 0x64, 0x20, 0x64, 0x28, 0x64, 0x28, 0x84, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x40, 0xE2, 0x48, 
-    0xA2, 0x40, 0x62, 0x59, 0x82, 0x8A, 0x62, 0x82, 0x62, 0x82, 0x23, 0xA3, 0x83, 0xAB, 0xA3, 0xB3, 
-    0xA2, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0xC7, 0x40, 
-    0xA7, 0x40, 0xA7, 0x40, 0xA8, 0x40, 0xA8, 0x48, 0xA8, 0x48, 0xC8, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x49, 0x02, 0x49, 
-    0xE2, 0x40, 0x82, 0x61, 0x82, 0x8A, 0x82, 0x8A, 0x62, 0x8A, 0xE3, 0x92, 0x23, 0x9B, 0x43, 0xA3, 
-    0x62, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0xA7, 0x38, 
-    0x86, 0x38, 0xA6, 0x38, 0xA7, 0x38, 0xA7, 0x40, 0xA7, 0x40, 0xA7, 0x40, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x08, 0x02, 0x49, 0x02, 0x49, 
-    0xE2, 0x48, 0x82, 0x61, 0x62, 0x8A, 0x62, 0x82, 0x42, 0x82, 0x03, 0x9B, 0x43, 0xA3, 0x63, 0xAB, 
-    0x83, 0x7A, 0x40, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0xC7, 0x38, 
-    0xA7, 0x38, 0xA6, 0x38, 0xC7, 0x38, 0xC7, 0x38, 0xC8, 0x38, 0xC7, 0x38, 0x21, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x30, 0x02, 0x51, 0x02, 0x49, 0x22, 0x51, 0xA2, 0x69, 0xA2, 0x69, 
-    0xA2, 0x69, 0xA2, 0x69, 0x82, 0x59, 0xA2, 0x61, 0x62, 0x59, 0x44, 0x9B, 0x05, 0xB4, 0xE5, 0xB3, 
-    0x84, 0xA3, 0x82, 0x82, 0x82, 0x82, 0xA2, 0x8A, 0xA0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x20, 0xA6, 0x38, 0xA6, 0x38, 0xC6, 0x30, 0xE7, 0x10, 
-    0x07, 0x11, 0xE6, 0x10, 0x27, 0x11, 0x68, 0x11, 0x68, 0x11, 0x68, 0x19, 0xA8, 0x48, 0x88, 0x48, 
-    0xA9, 0x50, 0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC1, 0x30, 0x22, 0x51, 0x02, 0x49, 0x01, 0x51, 0xA2, 0x69, 0xA2, 0x71, 
-    0xA2, 0x71, 0xA2, 0x69, 0x82, 0x59, 0xA2, 0x61, 0x62, 0x59, 0x44, 0x9B, 0x25, 0xBC, 0xE5, 0xB3, 
-    0xA4, 0xAB, 0xA2, 0x8A, 0xA2, 0x8A, 0xC2, 0x92, 0xA0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x20, 0xA7, 0x38, 0xA6, 0x38, 0xC7, 0x30, 0x07, 0x11, 
-    0x07, 0x11, 0x06, 0x11, 0x27, 0x11, 0x69, 0x11, 0x68, 0x11, 0x69, 0x11, 0xA9, 0x48, 0xA9, 0x48, 
-    0xAA, 0x50, 0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA1, 0x28, 0xE2, 0x48, 0xE1, 0x40, 0xE1, 0x48, 0xA2, 0x69, 0xC2, 0x71, 
-    0xC2, 0x71, 0x82, 0x61, 0x42, 0x59, 0x62, 0x59, 0x21, 0x51, 0x44, 0x9B, 0x25, 0xBC, 0x05, 0xB4, 
-    0xA4, 0xAB, 0x82, 0x82, 0xA2, 0x82, 0xA2, 0x8A, 0xA0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x20, 0xA7, 0x40, 0x86, 0x38, 0xA6, 0x30, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x48, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x19, 0xA9, 0x48, 0x89, 0x50, 
-    0x89, 0x58, 0x46, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x20, 0x43, 0x20, 0x43, 0x20, 
-    0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x44, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0xA1, 0x28, 
-    0x80, 0x28, 0x80, 0x28, 0x22, 0x49, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x81, 0x69, 0x81, 0x69, 
-    0x61, 0x61, 0xE2, 0x71, 0xE3, 0x8A, 0xC3, 0x8A, 0xC3, 0x8A, 0x44, 0x9B, 0x84, 0xAB, 0x84, 0xAB, 
-    0x43, 0xA3, 0x82, 0x8A, 0x82, 0x8A, 0xA2, 0x8A, 0x61, 0x49, 0xC0, 0x30, 0xC0, 0x38, 0xC1, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x18, 0xE7, 0x28, 0xC6, 0x20, 0xE7, 0x20, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x27, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x29, 0x31, 0x09, 0x31, 
-    0x2A, 0x31, 0xE8, 0x40, 0x85, 0x50, 0x85, 0x48, 0xA5, 0x50, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xA7, 0x48, 0xA7, 0x48, 0xA7, 0x48, 
-    0xA7, 0x48, 0xA7, 0x48, 0xA7, 0x48, 0xA8, 0x50, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x42, 0x59, 
-    0x22, 0x51, 0x02, 0x51, 0x82, 0x69, 0xE2, 0x79, 0xE2, 0x79, 0xC2, 0x71, 0x61, 0x61, 0x61, 0x61, 
-    0x21, 0x59, 0x63, 0x7A, 0x45, 0xBC, 0x25, 0xB4, 0x45, 0xBC, 0x43, 0x9B, 0xE3, 0x92, 0x03, 0x9B, 
-    0xE3, 0x92, 0x82, 0x8A, 0x82, 0x8A, 0x82, 0x8A, 0xE2, 0x71, 0xA2, 0x69, 0xA1, 0x71, 0x82, 0x59, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x10, 0x07, 0x11, 0xE7, 0x10, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x27, 0x11, 0x89, 0x11, 0xAA, 0x11, 
-    0xAA, 0x01, 0x6A, 0x41, 0x09, 0xA1, 0x09, 0x91, 0x2A, 0xA1, 0x42, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x40, 0x86, 0x40, 0x86, 0x40, 
-    0x86, 0x40, 0x87, 0x40, 0x87, 0x40, 0xA7, 0x48, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x22, 0x51, 
-    0x01, 0x49, 0xE1, 0x48, 0x62, 0x61, 0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0x61, 0x61, 0x61, 0x61, 
-    0x21, 0x59, 0x43, 0x7A, 0x25, 0xB4, 0xE5, 0xAB, 0x05, 0xB4, 0x44, 0xA3, 0x03, 0x9B, 0x23, 0x9B, 
-    0xE3, 0x92, 0x62, 0x82, 0x82, 0x8A, 0x82, 0x8A, 0xC1, 0x69, 0x61, 0x61, 0x81, 0x69, 0x61, 0x51, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x10, 0x07, 0x19, 0xE6, 0x10, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x28, 0x11, 0x8A, 0x11, 0x8A, 0x19, 
-    0x8A, 0x09, 0x49, 0x41, 0xE8, 0x90, 0xE8, 0x88, 0x09, 0x91, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x08, 0x41, 0x10, 0xA7, 0x40, 0xA7, 0x40, 0xA7, 0x40, 
-    0xA7, 0x40, 0xA7, 0x40, 0xA7, 0x40, 0xA7, 0x48, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x22, 0x51, 
-    0x01, 0x51, 0x02, 0x49, 0x62, 0x61, 0xC2, 0x71, 0xC2, 0x71, 0xA2, 0x71, 0x61, 0x61, 0x61, 0x61, 
-    0x21, 0x59, 0x42, 0x7A, 0x25, 0xB4, 0xE5, 0xAB, 0xE5, 0xAB, 0x44, 0xA3, 0x03, 0x9B, 0x23, 0x9B, 
-    0xE3, 0x92, 0x62, 0x82, 0x62, 0x82, 0x62, 0x8A, 0xC2, 0x69, 0x82, 0x61, 0xA2, 0x61, 0x62, 0x51, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x10, 0x07, 0x19, 0xE6, 0x10, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x28, 0x11, 0x8A, 0x11, 0x8A, 0x19, 
-    0xAA, 0x09, 0x69, 0x41, 0xE9, 0x90, 0xE9, 0x88, 0x09, 0x91, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x84, 0x38, 0xE7, 0x68, 0xC6, 0x60, 0xC7, 0x60, 0xAA, 0x19, 0xAA, 0x11, 0xAA, 0x19, 
-    0x89, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x06, 0x11, 0xE6, 0x10, 0xE6, 0x10, 0xA4, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x22, 0x51, 
-    0x01, 0x49, 0x01, 0x49, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x62, 0x61, 0x82, 0x61, 
-    0x61, 0x61, 0x62, 0x61, 0x62, 0x59, 0x82, 0x59, 0x62, 0x59, 0x42, 0x7A, 0x82, 0x82, 0x82, 0x82, 
-    0x82, 0x8A, 0x42, 0x82, 0x62, 0x82, 0x61, 0x8A, 0xC6, 0x31, 0x88, 0x19, 0xA8, 0x19, 0x68, 0x21, 
-    0xA7, 0x38, 0xA7, 0x38, 0xA7, 0x40, 0xE7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0xEC, 0x19, 0x0D, 0x1A, 
-    0x0C, 0x12, 0x6B, 0x31, 0xAA, 0x68, 0xCA, 0x58, 0xCB, 0x68, 0x43, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x84, 0x38, 0xC7, 0x70, 0xC7, 0x68, 0xE7, 0x60, 0xCA, 0x19, 0xAA, 0x11, 0xAA, 0x11, 
-    0x89, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x07, 0x11, 0xE6, 0x10, 0xE6, 0x10, 0xC4, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x22, 0x51, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x62, 0x61, 0x82, 0x61, 
-    0x82, 0x61, 0x62, 0x59, 0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 0x22, 0x72, 0x82, 0x82, 0x62, 0x82, 
-    0x62, 0x82, 0x42, 0x82, 0x62, 0x82, 0x42, 0x82, 0xC7, 0x31, 0x89, 0x11, 0xA9, 0x11, 0x68, 0x19, 
-    0xA7, 0x40, 0xA7, 0x38, 0xA7, 0x40, 0xE7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0xEC, 0x19, 0x0D, 0x1A, 
-    0x0D, 0x1A, 0x8C, 0x31, 0xAA, 0x58, 0xAA, 0x50, 0xCB, 0x58, 0x63, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x84, 0x40, 0xC7, 0x70, 0xA6, 0x68, 0xC7, 0x60, 0xCA, 0x11, 0xCA, 0x11, 0xCA, 0x11, 
-    0x89, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x06, 0x11, 0xE6, 0x10, 0xE6, 0x10, 0xC4, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x01, 0x51, 
-    0x01, 0x51, 0x01, 0x51, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x50, 0x61, 0x61, 0x61, 0x69, 
-    0x61, 0x69, 0x41, 0x61, 0x01, 0x51, 0x21, 0x59, 0x01, 0x59, 0x21, 0x7A, 0x81, 0x8A, 0x61, 0x8A, 
-    0x61, 0x8A, 0x41, 0x8A, 0x41, 0x8A, 0x41, 0x92, 0xC7, 0x31, 0xA9, 0x09, 0xC9, 0x11, 0x68, 0x19, 
-    0xA7, 0x38, 0xA7, 0x38, 0xA7, 0x40, 0xC7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0x0D, 0x12, 0x0D, 0x12, 
-    0x2D, 0x0A, 0x8C, 0x31, 0x8A, 0x68, 0x8A, 0x58, 0xCB, 0x68, 0x63, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x84, 0x28, 0x07, 0x49, 0xE7, 0x40, 0xE7, 0x40, 0x49, 0x31, 0x49, 0x31, 0x29, 0x31, 
-    0x49, 0x21, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x27, 0x11, 0x07, 0x11, 0x07, 0x11, 0x06, 0x11, 
-    0xA4, 0x10, 0xA4, 0x08, 0xA4, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x45, 0x31, 
-    0x24, 0x31, 0x04, 0x31, 0x25, 0x31, 0x45, 0x31, 0x25, 0x31, 0x45, 0x31, 0xA5, 0x41, 0xA5, 0x41, 
-    0xA5, 0x41, 0xA6, 0x41, 0xA6, 0x39, 0xA6, 0x39, 0xA6, 0x39, 0x67, 0x52, 0xA7, 0x5A, 0xA7, 0x5A, 
-    0x87, 0x5A, 0x46, 0x52, 0x46, 0x52, 0x66, 0x5A, 0x68, 0x39, 0x08, 0x31, 0x28, 0x31, 0x08, 0x31, 
-    0xA7, 0x40, 0xA7, 0x38, 0xA7, 0x40, 0xE7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x28, 0x19, 0x8B, 0x51, 0x8C, 0x51, 
-    0x8C, 0x51, 0x6B, 0x49, 0x4B, 0x39, 0x4B, 0x39, 0x6C, 0x41, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA4, 0x08, 0x28, 0x11, 0x27, 0x09, 0x27, 0x11, 0xA8, 0x48, 0x88, 0x50, 0x88, 0x50, 
-    0xE8, 0x38, 0x48, 0x11, 0x48, 0x19, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 
-    0x48, 0x19, 0x48, 0x11, 0x48, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0x68, 0x11, 
-    0x48, 0x11, 0x28, 0x11, 0x69, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0xEA, 0x11, 0xEA, 0x11, 
-    0xCA, 0x11, 0x0B, 0x1A, 0x6C, 0x1A, 0x6C, 0x1A, 0x6C, 0x1A, 0xCD, 0x1A, 0xCE, 0x1A, 0xCE, 0x1A, 
-    0xAD, 0x12, 0x4C, 0x12, 0x4C, 0x12, 0x6C, 0x0A, 0x09, 0x41, 0x88, 0x50, 0xA8, 0x50, 0xA8, 0x48, 
-    0xA7, 0x40, 0xC7, 0x40, 0xA7, 0x40, 0xE7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x21, 0xC9, 0x90, 0xCA, 0x98, 
-    0xAA, 0xA0, 0x4B, 0x69, 0x2C, 0x0A, 0xEC, 0x11, 0x2D, 0x12, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA4, 0x08, 0x28, 0x19, 0x07, 0x11, 0x27, 0x19, 0xA9, 0x48, 0xA9, 0x48, 0xA9, 0x48, 
-    0xE8, 0x30, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x28, 0x11, 0x27, 0x11, 
-    0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0x68, 0x19, 
-    0x27, 0x11, 0x28, 0x11, 0x68, 0x11, 0x89, 0x11, 0x88, 0x11, 0x88, 0x11, 0xE9, 0x19, 0xE9, 0x19, 
-    0xE9, 0x19, 0x0A, 0x1A, 0x6B, 0x1A, 0x6B, 0x1A, 0x4B, 0x1A, 0xCC, 0x1A, 0xED, 0x1A, 0xED, 0x1A, 
-    0xAC, 0x1A, 0x4B, 0x1A, 0x4C, 0x1A, 0x6C, 0x12, 0x09, 0x39, 0x88, 0x48, 0xA8, 0x48, 0xA8, 0x48, 
-    0xA8, 0x40, 0xC8, 0x40, 0xA7, 0x40, 0xE7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 
-    0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x11, 0x07, 0x19, 0xEA, 0x88, 0xEA, 0x98, 
-    0xCA, 0xA0, 0x4B, 0x61, 0x0C, 0x0A, 0xEB, 0x11, 0x2D, 0x1A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA4, 0x10, 0x28, 0x19, 0x07, 0x19, 0x27, 0x19, 0xC8, 0x48, 0xA8, 0x48, 0xA9, 0x48, 
-    0xE8, 0x30, 0x48, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 
-    0x27, 0x11, 0x28, 0x11, 0x27, 0x11, 0x62, 0x08, 0x21, 0x00, 0x41, 0x00, 0xA3, 0x10, 0x48, 0x19, 
-    0x27, 0x19, 0x27, 0x19, 0x48, 0x19, 0x69, 0x19, 0x68, 0x19, 0x68, 0x19, 0xA9, 0x21, 0xC9, 0x21, 
-    0xC9, 0x21, 0xEA, 0x21, 0x4B, 0x2A, 0x4B, 0x2A, 0x4B, 0x2A, 0xAC, 0x2A, 0xAC, 0x2A, 0xAC, 0x2A, 
-    0x8C, 0x2A, 0x6B, 0x22, 0x6B, 0x22, 0x6B, 0x22, 0x28, 0x41, 0xA7, 0x50, 0xC7, 0x48, 0xC7, 0x48, 
-    0xA7, 0x40, 0xC7, 0x40, 0xC7, 0x40, 0xE7, 0x28, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 
-    0x07, 0x19, 0x07, 0x19, 0x08, 0x19, 0x08, 0x21, 0x08, 0x21, 0x08, 0x29, 0x0A, 0x79, 0x2A, 0x81, 
-    0x0A, 0x89, 0x6B, 0x61, 0xEC, 0x21, 0xCB, 0x21, 0x0C, 0x2A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x85, 0x28, 0xC9, 0x50, 0xA8, 0x48, 0xC8, 0x48, 0x28, 0x19, 0x48, 0x19, 0x48, 0x11, 
-    0x08, 0x29, 0xA9, 0x48, 0xC8, 0x40, 0xA8, 0x48, 0x08, 0x21, 0x48, 0x11, 0x27, 0x11, 0x28, 0x11, 
-    0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x47, 0x19, 0x27, 0x19, 0x28, 0x11, 0x26, 0x21, 0xE2, 0x40, 
-    0xE3, 0x40, 0xE2, 0x38, 0xC6, 0x40, 0xA8, 0x48, 0xA7, 0x48, 0xA8, 0x48, 0xA9, 0x58, 0xC9, 0x58, 
-    0xA9, 0x58, 0xE8, 0x68, 0x27, 0x89, 0x07, 0x81, 0x27, 0x81, 0x27, 0x81, 0x27, 0x89, 0x28, 0x89, 
-    0x86, 0x89, 0xA2, 0x8A, 0x82, 0x8A, 0xA2, 0x8A, 0x02, 0x7A, 0xC2, 0x79, 0xC2, 0x79, 0xA2, 0x71, 
-    0x02, 0x51, 0x03, 0x51, 0x02, 0x59, 0x05, 0x31, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 
-    0x07, 0x19, 0x07, 0x11, 0xE9, 0x38, 0xCB, 0x60, 0xCB, 0x60, 0xEB, 0x58, 0x4C, 0x22, 0x8C, 0x1A, 
-    0xAD, 0x12, 0xEB, 0x49, 0xE9, 0x98, 0xE9, 0x88, 0x0A, 0x99, 0x42, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x65, 0x30, 0xA9, 0x50, 0x88, 0x48, 0xA8, 0x48, 0x27, 0x19, 0x48, 0x11, 0x48, 0x11, 
-    0x08, 0x29, 0xA8, 0x48, 0xA8, 0x40, 0xA8, 0x48, 0x08, 0x21, 0x27, 0x11, 0x28, 0x19, 0x28, 0x11, 
-    0x28, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x11, 0x27, 0x11, 0x28, 0x11, 0x06, 0x21, 0xE2, 0x40, 
-    0xE2, 0x40, 0xE2, 0x40, 0xC6, 0x40, 0xA8, 0x48, 0xA7, 0x48, 0xA8, 0x48, 0xA9, 0x50, 0xA9, 0x58, 
-    0xA9, 0x50, 0xC8, 0x68, 0x07, 0x89, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x89, 0x07, 0x89, 
-    0x66, 0x89, 0xA2, 0x92, 0x82, 0x92, 0xA2, 0x92, 0x02, 0x82, 0xC2, 0x79, 0xE2, 0x79, 0xA2, 0x71, 
-    0x02, 0x51, 0x02, 0x51, 0x02, 0x59, 0x05, 0x31, 0x07, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 
-    0x07, 0x19, 0x07, 0x11, 0xE9, 0x40, 0xCB, 0x60, 0xCB, 0x60, 0xEB, 0x58, 0x4C, 0x22, 0x8C, 0x22, 
-    0xAD, 0x1A, 0xCB, 0x49, 0xC9, 0x98, 0xE9, 0x88, 0xEA, 0x98, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x85, 0x28, 0xA9, 0x50, 0x88, 0x48, 0xA9, 0x48, 0x47, 0x11, 0x47, 0x11, 0x47, 0x09, 
-    0x08, 0x29, 0xA8, 0x48, 0xA8, 0x48, 0xA8, 0x48, 0x28, 0x19, 0x47, 0x11, 0x48, 0x11, 0x48, 0x11, 
-    0x48, 0x11, 0x48, 0x11, 0x47, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x06, 0x21, 0xC2, 0x40, 
-    0xC2, 0x40, 0xC2, 0x40, 0xC6, 0x48, 0xA8, 0x50, 0xA8, 0x48, 0xA8, 0x48, 0xA9, 0x58, 0xA9, 0x58, 
-    0x89, 0x58, 0xC8, 0x70, 0x07, 0x91, 0xE7, 0x88, 0x07, 0x89, 0x07, 0x91, 0x07, 0x91, 0x07, 0x91, 
-    0x86, 0x91, 0xC1, 0x9A, 0xA2, 0x9A, 0xC2, 0x9A, 0x02, 0x8A, 0xC1, 0x81, 0xE1, 0x81, 0xC1, 0x79, 
-    0x02, 0x59, 0x02, 0x59, 0x01, 0x59, 0x05, 0x31, 0x07, 0x11, 0x07, 0x19, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x27, 0x09, 0xE9, 0x40, 0xAB, 0x68, 0xAB, 0x68, 0xCB, 0x60, 0x8C, 0x1A, 0xAD, 0x12, 
-    0xCD, 0x0A, 0xEC, 0x49, 0xEA, 0xA8, 0x0A, 0x99, 0x0B, 0xA1, 0x43, 0x28, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x83, 0x28, 0xE5, 0x50, 0xC5, 0x48, 0xE5, 0x48, 0xE7, 0x30, 0xE8, 0x30, 0xE8, 0x30, 
-    0x08, 0x29, 0x08, 0x29, 0x08, 0x29, 0x08, 0x29, 0xE8, 0x30, 0xE8, 0x30, 0x08, 0x31, 0x08, 0x31, 
-    0x09, 0x39, 0xE8, 0x38, 0xE8, 0x38, 0x28, 0x21, 0x27, 0x11, 0x27, 0x11, 0x06, 0x19, 0xE5, 0x28, 
-    0x05, 0x21, 0x05, 0x21, 0xE7, 0x28, 0xE8, 0x30, 0xE7, 0x28, 0xE7, 0x28, 0xE8, 0x38, 0xE8, 0x38, 
-    0xE8, 0x38, 0x08, 0x41, 0x08, 0x51, 0x07, 0x51, 0x08, 0x51, 0x48, 0x51, 0x48, 0x51, 0x48, 0x51, 
-    0x67, 0x51, 0xE5, 0x51, 0xE5, 0x51, 0xE5, 0x51, 0xA5, 0x49, 0x85, 0x41, 0x85, 0x41, 0x65, 0x41, 
-    0x45, 0x31, 0x45, 0x31, 0x25, 0x31, 0x47, 0x21, 0x69, 0x11, 0x68, 0x11, 0x48, 0x21, 0xE8, 0x58, 
-    0x08, 0x59, 0xE8, 0x58, 0x8B, 0x49, 0xED, 0x39, 0xCD, 0x39, 0xCC, 0x39, 0xAB, 0x61, 0x8B, 0x61, 
-    0xAB, 0x61, 0x49, 0x59, 0x65, 0x48, 0x85, 0x48, 0x85, 0x50, 0x21, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x28, 0x21, 0x59, 0x01, 0x51, 0x02, 0x51, 0xA7, 0x48, 0xA7, 0x48, 0x87, 0x50, 
-    0xE8, 0x30, 0x68, 0x09, 0x48, 0x11, 0x48, 0x11, 0xC8, 0x40, 0xA8, 0x50, 0xA8, 0x48, 0xA8, 0x50, 
-    0xA9, 0x58, 0xA9, 0x58, 0xA9, 0x60, 0x08, 0x29, 0x27, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 
-    0x27, 0x11, 0x07, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x28, 0x11, 
-    0x27, 0x11, 0x28, 0x11, 0x28, 0x11, 0x27, 0x11, 0x27, 0x11, 0x88, 0x09, 0x89, 0x09, 0x89, 0x09, 
-    0x68, 0x09, 0x48, 0x09, 0x48, 0x09, 0x48, 0x09, 0x48, 0x11, 0x48, 0x11, 0x28, 0x11, 0x48, 0x11, 
-    0x68, 0x11, 0x68, 0x11, 0x48, 0x11, 0xA9, 0x19, 0xCA, 0x19, 0xCA, 0x11, 0x89, 0x29, 0xE9, 0x90, 
-    0xE9, 0x90, 0xC9, 0x98, 0xEC, 0x49, 0xEE, 0x0A, 0xCD, 0x12, 0xAD, 0x1A, 0xEA, 0x88, 0xA9, 0x98, 
-    0xEA, 0xA0, 0xA6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x30, 0x22, 0x59, 0x01, 0x51, 0x02, 0x51, 0xA7, 0x48, 0xA7, 0x48, 0xA7, 0x48, 
-    0xE8, 0x30, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0xC8, 0x40, 0xA8, 0x48, 0xA8, 0x48, 0xA8, 0x48, 
-    0xA9, 0x58, 0xA9, 0x58, 0xA9, 0x58, 0x08, 0x29, 0x27, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 
-    0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x27, 0x19, 0x27, 0x19, 
-    0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x68, 0x11, 0x88, 0x11, 0x88, 0x11, 
-    0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x11, 
-    0x67, 0x11, 0x47, 0x11, 0x47, 0x11, 0xA9, 0x11, 0xC9, 0x19, 0xC9, 0x11, 0x89, 0x29, 0xE9, 0x88, 
-    0xE9, 0x88, 0xC9, 0x90, 0xCB, 0x49, 0xCE, 0x12, 0x8D, 0x1A, 0x8D, 0x1A, 0x2A, 0x81, 0xE9, 0x90, 
-    0x0A, 0x99, 0xA6, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x28, 0x22, 0x59, 0x02, 0x51, 0x02, 0x49, 0xA7, 0x40, 0xA7, 0x40, 0xA7, 0x40, 
-    0xE7, 0x30, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0xC8, 0x40, 0xA8, 0x48, 0xA8, 0x40, 0xC8, 0x48, 
-    0xC9, 0x58, 0xC9, 0x50, 0xC9, 0x58, 0x08, 0x29, 0x07, 0x11, 0x07, 0x19, 0x27, 0x19, 0x27, 0x11, 
-    0x47, 0x11, 0x47, 0x11, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x07, 0x19, 0x48, 0x19, 0x48, 0x19, 
-    0x48, 0x19, 0x28, 0x19, 0x08, 0x21, 0x28, 0x21, 0x08, 0x19, 0x68, 0x19, 0x68, 0x21, 0x68, 0x21, 
-    0x68, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x48, 0x19, 0x28, 0x19, 0x28, 0x19, 0x27, 0x19, 
-    0x47, 0x21, 0x47, 0x21, 0x27, 0x21, 0x89, 0x21, 0xAA, 0x19, 0xA9, 0x19, 0x89, 0x29, 0x09, 0x81, 
-    0x09, 0x81, 0xE9, 0x88, 0xCB, 0x49, 0xAD, 0x12, 0x8C, 0x1A, 0x8C, 0x1A, 0x2A, 0x81, 0xE9, 0x88, 
-    0x0A, 0x91, 0xA6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 
-    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x64, 0x20, 0xC8, 0x48, 0xA7, 0x40, 0xA8, 0x40, 0x28, 0x21, 0x48, 0x19, 0x28, 0x19, 0x48, 0x19, 
-    0x8A, 0x19, 0x69, 0x19, 0x89, 0x19, 0x0A, 0x41, 0xCA, 0x58, 0xCA, 0x50, 0x2A, 0x49, 0x8A, 0x1A, 
-    0x6A, 0x1A, 0x8A, 0x12, 0x6A, 0x41, 0xAA, 0x60, 0xCA, 0x58, 0xEA, 0x50, 0x2A, 0x22, 0x4B, 0x1A, 
-    0x4B, 0x1A, 0x8A, 0x41, 0xAA, 0x70, 0xCA, 0x68, 0xCA, 0x68, 0x09, 0x81, 0x28, 0x89, 0xE8, 0x88, 
-    0x69, 0x69, 0x8B, 0x1A, 0x6A, 0x22, 0x8B, 0x1A, 0x4B, 0x51, 0xAA, 0x60, 0xCA, 0x58, 0xEA, 0x60, 
-    0x08, 0x81, 0x08, 0x81, 0x08, 0x89, 0xE9, 0x68, 0xC9, 0x50, 0xC9, 0x58, 0x09, 0x51, 0x4B, 0x22, 
-    0x2A, 0x22, 0x4B, 0x22, 0x66, 0x31, 0xC2, 0x38, 0xE3, 0x38, 0x24, 0x39, 0x62, 0x18, 0x00, 0x08, 
-    0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x80, 0x18, 0xC2, 0x69, 0x81, 0x61, 0x81, 0x61, 0xE1, 0x71, 0x01, 0x72, 0x02, 0x72, 0x01, 0x72, 
-    0x02, 0x72, 0x02, 0x72, 0x42, 0x7A, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x43, 0x18, 0xA8, 0x48, 0xA7, 0x40, 0xA7, 0x40, 0x28, 0x19, 0x48, 0x11, 0x28, 0x11, 0x48, 0x11, 
-    0xA9, 0x11, 0x89, 0x19, 0xA9, 0x11, 0x0A, 0x49, 0xCA, 0x58, 0xCA, 0x58, 0x2A, 0x49, 0x8A, 0x1A, 
-    0x6A, 0x1A, 0xAA, 0x1A, 0x6A, 0x49, 0xAA, 0x60, 0xCA, 0x60, 0xEA, 0x58, 0x2B, 0x22, 0x4B, 0x22, 
-    0x6B, 0x1A, 0x8A, 0x41, 0xAA, 0x70, 0xCA, 0x68, 0xCA, 0x68, 0xE9, 0x80, 0x08, 0x89, 0xE8, 0x90, 
-    0x69, 0x71, 0xAB, 0x1A, 0x6B, 0x22, 0xAB, 0x22, 0x4B, 0x59, 0xAA, 0x68, 0xCA, 0x60, 0xC9, 0x68, 
-    0x07, 0x89, 0x08, 0x89, 0x07, 0x89, 0xC9, 0x68, 0xC9, 0x58, 0xA9, 0x60, 0x09, 0x51, 0x6A, 0x1A, 
-    0x2A, 0x1A, 0x4B, 0x1A, 0x45, 0x29, 0x81, 0x38, 0xA2, 0x38, 0xE3, 0x38, 0x41, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x80, 0x20, 0xC2, 0x71, 0xA1, 0x69, 0xA1, 0x69, 0x01, 0x7A, 0x22, 0x7A, 0x22, 0x7A, 0x42, 0x7A, 
-    0x22, 0x7A, 0x22, 0x7A, 0x62, 0x82, 0x21, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x63, 0x20, 0xC8, 0x50, 0xC8, 0x48, 0xC8, 0x48, 0x28, 0x19, 0x48, 0x11, 0x48, 0x11, 0x69, 0x11, 
-    0xAA, 0x11, 0xAA, 0x11, 0xAA, 0x11, 0x0A, 0x49, 0xCA, 0x58, 0xCA, 0x58, 0x2A, 0x49, 0xAB, 0x1A, 
-    0x8B, 0x1A, 0xCB, 0x12, 0x6B, 0x49, 0xAA, 0x60, 0xCA, 0x60, 0xEA, 0x58, 0x4B, 0x1A, 0x6B, 0x1A, 
-    0x8B, 0x12, 0xAB, 0x41, 0xAA, 0x78, 0xCA, 0x70, 0xCB, 0x70, 0xE9, 0x88, 0x09, 0x91, 0xE9, 0x90, 
-    0x69, 0x71, 0xCB, 0x12, 0x8B, 0x1A, 0xAB, 0x1A, 0x4C, 0x59, 0xAB, 0x68, 0xCB, 0x60, 0xCA, 0x68, 
-    0x08, 0x91, 0x08, 0x89, 0x08, 0x91, 0xC9, 0x70, 0xCA, 0x58, 0xA9, 0x60, 0x2A, 0x51, 0x6B, 0x1A, 
-    0x4B, 0x1A, 0x6C, 0x1A, 0x66, 0x29, 0xA2, 0x38, 0xC2, 0x38, 0x03, 0x39, 0x41, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x18, 0xC1, 0x71, 0xA1, 0x69, 0xA1, 0x69, 0x01, 0x72, 0x22, 0x7A, 0x22, 0x7A, 0x22, 0x7A, 
-    0x22, 0x7A, 0x21, 0x7A, 0x42, 0x82, 0x21, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x21, 0x10, 0x64, 0x28, 0x64, 0x20, 0x64, 0x28, 0x25, 0x31, 0x05, 0x29, 0x05, 0x29, 0x25, 0x29, 
-    0x66, 0x29, 0x66, 0x29, 0x67, 0x29, 0x07, 0x49, 0xE6, 0x50, 0xE6, 0x50, 0x26, 0x49, 0xE7, 0x31, 
-    0xC6, 0x31, 0xE6, 0x31, 0x26, 0x49, 0xC6, 0x58, 0xE6, 0x50, 0xE6, 0x50, 0xA7, 0x31, 0xA7, 0x31, 
-    0xC7, 0x29, 0x47, 0x41, 0xC7, 0x60, 0xE7, 0x58, 0xC7, 0x58, 0xE6, 0x68, 0x06, 0x69, 0xE5, 0x68, 
-    0x46, 0x59, 0x07, 0x3A, 0xE6, 0x41, 0x07, 0x3A, 0x47, 0x51, 0xE6, 0x58, 0xE6, 0x58, 0x06, 0x59, 
-    0xE5, 0x60, 0xE5, 0x60, 0xE5, 0x60, 0xC6, 0x50, 0xC6, 0x48, 0xC6, 0x48, 0x06, 0x41, 0xC7, 0x31, 
-    0xA7, 0x31, 0xC7, 0x31, 0x24, 0x29, 0x81, 0x28, 0xA2, 0x20, 0xA2, 0x20, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x28, 0xE1, 0x38, 0xC1, 0x30, 
-    0x01, 0x41, 0x82, 0x61, 0x61, 0x61, 0x61, 0x59, 0xC1, 0x69, 0x02, 0x72, 0xE1, 0x71, 0x02, 0x72, 
-    0x22, 0x7A, 0x21, 0x7A, 0x62, 0x82, 0x21, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x40, 0xC1, 0x48, 0xC1, 0x40, 0xC1, 0x48, 
-    0xE2, 0x48, 0xE1, 0x48, 0xE1, 0x48, 0xE1, 0x48, 0x01, 0x49, 0x01, 0x49, 0xE1, 0x48, 0xE1, 0x50, 
-    0xE1, 0x50, 0xE1, 0x48, 0xE1, 0x48, 0x01, 0x49, 0x01, 0x49, 0x01, 0x49, 0xE1, 0x48, 0xC1, 0x48, 
-    0xC1, 0x48, 0xE1, 0x48, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x38, 0xE2, 0x38, 0xE2, 0x38, 
-    0x01, 0x49, 0x21, 0x61, 0x41, 0x61, 0x41, 0x69, 0x21, 0x51, 0x21, 0x49, 0x21, 0x51, 0x01, 0x49, 
-    0xE2, 0x38, 0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x30, 0xC1, 0x38, 0xE1, 0x50, 
-    0xE1, 0x50, 0x01, 0x59, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x51, 0xC2, 0x71, 0xA2, 0x69, 
-    0x81, 0x61, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0xA1, 0x61, 0xC1, 0x71, 0xC1, 0x69, 0xC1, 0x71, 
-    0x22, 0x7A, 0x01, 0x72, 0x62, 0x82, 0x41, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x38, 0xC2, 0x40, 0xC2, 0x40, 0xE2, 0x40, 
-    0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x40, 
-    0xE2, 0x40, 0xE2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 
-    0xE2, 0x48, 0x42, 0x61, 0x42, 0x61, 0x62, 0x61, 0x22, 0x51, 0x02, 0x51, 0x22, 0x51, 0x02, 0x49, 
-    0xC2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x38, 0x02, 0x51, 
-    0x02, 0x49, 0x22, 0x51, 0x81, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x49, 0x81, 0x69, 0x61, 0x61, 
-    0x61, 0x59, 0x21, 0x51, 0x21, 0x59, 0x21, 0x51, 0xA1, 0x69, 0xE1, 0x71, 0xC1, 0x71, 0xC1, 0x71, 
-    0x22, 0x7A, 0x21, 0x7A, 0x62, 0x82, 0x21, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x39, 0x03, 0x41, 0xE3, 0x40, 0xE2, 0x40, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 
-    0x23, 0x49, 0x43, 0x51, 0x43, 0x49, 0x43, 0x49, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 0x23, 0x49, 
-    0x43, 0x51, 0x42, 0x61, 0x62, 0x61, 0x62, 0x69, 0x42, 0x59, 0x22, 0x51, 0x22, 0x51, 0x22, 0x49, 
-    0x23, 0x41, 0x23, 0x41, 0x23, 0x41, 0x23, 0x41, 0x23, 0x41, 0x23, 0x39, 0x03, 0x41, 0x02, 0x51, 
-    0x01, 0x51, 0x22, 0x59, 0x81, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x49, 0x81, 0x69, 0x61, 0x61, 
-    0x61, 0x59, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x81, 0x61, 0xC1, 0x69, 0xA1, 0x69, 0xC1, 0x69, 
-    0x22, 0x7A, 0x01, 0x72, 0x42, 0x82, 0x21, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x00, 0xA2, 0x20, 
-    0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0x22, 0x51, 0xC2, 0x79, 
-    0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0x81, 0x71, 0xA6, 0x82, 
-    0x10, 0xB5, 0x10, 0xB5, 0x10, 0xB5, 0x10, 0xAD, 0xEF, 0xAC, 0xEF, 0xAC, 0xEF, 0xAC, 0x51, 0xB5, 
-    0x2C, 0xA4, 0x81, 0x71, 0xC2, 0x79, 0xA2, 0x79, 0x82, 0x71, 0xA2, 0x69, 0x81, 0x69, 0x45, 0x7A, 
-    0x10, 0xB5, 0xEF, 0xAC, 0xEF, 0xAC, 0x10, 0xAD, 0xEF, 0xAC, 0x10, 0xAD, 0x4D, 0xA4, 0x81, 0x69, 
-    0x81, 0x69, 0xA2, 0x79, 0xC1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x38, 0x22, 0x51, 0x21, 0x51, 
-    0x21, 0x51, 0x21, 0x59, 0x21, 0x51, 0x21, 0x51, 0x41, 0x59, 0x41, 0x59, 0x41, 0x59, 0x61, 0x59, 
-    0xC2, 0x69, 0xC1, 0x69, 0xE2, 0x79, 0x01, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 
-    0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x48, 0x22, 0x51, 0xE2, 0x79, 
-    0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xE2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xAE, 0xAC, 
-    0x71, 0xB5, 0x50, 0xB5, 0x51, 0xB5, 0x30, 0xB5, 0x30, 0xB5, 0x30, 0xB5, 0x30, 0xB5, 0x71, 0xBD, 
-    0x4D, 0xA4, 0x81, 0x71, 0xC2, 0x79, 0xA2, 0x79, 0xA2, 0x71, 0xA2, 0x71, 0x61, 0x69, 0x08, 0x8B, 
-    0x71, 0xBD, 0x10, 0xB5, 0x30, 0xB5, 0x30, 0xB5, 0x50, 0xB5, 0x71, 0xBD, 0x8E, 0xAC, 0x81, 0x71, 
-    0x81, 0x69, 0xA2, 0x79, 0xE1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x38, 0x21, 0x51, 0x01, 0x49, 
-    0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x59, 0x41, 0x59, 0x41, 0x59, 0x41, 0x59, 
-    0xC1, 0x69, 0xC1, 0x69, 0xE2, 0x79, 0x01, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 
-    0x02, 0x49, 0xC2, 0x40, 0xE2, 0x40, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x22, 0x51, 0xC2, 0x79, 
-    0xA2, 0x71, 0xA2, 0x71, 0xC2, 0x71, 0xC2, 0x79, 0xC2, 0x79, 0x81, 0x71, 0x07, 0x8B, 0x50, 0xB5, 
-    0x0F, 0xAD, 0x0F, 0xAD, 0x30, 0xB5, 0x91, 0xC5, 0x91, 0xBD, 0x91, 0xC5, 0xB2, 0xC5, 0xF3, 0xC5, 
-    0x8E, 0xAC, 0x61, 0x71, 0xA2, 0x71, 0x82, 0x71, 0x82, 0x69, 0x82, 0x69, 0x20, 0x61, 0xEB, 0x9B, 
-    0xF3, 0xCD, 0x91, 0xC5, 0xB2, 0xC5, 0x71, 0xBD, 0x10, 0xB5, 0x50, 0xB5, 0x6D, 0xA4, 0x81, 0x69, 
-    0x61, 0x69, 0xA2, 0x71, 0xC1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x41, 0x42, 0x59, 0x42, 0x59, 
-    0x42, 0x59, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x41, 0x59, 
-    0xC1, 0x69, 0xA1, 0x69, 0xE2, 0x71, 0x01, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x21, 0x41, 0x21, 0x39, 0x82, 0x51, 
-    0x82, 0x61, 0x82, 0x61, 0xA2, 0x69, 0x22, 0x51, 0x02, 0x51, 0x02, 0x49, 0x42, 0x59, 0x22, 0x82, 
-    0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x22, 0x82, 0x43, 0x8A, 0x92, 0xC5, 0xF3, 0xC5, 
-    0xD3, 0xC5, 0x14, 0xCE, 0x11, 0xAD, 0xE9, 0x62, 0x0A, 0x6B, 0xE9, 0x62, 0xA8, 0x5A, 0xEA, 0x62, 
-    0xC8, 0x72, 0x22, 0x8A, 0x22, 0x82, 0x22, 0x8A, 0x42, 0x82, 0x42, 0x82, 0x22, 0x82, 0xE8, 0x72, 
-    0x4B, 0x6B, 0x0A, 0x6B, 0xA9, 0x5A, 0x4E, 0x94, 0x14, 0xCE, 0x14, 0xCE, 0x30, 0xBD, 0xA1, 0x79, 
-    0xC2, 0x71, 0x02, 0x82, 0x01, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0xC1, 0x28, 0xC1, 0x28, 
-    0xE2, 0x38, 0x42, 0x59, 0x21, 0x51, 0x21, 0x51, 0x61, 0x59, 0x81, 0x61, 0x61, 0x61, 0x81, 0x61, 
-    0xC1, 0x71, 0xA1, 0x69, 0xE2, 0x79, 0x01, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7A, 0x82, 0x92, 0x82, 0x92, 0x62, 0x8A, 
-    0x62, 0x8A, 0x62, 0x8A, 0x82, 0x92, 0x82, 0x61, 0x02, 0x51, 0x02, 0x51, 0x62, 0x61, 0xC3, 0x9A, 
-    0xC3, 0x92, 0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 0xA2, 0x92, 0x05, 0x9B, 0xD7, 0xE6, 0x18, 0xE7, 
-    0xD8, 0xDE, 0x59, 0xEF, 0x11, 0xA5, 0x00, 0x00, 0x41, 0x08, 0x83, 0x10, 0xE7, 0x41, 0xC4, 0x18, 
-    0xE1, 0x30, 0x43, 0xAB, 0x03, 0xA3, 0x03, 0xA3, 0x23, 0xAB, 0x23, 0xA3, 0x63, 0xB3, 0x22, 0x39, 
-    0x01, 0x00, 0x65, 0x31, 0x86, 0x31, 0x2B, 0x6B, 0x7A, 0xF7, 0x18, 0xE7, 0x14, 0xD6, 0x02, 0x82, 
-    0x22, 0x82, 0x62, 0x92, 0x41, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x18, 0x42, 0x59, 0x21, 0x51, 0x21, 0x51, 0x81, 0x69, 0xC1, 0x71, 0xC2, 0x71, 0xC2, 0x71, 
-    0xC1, 0x71, 0xA1, 0x69, 0xE2, 0x79, 0x01, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x62, 0x8A, 0x42, 0x82, 0x42, 0x82, 
-    0x42, 0x8A, 0x62, 0x8A, 0x62, 0x8A, 0x62, 0x61, 0x02, 0x51, 0x02, 0x51, 0x62, 0x61, 0xC3, 0x9A, 
-    0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x92, 0xA3, 0x92, 0x05, 0x9B, 0x96, 0xDE, 0xF8, 0xE6, 
-    0xB7, 0xDE, 0x38, 0xEF, 0x11, 0xA5, 0x62, 0x10, 0x62, 0x08, 0x48, 0x4A, 0xFD, 0xFF, 0x0F, 0x84, 
-    0xC1, 0x28, 0x43, 0xAB, 0xE3, 0x9A, 0xE3, 0xA2, 0x03, 0xA3, 0x03, 0xA3, 0x43, 0xAB, 0x63, 0x41, 
-    0x01, 0x00, 0x90, 0x94, 0x39, 0xEF, 0xAD, 0x73, 0x18, 0xEF, 0xF8, 0xE6, 0xF4, 0xCD, 0x02, 0x82, 
-    0x22, 0x82, 0x62, 0x92, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x18, 0x42, 0x59, 0x21, 0x51, 0x21, 0x51, 0x81, 0x61, 0xC2, 0x69, 0xA1, 0x69, 0xC1, 0x69, 
-    0xC1, 0x69, 0xA1, 0x69, 0xE2, 0x79, 0x01, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7A, 0x82, 0x8A, 0x62, 0x8A, 0x62, 0x8A, 
-    0x62, 0x8A, 0x62, 0x8A, 0x62, 0x8A, 0x62, 0x61, 0x22, 0x51, 0x02, 0x51, 0x82, 0x61, 0xE3, 0x9A, 
-    0xC3, 0x92, 0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 0xA3, 0x92, 0x05, 0x9B, 0xB7, 0xDE, 0xF8, 0xE6, 
-    0xD7, 0xDE, 0x39, 0xEF, 0x12, 0xA5, 0x42, 0x08, 0x62, 0x08, 0xC7, 0x39, 0x15, 0xCE, 0x0B, 0x63, 
-    0xE1, 0x30, 0x23, 0xAB, 0xE3, 0x9A, 0xE3, 0xA2, 0x03, 0xA3, 0x23, 0xA3, 0x43, 0xAB, 0x63, 0x41, 
-    0x21, 0x00, 0x2B, 0x6B, 0xD1, 0x9C, 0x6C, 0x73, 0x38, 0xEF, 0xD8, 0xDE, 0xF4, 0xCD, 0x22, 0x82, 
-    0x22, 0x82, 0x62, 0x92, 0x62, 0x51, 0x40, 0x08, 0x40, 0x10, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x61, 0x18, 0x22, 0x59, 0x01, 0x51, 0x21, 0x51, 0x62, 0x61, 0xA2, 0x69, 0xA2, 0x69, 0x81, 0x69, 
-    0x81, 0x69, 0x81, 0x61, 0xC2, 0x71, 0xE1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7A, 0x82, 0x92, 0x62, 0x8A, 0x42, 0x82, 
-    0xC2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0x42, 0x59, 0x22, 0x51, 0x22, 0x51, 0x82, 0x61, 0xE3, 0x9A, 
-    0xC3, 0x9A, 0xC3, 0x9A, 0xE3, 0x9A, 0xE3, 0x9A, 0xA3, 0x92, 0x05, 0x9B, 0xD7, 0xDE, 0xF8, 0xE6, 
-    0xB7, 0xDE, 0x39, 0xEF, 0xF1, 0xA4, 0x41, 0x08, 0xA3, 0x18, 0x82, 0x10, 0x62, 0x10, 0x62, 0x08, 
-    0x43, 0x39, 0x23, 0xA3, 0xE3, 0x9A, 0xE3, 0x9A, 0x64, 0xAB, 0xA5, 0xB3, 0xA5, 0xB3, 0x24, 0x9B, 
-    0xC3, 0x18, 0x82, 0x10, 0x00, 0x00, 0x2B, 0x63, 0x18, 0xE7, 0xD7, 0xDE, 0x14, 0xCE, 0x82, 0x92, 
-    0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x92, 0xA3, 0x92, 0xA3, 0x92, 0xC3, 0x9A, 0xA1, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x18, 0x02, 0x51, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 
-    0xE2, 0x48, 0xE2, 0x48, 0x02, 0x51, 0xA1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x7A, 0x62, 0x8A, 0x62, 0x8A, 0x22, 0x82, 
-    0xA1, 0x69, 0xC2, 0x71, 0xC2, 0x71, 0x42, 0x59, 0x22, 0x51, 0x22, 0x51, 0x82, 0x61, 0xE3, 0x9A, 
-    0xC3, 0x9A, 0xE3, 0x9A, 0xC3, 0x92, 0xC3, 0x92, 0xC3, 0x9A, 0xA3, 0x92, 0xCD, 0xBC, 0x19, 0xE7, 
-    0xB6, 0xDE, 0xF8, 0xE6, 0x32, 0xAD, 0x01, 0x00, 0x82, 0x10, 0xA3, 0x18, 0xA3, 0x18, 0x82, 0x10, 
-    0x23, 0x31, 0x23, 0xA3, 0xE3, 0x9A, 0xC3, 0x9A, 0x84, 0xAB, 0xC5, 0xB3, 0xC5, 0xB3, 0x64, 0xA3, 
-    0xC3, 0x20, 0xC3, 0x18, 0x41, 0x08, 0x2B, 0x6B, 0xF8, 0xE6, 0x96, 0xD6, 0xA8, 0xAB, 0xA2, 0x92, 
-    0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 0xE3, 0xA2, 0xC1, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x18, 0x02, 0x51, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x50, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x82, 0xA2, 0x9A, 0x82, 0x92, 0x42, 0x8A, 
-    0x81, 0x69, 0x81, 0x69, 0xA1, 0x69, 0x22, 0x59, 0x02, 0x51, 0xE2, 0x48, 0x62, 0x61, 0xE3, 0x9A, 
-    0xE3, 0x9A, 0xE3, 0x9A, 0x03, 0xA3, 0x03, 0xA3, 0x03, 0xA3, 0xE3, 0xA2, 0x62, 0x92, 0xEE, 0xBC, 
-    0x19, 0xE7, 0xD8, 0xDE, 0x39, 0xEF, 0x0E, 0x84, 0x42, 0x08, 0x62, 0x08, 0x83, 0x10, 0x42, 0x00, 
-    0xC3, 0x59, 0x24, 0xA3, 0x03, 0x9B, 0xE3, 0x9A, 0x64, 0xAB, 0xA5, 0xAB, 0xC5, 0xB3, 0x65, 0xA3, 
-    0x83, 0x10, 0x83, 0x08, 0x01, 0x00, 0x70, 0x8C, 0x7A, 0xEF, 0x6C, 0xB4, 0x61, 0x92, 0xE3, 0x9A, 
-    0xE3, 0x9A, 0xC3, 0x9A, 0xC3, 0x92, 0xC3, 0x92, 0xA3, 0x92, 0xE3, 0x9A, 0xC1, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x10, 0x02, 0x49, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x50, 0xE2, 0x50, 0xE2, 0x50, 
-    0xE2, 0x50, 0xE2, 0x50, 0x02, 0x51, 0xA2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x51, 0xA1, 0x61, 0xA1, 0x59, 0xE2, 0x69, 
-    0x42, 0x82, 0x22, 0x7A, 0x42, 0x82, 0xC2, 0x71, 0x82, 0x69, 0x82, 0x69, 0xE2, 0x71, 0x03, 0x9B, 
-    0xE3, 0x9A, 0x03, 0x9B, 0x83, 0x82, 0x23, 0x6A, 0x23, 0x6A, 0x23, 0x72, 0x04, 0x9B, 0xC3, 0x9A, 
-    0xCD, 0xBC, 0x70, 0xC5, 0x0F, 0xC5, 0x90, 0xCD, 0xA7, 0x72, 0x22, 0x41, 0x63, 0x41, 0x83, 0x51, 
-    0xE3, 0x9A, 0xE3, 0x9A, 0xA3, 0x92, 0x83, 0x92, 0xA3, 0x92, 0xA3, 0x92, 0xE3, 0x9A, 0xE4, 0x92, 
-    0xA3, 0x49, 0xA3, 0x49, 0xA3, 0x49, 0xEE, 0xB4, 0x0E, 0xC5, 0xE3, 0x9A, 0xE3, 0x9A, 0x63, 0x8A, 
-    0x83, 0x8A, 0x83, 0x8A, 0xA3, 0x92, 0xA3, 0x92, 0xA3, 0x92, 0xA3, 0x92, 0x81, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0xA3, 0x08, 0xA3, 0x08, 
-    0xC4, 0x20, 0xC4, 0x50, 0xC4, 0x48, 0xC4, 0x50, 0xE4, 0x38, 0xE4, 0x30, 0xE4, 0x30, 0xE3, 0x38, 
-    0xC2, 0x30, 0xA2, 0x30, 0xC2, 0x30, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x20, 
-    0xA4, 0xB3, 0x63, 0xA3, 0x83, 0xAB, 0xE3, 0xA2, 0xA2, 0x9A, 0xA3, 0x9A, 0xC3, 0x9A, 0x03, 0x9B, 
-    0xE3, 0x9A, 0x23, 0xA3, 0x43, 0x39, 0x42, 0x00, 0x62, 0x08, 0xC3, 0x20, 0x64, 0xA3, 0x64, 0xA3, 
-    0x43, 0xA3, 0xE3, 0x9A, 0x82, 0x92, 0x62, 0x92, 0xC3, 0x9A, 0xE3, 0x9A, 0xE3, 0x9A, 0xE3, 0x9A, 
-    0xA3, 0x92, 0xA3, 0x92, 0x22, 0x82, 0xE2, 0x79, 0x02, 0x7A, 0x02, 0x7A, 0xE2, 0x79, 0x22, 0x82, 
-    0x84, 0xAB, 0x84, 0xB3, 0xA4, 0xB3, 0x03, 0xA3, 0xE2, 0x9A, 0x44, 0xA3, 0xE3, 0x9A, 0xC2, 0x69, 
-    0xC2, 0x69, 0x42, 0x82, 0xA3, 0x92, 0x62, 0x8A, 0xA3, 0x9A, 0xC3, 0x59, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x19, 0xAA, 0x19, 0xA9, 0x11, 
-    0x49, 0x29, 0x87, 0x60, 0x87, 0x58, 0x87, 0x60, 0xE7, 0x20, 0x06, 0x09, 0xE6, 0x10, 0xE6, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x28, 
-    0x83, 0xAB, 0x23, 0x9B, 0x43, 0xA3, 0xA3, 0x9A, 0x82, 0x92, 0x83, 0x9A, 0xA3, 0x9A, 0x03, 0x9B, 
-    0xE3, 0x9A, 0x23, 0xA3, 0x63, 0x41, 0x82, 0x10, 0xA2, 0x18, 0x03, 0x29, 0x44, 0x9B, 0x44, 0xA3, 
-    0x65, 0xA3, 0x44, 0xA3, 0xE4, 0x9A, 0xC4, 0x9A, 0xC3, 0x92, 0xA3, 0x92, 0xA3, 0x92, 0xC3, 0x92, 
-    0xC3, 0x92, 0xA3, 0x92, 0x42, 0x82, 0x02, 0x7A, 0x22, 0x82, 0x22, 0x7A, 0x22, 0x7A, 0x42, 0x82, 
-    0x44, 0xA3, 0x64, 0xA3, 0x64, 0xA3, 0x44, 0xA3, 0x24, 0xA3, 0x24, 0xA3, 0xE3, 0x9A, 0xC2, 0x69, 
-    0x02, 0x7A, 0xC3, 0x92, 0x83, 0x92, 0x82, 0x92, 0x83, 0x8A, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x11, 0x69, 0x11, 0x68, 0x11, 
-    0x48, 0x21, 0x87, 0x58, 0xA7, 0x50, 0xA7, 0x58, 0xE6, 0x28, 0x06, 0x11, 0x06, 0x11, 0xE5, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 
-    0xC4, 0xBB, 0x83, 0xAB, 0xA4, 0xB3, 0xE3, 0xA2, 0x83, 0x9A, 0xA3, 0x9A, 0xC3, 0x9A, 0x03, 0x9B, 
-    0xE3, 0x9A, 0x23, 0xA3, 0x43, 0x39, 0x42, 0x00, 0x62, 0x08, 0xC3, 0x20, 0x64, 0xAB, 0x84, 0xAB, 
-    0xC5, 0xB3, 0x24, 0xA3, 0x62, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0xA2, 0x92, 0xA2, 0x92, 
-    0x82, 0x92, 0x82, 0x92, 0x22, 0x82, 0xE1, 0x79, 0x01, 0x7A, 0x01, 0x7A, 0xE1, 0x79, 0x22, 0x82, 
-    0x43, 0xA3, 0x43, 0xA3, 0x44, 0xA3, 0x64, 0xA3, 0x64, 0xAB, 0x64, 0xAB, 0xE3, 0x92, 0xC2, 0x69, 
-    0x83, 0x8A, 0xC3, 0x92, 0x82, 0x92, 0xC3, 0x9A, 0x82, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x09, 0x89, 0x11, 0x89, 0x09, 
-    0x49, 0x29, 0x67, 0x60, 0x87, 0x58, 0x87, 0x60, 0xE7, 0x20, 0x06, 0x09, 0x06, 0x11, 0x06, 0x11, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 
-    0x62, 0x41, 0x41, 0x39, 0x42, 0x39, 0xA2, 0x69, 0xA2, 0x79, 0x82, 0x71, 0xE2, 0x79, 0x23, 0x9B, 
-    0xE3, 0x9A, 0x03, 0x9B, 0x43, 0x7A, 0xE3, 0x69, 0x03, 0x6A, 0x03, 0x6A, 0x63, 0x41, 0x83, 0x41, 
-    0x43, 0x39, 0x28, 0x7B, 0xCD, 0xB4, 0x6C, 0xAC, 0x6C, 0xAC, 0x4B, 0xA4, 0x2B, 0xA4, 0x2B, 0xA4, 
-    0x0B, 0x9C, 0x0A, 0x9C, 0xEA, 0x9B, 0xCA, 0x93, 0xCA, 0x9B, 0xEA, 0x9B, 0xEB, 0x9B, 0x2B, 0xA4, 
-    0xAD, 0xAC, 0x8C, 0xAC, 0xED, 0xB4, 0x46, 0x5A, 0x02, 0x31, 0x23, 0x31, 0x23, 0x72, 0xA3, 0x92, 
-    0xA3, 0x92, 0xA3, 0x92, 0xA2, 0x92, 0x83, 0x8A, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x42, 0x18, 0x87, 0x38, 0x86, 0x38, 0x86, 0x38, 0xE8, 0x50, 0xE8, 0x50, 0xC7, 0x58, 
-    0x28, 0x49, 0xEA, 0x29, 0xC9, 0x29, 0xE9, 0x29, 0x28, 0x51, 0xC7, 0x60, 0xC8, 0x60, 0xC7, 0x50, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x40, 0x01, 0x61, 0xE1, 0x58, 0x62, 0x69, 0x03, 0x9B, 
-    0xE3, 0x9A, 0xE3, 0x9A, 0xE3, 0x9A, 0x03, 0xA3, 0x03, 0xA3, 0xC3, 0x92, 0x82, 0x10, 0x83, 0x10, 
-    0x01, 0x00, 0x2B, 0x6B, 0xF3, 0xC5, 0x71, 0xB5, 0x71, 0xB5, 0x30, 0xAD, 0xEF, 0xAC, 0xCF, 0xA4, 
-    0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xAE, 0xA4, 0xCE, 0xA4, 0xCE, 0xA4, 0xCF, 0xAC, 0x0F, 0xAD, 
-    0x30, 0xAD, 0x10, 0xAD, 0x71, 0xBD, 0xE6, 0x41, 0x22, 0x00, 0xE3, 0x20, 0xA3, 0x92, 0xA3, 0x9A, 
-    0xA3, 0x92, 0xA2, 0x92, 0xE3, 0xA2, 0x42, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x64, 0x20, 0xC9, 0x50, 0xA8, 0x50, 0xC9, 0x48, 0xA7, 0x68, 0xA7, 0x70, 0x87, 0x70, 
-    0x28, 0x51, 0x6A, 0x12, 0x4A, 0x1A, 0x6A, 0x12, 0x28, 0x59, 0xA8, 0x78, 0xA8, 0x78, 0xA7, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0x42, 0x71, 0x01, 0x61, 0xA2, 0x71, 0x23, 0x9B, 
-    0xE3, 0x9A, 0xE3, 0x9A, 0xC3, 0x92, 0xC3, 0x92, 0xE3, 0x9A, 0xA3, 0x8A, 0xA2, 0x18, 0xA3, 0x10, 
-    0x21, 0x08, 0x4A, 0x73, 0xD2, 0xCD, 0x71, 0xBD, 0x71, 0xBD, 0x30, 0xB5, 0xEF, 0xAC, 0xEE, 0xAC, 
-    0xCE, 0xA4, 0xCE, 0xAC, 0xCE, 0xAC, 0xCE, 0xAC, 0xCE, 0xAC, 0xCE, 0xAC, 0xEF, 0xAC, 0x30, 0xB5, 
-    0x30, 0xB5, 0x30, 0xB5, 0x71, 0xBD, 0xE6, 0x41, 0x22, 0x00, 0x03, 0x6A, 0xC3, 0x9A, 0xA3, 0x92, 
-    0xA3, 0x92, 0xC3, 0x9A, 0x43, 0x82, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x43, 0x20, 0xA8, 0x50, 0x87, 0x48, 0x88, 0x48, 0xA7, 0x60, 0xA7, 0x70, 0x87, 0x70, 
-    0x28, 0x59, 0x6B, 0x12, 0x4A, 0x1A, 0x6A, 0x12, 0x29, 0x59, 0xA8, 0x78, 0xC9, 0x78, 0xA7, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x40, 0x22, 0x59, 0x02, 0x51, 0x82, 0x61, 0xC3, 0x92, 
-    0x83, 0x8A, 0x83, 0x8A, 0xA3, 0x92, 0xE3, 0x9A, 0xC3, 0x9A, 0xA3, 0x92, 0xE2, 0x28, 0xE3, 0x28, 
-    0x82, 0x18, 0xA9, 0x5A, 0xCF, 0xA4, 0x6E, 0x9C, 0x6E, 0x9C, 0x4D, 0x94, 0x2D, 0x94, 0x0C, 0x8C, 
-    0xEC, 0x8B, 0xEC, 0x8B, 0xEC, 0x8B, 0xEC, 0x8B, 0xEC, 0x8B, 0x0C, 0x8C, 0x2D, 0x94, 0x4D, 0x94, 
-    0x4D, 0x94, 0x2D, 0x94, 0x6D, 0x94, 0xE5, 0x49, 0x02, 0x39, 0xA3, 0x92, 0x83, 0x92, 0xA3, 0x92, 
-    0x82, 0x92, 0xE3, 0xA2, 0x42, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x10, 0x42, 0x10, 
-    0x42, 0x10, 0xA5, 0x28, 0x29, 0x41, 0x09, 0x39, 0x09, 0x39, 0xE8, 0x48, 0xE8, 0x50, 0xE8, 0x50, 
-    0x28, 0x49, 0xC9, 0x39, 0xA9, 0x39, 0xC9, 0x39, 0xE6, 0x48, 0x85, 0x48, 0x86, 0x48, 0x85, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x18, 0x42, 0x61, 
-    0x21, 0x59, 0x22, 0x59, 0xC2, 0x79, 0xA3, 0x92, 0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 0xC3, 0x9A, 
-    0xC3, 0x92, 0xE2, 0x28, 0x62, 0x08, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 
-    0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 0x82, 0x10, 
-    0x82, 0x10, 0x62, 0x08, 0xE2, 0x28, 0x82, 0x92, 0xA3, 0x92, 0x83, 0x92, 0x82, 0x92, 0x83, 0x92, 
-    0xA2, 0x9A, 0xE3, 0x79, 0x82, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xC7, 0x40, 0xC7, 0x40, 
-    0xA7, 0x40, 0x49, 0x31, 0x4C, 0x12, 0x0C, 0x12, 0x2C, 0x12, 0xA9, 0x11, 0x88, 0x11, 0xA9, 0x09, 
-    0x68, 0x31, 0xA7, 0x88, 0xA7, 0x78, 0xC7, 0x88, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x18, 0x62, 0x61, 
-    0x21, 0x59, 0x22, 0x59, 0xC2, 0x71, 0x02, 0x82, 0xA3, 0x92, 0xC3, 0x9A, 0xA3, 0x92, 0xA3, 0x92, 
-    0xC3, 0x9A, 0x83, 0x8A, 0xA2, 0x18, 0x82, 0x10, 0xA3, 0x18, 0xA3, 0x10, 0xA3, 0x10, 0xA3, 0x18, 
-    0xA3, 0x18, 0xA3, 0x18, 0xA3, 0x18, 0xA3, 0x18, 0xA3, 0x18, 0xA3, 0x18, 0xA3, 0x18, 0xA3, 0x18, 
-    0x83, 0x10, 0xA3, 0x18, 0x63, 0x82, 0xA3, 0x92, 0x62, 0x8A, 0x62, 0x92, 0x62, 0x92, 0xA3, 0x9A, 
-    0xE2, 0x71, 0xE3, 0x50, 0xA2, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x38, 0xA6, 0x38, 
-    0x86, 0x38, 0x28, 0x29, 0x2C, 0x12, 0x0B, 0x1A, 0x0C, 0x1A, 0x89, 0x19, 0x68, 0x19, 0x88, 0x11, 
-    0x48, 0x31, 0xA7, 0x78, 0xC7, 0x70, 0xC7, 0x78, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0x62, 0x61, 
-    0x41, 0x59, 0x21, 0x59, 0xC2, 0x79, 0x22, 0x8A, 0x22, 0x82, 0xA3, 0x92, 0xC3, 0x9A, 0xC3, 0x92, 
-    0xA3, 0x92, 0xE3, 0xA2, 0x43, 0x7A, 0x82, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 
-    0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 
-    0x63, 0x08, 0xC3, 0x61, 0xA3, 0x9A, 0x83, 0x92, 0x83, 0x92, 0x82, 0x92, 0xA2, 0x92, 0xC2, 0x71, 
-    0xA2, 0x40, 0xE3, 0x50, 0x82, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x40, 0x86, 0x40, 
-    0x66, 0x40, 0x49, 0x29, 0x4C, 0x0A, 0x0C, 0x12, 0x2C, 0x12, 0xA9, 0x11, 0x88, 0x11, 0xA9, 0x09, 
-    0x68, 0x31, 0xC7, 0x88, 0xE7, 0x80, 0xE8, 0x88, 0x42, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x38, 0xC1, 0x50, 0xC1, 0x50, 0xE2, 0x58, 0xE3, 0x60, 
-    0xE2, 0x60, 0xE3, 0x68, 0x02, 0x51, 0x22, 0x49, 0x02, 0x49, 0x22, 0x51, 0xE2, 0x81, 0xE2, 0x81, 
-    0xE2, 0x81, 0x22, 0x82, 0xA3, 0x92, 0x23, 0x7A, 0x03, 0x72, 0x23, 0x72, 0x03, 0x72, 0x03, 0x72, 
-    0x02, 0x72, 0x03, 0x72, 0x03, 0x72, 0x03, 0x72, 0x03, 0x72, 0x03, 0x72, 0x03, 0x72, 0x02, 0x72, 
-    0x22, 0x7A, 0x83, 0x92, 0x83, 0x8A, 0xC2, 0x81, 0x62, 0x79, 0x82, 0x79, 0x63, 0x79, 0xC6, 0x58, 
-    0xC6, 0x58, 0xA6, 0x60, 0x07, 0x31, 0x27, 0x11, 0x26, 0x11, 0x47, 0x11, 0xAA, 0x21, 0xAA, 0x21, 
-    0xCB, 0x19, 0x89, 0x39, 0x47, 0x71, 0x47, 0x69, 0x47, 0x69, 0xE8, 0x50, 0xC8, 0x40, 0xE9, 0x48, 
-    0xC7, 0x40, 0x42, 0x20, 0x22, 0x20, 0x42, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x60, 0x22, 0x81, 0x22, 0x79, 0x02, 0x79, 0xA3, 0x68, 
-    0xA3, 0x68, 0xA3, 0x68, 0xC2, 0x48, 0xC2, 0x30, 0xA2, 0x38, 0xC2, 0x38, 0xA2, 0x79, 0xA2, 0x79, 
-    0xA2, 0x71, 0xE2, 0x81, 0x63, 0x8A, 0x83, 0x92, 0xA3, 0x9A, 0xA3, 0x92, 0x83, 0x92, 0x83, 0x92, 
-    0x83, 0x92, 0x83, 0x92, 0x83, 0x92, 0x82, 0x92, 0x83, 0x92, 0x83, 0x92, 0x83, 0x92, 0x83, 0x92, 
-    0x82, 0x92, 0x62, 0x8A, 0x83, 0x92, 0x82, 0x79, 0x02, 0x71, 0x22, 0x79, 0x03, 0x71, 0xC7, 0x60, 
-    0xC7, 0x60, 0xA7, 0x68, 0x08, 0x39, 0x89, 0x11, 0x69, 0x11, 0x69, 0x11, 0x2C, 0x12, 0x2C, 0x12, 
-    0x4D, 0x0A, 0xAA, 0x41, 0xC5, 0x90, 0xE6, 0x88, 0xE6, 0x88, 0xA8, 0x60, 0x88, 0x50, 0xA8, 0x60, 
-    0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x58, 0x22, 0x81, 0x02, 0x79, 0x02, 0x79, 0xA3, 0x68, 
-    0xA2, 0x68, 0xA2, 0x70, 0xC2, 0x48, 0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x38, 0xC2, 0x79, 0xC2, 0x79, 
-    0xC2, 0x79, 0x02, 0x82, 0x83, 0x92, 0x83, 0x92, 0x83, 0x92, 0xA3, 0x92, 0x83, 0x92, 0x83, 0x92, 
-    0x83, 0x92, 0x83, 0x92, 0x83, 0x92, 0x83, 0x92, 0x63, 0x8A, 0x63, 0x8A, 0x83, 0x8A, 0x83, 0x8A, 
-    0x63, 0x8A, 0x63, 0x8A, 0x83, 0x8A, 0x82, 0x79, 0x02, 0x71, 0x22, 0x79, 0x03, 0x71, 0xA7, 0x60, 
-    0xA7, 0x60, 0x87, 0x68, 0x08, 0x31, 0x89, 0x09, 0x68, 0x11, 0x69, 0x11, 0x2C, 0x12, 0x2C, 0x12, 
-    0x4C, 0x0A, 0xAA, 0x41, 0xC5, 0x90, 0xE6, 0x88, 0xE6, 0x88, 0xA8, 0x60, 0xA8, 0x50, 0xC9, 0x58, 
-    0x86, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0xA5, 0x31, 0x85, 0x31, 
-    0xA5, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x85, 0x31, 0x64, 0x31, 0x85, 0x31, 0xC6, 0x39, 
-    0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x39, 0xC6, 0x39, 0xE6, 0x39, 0x44, 0x29, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x48, 0x02, 0x69, 0x02, 0x61, 0x02, 0x69, 0xE4, 0x58, 
-    0xE4, 0x58, 0xE4, 0x60, 0xE3, 0x50, 0xE2, 0x48, 0xC2, 0x48, 0xE2, 0x48, 0x82, 0x71, 0x82, 0x79, 
-    0x82, 0x79, 0xC2, 0x79, 0x22, 0x82, 0x22, 0x82, 0x22, 0x8A, 0x22, 0x8A, 0x22, 0x8A, 0x22, 0x8A, 
-    0x22, 0x8A, 0x22, 0x82, 0x22, 0x8A, 0x22, 0x82, 0x22, 0x82, 0x02, 0x82, 0x02, 0x82, 0x22, 0x82, 
-    0x22, 0x8A, 0x22, 0x8A, 0x22, 0x8A, 0x82, 0x81, 0x42, 0x81, 0x42, 0x81, 0x23, 0x71, 0xC7, 0x48, 
-    0xC7, 0x50, 0xA7, 0x50, 0x08, 0x31, 0x49, 0x19, 0x49, 0x21, 0x49, 0x21, 0xCA, 0x19, 0xCA, 0x21, 
-    0xEB, 0x19, 0x89, 0x41, 0xE6, 0x78, 0x06, 0x71, 0x06, 0x71, 0xC7, 0x50, 0xA7, 0x48, 0xC7, 0x48, 
-    0x85, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x75, 0xD6, 0x75, 0xD6, 
-    0x55, 0xD6, 0x54, 0xD6, 0x34, 0xD6, 0x34, 0xCE, 0x14, 0xCE, 0xF3, 0xCD, 0xD2, 0xC5, 0xD7, 0xE6, 
-    0x59, 0xEF, 0x39, 0xEF, 0x39, 0xEF, 0x39, 0xEF, 0x39, 0xEF, 0x18, 0xEF, 0x9A, 0xF7, 0x73, 0xB5, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x08, 0xA8, 0x19, 
-    0x67, 0x19, 0x88, 0x11, 0x43, 0x61, 0x21, 0x89, 0x21, 0x79, 0x21, 0x79, 0x01, 0x71, 0x01, 0x69, 
-    0x01, 0x69, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 
-    0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x68, 
-    0x61, 0x81, 0x81, 0x81, 0x61, 0x81, 0xE1, 0x99, 0x21, 0xA2, 0x20, 0xAA, 0xC2, 0x89, 0x07, 0x11, 
-    0x06, 0x11, 0x06, 0x09, 0xC7, 0x30, 0xA8, 0x50, 0xA8, 0x50, 0xA8, 0x50, 0x87, 0x40, 0x86, 0x40, 
-    0x86, 0x48, 0xE7, 0x28, 0x69, 0x09, 0x68, 0x11, 0x69, 0x11, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x14, 0xCE, 0xF3, 0xC5, 
-    0xD3, 0xC5, 0xD3, 0xC5, 0xD3, 0xC5, 0xB2, 0xC5, 0x92, 0xBD, 0x91, 0xBD, 0x51, 0xB5, 0x51, 0xB5, 
-    0x76, 0xD6, 0xD7, 0xDE, 0xD7, 0xDE, 0xD7, 0xDE, 0xB7, 0xDE, 0xB7, 0xDE, 0x18, 0xE7, 0x32, 0xAD, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 0x88, 0x19, 
-    0x47, 0x19, 0x67, 0x11, 0x43, 0x59, 0x01, 0x81, 0x21, 0x79, 0x21, 0x79, 0x01, 0x71, 0x01, 0x71, 
-    0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 
-    0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 0x01, 0x69, 
-    0x81, 0x89, 0x81, 0x81, 0x81, 0x81, 0xE1, 0x99, 0x01, 0xA2, 0x01, 0xAA, 0xC2, 0x89, 0xE6, 0x10, 
-    0xE6, 0x10, 0xE6, 0x10, 0xC7, 0x30, 0xA8, 0x50, 0xA8, 0x48, 0xA8, 0x48, 0xA6, 0x40, 0xA6, 0x38, 
-    0x86, 0x40, 0xE7, 0x28, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x34, 0xCE, 0xF3, 0xC5, 
-    0xD3, 0xC5, 0xD3, 0xC5, 0xD2, 0xC5, 0xB2, 0xC5, 0x92, 0xBD, 0x91, 0xBD, 0x91, 0xBD, 0x50, 0xB5, 
-    0xF3, 0xC5, 0xF8, 0xE6, 0xD8, 0xDE, 0xD8, 0xE6, 0xF8, 0xE6, 0xD8, 0xDE, 0x59, 0xEF, 0x52, 0xAD, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0xA8, 0x19, 
-    0x67, 0x11, 0x67, 0x09, 0x43, 0x61, 0x20, 0x91, 0x21, 0x81, 0x21, 0x81, 0x01, 0x71, 0x01, 0x71, 
-    0x01, 0x71, 0x01, 0x69, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 
-    0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x60, 0xE1, 0x68, 
-    0x61, 0x81, 0x81, 0x81, 0x61, 0x81, 0xE1, 0x99, 0x21, 0xAA, 0x20, 0xAA, 0xE2, 0x91, 0xE6, 0x10, 
-    0xE6, 0x10, 0xE6, 0x10, 0xC7, 0x38, 0xA8, 0x58, 0xA8, 0x50, 0xA8, 0x50, 0xA7, 0x48, 0xC7, 0x40, 
-    0xA7, 0x48, 0x08, 0x31, 0x89, 0x11, 0x68, 0x11, 0x89, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x14, 0xCE, 0xD3, 0xC5, 
-    0xD3, 0xC5, 0xB2, 0xBD, 0x92, 0xBD, 0x92, 0xBD, 0x91, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x50, 0xB5, 
-    0xF4, 0xC5, 0xF8, 0xE6, 0xD8, 0xDE, 0xD8, 0xE6, 0xF3, 0xC5, 0x92, 0xBD, 0xF3, 0xC5, 0x8E, 0xA4, 
-    0x21, 0x51, 0x41, 0x51, 0x41, 0x51, 0xC4, 0x40, 0x86, 0x38, 0x86, 0x38, 0xA6, 0x38, 0x07, 0x39, 
-    0xE7, 0x30, 0xE7, 0x30, 0x26, 0x39, 0x25, 0x39, 0x26, 0x39, 0x25, 0x41, 0x42, 0x79, 0x41, 0x79, 
-    0x42, 0x79, 0x61, 0x81, 0x81, 0x89, 0x81, 0x89, 0x81, 0x89, 0xC1, 0x91, 0xE1, 0x91, 0xE1, 0x91, 
-    0xE1, 0x91, 0xE1, 0x91, 0xE1, 0x91, 0x01, 0x92, 0x01, 0x92, 0xE1, 0x91, 0xE1, 0x91, 0xE1, 0x91, 
-    0x01, 0x9A, 0x01, 0x9A, 0x01, 0xA2, 0x81, 0x89, 0x42, 0x79, 0x61, 0x89, 0x44, 0x61, 0x27, 0x11, 
-    0x27, 0x11, 0x27, 0x11, 0x28, 0x21, 0x08, 0x29, 0x08, 0x29, 0x28, 0x29, 0x83, 0x18, 0x63, 0x18, 
-    0x43, 0x18, 0x63, 0x10, 0x83, 0x08, 0x83, 0x08, 0xA3, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x14, 0xCE, 0xD3, 0xC5, 
-    0xB2, 0xC5, 0xD2, 0xC5, 0xD3, 0xC5, 0xD2, 0xC5, 0xB2, 0xC5, 0x71, 0xBD, 0x71, 0xBD, 0x50, 0xB5, 
-    0xF4, 0xCD, 0xF8, 0xE6, 0xD7, 0xDE, 0xD8, 0xDE, 0x71, 0xBD, 0x10, 0xAD, 0x51, 0xB5, 0x4C, 0xA4, 
-    0xA1, 0x79, 0xE2, 0x79, 0x01, 0x82, 0x27, 0x69, 0xCA, 0x58, 0xC9, 0x58, 0xC9, 0x58, 0xA7, 0x48, 
-    0xA7, 0x48, 0x87, 0x48, 0x07, 0x21, 0x28, 0x09, 0x28, 0x09, 0x27, 0x19, 0x62, 0x79, 0x62, 0x81, 
-    0x62, 0x79, 0x81, 0x89, 0xC1, 0x99, 0xC1, 0x99, 0xC1, 0x99, 0x21, 0xA2, 0x81, 0xB2, 0x81, 0xB2, 
-    0x81, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 0xA1, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 0x81, 0xB2, 
-    0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x62, 0x79, 0xE2, 0x68, 0xC5, 0x58, 0xC9, 0x28, 0x27, 0x11, 
-    0x28, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x21, 0xF3, 0xCD, 0xB2, 0xC5, 
-    0xD2, 0xC5, 0xAF, 0xA4, 0x0D, 0x8C, 0x2D, 0x94, 0x2D, 0x94, 0x51, 0xB5, 0x71, 0xBD, 0x51, 0xB5, 
-    0xF4, 0xCD, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0xB2, 0xBD, 0x51, 0xB5, 0xB2, 0xBD, 0x8D, 0xAC, 
-    0x81, 0x71, 0xC2, 0x71, 0xE1, 0x79, 0x07, 0x61, 0xA9, 0x50, 0xC9, 0x50, 0xA8, 0x50, 0xA7, 0x48, 
-    0xA7, 0x40, 0xA7, 0x48, 0x07, 0x29, 0x27, 0x11, 0x27, 0x11, 0x27, 0x21, 0x62, 0x79, 0x62, 0x81, 
-    0x42, 0x79, 0x81, 0x89, 0xC1, 0x99, 0xC1, 0x99, 0xC1, 0x99, 0x21, 0xA2, 0x61, 0xAA, 0x61, 0xAA, 
-    0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 
-    0x41, 0xAA, 0x41, 0xAA, 0x61, 0xAA, 0x61, 0x81, 0xC5, 0x58, 0xA9, 0x38, 0xC9, 0x30, 0x28, 0x11, 
-    0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x19, 0x21, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x29, 0xF3, 0xCD, 0x92, 0xBD, 
-    0xD3, 0xC5, 0x8B, 0x7B, 0x26, 0x52, 0x47, 0x5A, 0x87, 0x5A, 0x51, 0xB5, 0x71, 0xBD, 0x51, 0xB5, 
-    0xF4, 0xC5, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0x30, 0xB5, 0xCE, 0xAC, 0x0F, 0xB5, 0x2C, 0xA4, 
-    0x81, 0x71, 0xC2, 0x71, 0xC1, 0x71, 0x07, 0x61, 0xA9, 0x50, 0xC8, 0x50, 0xC8, 0x50, 0xC7, 0x38, 
-    0xC7, 0x38, 0xC7, 0x40, 0x07, 0x21, 0x47, 0x11, 0x27, 0x11, 0x47, 0x21, 0x63, 0x69, 0x43, 0x71, 
-    0x43, 0x69, 0x62, 0x79, 0xA1, 0x91, 0xA1, 0x91, 0x81, 0x89, 0x01, 0x9A, 0x41, 0xA2, 0x41, 0xA2, 
-    0x41, 0xA2, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x41, 0xAA, 
-    0x01, 0x9A, 0x01, 0x9A, 0x20, 0xA2, 0x25, 0x61, 0xA9, 0x30, 0xA9, 0x38, 0xC8, 0x30, 0x27, 0x19, 
-    0x27, 0x19, 0x47, 0x19, 0x47, 0x19, 0x27, 0x11, 0x07, 0x11, 0x27, 0x11, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0xF3, 0xCD, 0x92, 0xBD, 
-    0xD2, 0xC5, 0xAB, 0x83, 0x67, 0x5A, 0x88, 0x62, 0xC8, 0x62, 0x51, 0xB5, 0x91, 0xBD, 0x51, 0xB5, 
-    0x14, 0xCE, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0xE5, 0x8A, 0x01, 0x7A, 0x22, 0x7A, 0xC2, 0x71, 
-    0x21, 0x51, 0x22, 0x51, 0x41, 0x51, 0xC5, 0x50, 0x86, 0x48, 0xA6, 0x48, 0xA6, 0x40, 0x07, 0x11, 
-    0x06, 0x11, 0x06, 0x11, 0x48, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x19, 0x89, 0x19, 
-    0x89, 0x19, 0x49, 0x21, 0xE6, 0x50, 0xE2, 0x70, 0xE3, 0x68, 0x62, 0x79, 0xA2, 0x81, 0x82, 0x79, 
-    0xC2, 0x89, 0x61, 0xAA, 0x61, 0xAA, 0x41, 0xA2, 0x41, 0xA2, 0x41, 0xA2, 0x41, 0xAA, 0x21, 0x9A, 
-    0x62, 0x71, 0x41, 0x81, 0x84, 0x51, 0x09, 0x41, 0x88, 0x58, 0xA8, 0x50, 0xA7, 0x48, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x29, 0xF3, 0xC5, 0x92, 0xBD, 
-    0xD2, 0xC5, 0xAB, 0x83, 0x67, 0x5A, 0x88, 0x62, 0xC8, 0x62, 0x51, 0xB5, 0x71, 0xBD, 0x51, 0xB5, 
-    0x14, 0xCE, 0xF8, 0xE6, 0xD7, 0xDE, 0xD8, 0xDE, 0xE5, 0x8A, 0xE1, 0x79, 0x22, 0x7A, 0xC2, 0x71, 
-    0x21, 0x51, 0x22, 0x51, 0x41, 0x51, 0xC5, 0x48, 0x86, 0x48, 0xA6, 0x48, 0xA6, 0x40, 0x06, 0x11, 
-    0x06, 0x11, 0xE6, 0x10, 0x47, 0x11, 0x89, 0x11, 0x69, 0x11, 0x89, 0x11, 0x89, 0x19, 0x89, 0x19, 
-    0x89, 0x19, 0x49, 0x21, 0xEB, 0x28, 0x08, 0x41, 0x03, 0x69, 0x62, 0x81, 0xA2, 0x81, 0x82, 0x79, 
-    0xE2, 0x89, 0x61, 0xAA, 0x41, 0xA2, 0x41, 0xA2, 0x41, 0xA2, 0x41, 0xA2, 0x41, 0xAA, 0x21, 0x9A, 
-    0x41, 0x79, 0x84, 0x59, 0xE9, 0x19, 0x09, 0x41, 0xA8, 0x50, 0xA8, 0x50, 0xA7, 0x48, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x29, 0xF3, 0xC5, 0x92, 0xBD, 
-    0xD2, 0xC5, 0x8B, 0x7B, 0x26, 0x52, 0x47, 0x5A, 0x67, 0x5A, 0x51, 0xB5, 0x91, 0xBD, 0x51, 0xB5, 
-    0x14, 0xCE, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0xE5, 0x8A, 0x01, 0x7A, 0x22, 0x7A, 0xE2, 0x71, 
-    0x21, 0x51, 0x21, 0x51, 0x41, 0x51, 0xC5, 0x48, 0x86, 0x48, 0xA6, 0x48, 0xA6, 0x40, 0x27, 0x11, 
-    0x27, 0x11, 0x07, 0x11, 0x48, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 
-    0x89, 0x11, 0x49, 0x21, 0xCA, 0x30, 0xEA, 0x28, 0xC9, 0x38, 0x62, 0x79, 0xA1, 0x89, 0x82, 0x81, 
-    0xC1, 0x91, 0x81, 0xAA, 0x61, 0xAA, 0x61, 0xAA, 0x41, 0xAA, 0x41, 0xAA, 0x41, 0xAA, 0x01, 0xA2, 
-    0x84, 0x59, 0xC8, 0x19, 0xC8, 0x19, 0xE8, 0x48, 0x88, 0x58, 0x88, 0x58, 0x87, 0x48, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x21, 0xD3, 0xC5, 0x91, 0xBD, 
-    0x92, 0xBD, 0xCF, 0xA4, 0x6E, 0x9C, 0x4D, 0x94, 0x6E, 0x9C, 0x71, 0xB5, 0x71, 0xBD, 0x51, 0xB5, 
-    0x14, 0xC6, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0xC5, 0x8A, 0xE1, 0x71, 0x22, 0x7A, 0xC2, 0x69, 
-    0xC2, 0x40, 0xE2, 0x40, 0xE1, 0x40, 0xA5, 0x48, 0x86, 0x48, 0xA6, 0x48, 0xA6, 0x40, 0x83, 0x08, 
-    0x62, 0x08, 0x62, 0x08, 0xE5, 0x10, 0x27, 0x11, 0x27, 0x11, 0x27, 0x19, 0x09, 0x41, 0x0A, 0x41, 
-    0xE9, 0x40, 0x6A, 0x31, 0x0C, 0x1A, 0xEB, 0x21, 0xEC, 0x19, 0x88, 0x31, 0x86, 0x41, 0x87, 0x39, 
-    0x86, 0x49, 0x62, 0x81, 0x62, 0x79, 0x62, 0x79, 0xC1, 0x91, 0xE1, 0x91, 0xE1, 0x99, 0xE2, 0x81, 
-    0x09, 0x1A, 0xE9, 0x19, 0xE9, 0x19, 0xEA, 0x29, 0xCA, 0x29, 0xEB, 0x29, 0xA9, 0x21, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x21, 0xB2, 0xC5, 0x71, 0xBD, 
-    0x71, 0xBD, 0x92, 0xBD, 0x92, 0xBD, 0x92, 0xBD, 0x92, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x51, 0xB5, 
-    0x14, 0xCE, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0xC5, 0x8A, 0xE1, 0x71, 0x42, 0x7A, 0xC2, 0x69, 
-    0xA2, 0x30, 0xC2, 0x38, 0xA2, 0x30, 0x84, 0x40, 0x86, 0x48, 0x86, 0x48, 0xA5, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA3, 0x08, 0x06, 0x11, 0xE6, 0x10, 0xE6, 0x18, 0xA9, 0x58, 0xCA, 0x60, 
-    0x89, 0x60, 0x6B, 0x39, 0x8C, 0x0A, 0x6C, 0x12, 0x6C, 0x12, 0xAA, 0x11, 0x69, 0x11, 0x89, 0x11, 
-    0x89, 0x19, 0x46, 0x41, 0xE3, 0x68, 0xE3, 0x68, 0x82, 0x81, 0xC1, 0x89, 0xC1, 0x91, 0xE3, 0x71, 
-    0x0A, 0x12, 0xE9, 0x19, 0xE9, 0x19, 0x4A, 0x12, 0x6B, 0x12, 0x8C, 0x12, 0x2A, 0x12, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x29, 0xB2, 0xC5, 0x71, 0xBD, 
-    0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x51, 0xB5, 
-    0xF4, 0xCD, 0xF8, 0xE6, 0xD7, 0xDE, 0xD7, 0xDE, 0xC5, 0x82, 0xC0, 0x71, 0x01, 0x7A, 0xA1, 0x61, 
-    0xA2, 0x30, 0xC2, 0x38, 0xA2, 0x30, 0xA5, 0x40, 0x86, 0x48, 0xA6, 0x50, 0xA6, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x08, 0x07, 0x11, 0xE6, 0x10, 0x07, 0x19, 0xA9, 0x58, 0xA9, 0x58, 
-    0x89, 0x60, 0x6B, 0x39, 0x8C, 0x0A, 0x4C, 0x12, 0x6C, 0x12, 0xA9, 0x19, 0x68, 0x19, 0x68, 0x19, 
-    0x88, 0x19, 0xC9, 0x19, 0x87, 0x31, 0x03, 0x61, 0x81, 0x81, 0xC1, 0x89, 0xC1, 0x91, 0xE3, 0x71, 
-    0x2A, 0x12, 0x09, 0x1A, 0x09, 0x1A, 0x4A, 0x1A, 0x6B, 0x1A, 0x6C, 0x1A, 0x0A, 0x1A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x29, 0xF3, 0xCD, 0x51, 0xB5, 
-    0x71, 0xBD, 0x71, 0xBD, 0x91, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x92, 0xBD, 0x51, 0xB5, 
-    0x14, 0xCE, 0xF8, 0xE6, 0xB7, 0xDE, 0xD7, 0xDE, 0x68, 0x93, 0x84, 0x82, 0xC5, 0x8A, 0x24, 0x72, 
-    0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xA4, 0x40, 0xA6, 0x40, 0xA6, 0x40, 0xA5, 0x38, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x10, 0x07, 0x19, 0xE6, 0x18, 0xE7, 0x20, 0xE9, 0x48, 0xE9, 0x50, 
-    0xC9, 0x50, 0x6B, 0x39, 0x2C, 0x1A, 0x0C, 0x22, 0x0C, 0x22, 0xAA, 0x19, 0x88, 0x19, 0x89, 0x11, 
-    0xA8, 0x21, 0x07, 0x42, 0x28, 0x3A, 0x07, 0x42, 0xE2, 0x89, 0x01, 0x92, 0x01, 0x9A, 0x03, 0x72, 
-    0xEA, 0x19, 0xE9, 0x21, 0xC9, 0x21, 0x2A, 0x1A, 0x4B, 0x1A, 0x6B, 0x1A, 0x09, 0x1A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x6B, 0x73, 0xD3, 0xC5, 
-    0x51, 0xB5, 0x71, 0xB5, 0x71, 0xBD, 0x71, 0xBD, 0x71, 0xBD, 0x92, 0xBD, 0x71, 0xBD, 0x92, 0xBD, 
-    0xB7, 0xDE, 0xD7, 0xDE, 0xD8, 0xE6, 0x76, 0xD6, 0x30, 0xB5, 0x30, 0xB5, 0x71, 0xBD, 0x2D, 0x9C, 
-    0xE1, 0x48, 0x02, 0x49, 0x02, 0x51, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x84, 0x28, 0xA8, 0x48, 0xA7, 0x40, 0xC7, 0x40, 0x69, 0x19, 0x89, 0x19, 
-    0x89, 0x11, 0x29, 0x31, 0xAA, 0x60, 0xAA, 0x58, 0xAA, 0x58, 0x8A, 0x29, 0xEA, 0x11, 0xAA, 0x11, 
-    0x28, 0x42, 0x83, 0xBB, 0x64, 0xAB, 0x84, 0xB3, 0x23, 0xA3, 0xE2, 0xA2, 0x02, 0xAB, 0x63, 0x8A, 
-    0x87, 0x40, 0xA6, 0x40, 0x86, 0x40, 0x89, 0x21, 0xEA, 0x11, 0xEA, 0x19, 0xC8, 0x19, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x73, 
-    0xF3, 0xCD, 0x92, 0xBD, 0x71, 0xB5, 0x71, 0xBD, 0x71, 0xBD, 0x91, 0xBD, 0x92, 0xBD, 0x96, 0xD6, 
-    0xD7, 0xDE, 0xD7, 0xDE, 0x96, 0xD6, 0x51, 0xB5, 0xEF, 0xAC, 0xEF, 0xAC, 0x50, 0xB5, 0x0C, 0x94, 
-    0xC1, 0x48, 0x02, 0x49, 0x02, 0x51, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x84, 0x28, 0xA8, 0x48, 0xA7, 0x40, 0xC7, 0x40, 0x69, 0x19, 0x69, 0x19, 
-    0x69, 0x11, 0x29, 0x31, 0xAA, 0x58, 0xC9, 0x50, 0xAA, 0x58, 0x8A, 0x29, 0xEA, 0x19, 0xAA, 0x11, 
-    0x48, 0x42, 0x63, 0xB3, 0x64, 0xAB, 0x64, 0xAB, 0x03, 0xA3, 0xC2, 0x9A, 0x02, 0xA3, 0x63, 0x8A, 
-    0x87, 0x40, 0xC6, 0x40, 0xA6, 0x48, 0x89, 0x21, 0xE9, 0x11, 0xEA, 0x19, 0xA8, 0x19, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x4B, 0x6B, 0x92, 0xBD, 0x13, 0xCE, 0xF3, 0xCD, 0xF3, 0xC5, 0xD3, 0xC5, 0x96, 0xD6, 0xF8, 0xE6, 
-    0xF8, 0xE6, 0x96, 0xDE, 0x71, 0xBD, 0x50, 0xB5, 0x91, 0xBD, 0x71, 0xBD, 0xD2, 0xC5, 0x8E, 0xA4, 
-    0xE1, 0x48, 0x22, 0x51, 0x22, 0x59, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x85, 0x28, 0xA8, 0x48, 0x87, 0x40, 0xA8, 0x40, 0x69, 0x11, 0x89, 0x11, 
-    0x89, 0x09, 0x29, 0x31, 0xAA, 0x60, 0xCA, 0x58, 0xAA, 0x60, 0x8A, 0x21, 0xCB, 0x09, 0xAB, 0x09, 
-    0x49, 0x42, 0xC4, 0xBB, 0xA4, 0xB3, 0xC4, 0xBB, 0x23, 0xAB, 0xE2, 0xA2, 0x22, 0xAB, 0x63, 0x8A, 
-    0x67, 0x38, 0x87, 0x40, 0x46, 0x40, 0x69, 0x21, 0x0A, 0x12, 0xEA, 0x11, 0xC9, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xC2, 0x18, 0x65, 0x31, 0x64, 0x29, 0xA5, 0x31, 0xAC, 0x83, 0xEC, 0x8B, 0x0D, 0x8C, 
-    0x4D, 0x94, 0x0C, 0x8C, 0xEC, 0x8B, 0x2D, 0x94, 0x47, 0x4A, 0xC6, 0x39, 0xE6, 0x41, 0x85, 0x39, 
-    0x61, 0x18, 0x81, 0x18, 0x81, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x28, 0xE4, 0x48, 0xC4, 0x40, 0xC4, 0x40, 0x25, 0x39, 0x25, 0x39, 
-    0x24, 0x39, 0x26, 0x31, 0x08, 0x29, 0x08, 0x31, 0xE8, 0x28, 0x06, 0x5A, 0x84, 0x6A, 0x85, 0x6A, 
-    0x44, 0x6A, 0xE2, 0x71, 0xE2, 0x71, 0xE2, 0x71, 0x22, 0x82, 0x42, 0x8A, 0x42, 0x8A, 0x42, 0x8A, 
-    0x63, 0x82, 0x64, 0x82, 0x63, 0x82, 0x84, 0x49, 0x25, 0x31, 0x45, 0x39, 0x45, 0x31, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x6A, 0x29, 0x73, 0x29, 0x73, 
-    0x6A, 0x7B, 0x6A, 0x7B, 0x6A, 0x7B, 0x8A, 0x7B, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xE2, 0x48, 0xC2, 0x40, 0xE2, 0x40, 0x02, 0x51, 0x02, 0x51, 
-    0x01, 0x51, 0x04, 0x31, 0x26, 0x09, 0x26, 0x11, 0x07, 0x09, 0x63, 0x72, 0xE1, 0x9A, 0x02, 0x9B, 
-    0x61, 0x82, 0xE1, 0x48, 0x01, 0x51, 0xE1, 0x48, 0xA1, 0x71, 0xE1, 0x81, 0xC1, 0x79, 0x21, 0x8A, 
-    0x82, 0xA3, 0x62, 0xA3, 0xA2, 0xAB, 0xA2, 0x61, 0xC2, 0x40, 0xE1, 0x48, 0xE2, 0x40, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x29, 0x73, 0x6A, 0x7B, 0x6A, 0x7B, 
-    0x8B, 0x7B, 0x8A, 0x7B, 0x8B, 0x83, 0xAB, 0x83, 0xA2, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xE2, 0x48, 0xC2, 0x40, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x51, 0x24, 0x39, 0x07, 0x11, 0x06, 0x19, 0x07, 0x11, 0x43, 0x72, 0xE2, 0x9A, 0xE2, 0x92, 
-    0x62, 0x82, 0x01, 0x51, 0x21, 0x51, 0x01, 0x51, 0xC1, 0x71, 0x01, 0x82, 0xE1, 0x81, 0x42, 0x8A, 
-    0x62, 0xA3, 0x42, 0xA3, 0x82, 0xAB, 0xA2, 0x61, 0xC2, 0x40, 0x02, 0x49, 0x02, 0x39, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x4A, 0x73, 0x8A, 0x7B, 0x8A, 0x7B, 
-    0x8B, 0x83, 0x8A, 0x7B, 0x8B, 0x83, 0xAB, 0x83, 0xA2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xE3, 0x40, 0xC2, 0x38, 0xE2, 0x40, 0x03, 0x41, 0x03, 0x41, 
-    0x02, 0x49, 0x24, 0x31, 0x27, 0x11, 0x27, 0x19, 0x07, 0x11, 0x04, 0x62, 0x82, 0x82, 0xA3, 0x82, 
-    0x22, 0x72, 0x41, 0x59, 0x61, 0x59, 0x41, 0x59, 0xC2, 0x79, 0x01, 0x82, 0xE1, 0x81, 0x22, 0x82, 
-    0x03, 0x8B, 0x03, 0x8B, 0x23, 0x93, 0x83, 0x51, 0xC3, 0x38, 0x03, 0x41, 0x03, 0x39, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x39, 0xEC, 0x8B, 0xCB, 0x8B, 0xEB, 0x8B, 
-    0xEC, 0x8B, 0xEB, 0x8B, 0xEB, 0x8B, 0x0C, 0x8C, 0xA2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x10, 0xC5, 0x10, 0xA4, 0x10, 0xC5, 0x10, 0x27, 0x11, 0x47, 0x11, 
-    0x27, 0x11, 0x48, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x19, 0x27, 0x11, 0x06, 0x11, 0xE6, 0x08, 
-    0x85, 0x39, 0xC1, 0x9A, 0xA2, 0x92, 0xC2, 0x92, 0x62, 0x8A, 0x22, 0x8A, 0x41, 0x92, 0x03, 0x72, 
-    0x06, 0x11, 0x06, 0x19, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x11, 0x06, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x31, 0xEC, 0x8B, 0xCB, 0x83, 0xCB, 0x83, 0xCB, 0x8B, 
-    0xCB, 0x8B, 0xEB, 0x8B, 0xEB, 0x8B, 0xEC, 0x8B, 0xA2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0xC5, 0x10, 0xA4, 0x08, 0xC5, 0x10, 0x27, 0x11, 0x27, 0x11, 
-    0x27, 0x11, 0x48, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x27, 0x11, 0x06, 0x11, 0xE6, 0x08, 
-    0x85, 0x39, 0xC2, 0x9A, 0xA2, 0x92, 0xA2, 0x92, 0x42, 0x8A, 0x22, 0x8A, 0x41, 0x92, 0x03, 0x72, 
-    0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x27, 0x11, 0x06, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x85, 0x31, 0x4D, 0x9C, 0x0C, 0x94, 0x0C, 0x94, 0x2C, 0x94, 0x2C, 0x94, 
-    0x4C, 0x94, 0x4C, 0x94, 0x4C, 0x9C, 0x4D, 0x9C, 0xC2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0xC5, 0x10, 0xA4, 0x10, 0xC5, 0x10, 0x27, 0x11, 0x27, 0x11, 
-    0x27, 0x11, 0x47, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x26, 0x11, 0x06, 0x11, 0xE6, 0x08, 
-    0x85, 0x39, 0xE1, 0xA2, 0xC1, 0x9A, 0xC1, 0x9A, 0x61, 0x9A, 0x41, 0x92, 0x61, 0x9A, 0x02, 0x7A, 
-    0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0x06, 0x11, 0xE5, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x44, 0x29, 0x84, 0x39, 0x64, 0x31, 0x84, 0x31, 0x84, 0x31, 0x84, 0x31, 
-    0x84, 0x39, 0x84, 0x39, 0x84, 0x39, 0xA5, 0x39, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xA4, 0x10, 0x06, 0x11, 0xE6, 0x10, 0x06, 0x11, 0x68, 0x11, 0x68, 0x11, 
-    0x68, 0x11, 0x68, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x68, 0x11, 0x47, 0x11, 0x47, 0x11, 
-    0x67, 0x21, 0xC5, 0x41, 0xC5, 0x41, 0xC5, 0x41, 0xA5, 0x41, 0xA5, 0x41, 0xA5, 0x49, 0x86, 0x39, 
-    0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x47, 0x11, 0x48, 0x11, 0x68, 0x11, 0x47, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC4, 0x10, 0x47, 0x11, 0x27, 0x11, 0x27, 0x11, 0x88, 0x11, 0x88, 0x11, 
-    0x88, 0x19, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x11, 0x88, 0x19, 
-    0x68, 0x11, 0x07, 0x09, 0x07, 0x09, 0x07, 0x09, 0x27, 0x09, 0x27, 0x09, 0x27, 0x09, 0x27, 0x09, 
-    0x47, 0x11, 0x47, 0x11, 0x47, 0x11, 0x88, 0x11, 0x89, 0x11, 0xA9, 0x11, 0x88, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC4, 0x10, 0x47, 0x11, 0x06, 0x11, 0x27, 0x11, 0x88, 0x11, 0x88, 0x11, 
-    0x88, 0x11, 0x88, 0x19, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x11, 0x88, 0x19, 
-    0x68, 0x19, 0x47, 0x19, 0x47, 0x19, 0x27, 0x19, 0x47, 0x19, 0x47, 0x11, 0x47, 0x11, 0x47, 0x11, 
-    0x47, 0x11, 0x47, 0x11, 0x47, 0x11, 0x68, 0x11, 0x88, 0x11, 0x89, 0x11, 0x67, 0x11, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC4, 0x08, 0x47, 0x11, 0x27, 0x11, 0x47, 0x11, 0x88, 0x11, 0x88, 0x19, 
-    0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x68, 0x11, 0x68, 0x11, 0x68, 0x11, 
-    0x47, 0x11, 0x26, 0x11, 0x27, 0x11, 0x26, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 0x27, 0x11, 
-    0x47, 0x11, 0x47, 0x11, 0x47, 0x11, 0x88, 0x11, 0x89, 0x11, 0xA9, 0x11, 0x68, 0x11, 0x41, 0x00, 
-    0x41, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE5, 0x10, 0x89, 0x19, 0x68, 0x11, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0xC4, 0x10, 0x83, 0x08, 0x83, 0x10, 
-    0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0xA4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xE5, 0x10, 
-    0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0xA9, 0x11, 
-    0x88, 0x11, 0xCA, 0x19, 0xC3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE5, 0x10, 0x89, 0x19, 0x68, 0x11, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0xC4, 0x10, 0x63, 0x08, 0x83, 0x08, 
-    0x63, 0x08, 0x63, 0x08, 0x63, 0x08, 0x63, 0x08, 0x83, 0x08, 0xA4, 0x08, 0x84, 0x08, 0xC5, 0x10, 
-    0x89, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x89, 0x11, 0xA9, 0x11, 
-    0x89, 0x11, 0xCA, 0x11, 0xC4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE5, 0x10, 0xA9, 0x19, 0x68, 0x11, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 0xC5, 0x10, 0x83, 0x10, 0xA4, 0x10, 
-    0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0xA4, 0x10, 0xC4, 0x10, 0xA4, 0x10, 0xE5, 0x10, 
-    0x89, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x88, 0x11, 0x89, 0x11, 0xA9, 0x11, 
-    0xA9, 0x11, 0xCA, 0x11, 0xC4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xC4, 0x10, 
-    0xC4, 0x08, 0xC4, 0x10, 0x46, 0x11, 0x88, 0x19, 0x68, 0x11, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x67, 0x19, 0x47, 0x19, 0x47, 0x11, 0x67, 0x19, 0xC4, 0x10, 0x41, 0x00, 0x62, 0x08, 
-    0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0x42, 0x08, 0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0xE4, 0x10, 
-    0x68, 0x11, 0x47, 0x11, 0x47, 0x11, 0x88, 0x11, 0x89, 0x11, 0x89, 0x11, 0x88, 0x11, 0x48, 0x11, 
-    0x47, 0x11, 0x88, 0x11, 0xA3, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE4, 0x30, 0x27, 0x11, 
-    0x27, 0x11, 0x26, 0x11, 0x47, 0x11, 0x88, 0x19, 0x68, 0x19, 0x88, 0x11, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x47, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 
-    0x27, 0x19, 0x06, 0x11, 0x06, 0x11, 0x68, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0x88, 0x11, 0x06, 0x11, 
-    0x06, 0x11, 0x27, 0x11, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE2, 0x38, 0xC3, 0x30, 0x06, 0x11, 
-    0x06, 0x11, 0x06, 0x11, 0x47, 0x11, 0x88, 0x19, 0x68, 0x19, 0x88, 0x19, 0x88, 0x19, 0x88, 0x19, 
-    0x88, 0x19, 0x67, 0x11, 0x26, 0x11, 0x26, 0x11, 0x47, 0x19, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 
-    0x27, 0x11, 0x06, 0x11, 0x07, 0x11, 0x68, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0x89, 0x11, 0x07, 0x11, 
-    0x06, 0x11, 0x27, 0x11, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE2, 0x38, 0xA2, 0x38, 0xC3, 0x30, 0x26, 0x19, 
-    0x26, 0x19, 0x06, 0x19, 0x47, 0x19, 0x88, 0x11, 0x68, 0x11, 0x88, 0x11, 0x88, 0x19, 0x67, 0x19, 
-    0x88, 0x11, 0x67, 0x19, 0x26, 0x19, 0x26, 0x11, 0x46, 0x19, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x08, 
-    0x47, 0x19, 0x06, 0x19, 0x26, 0x19, 0x67, 0x19, 0xA8, 0x19, 0xA8, 0x19, 0x88, 0x19, 0x26, 0x19, 
-    0x26, 0x19, 0x47, 0x21, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE3, 0x30, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0x22, 0x51, 
-    0x22, 0x49, 0x01, 0x51, 0x65, 0x29, 0x89, 0x11, 0x88, 0x19, 0x88, 0x11, 0x26, 0x11, 0x26, 0x11, 
-    0x26, 0x11, 0xE4, 0x10, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 
-    0x22, 0x51, 0x02, 0x49, 0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 0x42, 0x59, 0xA2, 0x69, 
-    0x81, 0x61, 0xC2, 0x71, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x28, 0x82, 0x69, 0x61, 0x61, 0x82, 0x69, 0xE2, 0x48, 0xC1, 0x40, 0xE2, 0x48, 
-    0xA1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x41, 0x08, 0xC3, 0x28, 0xA2, 0x30, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0x21, 0x51, 
-    0x22, 0x51, 0x01, 0x51, 0x65, 0x31, 0x89, 0x11, 0x88, 0x19, 0x88, 0x19, 0x26, 0x11, 0x06, 0x11, 
-    0x26, 0x11, 0xC4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x18, 
-    0x22, 0x59, 0x01, 0x49, 0x01, 0x51, 0x01, 0x51, 0x21, 0x51, 0x01, 0x51, 0x41, 0x59, 0xA1, 0x71, 
-    0x81, 0x69, 0xC2, 0x71, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x30, 0xA2, 0x71, 0x82, 0x69, 0x82, 0x69, 0xE2, 0x48, 0xC1, 0x40, 0xE2, 0x48, 
-    0x81, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x41, 0x08, 0xC3, 0x28, 0x82, 0x28, 0xA2, 0x30, 0xA2, 0x38, 0xA2, 0x30, 0xC2, 0x38, 0x22, 0x51, 
-    0x22, 0x49, 0x01, 0x51, 0x66, 0x29, 0xA9, 0x09, 0x89, 0x11, 0x88, 0x11, 0x27, 0x11, 0x26, 0x11, 
-    0x47, 0x11, 0xE4, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 
-    0x22, 0x59, 0x01, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x21, 0x51, 0x41, 0x59, 0xA2, 0x71, 
-    0xA1, 0x69, 0xC2, 0x79, 0xA1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0xA1, 0x28, 0xA2, 0x71, 0x82, 0x69, 0x82, 0x69, 0xE1, 0x48, 0xC1, 0x40, 0xE1, 0x50, 
-    0x81, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x18, 
-    0xE2, 0x38, 0xA2, 0x38, 0xA2, 0x30, 0xE2, 0x40, 0x02, 0x49, 0xE2, 0x48, 0x02, 0x49, 0x02, 0x51, 
-    0x02, 0x49, 0x01, 0x51, 0x23, 0x41, 0x45, 0x31, 0x45, 0x31, 0x45, 0x31, 0x04, 0x31, 0x04, 0x31, 
-    0x25, 0x31, 0x82, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 
-    0xE2, 0x40, 0xC1, 0x40, 0xC2, 0x40, 0x02, 0x49, 0x21, 0x51, 0x01, 0x51, 0x21, 0x51, 0x41, 0x59, 
-    0x41, 0x59, 0x62, 0x61, 0x01, 0x49, 0xE1, 0x38, 0xE1, 0x38, 0xE1, 0x38, 0x01, 0x39, 0x01, 0x41, 
-    0x01, 0x41, 0x42, 0x51, 0x42, 0x61, 0x41, 0x59, 0x42, 0x61, 0xC2, 0x38, 0xA1, 0x30, 0xC2, 0x38, 
-    0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x28, 0xC2, 0x30, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x22, 0x51, 0x41, 0x59, 0x42, 0x59, 0x22, 0x59, 0x22, 0x51, 
-    0x02, 0x51, 0x02, 0x49, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x50, 0xE1, 0x50, 0x02, 0x51, 
-    0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xA2, 0x30, 0x82, 0x28, 0x82, 0x28, 0xE2, 0x48, 0x22, 0x51, 0x01, 0x51, 0x01, 0x51, 0x01, 0x51, 
-    0x01, 0x51, 0x01, 0x49, 0x62, 0x61, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0x02, 0x7A, 0x02, 0x7A, 
-    0x22, 0x82, 0x82, 0x69, 0x01, 0x49, 0x02, 0x51, 0x02, 0x51, 0xA2, 0x28, 0x82, 0x20, 0x82, 0x20, 
-    0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x20, 0x82, 0x28, 0x82, 0x28, 0xA2, 0x30, 
-    0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0x22, 0x51, 0x22, 0x59, 0x22, 0x51, 0x22, 0x51, 0x02, 0x51, 
-    0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x81, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xA2, 0x30, 0x82, 0x28, 0xA2, 0x28, 0xE2, 0x48, 0x02, 0x51, 0x01, 0x51, 0x22, 0x51, 0x21, 0x51, 
-    0x21, 0x51, 0x01, 0x51, 0x41, 0x59, 0x81, 0x61, 0x81, 0x61, 0x81, 0x61, 0xC2, 0x71, 0xC2, 0x71, 
-    0xE2, 0x79, 0x82, 0x61, 0x01, 0x51, 0x22, 0x51, 0x22, 0x51, 0xA2, 0x30, 0x61, 0x20, 0x82, 0x28, 
-    0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x20, 0xA2, 0x28, 0x82, 0x28, 0xA2, 0x30, 
-    0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0x02, 0x51, 0x22, 0x59, 0x22, 0x51, 0x22, 0x51, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0xE1, 0x48, 0xE1, 0x48, 0x02, 0x49, 0x81, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 
-    0xA2, 0x30, 0x82, 0x28, 0xA2, 0x28, 0xE2, 0x40, 0x02, 0x51, 0x01, 0x51, 0x22, 0x51, 0x22, 0x51, 
-    0x22, 0x51, 0x01, 0x51, 0x41, 0x59, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0xC2, 0x71, 0xC2, 0x71, 
-    0xE2, 0x79, 0x82, 0x61, 0x01, 0x51, 0x02, 0x51, 0x02, 0x51, 0xC2, 0x30, 0xA2, 0x20, 0xA2, 0x28, 
-    0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xA2, 0x28, 0x82, 0x28, 0xA2, 0x28, 
-    0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xE2, 0x48, 0x22, 0x51, 0x22, 0x51, 0x02, 0x51, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x40, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 
-    0xC3, 0x28, 0xA2, 0x30, 0x82, 0x28, 0xE2, 0x40, 0x02, 0x51, 0x02, 0x51, 0x22, 0x51, 0x02, 0x51, 
-    0x01, 0x51, 0x01, 0x51, 0x01, 0x51, 0x01, 0x51, 0x01, 0x51, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 
-    0x02, 0x51, 0xE2, 0x40, 0xA2, 0x28, 0xA2, 0x28, 0xA2, 0x28, 0x61, 0x10, 0x20, 0x08, 0x20, 0x08, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x20, 0x82, 0x28, 0x82, 0x28, 0x82, 0x28, 
-    0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x28, 0x02, 0x49, 0x22, 0x51, 0x22, 0x51, 0x02, 0x51, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x40, 0x81, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0xC2, 0x28, 0xA2, 0x30, 0xE1, 0x40, 0x02, 0x51, 0x01, 0x51, 0x02, 0x51, 0x02, 0x51, 
-    0x01, 0x51, 0x01, 0x51, 0x01, 0x49, 0x01, 0x49, 0x02, 0x49, 0x01, 0x49, 0xE1, 0x48, 0xE1, 0x48, 
-    0x01, 0x49, 0xC2, 0x38, 0x82, 0x20, 0x82, 0x20, 0xA2, 0x28, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x28, 0xA2, 0x30, 0xA2, 0x28, 0xE2, 0x48, 0x22, 0x51, 0x22, 0x51, 0x02, 0x49, 0xA2, 0x38, 
-    0xA2, 0x30, 0xC2, 0x38, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xC2, 0x20, 0x02, 0x49, 0x01, 0x51, 0x01, 0x51, 0x21, 0x51, 0x21, 0x51, 
-    0x21, 0x51, 0x01, 0x51, 0x02, 0x51, 0x01, 0x51, 0x02, 0x51, 0x01, 0x51, 0x02, 0x51, 0x02, 0x51, 
-    0x22, 0x59, 0xE2, 0x40, 0xA2, 0x28, 0xA2, 0x28, 0xC2, 0x28, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0x61, 0x18, 0x61, 0x18, 0x82, 0x20, 
-    0xA2, 0x30, 0x82, 0x28, 0xA2, 0x28, 0x02, 0x49, 0x22, 0x59, 0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 
-    0x02, 0x49, 0x22, 0x51, 0x22, 0x41, 0xC1, 0x30, 0xC1, 0x30, 0xC1, 0x30, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x30, 0xC2, 0x38, 0xC2, 0x38, 0xE2, 0x40, 0x02, 0x49, 
-    0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0xC1, 0x38, 0xC2, 0x38, 0xE2, 0x38, 0xA1, 0x28, 0x81, 0x28, 
-    0x81, 0x28, 0x81, 0x20, 0x61, 0x10, 0x61, 0x18, 0x81, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 
-    0xA2, 0x30, 0x82, 0x28, 0x82, 0x28, 0x02, 0x49, 0x42, 0x59, 0x22, 0x51, 0x42, 0x59, 0xA2, 0x69, 
-    0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0xA2, 0x69, 0x60, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x18, 0x82, 0x28, 0x82, 0x20, 0xA2, 0x28, 0xE2, 0x40, 
-    0xC2, 0x40, 0xE2, 0x48, 0xA2, 0x30, 0x82, 0x20, 0x82, 0x28, 0xA2, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 
-    0xA2, 0x30, 0x82, 0x30, 0x82, 0x28, 0x02, 0x49, 0x42, 0x59, 0x22, 0x51, 0x42, 0x59, 0xA2, 0x69, 
-    0xA2, 0x69, 0xA2, 0x69, 0x82, 0x69, 0x61, 0x61, 0x61, 0x61, 0x82, 0x61, 0x40, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x20, 0xA2, 0x28, 0x82, 0x28, 0xA2, 0x30, 0xE2, 0x48, 
-    0xE2, 0x40, 0xE2, 0x48, 0xC2, 0x38, 0x82, 0x28, 0x82, 0x28, 0xA2, 0x28, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 
-    0xC3, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x02, 0x49, 0x42, 0x59, 0x22, 0x51, 0x42, 0x59, 0x82, 0x69, 
-    0xA2, 0x69, 0xA2, 0x69, 0x82, 0x61, 0x61, 0x61, 0x62, 0x61, 0x82, 0x61, 0x81, 0x10, 0x20, 0x00, 
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x20, 0xC2, 0x30, 0xA2, 0x28, 0xC2, 0x30, 0xE2, 0x40, 
-    0xE2, 0x40, 0xE2, 0x48, 0xA2, 0x30, 0x82, 0x28, 0x82, 0x28, 0xC2, 0x28, 0x20, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x40, 0x08, 0x20, 0x08, 0x41, 0x08, 0xC2, 0x30, 0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x30, 
-    0xC2, 0x38, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x20, 0x08, 0x61, 0x10, 0xA2, 0x30, 
-    0xA2, 0x28, 0xA2, 0x28, 0xA2, 0x30, 0xA1, 0x38, 0xE2, 0x38, 0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x28, 0xC2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 
-    0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 
-    0xC2, 0x38, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0xA2, 0x28, 
-    0x82, 0x28, 0x82, 0x28, 0xA2, 0x30, 0xE2, 0x40, 0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x28, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 
-    0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x40, 0x82, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0xC2, 0x30, 
-    0xA2, 0x30, 0xA2, 0x30, 0xE2, 0x38, 0x82, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x10, 0x61, 0x20, 0x81, 0x20, 0x81, 0x20, 0x81, 0x20, 
-    0x61, 0x20, 0x81, 0x20, 0x61, 0x18, 0x61, 0x18, 0x81, 0x20, 0x81, 0x20, 0x61, 0x18, 0x61, 0x18, 
-    0x61, 0x20, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x82, 0x18, 
-    0x61, 0x18, 0x61, 0x18, 0x61, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-/* LVGL image descriptor */
-const lv_img_dsc_t howdy_img_armraisehowdy = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 128,
-    .header.h = 128,
-    .data_size = 32768,
-    .data = howdy_img_armraisehowdy_data,
-};
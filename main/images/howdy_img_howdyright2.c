@@ -1,2068 +0,0 @@
-/* Auto-generated LVGL image data from HowdyRight2.png */
-/* Original size: 1024x1024, Scaled: 128x128 */
-
-#include "howdy_img_howdyright2.h"
-
-/* Image data in RGB565 format */
-static const uint8_t howdy_img_howdyright2_data[] = {
-
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x60, 0x18, 0x60, 0x18, 0x60, 0x18, 
-    0x60, 0x18, 0x60, 0x18, 0x80, 0x20, 0xA0, 0x20, 0xA0, 0x20, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x71, 0x22, 0x92, 0x02, 0x8A, 0x22, 0x8A, 
-    0x42, 0x8A, 0x22, 0x82, 0xA2, 0xA2, 0x03, 0xBB, 0x03, 0xB3, 0xC3, 0xAA, 0x40, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x69, 0x21, 0x8A, 0x01, 0x82, 0x01, 0x8A, 
-    0x21, 0x82, 0x01, 0x82, 0x82, 0x9A, 0xE3, 0xB2, 0xE3, 0xAA, 0xA2, 0xA2, 0x40, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x22, 0x92, 0xE1, 0x81, 0x21, 0x8A, 
-    0x42, 0x8A, 0x41, 0x8A, 0xA2, 0xA2, 0x02, 0xB3, 0x03, 0xB3, 0xC2, 0xAA, 0x20, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x60, 0x18, 0xE1, 0x71, 0xC1, 0x69, 0xC1, 0x71, 0x21, 0x8A, 0x62, 0xA2, 0x62, 0xA2, 0x22, 0x8A, 
-    0x42, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x69, 0x62, 0x69, 0x62, 0x61, 0xC2, 0x79, 0xE2, 0x79, 
-    0xE2, 0x81, 0x21, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC0, 0x30, 0x23, 0xC3, 0xE2, 0xB2, 0x02, 0xB3, 0xC2, 0xAA, 0x82, 0xAA, 0xC2, 0xB2, 0x02, 0x8A, 
-    0x82, 0x38, 0xA2, 0x40, 0xA2, 0x40, 0xA2, 0x40, 0xA2, 0x38, 0xC2, 0x40, 0x83, 0xAA, 0xC3, 0xB2, 
-    0xE3, 0xC2, 0xC2, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA0, 0x28, 0xE2, 0xB2, 0xC2, 0xAA, 0xC2, 0xAA, 0xA2, 0xAA, 0xA2, 0xAA, 0xC2, 0xB2, 0x22, 0x8A, 
-    0xA2, 0x40, 0xC2, 0x48, 0xC2, 0x40, 0xC2, 0x40, 0xA2, 0x40, 0xC2, 0x40, 0x82, 0xAA, 0xA2, 0xAA, 
-    0xC3, 0xBA, 0xA1, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0xA0, 0x28, 0x80, 0x20, 
-    0x20, 0x49, 0xC2, 0xAA, 0xA2, 0xA2, 0xC2, 0xAA, 0x42, 0x9A, 0x22, 0x92, 0x42, 0x9A, 0xC2, 0x79, 
-    0xC2, 0x40, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x02, 0x8A, 0x02, 0x8A, 
-    0x22, 0x92, 0x82, 0x69, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x22, 0x28, 0x22, 0x28, 0x43, 0x30, 0x43, 0x30, 0x43, 0x38, 0x43, 0x38, 0x64, 0x48, 0x84, 0x50, 
-    0xC4, 0x58, 0x21, 0x61, 0x41, 0x61, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x49, 0x62, 0x9A, 0x41, 0x8A, 
-    0x41, 0x92, 0x62, 0x9A, 0x42, 0x9A, 0x62, 0x9A, 0x42, 0x61, 0xE2, 0x48, 0xE2, 0x50, 0x02, 0x51, 
-    0x22, 0x51, 0x02, 0x51, 0x62, 0x61, 0xC3, 0x71, 0xA3, 0x71, 0xA3, 0x71, 0x02, 0x49, 0xE2, 0x48, 
-    0xE2, 0x40, 0x82, 0x69, 0x43, 0x92, 0x23, 0x8A, 0x23, 0x8A, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 
-    0xA7, 0x78, 0xA7, 0x70, 0xA7, 0x70, 0xA7, 0x70, 0xA7, 0x78, 0xA7, 0x78, 0xA6, 0x78, 0xE6, 0x80, 
-    0x46, 0x89, 0x03, 0x9A, 0x22, 0xA2, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 0x22, 0x8A, 0x01, 0x7A, 
-    0x21, 0x8A, 0x62, 0xA2, 0x62, 0x9A, 0x62, 0xA2, 0x42, 0x61, 0xE2, 0x48, 0x02, 0x51, 0x02, 0x51, 
-    0x22, 0x51, 0x02, 0x51, 0x62, 0x61, 0xA3, 0x71, 0xA3, 0x71, 0xA3, 0x69, 0x22, 0x51, 0x22, 0x51, 
-    0x02, 0x49, 0x82, 0x69, 0x22, 0x8A, 0x02, 0x82, 0x02, 0x82, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 
-    0xA7, 0x68, 0x86, 0x60, 0x86, 0x60, 0x86, 0x68, 0xA6, 0x68, 0xA6, 0x68, 0x86, 0x68, 0xC6, 0x70, 
-    0x05, 0x81, 0xC2, 0x91, 0xE2, 0x91, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x51, 0x42, 0x92, 0x01, 0x82, 
-    0x41, 0x8A, 0x62, 0xA2, 0x62, 0x9A, 0x62, 0xA2, 0x42, 0x61, 0xE2, 0x48, 0x02, 0x51, 0x02, 0x51, 
-    0x02, 0x51, 0x02, 0x51, 0x62, 0x61, 0xC3, 0x71, 0xA3, 0x71, 0xA3, 0x69, 0x22, 0x51, 0x02, 0x49, 
-    0x02, 0x49, 0x82, 0x69, 0x22, 0x8A, 0x02, 0x82, 0x02, 0x82, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x28, 
-    0xA7, 0x70, 0x86, 0x68, 0x86, 0x68, 0x86, 0x68, 0xA6, 0x70, 0xA6, 0x70, 0x86, 0x70, 0xC6, 0x78, 
-    0x05, 0x81, 0xE2, 0x91, 0xE2, 0x99, 0x60, 0x20, 0x20, 0x08, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x20, 
-    0xA4, 0x60, 0x83, 0x58, 0x83, 0x58, 0x83, 0x50, 0x63, 0x48, 0x63, 0x48, 0x63, 0x48, 0x63, 0x40, 
-    0x63, 0x40, 0x63, 0x40, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x41, 0x22, 0x8A, 0x02, 0x7A, 
-    0x02, 0x82, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0xA2, 0x71, 0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 
-    0x62, 0x69, 0x62, 0x69, 0x82, 0x69, 0xA3, 0x69, 0xA3, 0x69, 0x83, 0x69, 0x02, 0x49, 0x02, 0x49, 
-    0xE2, 0x48, 0xA2, 0x69, 0x62, 0x9A, 0x42, 0x9A, 0x62, 0x9A, 0xC1, 0x38, 0x40, 0x28, 0x61, 0x28, 
-    0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x10, 
-    0x29, 0x39, 0x28, 0x31, 0x28, 0x39, 0x48, 0x31, 0x69, 0x29, 0x69, 0x29, 0x68, 0x29, 0xEB, 0x29, 
-    0x4C, 0x22, 0x6C, 0x22, 0x6C, 0x2A, 0x03, 0x82, 0xE1, 0x91, 0x02, 0x92, 0x40, 0x18, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x48, 
-    0x47, 0xB9, 0x47, 0xB1, 0x47, 0xB1, 0x07, 0xA1, 0x07, 0x99, 0x07, 0x99, 0xE7, 0x90, 0xC7, 0x80, 
-    0xC7, 0x80, 0xC7, 0x88, 0x21, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x38, 0x22, 0x8A, 0xE2, 0x79, 
-    0xE2, 0x79, 0x83, 0x69, 0x83, 0x69, 0x83, 0x69, 0xA3, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0x82, 0x71, 
-    0x82, 0x71, 0x82, 0x71, 0x82, 0x69, 0x83, 0x69, 0x83, 0x69, 0x83, 0x69, 0x02, 0x51, 0x02, 0x51, 
-    0xE2, 0x48, 0xA2, 0x71, 0x83, 0xA2, 0x62, 0x9A, 0x62, 0xA2, 0x02, 0x59, 0xC2, 0x48, 0xE2, 0x50, 
-    0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x08, 
-    0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0xA9, 0x11, 0xC9, 0x11, 0xCA, 0x11, 0xC9, 0x11, 0x4C, 0x0A, 
-    0xAE, 0x0A, 0x8E, 0x02, 0x8D, 0x12, 0x43, 0x8A, 0x22, 0x9A, 0x42, 0xA2, 0x60, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x40, 
-    0x47, 0xA9, 0x26, 0xA1, 0x26, 0xA1, 0xE6, 0x98, 0xC6, 0x90, 0xC6, 0x90, 0xC6, 0x88, 0xA6, 0x78, 
-    0xA6, 0x78, 0xC6, 0x78, 0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x30, 0x22, 0x8A, 0x02, 0x7A, 
-    0x02, 0x7A, 0x83, 0x71, 0xA3, 0x71, 0xA3, 0x71, 0xA3, 0x71, 0xA3, 0x71, 0x82, 0x71, 0x82, 0x71, 
-    0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0x83, 0x69, 0x83, 0x69, 0x83, 0x69, 0x02, 0x49, 0x02, 0x49, 
-    0xE2, 0x40, 0x82, 0x69, 0x83, 0xAA, 0x63, 0xA2, 0x63, 0xA2, 0x01, 0x59, 0xA1, 0x40, 0xC1, 0x50, 
-    0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 
-    0x69, 0x21, 0x48, 0x19, 0x69, 0x19, 0xA9, 0x19, 0xC9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0x4C, 0x12, 
-    0xAD, 0x0A, 0xAD, 0x0A, 0x8C, 0x1A, 0x42, 0x92, 0x21, 0x9A, 0x42, 0xA2, 0x80, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x83, 0x48, 
-    0x47, 0xB1, 0x26, 0xA1, 0x27, 0xA9, 0x28, 0x89, 0x28, 0x81, 0x28, 0x79, 0xE7, 0x80, 0x86, 0x80, 
-    0xA6, 0x80, 0xA6, 0x88, 0x41, 0x20, 0x20, 0x08, 0x20, 0x08, 0xC1, 0x30, 0xA3, 0x79, 0x83, 0x71, 
-    0xA3, 0x71, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0xA3, 0x71, 0xA3, 0x71, 0x82, 0x71, 0x82, 0x69, 
-    0x82, 0x69, 0x82, 0x69, 0x82, 0x71, 0xC2, 0x79, 0xC3, 0x79, 0xC3, 0x79, 0x62, 0x61, 0x42, 0x61, 
-    0x42, 0x61, 0xA2, 0x79, 0x42, 0x9A, 0x22, 0x92, 0x22, 0x92, 0x24, 0x51, 0xC3, 0x40, 0xE3, 0x48, 
-    0x61, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x41, 0x00, 0x41, 0x00, 0xC4, 0x08, 
-    0x89, 0x19, 0x69, 0x19, 0x89, 0x19, 0xC9, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0x0B, 0x12, 
-    0x0C, 0x1A, 0x2C, 0x12, 0x0B, 0x2A, 0xA4, 0x91, 0x84, 0x89, 0xA4, 0x99, 0x61, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x42, 0x9A, 0x21, 0x92, 0x84, 0x81, 
-    0xA9, 0x68, 0xC9, 0x68, 0xC8, 0x68, 0x0C, 0x2A, 0x8E, 0x12, 0x8E, 0x12, 0x6D, 0x22, 0x0C, 0x32, 
-    0x2C, 0x2A, 0x0C, 0x32, 0x03, 0x7A, 0x01, 0x8A, 0x21, 0x8A, 0x24, 0x69, 0x66, 0x50, 0x86, 0x58, 
-    0xA5, 0x58, 0x02, 0x61, 0x02, 0x61, 0x02, 0x61, 0x82, 0x69, 0x83, 0x69, 0x83, 0x69, 0x83, 0x69, 
-    0x82, 0x71, 0x82, 0x69, 0xC2, 0x79, 0x42, 0x9A, 0x42, 0x9A, 0x42, 0x9A, 0x62, 0xA2, 0x62, 0xA2, 
-    0x82, 0xAA, 0x02, 0x8A, 0xA2, 0x71, 0xA2, 0x79, 0xA2, 0x79, 0x48, 0x39, 0x29, 0x29, 0x6A, 0x31, 
-    0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x11, 0xC9, 0x19, 0xC9, 0x19, 0xC9, 0x19, 
-    0xC9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xCA, 0x11, 0xEA, 0x11, 0xEA, 0x11, 0xEA, 0x11, 0x69, 0x29, 
-    0xE9, 0x38, 0x09, 0x31, 0xE8, 0x40, 0xA7, 0x78, 0xA7, 0x80, 0xC7, 0x88, 0x22, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x71, 0x62, 0xA2, 0x61, 0x9A, 0x85, 0x81, 
-    0x8A, 0x50, 0xC9, 0x58, 0xA9, 0x58, 0x0C, 0x2A, 0x8E, 0x12, 0x6D, 0x12, 0x8E, 0x12, 0x8E, 0x12, 
-    0x8E, 0x12, 0x8F, 0x0A, 0x44, 0x7A, 0x21, 0x92, 0x62, 0x92, 0x44, 0x71, 0x86, 0x58, 0xA6, 0x58, 
-    0xC5, 0x58, 0x02, 0x61, 0x02, 0x61, 0x02, 0x61, 0x83, 0x69, 0x83, 0x69, 0x83, 0x69, 0xA3, 0x69, 
-    0xA3, 0x71, 0x83, 0x69, 0xC2, 0x79, 0x42, 0x92, 0x42, 0x92, 0x42, 0x92, 0x42, 0x9A, 0x42, 0xA2, 
-    0x62, 0xA2, 0x02, 0x92, 0xA2, 0x71, 0xC2, 0x79, 0xC2, 0x71, 0x48, 0x39, 0x29, 0x31, 0x4A, 0x39, 
-    0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x11, 0xCA, 0x19, 0xA9, 0x19, 0xA9, 0x11, 
-    0xA9, 0x11, 0xA9, 0x11, 0xC9, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0xEA, 0x11, 0x49, 0x29, 
-    0x09, 0x31, 0x29, 0x31, 0xE8, 0x48, 0xC7, 0x80, 0xC6, 0x80, 0xC7, 0x88, 0x21, 0x20, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x71, 0x81, 0xA2, 0x81, 0x9A, 0x84, 0x81, 
-    0x69, 0x60, 0xA8, 0x60, 0x68, 0x68, 0xEC, 0x29, 0xCE, 0x0A, 0xAE, 0x12, 0xAE, 0x0A, 0xAE, 0x0A, 
-    0xAE, 0x0A, 0xAF, 0x0A, 0x64, 0x7A, 0x41, 0x92, 0x81, 0x92, 0x24, 0x69, 0x46, 0x50, 0x66, 0x50, 
-    0xA5, 0x58, 0x02, 0x69, 0x02, 0x69, 0x02, 0x69, 0x82, 0x71, 0x82, 0x71, 0x82, 0x71, 0x82, 0x71, 
-    0x82, 0x71, 0x82, 0x71, 0xC2, 0x81, 0x41, 0xA2, 0x41, 0x9A, 0x21, 0x9A, 0x41, 0x9A, 0x42, 0xA2, 
-    0x62, 0xA2, 0x01, 0x92, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x68, 0x39, 0x49, 0x21, 0x49, 0x31, 
-    0xC6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x11, 0xE9, 0x19, 0xC9, 0x11, 0xC9, 0x19, 
-    0xA9, 0x11, 0xA9, 0x11, 0xC9, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0xCA, 0x11, 0x49, 0x29, 
-    0x09, 0x31, 0x29, 0x29, 0xE8, 0x50, 0xA6, 0x88, 0xA6, 0x88, 0xC7, 0x90, 0x22, 0x28, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE0, 0x40, 0x81, 0x69, 0x61, 0x61, 0x81, 0x61, 0x83, 0x79, 0x85, 0x79, 0x64, 0x81, 0x88, 0x59, 
-    0xED, 0x29, 0xED, 0x29, 0xED, 0x29, 0xAC, 0x39, 0xAC, 0x39, 0xAC, 0x31, 0xAB, 0x39, 0xAB, 0x49, 
-    0x8B, 0x49, 0xAB, 0x49, 0x66, 0x69, 0x64, 0x71, 0x45, 0x69, 0xE4, 0x81, 0x24, 0x8A, 0x24, 0x8A, 
-    0x04, 0x82, 0xC5, 0x48, 0xC5, 0x40, 0xC5, 0x48, 0x87, 0x31, 0xC8, 0x29, 0xC8, 0x29, 0xA7, 0x29, 
-    0x86, 0x29, 0x87, 0x29, 0xC6, 0x39, 0x26, 0x62, 0x06, 0x62, 0x26, 0x62, 0x04, 0x7A, 0xC3, 0x81, 
-    0xC3, 0x81, 0x05, 0x6A, 0x6B, 0x32, 0x49, 0x42, 0x28, 0x42, 0x08, 0x71, 0x88, 0x78, 0xA8, 0x78, 
-    0x88, 0x60, 0x45, 0x20, 0x65, 0x20, 0x65, 0x28, 0x28, 0x21, 0x68, 0x21, 0x48, 0x21, 0x89, 0x19, 
-    0xC9, 0x11, 0xA9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xE9, 0x40, 
-    0xA9, 0x48, 0xA9, 0x48, 0x29, 0x41, 0x2B, 0x2A, 0xEB, 0x29, 0x2C, 0x32, 0xC4, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x69, 0xA2, 0xAA, 0x62, 0xA2, 0x82, 0xA2, 0xE8, 0x68, 0x6A, 0x50, 0x69, 0x60, 0x6C, 0x39, 
-    0xF0, 0x02, 0xAF, 0x0A, 0xF0, 0x02, 0x2A, 0x51, 0x48, 0x70, 0x89, 0x68, 0x68, 0x78, 0x47, 0x90, 
-    0x47, 0x90, 0x46, 0x90, 0x67, 0x60, 0x67, 0x50, 0x27, 0x48, 0x24, 0x8A, 0x63, 0xB3, 0x43, 0xAB, 
-    0xE3, 0x9A, 0xA7, 0x28, 0x88, 0x28, 0x88, 0x28, 0xA9, 0x09, 0xEA, 0x09, 0xEA, 0x09, 0xA8, 0x09, 
-    0x87, 0x11, 0x87, 0x11, 0xC9, 0x11, 0x6D, 0x0A, 0x4D, 0x0A, 0x8D, 0x02, 0xCB, 0x49, 0x29, 0x79, 
-    0x29, 0x79, 0xEC, 0x51, 0x72, 0x03, 0x31, 0x03, 0x51, 0x03, 0xEA, 0x80, 0x07, 0xB0, 0x28, 0xB0, 
-    0x68, 0x90, 0xA8, 0x38, 0xA8, 0x40, 0xA8, 0x40, 0xE8, 0x28, 0xE7, 0x20, 0xE7, 0x20, 0x28, 0x21, 
-    0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xA9, 0x19, 0xA8, 0x50, 
-    0x89, 0x50, 0x68, 0x58, 0x4A, 0x39, 0xAC, 0x02, 0x6C, 0x02, 0xAD, 0x02, 0xE4, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x61, 0x61, 0x62, 0xA2, 0x21, 0x92, 0x41, 0x9A, 0xE7, 0x68, 0x89, 0x58, 0x68, 0x68, 0x8C, 0x41, 
-    0xD0, 0x0A, 0x8F, 0x12, 0xD0, 0x0A, 0x0A, 0x51, 0x69, 0x68, 0xA9, 0x60, 0xA8, 0x70, 0x67, 0x88, 
-    0x67, 0x80, 0x67, 0x88, 0x87, 0x68, 0x86, 0x58, 0x66, 0x50, 0x24, 0x8A, 0x23, 0xAB, 0x03, 0xAB, 
-    0xE3, 0x9A, 0xA7, 0x30, 0x87, 0x28, 0x87, 0x28, 0xA9, 0x11, 0xE9, 0x11, 0xE9, 0x11, 0xA8, 0x11, 
-    0x87, 0x11, 0x87, 0x11, 0xC8, 0x11, 0x6C, 0x1A, 0x4C, 0x1A, 0x6C, 0x12, 0xAA, 0x51, 0x29, 0x79, 
-    0x29, 0x79, 0x0C, 0x4A, 0x51, 0x03, 0x10, 0x03, 0x50, 0x03, 0x09, 0x81, 0x07, 0xA8, 0x28, 0xA8, 
-    0x48, 0x90, 0xA8, 0x30, 0xA8, 0x38, 0x88, 0x38, 0xE8, 0x28, 0x08, 0x21, 0xE7, 0x20, 0x28, 0x21, 
-    0xC9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0x89, 0x19, 0x89, 0x50, 
-    0x89, 0x50, 0x49, 0x50, 0x8A, 0x31, 0xAD, 0x0A, 0x8C, 0x0A, 0xCD, 0x12, 0x05, 0x01, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x81, 0x61, 0x62, 0x9A, 0x22, 0x92, 0x42, 0x92, 0x08, 0x61, 0xA9, 0x50, 0xA9, 0x58, 0x8B, 0x39, 
-    0x8F, 0x1A, 0x6E, 0x1A, 0x8F, 0x1A, 0x2A, 0x51, 0xA9, 0x60, 0xC9, 0x58, 0xA8, 0x68, 0x67, 0x80, 
-    0x88, 0x78, 0x87, 0x80, 0xA7, 0x60, 0xA7, 0x50, 0x87, 0x50, 0x24, 0x8A, 0x03, 0xA3, 0xE3, 0xA2, 
-    0xC4, 0x9A, 0xE6, 0x40, 0xA7, 0x38, 0xC7, 0x38, 0x89, 0x19, 0xA9, 0x11, 0xA9, 0x11, 0x88, 0x19, 
-    0x67, 0x19, 0x47, 0x19, 0xA8, 0x19, 0x6C, 0x12, 0x4C, 0x12, 0x6C, 0x0A, 0xAA, 0x51, 0x29, 0x79, 
-    0x29, 0x71, 0x0C, 0x52, 0x31, 0x13, 0xF0, 0x12, 0x10, 0x13, 0x4A, 0x79, 0x67, 0x98, 0x68, 0x98, 
-    0x88, 0x80, 0xC7, 0x40, 0xC7, 0x48, 0xA7, 0x48, 0xE7, 0x28, 0x07, 0x21, 0xE7, 0x20, 0x28, 0x21, 
-    0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x19, 0xA9, 0x19, 0xA9, 0x19, 0x89, 0x21, 0xC7, 0x58, 
-    0xC7, 0x58, 0xA7, 0x60, 0x89, 0x39, 0x09, 0x02, 0xC9, 0x09, 0x0A, 0x0A, 0xA3, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x51, 0x03, 0x82, 0xE3, 0x71, 0xE3, 0x79, 0x2A, 0x2A, 0x4B, 0x12, 0x6B, 0x12, 0xEB, 0x29, 
-    0x0B, 0x61, 0x2B, 0x59, 0x0B, 0x61, 0x4C, 0x1A, 0x6C, 0x02, 0x8C, 0x0A, 0x8A, 0x31, 0xEA, 0x50, 
-    0x0A, 0x51, 0x0A, 0x51, 0x0B, 0x2A, 0x4C, 0x1A, 0x4B, 0x1A, 0x29, 0x51, 0xE8, 0x60, 0xE9, 0x58, 
-    0x27, 0x61, 0xE2, 0x79, 0xC2, 0x71, 0xE2, 0x79, 0xC6, 0x30, 0x87, 0x20, 0xA7, 0x20, 0x87, 0x28, 
-    0x87, 0x28, 0x87, 0x28, 0xE8, 0x20, 0x2B, 0x12, 0x0B, 0x12, 0x2B, 0x0A, 0x8A, 0x49, 0x29, 0x69, 
-    0x29, 0x61, 0x09, 0x81, 0xEA, 0xB8, 0xEA, 0xB0, 0xCA, 0xC0, 0x0B, 0x42, 0x6C, 0x0A, 0x6C, 0x0A, 
-    0x2A, 0x2A, 0x22, 0x79, 0x23, 0x71, 0x22, 0x79, 0x25, 0x31, 0x06, 0x09, 0x06, 0x11, 0x26, 0x11, 
-    0x47, 0x11, 0x47, 0x11, 0x47, 0x09, 0x49, 0x29, 0x4B, 0x39, 0x4B, 0x31, 0x68, 0x49, 0xC2, 0x81, 
-    0xA2, 0x79, 0xC2, 0x81, 0x42, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x59, 0x03, 0x82, 0xE3, 0x79, 0xE3, 0x79, 0x29, 0x2A, 0x6B, 0x0A, 0x8B, 0x0A, 0x0B, 0x22, 
-    0x0B, 0x59, 0x2B, 0x59, 0x2B, 0x59, 0x4C, 0x12, 0x8C, 0x02, 0xAC, 0x02, 0xAB, 0x31, 0xEA, 0x50, 
-    0x0A, 0x51, 0x0A, 0x51, 0x2B, 0x22, 0x6C, 0x1A, 0x4C, 0x1A, 0x09, 0x51, 0xC9, 0x58, 0xC9, 0x50, 
-    0x27, 0x61, 0xE2, 0x71, 0xC3, 0x71, 0xE2, 0x79, 0xE6, 0x38, 0x87, 0x20, 0xA7, 0x28, 0xA7, 0x28, 
-    0x87, 0x28, 0x87, 0x28, 0x08, 0x21, 0x2B, 0x12, 0x0B, 0x12, 0x0B, 0x0A, 0x8A, 0x49, 0x29, 0x69, 
-    0x29, 0x59, 0x09, 0x81, 0xAA, 0xC0, 0xC9, 0xB8, 0xA9, 0xC8, 0xEB, 0x41, 0x8C, 0x02, 0x6C, 0x02, 
-    0x2A, 0x22, 0x22, 0x79, 0x23, 0x71, 0x22, 0x79, 0x25, 0x31, 0x06, 0x09, 0x06, 0x11, 0x26, 0x11, 
-    0x47, 0x11, 0x47, 0x11, 0x47, 0x11, 0x49, 0x29, 0x6B, 0x39, 0x4B, 0x31, 0x68, 0x51, 0xA2, 0x79, 
-    0xA2, 0x79, 0xC2, 0x81, 0x22, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x62, 0x59, 0x03, 0x82, 0xE3, 0x71, 0xE3, 0x79, 0x2A, 0x22, 0x6B, 0x0A, 0x6B, 0x0A, 0x0B, 0x2A, 
-    0xEB, 0x60, 0x0B, 0x59, 0x2B, 0x59, 0x8C, 0x0A, 0x8C, 0x02, 0xAC, 0x02, 0xAB, 0x31, 0xEA, 0x58, 
-    0x0A, 0x51, 0xEA, 0x50, 0x2B, 0x22, 0x6C, 0x1A, 0x4C, 0x22, 0x09, 0x51, 0xA8, 0x60, 0xA9, 0x58, 
-    0x07, 0x61, 0xE2, 0x79, 0xE2, 0x79, 0xE2, 0x81, 0xE5, 0x38, 0x67, 0x18, 0x87, 0x20, 0x67, 0x20, 
-    0x88, 0x20, 0x67, 0x20, 0xE8, 0x20, 0x2B, 0x12, 0x0B, 0x12, 0x2B, 0x12, 0x69, 0x51, 0x29, 0x69, 
-    0x29, 0x61, 0x09, 0x81, 0xAA, 0xD0, 0xAA, 0xC8, 0x8A, 0xD8, 0xEC, 0x41, 0x8C, 0x02, 0x6D, 0x0A, 
-    0x2A, 0x2A, 0x22, 0x81, 0x22, 0x79, 0x22, 0x81, 0x25, 0x39, 0x06, 0x09, 0x06, 0x11, 0x26, 0x11, 
-    0x47, 0x09, 0x47, 0x09, 0x47, 0x09, 0x4A, 0x29, 0x6B, 0x39, 0x6B, 0x31, 0x87, 0x51, 0xE2, 0x89, 
-    0xC3, 0x81, 0xE3, 0x89, 0x42, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xE4, 0x68, 0x46, 0x91, 0x26, 0x89, 0x06, 0x81, 0xC7, 0x60, 0xE8, 0x58, 0xC8, 0x60, 0x29, 0x49, 
-    0xEA, 0x21, 0xCA, 0x21, 0xCA, 0x21, 0x29, 0x51, 0x09, 0x59, 0xE9, 0x58, 0x6A, 0x41, 0xAB, 0x31, 
-    0x8B, 0x39, 0x8B, 0x39, 0x09, 0x51, 0xE8, 0x58, 0xC8, 0x58, 0x89, 0x39, 0x2B, 0x1A, 0x0B, 0x22, 
-    0xCA, 0x31, 0xE6, 0x48, 0x06, 0x49, 0x06, 0x49, 0xA4, 0x69, 0x03, 0x7A, 0x03, 0x7A, 0xC4, 0x71, 
-    0x64, 0x59, 0x44, 0x61, 0x66, 0x51, 0x8B, 0x29, 0x8B, 0x29, 0x8B, 0x31, 0x68, 0x21, 0x47, 0x21, 
-    0x47, 0x21, 0x48, 0x31, 0x8A, 0x51, 0x8A, 0x51, 0x6A, 0x59, 0xC9, 0x21, 0x09, 0x0A, 0xE9, 0x11, 
-    0xC8, 0x19, 0x26, 0x39, 0x27, 0x39, 0x27, 0x39, 0x68, 0x21, 0x88, 0x11, 0x88, 0x11, 0x48, 0x21, 
-    0xC8, 0x40, 0xE8, 0x40, 0xC8, 0x40, 0x85, 0x61, 0xC3, 0x71, 0xC4, 0x69, 0xC3, 0x71, 0xC1, 0x38, 
-    0x81, 0x28, 0x80, 0x28, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA5, 0x70, 0xE7, 0x98, 0xE7, 0x90, 0xA7, 0x80, 0x87, 0x68, 0x87, 0x70, 0x67, 0x78, 0x28, 0x49, 
-    0x2A, 0x0A, 0x0A, 0x12, 0xEA, 0x11, 0xA8, 0x68, 0x88, 0x70, 0x68, 0x70, 0x4A, 0x49, 0xEC, 0x29, 
-    0xCC, 0x31, 0xCC, 0x31, 0xA8, 0x60, 0x87, 0x60, 0x67, 0x68, 0xA9, 0x31, 0xCC, 0x02, 0xAC, 0x02, 
-    0x4C, 0x0A, 0x68, 0x30, 0x89, 0x30, 0x49, 0x28, 0x04, 0x7A, 0xC1, 0xA2, 0xA2, 0xA2, 0x62, 0x92, 
-    0xC2, 0x79, 0xE2, 0x79, 0xA4, 0x71, 0x4A, 0x39, 0x4B, 0x39, 0x6B, 0x39, 0x67, 0x19, 0x46, 0x11, 
-    0x46, 0x11, 0x87, 0x11, 0xEA, 0x09, 0xEA, 0x09, 0xEA, 0x01, 0xA7, 0x11, 0x86, 0x11, 0xA6, 0x11, 
-    0x87, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x89, 0x11, 0xC9, 0x11, 0xC9, 0x11, 0x69, 0x29, 
-    0x89, 0x68, 0x89, 0x60, 0x89, 0x60, 0xA3, 0x71, 0xE2, 0x71, 0xC2, 0x71, 0xC2, 0x71, 0x20, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xA5, 0x78, 0xC7, 0xA8, 0xC6, 0xA0, 0xA6, 0x88, 0x67, 0x70, 0x87, 0x70, 0x47, 0x78, 0x49, 0x39, 
-    0x4B, 0x02, 0x0A, 0x0A, 0xEA, 0x11, 0x88, 0x68, 0x88, 0x70, 0x68, 0x70, 0x4A, 0x49, 0xEC, 0x29, 
-    0xCC, 0x31, 0xCB, 0x31, 0xA8, 0x60, 0x87, 0x68, 0x67, 0x70, 0x89, 0x39, 0xCD, 0x02, 0xAC, 0x02, 
-    0x4C, 0x0A, 0x68, 0x38, 0x88, 0x38, 0x69, 0x30, 0x04, 0x82, 0xA1, 0xA2, 0xA2, 0xA2, 0x42, 0x92, 
-    0xA2, 0x79, 0xC2, 0x81, 0xA3, 0x71, 0x6A, 0x39, 0x4B, 0x39, 0x4B, 0x39, 0x68, 0x11, 0x47, 0x09, 
-    0x47, 0x11, 0x68, 0x09, 0xCB, 0x09, 0xCA, 0x09, 0xCA, 0x09, 0xA8, 0x09, 0xA7, 0x09, 0xA7, 0x09, 
-    0x88, 0x09, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x89, 0x09, 0xAA, 0x09, 0xAA, 0x01, 0x49, 0x29, 
-    0x89, 0x68, 0xA9, 0x60, 0x89, 0x60, 0xC4, 0x79, 0x03, 0x7A, 0x03, 0x7A, 0x03, 0x7A, 0x40, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x06, 0x51, 0x69, 0x69, 0x49, 0x69, 0x28, 0x61, 0xE8, 0x48, 0xE8, 0x50, 0xE8, 0x50, 0x29, 0x41, 
-    0x89, 0x29, 0x69, 0x29, 0x8A, 0x29, 0xE9, 0x48, 0xE9, 0x50, 0xC9, 0x50, 0x2A, 0x41, 0x6B, 0x39, 
-    0x6B, 0x39, 0x6B, 0x39, 0xE8, 0x40, 0x08, 0x41, 0xE8, 0x40, 0x69, 0x31, 0x0A, 0x22, 0xEA, 0x29, 
-    0xA9, 0x31, 0xC8, 0x28, 0xC8, 0x28, 0xC8, 0x28, 0xC5, 0x59, 0x23, 0x7A, 0x24, 0x7A, 0x04, 0x72, 
-    0xC5, 0x59, 0xC5, 0x59, 0xA6, 0x51, 0x8A, 0x29, 0x8A, 0x29, 0x8B, 0x29, 0x66, 0x31, 0x65, 0x31, 
-    0x45, 0x29, 0xA6, 0x39, 0x27, 0x52, 0x07, 0x4A, 0x08, 0x42, 0xC6, 0x31, 0xA5, 0x31, 0xA5, 0x31, 
-    0x86, 0x31, 0x68, 0x29, 0x67, 0x31, 0x67, 0x31, 0xE7, 0x49, 0x07, 0x42, 0x27, 0x4A, 0x87, 0x49, 
-    0x89, 0x50, 0x89, 0x50, 0x88, 0x58, 0x22, 0x49, 0x41, 0x49, 0x42, 0x49, 0x21, 0x49, 0x20, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC9, 0x01, 0x6C, 0x02, 0x6C, 0x02, 0x4B, 0x0A, 0xCA, 0x11, 0xCA, 0x11, 0xEA, 0x09, 0xE8, 0x38, 
-    0x48, 0x60, 0x68, 0x58, 0xA8, 0x48, 0xAA, 0x09, 0xAA, 0x09, 0xCA, 0x09, 0x0A, 0x31, 0x49, 0x58, 
-    0x69, 0x50, 0x69, 0x50, 0x89, 0x11, 0xA9, 0x09, 0xAA, 0x01, 0x28, 0x29, 0x85, 0x68, 0x86, 0x60, 
-    0xA6, 0x60, 0x87, 0x11, 0x87, 0x09, 0x67, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x89, 0x11, 
-    0xEB, 0x11, 0xCB, 0x11, 0xEB, 0x11, 0xEA, 0x11, 0xEA, 0x11, 0xEA, 0x11, 0x83, 0x61, 0x61, 0x79, 
-    0x42, 0x69, 0xE1, 0x91, 0xA1, 0xCA, 0x81, 0xC2, 0x81, 0xCA, 0x01, 0x9A, 0xA1, 0x79, 0xA1, 0x81, 
-    0x01, 0x8A, 0xE2, 0xC2, 0x01, 0xC3, 0x01, 0xC3, 0xE1, 0xAA, 0xE1, 0xA2, 0x00, 0xB3, 0xE4, 0x81, 
-    0x69, 0x38, 0x88, 0x40, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0xC9, 0x09, 0x6C, 0x12, 0x2B, 0x0A, 0x2B, 0x0A, 0xCA, 0x11, 0xCA, 0x11, 0xEA, 0x09, 0x09, 0x39, 
-    0x68, 0x50, 0x88, 0x50, 0xC9, 0x48, 0x8A, 0x11, 0x8A, 0x11, 0xAA, 0x09, 0x0A, 0x31, 0x69, 0x58, 
-    0x89, 0x50, 0x89, 0x50, 0x69, 0x19, 0x89, 0x11, 0x8A, 0x09, 0x48, 0x29, 0xA6, 0x60, 0xC6, 0x58, 
-    0xC6, 0x58, 0x67, 0x19, 0x67, 0x11, 0x67, 0x11, 0x68, 0x11, 0x68, 0x11, 0x68, 0x11, 0xA9, 0x19, 
-    0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x19, 0xEA, 0x11, 0xEA, 0x11, 0xEA, 0x11, 0x64, 0x61, 0x62, 0x71, 
-    0x42, 0x69, 0xE2, 0x89, 0x81, 0xBA, 0x61, 0xBA, 0x81, 0xC2, 0x01, 0x92, 0xC2, 0x79, 0xC2, 0x79, 
-    0x01, 0x8A, 0x01, 0xCB, 0x01, 0xC3, 0x01, 0xC3, 0xE2, 0xA2, 0xE2, 0x9A, 0x01, 0xAB, 0xE5, 0x79, 
-    0x69, 0x40, 0x89, 0x48, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x88, 0x09, 0x4B, 0x0A, 0x2B, 0x0A, 0x2B, 0x12, 0xCA, 0x19, 0xAA, 0x19, 0xCA, 0x11, 0x09, 0x39, 
-    0x68, 0x58, 0x88, 0x50, 0xA8, 0x48, 0x8A, 0x11, 0x8A, 0x11, 0xA9, 0x09, 0x09, 0x31, 0x69, 0x58, 
-    0x89, 0x50, 0x89, 0x50, 0x69, 0x19, 0x89, 0x11, 0xA9, 0x09, 0x28, 0x31, 0xA6, 0x60, 0xC6, 0x58, 
-    0xC6, 0x58, 0x67, 0x19, 0x67, 0x11, 0x67, 0x11, 0x68, 0x11, 0x68, 0x11, 0x67, 0x19, 0xA9, 0x19, 
-    0xEA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0xCA, 0x19, 0x63, 0x59, 0x41, 0x71, 
-    0x42, 0x69, 0xC1, 0x89, 0x81, 0xBA, 0x61, 0xBA, 0x81, 0xC2, 0xE1, 0x89, 0x82, 0x71, 0xA2, 0x71, 
-    0xE1, 0x81, 0xE1, 0xC2, 0xE1, 0xBA, 0xE1, 0xC2, 0xA1, 0xA2, 0x82, 0x92, 0xA1, 0xA2, 0x84, 0x69, 
-    0x48, 0x38, 0x88, 0x40, 0x67, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x20, 0x00, 0x21, 0x00, 0x41, 0x00, 0x61, 0x08, 0x43, 0x59, 0x83, 0x69, 0x82, 0x69, 0x46, 0x41, 
-    0x29, 0x21, 0x28, 0x29, 0x28, 0x29, 0x07, 0x21, 0x07, 0x21, 0x27, 0x19, 0xE8, 0x30, 0xA9, 0x48, 
-    0xA9, 0x40, 0xA9, 0x48, 0xE5, 0x40, 0x03, 0x41, 0x03, 0x41, 0xE3, 0x40, 0xE2, 0x40, 0xE2, 0x40, 
-    0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xC2, 0x38, 0xC2, 0x30, 0xC2, 0x30, 0xC2, 0x40, 
-    0xC2, 0x48, 0xC2, 0x48, 0xC2, 0x48, 0xA2, 0x40, 0xA2, 0x40, 0xC2, 0x40, 0xA1, 0x40, 0x81, 0x40, 
-    0x81, 0x40, 0xA1, 0x50, 0x21, 0x79, 0x21, 0x79, 0x21, 0x71, 0x02, 0x61, 0x02, 0x59, 0x02, 0x59, 
-    0x22, 0x69, 0x82, 0x89, 0x82, 0x89, 0x82, 0x89, 0x82, 0x89, 0x62, 0x81, 0xA2, 0x91, 0xC1, 0x40, 
-    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x61, 0x62, 0x71, 0x61, 0x71, 0x45, 0x41, 
-    0x49, 0x11, 0x28, 0x19, 0x28, 0x19, 0xE7, 0x20, 0xE7, 0x20, 0xE6, 0x18, 0xC8, 0x30, 0xA9, 0x48, 
-    0xA9, 0x40, 0xA9, 0x48, 0xE3, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 
-    0xE2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xA2, 0x38, 0xA2, 0x38, 0xA1, 0x38, 0xA1, 0x40, 
-    0xA1, 0x50, 0xA1, 0x48, 0xA1, 0x48, 0x81, 0x48, 0x81, 0x48, 0xA1, 0x48, 0x81, 0x40, 0x81, 0x40, 
-    0x81, 0x40, 0xA1, 0x48, 0xE1, 0x68, 0x01, 0x71, 0xE1, 0x68, 0x02, 0x61, 0x22, 0x61, 0x22, 0x61, 
-    0x42, 0x69, 0x82, 0x89, 0x82, 0x89, 0x82, 0x89, 0x82, 0x89, 0x82, 0x89, 0xC2, 0x91, 0xC1, 0x40, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x69, 0xA2, 0x79, 0xA2, 0x79, 0x66, 0x49, 
-    0x4A, 0x19, 0x49, 0x21, 0x49, 0x21, 0x07, 0x21, 0x07, 0x21, 0x07, 0x21, 0xC9, 0x38, 0x8A, 0x48, 
-    0xAA, 0x40, 0xAA, 0x40, 0xE4, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x38, 0xE2, 0x38, 
-    0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x38, 0xA2, 0x40, 
-    0xA2, 0x48, 0xA2, 0x48, 0xA1, 0x48, 0x81, 0x40, 0x81, 0x40, 0x81, 0x40, 0x81, 0x40, 0x61, 0x40, 
-    0x61, 0x38, 0x81, 0x40, 0xC1, 0x68, 0xE1, 0x68, 0xE1, 0x68, 0xC1, 0x60, 0xC1, 0x58, 0xC1, 0x58, 
-    0xE1, 0x60, 0x21, 0x81, 0x21, 0x81, 0x21, 0x81, 0x42, 0x81, 0x42, 0x81, 0x62, 0x89, 0x81, 0x38, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x30, 0xC1, 0x38, 0xC0, 0x38, 0xA2, 0x28, 
-    0x84, 0x08, 0xA4, 0x10, 0x84, 0x10, 0x83, 0x10, 0x84, 0x10, 0x84, 0x10, 0xA5, 0x30, 0xC6, 0x48, 
-    0xC5, 0x40, 0xC6, 0x48, 0x23, 0x51, 0x22, 0x51, 0x22, 0x51, 0x22, 0x51, 0x02, 0x49, 0x02, 0x49, 
-    0x02, 0x49, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0xE2, 0x50, 
-    0x22, 0x61, 0x02, 0x61, 0x42, 0x69, 0xC2, 0x81, 0xC2, 0x81, 0xC2, 0x81, 0xE2, 0x81, 0x02, 0x82, 
-    0xE2, 0x81, 0xC2, 0x81, 0xC2, 0x89, 0xC2, 0x89, 0xA1, 0x81, 0x4D, 0xB4, 0x51, 0xC5, 0x10, 0xBD, 
-    0x10, 0xC5, 0xCE, 0xCC, 0xAE, 0xC4, 0xAE, 0xC4, 0x66, 0xBB, 0x04, 0xB3, 0x65, 0xC3, 0x41, 0x49, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x30, 0x01, 0x51, 
-    0xE1, 0x48, 0x01, 0x51, 0x62, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x62, 0x61, 
-    0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x02, 0x51, 0x02, 0x51, 0x02, 0x51, 0x22, 0x61, 
-    0x62, 0x71, 0x42, 0x69, 0x82, 0x79, 0x42, 0x9A, 0x42, 0x9A, 0x42, 0x9A, 0x82, 0xA2, 0xA3, 0xA2, 
-    0xA3, 0xA2, 0xA3, 0xA2, 0x83, 0x9A, 0x83, 0x9A, 0x22, 0x92, 0xB1, 0xDD, 0x38, 0xF7, 0xF7, 0xEE, 
-    0xF7, 0xF6, 0xD6, 0xEE, 0xF6, 0xEE, 0xF7, 0xEE, 0xE9, 0xE4, 0x45, 0xDC, 0xE6, 0xEC, 0xE2, 0x59, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x30, 0x02, 0x51, 
-    0xE2, 0x40, 0x02, 0x49, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 0x42, 0x59, 0x42, 0x59, 0x42, 0x59, 
-    0x42, 0x59, 0x22, 0x59, 0x42, 0x59, 0x42, 0x59, 0x02, 0x51, 0x02, 0x51, 0x02, 0x49, 0x22, 0x59, 
-    0x42, 0x69, 0x22, 0x69, 0x82, 0x71, 0x22, 0x92, 0x22, 0x92, 0x02, 0x92, 0x62, 0x9A, 0x83, 0x9A, 
-    0x83, 0x9A, 0x63, 0x9A, 0x43, 0x9A, 0x63, 0x9A, 0x02, 0x92, 0x50, 0xD5, 0xD7, 0xEE, 0x95, 0xE6, 
-    0x95, 0xE6, 0xB5, 0xEE, 0xB5, 0xEE, 0xD6, 0xEE, 0xA8, 0xDC, 0x05, 0xD4, 0xA6, 0xEC, 0xC2, 0x59, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0x02, 0x49, 
-    0xC2, 0x40, 0x22, 0x51, 0xE3, 0x71, 0xC3, 0x71, 0xC3, 0x71, 0xA2, 0x69, 0x82, 0x69, 0x82, 0x69, 
-    0x62, 0x61, 0x22, 0x59, 0x42, 0x59, 0x42, 0x59, 0x02, 0x51, 0x02, 0x51, 0x02, 0x49, 0x22, 0x61, 
-    0x62, 0x71, 0x42, 0x69, 0xA2, 0x79, 0x42, 0x9A, 0x42, 0x9A, 0x42, 0x9A, 0x83, 0xA2, 0xA3, 0xA2, 
-    0xA3, 0xA2, 0x83, 0xA2, 0x63, 0x9A, 0x83, 0x9A, 0x22, 0x92, 0x71, 0xD5, 0xF7, 0xEE, 0xB6, 0xEE, 
-    0x95, 0xE6, 0xD3, 0xCD, 0xB3, 0xCD, 0xD3, 0xCD, 0x88, 0xD4, 0x25, 0xD4, 0x86, 0xE4, 0x83, 0x7A, 
-    0x80, 0x18, 0x60, 0x10, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xE2, 0x48, 
-    0x82, 0x38, 0xC3, 0x69, 0xC6, 0xE4, 0x85, 0xDC, 0xC6, 0xE4, 0x64, 0xB3, 0x83, 0x9A, 0xC3, 0xA2, 
-    0x43, 0x92, 0x62, 0x71, 0x82, 0x71, 0x62, 0x71, 0x22, 0x59, 0x22, 0x59, 0x02, 0x51, 0xC2, 0x79, 
-    0x82, 0xA2, 0x42, 0x92, 0x83, 0x9A, 0x24, 0xBB, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 
-    0x24, 0xB3, 0x24, 0xB3, 0x04, 0xAB, 0x04, 0xB3, 0xC3, 0xAA, 0xB1, 0xD5, 0xD7, 0xEE, 0xD6, 0xEE, 
-    0xD3, 0xCD, 0x82, 0x10, 0x61, 0x10, 0xA2, 0x18, 0xC5, 0xBB, 0x45, 0xDC, 0x05, 0xD4, 0x45, 0xD4, 
-    0x66, 0xD4, 0x05, 0xCC, 0x25, 0xCC, 0x03, 0xB3, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xE2, 0x40, 
-    0x82, 0x38, 0xC3, 0x69, 0xA6, 0xE4, 0x66, 0xDC, 0xA6, 0xDC, 0x44, 0xB3, 0x83, 0x9A, 0xC3, 0xA2, 
-    0x43, 0x92, 0x82, 0x79, 0xA2, 0x79, 0x82, 0x79, 0x22, 0x59, 0x22, 0x59, 0x02, 0x51, 0xC2, 0x79, 
-    0x82, 0xA2, 0x62, 0x9A, 0x83, 0xA2, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 
-    0x24, 0xB3, 0x24, 0xB3, 0x04, 0xB3, 0x24, 0xB3, 0xE3, 0xAA, 0xB1, 0xDD, 0xD7, 0xEE, 0xD6, 0xEE, 
-    0xD3, 0xCD, 0x61, 0x10, 0x41, 0x10, 0xA2, 0x20, 0xE5, 0xC3, 0x25, 0xD4, 0x05, 0xD4, 0x45, 0xD4, 
-    0x66, 0xDC, 0x86, 0xDC, 0x86, 0xDC, 0x84, 0xD3, 0x23, 0xCB, 0x21, 0x41, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xE2, 0x40, 
-    0x82, 0x38, 0xC3, 0x69, 0xC6, 0xE4, 0x86, 0xDC, 0xC6, 0xE4, 0x24, 0xAB, 0x83, 0x9A, 0xA3, 0x9A, 
-    0x22, 0x8A, 0x62, 0x71, 0x82, 0x79, 0x61, 0x71, 0xE1, 0x50, 0xE1, 0x50, 0xC1, 0x48, 0xA2, 0x79, 
-    0x62, 0x9A, 0x42, 0x92, 0x83, 0xA2, 0x24, 0xBB, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 
-    0x24, 0xB3, 0x24, 0xB3, 0x04, 0xB3, 0x24, 0xB3, 0xE3, 0xB2, 0xB1, 0xDD, 0xD7, 0xEE, 0xD7, 0xEE, 
-    0xD4, 0xCD, 0x82, 0x10, 0x61, 0x10, 0xC2, 0x20, 0x05, 0xCC, 0x45, 0xD4, 0x25, 0xD4, 0x45, 0xD4, 
-    0x65, 0xDC, 0x66, 0xDC, 0x86, 0xDC, 0x43, 0xC3, 0xE3, 0xC2, 0x43, 0xD3, 0x01, 0x41, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xE2, 0x40, 
-    0xA2, 0x30, 0x83, 0x59, 0x25, 0xCC, 0x05, 0xCC, 0x05, 0xCC, 0x64, 0xBB, 0x44, 0xB3, 0x64, 0xBB, 
-    0xE3, 0xA2, 0x23, 0x8A, 0x43, 0x92, 0x43, 0x92, 0x43, 0x8A, 0x43, 0x8A, 0x23, 0x8A, 0xA3, 0xA2, 
-    0x04, 0xAB, 0xE3, 0xAA, 0x04, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 
-    0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0xE3, 0xB2, 0xB1, 0xDD, 0xD7, 0xEE, 0xD7, 0xEE, 
-    0xD3, 0xCD, 0x82, 0x10, 0x61, 0x10, 0xC2, 0x20, 0xC5, 0xC3, 0xE5, 0xCB, 0xE5, 0xCB, 0x06, 0xCC, 
-    0x47, 0xD4, 0x46, 0xD4, 0x47, 0xD4, 0xC6, 0xCB, 0x65, 0xC3, 0xA5, 0xD3, 0x23, 0x7A, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xC2, 0x38, 
-    0xA2, 0x30, 0x22, 0x51, 0x64, 0xB3, 0x44, 0xB3, 0x44, 0xB3, 0xA4, 0xC3, 0xA4, 0xC3, 0xC4, 0xCB, 
-    0x44, 0xB3, 0xC4, 0xA2, 0xE4, 0xA2, 0xE4, 0xAA, 0x45, 0xBB, 0x45, 0xBB, 0x45, 0xBB, 0x65, 0xBB, 
-    0x64, 0xBB, 0x65, 0xBB, 0x64, 0xBB, 0x24, 0xB3, 0x44, 0xBB, 0x44, 0xBB, 0x24, 0xB3, 0x24, 0xB3, 
-    0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0x24, 0xB3, 0xE3, 0xB2, 0xB1, 0xDD, 0xD7, 0xEE, 0xD6, 0xEE, 
-    0xD3, 0xC5, 0x82, 0x10, 0x61, 0x10, 0xC2, 0x20, 0x85, 0xB3, 0xA5, 0xC3, 0xA5, 0xBB, 0xC6, 0xC3, 
-    0x08, 0xC4, 0x08, 0xC4, 0x08, 0xC4, 0x48, 0xCC, 0x48, 0xCC, 0x89, 0xD4, 0x06, 0x93, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xC2, 0x40, 
-    0xA2, 0x30, 0x43, 0x51, 0x84, 0xBB, 0x84, 0xBB, 0x84, 0xBB, 0x84, 0xBB, 0xA4, 0xC3, 0xA4, 0xC3, 
-    0x24, 0xB3, 0xA4, 0x9A, 0xC4, 0xA2, 0xC4, 0xA2, 0x25, 0xB3, 0x25, 0xB3, 0x25, 0xB3, 0x44, 0xBB, 
-    0x64, 0xBB, 0x64, 0xBB, 0x44, 0xBB, 0x24, 0xB3, 0x24, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 0x44, 0xBB, 
-    0x44, 0xBB, 0x44, 0xBB, 0x24, 0xB3, 0x24, 0xB3, 0xE3, 0xB2, 0xD2, 0xDD, 0x18, 0xEF, 0x17, 0xF7, 
-    0xF4, 0xCD, 0x61, 0x08, 0x41, 0x08, 0xA2, 0x20, 0x65, 0xB3, 0xC5, 0xC3, 0xA5, 0xC3, 0xE6, 0xC3, 
-    0x28, 0xCC, 0x28, 0xCC, 0x28, 0xCC, 0x48, 0xCC, 0x48, 0xCC, 0x89, 0xDC, 0x67, 0xA3, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x28, 0xC2, 0x38, 
-    0x82, 0x30, 0x22, 0x51, 0x44, 0xB3, 0x24, 0xAB, 0x24, 0xAB, 0x84, 0xBB, 0xA4, 0xC3, 0xA4, 0xC3, 
-    0x44, 0xB3, 0xE4, 0xA2, 0xE4, 0xA2, 0xE4, 0xA2, 0x05, 0xAB, 0x05, 0xAB, 0x05, 0xAB, 0x44, 0xBB, 
-    0x64, 0xBB, 0x64, 0xBB, 0x64, 0xBB, 0x44, 0xB3, 0x44, 0xBB, 0x44, 0xBB, 0x04, 0xAB, 0xE4, 0xAA, 
-    0xE4, 0xA2, 0x04, 0xAB, 0x44, 0xBB, 0x24, 0xB3, 0x03, 0xB3, 0x0E, 0xCD, 0xF3, 0xDD, 0xF2, 0xDD, 
-    0x30, 0xBD, 0x02, 0x29, 0xC2, 0x28, 0x02, 0x31, 0x85, 0xBB, 0xA5, 0xC3, 0xA5, 0xC3, 0xC6, 0xC3, 
-    0xE7, 0xC3, 0xE7, 0xC3, 0xE7, 0xC3, 0xE7, 0xBB, 0xC7, 0xB3, 0xE8, 0xBB, 0xE5, 0x82, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x18, 0x22, 0x51, 0x02, 0x49, 0xE2, 0x48, 0x04, 0xA3, 0xE5, 0xCB, 0xA4, 0xC3, 
-    0xC4, 0xC3, 0xC4, 0xC3, 0xC5, 0xC3, 0x84, 0xBB, 0xC2, 0x71, 0xA2, 0x69, 0x82, 0x69, 0xC4, 0xA2, 
-    0xA4, 0xC3, 0x84, 0xBB, 0x84, 0xBB, 0x64, 0xBB, 0x64, 0xBB, 0x44, 0xBB, 0xC1, 0x28, 0x61, 0x10, 
-    0x21, 0x00, 0x62, 0x49, 0x64, 0xC3, 0x24, 0xB3, 0x24, 0xB3, 0xE3, 0xAA, 0xE3, 0xAA, 0xE4, 0xAA, 
-    0x24, 0xAB, 0xC6, 0xC3, 0xA5, 0xBB, 0xA5, 0xBB, 0xA5, 0xC3, 0xA5, 0xC3, 0xC5, 0xC3, 0x04, 0xAB, 
-    0xE2, 0x79, 0x02, 0x7A, 0x03, 0x82, 0xA1, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x10, 0x02, 0x49, 0xE2, 0x48, 0xC2, 0x40, 0x04, 0xA3, 0xC5, 0xCB, 0xA4, 0xBB, 
-    0xA4, 0xC3, 0xA4, 0xBB, 0xC5, 0xC3, 0x84, 0xBB, 0xA2, 0x71, 0x82, 0x69, 0x62, 0x61, 0xC3, 0xA2, 
-    0xA4, 0xC3, 0x84, 0xBB, 0x84, 0xBB, 0x64, 0xBB, 0x64, 0xBB, 0x44, 0xBB, 0xA1, 0x20, 0x41, 0x08, 
-    0x21, 0x00, 0x42, 0x49, 0x44, 0xBB, 0x04, 0xAB, 0x24, 0xB3, 0x04, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 
-    0x44, 0xAB, 0xA5, 0xBB, 0xA5, 0xBB, 0xA6, 0xBB, 0xA5, 0xC3, 0xA5, 0xBB, 0xC5, 0xC3, 0x04, 0xAB, 
-    0xA2, 0x71, 0xC2, 0x79, 0xC2, 0x79, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x10, 0x22, 0x51, 0x02, 0x49, 0xE2, 0x48, 0x64, 0xB3, 0x05, 0xD4, 0xC5, 0xC3, 
-    0xE5, 0xCB, 0xC5, 0xC3, 0xC5, 0xC3, 0xA4, 0xC3, 0xC2, 0x71, 0x82, 0x69, 0x62, 0x69, 0xE4, 0xA2, 
-    0xA4, 0xC3, 0x84, 0xBB, 0x84, 0xBB, 0x64, 0xBB, 0x64, 0xBB, 0x44, 0xBB, 0x81, 0x18, 0x21, 0x00, 
-    0x01, 0x00, 0x42, 0x49, 0x84, 0xCB, 0x44, 0xBB, 0x64, 0xC3, 0x44, 0xBB, 0x44, 0xB3, 0x44, 0xB3, 
-    0x85, 0xBB, 0xE6, 0xCB, 0xE6, 0xCB, 0xE6, 0xCB, 0xE5, 0xCB, 0xE5, 0xCB, 0x05, 0xD4, 0x44, 0xB3, 
-    0xE2, 0x79, 0x02, 0x82, 0x03, 0x82, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x08, 0x81, 0x20, 0x81, 0x28, 0x81, 0x20, 0x62, 0x51, 0x83, 0x59, 0x62, 0x59, 
-    0x62, 0x51, 0x22, 0x41, 0x22, 0x41, 0x22, 0x41, 0x82, 0x69, 0x82, 0x71, 0x62, 0x69, 0x83, 0x92, 
-    0x24, 0xAB, 0x04, 0xAB, 0x04, 0xAB, 0x64, 0xBB, 0x64, 0xBB, 0x64, 0xBB, 0x63, 0x8A, 0x23, 0x82, 
-    0x43, 0x82, 0x03, 0x7A, 0x82, 0x51, 0x62, 0x51, 0x62, 0x51, 0x62, 0x49, 0x62, 0x49, 0x62, 0x49, 
-    0x62, 0x49, 0xA3, 0x51, 0xA3, 0x51, 0xA3, 0x59, 0xC3, 0x69, 0xC3, 0x69, 0xC3, 0x69, 0x62, 0x51, 
-    0xE1, 0x38, 0xE1, 0x38, 0xE1, 0x40, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x41, 0x08, 0x82, 0x28, 0x82, 0x30, 0x82, 0x28, 
-    0x82, 0x28, 0x62, 0x18, 0x62, 0x18, 0x62, 0x20, 0x62, 0x61, 0x82, 0x71, 0x62, 0x69, 0x43, 0x8A, 
-    0xA3, 0x9A, 0x83, 0x9A, 0xA3, 0x9A, 0x44, 0xBB, 0x64, 0xBB, 0x64, 0xBB, 0x24, 0xBB, 0x23, 0xB3, 
-    0x44, 0xBB, 0x63, 0x8A, 0x01, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x21, 0x08, 0x21, 0x08, 0x41, 0x08, 0x61, 0x28, 0x61, 0x28, 0x62, 0x30, 0x00, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x21, 0x00, 0x82, 0x20, 0xA2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x28, 0xA2, 0x20, 0xA2, 0x20, 0xA2, 0x20, 0x82, 0x69, 0xA2, 0x79, 0x82, 0x71, 0x63, 0x92, 
-    0xE3, 0xAA, 0xC3, 0xA2, 0xE3, 0xAA, 0x84, 0xC3, 0xA4, 0xC3, 0x84, 0xC3, 0x23, 0xB3, 0xE3, 0xAA, 
-    0x23, 0xB3, 0x63, 0x8A, 0x01, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x21, 0x08, 0x21, 0x08, 0x41, 0x10, 0xC2, 0x38, 0xA2, 0x38, 0xC2, 0x40, 0x40, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x10, 0x60, 0x20, 
-    0x60, 0x18, 0x60, 0x20, 0x60, 0x20, 0xA1, 0x30, 0xE1, 0x38, 0xE1, 0x48, 0x02, 0x51, 0x02, 0x59, 
-    0xE2, 0x40, 0x62, 0x20, 0x82, 0x28, 0x82, 0x28, 0x02, 0x51, 0x22, 0x59, 0xE1, 0x50, 0x62, 0x69, 
-    0xA2, 0x79, 0xA2, 0x71, 0xC2, 0x79, 0x63, 0x9A, 0x83, 0x9A, 0x83, 0x9A, 0xA3, 0xA2, 0xC3, 0xA2, 
-    0xC3, 0xA2, 0x83, 0x92, 0xE3, 0x69, 0xC3, 0x61, 0xC2, 0x61, 0xE3, 0x61, 0x03, 0x6A, 0x03, 0x6A, 
-    0x03, 0x6A, 0xE3, 0x61, 0xE3, 0x61, 0xA3, 0x59, 0x61, 0x20, 0x41, 0x18, 0x41, 0x18, 0x00, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x91, 0xA2, 0xDA, 
-    0x62, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xC2, 0xDA, 0x22, 0xAA, 0xA1, 0x89, 0xE2, 0x99, 
-    0x41, 0x71, 0x41, 0x20, 0x61, 0x28, 0x61, 0x28, 0x41, 0x28, 0x41, 0x28, 0x41, 0x28, 0x61, 0x38, 
-    0x81, 0x48, 0x61, 0x48, 0x81, 0x48, 0xE1, 0x58, 0xE1, 0x58, 0xC1, 0x50, 0xE2, 0x81, 0x62, 0x92, 
-    0x42, 0x8A, 0x83, 0x9A, 0xA4, 0xCB, 0xA4, 0xCB, 0xA4, 0xC3, 0xE5, 0xCB, 0x05, 0xD4, 0xE5, 0xD3, 
-    0xE5, 0xD3, 0xE6, 0xCB, 0x06, 0xD4, 0xC5, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x91, 0x82, 0xD2, 
-    0x62, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xA2, 0xD2, 0x02, 0xAA, 0xA2, 0x89, 0xC2, 0x91, 
-    0x21, 0x69, 0x41, 0x20, 0x61, 0x28, 0x61, 0x28, 0x61, 0x28, 0x61, 0x30, 0x41, 0x28, 0x81, 0x40, 
-    0xA1, 0x50, 0xA1, 0x50, 0xC1, 0x50, 0x01, 0x59, 0x02, 0x61, 0x01, 0x59, 0xE2, 0x81, 0x83, 0x92, 
-    0x62, 0x92, 0x83, 0x92, 0x64, 0xBB, 0x44, 0xB3, 0x44, 0xB3, 0x85, 0xBB, 0xA5, 0xC3, 0xA5, 0xBB, 
-    0xA5, 0xBB, 0xA5, 0xBB, 0xA5, 0xC3, 0x85, 0xB3, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xA1, 0xC2, 0xE2, 
-    0x82, 0xD2, 0x82, 0xCA, 0x82, 0xCA, 0x82, 0xCA, 0xA2, 0xD2, 0x02, 0xAA, 0x81, 0x81, 0xC1, 0x91, 
-    0x41, 0x69, 0x41, 0x20, 0x61, 0x30, 0x61, 0x30, 0x61, 0x30, 0x81, 0x38, 0x61, 0x38, 0x81, 0x40, 
-    0xA1, 0x50, 0xA1, 0x48, 0xA1, 0x50, 0xE1, 0x58, 0x01, 0x59, 0xE1, 0x50, 0xC2, 0x79, 0x82, 0x92, 
-    0x42, 0x92, 0x83, 0x9A, 0x64, 0xBB, 0x64, 0xBB, 0x84, 0xBB, 0xA5, 0xC3, 0xC5, 0xC3, 0xC5, 0xC3, 
-    0xC5, 0xC3, 0xC5, 0xC3, 0xE6, 0xC3, 0xA5, 0xBB, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0xC0, 0x38, 
-    0x80, 0x28, 0xC0, 0x48, 0x61, 0x91, 0x61, 0x89, 0x61, 0x89, 0x01, 0x69, 0xC1, 0x50, 0xC1, 0x50, 
-    0xE1, 0x60, 0x21, 0x79, 0x21, 0x71, 0x41, 0x79, 0x82, 0x89, 0x82, 0x81, 0x82, 0x81, 0xC2, 0x99, 
-    0xE2, 0xA1, 0xC2, 0xA1, 0xE2, 0xA1, 0x02, 0xA2, 0x02, 0xA2, 0x02, 0xA2, 0xE2, 0xA1, 0xA2, 0x99, 
-    0xA2, 0x99, 0xA2, 0x91, 0x82, 0x89, 0x82, 0x89, 0xA2, 0x89, 0xA2, 0x81, 0xA2, 0x79, 0x82, 0x79, 
-    0xA2, 0x81, 0x03, 0x9A, 0x03, 0x9A, 0x23, 0xA2, 0xE1, 0x89, 0xC1, 0x81, 0xC1, 0x89, 0xA0, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x40, 0x28, 0x21, 0x81, 0x01, 0x79, 0x01, 0x79, 0xC1, 0x58, 0xA1, 0x48, 0xA1, 0x48, 
-    0xE1, 0x58, 0x42, 0x81, 0x42, 0x79, 0x42, 0x81, 0x82, 0x89, 0x82, 0x89, 0x82, 0x81, 0x02, 0xA2, 
-    0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x42, 0xBA, 0x42, 0xBA, 0x42, 0xBA, 0xE2, 0xA9, 0x82, 0x99, 
-    0xA2, 0x99, 0x81, 0x91, 0x21, 0x79, 0x21, 0x81, 0x21, 0x81, 0x01, 0x69, 0x01, 0x69, 0xE1, 0x68, 
-    0x21, 0x71, 0x82, 0x91, 0x62, 0x91, 0x82, 0x91, 0xC2, 0xD2, 0xE2, 0xDA, 0x03, 0xEB, 0x21, 0x51, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x60, 0x30, 0x41, 0x89, 0x21, 0x81, 0x21, 0x81, 0xA0, 0x60, 0x80, 0x50, 0x60, 0x50, 
-    0xA0, 0x60, 0x00, 0x89, 0x00, 0x81, 0x21, 0x81, 0xA1, 0x91, 0x81, 0x91, 0x81, 0x91, 0x02, 0xB2, 
-    0x42, 0xC2, 0x22, 0xBA, 0x42, 0xBA, 0x42, 0xBA, 0x42, 0xBA, 0x42, 0xBA, 0xE2, 0xA9, 0xA2, 0x99, 
-    0xA2, 0xA1, 0x81, 0x91, 0x21, 0x79, 0x21, 0x79, 0x21, 0x81, 0x01, 0x69, 0x02, 0x61, 0x02, 0x61, 
-    0x21, 0x71, 0x82, 0x91, 0x82, 0x91, 0xA2, 0x91, 0xA2, 0xC2, 0xA2, 0xCA, 0xE2, 0xDA, 0x21, 0x59, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x41, 0x28, 0xE3, 0x70, 0xE3, 0x60, 0xE3, 0x60, 0x86, 0x41, 0xC7, 0x39, 0xC8, 0x31, 
-    0xC8, 0x39, 0xE7, 0x49, 0xE8, 0x49, 0xE8, 0x51, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x84, 0x69, 
-    0xA4, 0x71, 0xA4, 0x71, 0xC3, 0x81, 0xE2, 0x99, 0xE2, 0x99, 0xE2, 0x99, 0xA2, 0x91, 0x82, 0x89, 
-    0x82, 0x89, 0x82, 0x91, 0xC2, 0x99, 0xA2, 0x99, 0xA2, 0x99, 0xA2, 0x91, 0xC2, 0x91, 0xC2, 0x91, 
-    0xE2, 0x99, 0x02, 0xAA, 0x22, 0xAA, 0x22, 0xAA, 0x82, 0xC2, 0x82, 0xC2, 0xC2, 0xD2, 0x61, 0x69, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x23, 0x18, 0x88, 0x38, 0x67, 0x30, 0x88, 0x38, 0x0F, 0x0B, 0xB0, 0x03, 0x90, 0x0B, 
-    0x50, 0x03, 0xEF, 0x02, 0x0F, 0x03, 0xCF, 0x0A, 0x6C, 0x29, 0x6C, 0x29, 0x8C, 0x29, 0x07, 0x09, 
-    0xE5, 0x00, 0xE6, 0x00, 0xE5, 0x18, 0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x42, 0x69, 0x42, 0x79, 
-    0x42, 0x71, 0x82, 0x81, 0x22, 0xBA, 0x22, 0xB2, 0x22, 0xB2, 0x42, 0xBA, 0x62, 0xBA, 0x62, 0xBA, 
-    0x62, 0xBA, 0x62, 0xC2, 0x62, 0xBA, 0x62, 0xBA, 0x62, 0xBA, 0x42, 0xBA, 0x82, 0xCA, 0x81, 0x79, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x23, 0x18, 0x88, 0x40, 0x87, 0x38, 0x87, 0x38, 0xEE, 0x12, 0x6F, 0x0B, 0x4F, 0x0B, 
-    0x2F, 0x0B, 0xCE, 0x0A, 0xEE, 0x02, 0xAE, 0x12, 0x6B, 0x31, 0x8B, 0x31, 0x8B, 0x31, 0x06, 0x19, 
-    0xE5, 0x10, 0xE6, 0x08, 0x04, 0x29, 0x21, 0x69, 0x22, 0x69, 0x22, 0x61, 0x42, 0x71, 0x42, 0x79, 
-    0x41, 0x79, 0x82, 0x89, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x22, 0xB2, 0x42, 0xBA, 0x42, 0xB2, 
-    0x42, 0xBA, 0x62, 0xBA, 0x62, 0xBA, 0x62, 0xBA, 0x82, 0xC2, 0x62, 0xC2, 0xA2, 0xD2, 0xC1, 0x89, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x00, 0x21, 0x00, 
-    0x21, 0x00, 0x63, 0x18, 0x88, 0x40, 0x87, 0x38, 0x87, 0x40, 0xEE, 0x1A, 0x6F, 0x0B, 0x6F, 0x0B, 
-    0x0E, 0x13, 0xAD, 0x12, 0xAD, 0x12, 0x6D, 0x1A, 0x6B, 0x31, 0x6B, 0x31, 0x6B, 0x31, 0x27, 0x19, 
-    0x26, 0x09, 0x27, 0x09, 0x25, 0x21, 0x42, 0x61, 0x43, 0x61, 0x42, 0x61, 0x42, 0x69, 0x42, 0x79, 
-    0x42, 0x71, 0x82, 0x81, 0x02, 0xAA, 0xE2, 0xA1, 0xE2, 0xA1, 0x42, 0xB2, 0x62, 0xBA, 0x62, 0xBA, 
-    0x62, 0xBA, 0x82, 0xBA, 0x82, 0xBA, 0x82, 0xC2, 0x02, 0xAA, 0xC2, 0xA1, 0xE2, 0xA9, 0x61, 0x81, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 
-    0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 
-    0x61, 0x08, 0x41, 0x08, 0x61, 0x08, 0x41, 0x08, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x67, 0x58, 0x67, 0x58, 0x47, 0x68, 0x6A, 0x39, 0xAD, 0x0A, 
-    0x6C, 0x0A, 0x4C, 0x22, 0xE7, 0x78, 0xE7, 0x78, 0xE7, 0x78, 0x89, 0x51, 0xCA, 0x49, 0xCB, 0x49, 
-    0x89, 0x49, 0x47, 0x49, 0x47, 0x49, 0x27, 0x49, 0xA9, 0x50, 0xAA, 0x48, 0x69, 0x50, 0x4D, 0x22, 
-    0x50, 0x03, 0x10, 0x03, 0xAE, 0x02, 0xCE, 0x0A, 0xCE, 0x0A, 0xCE, 0x0A, 0xCA, 0x21, 0x49, 0x29, 
-    0x6A, 0x29, 0x68, 0x39, 0x62, 0x71, 0x62, 0x71, 0x42, 0x69, 0x22, 0x9A, 0xC2, 0xCA, 0xA2, 0xC2, 
-    0xC2, 0xC2, 0xC2, 0xC2, 0xA2, 0xC2, 0xC2, 0xC2, 0x61, 0x89, 0xC1, 0x70, 0x01, 0x81, 0xA0, 0x58, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x18, 0xF1, 0xA4, 
-    0xF1, 0xA4, 0xF1, 0xA4, 0x11, 0xA5, 0x11, 0xA5, 0x11, 0xA5, 0x11, 0xA5, 0x11, 0xA5, 0x32, 0xA5, 
-    0x11, 0xA5, 0x32, 0xA5, 0x11, 0xA5, 0x32, 0xA5, 0x32, 0xA5, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x88, 0x70, 0x88, 0x68, 0x48, 0x70, 0x8B, 0x41, 0xCE, 0x0A, 
-    0xAD, 0x12, 0x6D, 0x22, 0xE7, 0x80, 0xE7, 0x80, 0x07, 0x81, 0x49, 0x59, 0x69, 0x51, 0x69, 0x51, 
-    0x48, 0x49, 0x46, 0x49, 0x47, 0x49, 0x47, 0x49, 0x89, 0x50, 0x8A, 0x50, 0x69, 0x50, 0x4E, 0x22, 
-    0x71, 0x03, 0x30, 0x03, 0xCF, 0x02, 0xEF, 0x02, 0xEF, 0x02, 0x0F, 0x03, 0xCB, 0x19, 0x6A, 0x21, 
-    0x6B, 0x19, 0x69, 0x31, 0x62, 0x71, 0x62, 0x71, 0x42, 0x69, 0x22, 0x9A, 0xC3, 0xC2, 0xA2, 0xBA, 
-    0xA2, 0xC2, 0xC2, 0xC2, 0xA2, 0xC2, 0xC2, 0xC2, 0x61, 0x89, 0xE1, 0x70, 0x01, 0x81, 0xC0, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x20, 0x73, 0xB5, 
-    0x52, 0xAD, 0x52, 0xAD, 0x73, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 
-    0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0x93, 0xB5, 0xE3, 0x18, 0x20, 0x00, 0x20, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x68, 0x60, 0x68, 0x60, 0x47, 0x68, 0xAB, 0x39, 0xCE, 0x02, 
-    0xAD, 0x02, 0x8D, 0x12, 0x08, 0x81, 0xE8, 0x88, 0x08, 0x89, 0x8A, 0x59, 0xAA, 0x51, 0xAA, 0x51, 
-    0x88, 0x51, 0x67, 0x49, 0x67, 0x49, 0x48, 0x51, 0x89, 0x50, 0x8A, 0x50, 0x49, 0x58, 0x4E, 0x22, 
-    0xB1, 0x03, 0x71, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x30, 0x03, 0xAA, 0x19, 0x29, 0x29, 
-    0x4A, 0x21, 0x48, 0x31, 0x61, 0x79, 0x61, 0x79, 0x41, 0x71, 0x42, 0xAA, 0xE3, 0xCA, 0xC2, 0xCA, 
-    0xC2, 0xCA, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x82, 0x91, 0x01, 0x79, 0x21, 0x89, 0xC1, 0x60, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x52, 0xAD, 
-    0x32, 0xAD, 0x32, 0xAD, 0x32, 0xAD, 0x52, 0xAD, 0x52, 0xAD, 0x52, 0xAD, 0x52, 0xAD, 0x52, 0xAD, 
-    0x52, 0xAD, 0x52, 0xAD, 0x52, 0xAD, 0x52, 0xAD, 0x12, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x10, 
-    0xE6, 0x10, 0xE6, 0x08, 0xA6, 0x38, 0x69, 0x98, 0x88, 0x90, 0x68, 0x98, 0x2A, 0x71, 0x8B, 0x51, 
-    0x8A, 0x51, 0x8A, 0x51, 0xE5, 0x60, 0xC5, 0x60, 0xE5, 0x60, 0x06, 0x39, 0x06, 0x31, 0x07, 0x39, 
-    0x06, 0x39, 0x05, 0x31, 0x05, 0x31, 0xE5, 0x30, 0xE8, 0x30, 0x09, 0x29, 0xE9, 0x30, 0x0C, 0x22, 
-    0xCF, 0x22, 0x8E, 0x22, 0x2D, 0x32, 0xAC, 0x69, 0xAC, 0x69, 0xAC, 0x79, 0x6E, 0x22, 0x6E, 0x12, 
-    0x6E, 0x12, 0x0C, 0x1A, 0x86, 0x39, 0x86, 0x39, 0x86, 0x39, 0xE3, 0x79, 0x02, 0x9A, 0xE2, 0x91, 
-    0x02, 0x9A, 0xA3, 0xBA, 0xA2, 0xB2, 0xC3, 0xC2, 0x21, 0x61, 0x60, 0x38, 0x80, 0x40, 0x40, 0x28, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x18, 0x61, 0x20, 0x40, 0x18, 0x44, 0x31, 0x32, 0xAD, 
-    0x11, 0xA5, 0x11, 0xA5, 0x15, 0xC6, 0x77, 0xD6, 0x76, 0xCE, 0x56, 0xCE, 0x36, 0xCE, 0x36, 0xCE, 
-    0x36, 0xC6, 0x36, 0xC6, 0x36, 0xC6, 0x36, 0xCE, 0x15, 0xC6, 0xCD, 0x7B, 0x4C, 0x6B, 0x0A, 0x63, 
-    0xC6, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAC, 0x21, 
-    0xED, 0x29, 0x0D, 0x1A, 0x6C, 0x61, 0x89, 0xC8, 0x89, 0xB8, 0xA9, 0xC0, 0x68, 0xA8, 0x47, 0x90, 
-    0x47, 0x98, 0x67, 0x90, 0xC2, 0x38, 0xC1, 0x38, 0xC2, 0x38, 0x40, 0x10, 0x20, 0x00, 0x20, 0x00, 
-    0x20, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x47, 0x09, 0x89, 0x09, 0x88, 0x01, 0x6A, 0x21, 
-    0x4B, 0x59, 0x4B, 0x49, 0x2B, 0x69, 0x89, 0xC8, 0x89, 0xC0, 0x89, 0xC8, 0xD0, 0x22, 0x92, 0x03, 
-    0x72, 0x03, 0xEF, 0x02, 0xAA, 0x01, 0xCB, 0x01, 0xCB, 0x01, 0x44, 0x49, 0x01, 0x61, 0x02, 0x59, 
-    0x42, 0x69, 0xA3, 0xAA, 0x83, 0xAA, 0xC3, 0xBA, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x38, 0xE2, 0x48, 0xA1, 0x40, 0xA5, 0x59, 0x31, 0xA5, 
-    0xF1, 0xA4, 0xF1, 0xA4, 0xB8, 0xD6, 0x5A, 0xEF, 0x3A, 0xEF, 0x39, 0xE7, 0xF9, 0xDE, 0xF9, 0xDE, 
-    0xF8, 0xDE, 0xF9, 0xDE, 0xF9, 0xDE, 0xF9, 0xDE, 0xF9, 0xDE, 0x5A, 0xEF, 0x5A, 0xEF, 0xBB, 0xFF, 
-    0x73, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x19, 
-    0xCC, 0x21, 0xEC, 0x11, 0x4A, 0x59, 0x69, 0xC8, 0x89, 0xB8, 0x89, 0xC0, 0x88, 0xA0, 0x67, 0x88, 
-    0x88, 0x90, 0xA7, 0x80, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0x41, 0x10, 0x21, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x47, 0x09, 0x89, 0x09, 0x68, 0x01, 0x6A, 0x21, 
-    0x6C, 0x59, 0x6B, 0x49, 0x4B, 0x69, 0xAA, 0xC0, 0xCA, 0xB8, 0xAA, 0xC0, 0xD0, 0x22, 0x71, 0x03, 
-    0x51, 0x03, 0xEF, 0x02, 0xA9, 0x09, 0xAA, 0x09, 0xAA, 0x01, 0x64, 0x49, 0x41, 0x69, 0x42, 0x61, 
-    0x82, 0x71, 0xC2, 0xBA, 0xA2, 0xB2, 0xE3, 0xC2, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x38, 0xC2, 0x48, 0x81, 0x38, 0xA5, 0x51, 0x32, 0xAD, 
-    0x11, 0xA5, 0xF1, 0xA4, 0x97, 0xD6, 0x19, 0xE7, 0x19, 0xE7, 0x19, 0xE7, 0xF9, 0xDE, 0xF9, 0xDE, 
-    0xF9, 0xDE, 0xF9, 0xDE, 0xF9, 0xDE, 0xF9, 0xDE, 0xF9, 0xDE, 0xD8, 0xDE, 0xB7, 0xD6, 0x19, 0xE7, 
-    0x12, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x29, 
-    0xAC, 0x31, 0xAB, 0x21, 0x4A, 0x59, 0xA9, 0xA8, 0xC9, 0xA0, 0xC9, 0xA0, 0xA8, 0x88, 0x87, 0x80, 
-    0x88, 0x88, 0xA7, 0x78, 0xA2, 0x38, 0xA2, 0x38, 0xC2, 0x38, 0x41, 0x10, 0x21, 0x08, 0x21, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x28, 0x19, 0x49, 0x19, 0x49, 0x19, 0x6A, 0x31, 
-    0x6C, 0x51, 0x6C, 0x49, 0x4B, 0x61, 0xEA, 0xA8, 0x0A, 0x99, 0xEA, 0xA0, 0x8E, 0x32, 0x10, 0x1B, 
-    0x31, 0x13, 0x8E, 0x22, 0xAA, 0x09, 0xCA, 0x09, 0xCB, 0x01, 0x45, 0x51, 0x03, 0x71, 0x03, 0x61, 
-    0x23, 0x69, 0x65, 0x8A, 0x44, 0x8A, 0x85, 0x9A, 0xC1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x20, 0x10, 0x40, 0x10, 0x60, 0x18, 0xA1, 0x38, 0xC2, 0x40, 0x81, 0x38, 0xA5, 0x51, 0x32, 0xAD, 
-    0x11, 0xA5, 0x11, 0xA5, 0xB8, 0xD6, 0x19, 0xE7, 0x19, 0xE7, 0xD8, 0xDE, 0x56, 0xCE, 0x57, 0xCE, 
-    0x57, 0xCE, 0x77, 0xCE, 0x97, 0xD6, 0x97, 0xD6, 0x97, 0xD6, 0xD8, 0xDE, 0xD8, 0xDE, 0x39, 0xEF, 
-    0x32, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x58, 
-    0xC8, 0x78, 0x87, 0x78, 0x89, 0x41, 0x4B, 0x0A, 0x2B, 0x12, 0x4B, 0x0A, 0xA9, 0x41, 0x47, 0x61, 
-    0x48, 0x61, 0x26, 0x51, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x21, 0x08, 0x21, 0x08, 
-    0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0xA8, 0x50, 0xAA, 0x60, 0xA9, 0x60, 0x2C, 0x51, 
-    0x6E, 0x41, 0x6E, 0x49, 0xAD, 0x31, 0x0A, 0x0A, 0x0B, 0x0A, 0x2B, 0x02, 0x4A, 0x79, 0xAA, 0xC0, 
-    0xEA, 0xB0, 0xEA, 0xA8, 0x4C, 0x12, 0x4C, 0x0A, 0x6C, 0x0A, 0xE8, 0x60, 0x26, 0x80, 0x47, 0x80, 
-    0x67, 0x70, 0x6A, 0x19, 0x6A, 0x19, 0x6B, 0x19, 0x04, 0x39, 0xC1, 0x40, 0xC1, 0x38, 0x02, 0x51, 
-    0x82, 0x69, 0x62, 0x69, 0x82, 0x69, 0xC2, 0x38, 0xA2, 0x28, 0x61, 0x28, 0x85, 0x41, 0xF1, 0x9C, 
-    0xD0, 0x9C, 0xB0, 0x9C, 0x77, 0xD6, 0xF9, 0xDE, 0x19, 0xE7, 0xB4, 0xB5, 0xEA, 0x52, 0x2B, 0x63, 
-    0x0B, 0x5B, 0xCD, 0x73, 0x4E, 0x8C, 0x2E, 0x84, 0x0E, 0x84, 0x56, 0xCE, 0xF9, 0xE6, 0x3A, 0xEF, 
-    0x32, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x58, 
-    0xC7, 0x70, 0x87, 0x78, 0x69, 0x41, 0x4B, 0x0A, 0x2B, 0x12, 0x2B, 0x0A, 0xA9, 0x41, 0x27, 0x61, 
-    0x48, 0x61, 0x26, 0x51, 0x21, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21, 0x08, 0x21, 0x08, 
-    0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0xA8, 0x50, 0xAA, 0x60, 0xA9, 0x60, 0x2C, 0x51, 
-    0x6E, 0x41, 0x6E, 0x49, 0xAD, 0x31, 0x0A, 0x0A, 0x0A, 0x12, 0x2B, 0x02, 0x2A, 0x79, 0x89, 0xC0, 
-    0xA9, 0xB8, 0xEA, 0xA0, 0x6D, 0x12, 0x4C, 0x0A, 0x6C, 0x0A, 0xC8, 0x68, 0x26, 0x80, 0x47, 0x80, 
-    0x87, 0x70, 0x8A, 0x21, 0x69, 0x21, 0x8A, 0x21, 0x04, 0x41, 0xE1, 0x50, 0xE2, 0x48, 0x22, 0x59, 
-    0x82, 0x69, 0x82, 0x69, 0x82, 0x69, 0xC2, 0x38, 0xA2, 0x28, 0x61, 0x28, 0x85, 0x41, 0xD0, 0x9C, 
-    0xB0, 0x9C, 0xB0, 0x9C, 0x77, 0xCE, 0xF9, 0xDE, 0x19, 0xE7, 0xD5, 0xBD, 0xEA, 0x5A, 0x2B, 0x63, 
-    0x0B, 0x5B, 0xCD, 0x73, 0x4E, 0x8C, 0x2E, 0x84, 0xED, 0x7B, 0x36, 0xCE, 0xF9, 0xE6, 0x3A, 0xEF, 
-    0x32, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x70, 
-    0xE8, 0x80, 0xA7, 0x80, 0x8A, 0x41, 0x6C, 0x02, 0x2B, 0x0A, 0x4C, 0x02, 0x89, 0x49, 0x27, 0x69, 
-    0x47, 0x69, 0x26, 0x59, 0x21, 0x00, 0x21, 0x00, 0x21, 0x00, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 
-    0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0xA8, 0x58, 0xAA, 0x68, 0xA9, 0x60, 0x2C, 0x51, 
-    0x6E, 0x41, 0x4E, 0x49, 0xAD, 0x31, 0x2A, 0x0A, 0x0B, 0x12, 0x2A, 0x02, 0x2A, 0x89, 0x8A, 0xC8, 
-    0x8A, 0xC8, 0x0A, 0x99, 0xAD, 0x02, 0x8D, 0x02, 0x8D, 0x02, 0xA8, 0x68, 0x07, 0x80, 0x07, 0x78, 
-    0x47, 0x68, 0x4A, 0x19, 0x4A, 0x19, 0x4A, 0x19, 0xE4, 0x38, 0xE1, 0x48, 0xC2, 0x40, 0x22, 0x59, 
-    0x82, 0x71, 0x82, 0x69, 0x82, 0x69, 0xC2, 0x38, 0xA2, 0x30, 0x61, 0x28, 0x85, 0x49, 0xF0, 0x9C, 
-    0xD0, 0x9C, 0xB0, 0x9C, 0x77, 0xCE, 0xF9, 0xDE, 0x19, 0xE7, 0xF5, 0xBD, 0xEA, 0x5A, 0x2B, 0x63, 
-    0x0B, 0x5B, 0xCD, 0x73, 0x6F, 0x8C, 0x4E, 0x84, 0x2E, 0x84, 0x57, 0xCE, 0xF9, 0xDE, 0x3A, 0xEF, 
-    0x12, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x38, 
-    0x44, 0x38, 0x43, 0x38, 0xC5, 0x38, 0x69, 0x49, 0x69, 0x49, 0x69, 0x49, 0x69, 0x39, 0x69, 0x41, 
-    0x69, 0x41, 0x27, 0x41, 0xA1, 0x38, 0xA2, 0x38, 0xC2, 0x48, 0x81, 0x30, 0x21, 0x00, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0xE7, 0x28, 0xE7, 0x28, 0xE7, 0x20, 0x28, 0x21, 
-    0x6A, 0x19, 0x49, 0x19, 0x69, 0x19, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x09, 0x69, 0x39, 0x49, 0x51, 
-    0x49, 0x49, 0x49, 0x49, 0x29, 0x51, 0x49, 0x51, 0x09, 0x49, 0x86, 0xA2, 0xA5, 0xCB, 0x85, 0xC3, 
-    0x85, 0xBB, 0x26, 0x9B, 0x06, 0x93, 0x46, 0x9B, 0xA3, 0x61, 0xC1, 0x40, 0xE2, 0x48, 0x22, 0x51, 
-    0x82, 0x69, 0x62, 0x61, 0x82, 0x69, 0xC2, 0x38, 0x82, 0x28, 0x82, 0x28, 0xE3, 0x30, 0x2E, 0x8C, 
-    0x8F, 0x94, 0x4E, 0x8C, 0x36, 0xCE, 0xF9, 0xE6, 0x19, 0xE7, 0x16, 0xBE, 0x0A, 0x5B, 0x2B, 0x63, 
-    0x0A, 0x5B, 0x2F, 0x84, 0x53, 0xAD, 0x32, 0xA5, 0x12, 0xA5, 0x98, 0xD6, 0xF9, 0xDE, 0x5B, 0xEF, 
-    0xF2, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x30, 0xA7, 0x90, 0x86, 0x88, 0xA6, 0x88, 0x49, 0x29, 0x6A, 0x21, 
-    0x6A, 0x21, 0x48, 0x31, 0xE2, 0x60, 0xE2, 0x58, 0x02, 0x61, 0xA2, 0x38, 0x21, 0x00, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x06, 0x09, 0x06, 0x09, 0x06, 0x09, 0x27, 0x11, 
-    0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 0x89, 0x09, 0x89, 0x01, 
-    0xA9, 0x01, 0x68, 0x21, 0x46, 0x80, 0x66, 0x80, 0x06, 0x78, 0x25, 0xBB, 0x04, 0xE5, 0xA5, 0xDC, 
-    0xA5, 0xDC, 0x04, 0xCC, 0xE4, 0xCB, 0x24, 0xD4, 0xE3, 0x71, 0xC2, 0x40, 0xE2, 0x48, 0x02, 0x51, 
-    0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0xC2, 0x30, 0x82, 0x28, 0x82, 0x28, 0x82, 0x20, 0x8C, 0x73, 
-    0x4E, 0x8C, 0xED, 0x7B, 0x15, 0xC6, 0x19, 0xE7, 0x19, 0xE7, 0x36, 0xC6, 0x0B, 0x5B, 0x4B, 0x63, 
-    0x0A, 0x5B, 0x70, 0x8C, 0xB5, 0xB5, 0x74, 0xAD, 0x74, 0xAD, 0x98, 0xD6, 0xF9, 0xDE, 0x5B, 0xEF, 
-    0xD2, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x30, 0xA7, 0x90, 0x86, 0x80, 0xA6, 0x80, 0x49, 0x31, 0x6A, 0x21, 
-    0x6A, 0x21, 0x27, 0x39, 0xE2, 0x58, 0xE2, 0x50, 0x02, 0x61, 0x81, 0x30, 0x21, 0x00, 0x21, 0x08, 
-    0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0xE6, 0x08, 0x07, 0x09, 0x06, 0x09, 0x28, 0x11, 
-    0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0x69, 0x11, 0x89, 0x11, 
-    0x89, 0x09, 0x68, 0x21, 0x46, 0x70, 0x66, 0x70, 0x07, 0x68, 0x26, 0xB3, 0xE5, 0xE4, 0xA5, 0xDC, 
-    0x85, 0xDC, 0xE4, 0xC3, 0xC4, 0xC3, 0x05, 0xCC, 0xE3, 0x71, 0xC2, 0x40, 0x02, 0x49, 0x22, 0x51, 
-    0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0xC2, 0x30, 0x82, 0x28, 0x82, 0x28, 0x62, 0x28, 0x6C, 0x73, 
-    0x6F, 0x8C, 0xED, 0x83, 0xF5, 0xC5, 0x1A, 0xE7, 0x1A, 0xE7, 0x36, 0xC6, 0xEA, 0x52, 0x0A, 0x5B, 
-    0xCA, 0x52, 0x4F, 0x84, 0x94, 0xAD, 0x53, 0xAD, 0x53, 0xA5, 0x98, 0xD6, 0xF9, 0xE6, 0x7B, 0xEF, 
-    0x91, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0xC7, 0x80, 0xC7, 0x70, 0xE7, 0x68, 0x49, 0x29, 0x69, 0x29, 
-    0x69, 0x21, 0x26, 0x39, 0xE2, 0x58, 0x02, 0x59, 0x02, 0x61, 0xC2, 0x38, 0x81, 0x20, 0x81, 0x20, 
-    0x61, 0x18, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0xE5, 0x18, 0x06, 0x19, 0xE5, 0x10, 0x26, 0x19, 
-    0x47, 0x21, 0x47, 0x21, 0x48, 0x21, 0x69, 0x11, 0x69, 0x11, 0x69, 0x11, 0x68, 0x19, 0x48, 0x21, 
-    0x68, 0x19, 0x47, 0x29, 0xE6, 0x80, 0xE6, 0x80, 0xA6, 0x78, 0x64, 0xAA, 0x43, 0xC3, 0x03, 0xBB, 
-    0x23, 0xC3, 0xC4, 0xC3, 0xA4, 0xC3, 0xE5, 0xCB, 0xC3, 0x61, 0x81, 0x30, 0xC2, 0x38, 0xE2, 0x40, 
-    0x42, 0x59, 0x22, 0x51, 0x42, 0x59, 0xA2, 0x30, 0x82, 0x20, 0x82, 0x28, 0x61, 0x20, 0x4B, 0x6B, 
-    0x4F, 0x8C, 0xCD, 0x7B, 0xF5, 0xBD, 0x3A, 0xE7, 0x19, 0xE7, 0x77, 0xCE, 0x0E, 0x7C, 0x2F, 0x84, 
-    0x0E, 0x7C, 0x33, 0xA5, 0x16, 0xBE, 0xF5, 0xBD, 0xD5, 0xBD, 0x57, 0xCE, 0x98, 0xD6, 0x1A, 0xE7, 
-    0x2F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x89, 0x21, 0x69, 0x19, 0x69, 0x19, 0x04, 0x39, 0xE2, 0x40, 
-    0xE3, 0x40, 0x02, 0x49, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x69, 0x42, 0x69, 0x62, 0x71, 
-    0x02, 0x51, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0xC2, 0x40, 0xE2, 0x40, 0xC2, 0x38, 0x02, 0x51, 
-    0x42, 0x61, 0x22, 0x61, 0x23, 0x59, 0x28, 0x19, 0x28, 0x19, 0x48, 0x11, 0x05, 0x41, 0xE3, 0x60, 
-    0xC3, 0x58, 0x23, 0x69, 0x24, 0xBB, 0x24, 0xBB, 0x24, 0xBB, 0xC2, 0x99, 0x01, 0x89, 0x01, 0x89, 
-    0x82, 0x99, 0x64, 0xBB, 0x44, 0xB3, 0x64, 0xC3, 0x02, 0x41, 0x21, 0x10, 0x41, 0x18, 0x61, 0x18, 
-    0x82, 0x28, 0x82, 0x28, 0x82, 0x28, 0x61, 0x18, 0x41, 0x10, 0x61, 0x10, 0x21, 0x08, 0x0A, 0x63, 
-    0x0E, 0x84, 0x8C, 0x73, 0xD5, 0xBD, 0x3A, 0xEF, 0xF9, 0xDE, 0xF9, 0xE6, 0x1A, 0xE7, 0x1A, 0xE7, 
-    0x1A, 0xE7, 0x3A, 0xE7, 0x3A, 0xEF, 0x5A, 0xEF, 0x1A, 0xE7, 0x53, 0xA5, 0xF2, 0x9C, 0x94, 0xAD, 
-    0x4C, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x69, 0x21, 0x48, 0x21, 0x49, 0x21, 0x04, 0x39, 0xE2, 0x48, 
-    0xE2, 0x40, 0x02, 0x49, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x62, 0x69, 
-    0x02, 0x51, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0xC2, 0x38, 0xE2, 0x40, 0xC2, 0x38, 0x02, 0x51, 
-    0x42, 0x61, 0x22, 0x61, 0x23, 0x59, 0x28, 0x19, 0x28, 0x19, 0x28, 0x11, 0x05, 0x41, 0xE3, 0x58, 
-    0xE3, 0x50, 0x23, 0x69, 0x04, 0xBB, 0x04, 0xBB, 0x24, 0xBB, 0xE2, 0xA1, 0x41, 0x91, 0x42, 0x91, 
-    0xC2, 0x99, 0x44, 0xBB, 0x24, 0xB3, 0x64, 0xBB, 0x22, 0x41, 0x21, 0x10, 0x41, 0x18, 0x61, 0x18, 
-    0x82, 0x28, 0x62, 0x28, 0x82, 0x28, 0x61, 0x18, 0x41, 0x10, 0x41, 0x10, 0x21, 0x08, 0x0A, 0x63, 
-    0x0E, 0x84, 0x8C, 0x73, 0xD5, 0xBD, 0x3A, 0xEF, 0xF9, 0xE6, 0xF9, 0xDE, 0xD9, 0xDE, 0xD9, 0xDE, 
-    0xD9, 0xDE, 0xF9, 0xDE, 0x19, 0xE7, 0x19, 0xE7, 0xD9, 0xDE, 0x33, 0xA5, 0x12, 0xA5, 0x94, 0xAD, 
-    0x4B, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x8A, 0x21, 0x69, 0x21, 0x69, 0x21, 0x04, 0x39, 0xE2, 0x48, 
-    0xE2, 0x40, 0x02, 0x49, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x62, 0x69, 
-    0x02, 0x51, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0xC2, 0x40, 0xC2, 0x40, 0xC2, 0x40, 0x02, 0x51, 
-    0x42, 0x61, 0x22, 0x61, 0x23, 0x59, 0x28, 0x19, 0x28, 0x19, 0x28, 0x11, 0x05, 0x41, 0xE3, 0x68, 
-    0xC3, 0x58, 0x43, 0x71, 0x24, 0xC3, 0x24, 0xBB, 0x64, 0xC3, 0xE2, 0xA1, 0x01, 0x89, 0x01, 0x89, 
-    0xA2, 0x99, 0x84, 0xC3, 0x64, 0xBB, 0xA4, 0xCB, 0x42, 0x49, 0x21, 0x10, 0x61, 0x18, 0x61, 0x20, 
-    0x82, 0x30, 0x82, 0x28, 0x82, 0x30, 0x61, 0x18, 0x41, 0x10, 0x61, 0x10, 0x21, 0x10, 0x0A, 0x63, 
-    0x0E, 0x84, 0x8C, 0x73, 0xF5, 0xBD, 0x7B, 0xEF, 0x3A, 0xE7, 0x1A, 0xE7, 0xF9, 0xE6, 0x19, 0xE7, 
-    0xF9, 0xDE, 0x5B, 0xEF, 0x7B, 0xF7, 0x7B, 0xF7, 0x5B, 0xEF, 0xB4, 0xB5, 0x53, 0xAD, 0xD5, 0xBD, 
-    0x4C, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x62, 0x08, 0x42, 0x08, 0x62, 0x08, 0xC2, 0x30, 0xE2, 0x48, 
-    0xE2, 0x40, 0x02, 0x49, 0x42, 0x69, 0x42, 0x61, 0x62, 0x69, 0x22, 0x61, 0x02, 0x51, 0x22, 0x59, 
-    0xE2, 0x48, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x26, 0x21, 0x47, 0x29, 0x47, 0x21, 0x47, 0x29, 
-    0x46, 0x29, 0x46, 0x31, 0x46, 0x31, 0x28, 0x19, 0x28, 0x19, 0x28, 0x11, 0x25, 0x21, 0x04, 0x29, 
-    0x04, 0x29, 0x23, 0x41, 0xE2, 0x89, 0xE2, 0x81, 0xC2, 0x81, 0xA4, 0xA2, 0x44, 0xBB, 0x24, 0xBB, 
-    0x04, 0xB3, 0xE3, 0x81, 0xC2, 0x79, 0x03, 0x82, 0xA1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-    0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x20, 0x08, 0x21, 0x08, 0x41, 0x08, 0x21, 0x08, 0x0A, 0x63, 
-    0xED, 0x7B, 0xAC, 0x73, 0x4F, 0x8C, 0x90, 0x94, 0x70, 0x8C, 0xB0, 0x94, 0x12, 0xA5, 0x12, 0xA5, 
-    0x12, 0xA5, 0x69, 0x4A, 0xC7, 0x39, 0xC7, 0x39, 0xC6, 0x39, 0x45, 0x29, 0x44, 0x21, 0x44, 0x29, 
-    0xA2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x30, 0x02, 0x49, 
-    0xE2, 0x40, 0x02, 0x49, 0x62, 0x69, 0x42, 0x61, 0x62, 0x69, 0x22, 0x59, 0xE2, 0x48, 0x02, 0x51, 
-    0xC2, 0x40, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x68, 0x19, 0x89, 0x19, 0x69, 0x19, 0x68, 0x11, 
-    0x68, 0x11, 0x68, 0x11, 0x48, 0x11, 0x28, 0x19, 0x27, 0x19, 0x28, 0x19, 0x26, 0x09, 0x25, 0x01, 
-    0x25, 0x01, 0x04, 0x19, 0x02, 0x61, 0x22, 0x61, 0xC1, 0x50, 0xE4, 0xA2, 0x66, 0xDC, 0x46, 0xD4, 
-    0xE6, 0xC3, 0x02, 0x59, 0xE2, 0x50, 0x02, 0x59, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x62, 
-    0xCD, 0x7B, 0xAC, 0x73, 0xAC, 0x73, 0x8C, 0x73, 0x8C, 0x6B, 0xED, 0x7B, 0x6F, 0x8C, 0x4F, 0x8C, 
-    0x4F, 0x8C, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x30, 0x02, 0x49, 
-    0xE2, 0x40, 0x02, 0x49, 0x62, 0x69, 0x42, 0x61, 0x62, 0x69, 0x22, 0x59, 0x02, 0x51, 0x02, 0x59, 
-    0xE2, 0x40, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x68, 0x19, 0x89, 0x19, 0x68, 0x19, 0x68, 0x19, 
-    0x68, 0x19, 0x68, 0x19, 0x47, 0x19, 0x27, 0x19, 0x27, 0x19, 0x28, 0x19, 0x26, 0x11, 0x04, 0x09, 
-    0x05, 0x09, 0x04, 0x21, 0x22, 0x69, 0x42, 0x69, 0xE2, 0x60, 0xE4, 0xA2, 0x46, 0xD4, 0x26, 0xD4, 
-    0xC6, 0xC3, 0x42, 0x61, 0x22, 0x59, 0x22, 0x59, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x63, 
-    0xCD, 0x7B, 0xAC, 0x73, 0xAC, 0x73, 0x8C, 0x73, 0x8C, 0x6B, 0xED, 0x7B, 0x6F, 0x94, 0x6F, 0x8C, 
-    0x6F, 0x8C, 0xC2, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x38, 0x02, 0x49, 
-    0xE2, 0x40, 0x02, 0x49, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x22, 0x59, 0xE2, 0x48, 0x02, 0x51, 
-    0xC2, 0x38, 0x21, 0x08, 0x41, 0x08, 0x41, 0x08, 0x47, 0x19, 0x68, 0x19, 0x48, 0x19, 0x68, 0x19, 
-    0x68, 0x11, 0x68, 0x11, 0x48, 0x11, 0x47, 0x19, 0x27, 0x19, 0x28, 0x19, 0x26, 0x11, 0x05, 0x09, 
-    0x25, 0x09, 0x25, 0x21, 0x22, 0x61, 0x22, 0x61, 0xE2, 0x58, 0xC4, 0x9A, 0xE6, 0xCB, 0xC6, 0xC3, 
-    0x85, 0xB3, 0x22, 0x59, 0x02, 0x59, 0x22, 0x59, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x10, 0xED, 0x7B, 
-    0x0E, 0x84, 0xCD, 0x7B, 0x6F, 0x8C, 0xB0, 0x94, 0xB0, 0x94, 0xB0, 0x94, 0xB0, 0x94, 0xB0, 0x9C, 
-    0xB0, 0x94, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x38, 0xE2, 0x40, 
-    0xE2, 0x40, 0xE2, 0x40, 0x02, 0x49, 0x02, 0x49, 0x22, 0x51, 0x81, 0x20, 0x41, 0x08, 0x41, 0x10, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x63, 0x08, 0x83, 0x08, 0x62, 0x08, 0xE5, 0x10, 
-    0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x11, 0x48, 0x11, 0x47, 0x11, 0x89, 0x11, 0xC9, 0x11, 
-    0xC9, 0x11, 0xA9, 0x11, 0x05, 0x11, 0xE4, 0x10, 0xE5, 0x08, 0x03, 0x41, 0x22, 0x61, 0x22, 0x59, 
-    0x22, 0x59, 0xE2, 0x50, 0x02, 0x51, 0xE2, 0x50, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x29, 0x52, 0xB5, 
-    0xF1, 0xA4, 0xF1, 0xA4, 0x36, 0xCE, 0xB8, 0xD6, 0x97, 0xD6, 0x77, 0xCE, 0x16, 0xC6, 0x36, 0xC6, 
-    0x36, 0xCE, 0x03, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x38, 0xE2, 0x48, 
-    0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x48, 0xE2, 0x48, 0x02, 0x49, 0x61, 0x10, 0x21, 0x00, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x62, 0x08, 0x83, 0x08, 0x62, 0x08, 0xC5, 0x10, 
-    0x48, 0x19, 0x47, 0x19, 0x48, 0x19, 0x48, 0x11, 0x48, 0x11, 0x47, 0x11, 0x89, 0x11, 0xCA, 0x11, 
-    0xCA, 0x11, 0xA9, 0x11, 0x05, 0x09, 0xE5, 0x08, 0xE5, 0x00, 0x03, 0x41, 0x01, 0x59, 0x02, 0x59, 
-    0x02, 0x59, 0x02, 0x51, 0xE2, 0x48, 0xE2, 0x50, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x29, 0x32, 0xAD, 
-    0xD1, 0xA4, 0xF1, 0xA4, 0xF5, 0xC5, 0x56, 0xCE, 0x36, 0xCE, 0x36, 0xC6, 0x15, 0xC6, 0x15, 0xC6, 
-    0x36, 0xC6, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x38, 0xE2, 0x48, 
-    0xE2, 0x40, 0x02, 0x49, 0x02, 0x49, 0x23, 0x51, 0x23, 0x51, 0x61, 0x10, 0x21, 0x08, 0x41, 0x08, 
-    0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x41, 0x08, 0x62, 0x08, 0x83, 0x08, 0x62, 0x08, 0xC5, 0x10, 
-    0x68, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x48, 0x11, 0x89, 0x11, 0xCA, 0x11, 
-    0xCA, 0x11, 0xA9, 0x11, 0xE5, 0x08, 0xE4, 0x08, 0xE5, 0x08, 0x03, 0x49, 0x22, 0x61, 0x02, 0x59, 
-    0x02, 0x59, 0x02, 0x51, 0x02, 0x51, 0x02, 0x59, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x31, 0xB3, 0xBD, 
-    0x52, 0xB5, 0x52, 0xB5, 0x97, 0xD6, 0xF9, 0xE6, 0xD8, 0xDE, 0xD8, 0xDE, 0x97, 0xD6, 0x97, 0xD6, 
-    0xB8, 0xD6, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x08, 
-    0x20, 0x08, 0x20, 0x10, 0x40, 0x18, 0x61, 0x20, 0x61, 0x20, 0x41, 0x08, 0x41, 0x08, 0x21, 0x08, 
-    0x62, 0x08, 0x83, 0x08, 0x63, 0x08, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0x63, 0x08, 0x83, 0x08, 
-    0xA4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0x06, 0x11, 0x06, 0x11, 0xE6, 0x10, 0x88, 0x11, 0xCA, 0x11, 
-    0xCA, 0x11, 0xA9, 0x11, 0x47, 0x11, 0x27, 0x11, 0x48, 0x11, 0x82, 0x10, 0x20, 0x10, 0x20, 0x08, 
-    0x20, 0x08, 0x20, 0x08, 0x20, 0x10, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x85, 0x31, 
-    0xC6, 0x39, 0x07, 0x42, 0xA9, 0x52, 0xCA, 0x5A, 0xA9, 0x52, 0x89, 0x52, 0x69, 0x52, 0x69, 0x4A, 
-    0x69, 0x4A, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x21, 0x08, 
-    0x62, 0x08, 0x83, 0x10, 0x83, 0x10, 0x83, 0x10, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 
-    0x62, 0x08, 0x62, 0x08, 0x62, 0x08, 0xC5, 0x08, 0xE5, 0x10, 0xC5, 0x08, 0x68, 0x11, 0xEA, 0x11, 
-    0xCA, 0x11, 0xCA, 0x11, 0x68, 0x11, 0x68, 0x11, 0x89, 0x19, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x20, 0x00, 
-    0x62, 0x08, 0x83, 0x10, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 
-    0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0xE5, 0x10, 0x06, 0x11, 0xE5, 0x10, 0x68, 0x11, 0xEA, 0x11, 
-    0xCA, 0x11, 0xCA, 0x11, 0x68, 0x11, 0x48, 0x11, 0x89, 0x19, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x18, 0x82, 0x20, 0x81, 0x20, 
-    0xA3, 0x18, 0xA4, 0x08, 0xA4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0x83, 0x08, 
-    0x83, 0x08, 0x83, 0x08, 0x83, 0x08, 0xC4, 0x08, 0xC5, 0x08, 0xA4, 0x08, 0x27, 0x11, 0xA9, 0x11, 
-    0x89, 0x11, 0x89, 0x11, 0x89, 0x11, 0x68, 0x11, 0x89, 0x11, 0xE5, 0x08, 0xA4, 0x08, 0xC4, 0x08, 
-    0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x22, 0x51, 0x03, 0x49, 0x02, 0x51, 
-    0xE4, 0x28, 0xE6, 0x08, 0xE5, 0x10, 0xE5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xA4, 0x10, 
-    0x83, 0x08, 0x83, 0x08, 0x62, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x48, 0x11, 
-    0x07, 0x11, 0x47, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xCA, 0x11, 0xAA, 0x19, 0xCA, 0x19, 
-    0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x41, 0x02, 0x41, 0x02, 0x49, 
-    0xE4, 0x28, 0xC5, 0x08, 0xE5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xA4, 0x10, 
-    0x63, 0x08, 0x83, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x48, 0x11, 
-    0x27, 0x11, 0x47, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0x89, 0x11, 0x89, 0x11, 0xA9, 0x11, 
-    0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x08, 0x20, 0x08, 0x40, 0x10, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0xE4, 0x28, 0xC5, 0x08, 0xE5, 0x10, 0xE5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0xA4, 0x10, 
-    0x63, 0x08, 0x83, 0x10, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 0x47, 0x11, 
-    0x27, 0x11, 0x47, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x11, 0xA9, 0x19, 0x88, 0x19, 0xA9, 0x21, 
-    0x26, 0x19, 0x20, 0x10, 0x40, 0x10, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x69, 0x02, 0x82, 
-    0x02, 0x82, 0xE2, 0x79, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x61, 0x42, 0x69, 
-    0x23, 0x51, 0xE3, 0x38, 0xE3, 0x38, 0xE3, 0x30, 0xC5, 0x10, 0xC5, 0x10, 0xC5, 0x10, 0x83, 0x10, 
-    0x63, 0x08, 0x83, 0x10, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x06, 0x11, 
-    0xE6, 0x10, 0x06, 0x11, 0x68, 0x19, 0x68, 0x19, 0x68, 0x11, 0xA5, 0x51, 0xC2, 0x79, 0xA3, 0x71, 
-    0xA2, 0x79, 0xA2, 0x79, 0xA2, 0x79, 0xC2, 0x81, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x79, 0x63, 0x9A, 
-    0x63, 0x92, 0x23, 0x8A, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0x42, 0x61, 0x42, 0x61, 0x62, 0x61, 
-    0x22, 0x51, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0xC4, 0x18, 0xC5, 0x10, 0xC5, 0x10, 0x83, 0x08, 
-    0x62, 0x08, 0x83, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0xE6, 0x10, 
-    0xE5, 0x10, 0x06, 0x11, 0x68, 0x19, 0x68, 0x19, 0x48, 0x11, 0xA4, 0x59, 0xC2, 0x81, 0xC2, 0x79, 
-    0xC2, 0x79, 0xC2, 0x79, 0xA2, 0x79, 0xC2, 0x81, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x79, 0x63, 0x9A, 
-    0x63, 0x9A, 0x22, 0x8A, 0x42, 0x61, 0x62, 0x69, 0x62, 0x61, 0x62, 0x61, 0x62, 0x61, 0x62, 0x69, 
-    0x22, 0x51, 0xE3, 0x40, 0x03, 0x41, 0xE3, 0x40, 0xC5, 0x10, 0xC5, 0x08, 0xC5, 0x10, 0xA3, 0x08, 
-    0x83, 0x10, 0x83, 0x10, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x06, 0x11, 
-    0x06, 0x11, 0x06, 0x11, 0x68, 0x11, 0x68, 0x11, 0x69, 0x09, 0xA5, 0x51, 0xC2, 0x81, 0xC2, 0x79, 
-    0xC2, 0x81, 0xA2, 0x79, 0xA2, 0x79, 0xC2, 0x81, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x59, 0xE3, 0x79, 
-    0xC2, 0x71, 0xA2, 0x71, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0x22, 0x51, 0x22, 0x51, 0x22, 0x59, 
-    0x22, 0x51, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0xE4, 0x28, 0xC4, 0x20, 0xE4, 0x20, 0x62, 0x10, 
-    0x41, 0x08, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x08, 
-    0x83, 0x08, 0x83, 0x08, 0x25, 0x29, 0x45, 0x39, 0x45, 0x39, 0x63, 0x59, 0x82, 0x71, 0x82, 0x71, 
-    0x82, 0x71, 0xC2, 0x81, 0xC2, 0x79, 0xE2, 0x81, 0xE1, 0x40, 0x81, 0x28, 0x81, 0x30, 0x60, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0xA1, 0x30, 0x80, 0x28, 0xA0, 0x30, 0xA1, 0x30, 
-    0xA1, 0x30, 0x80, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0x38, 0xE2, 0x40, 
-    0xE2, 0x40, 0x02, 0x51, 0x82, 0x69, 0x62, 0x69, 0x62, 0x69, 0x02, 0x49, 0x02, 0x41, 0x03, 0x49, 
-    0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 0x02, 0x49, 0x20, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x21, 0x69, 0x21, 0x61, 0x22, 0x61, 0x22, 0x59, 0x22, 0x59, 
-    0x42, 0x61, 0xC2, 0x81, 0xC2, 0x81, 0xE2, 0x81, 0x82, 0x69, 0x22, 0x59, 0x42, 0x61, 0xE1, 0x48, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x59, 0xC3, 0x89, 0xA2, 0x79, 0xC2, 0x81, 0xC3, 0x81, 
-    0xC3, 0x81, 0xA2, 0x79, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x40, 0x02, 0x49, 
-    0xE2, 0x40, 0x22, 0x51, 0x62, 0x69, 0x62, 0x69, 0x62, 0x69, 0x22, 0x51, 0x02, 0x49, 0x03, 0x49, 
-    0x03, 0x49, 0x03, 0x41, 0x03, 0x41, 0x03, 0x41, 0x03, 0x49, 0x03, 0x49, 0x03, 0x49, 0x20, 0x10, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x61, 0x22, 0x59, 
-    0x42, 0x61, 0xE2, 0x81, 0xE2, 0x81, 0xE3, 0x81, 0x42, 0x61, 0xE2, 0x48, 0x02, 0x59, 0xA1, 0x38, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x49, 0xA2, 0x79, 0x82, 0x71, 0x82, 0x71, 0xA2, 0x79, 
-    0xA2, 0x79, 0x82, 0x71, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x40, 0x02, 0x49, 
-    0xE2, 0x40, 0x22, 0x51, 0x82, 0x69, 0x62, 0x69, 0x62, 0x69, 0x22, 0x51, 0x03, 0x49, 0x03, 0x49, 
-    0x03, 0x49, 0xE3, 0x40, 0x03, 0x41, 0xE2, 0x38, 0xA1, 0x28, 0xA1, 0x28, 0xC2, 0x30, 0x20, 0x08, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0xE1, 0x50, 0x02, 0x59, 0x02, 0x51, 0x22, 0x59, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x61, 0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0x62, 0x69, 0x42, 0x59, 0x62, 0x61, 0x01, 0x49, 
-    0x60, 0x18, 0x60, 0x20, 0x80, 0x28, 0x42, 0x61, 0xA2, 0x79, 0x82, 0x71, 0x82, 0x71, 0x62, 0x69, 
-    0x82, 0x71, 0x42, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0xA1, 0x30, 0xC2, 0x38, 0xE2, 0x40, 0xE2, 0x40, 0xE2, 0x40, 
-    0xE2, 0x40, 0x02, 0x41, 0x22, 0x51, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x03, 0x49, 0x03, 0x49, 
-    0x03, 0x49, 0xE2, 0x40, 0x03, 0x49, 0xA2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x30, 0x81, 0x38, 0x61, 0x30, 0xE2, 0x48, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x59, 0xE2, 0x48, 0xE2, 0x48, 0xE2, 0x48, 0x82, 0x69, 0x03, 0x82, 0xE3, 0x79, 0xE3, 0x79, 
-    0xC3, 0x79, 0xC3, 0x79, 0xC3, 0x79, 0xA2, 0x79, 0xA2, 0x71, 0xA2, 0x79, 0x42, 0x61, 0x61, 0x18, 
-    0x62, 0x20, 0x41, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 0x23, 0x51, 0x02, 0x49, 0x02, 0x49, 0xE2, 0x40, 0xE2, 0x40, 
-    0xE3, 0x40, 0x02, 0x41, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x03, 0x49, 0x03, 0x49, 
-    0x02, 0x41, 0xE2, 0x40, 0x03, 0x41, 0xC2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x30, 0x81, 0x38, 0x81, 0x30, 0xE2, 0x48, 0x22, 0x59, 0x22, 0x59, 
-    0x22, 0x59, 0x02, 0x51, 0x02, 0x51, 0xE2, 0x48, 0x83, 0x69, 0x03, 0x82, 0xE3, 0x79, 0xE3, 0x79, 
-    0xA2, 0x71, 0xA2, 0x71, 0xA2, 0x71, 0x82, 0x71, 0xA2, 0x71, 0xA2, 0x79, 0x42, 0x61, 0x61, 0x18, 
-    0x62, 0x20, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x20, 0x23, 0x51, 0x03, 0x49, 0x03, 0x51, 0x03, 0x41, 0x03, 0x41, 
-    0x03, 0x41, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x41, 0x02, 0x41, 0x03, 0x49, 
-    0x03, 0x49, 0x03, 0x49, 0x23, 0x49, 0xE2, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x81, 0x30, 0xA2, 0x38, 0x81, 0x30, 0xE2, 0x50, 0x22, 0x61, 0x22, 0x61, 
-    0x22, 0x59, 0xE2, 0x48, 0xE2, 0x48, 0xC2, 0x48, 0xA3, 0x71, 0x03, 0x82, 0x03, 0x82, 0x03, 0x7A, 
-    0xA3, 0x71, 0xA3, 0x71, 0xA3, 0x71, 0xA2, 0x79, 0xA2, 0x79, 0xA2, 0x79, 0x62, 0x61, 0x62, 0x20, 
-    0x82, 0x20, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0xA1, 0x30, 0xA1, 0x30, 0xA1, 0x28, 0xA2, 0x30, 0xA2, 0x30, 
-    0x82, 0x28, 0xC2, 0x38, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x22, 0x51, 0x02, 0x51, 0x22, 0x59, 
-    0xA1, 0x30, 0x41, 0x18, 0x61, 0x18, 0x61, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x10, 0x20, 0x10, 0x81, 0x28, 0xC2, 0x40, 0xA2, 0x38, 
-    0xE2, 0x40, 0xC2, 0x79, 0xC2, 0x79, 0xC2, 0x79, 0x62, 0x61, 0x22, 0x51, 0x42, 0x59, 0x22, 0x59, 
-    0x22, 0x61, 0x42, 0x61, 0x42, 0x61, 0xE2, 0x40, 0xC2, 0x38, 0xC2, 0x38, 0x81, 0x28, 0x00, 0x00, 
-    0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x18, 0x61, 0x20, 
-    0x41, 0x18, 0xA2, 0x30, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 0x42, 0x59, 0x22, 0x59, 0x42, 0x69, 
-    0x81, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0xA2, 0x28, 0x62, 0x20, 
-    0xC2, 0x38, 0x42, 0x92, 0x42, 0x92, 0x42, 0x9A, 0x42, 0x59, 0xC2, 0x40, 0xE2, 0x40, 0xE2, 0x48, 
-    0x02, 0x59, 0x02, 0x59, 0x02, 0x59, 0x82, 0x30, 0x62, 0x20, 0x82, 0x28, 0x20, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x18, 0x82, 0x20, 
-    0x62, 0x18, 0xA2, 0x30, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 0x22, 0x59, 0x22, 0x59, 0x43, 0x61, 
-    0xA1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x18, 0xA2, 0x30, 0x82, 0x20, 
-    0xC2, 0x38, 0x22, 0x92, 0x22, 0x92, 0x42, 0x92, 0x42, 0x59, 0xE2, 0x40, 0x02, 0x49, 0x02, 0x51, 
-    0x22, 0x59, 0x22, 0x59, 0x22, 0x61, 0xA2, 0x30, 0x82, 0x28, 0xA2, 0x30, 0x40, 0x10, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x18, 0x61, 0x20, 
-    0x61, 0x18, 0xA2, 0x30, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 0x22, 0x59, 0x22, 0x59, 0x43, 0x61, 
-    0xC1, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x18, 0xC2, 0x30, 0x82, 0x28, 
-    0xE2, 0x40, 0x22, 0x92, 0x02, 0x8A, 0x22, 0x8A, 0x42, 0x59, 0xC2, 0x40, 0xE2, 0x40, 0xE2, 0x48, 
-    0x02, 0x51, 0x02, 0x51, 0x02, 0x59, 0xA2, 0x30, 0x61, 0x20, 0x61, 0x20, 0x20, 0x08, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x20, 0x23, 0x51, 0x02, 0x49, 0x02, 0x49, 0x22, 0x49, 0x02, 0x51, 0x22, 0x51, 
-    0x22, 0x51, 0x42, 0x59, 0x42, 0x59, 0x42, 0x59, 0x22, 0x59, 0x22, 0x51, 0x02, 0x51, 0x40, 0x18, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 0x02, 0x8A, 0xE2, 0x81, 
-    0xC2, 0x79, 0x81, 0x18, 0x61, 0x18, 0x61, 0x10, 0xA2, 0x28, 0xA2, 0x38, 0xA2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x18, 0x02, 0x51, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 0x02, 0x49, 
-    0x22, 0x59, 0x83, 0x69, 0x83, 0x69, 0x83, 0x69, 0x63, 0x69, 0x62, 0x69, 0xA3, 0x79, 0xA1, 0x30, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x51, 0x02, 0x92, 0x02, 0x8A, 
-    0xA2, 0x71, 0x21, 0x00, 0x41, 0x08, 0x21, 0x08, 0x82, 0x28, 0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 
-    0xA2, 0x30, 0xA2, 0x30, 0xA2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x61, 0x20, 0x23, 0x59, 0x23, 0x51, 0x23, 0x51, 0x23, 0x51, 0x23, 0x51, 0x23, 0x51, 
-    0x43, 0x59, 0x83, 0x71, 0x83, 0x69, 0x83, 0x69, 0x83, 0x71, 0x83, 0x69, 0xA3, 0x79, 0xC1, 0x38, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x59, 0x42, 0xA2, 0x22, 0x9A, 
-    0xC2, 0x79, 0x41, 0x08, 0x41, 0x08, 0x41, 0x10, 0xA2, 0x30, 0xC2, 0x38, 0xC2, 0x38, 0xC2, 0x38, 
-    0xC2, 0x38, 0xC2, 0x38, 0xA2, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x20, 0x10, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 0x81, 0x28, 
-    0xA1, 0x30, 0xC1, 0x38, 0xC1, 0x38, 0xE1, 0x40, 0xE1, 0x40, 0xE1, 0x40, 0x01, 0x49, 0x60, 0x20, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x28, 0x01, 0x49, 0x01, 0x49, 
-    0xC0, 0x38, 0x20, 0x00, 0x20, 0x08, 0x20, 0x00, 0x20, 0x10, 0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 
-    0x40, 0x10, 0x40, 0x10, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-};
-
-/* LVGL image descriptor */
-const lv_img_dsc_t howdy_img_howdyright2 = {
-    .header.cf = LV_IMG_CF_TRUE_COLOR,
-    .header.always_zero = 0,
-    .header.reserved = 0,
-    .header.w = 128,
-    .header.h = 128,
-    .data_size = 32768,
-    .data = howdy_img_howdyright2_data,
-};
@@ -1,5 +1,5 @@
 #include "voice_assistant_ui.h"
-#include "images/howdy_images.h"
+#include "howdy_asset_pack.h"
 #include "esp_log.h"
 #include "esp_check.h"
 #include "esp_timer.h"
@@ -222,9 +222,11 @@ static void create_howdy_character(void)
 {
     ESP_LOGI(TAG, "Creating Howdy character image");
 
+    howdy_asset_pack_init();
+
     // Create Howdy character image in the center
     s_howdy_character = lv_img_create(s_circular_container);
-    lv_img_set_src(s_howdy_character, &howdy_img_armraisehowdy);  // Default to greeting pose
+    lv_img_set_src(s_howdy_character, howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY));  // Default to greeting pose
     lv_obj_center(s_howdy_character);
     
     // Style the character image
@@ -423,37 +425,37 @@ static void update_howdy_character(va_ui_state_t state)
     
     switch (state) {
         case VA_UI_STATE_IDLE:
-            character_image = &howdy_img_armraisehowdy;  // Friendly greeting pose
+            character_image = howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY);  // Friendly greeting pose
             ESP_LOGI(TAG, "Howdy: Greeting pose (IDLE)");
             break;
             
         case VA_UI_STATE_LISTENING:
-            character_image = &howdy_img_howdyleft;  // Looking left, listening attentively
+            character_image = howdy_asset_img(HOWDY_IMG_HOWDYLEFT);  // Looking left, listening attentively
             ESP_LOGI(TAG, "Howdy: Listening pose");
             break;
             
         case VA_UI_STATE_PROCESSING:
-            character_image = &howdy_img_howdybackward;  // Thinking pose
+            character_image = howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD);  // Thinking pose
             ESP_LOGI(TAG, "Howdy: Thinking pose (PROCESSING)");
             break;
             
         case VA_UI_STATE_SPEAKING:
-            character_image = &howdy_img_howdyright;  // Speaking/responding pose
+            character_image = howdy_asset_img(HOWDY_IMG_HOWDYRIGHT);  // Speaking/responding pose
             ESP_LOGI(TAG, "Howdy: Speaking pose");
             break;
             
         case VA_UI_STATE_CONNECTING:
-            character_image = &howdy_img_howdyright2;  // Alternative right pose for connecting
+            character_image = howdy_asset_img(HOWDY_IMG_HOWDYRIGHT2);  // Alternative right pose for connecting
             ESP_LOGI(TAG, "Howdy: Connecting pose");
             break;
             
         case VA_UI_STATE_ERROR:
-            character_image = &howdy_img_howdybackward;  // Confused/error pose
+            character_image = howdy_asset_img(HOWDY_IMG_HOWDYBACKWARD);  // Confused/error pose
             ESP_LOGI(TAG, "Howdy: Error pose");
             break;
             
         default:
-            character_image = &howdy_img_armraisehowdy;  // Default greeting
+            character_image = howdy_asset_img(HOWDY_IMG_ARMRAISEHOWDY);  // Default greeting
             break;
     }
     
@@ -575,8 +577,9 @@ static void create_boot_screen(void)
     lv_obj_align(subtitle_label, LV_ALIGN_TOP_MID, 0, 80);
 
     // Large cowboy Howdy character in center - the perfect boot screen image!
+    howdy_asset_pack_init();
     s_boot_howdy_character = lv_img_create(s_boot_screen);
-    lv_img_set_src(s_boot_howdy_character, &howdy_img_howdymidget);  // Cowboy Howdy with hat and badge
+    lv_img_set_src(s_boot_howdy_character, howdy_asset_img(HOWDY_IMG_HOWDYMIDGET));  // Cowboy Howdy with hat and badge
     lv_obj_center(s_boot_howdy_character);
     
     // Make boot character larger and more prominent
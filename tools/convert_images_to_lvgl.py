@@ -2,13 +2,97 @@
 """
 Convert PNG images to LVGL C array format for ESP32-P4 Voice Assistant UI
 Optimized for embedded systems with memory constraints
+
+With --pack, writes one LZ4-compressed asset pack for the "assets" flash
+partition plus the howdy_images.h ID header instead of C arrays (see
+components/ui_manager/include/howdy_asset_format.h for the layout).
 """
 
 import os
+import re
+import struct
 import sys
-from PIL import Image
+import zlib
 import argparse
 
+try:
+    from PIL import Image
+except ImportError:     # Only needed for PNG input; --from-c works without it
+    Image = None
+
+def png_to_rgb565(image_path, max_width=128, max_height=128):
+    """
+    Load a PNG as little-endian RGB565, blended onto black
+
+    Returns:
+        (width, height, pixel bytes, original size)
+    """
+    if Image is None:
+        raise RuntimeError("Pillow is required for PNG input (pip install pillow)")
+
+    # Open and process image
+    img = Image.open(image_path)
+    original_size = img.size
+    print(f"Processing {image_path}: {original_size[0]}x{original_size[1]}")
+    
+    # Convert to RGBA if not already
+    if img.mode != 'RGBA':
+        img = img.convert('RGBA')
+    
+    # Scale down if needed for embedded constraints
+    if img.width > max_width or img.height > max_height:
+        img.thumbnail((max_width, max_height), Image.Resampling.LANCZOS)
+        print(f"Scaled to: {img.width}x{img.height}")
+    
+    # Convert to RGB565 format for LVGL (saves memory)
+    width, height = img.size
+    
+    pixel_data = bytearray()
+    for y in range(height):
+        for x in range(width):
+            r, g, b, a = img.getpixel((x, y))
+            
+            # Handle transparency - blend with black background
+            if a < 255:
+                alpha = a / 255.0
+                r = int(r * alpha)
+                g = int(g * alpha) 
+                b = int(b * alpha)
+            
+            # Convert to RGB565 (16-bit: 5R + 6G + 5B)
+            r565 = (r >> 3) & 0x1F
+            g565 = (g >> 2) & 0x3F  
+            b565 = (b >> 3) & 0x1F
+            
+            rgb565 = (r565 << 11) | (g565 << 5) | b565
+            
+            # Store as little-endian bytes
+            pixel_data.append(rgb565 & 0xFF)
+            pixel_data.append((rgb565 >> 8) & 0xFF)
+    
+    return width, height, bytes(pixel_data), original_size
+
+def c_array_to_rgb565(c_path):
+    """
+    Read the pixels back out of a C array written by this script
+
+    Lets the pack be built from the checked-in arrays without Pillow.
+
+    Returns:
+        (width, height, pixel bytes)
+    """
+    with open(c_path) as f:
+        text = f.read()
+    
+    width = int(re.search(r'\.header\.w\s*=\s*(\d+)', text).group(1))
+    height = int(re.search(r'\.header\.h\s*=\s*(\d+)', text).group(1))
+    body = re.search(r'_data\[\]\s*=\s*\{(.*?)\};', text, re.S).group(1)
+    pixel_data = bytes(int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', body))
+    
+    if len(pixel_data) != width * height * 2:
+        raise ValueError(f"{c_path}: {len(pixel_data)} bytes for {width}x{height} RGB565")
+    return width, height, pixel_data
+
 def convert_png_to_lvgl_c_array(image_path, output_path, var_name, max_width=128, max_height=128):
     """
     Convert PNG image to LVGL C array format
@@ -21,22 +105,7 @@ def convert_png_to_lvgl_c_array(image_path, output_path, var_name, max_width=128
         max_height: Maximum height for scaling (default 128px for embedded)
     """
     try:
-        # Open and process image
-        img = Image.open(image_path)
-        original_size = img.size
-        print(f"Processing {image_path}: {original_size[0]}x{original_size[1]}")
-        
-        # Convert to RGBA if not already
-        if img.mode != 'RGBA':
-            img = img.convert('RGBA')
-        
-        # Scale down if needed for embedded constraints
-        if img.width > max_width or img.height > max_height:
-            img.thumbnail((max_width, max_height), Image.Resampling.LANCZOS)
-            print(f"Scaled to: {img.width}x{img.height}")
-        
-        # Convert to RGB565 format for LVGL (saves memory)
-        width, height = img.size
+        width, height, pixel_data, original_size = png_to_rgb565(image_path, max_width, max_height)
         
         # Generate C header content
         header_content = f"""/* Auto-generated LVGL image data from {os.path.basename(image_path)} */
@@ -67,30 +136,6 @@ extern const lv_img_dsc_t {var_name};
 static const uint8_t {var_name}_data[] = {{
 """
         
-        # Convert pixels to RGB565 format
-        pixel_data = []
-        for y in range(height):
-            for x in range(width):
-                r, g, b, a = img.getpixel((x, y))
-                
-                # Handle transparency - blend with black background
-                if a < 255:
-                    alpha = a / 255.0
-                    r = int(r * alpha)
-                    g = int(g * alpha) 
-                    b = int(b * alpha)
-                
-                # Convert to RGB565 (16-bit: 5R + 6G + 5B)
-                r565 = (r >> 3) & 0x1F
-                g565 = (g >> 2) & 0x3F  
-                b565 = (b >> 3) & 0x1F
-                
-                rgb565 = (r565 << 11) | (g565 << 5) | b565
-                
-                # Store as little-endian bytes
-                pixel_data.append(rgb565 & 0xFF)
-                pixel_data.append((rgb565 >> 8) & 0xFF)
-        
         # Format pixel data as C array
         for i, byte in enumerate(pixel_data):
             if i % 16 == 0:
@@ -130,17 +175,180 @@ const lv_img_dsc_t {var_name} = {{
         print(f"Error processing {image_path}: {e}")
         return False
 
+# ---- Asset pack ----
+
+PACK_MAGIC = 0x474D4948         # "HIMG"
+PACK_VERSION = 1
+PACK_NAME_LEN = 24
+PACK_HEADER = struct.Struct('<IHHII')
+PACK_ENTRY = struct.Struct(f'<{PACK_NAME_LEN}sHHBBHIIII')
+LV_IMG_CF_TRUE_COLOR = 4
+CODEC_RAW = 0
+CODEC_LZ4 = 1
+
+def _lz4_length(out, value):
+    while value >= 255:
+        out.append(255)
+        value -= 255
+    out.append(value)
+
+def _lz4_sequence(out, literals, offset=0, match_len=0):
+    lit_len = len(literals)
+    ml = match_len - 4 if offset else 0
+    out.append((min(lit_len, 15) << 4) | min(ml, 15))
+    if lit_len >= 15:
+        _lz4_length(out, lit_len - 15)
+    out += literals
+    if offset:
+        out += struct.pack('<H', offset)
+        if ml >= 15:
+            _lz4_length(out, ml - 15)
+
+def lz4_block_compress(data):
+    """
+    Greedy LZ4 block compressor (no frame header)
+
+    Not as tight as liblz4, but needs no dependency and the character
+    images are mostly runs of black. Follows the block format's end rules:
+    the last 5 bytes are literals and no match starts in the last 12.
+    """
+    n = len(data)
+    out = bytearray()
+    last_seen = {}
+    anchor = 0
+    i = 0
+    while i < n - 12:
+        key = data[i:i + 4]
+        candidate = last_seen.get(key)
+        last_seen[key] = i
+        if candidate is None or i - candidate > 0xFFFF:
+            i += 1
+            continue
+        match_len = 4
+        max_len = n - 5 - i
+        while match_len < max_len and data[candidate + match_len] == data[i + match_len]:
+            match_len += 1
+        _lz4_sequence(out, data[anchor:i], i - candidate, match_len)
+        i += match_len
+        anchor = i
+    _lz4_sequence(out, data[anchor:])
+    return bytes(out)
+
+def write_asset_pack(images, pack_path, header_path, compress=True):
+    """
+    Write images into one asset pack plus the matching ID header
+
+    Args:
+        images: list of (name, width, height, RGB565 bytes), in ID order
+        pack_path: Output .bin for the "assets" partition
+        header_path: Output howdy_images.h
+        compress: LZ4-compress entries that get smaller
+    """
+    table_size = PACK_HEADER.size + PACK_ENTRY.size * len(images)
+    entries = bytearray()
+    payload = bytearray()
+    for name, width, height, pixels in images:
+        if len(name.encode()) >= PACK_NAME_LEN:
+            raise ValueError(f"asset name too long: {name}")
+        stored, codec = pixels, CODEC_RAW
+        if compress:
+            packed = lz4_block_compress(pixels)
+            if len(packed) < len(pixels):
+                stored, codec = packed, CODEC_LZ4
+        # Keep every entry 4-byte aligned so raw images can be used in place
+        payload += b'\0' * (-len(payload) % 4)
+        entries += PACK_ENTRY.pack(name.encode(), width, height, LV_IMG_CF_TRUE_COLOR, codec, 0,
+                                   table_size + len(payload), len(stored), len(pixels),
+                                   zlib.crc32(pixels))
+        payload += stored
+        print(f"  {name:<20} {width}x{height} {len(pixels):>7} -> {len(stored):>7} bytes "
+              f"({'lz4' if codec == CODEC_LZ4 else 'raw'})")
+    
+    total = table_size + len(payload)
+    with open(pack_path, 'wb') as f:
+        f.write(PACK_HEADER.pack(PACK_MAGIC, PACK_VERSION, len(images), total, 0))
+        f.write(entries)
+        f.write(payload)
+    
+    ids = ''.join(f"    HOWDY_IMG_{name.upper()},\n" for name, _, _, _ in images)
+    names = ''.join(f'    "{name}", \\\n' for name, _, _, _ in images)
+    header = f"""/* Auto-generated by tools/convert_images_to_lvgl.py --pack */
+/* IDs of the images in {os.path.basename(pack_path)}; load them with howdy_asset_img() */
+
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+typedef enum {{
+{ids}    HOWDY_IMG_COUNT
+}} howdy_img_id_t;
+
+/* Pack entry name for each ID, in ID order */
+#define HOWDY_IMG_NAMES {{ \\
+{names}}}
+
+#ifdef __cplusplus
+}}
+#endif
+"""
+    with open(header_path, 'w') as f:
+        f.write(header)
+    
+    raw_total = sum(len(p) for _, _, _, p in images)
+    print(f"Generated: {pack_path} ({total} bytes, {raw_total} raw) and {header_path}")
+
+def asset_name(filename):
+    """Pack entry name: the C variable name without the howdy_img_ prefix"""
+    stem = os.path.splitext(filename)[0].lower().replace('-', '_').replace(' ', '_')
+    return stem[len('howdy_img_'):] if stem.startswith('howdy_img_') else stem
+
+def build_pack(args):
+    if args.from_c:
+        files = sorted(f for f in os.listdir(args.input_dir)
+                       if f.startswith('howdy_img_') and f.endswith('.c'))
+    else:
+        files = sorted(f for f in os.listdir(args.input_dir) if f.lower().endswith('.png'))
+    if not files:
+        print(f"No {'C array' if args.from_c else 'PNG'} files found in {args.input_dir}")
+        return 1
+    
+    images = []
+    for filename in files:
+        path = os.path.join(args.input_dir, filename)
+        if args.from_c:
+            width, height, pixels = c_array_to_rgb565(path)
+        else:
+            width, height, pixels, _ = png_to_rgb565(path, args.max_size, args.max_size)
+        images.append((asset_name(filename), width, height, pixels))
+    
+    print(f"Packing {len(images)} images...")
+    write_asset_pack(images,
+                     os.path.join(args.output_dir, 'howdy_assets.bin'),
+                     os.path.join(args.output_dir, 'howdy_images.h'),
+                     compress=not args.no_compress)
+    return 0
+
 def main():
     parser = argparse.ArgumentParser(description='Convert PNG images to LVGL C arrays')
     parser.add_argument('input_dir', help='Input directory containing PNG files')
     parser.add_argument('output_dir', help='Output directory for C files')
     parser.add_argument('--max-size', type=int, default=128, help='Maximum image dimension')
+    parser.add_argument('--pack', action='store_true',
+                        help='Write howdy_assets.bin and howdy_images.h instead of C arrays')
+    parser.add_argument('--from-c', action='store_true',
+                        help='With --pack, read existing howdy_img_*.c arrays instead of PNGs')
+    parser.add_argument('--no-compress', action='store_true', help='With --pack, store images raw')
     
     args = parser.parse_args()
     
     # Create output directory if it doesn't exist
     os.makedirs(args.output_dir, exist_ok=True)
     
+    if args.pack:
+        return build_pack(args)
+    
     # Process all PNG files in input directory
     png_files = [f for f in os.listdir(args.input_dir) if f.lower().endswith('.png')]
     
@@ -195,4 +403,4 @@ extern "C" {{
     print(f"Generated combined header: {combined_header_path}")
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    sys.exit(main())
\ No newline at end of file
@@ -0,0 +1,196 @@
+/*
+ * Checks an image asset pack and measures the LZ4 decoder on the host.
+ *
+ * Every entry is decoded with the firmware's howdy_lz4_decompress() and
+ * compared against the CRC the packer stored. The decoder is then fed
+ * truncated and bit-flipped copies of each entry; it must reject or
+ * survive them without writing outside the output buffer (run under
+ * -DHOWDY_HOST_SANITIZE=ON to be sure). Finally each entry is decoded
+ * --runs times and the median throughput reported.
+ *
+ * Exits 1 if any entry fails to decode or mismatches its CRC.
+ */
+#include "howdy_asset_format.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_RUNS            64
+#define CORRUPT_TRIALS      2000
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// zlib CRC-32, the same as esp_rom_crc32_le(0, ...)
+static uint32_t crc32_zlib(const uint8_t *buf, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (uint32_t)-(int32_t)(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static uint8_t *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = size > 0 ? malloc((size_t)size) : NULL;
+    if (buf && fread(buf, 1, (size_t)size, f) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    *len = buf ? (size_t)size : 0;
+    return buf;
+}
+
+// Corrupt input must never overrun; whether it is rejected depends on where the damage lands
+static uint32_t corrupt_trials(const howdy_asset_entry_t *e, const uint8_t *stored, uint8_t *out)
+{
+    uint8_t *copy = malloc(e->size);
+    uint32_t rejected = 0;
+    uint32_t lcg = 0x2545F491u;
+
+    for (int t = 0; t < CORRUPT_TRIALS; t++) {
+        memcpy(copy, stored, e->size);
+        lcg = lcg * 1664525u + 1013904223u;
+        size_t len = e->size;
+        if (t % 2) {
+            len = lcg % e->size;                        // truncated
+        } else {
+            copy[lcg % e->size] ^= (uint8_t)(1u << ((lcg >> 24) & 7));   // one bit flipped
+        }
+        int r = howdy_lz4_decompress(copy, len, out, e->raw_size);
+        if (r < 0 || (uint32_t)r != e->raw_size || crc32_zlib(out, (size_t)r) != e->crc32) {
+            rejected++;
+        }
+    }
+    free(copy);
+    return rejected;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [pack.bin] [--runs N]\n"
+            "  default pack: %s\n", argv0, HOWDY_ASSET_PACK_DEFAULT);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = HOWDY_ASSET_PACK_DEFAULT;
+    int runs = 15;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            runs = atoi(argv[++i]);
+            if (runs < 1 || runs > MAX_RUNS) {
+                fprintf(stderr, "--runs must be 1..%d\n", MAX_RUNS);
+                return 2;
+            }
+        } else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            path = argv[i];
+        }
+    }
+
+    size_t len;
+    uint8_t *pack = read_file(path, &len);
+    if (!pack) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 2;
+    }
+
+    const howdy_asset_pack_header_t *hdr = (const howdy_asset_pack_header_t *)pack;
+    if (len < sizeof(*hdr) || hdr->magic != HOWDY_ASSET_PACK_MAGIC ||
+        hdr->version != HOWDY_ASSET_PACK_VERSION || hdr->total_size != len ||
+        sizeof(*hdr) + (size_t)hdr->count * sizeof(howdy_asset_entry_t) > len) {
+        fprintf(stderr, "%s: not a v%d asset pack\n", path, HOWDY_ASSET_PACK_VERSION);
+        free(pack);
+        return 1;
+    }
+
+    const howdy_asset_entry_t *table = (const howdy_asset_entry_t *)(pack + sizeof(*hdr));
+    bool ok = true;
+    uint64_t raw_total = 0;
+    double ns_total = 0;
+
+    printf("%-20s %9s %8s %7s %6s %10s %10s %9s\n",
+           "asset", "size", "stored", "codec", "crc", "us/decode", "MB/s", "rejected");
+    for (int i = 0; i < hdr->count; i++) {
+        const howdy_asset_entry_t *e = &table[i];
+        if (e->offset > len || e->size > len - e->offset) {
+            printf("%-20.*s entry out of bounds\n", HOWDY_ASSET_NAME_LEN, e->name);
+            ok = false;
+            continue;
+        }
+        const uint8_t *stored = pack + e->offset;
+        uint8_t *out = malloc(e->raw_size ? e->raw_size : 1);
+
+        int r;
+        if (e->codec == HOWDY_ASSET_CODEC_LZ4) {
+            r = howdy_lz4_decompress(stored, e->size, out, e->raw_size);
+        } else {
+            memcpy(out, stored, e->size);
+            r = (int)e->size;
+        }
+        bool crc_ok = r == (int)e->raw_size && crc32_zlib(out, (size_t)r) == e->crc32;
+        ok &= crc_ok;
+
+        double per_run[MAX_RUNS];
+        uint32_t rejected = 0;
+        if (e->codec == HOWDY_ASSET_CODEC_LZ4 && crc_ok) {
+            for (int run = 0; run < runs; run++) {
+                int64_t start = now_ns();
+                howdy_lz4_decompress(stored, e->size, out, e->raw_size);
+                per_run[run] = (double)(now_ns() - start);
+            }
+            qsort(per_run, (size_t)runs, sizeof(double), cmp_double);
+            rejected = corrupt_trials(e, stored, out);
+            raw_total += e->raw_size;
+            ns_total += per_run[runs / 2];
+        }
+
+        printf("%-20.*s %4ux%-4u %8lu %7s %6s", HOWDY_ASSET_NAME_LEN, e->name, e->width, e->height,
+               (unsigned long)e->size, e->codec == HOWDY_ASSET_CODEC_LZ4 ? "lz4" : "raw",
+               crc_ok ? "ok" : "BAD");
+        if (e->codec == HOWDY_ASSET_CODEC_LZ4 && crc_ok) {
+            double ns = per_run[runs / 2];
+            printf(" %10.1f %10.1f %5u/%d\n", ns / 1000.0, e->raw_size / ns * 1000.0,
+                   rejected, CORRUPT_TRIALS);
+        } else {
+            printf(" %10s %10s %9s\n", "-", "-", "-");
+        }
+        free(out);
+    }
+
+    if (ns_total > 0) {
+        printf("TOTAL %lu bytes decoded at %.1f MB/s (median of %d runs)\n",
+               (unsigned long)raw_total, raw_total / ns_total * 1000.0, runs);
+    }
+    free(pack);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,557 @@
+/*
+ * Microbenchmarks for the audio_processor DSP modules on the host.
+ *
+ * Every kernel is fed the same deterministic 16 kHz test signal (voiced
+ * bursts alternating with low-level noise) one 20 ms frame at a time and
+ * reports:
+ *   ns/frame      median over --runs runs of --frames frames (min alongside)
+ *   allocs/frame  heap_caps_* allocations per frame in steady state
+ *   copied/frame  memcpy/memmove bytes per frame (Linux builds only)
+ *
+ * --json writes the results; --baseline compares against an earlier --json
+ * file and exits 1 if any kernel's median got more than --max-regression
+ * percent slower.
+ */
+#include "enhanced_vad.h"
+#include "esp32_p4_wake_word.h"
+#include "enhanced_udp_audio.h"
+#include "tts_jitter_buffer.h"
+#include "tts_plc.h"
+#include "audio_memory_buffer.h"
+#include "host_shim.h"
+#ifdef HOWDY_BENCH_PROTOCOL
+#include "howdytts_protocol.h"
+#include "howdy_heap_tags.h"
+#include "mbedtls/base64.h"
+#endif
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SAMPLE_RATE         16000
+#define FRAME_SAMPLES       320                     // 20 ms
+#define SIGNAL_SECONDS      10
+#define SIGNAL_SAMPLES      (SAMPLE_RATE * SIGNAL_SECONDS)
+#define SIGNAL_FRAMES       (SIGNAL_SAMPLES / FRAME_SAMPLES)
+#define WARMUP_FRAMES       200
+#define MAX_KERNELS         16
+#define MAX_RUNS            64
+
+typedef struct {
+    const char *name;
+    const char *what;
+    void *(*setup)(void);
+    void (*run)(void *ctx, const int16_t *frame, size_t index);
+    void (*teardown)(void *ctx);
+} bench_kernel_t;
+
+typedef struct {
+    const char *name;
+    double ns_median;
+    double ns_min;
+    double allocs_per_frame;
+    double copied_per_frame;
+} bench_result_t;
+
+static int16_t s_signal[SIGNAL_SAMPLES];
+static int s_global_ctx;                            // setup() result for kernels with module-level state
+static enhanced_vad_result_t s_vad_track[SIGNAL_FRAMES];
+
+// ---- Test signal ----
+
+static uint32_t s_lcg = 0x12345678u;
+
+static float noise(void)
+{
+    s_lcg = s_lcg * 1664525u + 1013904223u;
+    return (float)(int32_t)s_lcg / 2147483648.0f;
+}
+
+static void generate_signal(void)
+{
+    const float two_pi = 6.283185307f;
+    for (size_t i = 0; i < SIGNAL_SAMPLES; i++) {
+        float t = (float)i / SAMPLE_RATE;
+        bool voiced = ((int)t % 2) == 0;
+        float v = 120.0f * noise();                 // background floor
+        if (voiced) {
+            // Glottal-ish harmonic stack with a 4 Hz syllable envelope
+            float f0 = 140.0f + 20.0f * sinf(two_pi * 0.7f * t);
+            float env = 0.5f + 0.5f * sinf(two_pi * 4.0f * t);
+            for (int h = 1; h <= 12; h++) {
+                v += env * (6000.0f / h) * sinf(two_pi * f0 * h * t);
+            }
+        }
+        if (v > 32767.0f) v = 32767.0f;
+        if (v < -32768.0f) v = -32768.0f;
+        s_signal[i] = (int16_t)v;
+    }
+}
+
+// Wake word and UDP kernels take a VAD result per frame; compute the track once
+static void precompute_vad_track(void)
+{
+    enhanced_vad_config_t cfg;
+    enhanced_vad_get_default_config(SAMPLE_RATE, &cfg);
+    enhanced_vad_handle_t vad = enhanced_vad_init(&cfg);
+    for (size_t f = 0; f < SIGNAL_FRAMES; f++) {
+        enhanced_vad_process_audio(vad, &s_signal[f * FRAME_SAMPLES], FRAME_SAMPLES, &s_vad_track[f]);
+    }
+    enhanced_vad_deinit(vad);
+}
+
+// ---- Kernels ----
+
+static void *vad_setup(void)
+{
+    enhanced_vad_config_t cfg;
+    enhanced_vad_get_default_config(SAMPLE_RATE, &cfg);
+    return enhanced_vad_init(&cfg);
+}
+
+static void vad_run(void *ctx, const int16_t *frame, size_t index)
+{
+    (void)index;
+    enhanced_vad_result_t result;
+    enhanced_vad_process_audio((enhanced_vad_handle_t)ctx, frame, FRAME_SAMPLES, &result);
+}
+
+static void vad_teardown(void *ctx)
+{
+    enhanced_vad_deinit((enhanced_vad_handle_t)ctx);
+}
+
+static void *wake_setup(void)
+{
+    esp32_p4_wake_word_config_t cfg;
+    esp32_p4_wake_word_get_default_config(&cfg);
+    return esp32_p4_wake_word_init(&cfg);
+}
+
+static void wake_run(void *ctx, const int16_t *frame, size_t index)
+{
+    esp32_p4_wake_word_result_t result;
+    esp32_p4_wake_word_process((esp32_p4_wake_word_handle_t)ctx, frame, FRAME_SAMPLES,
+                               &s_vad_track[index], &result);
+}
+
+static void wake_teardown(void *ctx)
+{
+    esp32_p4_wake_word_deinit((esp32_p4_wake_word_handle_t)ctx);
+}
+
+static void *udp_setup(void)
+{
+    udp_audio_config_t basic = {
+        .server_ip = "127.0.0.1",
+        .server_port = 8003,
+        .buffer_size = 2048,
+        .packet_size_ms = 20,
+    };
+    enhanced_udp_audio_config_t cfg;
+    enhanced_udp_audio_get_default_config(&basic, &cfg);
+    cfg.enable_vad_optimization = false;    // wall-clock silence suppression would skew timings
+    return enhanced_udp_audio_init(&cfg) == ESP_OK ? &s_global_ctx : NULL;
+}
+
+static void udp_run(void *ctx, const int16_t *frame, size_t index)
+{
+    (void)ctx;
+    enhanced_udp_audio_send_with_vad(frame, FRAME_SAMPLES, &s_vad_track[index]);
+}
+
+static void udp_teardown(void *ctx)
+{
+    (void)ctx;
+    enhanced_udp_audio_deinit();
+}
+
+static void *jb_setup(void)
+{
+    tts_jitter_buffer_t *jb = tts_jb_create(FRAME_SAMPLES, 3, 16);
+    if (jb) {
+        tts_jb_enable_plc(jb, SAMPLE_RATE);
+    }
+    return jb;
+}
+
+static void jb_run(void *ctx, const int16_t *frame, size_t index)
+{
+    (void)index;
+    int16_t out[FRAME_SAMPLES];
+    bool false_underrun;
+    tts_jb_push((tts_jitter_buffer_t *)ctx, frame, FRAME_SAMPLES);
+    tts_jb_pop_frame((tts_jitter_buffer_t *)ctx, out, &false_underrun);
+}
+
+static void jb_teardown(void *ctx)
+{
+    tts_jb_destroy((tts_jitter_buffer_t *)ctx);
+}
+
+static void *plc_setup(void)
+{
+    return tts_plc_create(SAMPLE_RATE, FRAME_SAMPLES);
+}
+
+// Every fourth frame is lost and concealed
+static void plc_run(void *ctx, const int16_t *frame, size_t index)
+{
+    int16_t work[FRAME_SAMPLES];
+    if ((index & 3) == 3) {
+        tts_plc_conceal_frame((tts_plc_t *)ctx, work);
+    } else {
+        memcpy(work, frame, sizeof(work));
+        tts_plc_good_frame((tts_plc_t *)ctx, work);
+    }
+}
+
+static void plc_teardown(void *ctx)
+{
+    tts_plc_destroy((tts_plc_t *)ctx);
+}
+
+static void *ring_setup(void)
+{
+    audio_memory_buffer_t *amb = calloc(1, sizeof(*amb));
+    if (amb && audio_memory_buffer_init(amb, FRAME_SAMPLES * 8) != ESP_OK) {
+        free(amb);
+        return NULL;
+    }
+    return amb;
+}
+
+static void ring_run(void *ctx, const int16_t *frame, size_t index)
+{
+    (void)index;
+    int16_t out[FRAME_SAMPLES];
+    audio_memory_buffer_write((audio_memory_buffer_t *)ctx, frame, FRAME_SAMPLES);
+    audio_memory_buffer_read((audio_memory_buffer_t *)ctx, out, FRAME_SAMPLES);
+}
+
+static void ring_teardown(void *ctx)
+{
+    audio_memory_buffer_deinit((audio_memory_buffer_t *)ctx);
+    free(ctx);
+}
+
+#ifdef HOWDY_BENCH_PROTOCOL
+#define PROTO_MESSAGE_SIZE  4096
+
+static char s_proto_message[PROTO_MESSAGE_SIZE];
+
+static void *proto_setup(void)
+{
+    howdytts_session_config_t session = {
+        .session_id = "bench-session",
+        .device_id = "host",
+        .audio_config = { .sample_rate = SAMPLE_RATE, .channels = 1, .bits_per_sample = 16 },
+        .keepalive_interval_ms = 30000,
+    };
+    howdy_heap_install_cjson_hooks();
+    return howdytts_protocol_init(&session) == ESP_OK ? &s_global_ctx : NULL;
+}
+
+static void proto_encode_run(void *ctx, const int16_t *frame, size_t index)
+{
+    (void)ctx;
+    (void)index;
+    howdytts_create_audio_message(frame, FRAME_SAMPLES, s_proto_message, sizeof(s_proto_message));
+}
+
+static void *proto_decode_setup(void)
+{
+    if (!proto_setup()) {
+        return NULL;
+    }
+
+    // A tts_response carrying one frame, built without the code under test
+    unsigned char b64[FRAME_SAMPLES * 2 * 4 / 3 + 8];
+    size_t b64_len = 0;
+    mbedtls_base64_encode(b64, sizeof(b64), &b64_len, (const unsigned char *)s_signal,
+                          FRAME_SAMPLES * sizeof(int16_t));
+    snprintf(s_proto_message, sizeof(s_proto_message),
+             "{\"event\":\"tts_response\",\"media\":{\"payload\":\"%s\"}}", (const char *)b64);
+    return &s_global_ctx;
+}
+
+static void proto_decode_run(void *ctx, const int16_t *frame, size_t index)
+{
+    (void)ctx;
+    (void)frame;
+    (void)index;
+    int16_t out[FRAME_SAMPLES];
+    size_t decoded = 0;
+    howdytts_parse_tts_response(s_proto_message, out, FRAME_SAMPLES, &decoded);
+}
+
+// The protocol module has no deinit; a second init just overwrites the session
+static void proto_teardown(void *ctx)
+{
+    (void)ctx;
+}
+#endif
+
+static const bench_kernel_t s_kernels[] = {
+    { "vad",            "enhanced_vad_process_audio",               vad_setup,  vad_run,  vad_teardown },
+    { "wake_word",      "esp32_p4_wake_word_process",               wake_setup, wake_run, wake_teardown },
+    { "udp_send",       "enhanced_udp_audio_send_with_vad",         udp_setup,  udp_run,  udp_teardown },
+    { "jitter_buffer",  "tts_jb_push + tts_jb_pop_frame (PLC on)",  jb_setup,   jb_run,   jb_teardown },
+    { "plc",            "tts_plc good/conceal, 25% loss",           plc_setup,  plc_run,  plc_teardown },
+    { "ring",           "audio_memory_buffer write + read",         ring_setup, ring_run, ring_teardown },
+#ifdef HOWDY_BENCH_PROTOCOL
+    { "proto_encode",   "howdytts_create_audio_message",            proto_setup,        proto_encode_run, proto_teardown },
+    { "proto_decode",   "howdytts_parse_tts_response",              proto_decode_setup, proto_decode_run, proto_teardown },
+#endif
+};
+
+#define KERNEL_COUNT (sizeof(s_kernels) / sizeof(s_kernels[0]))
+
+// ---- Measurement ----
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static bool run_kernel(const bench_kernel_t *k, int runs, int frames, bench_result_t *out)
+{
+    void *ctx = k->setup();
+    if (!ctx) {
+        fprintf(stderr, "%s: setup failed\n", k->name);
+        return false;
+    }
+
+    size_t index = 0;
+    for (int i = 0; i < WARMUP_FRAMES; i++) {
+        k->run(ctx, &s_signal[index * FRAME_SAMPLES], index);
+        index = (index + 1) % SIGNAL_FRAMES;
+    }
+
+    double per_run[MAX_RUNS];
+    host_shim_counters_t before, after;
+    host_shim_get_counters(&before);
+    for (int r = 0; r < runs; r++) {
+        int64_t start = now_ns();
+        for (int i = 0; i < frames; i++) {
+            k->run(ctx, &s_signal[index * FRAME_SAMPLES], index);
+            index = (index + 1) % SIGNAL_FRAMES;
+        }
+        per_run[r] = (double)(now_ns() - start) / frames;
+    }
+    host_shim_get_counters(&after);
+    k->teardown(ctx);
+
+    qsort(per_run, runs, sizeof(double), compare_double);
+    double total = (double)runs * frames;
+    out->name = k->name;
+    out->ns_median = per_run[runs / 2];
+    out->ns_min = per_run[0];
+    out->allocs_per_frame = (double)(after.allocs - before.allocs) / total;
+    out->copied_per_frame = (double)(after.copied_bytes - before.copied_bytes) / total;
+    return true;
+}
+
+// ---- Results files ----
+
+static bool write_json(const char *path, const bench_result_t *results, size_t count, int runs, int frames)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    fprintf(f, "{\n  \"frame_samples\": %d,\n  \"runs\": %d,\n  \"frames\": %d,\n"
+               "  \"counts_copies\": %s,\n  \"kernels\": [\n",
+            FRAME_SAMPLES, runs, frames, host_shim_counts_copies() ? "true" : "false");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(f, "    {\"name\": \"%s\", \"ns_per_frame\": %.1f, \"ns_min\": %.1f, "
+                   "\"allocs_per_frame\": %.3f, \"bytes_copied_per_frame\": %.1f}%s\n",
+                results[i].name, results[i].ns_median, results[i].ns_min,
+                results[i].allocs_per_frame, results[i].copied_per_frame,
+                i + 1 < count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+// Only reads what write_json() produces: one kernel object per line
+static bool baseline_lookup(const char *json, const char *name, double *ns)
+{
+    char key[64];
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    const char *p = strstr(json, key);
+    if (!p) {
+        return false;
+    }
+    const char *eol = strchr(p, '\n');
+    const char *v = strstr(p, "\"ns_per_frame\":");
+    if (!v || (eol && v > eol)) {
+        return false;
+    }
+    *ns = strtod(v + strlen("\"ns_per_frame\":"), NULL);
+    return *ns > 0.0;
+}
+
+static char *read_file(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = malloc((size_t)len + 1);
+    if (buf && fread(buf, 1, (size_t)len, f) == (size_t)len) {
+        buf[len] = '\0';
+    } else {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    return buf;
+}
+
+// ---- Main ----
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options] [kernel...]\n"
+            "  --runs N              timed runs per kernel (default 7)\n"
+            "  --frames N            frames per run (default 2000)\n"
+            "  --json FILE           write results as JSON\n"
+            "  --baseline FILE       compare with an earlier --json file\n"
+            "  --max-regression PCT  fail if a kernel is more than PCT%% slower (default 10)\n"
+            "  --list                list kernels and exit\n",
+            argv0);
+}
+
+static bool selected(const char *name, char **filters, int filter_count)
+{
+    if (filter_count == 0) {
+        return true;
+    }
+    for (int i = 0; i < filter_count; i++) {
+        if (strcmp(filters[i], name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    int runs = 7;
+    int frames = 2000;
+    double max_regression = 10.0;
+    const char *json_path = NULL;
+    const char *baseline_path = NULL;
+    char *filters[MAX_KERNELS];
+    int filter_count = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "--runs") == 0 && has_value) {
+            runs = atoi(argv[++i]);
+        } else if (strcmp(arg, "--frames") == 0 && has_value) {
+            frames = atoi(argv[++i]);
+        } else if (strcmp(arg, "--json") == 0 && has_value) {
+            json_path = argv[++i];
+        } else if (strcmp(arg, "--baseline") == 0 && has_value) {
+            baseline_path = argv[++i];
+        } else if (strcmp(arg, "--max-regression") == 0 && has_value) {
+            max_regression = atof(argv[++i]);
+        } else if (strcmp(arg, "--list") == 0) {
+            for (size_t k = 0; k < KERNEL_COUNT; k++) {
+                printf("%-14s %s\n", s_kernels[k].name, s_kernels[k].what);
+            }
+            return 0;
+        } else if (arg[0] != '-' && filter_count < MAX_KERNELS) {
+            filters[filter_count++] = argv[i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (runs < 1 || runs > MAX_RUNS || frames < 1) {
+        fprintf(stderr, "--runs must be 1..%d and --frames positive\n", MAX_RUNS);
+        return 2;
+    }
+
+    char *baseline = NULL;
+    if (baseline_path && !(baseline = read_file(baseline_path))) {
+        return 2;
+    }
+
+    generate_signal();
+    precompute_vad_track();
+
+    bench_result_t results[KERNEL_COUNT];
+    size_t count = 0;
+    int regressions = 0;
+    bool copies = host_shim_counts_copies();
+
+    printf("%-14s %12s %12s %13s %13s", "kernel", "ns/frame", "min", "allocs/frame", "copied/frame");
+    if (baseline) {
+        printf(" %10s %8s", "baseline", "delta");
+    }
+    printf("\n");
+
+    for (size_t k = 0; k < KERNEL_COUNT; k++) {
+        if (!selected(s_kernels[k].name, filters, filter_count)) {
+            continue;
+        }
+        bench_result_t *r = &results[count];
+        if (!run_kernel(&s_kernels[k], runs, frames, r)) {
+            regressions++;
+            continue;
+        }
+        count++;
+
+        printf("%-14s %12.1f %12.1f %13.3f ", r->name, r->ns_median, r->ns_min, r->allocs_per_frame);
+        if (copies) {
+            printf("%13.1f", r->copied_per_frame);
+        } else {
+            printf("%13s", "n/a");
+        }
+        double base_ns;
+        if (baseline && baseline_lookup(baseline, r->name, &base_ns)) {
+            double delta = (r->ns_median - base_ns) * 100.0 / base_ns;
+            bool regressed = delta > max_regression;
+            printf(" %10.1f %+7.1f%%%s", base_ns, delta, regressed ? "  REGRESSION" : "");
+            regressions += regressed;
+        } else if (baseline) {
+            printf(" %10s %8s", "-", "new");
+        }
+        printf("\n");
+    }
+
+    if (json_path && !write_json(json_path, results, count, runs, frames)) {
+        regressions++;
+    }
+    free(baseline);
+
+    if (regressions) {
+        fflush(stdout);
+        fprintf(stderr, "%d kernel(s) failed or regressed by more than %.1f%%\n",
+                regressions, max_regression);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,891 @@
+/*
+ * Scores the enhanced VAD and wake word detector against a labelled WAV
+ * corpus, running the device code frame by frame exactly as the analysis
+ * stage does (20 ms frames, VAD result passed to the wake word detector).
+ *
+ * Corpus layout: any directory tree of 16 kHz 16-bit WAV files. The name of
+ * a file's parent directory is its category (speech, noise, tts_echo,
+ * far_field, ...). Labels sit next to the WAV as <name>.txt in Audacity
+ * label-track format, one "start<TAB>end<TAB>label" line per segment, in
+ * seconds:
+ *   speech   user speech the VAD should detect
+ *   wake     a wake phrase (also counts as speech)
+ *   tts      TTS playing through the speaker; the detectors get the same
+ *            TTS level and conversation context calls as on the device
+ * A WAV with no label file contains no speech.
+ *
+ * Reported per file, per category and overall:
+ *   VAD       frame precision/recall/F1, false-positive rate, onset and
+ *             release latency (ms) per labelled segment
+ *   wake      false reject rate, false accepts per hour, detection latency
+ *   cpu       us per frame for each detector on this host
+ *
+ * --min-wake and --max-frr turn a run into a gate: it fails when the corpus
+ * has fewer labelled wake phrases than asked for, or misses too many.
+ */
+#include "enhanced_vad.h"
+#include "esp32_p4_wake_word.h"
+#include "howdy_voice_tuning.h"
+#include "host_shim.h"
+#include "wav_reader.h"
+#include <dirent.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define SAMPLE_RATE             16000
+#define FRAME_SAMPLES           320
+#define FRAME_US                20000
+#define FILE_GAP_US             10000000        // virtual time between files
+#define TTS_LEVEL               0.8f            // what the TTS start handler reports
+#define WAKE_GRACE_MS           1000            // beyond the silence timeout
+#define MAX_CATEGORIES          32
+#define MAX_SEGMENTS            4096
+#define CATEGORY_LEN            64
+
+typedef enum {
+    SEG_SPEECH,
+    SEG_WAKE,
+    SEG_TTS,
+} seg_kind_t;
+
+typedef struct {
+    double start_s;
+    double end_s;
+    seg_kind_t kind;
+} segment_t;
+
+typedef struct {
+    double *v;
+    size_t n;
+    size_t cap;
+} series_t;
+
+typedef struct {
+    double duration_s;
+    uint64_t frames;
+    uint64_t tp, fp, fn, tn;
+    uint32_t speech_segments;
+    uint32_t onset_missed;
+    uint32_t release_merged;            // next segment started before the VAD let go
+    series_t onset_ms;
+    series_t release_ms;
+    uint32_t wake_segments;
+    uint32_t wake_detected;
+    uint32_t wake_false_accepts;
+    series_t wake_latency_ms;
+    series_t vad_us;
+    series_t wake_us;
+} metrics_t;
+
+typedef struct {
+    char name[CATEGORY_LEN];
+    uint32_t files;
+    metrics_t m;
+} category_t;
+
+typedef struct {
+    const char *name;
+    size_t offset;
+    char type;                          // B bool, b u8, h u16, u u32, f float
+} param_t;
+
+#define VAD_PARAM(field, t)  { #field, offsetof(enhanced_vad_config_t, field), t }
+#define WAKE_PARAM(field, t) { #field, offsetof(esp32_p4_wake_word_config_t, field), t }
+
+static const param_t VAD_PARAMS[] = {
+    VAD_PARAM(amplitude_threshold, 'h'),
+    VAD_PARAM(silence_threshold_ms, 'h'),
+    VAD_PARAM(min_voice_duration_ms, 'h'),
+    VAD_PARAM(noise_floor_alpha, 'f'),
+    VAD_PARAM(snr_threshold_db, 'f'),
+    VAD_PARAM(adaptation_window_ms, 'h'),
+    VAD_PARAM(zcr_threshold_min, 'h'),
+    VAD_PARAM(zcr_threshold_max, 'h'),
+    VAD_PARAM(low_freq_ratio_threshold, 'f'),
+    VAD_PARAM(spectral_rolloff_threshold, 'f'),
+    VAD_PARAM(consistency_frames, 'b'),
+    VAD_PARAM(confidence_threshold, 'f'),
+    VAD_PARAM(feature_flags, 'u'),
+    VAD_PARAM(processing_mode, 'b'),
+};
+
+static const param_t WAKE_PARAMS[] = {
+    WAKE_PARAM(energy_threshold, 'h'),
+    WAKE_PARAM(confidence_threshold, 'f'),
+    WAKE_PARAM(silence_timeout_ms, 'h'),
+    WAKE_PARAM(pattern_frames, 'b'),
+    WAKE_PARAM(consistency_frames, 'b'),
+    WAKE_PARAM(enable_adaptation, 'B'),
+    WAKE_PARAM(adaptation_rate, 'f'),
+    WAKE_PARAM(max_detections_per_min, 'b'),
+};
+
+#define PARAM_COUNT(t) (sizeof(t) / sizeof((t)[0]))
+
+static enhanced_vad_config_t s_vad_config;
+static esp32_p4_wake_word_config_t s_wake_config;
+static const char *s_preset = "device";
+static category_t s_categories[MAX_CATEGORIES];
+static size_t s_category_count;
+static metrics_t s_total;
+static int64_t s_clock_us = FILE_GAP_US;
+
+// ---- Small helpers ----
+
+static void series_push(series_t *s, double v)
+{
+    if (s->n == s->cap) {
+        s->cap = s->cap ? s->cap * 2 : 256;
+        s->v = realloc(s->v, s->cap * sizeof(double));
+        if (!s->v) {
+            fprintf(stderr, "out of memory\n");
+            exit(2);
+        }
+    }
+    s->v[s->n++] = v;
+}
+
+static void series_append(series_t *dst, const series_t *src)
+{
+    for (size_t i = 0; i < src->n; i++) {
+        series_push(dst, src->v[i]);
+    }
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+typedef struct {
+    size_t count;
+    double mean, p50, p95, p99, max;
+} summary_t;
+
+static summary_t summarize(series_t *s)
+{
+    summary_t r = { .count = s->n };
+    if (!s->n) {
+        return r;
+    }
+    qsort(s->v, s->n, sizeof(double), compare_double);
+    double sum = 0;
+    for (size_t i = 0; i < s->n; i++) {
+        sum += s->v[i];
+    }
+    r.mean = sum / s->n;
+    r.p50 = s->v[(s->n - 1) * 50 / 100];
+    r.p95 = s->v[(s->n - 1) * 95 / 100];
+    r.p99 = s->v[(s->n - 1) * 99 / 100];
+    r.max = s->v[s->n - 1];
+    return r;
+}
+
+static void metrics_merge(metrics_t *dst, const metrics_t *src)
+{
+    dst->duration_s += src->duration_s;
+    dst->frames += src->frames;
+    dst->tp += src->tp;
+    dst->fp += src->fp;
+    dst->fn += src->fn;
+    dst->tn += src->tn;
+    dst->speech_segments += src->speech_segments;
+    dst->onset_missed += src->onset_missed;
+    dst->release_merged += src->release_merged;
+    series_append(&dst->onset_ms, &src->onset_ms);
+    series_append(&dst->release_ms, &src->release_ms);
+    dst->wake_segments += src->wake_segments;
+    dst->wake_detected += src->wake_detected;
+    dst->wake_false_accepts += src->wake_false_accepts;
+    series_append(&dst->wake_latency_ms, &src->wake_latency_ms);
+    series_append(&dst->vad_us, &src->vad_us);
+    series_append(&dst->wake_us, &src->wake_us);
+}
+
+static void metrics_free(metrics_t *m)
+{
+    free(m->onset_ms.v);
+    free(m->release_ms.v);
+    free(m->wake_latency_ms.v);
+    free(m->vad_us.v);
+    free(m->wake_us.v);
+    memset(m, 0, sizeof(*m));
+}
+
+static double ratio(double num, double den)
+{
+    return den > 0 ? num / den : 0.0;
+}
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// ---- Parameters ----
+
+static bool set_param(const param_t *table, size_t count, void *config, const char *assignment)
+{
+    const char *eq = strchr(assignment, '=');
+    if (!eq) {
+        return false;
+    }
+    size_t name_len = (size_t)(eq - assignment);
+    for (size_t i = 0; i < count; i++) {
+        if (strlen(table[i].name) != name_len || strncmp(table[i].name, assignment, name_len) != 0) {
+            continue;
+        }
+        void *field = (uint8_t *)config + table[i].offset;
+        double v = strtod(eq + 1, NULL);
+        switch (table[i].type) {
+        case 'B': *(bool *)field = v != 0; break;
+        case 'b': *(uint8_t *)field = (uint8_t)v; break;
+        case 'h': *(uint16_t *)field = (uint16_t)v; break;
+        case 'u': *(uint32_t *)field = (uint32_t)strtoul(eq + 1, NULL, 0); break;
+        case 'f': *(float *)field = (float)v; break;
+        }
+        return true;
+    }
+    return false;
+}
+
+static double get_param(const param_t *p, const void *config)
+{
+    const void *field = (const uint8_t *)config + p->offset;
+    switch (p->type) {
+    case 'B': return *(const bool *)field;
+    case 'b': return *(const uint8_t *)field;
+    case 'h': return *(const uint16_t *)field;
+    case 'u': return *(const uint32_t *)field;
+    default:  return *(const float *)field;
+    }
+}
+
+// ---- Labels ----
+
+static size_t load_labels(const char *wav_path, segment_t *segs, size_t max)
+{
+    char path[4096];
+    snprintf(path, sizeof(path), "%s", wav_path);
+    char *dot = strrchr(path, '.');
+    if (!dot) {
+        return 0;
+    }
+    strcpy(dot, ".txt");
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return 0;
+    }
+
+    size_t n = 0;
+    char line[256];
+    unsigned line_no = 0;
+    while (fgets(line, sizeof(line), f)) {
+        line_no++;
+        double start, end;
+        char label[64];
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\\') {
+            continue;   // comments, blanks, Audacity spectral-selection lines
+        }
+        if (sscanf(line, "%lf %lf %63s", &start, &end, label) != 3 || end <= start) {
+            fprintf(stderr, "%s:%u: ignoring malformed label\n", path, line_no);
+            continue;
+        }
+        seg_kind_t kind;
+        if (strcmp(label, "speech") == 0) {
+            kind = SEG_SPEECH;
+        } else if (strcmp(label, "wake") == 0) {
+            kind = SEG_WAKE;
+        } else if (strcmp(label, "tts") == 0) {
+            kind = SEG_TTS;
+        } else {
+            fprintf(stderr, "%s:%u: unknown label '%s'\n", path, line_no, label);
+            continue;
+        }
+        if (n < max) {
+            segs[n++] = (segment_t){ start, end, kind };
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+static bool in_kind(const segment_t *segs, size_t n, double t, bool speech)
+{
+    for (size_t i = 0; i < n; i++) {
+        bool match = speech ? segs[i].kind != SEG_TTS : segs[i].kind == SEG_TTS;
+        if (match && t >= segs[i].start_s && t < segs[i].end_s) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---- Running one file ----
+
+static double frame_end_s(size_t i)
+{
+    return (double)(i + 1) * FRAME_SAMPLES / SAMPLE_RATE;
+}
+
+static double frame_mid_s(size_t i)
+{
+    return ((double)i + 0.5) * FRAME_SAMPLES / SAMPLE_RATE;
+}
+
+static void score_segments(const segment_t *segs, size_t nseg, const uint8_t *voice, size_t frames,
+                           const series_t *wake_times, metrics_t *m)
+{
+    double frame_s = (double)FRAME_SAMPLES / SAMPLE_RATE;
+
+    for (size_t s = 0; s < nseg; s++) {
+        if (segs[s].kind == SEG_TTS) {
+            continue;
+        }
+        m->speech_segments++;
+
+        // Onset: first "voice" frame centred inside the segment
+        size_t first = (size_t)ceil(segs[s].start_s / frame_s - 0.5);
+        bool found = false;
+        for (size_t i = first; i < frames && frame_mid_s(i) < segs[s].end_s; i++) {
+            if (voice[i]) {
+                series_push(&m->onset_ms, (frame_end_s(i) - segs[s].start_s) * 1000.0);
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            m->onset_missed++;
+            continue;
+        }
+
+        // Release: first silent frame after the segment, unless speech resumes first
+        double next_start = INFINITY;
+        for (size_t o = 0; o < nseg; o++) {
+            if (segs[o].kind != SEG_TTS && segs[o].start_s >= segs[s].end_s && segs[o].start_s < next_start) {
+                next_start = segs[o].start_s;
+            }
+        }
+        for (size_t i = (size_t)ceil(segs[s].end_s / frame_s - 0.5); i < frames; i++) {
+            if (frame_mid_s(i) >= next_start) {
+                m->release_merged++;
+                break;
+            }
+            if (!voice[i]) {
+                series_push(&m->release_ms, (frame_end_s(i) - segs[s].end_s) * 1000.0);
+                break;
+            }
+        }
+    }
+
+    // Wake: each labelled phrase may claim one detection inside its window
+    double window_s = (s_wake_config.silence_timeout_ms + WAKE_GRACE_MS) / 1000.0;
+    uint8_t *claimed = calloc(wake_times->n ? wake_times->n : 1, 1);
+    for (size_t s = 0; s < nseg; s++) {
+        if (segs[s].kind != SEG_WAKE) {
+            continue;
+        }
+        m->wake_segments++;
+        for (size_t d = 0; d < wake_times->n; d++) {
+            double t = wake_times->v[d];
+            if (!claimed[d] && t >= segs[s].start_s && t <= segs[s].end_s + window_s) {
+                claimed[d] = 1;
+                m->wake_detected++;
+                series_push(&m->wake_latency_ms, (t - segs[s].end_s) * 1000.0);
+                break;
+            }
+        }
+    }
+    for (size_t d = 0; d < wake_times->n; d++) {
+        m->wake_false_accepts += !claimed[d];
+    }
+    free(claimed);
+}
+
+static bool run_file(const char *path, metrics_t *m)
+{
+    char err[128];
+    wav_reader_t wav;
+    if (!wav_open(&wav, path, err, sizeof(err))) {
+        fprintf(stderr, "%s: %s, skipped\n", path, err);
+        return false;
+    }
+    if (wav.sample_rate != SAMPLE_RATE) {
+        fprintf(stderr, "%s: %u Hz, expected %d, skipped\n", path, wav.sample_rate, SAMPLE_RATE);
+        wav_close(&wav);
+        return false;
+    }
+
+    static segment_t segs[MAX_SEGMENTS];
+    size_t nseg = load_labels(path, segs, MAX_SEGMENTS);
+    size_t frames_max = wav.frames_total / FRAME_SAMPLES;
+    uint8_t *voice = calloc(frames_max ? frames_max : 1, 1);
+
+    host_shim_set_time_us(s_clock_us);
+    enhanced_vad_handle_t vad = enhanced_vad_init(&s_vad_config);
+    esp32_p4_wake_word_handle_t wake = esp32_p4_wake_word_init(&s_wake_config);
+    if (!vad || !wake || !voice) {
+        fprintf(stderr, "%s: detector init failed\n", path);
+        if (vad) enhanced_vad_deinit(vad);
+        if (wake) esp32_p4_wake_word_deinit(wake);
+        free(voice);
+        wav_close(&wav);
+        return false;
+    }
+
+    series_t wake_times = {0};
+    bool tts_active = false;
+    int16_t frame[FRAME_SAMPLES];
+    size_t i = 0;
+    uint32_t detections = 0;
+
+    while (i < frames_max && wav_read(&wav, frame, FRAME_SAMPLES) == FRAME_SAMPLES) {
+        s_clock_us += FRAME_US;
+        host_shim_set_time_us(s_clock_us);
+
+        // Same notifications the TTS start/finish handlers send
+        bool tts_now = in_kind(segs, nseg, frame_mid_s(i), false);
+        if (tts_now != tts_active) {
+            enhanced_vad_set_tts_audio_level(vad, tts_now ? TTS_LEVEL : 0.0f, NULL);
+            esp32_p4_wake_word_set_tts_level(wake, tts_now ? TTS_LEVEL : 0.0f);
+            if (!tts_now) {
+                enhanced_vad_set_conversation_context(vad, VAD_CONVERSATION_LISTENING);
+                esp32_p4_wake_word_set_conversation_context(wake, VAD_CONVERSATION_LISTENING);
+            }
+            tts_active = tts_now;
+        }
+
+        enhanced_vad_result_t vad_result;
+        esp32_p4_wake_word_result_t wake_result;
+        int64_t t0 = now_ns();
+        enhanced_vad_process_audio(vad, frame, FRAME_SAMPLES, &vad_result);
+        int64_t t1 = now_ns();
+        esp32_p4_wake_word_process(wake, frame, FRAME_SAMPLES, &vad_result, &wake_result);
+        int64_t t2 = now_ns();
+        series_push(&m->vad_us, (t1 - t0) / 1000.0);
+        series_push(&m->wake_us, (t2 - t1) / 1000.0);
+
+        voice[i] = vad_result.voice_detected;
+        bool truth = in_kind(segs, nseg, frame_mid_s(i), true);
+        m->tp += truth && voice[i];
+        m->fp += !truth && voice[i];
+        m->fn += truth && !voice[i];
+        m->tn += !truth && !voice[i];
+
+        esp32_p4_wake_word_stats_t stats;
+        esp32_p4_wake_word_get_stats(wake, &stats);
+        if (stats.total_detections != detections) {
+            detections = stats.total_detections;
+            series_push(&wake_times, frame_end_s(i));
+        }
+        i++;
+    }
+
+    m->frames = i;
+    m->duration_s = (double)i * FRAME_SAMPLES / SAMPLE_RATE;
+    score_segments(segs, nseg, voice, i, &wake_times, m);
+
+    s_clock_us += FILE_GAP_US;
+    free(wake_times.v);
+    free(voice);
+    esp32_p4_wake_word_deinit(wake);
+    enhanced_vad_deinit(vad);
+    wav_close(&wav);
+    return true;
+}
+
+// ---- Corpus walk ----
+
+typedef struct {
+    char **paths;
+    size_t n;
+    size_t cap;
+} path_list_t;
+
+static bool has_wav_suffix(const char *name)
+{
+    size_t len = strlen(name);
+    return len > 4 && (strcmp(name + len - 4, ".wav") == 0 || strcmp(name + len - 4, ".WAV") == 0);
+}
+
+static void collect(const char *path, path_list_t *list)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        fprintf(stderr, "%s: not found\n", path);
+        return;
+    }
+    if (S_ISREG(st.st_mode)) {
+        if (list->n == list->cap) {
+            list->cap = list->cap ? list->cap * 2 : 64;
+            list->paths = realloc(list->paths, list->cap * sizeof(char *));
+        }
+        list->paths[list->n++] = strdup(path);
+        return;
+    }
+    if (!S_ISDIR(st.st_mode)) {
+        return;
+    }
+    DIR *dir = opendir(path);
+    if (!dir) {
+        return;
+    }
+    struct dirent *e;
+    while ((e = readdir(dir)) != NULL) {
+        if (e->d_name[0] == '.') {
+            continue;
+        }
+        char child[4096];
+        snprintf(child, sizeof(child), "%s/%s", path, e->d_name);
+        struct stat cst;
+        if (stat(child, &cst) != 0) {
+            continue;
+        }
+        if (S_ISDIR(cst.st_mode) || has_wav_suffix(e->d_name)) {
+            collect(child, list);
+        }
+    }
+    closedir(dir);
+}
+
+static int compare_path(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static category_t *category_for(const char *path)
+{
+    char name[CATEGORY_LEN] = "uncategorized";
+    const char *slash = strrchr(path, '/');
+    if (slash && slash > path) {
+        const char *start = slash - 1;
+        while (start > path && start[-1] != '/') {
+            start--;
+        }
+        size_t len = (size_t)(slash - start);
+        if (len > 0 && len < CATEGORY_LEN && !(len == 1 && start[0] == '.')) {
+            memcpy(name, start, len);
+            name[len] = '\0';
+        }
+    }
+    for (size_t i = 0; i < s_category_count; i++) {
+        if (strcmp(s_categories[i].name, name) == 0) {
+            return &s_categories[i];
+        }
+    }
+    if (s_category_count == MAX_CATEGORIES) {
+        return &s_categories[MAX_CATEGORIES - 1];
+    }
+    category_t *c = &s_categories[s_category_count++];
+    snprintf(c->name, sizeof(c->name), "%s", name);
+    return c;
+}
+
+// ---- Output ----
+
+static void print_ratio(double num, double den, int width)
+{
+    if (den > 0) {
+        printf(" %*.3f", width, num / den);
+    } else {
+        printf(" %*s", width, "-");
+    }
+}
+
+static void print_ms(const summary_t *s)
+{
+    if (s->count) {
+        printf(" %8.0f", s->p50);
+    } else {
+        printf(" %8s", "-");
+    }
+}
+
+// Ratios with no denominator (e.g. recall on a noise-only category) print "-"
+static void print_row(const char *name, metrics_t *m)
+{
+    summary_t onset = summarize(&m->onset_ms);
+    summary_t release = summarize(&m->release_ms);
+    summary_t vad_us = summarize(&m->vad_us);
+    summary_t wake_us = summarize(&m->wake_us);
+    double hours = m->duration_s / 3600.0;
+
+    printf("%-16s %7.2f", name, hours);
+    print_ratio(m->tp, m->tp + m->fp, 6);
+    print_ratio(m->tp, m->tp + m->fn, 6);
+    print_ratio(m->fp, m->fp + m->tn, 6);
+    print_ms(&onset);
+    print_ms(&release);
+    print_ratio(m->wake_segments - m->wake_detected, m->wake_segments, 6);
+    printf(" %7.2f %7.1f %7.1f\n", ratio(m->wake_false_accepts, hours), vad_us.mean, wake_us.mean);
+}
+
+static void json_summary(FILE *f, const char *key, series_t *s, int decimals)
+{
+    summary_t r = summarize(s);
+    fprintf(f, "\"%s\": {\"count\": %zu, \"mean\": %.*f, \"p50\": %.*f, \"p95\": %.*f, "
+               "\"p99\": %.*f, \"max\": %.*f}",
+            key, r.count, decimals, r.mean, decimals, r.p50, decimals, r.p95,
+            decimals, r.p99, decimals, r.max);
+}
+
+static void json_metrics(FILE *f, metrics_t *m)
+{
+    double hours = m->duration_s / 3600.0;
+    fprintf(f, "\"duration_s\": %.2f, \"frames\": %llu, ", m->duration_s, (unsigned long long)m->frames);
+    fprintf(f, "\"vad\": {\"tp\": %llu, \"fp\": %llu, \"fn\": %llu, \"tn\": %llu, "
+               "\"precision\": %.4f, \"recall\": %.4f, \"f1\": %.4f, \"false_positive_rate\": %.4f, "
+               "\"segments\": %u, \"onset_missed\": %u, \"release_merged\": %u, ",
+            (unsigned long long)m->tp, (unsigned long long)m->fp,
+            (unsigned long long)m->fn, (unsigned long long)m->tn,
+            ratio(m->tp, m->tp + m->fp), ratio(m->tp, m->tp + m->fn),
+            ratio(2.0 * m->tp, 2.0 * m->tp + m->fp + m->fn), ratio(m->fp, m->fp + m->tn),
+            m->speech_segments, m->onset_missed, m->release_merged);
+    json_summary(f, "onset_ms", &m->onset_ms, 1);
+    fprintf(f, ", ");
+    json_summary(f, "release_ms", &m->release_ms, 1);
+    fprintf(f, "}, \"wake\": {\"utterances\": %u, \"detected\": %u, \"false_accepts\": %u, "
+               "\"frr\": %.4f, \"far_per_hour\": %.3f, ",
+            m->wake_segments, m->wake_detected, m->wake_false_accepts,
+            ratio(m->wake_segments - m->wake_detected, m->wake_segments),
+            ratio(m->wake_false_accepts, hours));
+    json_summary(f, "latency_ms", &m->wake_latency_ms, 1);
+    fprintf(f, "}, \"cpu_us\": {");
+    json_summary(f, "vad", &m->vad_us, 2);
+    fprintf(f, ", ");
+    json_summary(f, "wake", &m->wake_us, 2);
+    fprintf(f, "}");
+}
+
+static void json_config(FILE *f, const char *key, const param_t *table, size_t count, const void *config)
+{
+    fprintf(f, "  \"%s\": {", key);
+    for (size_t i = 0; i < count; i++) {
+        fprintf(f, "%s\"%s\": %g", i ? ", " : "", table[i].name, get_param(&table[i], config));
+    }
+    fprintf(f, "},\n");
+}
+
+static void json_string(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+        }
+        fputc(*s, f);
+    }
+    fputc('"', f);
+}
+
+// ---- Main ----
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [options] <corpus dir or wav>...\n"
+            "  --preset device|default|conversation\n"
+            "                      starting configuration (default: device, as shipped)\n"
+            "  --vad name=value    override a VAD parameter (repeatable)\n"
+            "  --wake name=value   override a wake word parameter (repeatable)\n"
+            "  --json FILE         write per-file, per-category and total results\n"
+            "  --min-wake N        fail unless at least N wake phrases were scored\n"
+            "  --max-frr R         fail if the wake false reject rate is above R\n"
+            "  --params            list tunable parameters with their values and exit\n",
+            argv0);
+}
+
+static bool load_preset(const char *preset)
+{
+    if (strcmp(preset, "device") == 0) {
+        howdy_voice_tuning_vad_config(SAMPLE_RATE, &s_vad_config);
+        howdy_voice_tuning_wake_word_config(&s_wake_config);
+    } else if (strcmp(preset, "default") == 0) {
+        enhanced_vad_get_default_config(SAMPLE_RATE, &s_vad_config);
+        esp32_p4_wake_word_get_default_config(&s_wake_config);
+    } else if (strcmp(preset, "conversation") == 0) {
+        enhanced_vad_get_conversation_config(SAMPLE_RATE, &s_vad_config);
+        esp32_p4_wake_word_get_conversation_config(&s_wake_config);
+    } else {
+        return false;
+    }
+    s_preset = preset;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *json_path = NULL;
+    const char *inputs[256];
+    const char *overrides[64];
+    bool override_is_vad[64];
+    size_t input_count = 0;
+    size_t override_count = 0;
+    bool list_params = false;
+    unsigned min_wake = 0;
+    double max_frr = -1.0;
+
+    load_preset("device");
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (strcmp(arg, "--preset") == 0 && has_value) {
+            if (!load_preset(argv[++i])) {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if ((strcmp(arg, "--vad") == 0 || strcmp(arg, "--wake") == 0) && has_value &&
+                   override_count < 64) {
+            override_is_vad[override_count] = arg[2] == 'v';
+            overrides[override_count++] = argv[++i];
+        } else if (strcmp(arg, "--json") == 0 && has_value) {
+            json_path = argv[++i];
+        } else if (strcmp(arg, "--min-wake") == 0 && has_value) {
+            min_wake = (unsigned)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(arg, "--max-frr") == 0 && has_value) {
+            max_frr = strtod(argv[++i], NULL);
+        } else if (strcmp(arg, "--params") == 0) {
+            list_params = true;
+        } else if (arg[0] != '-' && input_count < 256) {
+            inputs[input_count++] = arg;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    // Overrides apply on top of whichever preset was chosen
+    for (size_t i = 0; i < override_count; i++) {
+        bool ok = override_is_vad[i]
+            ? set_param(VAD_PARAMS, PARAM_COUNT(VAD_PARAMS), &s_vad_config, overrides[i])
+            : set_param(WAKE_PARAMS, PARAM_COUNT(WAKE_PARAMS), &s_wake_config, overrides[i]);
+        if (!ok) {
+            fprintf(stderr, "unknown %s parameter: %s (see --params)\n",
+                    override_is_vad[i] ? "VAD" : "wake", overrides[i]);
+            return 2;
+        }
+    }
+
+    if (list_params) {
+        printf("preset: %s\n", s_preset);
+        for (size_t i = 0; i < PARAM_COUNT(VAD_PARAMS); i++) {
+            printf("  --vad  %-28s %g\n", VAD_PARAMS[i].name, get_param(&VAD_PARAMS[i], &s_vad_config));
+        }
+        for (size_t i = 0; i < PARAM_COUNT(WAKE_PARAMS); i++) {
+            printf("  --wake %-28s %g\n", WAKE_PARAMS[i].name, get_param(&WAKE_PARAMS[i], &s_wake_config));
+        }
+        return 0;
+    }
+    if (input_count == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    path_list_t list = {0};
+    for (size_t i = 0; i < input_count; i++) {
+        collect(inputs[i], &list);
+    }
+    if (list.n == 0) {
+        fprintf(stderr, "no WAV files found\n");
+        return 2;
+    }
+    qsort(list.paths, list.n, sizeof(char *), compare_path);
+
+    FILE *json = NULL;
+    if (json_path) {
+        json = fopen(json_path, "w");
+        if (!json) {
+            perror(json_path);
+            return 2;
+        }
+        fprintf(json, "{\n  \"preset\": \"%s\",\n", s_preset);
+        json_config(json, "vad_config", VAD_PARAMS, PARAM_COUNT(VAD_PARAMS), &s_vad_config);
+        json_config(json, "wake_config", WAKE_PARAMS, PARAM_COUNT(WAKE_PARAMS), &s_wake_config);
+        fprintf(json, "  \"files\": [\n");
+    }
+
+    size_t scored = 0;
+    for (size_t i = 0; i < list.n; i++) {
+        metrics_t m = {0};
+        category_t *cat = category_for(list.paths[i]);
+        if (run_file(list.paths[i], &m)) {
+            if (json) {
+                fprintf(json, "%s    {\"path\": ", scored ? ",\n" : "");
+                json_string(json, list.paths[i]);
+                fprintf(json, ", \"category\": ");
+                json_string(json, cat->name);
+                fprintf(json, ", ");
+                json_metrics(json, &m);
+                fprintf(json, "}");
+            }
+            cat->files++;
+            metrics_merge(&cat->m, &m);
+            metrics_merge(&s_total, &m);
+            scored++;
+        }
+        metrics_free(&m);
+        free(list.paths[i]);
+    }
+    free(list.paths);
+
+    printf("%-16s %7s %6s %6s %6s %8s %8s %6s %7s %7s %7s\n",
+           "category", "hours", "vad_P", "vad_R", "vadFPR", "onset50", "relse50",
+           "FRR", "FA/h", "vad_us", "wake_us");
+    for (size_t c = 0; c < s_category_count; c++) {
+        if (s_categories[c].files) {
+            print_row(s_categories[c].name, &s_categories[c].m);
+        }
+    }
+    print_row("TOTAL", &s_total);
+    printf("%zu of %zu files scored; onset/release in ms (p50), cpu in us/frame (mean)\n",
+           scored, list.n);
+
+    if (json) {
+        fprintf(json, "\n  ],\n  \"categories\": [\n");
+        bool first = true;
+        for (size_t c = 0; c < s_category_count; c++) {
+            if (!s_categories[c].files) {
+                continue;
+            }
+            fprintf(json, "%s    {\"name\": ", first ? "" : ",\n");
+            json_string(json, s_categories[c].name);
+            fprintf(json, ", \"files\": %u, ", s_categories[c].files);
+            json_metrics(json, &s_categories[c].m);
+            fprintf(json, "}");
+            first = false;
+        }
+        fprintf(json, "\n  ],\n  \"total\": {\"files\": %zu, ", scored);
+        json_metrics(json, &s_total);
+        fprintf(json, "}\n}\n");
+        fclose(json);
+    }
+
+    // Gates; FRR over no wake phrases would pass vacuously, so --max-frr also needs one
+    int status = scored ? 0 : 1;
+    uint32_t wake_min = max_frr >= 0.0 && min_wake == 0 ? 1 : min_wake;
+    double frr = ratio(s_total.wake_segments - s_total.wake_detected, s_total.wake_segments);
+    if (s_total.wake_segments < wake_min) {
+        fprintf(stderr, "FAIL: %u wake phrases scored, need at least %u\n", s_total.wake_segments, wake_min);
+        status = 1;
+    }
+    if (max_frr >= 0.0 && s_total.wake_segments && frr > max_frr) {
+        fprintf(stderr, "FAIL: wake FRR %.3f above %.3f (%u of %u missed)\n", frr, max_frr,
+                s_total.wake_segments - s_total.wake_detected, s_total.wake_segments);
+        status = 1;
+    }
+
+    for (size_t c = 0; c < s_category_count; c++) {
+        metrics_free(&s_categories[c].m);
+    }
+    metrics_free(&s_total);
+    return status;
+}
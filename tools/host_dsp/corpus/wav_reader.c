@@ -0,0 +1,122 @@
+#include "wav_reader.h"
+#include <string.h>
+
+#define WAV_FORMAT_PCM          0x0001
+#define WAV_FORMAT_EXTENSIBLE   0xFFFE
+#define WAV_MAX_CHANNELS        8
+
+static uint32_t le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static bool fail(wav_reader_t *wav, char *err, size_t err_len, const char *why)
+{
+    if (err && err_len) {
+        snprintf(err, err_len, "%s", why);
+    }
+    if (wav->file) {
+        fclose(wav->file);
+        wav->file = NULL;
+    }
+    return false;
+}
+
+bool wav_open(wav_reader_t *wav, const char *path, char *err, size_t err_len)
+{
+    memset(wav, 0, sizeof(*wav));
+    wav->file = fopen(path, "rb");
+    if (!wav->file) {
+        return fail(wav, err, err_len, "cannot open");
+    }
+
+    uint8_t riff[12];
+    if (fread(riff, 1, sizeof(riff), wav->file) != sizeof(riff) ||
+        memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0) {
+        return fail(wav, err, err_len, "not a RIFF/WAVE file");
+    }
+
+    bool have_fmt = false;
+    uint16_t bits = 0;
+    for (;;) {
+        uint8_t hdr[8];
+        if (fread(hdr, 1, sizeof(hdr), wav->file) != sizeof(hdr)) {
+            return fail(wav, err, err_len, "no data chunk");
+        }
+        uint32_t size = le32(hdr + 4);
+
+        if (memcmp(hdr, "fmt ", 4) == 0) {
+            uint8_t fmt[40] = {0};
+            size_t want = size < sizeof(fmt) ? size : sizeof(fmt);
+            if (size < 16 || fread(fmt, 1, want, wav->file) != want) {
+                return fail(wav, err, err_len, "bad fmt chunk");
+            }
+            uint16_t format = le16(fmt);
+            if (format == WAV_FORMAT_EXTENSIBLE && size >= 26) {
+                format = le16(fmt + 24);    // first two bytes of the subformat GUID
+            }
+            if (format != WAV_FORMAT_PCM) {
+                return fail(wav, err, err_len, "not PCM");
+            }
+            wav->channels = le16(fmt + 2);
+            wav->sample_rate = le32(fmt + 4);
+            bits = le16(fmt + 14);
+            have_fmt = true;
+            size -= (uint32_t)want;
+        } else if (memcmp(hdr, "data", 4) == 0) {
+            if (!have_fmt) {
+                return fail(wav, err, err_len, "data before fmt");
+            }
+            if (bits != 16 || wav->channels == 0 || wav->channels > WAV_MAX_CHANNELS) {
+                return fail(wav, err, err_len, "only 16-bit PCM with 1-8 channels is supported");
+            }
+            wav->frames_total = size / (2u * wav->channels);
+            wav->frames_left = wav->frames_total;
+            return true;
+        }
+
+        // Skip the rest of this chunk (chunks are word aligned)
+        if (fseek(wav->file, (long)size + (size & 1), SEEK_CUR) != 0) {
+            return fail(wav, err, err_len, "truncated chunk");
+        }
+    }
+}
+
+size_t wav_read(wav_reader_t *wav, int16_t *out, size_t count)
+{
+    if (!wav->file || wav->frames_left == 0) {
+        return 0;
+    }
+    if (count > wav->frames_left) {
+        count = wav->frames_left;
+    }
+
+    size_t got;
+    if (wav->channels == 1) {
+        got = fread(out, sizeof(int16_t), count, wav->file);
+    } else {
+        int16_t interleaved[WAV_MAX_CHANNELS];
+        got = 0;
+        while (got < count) {
+            if (fread(interleaved, sizeof(int16_t), wav->channels, wav->file) != wav->channels) {
+                break;
+            }
+            out[got++] = interleaved[0];
+        }
+    }
+    wav->frames_left = got < count ? 0 : wav->frames_left - (uint32_t)got;
+    return got;
+}
+
+void wav_close(wav_reader_t *wav)
+{
+    if (wav->file) {
+        fclose(wav->file);
+        wav->file = NULL;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief Streaming reader for 16-bit PCM WAV files
+ *
+ * Multi-channel files are read as their first channel. No resampling: the
+ * caller checks sample_rate. Assumes a little-endian host.
+ */
+typedef struct {
+    FILE *file;
+    uint32_t sample_rate;
+    uint16_t channels;
+    uint32_t frames_total;          ///< Sample frames (per channel) in the data chunk
+    uint32_t frames_left;
+} wav_reader_t;
+
+/**
+ * @brief Open a file and position at the first sample
+ *
+ * @param err Receives a short reason on failure (may be NULL)
+ */
+bool wav_open(wav_reader_t *wav, const char *path, char *err, size_t err_len);
+
+/**
+ * @brief Read up to count mono samples
+ *
+ * @return Samples read, 0 at end of data
+ */
+size_t wav_read(wav_reader_t *wav, int16_t *out, size_t count);
+
+void wav_close(wav_reader_t *wav);
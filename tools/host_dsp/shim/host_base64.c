@@ -0,0 +1,121 @@
+/*
+ * RFC 4648 base64 with the mbedtls_base64_* contract, so howdytts_protocol.c
+ * builds without pulling mbedtls onto the host.
+ */
+#include "mbedtls/base64.h"
+#include <stdint.h>
+
+static const unsigned char B64_ENC[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen,
+                          const unsigned char *src, size_t slen)
+{
+    size_t need = ((slen + 2) / 3) * 4 + 1;     // mbedtls counts the terminator
+    if (slen == 0) {
+        *olen = 0;
+        return 0;
+    }
+    if (!dst || dlen < need) {
+        *olen = need;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
+
+    unsigned char *p = dst;
+    size_t i = 0;
+    for (; i + 2 < slen; i += 3) {
+        uint32_t v = ((uint32_t)src[i] << 16) | ((uint32_t)src[i + 1] << 8) | src[i + 2];
+        *p++ = B64_ENC[(v >> 18) & 0x3F];
+        *p++ = B64_ENC[(v >> 12) & 0x3F];
+        *p++ = B64_ENC[(v >> 6) & 0x3F];
+        *p++ = B64_ENC[v & 0x3F];
+    }
+    if (i < slen) {
+        uint32_t v = (uint32_t)src[i] << 16;
+        if (i + 1 < slen) {
+            v |= (uint32_t)src[i + 1] << 8;
+        }
+        *p++ = B64_ENC[(v >> 18) & 0x3F];
+        *p++ = B64_ENC[(v >> 12) & 0x3F];
+        *p++ = (i + 1 < slen) ? B64_ENC[(v >> 6) & 0x3F] : '=';
+        *p++ = '=';
+    }
+    *p = '\0';
+    *olen = (size_t)(p - dst);
+    return 0;
+}
+
+static int b64_value(unsigned char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return -1;
+}
+
+int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen,
+                          const unsigned char *src, size_t slen)
+{
+    size_t chars = 0;
+    size_t pad = 0;
+    for (size_t i = 0; i < slen; i++) {
+        unsigned char c = src[i];
+        if (c == ' ' || c == '\r' || c == '\n') {
+            continue;
+        }
+        if (c == '=') {
+            if (++pad > 2) {
+                return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+            }
+            chars++;
+            continue;
+        }
+        if (pad || b64_value(c) < 0) {
+            return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+        }
+        chars++;
+    }
+    if (chars == 0) {
+        *olen = 0;
+        return 0;
+    }
+    if (chars % 4) {
+        return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+    }
+
+    size_t need = (chars / 4) * 3 - pad;
+    if (!dst || dlen < need) {
+        *olen = need;
+        return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+    }
+
+    uint32_t acc = 0;
+    size_t n = 0;
+    unsigned char *p = dst;
+    for (size_t i = 0; i < slen; i++) {
+        int v = b64_value(src[i]);
+        if (v < 0) {
+            continue;
+        }
+        acc = (acc << 6) | (uint32_t)v;
+        if (++n == 4) {
+            *p++ = (unsigned char)(acc >> 16);
+            *p++ = (unsigned char)(acc >> 8);
+            *p++ = (unsigned char)acc;
+            acc = 0;
+            n = 0;
+        }
+    }
+    if (n == 3) {           // one '='
+        acc <<= 6;
+        *p++ = (unsigned char)(acc >> 16);
+        *p++ = (unsigned char)(acc >> 8);
+    } else if (n == 2) {    // two '='
+        acc <<= 12;
+        *p++ = (unsigned char)(acc >> 16);
+    }
+    *olen = (size_t)(p - dst);
+    return 0;
+}
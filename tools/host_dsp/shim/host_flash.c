@@ -0,0 +1,107 @@
+/*
+ * File-backed partitions and the ROM CRC, for the UI modules that read the
+ * asset pack from flash.
+ */
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "host_shim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOST_MAX_PARTITIONS 4
+
+static struct {
+    esp_partition_t part;
+    uint8_t *data;
+} s_parts[HOST_MAX_PARTITIONS];
+static int s_part_count;
+
+esp_err_t host_shim_add_partition(const char *label, int subtype, const char *path)
+{
+    if (!label || !path || strlen(label) >= sizeof(s_parts[0].part.label)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_part_count == HOST_MAX_PARTITIONS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = size > 0 ? malloc((size_t)size) : NULL;
+    if (data && fread(data, 1, (size_t)size, f) != (size_t)size) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    if (!data) {
+        return ESP_FAIL;
+    }
+
+    esp_partition_t *p = &s_parts[s_part_count].part;
+    p->type = ESP_PARTITION_TYPE_DATA;
+    p->subtype = subtype;
+    p->address = 0;
+    p->size = (uint32_t)size;
+    strcpy(p->label, label);
+    s_parts[s_part_count].data = data;
+    s_part_count++;
+    return ESP_OK;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    for (int i = 0; i < s_part_count && i < HOST_MAX_PARTITIONS; i++) {
+        const esp_partition_t *p = &s_parts[i].part;
+        if ((type == ESP_PARTITION_TYPE_ANY || p->type == type) &&
+            (subtype == ESP_PARTITION_SUBTYPE_ANY || p->subtype == subtype) &&
+            (!label || strcmp(p->label, label) == 0)) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory,
+                             const void **out_ptr, esp_partition_mmap_handle_t *out_handle)
+{
+    (void)memory;
+    for (int i = 0; i < s_part_count; i++) {
+        if (&s_parts[i].part != partition) {
+            continue;
+        }
+        if (offset > partition->size || size > partition->size - offset) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        *out_ptr = s_parts[i].data + offset;
+        *out_handle = (esp_partition_mmap_handle_t)i;
+        return ESP_OK;
+    }
+    return ESP_ERR_INVALID_ARG;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+    // The copy lives as long as the process
+    (void)handle;
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len)
+{
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (uint32_t)-(int32_t)(crc & 1));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,235 @@
+/*
+ * POSIX implementations of the ESP-IDF calls the DSP modules use, plus the
+ * counters behind the benchmark's allocations/frame and bytes-copied
+ * columns.
+ */
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "host_shim.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#define host_usable_size(p) malloc_size(p)
+#else
+#include <malloc.h>
+#define host_usable_size(p) malloc_usable_size(p)
+#endif
+
+static _Atomic uint64_t s_allocs;
+static _Atomic uint64_t s_frees;
+static _Atomic uint64_t s_alloc_bytes;
+static _Atomic uint64_t s_copied_bytes;
+static _Atomic bool s_virtual_clock;
+static _Atomic int64_t s_virtual_time_us;
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:                    return "ESP_OK";
+    case ESP_FAIL:                  return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:            return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:       return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:     return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:      return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:         return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:     return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:           return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE:  return "ESP_ERR_INVALID_RESPONSE";
+    case ESP_ERR_INVALID_CRC:       return "ESP_ERR_INVALID_CRC";
+    case ESP_ERR_INVALID_VERSION:   return "ESP_ERR_INVALID_VERSION";
+    case ESP_ERR_INVALID_MAC:       return "ESP_ERR_INVALID_MAC";
+    case ESP_ERR_NOT_FINISHED:      return "ESP_ERR_NOT_FINISHED";
+    default:                        return "UNKNOWN ERROR";
+    }
+}
+
+int64_t esp_timer_get_time(void)
+{
+    if (atomic_load_explicit(&s_virtual_clock, memory_order_acquire)) {
+        return atomic_load_explicit(&s_virtual_time_us, memory_order_relaxed);
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void host_shim_set_time_us(int64_t now_us)
+{
+    atomic_store_explicit(&s_virtual_time_us, now_us, memory_order_relaxed);
+    atomic_store_explicit(&s_virtual_clock, true, memory_order_release);
+}
+
+void host_shim_use_real_time(void)
+{
+    atomic_store_explicit(&s_virtual_clock, false, memory_order_release);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / 1000);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    struct timespec ts = { .tv_sec = ticks / 1000, .tv_nsec = (long)(ticks % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+// ---- Heap ----
+
+static inline void count_alloc(void *ptr, size_t size)
+{
+    if (ptr) {
+        atomic_fetch_add_explicit(&s_allocs, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&s_alloc_bytes, size, memory_order_relaxed);
+    }
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    void *ptr = malloc(size);
+    count_alloc(ptr, size);
+    return ptr;
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    void *ptr = calloc(n, size);
+    count_alloc(ptr, n * size);
+    return ptr;
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+    (void)caps;
+    void *grown = realloc(ptr, size);
+    count_alloc(grown, size);
+    return grown;
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    (void)caps;
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, alignment < sizeof(void *) ? sizeof(void *) : alignment, size) != 0) {
+        return NULL;
+    }
+    count_alloc(ptr, size);
+    return ptr;
+}
+
+void *heap_caps_aligned_calloc(size_t alignment, size_t n, size_t size, uint32_t caps)
+{
+    void *ptr = heap_caps_aligned_alloc(alignment, n * size, caps);
+    if (ptr) {
+        memset(ptr, 0, n * size);
+    }
+    return ptr;
+}
+
+void heap_caps_free(void *ptr)
+{
+    if (ptr) {
+        atomic_fetch_add_explicit(&s_frees, 1, memory_order_relaxed);
+    }
+    free(ptr);
+}
+
+size_t heap_caps_get_allocated_size(void *ptr)
+{
+    return ptr ? host_usable_size(ptr) : 0;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    (void)caps;
+    return 64 * 1024 * 1024;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    (void)caps;
+    return 64 * 1024 * 1024;
+}
+
+// ---- Mutexes ----
+
+struct host_semaphore {
+    pthread_mutex_t mutex;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t sem = malloc(sizeof(*sem));
+    if (sem) {
+        pthread_mutex_init(&sem->mutex, NULL);
+    }
+    return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    (void)ticks;
+    return pthread_mutex_lock(&sem->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    return pthread_mutex_unlock(&sem->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    if (sem) {
+        pthread_mutex_destroy(&sem->mutex);
+        free(sem);
+    }
+}
+
+// ---- Copy accounting ----
+
+#ifdef HOST_SHIM_WRAP_MEMCPY
+// Linked with -Wl,--wrap=memcpy,--wrap=memmove; the modules are built with
+// -fno-builtin-memcpy so even small fixed-size copies land here.
+void *__real_memcpy(void *dst, const void *src, size_t n);
+void *__real_memmove(void *dst, const void *src, size_t n);
+
+void *__wrap_memcpy(void *dst, const void *src, size_t n)
+{
+    atomic_fetch_add_explicit(&s_copied_bytes, n, memory_order_relaxed);
+    return __real_memcpy(dst, src, n);
+}
+
+void *__wrap_memmove(void *dst, const void *src, size_t n)
+{
+    atomic_fetch_add_explicit(&s_copied_bytes, n, memory_order_relaxed);
+    return __real_memmove(dst, src, n);
+}
+#endif
+
+bool host_shim_counts_copies(void)
+{
+#ifdef HOST_SHIM_WRAP_MEMCPY
+    return true;
+#else
+    return false;
+#endif
+}
+
+void host_shim_get_counters(host_shim_counters_t *counters)
+{
+    counters->allocs = atomic_load_explicit(&s_allocs, memory_order_relaxed);
+    counters->frees = atomic_load_explicit(&s_frees, memory_order_relaxed);
+    counters->alloc_bytes = atomic_load_explicit(&s_alloc_bytes, memory_order_relaxed);
+    counters->copied_bytes = atomic_load_explicit(&s_copied_bytes, memory_order_relaxed);
+}
@@ -0,0 +1,411 @@
+/*
+ * pthread stand-ins for FreeRTOS tasks, task notifications, event groups
+ * and esp_timer, enough to run the capture engine and the boot graph on the
+ * host with real concurrency. Nothing here is real-time: priorities and
+ * core pinning are recorded only.
+ */
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_timer.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct host_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    UBaseType_t priority;
+    BaseType_t core_id;
+    char name[16];
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notify_count;
+    struct host_task *next_retired;
+};
+
+static __thread struct host_task *t_current;
+
+// Tasks that have ended; kept so late notifications stay harmless
+static pthread_mutex_t s_retired_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct host_task *s_retired;
+
+static void cond_init_monotonic(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+#if !defined(__APPLE__)
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static struct host_task *task_alloc(const char *name, UBaseType_t priority, BaseType_t core_id)
+{
+    struct host_task *task = calloc(1, sizeof(*task));
+    if (!task) {
+        return NULL;
+    }
+    strncpy(task->name, name ? name : "", sizeof(task->name) - 1);
+    task->priority = priority;
+    task->core_id = core_id;
+    pthread_mutex_init(&task->lock, NULL);
+    cond_init_monotonic(&task->cond);
+    return task;
+}
+
+static void task_retire(struct host_task *task)
+{
+    pthread_mutex_lock(&s_retired_lock);
+    task->next_retired = s_retired;
+    s_retired = task;
+    pthread_mutex_unlock(&s_retired_lock);
+}
+
+static void *task_main(void *arg)
+{
+    struct host_task *task = (struct host_task *)arg;
+    t_current = task;
+    task->fn(task->arg);
+    // FreeRTOS tasks must not return; treat it like vTaskDelete(NULL)
+    task_retire(task);
+    return NULL;
+}
+
+static void abs_deadline(struct timespec *ts, uint64_t delta_ns)
+{
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    uint64_t ns = (uint64_t)ts->tv_nsec + delta_ns;
+    ts->tv_sec += (time_t)(ns / 1000000000ULL);
+    ts->tv_nsec = (long)(ns % 1000000000ULL);
+}
+
+// ---- Tasks ----
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_size,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *out_handle,
+                                   BaseType_t core_id)
+{
+    struct host_task *task = task_alloc(name, priority, core_id);
+    if (!task) {
+        return pdFAIL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+
+    // Host frames are bigger than the target's; never go below the default
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    size_t stack = (size_t)stack_size * 4;
+    if (stack > 256 * 1024) {
+        pthread_attr_setstacksize(&attr, stack);
+    }
+    int rc = pthread_create(&task->thread, &attr, task_main, task);
+    pthread_attr_destroy(&attr);
+    if (rc != 0) {
+        free(task);
+        return pdFAIL;
+    }
+    if (out_handle) {
+        *out_handle = task;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_size,
+                       void *arg, UBaseType_t priority, TaskHandle_t *out_handle)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack_size, arg, priority, out_handle, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task && task != t_current) {
+        return;
+    }
+    // The handle stays allocated: other threads may still notify it
+    if (t_current) {
+        task_retire(t_current);
+    }
+    pthread_exit(NULL);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    if (!t_current) {
+        t_current = task_alloc("host", 1, tskNO_AFFINITY);
+    }
+    return t_current;
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task)
+{
+    task = task ? task : xTaskGetCurrentTaskHandle();
+    return task->priority;
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *prev_wake, TickType_t period)
+{
+    TickType_t next = *prev_wake + period;
+    TickType_t now = xTaskGetTickCount();
+    *prev_wake = next;
+    // Wrap-safe: a deadline at or before now means the caller fell behind
+    if ((int32_t)(next - now) <= 0) {
+        return pdFALSE;
+    }
+    vTaskDelay(next - now);
+    return pdTRUE;
+}
+
+void vTaskDelayUntil(TickType_t *prev_wake, TickType_t period)
+{
+    xTaskDelayUntil(prev_wake, period);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    // pthread stacks are not watermarked; 0 reads as "not sampled" everywhere
+    (void)task;
+    return 0;
+}
+
+// ---- Notifications ----
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    pthread_mutex_lock(&task->lock);
+    task->notify_count++;
+    pthread_cond_signal(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken)
+{
+    xTaskNotifyGive(task);
+    if (higher_priority_woken) {
+        *higher_priority_woken = pdTRUE;
+    }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks)
+{
+    struct host_task *task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    abs_deadline(&deadline, (uint64_t)ticks * 1000000ULL);
+
+    pthread_mutex_lock(&task->lock);
+    while (task->notify_count == 0 && ticks != 0) {
+        int rc = ticks == portMAX_DELAY ? pthread_cond_wait(&task->cond, &task->lock)
+                                        : pthread_cond_timedwait(&task->cond, &task->lock, &deadline);
+        if (rc == ETIMEDOUT) {
+            break;
+        }
+    }
+    uint32_t value = task->notify_count;
+    if (value) {
+        task->notify_count = clear_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+// ---- Event groups ----
+
+#define EVENT_BITS_MASK     0x00FFFFFFu     // The top byte is reserved on the target
+
+struct host_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+};
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    struct host_event_group *group = calloc(1, sizeof(*group));
+    if (!group) {
+        return NULL;
+    }
+    pthread_mutex_init(&group->lock, NULL);
+    cond_init_monotonic(&group->cond);
+    return group;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group)
+{
+    if (!group) {
+        return;
+    }
+    pthread_cond_destroy(&group->cond);
+    pthread_mutex_destroy(&group->lock);
+    free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits & EVENT_BITS_MASK;
+    EventBits_t value = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    pthread_mutex_lock(&group->lock);
+    EventBits_t value = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    pthread_mutex_lock(&group->lock);
+    EventBits_t value = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks)
+{
+    struct timespec deadline;
+    abs_deadline(&deadline, (uint64_t)ticks * 1000000ULL);
+
+    pthread_mutex_lock(&group->lock);
+    bool met;
+    for (;;) {
+        met = wait_for_all ? (group->bits & bits) == bits : (group->bits & bits) != 0;
+        if (met || ticks == 0) {
+            break;
+        }
+        int rc = ticks == portMAX_DELAY ? pthread_cond_wait(&group->cond, &group->lock)
+                                        : pthread_cond_timedwait(&group->cond, &group->lock, &deadline);
+        if (rc == ETIMEDOUT) {
+            met = wait_for_all ? (group->bits & bits) == bits : (group->bits & bits) != 0;
+            break;
+        }
+    }
+    // Like FreeRTOS: the value before clearing, or the current value on timeout
+    EventBits_t value = group->bits;
+    if (met && clear_on_exit) {
+        group->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&group->lock);
+    return value;
+}
+
+// ---- esp_timer ----
+
+struct host_timer {
+    esp_timer_create_args_t args;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint64_t period_us;
+    bool running;
+    bool has_thread;
+};
+
+static void *timer_main(void *arg)
+{
+    struct host_timer *timer = (struct host_timer *)arg;
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    pthread_mutex_lock(&timer->lock);
+    while (timer->running) {
+        uint64_t ns = (uint64_t)next.tv_nsec + timer->period_us * 1000ULL;
+        next.tv_sec += (time_t)(ns / 1000000000ULL);
+        next.tv_nsec = (long)(ns % 1000000000ULL);
+        while (timer->running &&
+               pthread_cond_timedwait(&timer->cond, &timer->lock, &next) != ETIMEDOUT) {
+        }
+        if (!timer->running) {
+            break;
+        }
+        pthread_mutex_unlock(&timer->lock);
+        timer->args.callback(timer->args.arg);
+        pthread_mutex_lock(&timer->lock);
+    }
+    pthread_mutex_unlock(&timer->lock);
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle)
+{
+    if (!args || !args->callback || !out_handle) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_timer *timer = calloc(1, sizeof(*timer));
+    if (!timer) {
+        return ESP_ERR_NO_MEM;
+    }
+    timer->args = *args;
+    pthread_mutex_init(&timer->lock, NULL);
+    cond_init_monotonic(&timer->cond);
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us)
+{
+    if (!timer || period_us == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer->lock);
+    bool running = timer->running;
+    timer->running = true;
+    timer->period_us = period_us;
+    pthread_mutex_unlock(&timer->lock);
+    if (running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (pthread_create(&timer->thread, NULL, timer_main, timer) != 0) {
+        timer->running = false;
+        return ESP_ERR_NO_MEM;
+    }
+    timer->has_thread = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    if (!timer) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer->lock);
+    bool running = timer->running;
+    timer->running = false;
+    pthread_cond_signal(&timer->cond);
+    pthread_mutex_unlock(&timer->lock);
+    // Like esp_timer_stop, a callback already running is allowed to finish
+    if (timer->has_thread && !pthread_equal(timer->thread, pthread_self())) {
+        pthread_join(timer->thread, NULL);
+        timer->has_thread = false;
+    }
+    return running ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    if (!timer) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pthread_cond_destroy(&timer->cond);
+    pthread_mutex_destroy(&timer->lock);
+    free(timer);
+    return ESP_OK;
+}
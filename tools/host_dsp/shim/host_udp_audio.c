@@ -0,0 +1,86 @@
+/*
+ * Loopback stand-in for udp_audio_streamer.c: packets are serialised into a
+ * datagram buffer exactly as they would be before sendto(), then dropped.
+ * Lets enhanced_udp_audio.c run its header builders and suppression logic
+ * without sockets.
+ */
+#include "udp_audio_streamer.h"
+#include <string.h>
+
+#define HOST_UDP_MAX_DATAGRAM   2048
+
+static udp_audio_config_t s_config;
+static udp_audio_stats_t s_stats;
+static bool s_initialized;
+static uint8_t s_datagram[HOST_UDP_MAX_DATAGRAM];
+
+esp_err_t udp_audio_init(const udp_audio_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_config = *config;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_initialized = true;
+    return ESP_OK;
+}
+
+esp_err_t udp_audio_deinit(void)
+{
+    s_initialized = false;
+    return ESP_OK;
+}
+
+esp_err_t udp_audio_send_packet(const udp_audio_header_t *header,
+                               const uint8_t *audio_data,
+                               size_t audio_size)
+{
+    if (!s_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!header || !audio_data || sizeof(*header) + audio_size > sizeof(s_datagram)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memcpy(s_datagram, header, sizeof(*header));
+    memcpy(s_datagram + sizeof(*header), audio_data, audio_size);
+    s_stats.packets_sent++;
+    s_stats.bytes_sent += sizeof(*header) + audio_size;
+    return ESP_OK;
+}
+
+esp_err_t udp_audio_send_rtp(const int16_t *samples, size_t sample_count,
+                             const rtp_vad_ext_t *vad,
+                             const rtp_wake_word_ext_t *wake_word)
+{
+    (void)samples;
+    (void)sample_count;
+    (void)vad;
+    (void)wake_word;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+bool udp_audio_is_rtp_enabled(void)
+{
+    return false;
+}
+
+esp_err_t udp_audio_get_stats(udp_audio_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = s_stats;
+    return ESP_OK;
+}
+
+esp_err_t udp_audio_reset_stats(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+    return ESP_OK;
+}
+
+bool udp_audio_is_streaming(void)
+{
+    return s_initialized;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Types only: there is no I2S peripheral on the host. Code paths that need
+ * a real channel fail with ESP_ERR_NOT_SUPPORTED; use the capture engine's
+ * FAKE source instead.
+ */
+
+typedef struct i2s_channel_obj_t *i2s_chan_handle_t;
+
+typedef struct {
+    void *dma_buf;
+    size_t size;
+} i2s_event_data_t;
+
+typedef bool (*i2s_isr_callback_t)(i2s_chan_handle_t handle, i2s_event_data_t *event, void *user_ctx);
+
+typedef struct {
+    i2s_isr_callback_t on_recv;
+    i2s_isr_callback_t on_recv_q_ovf;
+    i2s_isr_callback_t on_sent;
+    i2s_isr_callback_t on_send_q_ovf;
+} i2s_event_callbacks_t;
+
+static inline esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle,
+                                                            const i2s_event_callbacks_t *callbacks,
+                                                            void *user_data)
+{
+    (void)handle; (void)callbacks; (void)user_data;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t i2s_channel_enable(i2s_chan_handle_t handle)
+{
+    (void)handle;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t i2s_channel_disable(i2s_chan_handle_t handle)
+{
+    (void)handle;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdio.h>
+
+/*
+ * Host logging: errors and warnings go to stderr, everything else compiles
+ * out so it never shows up in benchmark timings. Define
+ * HOST_SHIM_LOG_VERBOSE to keep info/debug output as well.
+ */
+
+#define HOST_SHIM_LOG(level, tag, fmt, ...) \
+    fprintf(stderr, level " (%s) " fmt "\n", (tag), ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, fmt, ...) HOST_SHIM_LOG("E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) HOST_SHIM_LOG("W", tag, fmt, ##__VA_ARGS__)
+
+#ifdef HOST_SHIM_LOG_VERBOSE
+#define ESP_LOGI(tag, fmt, ...) HOST_SHIM_LOG("I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) HOST_SHIM_LOG("D", tag, fmt, ##__VA_ARGS__)
+#else
+#define ESP_LOGI(tag, fmt, ...) do { (void)(tag); } while (0)
+#define ESP_LOGD(tag, fmt, ...) do { (void)(tag); } while (0)
+#endif
+#define ESP_LOGV(tag, fmt, ...) do { (void)(tag); } while (0)
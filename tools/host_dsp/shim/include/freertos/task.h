@@ -0,0 +1,46 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Tasks are pthreads (host_task.c). Priorities and core pinning are
+ * recorded but not enforced; notifications are a counting semaphore per
+ * task. Threads that were not created here get a handle on first use.
+ */
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+#define tskNO_AFFINITY          ((BaseType_t)0x7fffffff)
+
+TickType_t xTaskGetTickCount(void);
+void vTaskDelay(TickType_t ticks);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_size,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *out_handle,
+                                   BaseType_t core_id);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_size,
+                       void *arg, UBaseType_t priority, TaskHandle_t *out_handle);
+
+/** Only NULL (the calling task) is supported: a pthread cannot be killed from outside */
+void vTaskDelete(TaskHandle_t task);
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+
+/** Ticks are esp_timer_get_time() milliseconds; the sleep itself is always real time */
+BaseType_t xTaskDelayUntil(TickType_t *prev_wake, TickType_t period);
+void vTaskDelayUntil(TickType_t *prev_wake, TickType_t period);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Process-wide counters kept by the shims
+ */
+typedef struct {
+    uint64_t allocs;                ///< heap_caps_* allocations (including realloc)
+    uint64_t frees;
+    uint64_t alloc_bytes;           ///< Bytes requested
+    uint64_t copied_bytes;          ///< memcpy/memmove bytes (0 unless copies are counted)
+} host_shim_counters_t;
+
+/**
+ * @brief Snapshot the counters
+ */
+void host_shim_get_counters(host_shim_counters_t *counters);
+
+/**
+ * @brief Whether memcpy/memmove are wrapped, i.e. copied_bytes means anything
+ */
+bool host_shim_counts_copies(void);
+
+/**
+ * @brief Drive esp_timer_get_time() from the caller instead of CLOCK_MONOTONIC
+ *
+ * For replaying recordings faster than real time: modules that measure
+ * silence or rate-limit by wall clock then see audio time. The first call
+ * switches the clock over; time should only move forward.
+ */
+void host_shim_set_time_us(int64_t now_us);
+
+/**
+ * @brief Go back to CLOCK_MONOTONIC for esp_timer_get_time()
+ */
+void host_shim_use_real_time(void);
+
+/**
+ * @brief Back a data partition with a file
+ *
+ * The file is read into memory once; esp_partition_find_first() finds it by
+ * subtype and label and esp_partition_mmap() returns pointers into the copy.
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the file cannot be opened
+ */
+esp_err_t host_shim_add_partition(const char *label, int subtype, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
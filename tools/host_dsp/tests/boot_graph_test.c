@@ -0,0 +1,194 @@
+/*
+ * Runs howdy_boot on the pthread task and event group shims with a graph
+ * shaped like the firmware's: system and display first, voice models in
+ * parallel with display and Wi-Fi, HowdyTTS after the models, audio and
+ * discovery after that, and a "ready" milestone at the end. Stages sleep
+ * for their stand-in durations. A side branch fails, so its dependents
+ * must be skipped while everything else runs.
+ *
+ * Built twice: with CONFIG_HOWDY_BOOT_PARALLEL the run must overlap
+ * independent stages and finish well under the sum of the stage times;
+ * without it, stages must run one at a time. Both check dependency order,
+ * skipping, the returned error, and the rejection of duplicate names,
+ * unknown dependencies, cycles and a second run.
+ */
+#include "howdy_boot.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "host_check.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+// howdy_trace.c needs the FreeRTOS tick hooks; the boot graph only names its track
+uint8_t howdy_trace_track(const char *name)
+{
+    (void)name;
+    return 1;
+}
+
+typedef struct {
+    uint32_t ms;
+    esp_err_t result;
+    atomic_int calls;
+} work_t;
+
+static esp_err_t work(void *arg)
+{
+    work_t *w = (work_t *)arg;
+    atomic_fetch_add(&w->calls, 1);
+    vTaskDelay(pdMS_TO_TICKS(w->ms));
+    return w->result;
+}
+
+static esp_err_t never_called(void *arg)
+{
+    (void)arg;
+    return ESP_FAIL;
+}
+
+static work_t w_system = { 100 }, w_display = { 150 }, w_ui = { 50 }, w_wifi = { 200 };
+static work_t w_models = { 300 }, w_howdytts = { 50 }, w_audio = { 60 }, w_discovery = { 50 };
+static work_t w_sensor = { 10, ESP_ERR_NOT_FOUND }, w_sensor_cal = { 10 };
+
+#define STAGE(n, w, ...)    { .name = n, .fn = work, .arg = &w, .deps = { __VA_ARGS__ }, .core = -1 }
+
+static const howdy_boot_stage_t s_graph[] = {
+    STAGE("system", w_system),
+    STAGE("display", w_display),
+    STAGE("ui", w_ui, "display"),
+    STAGE("wifi", w_wifi, "system"),
+    { .name = "voice_models", .fn = work, .arg = &w_models, .core = 1 },
+    STAGE("howdytts", w_howdytts, "system", "voice_models"),
+    STAGE("audio_io", w_audio, "howdytts"),
+    STAGE("discovery", w_discovery, "wifi", "howdytts"),
+    { .name = "ready", .deps = { "audio_io", "discovery", "ui" } },
+    STAGE("sensor", w_sensor, "system"),
+    STAGE("sensor_cal", w_sensor_cal, "sensor"),
+    { .name = "sensor_ready", .deps = { "sensor_cal" } },
+};
+#define GRAPH_COUNT         (sizeof(s_graph) / sizeof(s_graph[0]))
+
+static void check_rejected(void)
+{
+    const howdy_boot_stage_t dup[] = {
+        { .name = "a", .fn = never_called },
+        { .name = "a", .fn = never_called },
+    };
+    const howdy_boot_stage_t unknown[] = {
+        { .name = "a", .fn = never_called, .deps = { "nope" } },
+    };
+    const howdy_boot_stage_t self[] = {
+        { .name = "a", .fn = never_called, .deps = { "a" } },
+    };
+    const howdy_boot_stage_t cycle[] = {
+        { .name = "a", .fn = never_called },
+        { .name = "b", .fn = never_called, .deps = { "a", "d" } },
+        { .name = "c", .fn = never_called, .deps = { "b" } },
+        { .name = "d", .fn = never_called, .deps = { "c" } },
+    };
+    CHECK(howdy_boot_run(dup, 2) == ESP_ERR_INVALID_ARG, "duplicate name accepted");
+    CHECK(howdy_boot_run(unknown, 1) == ESP_ERR_INVALID_ARG, "unknown dependency accepted");
+    CHECK(howdy_boot_run(self, 1) == ESP_ERR_INVALID_ARG, "self dependency accepted");
+    CHECK(howdy_boot_run(cycle, 4) == ESP_ERR_INVALID_ARG, "cycle accepted");
+    CHECK(howdy_boot_run(NULL, 1) == ESP_ERR_INVALID_ARG, "NULL stages accepted");
+    CHECK(howdy_boot_run(s_graph, 0) == ESP_ERR_INVALID_ARG, "empty graph accepted");
+    CHECK(howdy_boot_run(s_graph, HOWDY_BOOT_MAX_STAGES + 1) == ESP_ERR_INVALID_ARG,
+          "oversized graph accepted");
+}
+
+static howdy_boot_stage_stats_t stage(const char *name)
+{
+    howdy_boot_stage_stats_t st = {0};
+    CHECK(howdy_boot_get_stage(name, &st) == ESP_OK, "no stage %s", name);
+    return st;
+}
+
+static bool overlap(const howdy_boot_stage_stats_t *a, const howdy_boot_stage_stats_t *b)
+{
+    return a->start_us < b->end_us && b->start_us < a->end_us;
+}
+
+int main(void)
+{
+    check_rejected();
+
+    esp_err_t ret = howdy_boot_run(s_graph, GRAPH_COUNT);
+    CHECK(ret == ESP_ERR_NOT_FOUND, "run returned %s, expected the failing stage's error",
+          esp_err_to_name(ret));
+    CHECK(howdy_boot_run(s_graph, GRAPH_COUNT) == ESP_ERR_INVALID_STATE, "second run accepted");
+
+    howdy_boot_summary_t sum;
+    howdy_boot_get_summary(&sum);
+    CHECK(sum.parallel == CONFIG_HOWDY_BOOT_PARALLEL, "parallel %d", sum.parallel);
+    CHECK(sum.stage_count == GRAPH_COUNT && sum.failed == 3, "stages %zu failed %u",
+          sum.stage_count, sum.failed);
+
+    // Statuses, and only the stages that should run were called, once each
+    howdy_boot_stage_stats_t stats[HOWDY_BOOT_MAX_STAGES];
+    size_t n = howdy_boot_get_stages(stats, HOWDY_BOOT_MAX_STAGES);
+    CHECK(n == GRAPH_COUNT, "get_stages returned %zu", n);
+    for (size_t i = 0; i < n; i++) {
+        const howdy_boot_stage_stats_t *st = &stats[i];
+        howdy_boot_status_t want = HOWDY_BOOT_DONE;
+        if (strcmp(st->name, "sensor") == 0) {
+            want = HOWDY_BOOT_FAILED;
+        } else if (strncmp(st->name, "sensor_", 7) == 0) {
+            want = HOWDY_BOOT_SKIPPED;
+        }
+        CHECK(st->status == want, "%s: %s, expected %s", st->name,
+              howdy_boot_status_name(st->status), howdy_boot_status_name(want));
+        if (s_graph[i].fn) {
+            int calls = atomic_load(&((work_t *)s_graph[i].arg)->calls);
+            CHECK(calls == (want == HOWDY_BOOT_SKIPPED ? 0 : 1), "%s called %d times", st->name, calls);
+        }
+    }
+    CHECK(stage("sensor").err == ESP_ERR_NOT_FOUND, "sensor error not recorded");
+    CHECK(stage("ready").milestone && !stage("system").milestone, "milestone flags");
+
+    // Nothing starts before its dependencies end
+    for (size_t i = 0; i < n; i++) {
+        if (stats[i].status != HOWDY_BOOT_DONE) {
+            continue;
+        }
+        for (int d = 0; d < HOWDY_BOOT_MAX_DEPS && s_graph[i].deps[d]; d++) {
+            howdy_boot_stage_stats_t dep = stage(s_graph[i].deps[d]);
+            CHECK(dep.end_us <= stats[i].ready_us && stats[i].ready_us <= stats[i].start_us,
+                  "%s started at %u before %s ended at %u", stats[i].name, stats[i].start_us,
+                  dep.name, dep.end_us);
+        }
+    }
+
+    uint32_t wall_us = sum.end_us - sum.start_us;
+    CHECK(sum.serial_us >= 970 * 1000, "stage work %u us, expected at least 970 ms", sum.serial_us);
+    howdy_boot_stage_stats_t models = stage("voice_models"), display = stage("display");
+    howdy_boot_stage_stats_t wifi = stage("wifi");
+#if CONFIG_HOWDY_BOOT_PARALLEL
+    CHECK(wall_us < sum.serial_us * 7 / 10, "parallel boot took %u us of %u us work",
+          wall_us, sum.serial_us);
+    CHECK(overlap(&models, &display) && overlap(&models, &wifi),
+          "voice models did not overlap display and Wi-Fi");
+#else
+    CHECK(wall_us >= sum.serial_us, "serial boot took %u us, less than %u us of work",
+          wall_us, sum.serial_us);
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i + 1; j < n; j++) {
+            if (s_graph[i].fn && s_graph[j].fn && stats[i].status != HOWDY_BOOT_SKIPPED &&
+                stats[j].status != HOWDY_BOOT_SKIPPED) {
+                CHECK(!overlap(&stats[i], &stats[j]), "%s overlapped %s", stats[i].name, stats[j].name);
+            }
+        }
+    }
+    (void)models;
+    (void)display;
+    (void)wifi;
+#endif
+
+    if (host_check_status()) {
+        return 1;
+    }
+    printf("boot graph (%s): %zu stages in %u ms against %u ms of stage work, %u failed or skipped\n",
+           sum.parallel ? "parallel" : "serial", sum.stage_count, wall_us / 1000,
+           sum.serial_us / 1000, sum.failed);
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * Drives ui_frame_governor on the shim's virtual clock against a
+ * registered LVGL display and checks the refresh period it sets on the
+ * display's refresh timer: the rate of each UI state, elevated and
+ * critical audio pressure, audio-priority states, a report lapsing after
+ * 2 s without renewal (and not before), a report stamped just after the
+ * update read the clock, skipped-frame accounting while throttled, and the
+ * frame rate counted from LVGL's monitor callback.
+ */
+#include "lvgl.h"
+#include "ui_frame_governor.h"
+#include "host_shim.h"
+#include "host_check.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+#define HRES                800
+#define VRES                800
+#define BUF_LINES           40
+
+static lv_disp_t *s_disp;
+static uint32_t s_now_ms;
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *px)
+{
+    (void)area;
+    (void)px;
+    lv_disp_flush_ready(drv);
+}
+
+static lv_disp_t *display_init(void)
+{
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t drv;
+    static lv_color_t buf[HRES * BUF_LINES];
+
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HRES * BUF_LINES);
+    lv_disp_drv_init(&drv);
+    drv.hor_res = HRES;
+    drv.ver_res = VRES;
+    drv.flush_cb = flush_cb;
+    drv.draw_buf = &draw_buf;
+    return lv_disp_drv_register(&drv);
+}
+
+static void advance(uint32_t ms)
+{
+    s_now_ms += ms;
+    host_shim_set_time_us((int64_t)s_now_ms * 1000);
+}
+
+// One governor update; returns the period in force on the refresh timer
+static uint32_t update(void)
+{
+    uint32_t period = 0;
+    bool changed = ui_frame_governor_update(&period);
+    uint32_t timer_period = s_disp->refr_timer->period;
+    CHECK(!changed || period == timer_period, "reported %u, timer has %u", period, timer_period);
+    return timer_period;
+}
+
+// A refresh that draws something, as LVGL's timer would run it
+static void draw_frame(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    s_disp->refr_timer->timer_cb(s_disp->refr_timer);
+}
+
+int main(void)
+{
+    advance(1);
+    lv_init();
+    s_disp = display_init();
+    CHECK(s_disp != NULL, "display init");
+    if (!s_disp) {
+        return 1;
+    }
+
+    uint32_t period;
+    CHECK(!ui_frame_governor_update(&period), "update before init");
+    CHECK(ui_frame_governor_init(s_disp) == ESP_OK, "init");
+
+    ui_frame_governor_stats_t st;
+    ui_frame_governor_get_stats(&st);
+    CHECK(st.period_ms == LV_DISP_DEF_REFR_PERIOD, "initial period %u", st.period_ms);
+
+    // Each state's rate
+    static const struct {
+        ui_state_t state;
+        uint32_t period_ms;
+    } rates[] = {
+        { UI_STATE_IDLE, 100 },
+        { UI_STATE_WAKE_WORD_DETECTED, 67 },
+        { UI_STATE_LISTENING, LV_DISP_DEF_REFR_PERIOD },
+        { UI_STATE_PROCESSING, 50 },
+        { UI_STATE_SPEAKING, LV_DISP_DEF_REFR_PERIOD },
+        { UI_STATE_SESSION_ENDING, 67 },
+        { UI_STATE_DISCONNECTED, 100 },
+    };
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        ui_frame_governor_set_state(rates[i].state);
+        advance(10);
+        CHECK(update() == rates[i].period_ms, "state %d: period %u, expected %u",
+              rates[i].state, s_disp->refr_timer->period, rates[i].period_ms);
+    }
+    ui_frame_governor_get_stats(&st);
+    uint32_t changes = st.period_changes;
+    advance(10);
+    CHECK(!ui_frame_governor_update(&period), "same state changed the period");
+
+    // Elevated pressure halves a spinner state's rate
+    ui_frame_governor_set_state(UI_STATE_PROCESSING);
+    advance(10);
+    CHECK(update() == 50, "processing: %u", s_disp->refr_timer->period);
+    ui_frame_governor_report_audio_pressure(UI_AUDIO_PRESSURE_ELEVATED);
+    advance(10);
+    CHECK(update() == 100, "processing under elevated pressure: %u", s_disp->refr_timer->period);
+    ui_frame_governor_get_stats(&st);
+    CHECK(st.pressure == UI_AUDIO_PRESSURE_ELEVATED && st.target_period_ms == 50,
+          "pressure %d target %u", st.pressure, st.target_period_ms);
+    CHECK(st.period_changes == changes + 2, "period changes %u", st.period_changes - changes);
+
+    // Any pressure while audio has priority drops to the floor
+    ui_frame_governor_set_state(UI_STATE_LISTENING);
+    advance(10);
+    CHECK(update() == 100, "listening under elevated pressure: %u", s_disp->refr_timer->period);
+
+    // The report holds for 2 s, then lapses
+    ui_frame_governor_report_audio_pressure(UI_AUDIO_PRESSURE_CRITICAL);
+    advance(2000);
+    CHECK(update() == 100, "critical pressure lapsed early");
+    advance(1);
+    CHECK(update() == LV_DISP_DEF_REFR_PERIOD, "critical pressure did not lapse: %u",
+          s_disp->refr_timer->period);
+
+    // A report stamped after the update read the clock is fresh, not 49 days old
+    ui_frame_governor_set_state(UI_STATE_PROCESSING);
+    advance(1000);
+    ui_frame_governor_report_audio_pressure(UI_AUDIO_PRESSURE_CRITICAL);
+    s_now_ms -= 1;
+    advance(0);
+    CHECK(update() == 100, "report from the future treated as lapsed: %u",
+          s_disp->refr_timer->period);
+
+    // Throttled from 50 to 100 ms: one frame skipped per update
+    advance(1);
+    ui_frame_governor_get_stats(&st);
+    uint32_t skipped = st.skipped;
+    for (int i = 0; i < 10; i++) {
+        ui_frame_governor_report_audio_pressure(UI_AUDIO_PRESSURE_CRITICAL);
+        advance(100);
+        update();
+    }
+    ui_frame_governor_get_stats(&st);
+    CHECK(st.skipped - skipped == 10, "skipped %u frames, expected 10", st.skipped - skipped);
+
+    // Frame rate over a one-second window, from the monitor callback
+    ui_frame_governor_report_audio_pressure(UI_AUDIO_PRESSURE_NONE);
+    advance(1000);
+    update();
+    ui_frame_governor_get_stats(&st);
+    uint32_t frames = st.frames;
+    for (int i = 0; i < 20; i++) {
+        advance(50);
+        draw_frame();
+        update();
+    }
+    ui_frame_governor_get_stats(&st);
+    CHECK(st.frames - frames == 20, "monitor counted %u frames", st.frames - frames);
+    CHECK(st.fps > 19.0f && st.fps < 21.0f, "fps %.1f", st.fps);
+    CHECK(st.period_ms == 50 && st.pressure == UI_AUDIO_PRESSURE_NONE,
+          "period %u pressure %d after the report was cleared", st.period_ms, st.pressure);
+
+    if (host_check_status()) {
+        return 1;
+    }
+    printf("frame governor: state rates, pressure, lapse, skips and fps ok "
+           "(%u period changes, %u skipped)\n", st.period_changes, st.skipped);
+    return 0;
+}
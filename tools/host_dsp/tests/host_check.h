@@ -0,0 +1,28 @@
+#pragma once
+
+/*
+ * Shared by the host tests: CHECK() reports a failed condition with its
+ * location and keeps going, so one run lists every failure; main() returns
+ * host_check_status(), which is 1 if any check failed.
+ */
+#include <stdio.h>
+
+static int s_failures;
+
+#define CHECK(cond, ...) do {                                       \
+        if (!(cond)) {                                              \
+            fprintf(stderr, "FAIL %s:%d: ", __FILE__, __LINE__);    \
+            fprintf(stderr, __VA_ARGS__);                           \
+            fprintf(stderr, "\n");                                  \
+            s_failures++;                                           \
+        }                                                           \
+    } while (0)
+
+static inline int host_check_status(void)
+{
+    if (s_failures) {
+        fprintf(stderr, "%d check(s) failed\n", s_failures);
+        return 1;
+    }
+    return 0;
+}
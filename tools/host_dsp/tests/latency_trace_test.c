@@ -0,0 +1,191 @@
+/*
+ * Replays the firmware's capture path through the latency tracer with the
+ * same thread layout: this thread plays the HowdyTTS streaming task,
+ * taking frames from an i2s_dma_capture FAKE source and stamping
+ * HOWDY_LAT_I2S_DMA from the descriptor before handing the frame on. An
+ * analysis pthread (the app's VAD stage) records the VAD decision for
+ * every frame and triggers the wake word on one of them, and a send
+ * pthread (udp_send_task) marks HOWDY_LAT_UPLINK per datagram. The TTS
+ * points are then marked in playback order.
+ *
+ * Checks that capture-to-VAD is recorded for every frame with the DMA
+ * timestamp carried through, that the utterance completes with exactly one
+ * sample in every wake span, and that playback points arriving out of
+ * order do not close it early.
+ */
+#include "howdy_latency.h"
+#include "audio_frame_ring.h"
+#include "i2s_dma_capture.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_check.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+
+#define SAMPLE_RATE         16000
+#define FRAME_SAMPLES       320                     // 20 ms
+#define DMA_BUFFERS         4
+#define CAPTURE_FRAMES      20
+#define WAKE_FRAME          8
+
+typedef struct {
+    uint32_t seq;
+    int64_t captured_us;
+} trace_frame_t;
+
+typedef struct {
+    audio_frame_ring_t *analysis;
+    audio_frame_ring_t *transport;
+    atomic_bool capture_done;
+    uint32_t analysed;
+    uint32_t zero_stamps;
+    uint32_t sent;
+} trace_test_t;
+
+static void sleep_ms(int ms)
+{
+    struct timespec ts = { .tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L };
+    nanosleep(&ts, NULL);
+}
+
+static bool next_frame(trace_test_t *t, audio_frame_ring_t *ring, trace_frame_t *frame)
+{
+    size_t len;
+    while (!audio_frame_ring_pop(ring, frame, &len)) {
+        if (atomic_load(&t->capture_done) && audio_frame_ring_count(ring) == 0) {
+            return false;
+        }
+        sched_yield();
+    }
+    return true;
+}
+
+static void *analysis_main(void *arg)
+{
+    trace_test_t *t = (trace_test_t *)arg;
+    trace_frame_t frame;
+    while (next_frame(t, t->analysis, &frame)) {
+        if (frame.captured_us == 0) {
+            t->zero_stamps++;
+        }
+        howdy_lat_vad_decision(frame.captured_us);
+        if (frame.seq == WAKE_FRAME) {
+            howdy_lat_mark(HOWDY_LAT_WAKE);
+        }
+        t->analysed++;
+    }
+    return NULL;
+}
+
+static void *send_main(void *arg)
+{
+    trace_test_t *t = (trace_test_t *)arg;
+    trace_frame_t frame;
+    while (next_frame(t, t->transport, &frame)) {
+        howdy_lat_mark(HOWDY_LAT_UPLINK);
+        t->sent++;
+    }
+    return NULL;
+}
+
+static uint32_t span_count(howdy_lat_span_t span, howdy_lat_summary_t *out)
+{
+    howdy_lat_summary_t s = {0};
+    howdy_lat_get_summary(span, &s);
+    if (out) {
+        *out = s;
+    }
+    return s.count;
+}
+
+int main(void)
+{
+    i2s_dma_capture_config_t config = {
+        .source = I2S_DMA_SOURCE_FAKE,
+        .dma_desc_num = DMA_BUFFERS,
+        .sample_rate = SAMPLE_RATE,
+        .frame_samples = FRAME_SAMPLES,
+    };
+    i2s_dma_capture_handle_t cap = NULL;
+    CHECK(i2s_dma_capture_create(&config, &cap) == ESP_OK, "create");
+    if (!cap) {
+        return 1;
+    }
+
+    trace_test_t t = {
+        .analysis = audio_frame_ring_create(sizeof(trace_frame_t), CAPTURE_FRAMES),
+        .transport = audio_frame_ring_create(sizeof(trace_frame_t), CAPTURE_FRAMES),
+    };
+    atomic_init(&t.capture_done, false);
+    howdy_lat_reset();
+
+    pthread_t analysis, sender;
+    pthread_create(&analysis, NULL, analysis_main, &t);
+    pthread_create(&sender, NULL, send_main, &t);
+
+    // The streaming task: stamp from the descriptor, then run the app callback
+    i2s_dma_capture_subscribe(cap, NULL);
+    CHECK(i2s_dma_capture_start(cap) == ESP_OK, "start");
+    for (uint32_t i = 0; i < CAPTURE_FRAMES; i++) {
+        i2s_dma_frame_t dma;
+        if (i2s_dma_capture_acquire(cap, &dma, 200) != ESP_OK) {
+            CHECK(false, "no frame %u", i);
+            break;
+        }
+        howdy_lat_mark_at(HOWDY_LAT_I2S_DMA, dma.timestamp_us);
+
+        trace_frame_t frame = { .seq = i, .captured_us = howdy_lat_last(HOWDY_LAT_I2S_DMA) };
+        CHECK(frame.captured_us == dma.timestamp_us, "frame %u: DMA stamp not carried", i);
+        audio_frame_ring_push(t.transport, &frame, sizeof(frame));
+        audio_frame_ring_push(t.analysis, &frame, sizeof(frame));
+        i2s_dma_capture_release(cap, &dma);
+    }
+    i2s_dma_capture_stop(cap);
+    atomic_store(&t.capture_done, true);
+    pthread_join(analysis, NULL);
+    pthread_join(sender, NULL);
+
+    CHECK(t.analysed == CAPTURE_FRAMES && t.sent == CAPTURE_FRAMES,
+          "analysed %u, sent %u of %u", t.analysed, t.sent, CAPTURE_FRAMES);
+    CHECK(t.zero_stamps == 0, "%u frames reached VAD without a DMA stamp", t.zero_stamps);
+
+    howdy_lat_summary_t vad;
+    CHECK(span_count(HOWDY_LAT_SPAN_CAPTURE_TO_VAD, &vad) == CAPTURE_FRAMES,
+          "capture_to_vad count %u", vad.count);
+
+    howdy_lat_counters_t counters;
+    howdy_lat_get_counters(&counters);
+    CHECK(counters.in_progress == 1, "wake did not open an utterance");
+
+    // Reply audio: a write before anything was popped must not close the utterance
+    sleep_ms(5);
+    howdy_lat_mark(HOWDY_LAT_TTS_CHUNK);
+    howdy_lat_mark(HOWDY_LAT_I2S_WRITE);
+    CHECK(span_count(HOWDY_LAT_SPAN_WAKE_TO_AUDIO, NULL) == 0, "closed before playout");
+    howdy_lat_mark(HOWDY_LAT_PLAYOUT_POP);
+    howdy_lat_mark(HOWDY_LAT_I2S_WRITE);
+
+    howdy_lat_get_counters(&counters);
+    howdy_lat_summary_t wake_to_audio;
+    CHECK(counters.completed == 1 && counters.in_progress == 0 && counters.abandoned == 0,
+          "completed %u, in progress %u, abandoned %u",
+          counters.completed, counters.in_progress, counters.abandoned);
+    CHECK(span_count(HOWDY_LAT_SPAN_WAKE_TO_AUDIO, &wake_to_audio) == 1, "wake_to_audio count %u",
+          wake_to_audio.count);
+    CHECK(span_count(HOWDY_LAT_SPAN_VAD_TO_WAKE, NULL) == 1, "vad_to_wake not recorded");
+    CHECK(span_count(HOWDY_LAT_SPAN_WAKE_TO_UPLINK, NULL) == 1, "wake_to_uplink not recorded");
+    CHECK(span_count(HOWDY_LAT_SPAN_WAKE_TO_TTS, NULL) == 1, "wake_to_tts not recorded");
+
+    printf("latency trace: %u frames, capture_to_vad p50 %u us, wake_to_audio %u us, "
+           "%u completed\n", vad.count, vad.p50_us, wake_to_audio.max_us, counters.completed);
+
+    i2s_dma_capture_destroy(cap);
+    audio_frame_ring_destroy(t.analysis);
+    audio_frame_ring_destroy(t.transport);
+
+    return host_check_status();
+}
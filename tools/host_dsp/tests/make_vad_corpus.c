@@ -0,0 +1,175 @@
+/*
+ * Writes a small synthetic corpus for vad_corpus: voiced "speech" bursts
+ * (harmonics of a gliding pitch under a syllable envelope) over a low noise
+ * floor, with Audacity-style labels next to each WAV.
+ *
+ *   speech/talk_01.wav       two labelled phrases
+ *   speech/talk_stereo.wav   the same in two channels (first channel is read)
+ *   speech/quiet_01.wav      a phrase at a sixth of the level
+ *   noise/fan_01.wav         broadband noise, no labels
+ *   wake/hey_howdy_01.wav    a short phrase labelled as a wake phrase, then the
+ *                            silence the detector waits for before deciding
+ *   wake/hey_howdy_02.wav    two of them, louder, over a higher noise floor
+ *   tts_echo/reply_01.wav    a phrase labelled as TTS playback
+ *   rate/phone_8k.wav        8 kHz, which vad_corpus must skip
+ *
+ * This is not a stand-in for real recordings; it only gives the scorer's
+ * file, label and category handling something to run on in ctest.
+ *
+ * usage: make_vad_corpus <output dir>
+ */
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define RATE        16000
+
+typedef struct {
+    double start_s;
+    double end_s;
+    double level;                   // Peak amplitude of the voiced signal
+} phrase_t;
+
+static uint32_t s_rng = 0x2545f491u;
+
+static double noise(void)
+{
+    s_rng = s_rng * 1664525u + 1013904223u;
+    return ((double)(s_rng >> 8) / (double)(1u << 24)) * 2.0 - 1.0;
+}
+
+static int make_dir(const char *path)
+{
+    if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+static void put_u16(FILE *f, uint16_t v)
+{
+    fputc(v & 0xFF, f);
+    fputc(v >> 8, f);
+}
+
+static void put_u32(FILE *f, uint32_t v)
+{
+    put_u16(f, (uint16_t)(v & 0xFFFF));
+    put_u16(f, (uint16_t)(v >> 16));
+}
+
+static double voiced(double t, double start)
+{
+    // Pitch glides around 140 Hz; syllables at 4 Hz
+    double f0 = 140.0 + 20.0 * sin(2.0 * M_PI * 0.7 * (t - start));
+    double syllable = 0.55 + 0.45 * sin(2.0 * M_PI * 4.0 * (t - start));
+    double v = 0.0;
+    for (int h = 1; h <= 8; h++) {
+        v += sin(2.0 * M_PI * f0 * h * t) / h;
+    }
+    return v * syllable / 2.2;
+}
+
+static int write_wav(const char *dir, const char *name, uint32_t rate, uint16_t channels,
+                     double seconds, double floor_level, const phrase_t *phrases, size_t count,
+                     const char *label)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.wav", dir, name);
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    uint32_t frames = (uint32_t)(seconds * rate);
+    uint32_t data_bytes = frames * channels * 2;
+    fwrite("RIFF", 1, 4, f);
+    put_u32(f, 36 + data_bytes);
+    fwrite("WAVEfmt ", 1, 8, f);
+    put_u32(f, 16);
+    put_u16(f, 1);
+    put_u16(f, channels);
+    put_u32(f, rate);
+    put_u32(f, rate * channels * 2);
+    put_u16(f, channels * 2);
+    put_u16(f, 16);
+    fwrite("data", 1, 4, f);
+    put_u32(f, data_bytes);
+
+    for (uint32_t i = 0; i < frames; i++) {
+        double t = (double)i / rate;
+        double v = floor_level * noise();
+        for (size_t p = 0; p < count; p++) {
+            if (t >= phrases[p].start_s && t < phrases[p].end_s) {
+                v += phrases[p].level * voiced(t, phrases[p].start_s);
+            }
+        }
+        int16_t s = (int16_t)fmax(-32768.0, fmin(32767.0, v));
+        for (uint16_t c = 0; c < channels; c++) {
+            put_u16(f, (uint16_t)(c == 0 ? s : s / 2));
+        }
+    }
+    fclose(f);
+
+    if (label && count) {
+        snprintf(path, sizeof(path), "%s/%s.txt", dir, name);
+        f = fopen(path, "w");
+        if (!f) {
+            perror(path);
+            return -1;
+        }
+        for (size_t p = 0; p < count; p++) {
+            fprintf(f, "%.3f\t%.3f\t%s\n", phrases[p].start_s, phrases[p].end_s, label);
+        }
+        fclose(f);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output dir>\n", argv[0]);
+        return 2;
+    }
+
+    const char *root = argv[1];
+    static const char *const dirs[] = { "speech", "noise", "tts_echo", "rate", "wake" };
+    char dir[5][512];
+    if (make_dir(root) != 0) {
+        return 1;
+    }
+    for (int i = 0; i < 5; i++) {
+        snprintf(dir[i], sizeof(dir[i]), "%s/%s", root, dirs[i]);
+        if (make_dir(dir[i]) != 0) {
+            return 1;
+        }
+    }
+
+    const phrase_t talk[] = { { 1.0, 3.0, 9000 }, { 4.0, 5.5, 9000 } };
+    const phrase_t quiet[] = { { 1.0, 3.0, 1500 } };
+    const phrase_t reply[] = { { 0.5, 3.5, 5000 } };
+    const phrase_t wake[] = { { 1.0, 1.7, 9000 } };
+    const phrase_t wake_twice[] = { { 1.0, 1.7, 12000 }, { 5.0, 5.6, 12000 } };
+
+    int err = 0;
+    err |= write_wav(dir[0], "talk_01", RATE, 1, 6.0, 60, talk, 2, "speech");
+    err |= write_wav(dir[0], "talk_stereo", RATE, 2, 6.0, 60, talk, 2, "speech");
+    err |= write_wav(dir[0], "quiet_01", RATE, 1, 4.0, 60, quiet, 1, "speech");
+    err |= write_wav(dir[1], "fan_01", RATE, 1, 4.0, 700, NULL, 0, NULL);
+    err |= write_wav(dir[2], "reply_01", RATE, 1, 4.0, 60, reply, 1, "tts");
+    err |= write_wav(dir[4], "hey_howdy_01", RATE, 1, 4.5, 60, wake, 1, "wake");
+    err |= write_wav(dir[4], "hey_howdy_02", RATE, 1, 8.5, 300, wake_twice, 2, "wake");
+    err |= write_wav(dir[3], "phone_8k", 8000, 1, 2.0, 60, talk, 1, "speech");
+    if (err) {
+        return 1;
+    }
+    printf("synthetic corpus written to %s\n", root);
+    return 0;
+}
@@ -0,0 +1,216 @@
+/*
+ * Packet loss concealment through the TTS jitter buffer, as the playback
+ * task drives it: a 200 Hz tone is pushed a frame at a time and frames are
+ * dropped by popping with nothing queued.
+ *
+ * Checks that real frames pass through untouched, that the first concealed
+ * frame continues the tone from the last played sample with no step, that
+ * concealment holds full level for 10 ms and then stays under the linear
+ * fade to silence at 60 ms, that recovery crossfades without a step, and the
+ * counters: a gap real audio resumes after is counted as silence, the idle
+ * time after a reply is not.
+ */
+#include "tts_jitter_buffer.h"
+#include "host_check.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SAMPLE_RATE         16000
+#define FRAME_SAMPLES       320
+#define TONE_HZ             200
+#define TONE_AMPLITUDE      8000
+#define HOLD_SAMPLES        (SAMPLE_RATE / 100)
+#define FADE_END_SAMPLES    (SAMPLE_RATE * 60 / 1000)
+
+// Largest sample-to-sample change of the tone, plus rounding
+#define TONE_MAX_STEP       ((int)(2 * M_PI * TONE_HZ / SAMPLE_RATE * TONE_AMPLITUDE) + 2)
+
+static tts_jitter_buffer_t *s_jb;
+static uint32_t s_tone_pos;         // Next sample of the tone to push
+static int16_t s_last_out;          // Last sample played
+
+static int16_t tone(uint32_t n)
+{
+    return (int16_t)lrint(TONE_AMPLITUDE * sin(2 * M_PI * TONE_HZ * n / SAMPLE_RATE));
+}
+
+static void push_tone(int frames)
+{
+    int16_t frame[FRAME_SAMPLES];
+    for (int f = 0; f < frames; f++) {
+        for (int i = 0; i < FRAME_SAMPLES; i++) {
+            frame[i] = tone(s_tone_pos++);
+        }
+        tts_jb_push(s_jb, frame, FRAME_SAMPLES);
+    }
+}
+
+// Pops one frame; returns the largest step between consecutive samples played
+static int pop(int16_t *out, bool *underrun)
+{
+    tts_jb_pop_frame(s_jb, out, underrun);
+    int step = abs(out[0] - s_last_out);
+    for (int i = 1; i < FRAME_SAMPLES; i++) {
+        int d = abs(out[i] - out[i - 1]);
+        step = d > step ? d : step;
+    }
+    s_last_out = out[FRAME_SAMPLES - 1];
+    return step;
+}
+
+static tts_plc_stats_t stats(void)
+{
+    tts_plc_stats_t st;
+    CHECK(tts_jb_get_plc_stats(s_jb, &st), "PLC stats");
+    return st;
+}
+
+// Ten real frames: played as pushed
+static void check_passthrough(void)
+{
+    int16_t out[FRAME_SAMPLES];
+    bool underrun;
+    for (int f = 0; f < 10; f++) {
+        uint32_t start = s_tone_pos;
+        push_tone(1);
+        pop(out, &underrun);
+        CHECK(!underrun, "frame %d: underrun with audio queued", f);
+        int diff = 0;
+        // The first frame fades in over 4 ms from the underrun before it
+        for (int i = f == 0 ? SAMPLE_RATE / 250 : 0; i < FRAME_SAMPLES; i++) {
+            diff += out[i] != tone(start + i);
+        }
+        CHECK(diff == 0, "frame %d: %d samples changed", f, diff);
+    }
+}
+
+// A long loss: tone continued, held, faded out by 60 ms, then silence
+static void check_loss_and_fade(void)
+{
+    int16_t out[FRAME_SAMPLES];
+    bool underrun;
+    tts_plc_stats_t before = stats();
+    uint32_t n = s_tone_pos;         // Where the tone would have continued
+    int peak[3] = {0};
+
+    for (int f = 0; f < 3; f++) {
+        int step = pop(out, &underrun);
+        CHECK(underrun, "concealed frame %d not flagged as an underrun", f);
+        CHECK(step <= TONE_MAX_STEP, "concealed frame %d: step of %d", f, step);
+        for (int i = 0; i < FRAME_SAMPLES; i++, n++) {
+            int k = f * FRAME_SAMPLES + i;
+            int a = abs(out[i]);
+            peak[f] = a > peak[f] ? a : peak[f];
+            if (k < HOLD_SAMPLES) {
+                CHECK(abs(out[i] - tone(n)) <= TONE_AMPLITUDE / 50,
+                      "held sample %d is %d, tone is %d", k, out[i], tone(n));
+            } else {
+                double gain = (double)(FADE_END_SAMPLES - k) / (FADE_END_SAMPLES - HOLD_SAMPLES);
+                CHECK(a <= gain * TONE_AMPLITUDE + 2, "faded sample %d is %d, over gain %.2f", k, out[i], gain);
+            }
+        }
+    }
+    CHECK(peak[0] > TONE_AMPLITUDE * 9 / 10 && peak[1] < peak[0] && peak[2] < peak[1],
+          "fade peaks %d %d %d", peak[0], peak[1], peak[2]);
+    CHECK(abs(out[FRAME_SAMPLES - 1]) <= TONE_AMPLITUDE / 100, "still %d at 60 ms", out[FRAME_SAMPLES - 1]);
+
+    pop(out, &underrun);
+    int nonzero = 0;
+    for (int i = 0; i < FRAME_SAMPLES; i++) {
+        nonzero += out[i] != 0;
+    }
+    CHECK(underrun && nonzero == 0, "after the fade: %d samples not silent", nonzero);
+
+    tts_plc_stats_t st = stats();
+    CHECK(st.concealment_events == before.concealment_events + 1 &&
+          st.concealed_frames == before.concealed_frames + 3,
+          "events %u concealed %u", st.concealment_events - before.concealment_events,
+          st.concealed_frames - before.concealed_frames);
+    CHECK(st.last_pitch_samples % (SAMPLE_RATE / TONE_HZ) == 0, "pitch %u samples for a %d Hz tone",
+          st.last_pitch_samples, TONE_HZ);
+    CHECK(st.silence_frames == before.silence_frames, "silence counted before audio resumed");
+
+    // Audio resumes from silence: faded in, and the one silent frame counted as a gap
+    push_tone(1);
+    int step = pop(out, &underrun);
+    CHECK(!underrun && step <= TONE_MAX_STEP, "resume from silence: step of %d", step);
+    st = stats();
+    CHECK(st.silence_frames == before.silence_frames + 1, "silence frames %u, expected 1",
+          st.silence_frames - before.silence_frames);
+    CHECK(st.crossfades == before.crossfades, "crossfade counted when resuming from silence");
+}
+
+// One lost frame: the recovery blends into the real audio without a step
+static void check_short_loss(void)
+{
+    int16_t out[FRAME_SAMPLES];
+    bool underrun;
+    push_tone(3);
+    for (int f = 0; f < 3; f++) {
+        pop(out, &underrun);
+    }
+    tts_plc_stats_t before = stats();
+
+    int step = pop(out, &underrun);
+    CHECK(underrun && step <= TONE_MAX_STEP, "concealed: step of %d", step);
+    s_tone_pos += FRAME_SAMPLES;    // The lost frame never arrives
+    push_tone(1);
+    step = pop(out, &underrun);
+    CHECK(!underrun && step <= TONE_MAX_STEP, "recovery: step of %d", step);
+
+    tts_plc_stats_t st = stats();
+    CHECK(st.crossfades == before.crossfades + 1 && st.concealed_frames == before.concealed_frames + 1,
+          "crossfades %u concealed %u", st.crossfades - before.crossfades,
+          st.concealed_frames - before.concealed_frames);
+    CHECK(st.silence_frames == before.silence_frames, "silence counted for a concealed loss");
+}
+
+// Two seconds idle between replies is not a gap
+static void check_idle(void)
+{
+    int16_t out[FRAME_SAMPLES];
+    bool underrun;
+    tts_plc_stats_t before = stats();
+    for (int f = 0; f < 100; f++) {
+        pop(out, &underrun);
+    }
+    push_tone(2);
+    pop(out, &underrun);
+    pop(out, &underrun);
+    tts_plc_stats_t st = stats();
+    CHECK(st.silence_frames == before.silence_frames, "idle counted as %u silence frames",
+          st.silence_frames - before.silence_frames);
+    CHECK(st.concealment_events == before.concealment_events + 1, "reply tail not concealed once");
+}
+
+int main(void)
+{
+    s_jb = tts_jb_create(FRAME_SAMPLES, 6, 12);
+    CHECK(s_jb && tts_jb_enable_plc(s_jb, SAMPLE_RATE), "create");
+    if (!s_jb) {
+        return 1;
+    }
+
+    // Nothing played yet: silence, and not a gap
+    int16_t out[FRAME_SAMPLES];
+    bool underrun;
+    pop(out, &underrun);
+    CHECK(underrun && out[0] == 0 && out[FRAME_SAMPLES - 1] == 0, "underrun before any audio");
+
+    check_passthrough();
+    check_loss_and_fade();
+    check_short_loss();
+    check_idle();
+
+    tts_plc_stats_t st = stats();
+    tts_jb_destroy(s_jb);
+    if (host_check_status()) {
+        return 1;
+    }
+    printf("plc: %u events, %u concealed, %u silence, %u crossfades, pitch %u samples\n",
+           st.concealment_events, st.concealed_frames, st.silence_frames, st.crossfades,
+           st.last_pitch_samples);
+    return 0;
+}
@@ -0,0 +1,277 @@
+/*
+ * Multi-thread alloc/free test for howdy_memory_pool.
+ *
+ * Several pthreads take and return blocks of one small pool as fast as they
+ * can, each holding a random number at a time so the pool runs empty often.
+ * Every block handed out is claimed in a per-index owner table with an
+ * atomic exchange, so a block given to two threads at once is caught at
+ * the second claim. The owner also fills the block with its id and checks
+ * the fill before returning it, which catches a block recycled while still
+ * held. Afterwards the pool's hit, miss and free counters must equal the
+ * threads' own counts, and nothing may remain in use.
+ *
+ * A single-threaded pass then checks exhaustion, double frees, foreign
+ * pointers, damaged guard words and destroy with blocks outstanding.
+ *
+ * Build with -DHOWDY_HOST_TSAN=ON to also check the free list's memory
+ * orders.
+ */
+#include "howdy_memory_pool.h"
+#include "esp_heap_caps.h"
+#include "host_check.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOCK_SIZE          96
+#define BLOCK_COUNT         16
+#define MAX_THREADS         16
+#define MAX_HELD            6
+
+typedef struct {
+    howdy_pool_t *pool;
+    _Atomic uint32_t *owner;        // Per block index: 0 = free, else thread id + 1
+    uint32_t iterations;
+    atomic_uint double_handouts;
+    atomic_uint corruptions;
+} pool_test_t;
+
+typedef struct {
+    pool_test_t *t;
+    uint32_t id;
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t frees;
+    uint32_t bad_frees;
+} worker_t;
+
+static uint32_t lcg(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+static void release_block(worker_t *w, uint8_t *block)
+{
+    pool_test_t *t = w->t;
+    int idx = howdy_pool_index(t->pool, block);
+    uint8_t mark = (uint8_t)(w->id + 1);
+
+    for (size_t i = 0; i < BLOCK_SIZE; i++) {
+        if (block[i] != mark) {
+            atomic_fetch_add(&t->corruptions, 1);
+            break;
+        }
+    }
+    // Give up ownership before the pool can hand the block to someone else
+    uint32_t prev = atomic_exchange(&t->owner[idx], 0);
+    if (prev != w->id + 1) {
+        atomic_fetch_add(&t->double_handouts, 1);
+    }
+    if (howdy_pool_free(t->pool, block) == ESP_OK) {
+        w->frees++;
+    } else {
+        w->bad_frees++;
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    worker_t *w = (worker_t *)arg;
+    pool_test_t *t = w->t;
+    uint8_t *held[MAX_HELD];
+    size_t n_held = 0;
+    uint32_t rng = 0x9e3779b9u * (w->id + 1);
+
+    for (uint32_t it = 0; it < t->iterations; it++) {
+        size_t target = lcg(&rng) % (MAX_HELD + 1);
+
+        while (n_held < target) {
+            uint8_t *block = howdy_pool_alloc(t->pool);
+            if (!block) {
+                w->misses++;
+                break;
+            }
+            w->hits++;
+            int idx = howdy_pool_index(t->pool, block);
+            if (idx < 0 || idx >= BLOCK_COUNT) {
+                atomic_fetch_add(&t->corruptions, 1);
+                continue;
+            }
+            uint32_t prev = atomic_exchange(&t->owner[idx], w->id + 1);
+            if (prev != 0) {
+                atomic_fetch_add(&t->double_handouts, 1);
+            }
+            memset(block, w->id + 1, BLOCK_SIZE);
+            held[n_held++] = block;
+        }
+
+        while (n_held > target) {
+            // Return in a scrambled order so the free list gets shuffled
+            size_t pick = lcg(&rng) % n_held;
+            release_block(w, held[pick]);
+            held[pick] = held[--n_held];
+        }
+
+        if ((it & 63) == 0) {
+            sched_yield();
+        }
+    }
+
+    while (n_held) {
+        release_block(w, held[--n_held]);
+    }
+    return NULL;
+}
+
+static void stress(uint32_t threads, uint32_t iterations, bool canaries)
+{
+    howdy_pool_config_t cfg = {
+        .name = canaries ? "stress_guard" : "stress",
+        .block_size = BLOCK_SIZE,
+        .block_count = BLOCK_COUNT,
+        .caps = MALLOC_CAP_INTERNAL,
+        .canaries = canaries,
+    };
+    pool_test_t t = { .iterations = iterations };
+    CHECK(howdy_pool_create(&cfg, &t.pool) == ESP_OK, "pool_create");
+    if (!t.pool) {
+        return;
+    }
+    t.owner = calloc(BLOCK_COUNT, sizeof(*t.owner));
+    atomic_init(&t.double_handouts, 0);
+    atomic_init(&t.corruptions, 0);
+
+    pthread_t tids[MAX_THREADS];
+    worker_t workers[MAX_THREADS];
+    for (uint32_t i = 0; i < threads; i++) {
+        workers[i] = (worker_t){ .t = &t, .id = i };
+        pthread_create(&tids[i], NULL, worker_main, &workers[i]);
+    }
+
+    uint32_t hits = 0, misses = 0, frees = 0, bad_frees = 0;
+    for (uint32_t i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        hits += workers[i].hits;
+        misses += workers[i].misses;
+        frees += workers[i].frees;
+        bad_frees += workers[i].bad_frees;
+    }
+
+    howdy_pool_stats_t st;
+    howdy_pool_get_stats(t.pool, &st);
+    unsigned dup = atomic_load(&t.double_handouts);
+    unsigned bad = atomic_load(&t.corruptions);
+
+    CHECK(dup == 0, "%u blocks handed out twice", dup);
+    CHECK(bad == 0, "%u blocks changed while held", bad);
+    CHECK(bad_frees == 0, "%u frees rejected", bad_frees);
+    CHECK(st.hits == hits && st.misses == misses && st.frees == frees,
+          "stats hits=%u misses=%u frees=%u, threads counted %u/%u/%u",
+          st.hits, st.misses, st.frees, hits, misses, frees);
+    CHECK(hits == frees && st.in_use == 0, "in_use=%u after all frees", st.in_use);
+    CHECK(st.peak_in_use <= BLOCK_COUNT, "peak_in_use=%u", st.peak_in_use);
+    CHECK(st.canary_errors == 0 && st.invalid_frees == 0,
+          "canary_errors=%u invalid_frees=%u", st.canary_errors, st.invalid_frees);
+    CHECK(howdy_pool_destroy(t.pool) == ESP_OK, "destroy");
+    free((void *)t.owner);
+
+    printf("stress %-12s %u threads x %u iterations: %u allocs, %u misses, peak %u/%u, "
+           "%u double handouts, %u corruptions\n",
+           cfg.name, threads, iterations, hits, misses, st.peak_in_use, BLOCK_COUNT, dup, bad);
+}
+
+static void misuse(void)
+{
+    howdy_pool_config_t cfg = {
+        .name = "misuse",
+        .block_size = 40,
+        .block_count = 4,
+        .caps = MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL,
+        .canaries = true,
+    };
+    howdy_pool_t *pool = NULL;
+    CHECK(howdy_pool_create(&cfg, &pool) == ESP_OK, "pool_create");
+    if (!pool) {
+        return;
+    }
+
+    uint8_t *blocks[4];
+    for (int i = 0; i < 4; i++) {
+        blocks[i] = howdy_pool_alloc(pool);
+        CHECK(blocks[i] != NULL, "alloc %d", i);
+        CHECK(howdy_pool_index(pool, blocks[i]) == i, "index of block %d", i);
+    }
+    CHECK(howdy_pool_alloc(pool) == NULL, "alloc from an empty pool");
+    CHECK(howdy_pool_destroy(pool) == ESP_ERR_INVALID_STATE, "destroy with blocks in use");
+
+    uint8_t local[40];
+    CHECK(howdy_pool_free(pool, local) == ESP_ERR_INVALID_ARG, "foreign pointer");
+    CHECK(howdy_pool_free(pool, blocks[1] + 1) == ESP_ERR_INVALID_ARG, "interior pointer");
+
+    CHECK(howdy_pool_free(pool, blocks[0]) == ESP_OK, "free");
+    CHECK(howdy_pool_free(pool, blocks[0]) == ESP_ERR_INVALID_STATE, "double free");
+
+    blocks[2][cfg.block_size] ^= 0xFF;      // One byte past the end
+    CHECK(howdy_pool_check(pool) == 1, "check finds the damaged block");
+    CHECK(howdy_pool_free(pool, blocks[2]) == ESP_ERR_INVALID_CRC, "damaged guard");
+    CHECK(howdy_pool_free(pool, blocks[1]) == ESP_OK, "free");
+    CHECK(howdy_pool_free(pool, blocks[3]) == ESP_OK, "free");
+
+    howdy_pool_stats_t st;
+    howdy_pool_get_stats(pool, &st);
+    CHECK(st.in_use == 0 && st.hits == 4 && st.frees == 4 && st.misses == 1,
+          "stats in_use=%u hits=%u frees=%u misses=%u", st.in_use, st.hits, st.frees, st.misses);
+    CHECK(st.invalid_frees == 3 && st.canary_errors == 1,
+          "invalid_frees=%u canary_errors=%u", st.invalid_frees, st.canary_errors);
+
+    // The damaged block is still recycled, with fresh guard words
+    uint8_t *again[4];
+    for (int i = 0; i < 4; i++) {
+        again[i] = howdy_pool_alloc(pool);
+        CHECK(again[i] && ((uintptr_t)again[i] % 8) == 0, "realloc %d", i);
+    }
+    CHECK(howdy_pool_check(pool) == 0, "guards rewritten on alloc");
+    for (int i = 0; i < 4; i++) {
+        howdy_pool_free(pool, again[i]);
+    }
+    CHECK(howdy_pool_destroy(pool) == ESP_OK, "destroy");
+    printf("misuse: exhaustion, foreign/interior/double frees and guard damage detected\n");
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--threads N] [--iterations N]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t threads = 4;
+    uint32_t iterations = 100000;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (threads == 0 || threads > MAX_THREADS || iterations == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    stress(threads, iterations, false);
+    stress(threads, iterations, true);
+    misuse();
+
+    return host_check_status();
+}
@@ -0,0 +1,293 @@
+/*
+ * Two-thread stress test and throughput benchmark for audio_frame_ring.
+ *
+ * A producer pthread publishes numbered frames, mixing single pushes with
+ * batched claim/commit, and drops (and counts) whatever does not fit. A
+ * consumer pthread drains with peek/release and checks that every frame it
+ * sees carries the next expected sequence number or a later one, that its
+ * length and payload are intact, and that the gaps add up to exactly the
+ * producer's drops. The consumer stalls now and then so the full-ring path
+ * is exercised too. Finally the ring stats must agree with both sides.
+ *
+ * --throughput then times producer and consumer running flat out, for
+ * single-frame and batched handoffs; there the producer waits for space
+ * instead of dropping, so every frame is delivered.
+ *
+ * Exits 1 on any ordering, payload or accounting error.
+ */
+#include "audio_frame_ring.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define FRAME_BYTES         640                     // 20 ms at 16 kHz mono
+#define RING_FRAMES         16
+#define MAX_BATCH           8
+
+typedef struct {
+    audio_frame_ring_t *ring;
+    uint32_t frames;                // Producer: frames to offer
+    size_t batch;                   // 0 = random 1..MAX_BATCH
+    bool stall;                     // Consumer: pause now and then
+    bool verify;                    // Number, size and check every frame; drop when full
+
+    atomic_bool producer_done;
+    uint32_t dropped;               // Producer: frames not stored
+    uint32_t received;              // Consumer
+    uint32_t gaps;                  // Consumer: sum of sequence gaps
+    uint32_t errors;                // Consumer
+} ring_test_t;
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint32_t lcg(uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// Length and payload are derived from the sequence number so the consumer can check them
+static uint32_t frame_len(uint32_t seq)
+{
+    return sizeof(uint32_t) + (seq * 37u) % (FRAME_BYTES - sizeof(uint32_t) + 1);
+}
+
+static void fill_frame(uint8_t *slot, uint32_t seq, uint32_t len)
+{
+    memcpy(slot, &seq, sizeof(seq));
+    for (uint32_t i = sizeof(seq); i < len; i++) {
+        slot[i] = (uint8_t)(seq * 31u + i);
+    }
+}
+
+static bool check_frame(const uint8_t *slot, uint32_t len, uint32_t *seq_out)
+{
+    uint32_t seq;
+    if (len < sizeof(seq)) {
+        return false;
+    }
+    memcpy(&seq, slot, sizeof(seq));
+    *seq_out = seq;
+    if (len != frame_len(seq)) {
+        return false;
+    }
+    for (uint32_t i = sizeof(seq); i < len; i++) {
+        if (slot[i] != (uint8_t)(seq * 31u + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *producer_main(void *arg)
+{
+    ring_test_t *t = (ring_test_t *)arg;
+    uint32_t rng = 0x1234u;
+    uint32_t seq = 0;
+
+    while (seq < t->frames) {
+        size_t want = t->batch ? t->batch : 1 + lcg(&rng) % MAX_BATCH;
+        if (want > t->frames - seq) {
+            want = t->frames - seq;
+        }
+
+        if (want == 1 && (!t->verify || (lcg(&rng) & 1))) {
+            static const uint8_t blank[FRAME_BYTES];
+            uint8_t frame[FRAME_BYTES];
+            uint32_t len = t->verify ? frame_len(seq) : FRAME_BYTES;
+            if (t->verify) {
+                fill_frame(frame, seq, len);
+            }
+            if (audio_frame_ring_push(t->ring, t->verify ? frame : blank, len)) {
+                seq++;
+            } else if (t->verify) {
+                t->dropped++;
+                seq++;
+            } else {
+                sched_yield();
+            }
+            continue;
+        }
+
+        audio_frame_span_t span;
+        size_t got = audio_frame_ring_claim(t->ring, want, &span);
+        for (size_t i = 0; i < got; i++) {
+            uint32_t len = t->verify ? frame_len(seq + i) : FRAME_BYTES;
+            if (t->verify) {
+                fill_frame(span.data + i * span.stride, seq + (uint32_t)i, len);
+            }
+            span.lengths[i] = len;
+        }
+        audio_frame_ring_commit(t->ring, got);
+        seq += got;
+
+        // Full: drop one frame like udp_audio_send does, or wait when timing
+        if (got == 0) {
+            if (t->verify) {
+                audio_frame_ring_note_overrun(t->ring, 1);
+                t->dropped++;
+                seq++;
+            }
+            sched_yield();
+        }
+    }
+
+    atomic_store_explicit(&t->producer_done, true, memory_order_release);
+    return NULL;
+}
+
+static void *consumer_main(void *arg)
+{
+    ring_test_t *t = (ring_test_t *)arg;
+    uint32_t rng = 0x5678u;
+    uint32_t expected = 0;
+
+    for (;;) {
+        bool done = atomic_load_explicit(&t->producer_done, memory_order_acquire);
+        audio_frame_span_t span;
+        size_t batch = t->batch ? t->batch : 1 + lcg(&rng) % MAX_BATCH;
+        size_t got = audio_frame_ring_peek(t->ring, batch, &span);
+        if (got == 0) {
+            if (done && audio_frame_ring_count(t->ring) == 0) {
+                break;
+            }
+            sched_yield();
+            continue;
+        }
+
+        for (size_t i = 0; t->verify && i < got; i++) {
+            uint32_t seq = 0;
+            if (!check_frame(span.data + i * span.stride, span.lengths[i], &seq) || seq < expected) {
+                if (t->errors++ < 5) {
+                    fprintf(stderr, "frame %u: bad payload or order (expected >= %u, len %u)\n",
+                            seq, expected, span.lengths[i]);
+                }
+                continue;
+            }
+            t->gaps += seq - expected;
+            expected = seq + 1;
+        }
+        audio_frame_ring_release(t->ring, got);
+        t->received += got;
+
+        // Fall behind once in a while so the producer sees a full ring
+        if (t->stall && lcg(&rng) % 512 == 0) {
+            struct timespec pause = { .tv_sec = 0, .tv_nsec = 200000 };
+            nanosleep(&pause, NULL);
+        }
+    }
+
+    // Frames dropped after the last one received
+    if (t->verify) {
+        t->gaps += t->frames - expected;
+    }
+    return NULL;
+}
+
+static double run_pair(ring_test_t *t)
+{
+    pthread_t producer, consumer;
+    int64_t start = now_ns();
+    pthread_create(&consumer, NULL, consumer_main, t);
+    pthread_create(&producer, NULL, producer_main, t);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    return (double)(now_ns() - start);
+}
+
+static bool stress(uint32_t frames)
+{
+    ring_test_t t = {
+        .ring = audio_frame_ring_create(FRAME_BYTES, RING_FRAMES),
+        .frames = frames,
+        .stall = true,
+        .verify = true,
+    };
+    if (!t.ring) {
+        fprintf(stderr, "ring_create failed\n");
+        return false;
+    }
+    atomic_init(&t.producer_done, false);
+    run_pair(&t);
+
+    audio_frame_ring_stats_t st;
+    audio_frame_ring_get_stats(t.ring, &st);
+    audio_frame_ring_destroy(t.ring);
+
+    bool ok = t.errors == 0 &&
+              t.received + t.dropped == frames &&
+              t.gaps == t.dropped &&
+              st.overruns == t.dropped &&
+              st.frames_committed == t.received &&
+              st.frames_released == t.received &&
+              st.high_water <= st.capacity;
+
+    printf("stress     %u frames: %u received, %u dropped, %u gaps, %u errors; "
+           "ring committed=%u released=%u overruns=%u high_water=%u/%zu  %s\n",
+           frames, t.received, t.dropped, t.gaps, t.errors,
+           st.frames_committed, st.frames_released, st.overruns, st.high_water, st.capacity,
+           ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static void throughput(uint32_t frames, size_t batch)
+{
+    ring_test_t t = {
+        .ring = audio_frame_ring_create(FRAME_BYTES, RING_FRAMES),
+        .frames = frames,
+        .batch = batch,
+    };
+    if (!t.ring) {
+        return;
+    }
+    atomic_init(&t.producer_done, false);
+    double ns = run_pair(&t);
+    audio_frame_ring_destroy(t.ring);
+
+    double fps = t.received / ns * 1e9;
+    printf("throughput batch %zu: %10.0f frames/s %8.1f MB/s  %6.1f ns/frame\n",
+           batch, fps, fps * FRAME_BYTES / 1e6, ns / frames);
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--frames N] [--throughput]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frames = 200000;
+    bool bench = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--throughput") == 0) {
+            bench = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (frames == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    bool ok = stress(frames);
+    if (bench) {
+        throughput(frames * 5, 1);
+        throughput(frames * 5, MAX_BATCH);
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/*
+ * Coverage map for ui_round_display: registers an 800x800 LVGL display with
+ * a partial draw buffer, hooks it with ui_round_display_init(), invalidates
+ * sets of areas and runs the display's refresh timer callback directly (the
+ * round clip wraps it; lv_refr_now() would bypass the hook). The flush
+ * callback counts how often each pixel is sent.
+ *
+ * Every pixel of a requested area whose centre lies inside the circle must
+ * be flushed. Checks that a full-screen redraw is split into bands and sends
+ * fewer pixels, that an area inside the circle is left alone, that a corner
+ * area is dropped without a refresh, and that a full invalidation buffer of
+ * edge areas still fits, with no pixel sent twice.
+ */
+#include "lvgl.h"
+#include "ui_round_display.h"
+#include "host_check.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HRES                800
+#define VRES                800
+#define BUF_LINES           40
+
+typedef struct {
+    uint32_t flushed;               // Pixels sent, counting repeats
+    uint32_t missing;               // Visible requested pixels never sent
+    uint8_t max_repeat;             // Most times one pixel was sent
+} coverage_t;
+
+static uint8_t s_cover[HRES * VRES];
+static uint32_t s_flushed;
+
+static void flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *px)
+{
+    (void)px;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        for (int32_t x = area->x1; x <= area->x2; x++) {
+            s_cover[y * HRES + x]++;
+        }
+    }
+    s_flushed += lv_area_get_size(area);
+    lv_disp_flush_ready(drv);
+}
+
+static bool visible(int32_t x, int32_t y)
+{
+    const double c = HRES / 2.0;
+    double dx = x + 0.5 - c, dy = y + 0.5 - c;
+    return dx * dx + dy * dy <= c * c;
+}
+
+static coverage_t refresh(lv_disp_t *disp, const lv_area_t *areas, int count)
+{
+    memset(s_cover, 0, sizeof(s_cover));
+    s_flushed = 0;
+    for (int i = 0; i < count; i++) {
+        _lv_inv_area(disp, &areas[i]);
+    }
+    disp->refr_timer->timer_cb(disp->refr_timer);
+
+    coverage_t cov = { .flushed = s_flushed };
+    for (int i = 0; i < count; i++) {
+        for (int32_t y = LV_MAX(areas[i].y1, 0); y <= LV_MIN(areas[i].y2, VRES - 1); y++) {
+            for (int32_t x = LV_MAX(areas[i].x1, 0); x <= LV_MIN(areas[i].x2, HRES - 1); x++) {
+                if (visible(x, y) && s_cover[y * HRES + x] == 0) {
+                    cov.missing++;
+                    s_cover[y * HRES + x] = 0xFF;       // Count each pixel once
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < sizeof(s_cover); i++) {
+        if (s_cover[i] != 0xFF && s_cover[i] > cov.max_repeat) {
+            cov.max_repeat = s_cover[i];
+        }
+    }
+    return cov;
+}
+
+static lv_disp_t *display_init(void)
+{
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t drv;
+    static lv_color_t buf[HRES * BUF_LINES];
+
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, HRES * BUF_LINES);
+    lv_disp_drv_init(&drv);
+    drv.hor_res = HRES;
+    drv.ver_res = VRES;
+    drv.flush_cb = flush_cb;
+    drv.draw_buf = &draw_buf;
+    return lv_disp_drv_register(&drv);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_disp_t *disp = display_init();
+    CHECK(disp != NULL, "display init");
+    if (!disp) {
+        return 1;
+    }
+    CHECK(ui_round_display_init(disp) == ESP_OK, "round display init");
+
+    ui_round_display_stats_t st, prev;
+
+    // Whole screen: bands, nothing visible lost
+    const lv_area_t full = { 0, 0, HRES - 1, VRES - 1 };
+    coverage_t cov = refresh(disp, &full, 1);
+    ui_round_display_get_stats(&st);
+    CHECK(cov.missing == 0, "full screen: %u visible pixels not flushed", cov.missing);
+    CHECK(cov.max_repeat == 1, "full screen: a pixel was flushed %u times", cov.max_repeat);
+    CHECK(st.areas_split == 1 && cov.flushed < HRES * VRES * 85 / 100,
+          "full screen: split %u, %u px flushed", st.areas_split, cov.flushed);
+    CHECK(st.refreshes == 1 && st.px_requested == HRES * VRES && st.px_rendered == cov.flushed,
+          "stats: refreshes %u requested %llu rendered %llu", st.refreshes,
+          (unsigned long long)st.px_requested, (unsigned long long)st.px_rendered);
+    CHECK(st.large_refreshes == 1, "large refreshes %u", st.large_refreshes);
+    printf("full screen: %u of %u px flushed\n", cov.flushed, HRES * VRES);
+
+    // Inside the circle: not worth splitting
+    prev = st;
+    const lv_area_t centre = { 300, 300, 499, 499 };
+    cov = refresh(disp, &centre, 1);
+    ui_round_display_get_stats(&st);
+    CHECK(cov.missing == 0 && cov.flushed == 200 * 200, "centre: %u missing, %u flushed",
+          cov.missing, cov.flushed);
+    CHECK(st.areas_split == prev.areas_split, "centre area was split");
+
+    // A corner nobody can see: dropped, no refresh at all
+    prev = st;
+    const lv_area_t corner = { 0, 0, 99, 99 };
+    cov = refresh(disp, &corner, 1);
+    ui_round_display_get_stats(&st);
+    CHECK(cov.flushed == 0, "corner: %u px flushed", cov.flushed);
+    CHECK(st.areas_dropped == prev.areas_dropped + 1 && st.refreshes == prev.refreshes,
+          "corner: dropped %u refreshes %u", st.areas_dropped, st.refreshes);
+
+    // A top strip crossing the edge, plus a corner in the same refresh
+    prev = st;
+    const lv_area_t strip[] = { { 0, 0, HRES - 1, 99 }, { HRES - 60, VRES - 60, HRES - 1, VRES - 1 } };
+    cov = refresh(disp, strip, 2);
+    ui_round_display_get_stats(&st);
+    CHECK(cov.missing == 0, "strip: %u visible pixels not flushed", cov.missing);
+    CHECK(cov.flushed < HRES * 100 / 2, "strip: %u px flushed", cov.flushed);
+    CHECK(st.areas_split == prev.areas_split + 1 && st.areas_dropped == prev.areas_dropped + 1,
+          "strip: split %u dropped %u", st.areas_split, st.areas_dropped);
+
+    // A full invalidation buffer of tiles: the bands must share the slots
+    lv_area_t tiles[LV_INV_BUF_SIZE];
+    const int cols = 4, rows = LV_INV_BUF_SIZE / 4;
+    for (int i = 0; i < LV_INV_BUF_SIZE; i++) {
+        lv_coord_t x = (lv_coord_t)(i % cols * (HRES / cols));
+        lv_coord_t y = (lv_coord_t)(i / cols * (VRES / rows));
+        tiles[i] = (lv_area_t){ x, y, x + HRES / cols - 1, y + VRES / rows - 1 };
+    }
+    cov = refresh(disp, tiles, LV_INV_BUF_SIZE);
+    CHECK(cov.missing == 0, "tiles: %u visible pixels not flushed", cov.missing);
+    CHECK(cov.max_repeat == 1, "tiles: a pixel was flushed %u times", cov.max_repeat);
+    CHECK(cov.flushed < HRES * VRES, "tiles: %u px flushed", cov.flushed);
+    printf("%d tiles: %u of %u px flushed\n", LV_INV_BUF_SIZE, cov.flushed, HRES * VRES);
+
+    if (host_check_status()) {
+        return 1;
+    }
+    printf("round clip: every visible pixel of every requested area flushed\n");
+    return 0;
+}
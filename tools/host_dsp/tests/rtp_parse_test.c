@@ -0,0 +1,169 @@
+/*
+ * rtp_session_parse_packet() on hostile datagrams. Each packet is parsed
+ * from a heap buffer of exactly its length, so under
+ * -DHOWDY_HOST_SANITIZE=ON any read or in-place byte swap past the end is
+ * reported by ASan.
+ *
+ * Checks a packet built by the session itself round-trips with its
+ * extensions. Checks that a full CSRC list with a padding count larger than
+ * the datagram is rejected, and the edges of the padding, CSRC and
+ * extension length checks. Then every truncation of a valid packet and
+ * random datagrams with the version bits set must either be rejected or
+ * yield samples that lie inside the datagram.
+ */
+#include "rtp_session.h"
+#include "host_check.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SAMPLES             160
+#define RANDOM_PACKETS      200000
+#define RANDOM_MAX_LEN      96
+
+static rtp_session_t *s_rx;
+
+// Parses a copy of exactly len bytes; checks accepted samples lie inside it
+static bool parse(const uint8_t *bytes, size_t len, rtp_packet_info_t *info)
+{
+    uint8_t *packet = malloc(len ? len : 1);
+    memcpy(packet, bytes, len);
+    rtp_packet_info_t local;
+    info = info ? info : &local;
+    bool ok = rtp_session_parse_packet(s_rx, packet, len, 0, info);
+    if (ok) {
+        const uint8_t *first = (const uint8_t *)info->samples;
+        CHECK(first >= packet + RTP_HEADER_SIZE && first + info->sample_count * 2 <= packet + len,
+              "%zu byte packet: %zu samples at offset %td", len, info->sample_count, first - packet);
+    }
+    free(packet);
+    return ok;
+}
+
+static uint32_t bad_packets(void)
+{
+    rtp_session_stats_t st;
+    rtp_session_get_stats(s_rx, &st);
+    return st.bad_packets;
+}
+
+static void check_round_trip(const uint8_t *packet, size_t len, const int16_t *samples)
+{
+    uint8_t *copy = malloc(len);
+    memcpy(copy, packet, len);
+    rtp_packet_info_t info;
+    CHECK(rtp_session_parse_packet(s_rx, copy, len, 0, &info), "built packet rejected");
+    CHECK(info.sample_count == SAMPLES && info.ssrc == 0x1234 && info.marker, "header: %zu samples",
+          info.sample_count);
+    CHECK(info.has_vad && info.vad.max_amplitude == 12000 && info.has_wake_word &&
+          info.wake_word.detection_id == 7, "extensions");
+    CHECK(info.sample_count == SAMPLES && memcmp(info.samples, samples, SAMPLES * 2) == 0,
+          "samples changed");
+    free(copy);
+}
+
+static void check_edges(void)
+{
+    uint8_t p[RTP_HEADER_SIZE + 15 * 4 + 8] = {0};
+
+    // Full CSRC list past a 20 byte datagram whose padding byte says 200
+    uint32_t before = bad_packets();
+    memset(p, 0, sizeof(p));
+    p[0] = 0x80 | 0x20 | 15;
+    p[19] = 200;
+    CHECK(!parse(p, 20, NULL), "CC=15 in 20 bytes with 200 bytes of padding accepted");
+    CHECK(bad_packets() == before + 1, "not counted as bad");
+
+    // CSRC list longer than the datagram, no padding
+    p[0] = 0x80 | 15;
+    CHECK(!parse(p, RTP_HEADER_SIZE + 14 * 4, NULL), "truncated CSRC list accepted");
+    CHECK(parse(p, RTP_HEADER_SIZE + 15 * 4, NULL), "full CSRC list, empty payload rejected");
+
+    // Padding: all of the payload is fine, one byte more is not, zero is invalid
+    p[0] = 0x80 | 0x20 | 1;
+    size_t len = RTP_HEADER_SIZE + 4 + 8;
+    p[len - 1] = 8;
+    CHECK(parse(p, len, NULL), "padding covering the payload rejected");
+    p[len - 1] = 9;
+    CHECK(!parse(p, len, NULL), "padding into the CSRC list accepted");
+    p[len - 1] = 0;
+    CHECK(!parse(p, len, NULL), "zero padding count accepted");
+
+    // Extension header that does not fit, and one whose length runs past the end
+    memset(p, 0, sizeof(p));
+    p[0] = 0x80 | 0x10;
+    CHECK(!parse(p, RTP_HEADER_SIZE + 2, NULL), "truncated extension header accepted");
+    p[RTP_HEADER_SIZE] = 0xBE;
+    p[RTP_HEADER_SIZE + 1] = 0xDE;
+    p[RTP_HEADER_SIZE + 3] = 2;     // 8 bytes of elements, only 4 present
+    CHECK(!parse(p, RTP_HEADER_SIZE + 8, NULL), "extension past the end accepted");
+    p[0] |= 0x20;                   // ... or past the start of the padding
+    p[RTP_HEADER_SIZE + 3] = 1;
+    p[RTP_HEADER_SIZE + 11] = 5;
+    CHECK(!parse(p, RTP_HEADER_SIZE + 12, NULL), "extension into the padding accepted");
+}
+
+static uint32_t next_random(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+int main(void)
+{
+    rtp_session_config_t config = { .ssrc = 0x1234, .clock_rate = 16000,
+                                    .payload_type = RTP_PAYLOAD_TYPE_L16, .cname = "host" };
+    rtp_session_t *tx = rtp_session_create(&config);
+    config.ssrc = 0x5678;
+    s_rx = rtp_session_create(&config);
+    CHECK(tx && s_rx, "create");
+    if (!tx || !s_rx) {
+        return 1;
+    }
+
+    int16_t samples[SAMPLES];
+    for (int i = 0; i < SAMPLES; i++) {
+        samples[i] = (int16_t)(i * 397 - 30000);
+    }
+    rtp_vad_ext_t vad = { .vad_flags = 1, .max_amplitude = 12000 };
+    rtp_wake_word_ext_t wake = { .detection_id = 7, .confidence = 200 };
+    uint8_t packet[512];
+    size_t len = rtp_session_build_packet(tx, samples, SAMPLES, &vad, &wake, true, packet, sizeof(packet));
+    CHECK(len > RTP_HEADER_SIZE + SAMPLES * 2, "build returned %zu", len);
+
+    check_round_trip(packet, len, samples);
+    check_edges();
+
+    // Every truncation of a valid packet
+    for (size_t n = 0; n < len; n++) {
+        parse(packet, n, NULL);
+    }
+
+    // Random datagrams that pass the version check
+    uint32_t seed = 0x9E3779B9, accepted = 0;
+    uint8_t junk[RANDOM_MAX_LEN];
+    for (int i = 0; i < RANDOM_PACKETS; i++) {
+        size_t n = next_random(&seed) % (RANDOM_MAX_LEN + 1);
+        for (size_t b = 0; b < n; b++) {
+            junk[b] = (uint8_t)next_random(&seed);
+        }
+        if (n > 0) {
+            junk[0] = (junk[0] & 0x3F) | 0x80;
+        }
+        if (n > 1) {
+            junk[1] &= 0x7F;        // Keep clear of the RTCP range
+        }
+        accepted += parse(junk, n, NULL);
+    }
+
+    rtp_session_destroy(tx);
+    rtp_session_destroy(s_rx);
+    if (host_check_status()) {
+        return 1;
+    }
+    printf("rtp parse: %d random datagrams, %u accepted, no access outside the packet\n",
+           RANDOM_PACKETS, accepted);
+    return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * Drives howdy_sched_monitor on the shim's virtual clock, so every wake and
+ * every work time is exact, and checks what it records: jitter, overruns,
+ * deadline misses counted per missed period, the streak reset after a late
+ * wake, idle gaps not counted, a non-blocking xTaskDelayUntil counted as a
+ * miss, re-registration clearing a slot, slot exhaustion, and the summary.
+ */
+#include "howdy_sched_monitor.h"
+#include "host_shim.h"
+#include "freertos/task.h"
+#include "host_check.h"
+#include <stdio.h>
+#include <string.h>
+
+#define PERIOD_US           20000
+
+static void cycle(howdy_sched_handle_t h, int64_t wake_us, uint32_t work_us)
+{
+    host_shim_set_time_us(wake_us);
+    howdy_sched_wake(h);
+    host_shim_set_time_us(wake_us + work_us);
+    howdy_sched_done(h);
+}
+
+static howdy_sched_periodic_stats_t stats_of(const char *name)
+{
+    howdy_sched_periodic_stats_t all[HOWDY_SCHED_MAX_PERIODIC];
+    howdy_sched_periodic_stats_t none = {0};
+    size_t n = howdy_sched_get_periodic(all, HOWDY_SCHED_MAX_PERIODIC);
+    for (size_t i = 0; i < n; i++) {
+        if (strcmp(all[i].name, name) == 0) {
+            return all[i];
+        }
+    }
+    return none;
+}
+
+int main(void)
+{
+    host_shim_set_time_us(1);
+    howdy_sched_handle_t capture = howdy_sched_register("capture", PERIOD_US);
+    CHECK(capture != NULL, "register");
+
+    // On time, then 1 ms late
+    cycle(capture, 1000, 5000);
+    cycle(capture, 21000, 5000);
+    cycle(capture, 41000, 5000);
+    cycle(capture, 62000, 1000);
+    howdy_sched_periodic_stats_t st = stats_of("capture");
+    CHECK(st.cycles == 4 && st.misses == 0, "cycles %u misses %u", st.cycles, st.misses);
+    CHECK(st.jitter_max_us == 1000, "jitter_max %u", st.jitter_max_us);
+    CHECK(st.work_max_us == 5000 && st.overruns == 0, "work_max %u overruns %u",
+          st.work_max_us, st.overruns);
+
+    // 50 ms gap: two periods missed
+    cycle(capture, 112000, 1000);
+    st = stats_of("capture");
+    CHECK(st.misses == 2 && st.consecutive_misses == 2 && st.max_consecutive_misses == 2,
+          "misses %u consecutive %u max %u", st.misses, st.consecutive_misses,
+          st.max_consecutive_misses);
+
+    // Back on cadence: the streak ends, and the short interval is not jitter
+    cycle(capture, 132000, 25000);
+    st = stats_of("capture");
+    CHECK(st.consecutive_misses == 0 && st.jitter_max_us == 1000,
+          "consecutive %u jitter_max %u", st.consecutive_misses, st.jitter_max_us);
+    CHECK(st.overruns == 1 && st.work_max_us == 25000, "overruns %u work_max %u",
+          st.overruns, st.work_max_us);
+
+    // Idle between replies is not a miss
+    howdy_sched_idle(capture);
+    cycle(capture, 10000000, 1000);
+    st = stats_of("capture");
+    CHECK(st.cycles == 7 && st.misses == 2, "after idle: cycles %u misses %u", st.cycles, st.misses);
+
+    // xTaskDelayUntil that had nothing to wait for is a miss even on cadence
+    howdy_sched_handle_t playback = howdy_sched_register("playback", PERIOD_US);
+    TickType_t last = 20000 - 40;
+    host_shim_set_time_us(20000000);
+    howdy_sched_delay_until(playback, &last, PERIOD_US / 1000);
+    host_shim_set_time_us(20020000);
+    howdy_sched_delay_until(playback, &last, PERIOD_US / 1000);
+    st = stats_of("playback");
+    CHECK(last == 20000, "last wake %u", (unsigned)last);
+    CHECK(st.cycles == 2 && st.misses == 1, "delay_until: cycles %u misses %u", st.cycles, st.misses);
+
+    howdy_sched_summary_t sum;
+    howdy_sched_get_summary(&sum);
+    CHECK(sum.misses == 3 && sum.overruns == 1 && sum.max_consecutive_misses == 2,
+          "summary misses %u overruns %u max_consecutive %u",
+          sum.misses, sum.overruns, sum.max_consecutive_misses);
+    CHECK(strcmp(sum.worst_jitter_task, "capture") == 0 && sum.jitter_max_us == 1000,
+          "worst jitter %s %u", sum.worst_jitter_task, sum.jitter_max_us);
+
+    // A restarted task gets its old slot back, cleared
+    CHECK(howdy_sched_register("capture", PERIOD_US) == capture, "re-register reuses the slot");
+    st = stats_of("capture");
+    CHECK(st.cycles == 0 && st.misses == 0 && st.running, "re-register clears counters");
+
+    // Slots run out quietly; NULL is accepted everywhere
+    char name[HOWDY_SCHED_NAME_LEN];
+    for (int i = 2; i < HOWDY_SCHED_MAX_PERIODIC; i++) {
+        snprintf(name, sizeof(name), "task%d", i);
+        CHECK(howdy_sched_register(name, PERIOD_US) != NULL, "register %s", name);
+    }
+    howdy_sched_handle_t extra = howdy_sched_register("one_too_many", PERIOD_US);
+    CHECK(extra == NULL, "slot beyond HOWDY_SCHED_MAX_PERIODIC");
+    howdy_sched_wake(extra);
+    howdy_sched_done(extra);
+
+    CHECK(howdy_sched_sample() == ESP_ERR_NOT_SUPPORTED, "task list needs the trace facility");
+
+    howdy_sched_unregister(playback);
+    CHECK(!stats_of("playback").running, "unregister");
+
+    if (host_check_status()) {
+        return 1;
+    }
+    printf("sched monitor: jitter, overruns, misses, idle, delay_until and slots ok\n");
+    return 0;
+}
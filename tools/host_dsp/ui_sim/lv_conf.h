@@ -0,0 +1,48 @@
+/*
+ * LVGL 8.3 configuration for the host UI simulator. Mirrors the firmware's
+ * sdkconfig (CONFIG_LV_*) so the same code paths render; anything not set
+ * here takes the lv_conf_internal.h default, as it does on the device.
+ */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH              16
+#define LV_COLOR_16_SWAP            1
+#define LV_COLOR_MIX_ROUND_OFS      128
+
+// The device pool is 32 KB; objects hold twice as many pointer bytes on a 64-bit host
+#define LV_MEM_SIZE                 (64U * 1024U)
+#define LV_MEM_BUF_MAX_NUM          16
+
+#define LV_DISP_DEF_REFR_PERIOD     30
+#define LV_INDEV_DEF_READ_PERIOD    30
+#define LV_DPI_DEF                  130
+#define LV_TICK_CUSTOM              0
+
+#define LV_DRAW_COMPLEX             1
+#define LV_SHADOW_CACHE_SIZE        0
+#define LV_CIRCLE_CACHE_SIZE        4
+#define LV_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)
+#define LV_IMG_CACHE_DEF_SIZE       0
+#define LV_GRADIENT_MAX_STOPS       2
+#define LV_GRAD_CACHE_DEF_SIZE      0
+#define LV_DISP_ROT_MAX_BUF         (10 * 1024)
+
+#define LV_USE_LOG                  0
+#define LV_USE_ASSERT_NULL          1
+#define LV_USE_ASSERT_MALLOC        1
+#define LV_USE_PERF_MONITOR         0
+#define LV_USE_MEM_MONITOR          0
+#define LV_USE_USER_DATA            1
+
+#define LV_FONT_MONTSERRAT_14       1
+#define LV_FONT_MONTSERRAT_16       1
+#define LV_FONT_MONTSERRAT_24       1
+#define LV_FONT_MONTSERRAT_32       1
+#define LV_FONT_DEFAULT             &lv_font_montserrat_14
+#define LV_USE_FONT_PLACEHOLDER     1
+
+#define LV_USE_SNAPSHOT             1
+#define LV_BUILD_EXAMPLES           0
+
+#endif /* LV_CONF_H */
@@ -0,0 +1,10 @@
+/*
+ * The Kconfig options the UI sources read, at their main/Kconfig.projbuild
+ * defaults. Edit here to simulate a different configuration.
+ */
+#pragma once
+
+#define CONFIG_HOWDY_UI_ROUND_CLIP          1
+#define CONFIG_HOWDY_UI_FRAME_GOVERNOR      1
+#define CONFIG_HOWDY_UI_SPRITE_CACHE_KB     768
+#define CONFIG_HOWDY_UI_ASSET_CACHE_KB      256
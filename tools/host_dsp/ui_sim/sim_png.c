@@ -0,0 +1,120 @@
+#include "sim_png.h"
+#include "esp_rom_crc.h"
+#include <stdio.h>
+#include <string.h>
+
+#define DEFLATE_STORED_MAX  65535
+
+typedef struct {
+    FILE *f;
+    uint32_t crc;           // Of the chunk being written
+    uint32_t adler_a;
+    uint32_t adler_b;
+    uint32_t block_left;    // Bytes until the next stored-block header
+    uint32_t raw_left;      // Image bytes still to come
+} png_writer_t;
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static void chunk_bytes(png_writer_t *w, const void *data, uint32_t len)
+{
+    fwrite(data, 1, len, w->f);
+    w->crc = esp_rom_crc32_le(w->crc, data, len);
+}
+
+static void chunk_begin(png_writer_t *w, const char *type, uint32_t len)
+{
+    uint8_t hdr[4];
+    put_be32(hdr, len);
+    fwrite(hdr, 1, 4, w->f);
+    w->crc = 0;
+    chunk_bytes(w, type, 4);
+}
+
+static void chunk_end(png_writer_t *w)
+{
+    uint8_t crc[4];
+    put_be32(crc, w->crc);
+    fwrite(crc, 1, 4, w->f);
+}
+
+// Image bytes go out in stored blocks with the Adler-32 zlib wants at the end
+static void deflate_bytes(png_writer_t *w, const uint8_t *data, uint32_t len)
+{
+    while (len > 0) {
+        if (w->block_left == 0) {
+            uint32_t n = w->raw_left < DEFLATE_STORED_MAX ? w->raw_left : DEFLATE_STORED_MAX;
+            uint8_t hdr[5] = {
+                n == w->raw_left ? 1 : 0,
+                (uint8_t)n, (uint8_t)(n >> 8),
+                (uint8_t)~n, (uint8_t)(~n >> 8),
+            };
+            chunk_bytes(w, hdr, sizeof(hdr));
+            w->block_left = n;
+        }
+        uint32_t n = len < w->block_left ? len : w->block_left;
+        chunk_bytes(w, data, n);
+        for (uint32_t i = 0; i < n; i++) {
+            w->adler_a = (w->adler_a + data[i]) % 65521;
+            w->adler_b = (w->adler_b + w->adler_a) % 65521;
+        }
+        w->block_left -= n;
+        w->raw_left -= n;
+        data += n;
+        len -= n;
+    }
+}
+
+int sim_png_write_rgb(const char *path, const uint8_t *rgb, int width, int height)
+{
+    static const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    png_writer_t w = { .adler_a = 1 };
+
+    w.f = fopen(path, "wb");
+    if (!w.f) {
+        return -1;
+    }
+    fwrite(signature, 1, sizeof(signature), w.f);
+
+    uint8_t ihdr[13];
+    put_be32(&ihdr[0], (uint32_t)width);
+    put_be32(&ihdr[4], (uint32_t)height);
+    ihdr[8] = 8;        // Bit depth
+    ihdr[9] = 2;        // Truecolour
+    ihdr[10] = 0;       // Deflate
+    ihdr[11] = 0;       // Adaptive filtering (every row uses "none")
+    ihdr[12] = 0;       // Not interlaced
+    chunk_begin(&w, "IHDR", sizeof(ihdr));
+    chunk_bytes(&w, ihdr, sizeof(ihdr));
+    chunk_end(&w);
+
+    const uint32_t row_bytes = (uint32_t)width * 3;
+    const uint32_t raw = (row_bytes + 1) * (uint32_t)height;
+    const uint32_t blocks = (raw + DEFLATE_STORED_MAX - 1) / DEFLATE_STORED_MAX;
+    w.raw_left = raw;
+
+    chunk_begin(&w, "IDAT", 2 + raw + 5 * blocks + 4);
+    static const uint8_t zlib_hdr[2] = { 0x78, 0x01 };
+    chunk_bytes(&w, zlib_hdr, sizeof(zlib_hdr));
+    for (int y = 0; y < height; y++) {
+        static const uint8_t filter_none = 0;
+        deflate_bytes(&w, &filter_none, 1);
+        deflate_bytes(&w, rgb + (size_t)y * row_bytes, row_bytes);
+    }
+    uint8_t adler[4];
+    put_be32(adler, (w.adler_b << 16) | w.adler_a);
+    chunk_bytes(&w, adler, sizeof(adler));
+    chunk_end(&w);
+
+    chunk_begin(&w, "IEND", 0);
+    chunk_end(&w);
+
+    int ok = !ferror(w.f);
+    return fclose(w.f) == 0 && ok ? 0 : -1;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Write 8-bit RGB pixels as a PNG
+ *
+ * Stored (uncompressed) deflate blocks, so no zlib is needed. Files are
+ * large (about 1.9 MB for 800x800) but byte-identical for identical
+ * pixels, which is what a snapshot diff wants.
+ *
+ * @return 0 on success, -1 if the file could not be written
+ */
+int sim_png_write_rgb(const char *path, const uint8_t *rgb, int width, int height);
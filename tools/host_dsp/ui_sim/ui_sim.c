@@ -0,0 +1,661 @@
+/*
+ * Headless UI simulator: runs the firmware's ui_manager on the host
+ * against LVGL with an in-memory 800x800 framebuffer, replays a script of
+ * state changes, mic/TTS levels and animation calls at their real times,
+ * and reports what every display refresh cost.
+ *
+ * LVGL time and esp_timer_get_time() both follow the script clock, so the
+ * UI's timers fire at the same moments as on the device. By default the
+ * replay is paced to the wall clock; --fast runs it as quickly as the host
+ * can, which gives the same frames.
+ *
+ * Per frame (one display refresh): render time on the host, pixels
+ * invalidated before round clipping, and bytes flushed. Exits 1 if
+ * --max-p95-us is given and the overall p95 render time exceeds it.
+ */
+#include "lvgl.h"
+#include "ui_manager.h"
+#include "ui_round_display.h"
+#include "ui_sprite_cache.h"
+#include "ui_frame_governor.h"
+#include "howdy_asset_pack.h"
+#include "host_shim.h"
+#include "sim_png.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SIM_HRES            800
+#define SIM_VRES            800
+#define SIM_FEED_PERIOD_MS  20      // Audio frame cadence the level updates arrive at
+#define SIM_TAIL_MS         1000    // Run on after the last event without an "end"
+#define SIM_MAX_FEEDERS     4
+#define SIM_STATE_COUNT     (UI_STATE_DISCONNECTED + 1)
+
+static const char *const s_state_names[SIM_STATE_COUNT] = {
+    "init", "idle", "error",
+    "wake_word_detected", "listening", "speech_detected", "processing",
+    "thinking", "speaking", "responding", "conversation_active", "session_ending",
+    "connecting", "discovering", "registered", "disconnected",
+};
+
+typedef struct {
+    uint32_t t_ms;
+    int line;
+    char cmd[24];
+    char arg[104];
+} sim_event_t;
+
+typedef struct {
+    uint32_t t_ms;
+    uint8_t state;
+    uint32_t render_us;
+    uint32_t inv_px;            // Invalidated, before round clipping
+    uint32_t flush_bytes;
+    uint16_t flushes;
+} sim_frame_t;
+
+typedef enum {
+    FEED_SPEECH,
+    FEED_TTS,
+} sim_feed_kind_t;
+
+typedef struct {
+    sim_feed_kind_t kind;
+    uint32_t start_ms;
+    uint32_t end_ms;
+    uint32_t next_ms;
+} sim_feeder_t;
+
+static struct {
+    lv_disp_t *disp;
+    lv_color_t *fb;
+    lv_timer_cb_t refr_cb;      // LVGL's (or the round clip's) refresh callback
+    uint32_t now_ms;
+
+    // Accumulated by flush_cb during one refresh
+    uint32_t flush_bytes;
+    uint16_t flushes;
+
+    sim_frame_t *frames;
+    size_t frame_count;
+    size_t frame_cap;
+
+    sim_feeder_t feeders[SIM_MAX_FEEDERS];
+    uint32_t lcg;
+    const char *snapshot_dir;
+    int snapshots;
+} s_sim = {
+    .lcg = 0x2545F491u,
+    .snapshot_dir = ".",
+};
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void sleep_ns(int64_t ns)
+{
+    struct timespec ts = { .tv_sec = ns / 1000000000, .tv_nsec = ns % 1000000000 };
+    nanosleep(&ts, NULL);
+}
+
+// ---- Display ----
+
+static void sim_flush_cb(lv_disp_drv_t *drv, const lv_area_t *area, lv_color_t *px)
+{
+    const int32_t w = lv_area_get_width(area);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&s_sim.fb[(size_t)y * SIM_HRES + area->x1], px, w * sizeof(lv_color_t));
+        px += w;
+    }
+    s_sim.flush_bytes += lv_area_get_size(area) * sizeof(lv_color_t);
+    s_sim.flushes++;
+    lv_disp_flush_ready(drv);
+}
+
+static void sim_record_frame(uint32_t render_us, uint32_t inv_px)
+{
+    if (s_sim.frame_count == s_sim.frame_cap) {
+        s_sim.frame_cap = s_sim.frame_cap ? s_sim.frame_cap * 2 : 1024;
+        s_sim.frames = realloc(s_sim.frames, s_sim.frame_cap * sizeof(sim_frame_t));
+        if (!s_sim.frames) {
+            fprintf(stderr, "out of memory\n");
+            exit(2);
+        }
+    }
+    s_sim.frames[s_sim.frame_count++] = (sim_frame_t) {
+        .t_ms = s_sim.now_ms,
+        .state = (uint8_t)ui_manager_get_state(),
+        .render_us = render_us,
+        .inv_px = inv_px,
+        .flush_bytes = s_sim.flush_bytes,
+        .flushes = s_sim.flushes,
+    };
+}
+
+// Wraps the display refresh timer, outside the round clip so it sees the areas as requested
+static void sim_refr_timer_cb(lv_timer_t *timer)
+{
+    uint32_t inv_px = 0;
+    for (int i = 0; i < s_sim.disp->inv_p; i++) {
+        if (!s_sim.disp->inv_area_joined[i]) {
+            inv_px += lv_area_get_size(&s_sim.disp->inv_areas[i]);
+        }
+    }
+
+    s_sim.flush_bytes = 0;
+    s_sim.flushes = 0;
+    int64_t start = now_ns();
+    s_sim.refr_cb(timer);
+    int64_t elapsed = now_ns() - start;
+
+    if (s_sim.flushes > 0) {
+        sim_record_frame((uint32_t)(elapsed / 1000), inv_px);
+    }
+}
+
+static lv_disp_t *sim_display_init(int buf_lines)
+{
+    static lv_disp_draw_buf_t draw_buf;
+    static lv_disp_drv_t drv;
+
+    size_t buf_px = (size_t)SIM_HRES * buf_lines;
+    lv_color_t *buf = malloc(buf_px * sizeof(lv_color_t));
+    s_sim.fb = calloc((size_t)SIM_HRES * SIM_VRES, sizeof(lv_color_t));
+    if (!buf || !s_sim.fb) {
+        return NULL;
+    }
+
+    // Single partial buffer, like bsp_display_start() with BSP_LCD_DRAW_BUFF_SIZE
+    lv_disp_draw_buf_init(&draw_buf, buf, NULL, buf_px);
+    lv_disp_drv_init(&drv);
+    drv.hor_res = SIM_HRES;
+    drv.ver_res = SIM_VRES;
+    drv.flush_cb = sim_flush_cb;
+    drv.draw_buf = &draw_buf;
+    return lv_disp_drv_register(&drv);
+}
+
+static void sim_hook_refresh(void)
+{
+    // After ui_manager_init() so this wraps the round clip rather than the reverse
+    s_sim.refr_cb = s_sim.disp->refr_timer->timer_cb;
+    lv_timer_set_cb(s_sim.disp->refr_timer, sim_refr_timer_cb);
+}
+
+// ---- Snapshots ----
+
+static int sim_snapshot(const char *name)
+{
+    uint8_t *rgb = malloc((size_t)SIM_HRES * SIM_VRES * 3);
+    if (!rgb) {
+        return -1;
+    }
+
+    // Corners outside the circle are black, as on the panel; with round
+    // clipping they are never flushed and would otherwise hold stale pixels
+    const float c = SIM_HRES / 2.0f;
+    uint8_t *out = rgb;
+    for (int y = 0; y < SIM_VRES; y++) {
+        for (int x = 0; x < SIM_HRES; x++) {
+            float dx = x + 0.5f - c, dy = y + 0.5f - c;
+            uint32_t argb = 0;
+            if (dx * dx + dy * dy <= c * c) {
+                argb = lv_color_to32(s_sim.fb[(size_t)y * SIM_HRES + x]);
+            }
+            *out++ = (uint8_t)(argb >> 16);
+            *out++ = (uint8_t)(argb >> 8);
+            *out++ = (uint8_t)argb;
+        }
+    }
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.png", s_sim.snapshot_dir, name);
+    int ret = sim_png_write_rgb(path, rgb, SIM_HRES, SIM_VRES);
+    free(rgb);
+    if (ret == 0) {
+        s_sim.snapshots++;
+    } else {
+        fprintf(stderr, "cannot write %s\n", path);
+    }
+    return ret;
+}
+
+// ---- Script ----
+
+static int sim_parse_state(const char *name)
+{
+    for (int i = 0; i < SIM_STATE_COUNT; i++) {
+        if (strcmp(name, s_state_names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool sim_parse_on(const char *arg)
+{
+    return strcmp(arg, "on") == 0 || strcmp(arg, "start") == 0 || strcmp(arg, "1") == 0;
+}
+
+static sim_event_t *sim_load_script(const char *path, size_t *count)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return NULL;
+    }
+
+    sim_event_t *events = NULL;
+    size_t n = 0, cap = 0;
+    uint32_t prev_ms = 0;
+    char line[256];
+    int lineno = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        char *hash = strchr(line, '#');
+        if (hash) {
+            *hash = '\0';
+        }
+        char time_tok[32];
+        int used = 0;
+        if (sscanf(line, " %31s %n", time_tok, &used) != 1) {
+            continue;
+        }
+
+        // "1500" is absolute, "+200" is relative to the previous event
+        char *end;
+        bool relative = time_tok[0] == '+';
+        unsigned long t = strtoul(time_tok + relative, &end, 10);
+        if (*end != '\0') {
+            fprintf(stderr, "%s:%d: bad time '%s'\n", path, lineno, time_tok);
+            goto fail;
+        }
+        t += relative ? prev_ms : 0;
+        if (t < prev_ms) {
+            fprintf(stderr, "%s:%d: time goes backwards\n", path, lineno);
+            goto fail;
+        }
+
+        if (n == cap) {
+            cap = cap ? cap * 2 : 64;
+            sim_event_t *grown = realloc(events, cap * sizeof(sim_event_t));
+            if (!grown) {
+                goto fail;
+            }
+            events = grown;
+        }
+        sim_event_t *ev = &events[n];
+        memset(ev, 0, sizeof(*ev));
+        ev->t_ms = (uint32_t)t;
+        ev->line = lineno;
+        if (sscanf(line + used, "%23s %103[^\n]", ev->cmd, ev->arg) < 1) {
+            fprintf(stderr, "%s:%d: missing command\n", path, lineno);
+            goto fail;
+        }
+        // Trim trailing whitespace left by a comment
+        for (size_t len = strlen(ev->arg); len > 0 && (ev->arg[len - 1] == ' ' || ev->arg[len - 1] == '\t' ||
+                                                       ev->arg[len - 1] == '\r'); len--) {
+            ev->arg[len - 1] = '\0';
+        }
+        prev_ms = (uint32_t)t;
+        n++;
+    }
+    fclose(f);
+    *count = n;
+    return events;
+
+fail:
+    fclose(f);
+    free(events);
+    return NULL;
+}
+
+static void sim_start_feeder(sim_feed_kind_t kind, uint32_t duration_ms)
+{
+    // Restarting a kind replaces it; otherwise take a finished slot
+    sim_feeder_t *slot = NULL;
+    for (int i = 0; i < SIM_MAX_FEEDERS; i++) {
+        sim_feeder_t *fd = &s_sim.feeders[i];
+        bool active = fd->end_ms > s_sim.now_ms;
+        if (active && fd->kind == kind) {
+            slot = fd;
+            break;
+        }
+        if (!active && !slot) {
+            slot = fd;
+        }
+    }
+    if (!slot) {
+        return;
+    }
+    slot->kind = kind;
+    slot->start_ms = s_sim.now_ms;
+    slot->end_ms = s_sim.now_ms + duration_ms;
+    slot->next_ms = s_sim.now_ms;
+}
+
+static uint32_t sim_rand(void)
+{
+    s_sim.lcg = s_sim.lcg * 1664525u + 1013904223u;
+    return s_sim.lcg >> 8;
+}
+
+// Deterministic syllable-rate envelope plus noise, one update per audio frame
+static void sim_run_feeders(void)
+{
+    for (int i = 0; i < SIM_MAX_FEEDERS; i++) {
+        sim_feeder_t *fd = &s_sim.feeders[i];
+        if (s_sim.now_ms >= fd->end_ms || s_sim.now_ms < fd->next_ms) {
+            continue;
+        }
+        fd->next_ms += SIM_FEED_PERIOD_MS;
+
+        float t = (s_sim.now_ms - fd->start_ms) / 1000.0f;
+        float rate = fd->kind == FEED_SPEECH ? 4.0f : 5.0f;
+        float env = sinf(2.0f * (float)M_PI * rate * t);
+        int level = 4 + (int)(sim_rand() % 6);
+        if (env > 0.0f) {
+            level += (int)(70.0f * env * (0.6f + (sim_rand() % 40) / 100.0f));
+        }
+        if (level > 100) {
+            level = 100;
+        }
+
+        if (fd->kind == FEED_SPEECH) {
+            ui_manager_update_mic_level(level, level > 20 ? 0.85f : 0.1f);
+        } else {
+            float progress = (float)(s_sim.now_ms - fd->start_ms) / (fd->end_ms - fd->start_ms);
+            ui_manager_update_tts_level(level, progress);
+        }
+    }
+}
+
+static int sim_run_event(const char *script, const sim_event_t *ev)
+{
+    const char *cmd = ev->cmd;
+    const char *arg = ev->arg;
+    esp_err_t ret = ESP_OK;
+
+    if (strcmp(cmd, "state") == 0) {
+        int state = sim_parse_state(arg);
+        if (state < 0) {
+            fprintf(stderr, "%s:%d: unknown state '%s'\n", script, ev->line, arg);
+            return -1;
+        }
+        ret = ui_manager_set_state((ui_state_t)state);
+    } else if (strcmp(cmd, "mic") == 0) {
+        int level = 0;
+        float vad = 0.0f;
+        sscanf(arg, "%d %f", &level, &vad);
+        ret = ui_manager_update_mic_level(level, vad);
+    } else if (strcmp(cmd, "tts_level") == 0) {
+        int level = 0;
+        float progress = 0.0f;
+        sscanf(arg, "%d %f", &level, &progress);
+        ret = ui_manager_update_tts_level(level, progress);
+    } else if (strcmp(cmd, "speech") == 0 || strcmp(cmd, "tts") == 0) {
+        sim_start_feeder(cmd[0] == 's' ? FEED_SPEECH : FEED_TTS, (uint32_t)strtoul(arg, NULL, 10));
+    } else if (strcmp(cmd, "wake") == 0) {
+        ret = ui_manager_show_wake_word_detection(strtof(arg, NULL), "hey howdy");
+    } else if (strcmp(cmd, "status") == 0) {
+        ret = ui_manager_update_status(arg);
+    } else if (strcmp(cmd, "mute") == 0) {
+        ret = ui_manager_set_mute(sim_parse_on(arg));
+    } else if (strcmp(cmd, "wifi") == 0) {
+        ret = ui_manager_set_wifi_strength(atoi(arg));
+    } else if (strcmp(cmd, "anim") == 0) {
+        char which[24] = "", action[16] = "";
+        sscanf(arg, "%23s %15s", which, action);
+        bool on = sim_parse_on(action);
+        if (strcmp(which, "breathing") == 0) {
+            ret = on ? ui_manager_start_breathing_animation() : ui_manager_stop_breathing_animation();
+        } else if (strcmp(which, "listening") == 0) {
+            ret = on ? ui_manager_start_listening_animation() : ui_manager_stop_listening_animation();
+        } else if (strcmp(which, "processing") == 0) {
+            ret = on ? ui_manager_start_processing_animation() : ui_manager_stop_processing_animation();
+        } else if (strcmp(which, "wake") == 0) {
+            ret = on ? ui_manager_start_wake_word_animation() : ui_manager_stop_wake_word_animation();
+        } else {
+            fprintf(stderr, "%s:%d: unknown animation '%s'\n", script, ev->line, which);
+            return -1;
+        }
+    } else if (strcmp(cmd, "pressure") == 0) {
+        static const char *const levels[] = { "none", "elevated", "critical" };
+        int level = -1;
+        for (int i = 0; i < 3; i++) {
+            level = strcmp(arg, levels[i]) == 0 ? i : level;
+        }
+        if (level < 0) {
+            fprintf(stderr, "%s:%d: unknown pressure '%s'\n", script, ev->line, arg);
+            return -1;
+        }
+        ui_frame_governor_report_audio_pressure((ui_audio_pressure_t)level);
+    } else if (strcmp(cmd, "snapshot") == 0) {
+        return sim_snapshot(arg[0] ? arg : "snapshot");
+    } else if (strcmp(cmd, "end") != 0) {
+        fprintf(stderr, "%s:%d: unknown command '%s'\n", script, ev->line, cmd);
+        return -1;
+    }
+
+    if (ret != ESP_OK) {
+        fprintf(stderr, "%s:%d: %s failed: %s\n", script, ev->line, cmd, esp_err_to_name(ret));
+    }
+    return 0;
+}
+
+// ---- Report ----
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t sim_report_row(const char *name, int state)
+{
+    uint32_t *render = malloc((s_sim.frame_count + 1) * sizeof(uint32_t));
+    size_t n = 0;
+    uint64_t inv_total = 0, flush_total = 0;
+    uint32_t inv_max = 0, flush_max = 0;
+
+    for (size_t i = 0; i < s_sim.frame_count; i++) {
+        const sim_frame_t *fr = &s_sim.frames[i];
+        if (state >= 0 && fr->state != state) {
+            continue;
+        }
+        render[n++] = fr->render_us;
+        inv_total += fr->inv_px;
+        flush_total += fr->flush_bytes;
+        inv_max = fr->inv_px > inv_max ? fr->inv_px : inv_max;
+        flush_max = fr->flush_bytes > flush_max ? fr->flush_bytes : flush_max;
+    }
+    if (n == 0) {
+        free(render);
+        return 0;
+    }
+
+    qsort(render, n, sizeof(uint32_t), cmp_u32);
+    uint32_t p95 = render[(n * 95) / 100 < n ? (n * 95) / 100 : n - 1];
+    printf("%-20s %7zu %8u %8u %8u %10.1f %9.1f %10.1f %9.1f\n",
+           name, n, render[n / 2], p95, render[n - 1],
+           inv_total / 1000.0 / n, inv_max / 1000.0,
+           flush_total / 1024.0 / n, flush_max / 1024.0);
+    free(render);
+    return p95;
+}
+
+static uint32_t sim_report(uint32_t sim_ms, double wall_s)
+{
+    printf("%-20s %7s %8s %8s %8s %10s %9s %10s %9s\n",
+           "state", "frames", "p50_us", "p95_us", "max_us", "inv_kpx", "max", "flush_KB", "max");
+    for (int s = 0; s < SIM_STATE_COUNT; s++) {
+        sim_report_row(s_state_names[s], s);
+    }
+    uint32_t p95 = sim_report_row("TOTAL", -1);
+
+    printf("%zu frames in %.1f s of script (%.1f fps), %.1f s wall\n",
+           s_sim.frame_count, sim_ms / 1000.0, s_sim.frame_count * 1000.0 / (sim_ms ? sim_ms : 1), wall_s);
+
+    ui_round_display_stats_t round;
+    ui_round_display_get_stats(&round);
+    if (round.px_requested > 0 && round.px_rendered <= round.px_requested) {
+        printf("round clip: %llu of %llu px rendered (%llu%% clipped), %lu areas split, %lu dropped\n",
+               (unsigned long long)round.px_rendered, (unsigned long long)round.px_requested,
+               (unsigned long long)(100 - round.px_rendered * 100 / round.px_requested),
+               (unsigned long)round.areas_split, (unsigned long)round.areas_dropped);
+    }
+
+    ui_sprite_cache_stats_t sprites;
+    ui_sprite_cache_get_stats(&sprites);
+    howdy_asset_stats_t assets;
+    howdy_asset_get_stats(&assets);
+    printf("sprites: %lu hits, %lu rendered, %zu KB; assets: %lu decodes, %lu us max\n",
+           (unsigned long)sprites.hits, (unsigned long)sprites.misses, sprites.bytes / 1024,
+           (unsigned long)assets.decodes, (unsigned long)assets.decode_us_max);
+    ui_frame_governor_stats_t pacing;
+    ui_frame_governor_get_stats(&pacing);
+    printf("pacing: %lu period changes, %lu frames skipped for audio pressure\n",
+           (unsigned long)pacing.period_changes, (unsigned long)pacing.skipped);
+    if (s_sim.snapshots > 0) {
+        printf("%d snapshots written to %s\n", s_sim.snapshots, s_sim.snapshot_dir);
+    }
+    return p95;
+}
+
+static int sim_write_csv(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "t_ms,state,render_us,inv_px,flush_bytes,flushes\n");
+    for (size_t i = 0; i < s_sim.frame_count; i++) {
+        const sim_frame_t *fr = &s_sim.frames[i];
+        fprintf(f, "%u,%s,%u,%u,%u,%u\n", fr->t_ms, s_state_names[fr->state],
+                fr->render_us, fr->inv_px, fr->flush_bytes, fr->flushes);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [script.txt] [--fast] [--buf-lines N] [--assets pack.bin]\n"
+            "          [--csv frames.csv] [--snapshot-dir DIR] [--max-p95-us N]\n"
+            "  default script: %s\n"
+            "  default pack:   %s\n", argv0, HOWDY_UI_SIM_SCRIPT_DEFAULT, HOWDY_ASSET_PACK_DEFAULT);
+}
+
+int main(int argc, char **argv)
+{
+    const char *script = HOWDY_UI_SIM_SCRIPT_DEFAULT;
+    const char *assets = HOWDY_ASSET_PACK_DEFAULT;
+    const char *csv = NULL;
+    bool fast = false;
+    int buf_lines = 2;
+    unsigned long max_p95_us = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--fast") == 0) {
+            fast = true;
+        } else if (strcmp(argv[i], "--buf-lines") == 0 && i + 1 < argc) {
+            buf_lines = atoi(argv[++i]);
+            if (buf_lines < 1 || buf_lines > SIM_VRES) {
+                fprintf(stderr, "--buf-lines must be 1..%d\n", SIM_VRES);
+                return 2;
+            }
+        } else if (strcmp(argv[i], "--assets") == 0 && i + 1 < argc) {
+            assets = argv[++i];
+        } else if (strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            csv = argv[++i];
+        } else if (strcmp(argv[i], "--snapshot-dir") == 0 && i + 1 < argc) {
+            s_sim.snapshot_dir = argv[++i];
+        } else if (strcmp(argv[i], "--max-p95-us") == 0 && i + 1 < argc) {
+            max_p95_us = strtoul(argv[++i], NULL, 10);
+        } else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            script = argv[i];
+        }
+    }
+
+    size_t event_count;
+    sim_event_t *events = sim_load_script(script, &event_count);
+    if (!events) {
+        return 2;
+    }
+    uint32_t end_ms = event_count ? events[event_count - 1].t_ms : 0;
+    if (!event_count || strcmp(events[event_count - 1].cmd, "end") != 0) {
+        end_ms += SIM_TAIL_MS;
+    }
+
+    // The firmware finds the pack in its flash partition
+    if (host_shim_add_partition("assets", 0x40, assets) != ESP_OK) {
+        fprintf(stderr, "warning: cannot read %s, character images disabled\n", assets);
+    }
+
+    host_shim_set_time_us(0);
+    lv_init();
+    s_sim.disp = sim_display_init(buf_lines);
+    if (!s_sim.disp) {
+        fprintf(stderr, "display init failed\n");
+        return 2;
+    }
+    if (ui_manager_init() != ESP_OK) {
+        fprintf(stderr, "ui_manager_init failed\n");
+        return 1;
+    }
+    sim_hook_refresh();
+
+    int ret = 0;
+    size_t next = 0;
+    int64_t wall_start = now_ns();
+
+    for (s_sim.now_ms = 0; s_sim.now_ms <= end_ms; s_sim.now_ms++) {
+        host_shim_set_time_us((int64_t)s_sim.now_ms * 1000);
+        while (next < event_count && events[next].t_ms <= s_sim.now_ms) {
+            if (sim_run_event(script, &events[next++]) != 0) {
+                ret = 2;
+                goto done;
+            }
+        }
+        sim_run_feeders();
+
+        if (s_sim.now_ms > 0) {
+            lv_tick_inc(1);
+        }
+        lv_timer_handler();
+
+        if (!fast) {
+            int64_t ahead = (int64_t)s_sim.now_ms * 1000000 - (now_ns() - wall_start);
+            if (ahead > 0) {
+                sleep_ns(ahead);
+            }
+        }
+    }
+
+    uint32_t p95 = sim_report(end_ms, (now_ns() - wall_start) / 1e9);
+    if (csv && sim_write_csv(csv) != 0) {
+        ret = 2;
+    }
+    if (max_p95_us && p95 > max_p95_us) {
+        printf("FAIL: p95 render %u us over the %lu us budget\n", p95, max_p95_us);
+        ret = ret ? ret : 1;
+    }
+
+done:
+    free(events);
+    free(s_sim.frames);
+    return ret;
+}